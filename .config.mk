@@ -0,0 +1,106 @@
+# Automatically generated by configure - DO NOT EDIT!
+CONFIGURE_ARGS = --disable-libav --disable-ffmpeg_static --disable-hdhomerun_static --disable-dvbscan --disable-avahi --disable-dbus_1 --python=python3 --nowerror --cflags=-fcommon
+ROOTDIR  ?= /root/repo
+BUILDDIR ?= /root/repo/build.linux
+PLATFORM ?= linux
+OSENV    ?= posix
+ARCH     ?= x86_64
+CPU      ?= generic
+COMPILER ?= gcc
+ifeq ($(origin CC),default)
+CC        = cc
+endif
+PYTHON   ?= python3
+GZIPCMD  ?= gzip
+BZIP2    ?= bzip2
+XGETTEXT ?= xgettext
+MSGMERGE ?= msgmerge
+PKG_CONFIG ?= pkg-config
+CFLAGS   += -fcommon
+LDFLAGS  += 
+prefix    = /usr/local
+bindir    = ${prefix}/bin
+mandir    = ${datadir}/man
+datadir   = ${prefix}/share
+libdir    = ${prefix}/lib
+CFLAGS_NO_WERROR = yes
+LDFLAGS += -lssl -lcrypto 
+CFLAGS  += 
+LDFLAGS += -lz 
+CFLAGS  += 
+CONFIG_PIE = yes
+CONFIG_CWC = yes
+CONFIG_CAPMT = yes
+CONFIG_CONSTCW = yes
+CONFIG_LINUXDVB = yes
+CONFIG_SATIP_SERVER = yes
+CONFIG_SATIP_CLIENT = yes
+CONFIG_HDHOMERUN_CLIENT = no
+CONFIG_HDHOMERUN_STATIC = no
+CONFIG_IPTV = yes
+CONFIG_TSFILE = yes
+CONFIG_DVBSCAN = no
+CONFIG_TIMESHIFT = yes
+CONFIG_TRACE = yes
+CONFIG_IMAGECACHE = yes
+CONFIG_AVAHI = no
+CONFIG_ZLIB = yes
+CONFIG_LIBAV = no
+CONFIG_FFMPEG_STATIC = no
+CONFIG_LIBX264 = yes
+CONFIG_LIBX264_STATIC = yes
+CONFIG_LIBX265 = yes
+CONFIG_LIBX265_STATIC = yes
+CONFIG_LIBVPX = yes
+CONFIG_LIBVPX_STATIC = yes
+CONFIG_LIBTHEORA = yes
+CONFIG_LIBTHEORA_STATIC = yes
+CONFIG_LIBVORBIS = yes
+CONFIG_LIBVORBIS_STATIC = yes
+CONFIG_LIBFDKAAC = yes
+CONFIG_LIBFDKAAC_STATIC = yes
+CONFIG_NVENC = no
+CONFIG_QSV = no
+CONFIG_LIBMFX_STATIC = yes
+CONFIG_INOTIFY = yes
+CONFIG_EPOLL = yes
+CONFIG_URIPARSER = no
+CONFIG_CCACHE = no
+CONFIG_TVHCSA = yes
+CONFIG_BUNDLE = no
+CONFIG_DVBCSA = no
+CONFIG_DVBEN50221 = no
+CONFIG_KQUEUE = no
+CONFIG_DBUS_1 = no
+CONFIG_ANDROID = no
+CONFIG_TSDEBUG = no
+CONFIG_GTIMER_CHECK = no
+CONFIG_LOCK_PROFILE = no
+CONFIG_SLOW_MEMORYINFO = no
+CONFIG_LIBSYSTEMD_DAEMON = no
+CONFIG_BINTRAY_CACHE = yes
+CONFIG_EXECINFO = yes
+CONFIG_MMX = yes
+CONFIG_SSE2 = yes
+CONFIG_W_UNUSED_RESULT = yes
+CONFIG_GETLOADAVG = yes
+CONFIG_ATOMIC64 = yes
+CONFIG_ATOMIC_TIME_T = yes
+CONFIG_LOCKOWNER = yes
+CONFIG_QSORT_R = yes
+CONFIG_GMTOFF = yes
+CONFIG_RECVMMSG = yes
+CONFIG_SENDMMSG = yes
+CONFIG_IFNAMES = yes
+CONFIG_PY_GZIP = yes
+CONFIG_BIN_PKG_CONFIG = yes
+CONFIG_BIN_XGETTEXT = yes
+CONFIG_BIN_MSGMERGE = yes
+CONFIG_BIN_GZIP = yes
+CONFIG_BIN_BZIP2 = yes
+CONFIG_SSL = yes
+CONFIG_LINUXDVBAPI = yes
+CONFIG_UPNP = yes
+CONFIG_INOTIFY_H = yes
+CONFIG_MPEGTS = yes
+CONFIG_MPEGTS_DVB = yes
@@ -0,0 +1,108 @@
+// Automatically generated by configure - DO NOT EDIT!
+
+#include "build.h"
+
+const char* build_config_str =
+  "Configure arguments:\n"
+  "  --disable-libav --disable-ffmpeg_static --disable-hdhomerun_static --disable-dvbscan --disable-avahi --disable-dbus_1 --python=python3 --nowerror --cflags=-fcommon" "\n"
+  "" "\n"
+  "Compiler:" "\n"
+  "  Using C compiler:                        cc" "\n"
+  "  Using C flags:                           -fcommon" "\n"
+  "  Build for arch:                          x86_64" "\n"
+  "" "\n"
+  "Binaries:" "\n"
+  "  Using PYTHON:                            python3" "\n"
+  "  Using GZIP:                              gzip" "\n"
+  "  Using BZIP2:                             bzip2" "\n"
+  "" "\n"
+  "Options:" "\n"
+  "  pie                                      yes" "\n"
+  "  cwc                                      yes" "\n"
+  "  capmt                                    yes" "\n"
+  "  constcw                                  yes" "\n"
+  "  linuxdvb                                 yes" "\n"
+  "  satip_server                             yes" "\n"
+  "  satip_client                             yes" "\n"
+  "  hdhomerun_client                         no" "\n"
+  "  hdhomerun_static                         no" "\n"
+  "  iptv                                     yes" "\n"
+  "  tsfile                                   yes" "\n"
+  "  dvbscan                                  no" "\n"
+  "  timeshift                                yes" "\n"
+  "  trace                                    yes" "\n"
+  "  imagecache                               yes" "\n"
+  "  avahi                                    no" "\n"
+  "  zlib                                     yes" "\n"
+  "  libav                                    no" "\n"
+  "  ffmpeg_static                            no" "\n"
+  "  libx264                                  yes" "\n"
+  "  libx264_static                           yes" "\n"
+  "  libx265                                  yes" "\n"
+  "  libx265_static                           yes" "\n"
+  "  libvpx                                   yes" "\n"
+  "  libvpx_static                            yes" "\n"
+  "  libtheora                                yes" "\n"
+  "  libtheora_static                         yes" "\n"
+  "  libvorbis                                yes" "\n"
+  "  libvorbis_static                         yes" "\n"
+  "  libfdkaac                                yes" "\n"
+  "  libfdkaac_static                         yes" "\n"
+  "  nvenc                                    no" "\n"
+  "  qsv                                      no" "\n"
+  "  libmfx_static                            yes" "\n"
+  "  inotify                                  yes" "\n"
+  "  epoll                                    yes" "\n"
+  "  uriparser                                no" "\n"
+  "  ccache                                   no" "\n"
+  "  tvhcsa                                   yes" "\n"
+  "  bundle                                   no" "\n"
+  "  dvbcsa                                   no" "\n"
+  "  dvben50221                               no" "\n"
+  "  kqueue                                   no" "\n"
+  "  dbus_1                                   no" "\n"
+  "  android                                  no" "\n"
+  "  tsdebug                                  no" "\n"
+  "  gtimer_check                             no" "\n"
+  "  lock_profile                             no" "\n"
+  "  slow_memoryinfo                          no" "\n"
+  "  libsystemd_daemon                        no" "\n"
+  "  bintray_cache                            yes" "\n"
+  "  execinfo                                 yes" "\n"
+  "  mmx                                      yes" "\n"
+  "  sse2                                     yes" "\n"
+  "  W_unused_result                          yes" "\n"
+  "  getloadavg                               yes" "\n"
+  "  atomic64                                 yes" "\n"
+  "  atomic_time_t                            yes" "\n"
+  "  lockowner                                yes" "\n"
+  "  qsort_r                                  yes" "\n"
+  "  gmtoff                                   yes" "\n"
+  "  recvmmsg                                 yes" "\n"
+  "  sendmmsg                                 yes" "\n"
+  "  ifnames                                  yes" "\n"
+  "  py_gzip                                  yes" "\n"
+  "  bin_pkg_config                           yes" "\n"
+  "  bin_xgettext                             yes" "\n"
+  "  bin_msgmerge                             yes" "\n"
+  "  bin_gzip                                 yes" "\n"
+  "  bin_bzip2                                yes" "\n"
+  "  ssl                                      yes" "\n"
+  "  linuxdvbapi                              yes" "\n"
+  "  upnp                                     yes" "\n"
+  "  inotify_h                                yes" "\n"
+  "  mpegts                                   yes" "\n"
+  "  mpegts_dvb                               yes" "\n"
+  "" "\n"
+  "Packages:" "\n"
+  "  openssl                                  3.0.17" "\n"
+  "  zlib                                     1.2.13" "\n"
+  "" "\n"
+  "Installation paths:" "\n"
+  "  Prefix:                                  /usr/local" "\n"
+  "  Binaries:                                ${prefix}/bin" "\n"
+  "  Libraries:                               ${prefix}/lib" "\n"
+  "  Data files:                              ${prefix}/share" "\n"
+  "  Man pages:                               ${datadir}/man" "\n"
+  "" "\n"
+  "";
@@ -0,0 +1,2 @@
+#include "build.h"
+const char* build_timestamp = "2026-10-18T17:42:15+00:00";
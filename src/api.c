@@ -20,6 +20,7 @@
 #include "tvheadend.h"
 #include "api.h"
 #include "access.h"
+#include "htsmsg_json.h"
 
 #include <string.h>
 
@@ -63,6 +64,13 @@ api_register_all ( const api_hook_t *hooks )
 int
 api_exec ( access_t *perm, const char *subsystem,
            htsmsg_t *args, htsmsg_t **resp )
+{
+  return api_exec_stream(perm, subsystem, args, resp, NULL);
+}
+
+int
+api_exec_stream ( access_t *perm, const char *subsystem,
+                  htsmsg_t *args, htsmsg_t **resp, api_stream_t *as )
 {
   api_hook_t h;
   api_link_t *ah, skel;
@@ -94,9 +102,65 @@ api_exec ( access_t *perm, const char *subsystem,
   // Note: this is not required (so no final validation)
 
   /* Execute */
+  if (as && ah->hook->ah_stream)
+    return ah->hook->ah_stream(perm, ah->hook->ah_opaque, op, args, resp, as);
   return ah->hook->ah_callback(perm, ah->hook->ah_opaque, op, args, resp);
 }
 
+/*
+ * Stream encoder
+ */
+void
+api_stream_begin ( api_stream_t *as, const char *name )
+{
+  as->as_started = 1;
+  as->as_rows    = 0;
+  htsbuf_append(&as->as_queue, "{", 1);
+  htsbuf_append_and_escape_jsonstr(&as->as_queue, name);
+  htsbuf_append(&as->as_queue, ":[", 2);
+}
+
+void
+api_stream_row ( api_stream_t *as, htsmsg_t *row )
+{
+  if (!as->as_error) {
+    if (as->as_rows++)
+      htsbuf_append(&as->as_queue, ",", 1);
+    htsmsg_json_serialize(row, &as->as_queue, 0);
+  }
+  htsmsg_destroy(row);
+}
+
+int
+api_stream_flush ( api_stream_t *as )
+{
+  if (as->as_error)
+    return -1;
+  if (as->as_queue.hq_size && as->as_write(as))
+    as->as_error = 1;
+  htsbuf_queue_flush(&as->as_queue);
+  return as->as_error ? -1 : 0;
+}
+
+int
+api_stream_end ( api_stream_t *as, htsmsg_t *tail )
+{
+  char *s;
+
+  htsbuf_append(&as->as_queue, "]", 1);
+  if (tail && !htsmsg_is_empty(tail)) {
+    /* continue the outer object with the tail fields */
+    s = htsmsg_json_serialize_to_str(tail, 0);
+    htsbuf_append(&as->as_queue, ",", 1);
+    htsbuf_append_str(&as->as_queue, s + 1);
+    free(s);
+  } else {
+    htsbuf_append(&as->as_queue, "}", 1);
+  }
+  htsmsg_destroy(tail);
+  return api_stream_flush(as);
+}
+
 static int
 api_serverinfo
   ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
@@ -127,6 +191,7 @@ void api_init ( void )
   api_service_init();
   api_channel_init();
   api_bouquet_init();
+  api_mcast_output_init();
   api_epg_init();
   api_epggrab_init();
   api_status_init();
@@ -147,6 +212,7 @@ void api_done ( void )
 {
   api_link_t *t;
 
+  api_idnode_done();
   while ((t = RB_FIRST(&api_hook_tree)) != NULL) {
     RB_REMOVE(&api_hook_tree, t, link);
     free(t);
@@ -21,6 +21,7 @@
 #define __TVH_API_H__
 
 #include "htsmsg.h"
+#include "htsbuf.h"
 #include "idnode.h"
 #include "redblack.h"
 #include "access.h"
@@ -35,12 +36,38 @@ typedef int (*api_callback_t)
   ( access_t *perm, void *opaque, const char *op,
     htsmsg_t *args, htsmsg_t **resp );
 
+/*
+ * Streamed (JSON) output for large replies
+ *
+ * The rows are serialized as they are produced and written out by
+ * the transport in batches (as_write), the handler should call
+ * api_stream_flush() without the global_lock held.
+ */
+typedef struct api_stream
+{
+  htsbuf_queue_t      as_queue;
+  int                 as_started;
+  int                 as_rows;
+  int                 as_error;
+  void               *as_opaque;
+  int               (*as_write)(struct api_stream *as);
+} api_stream_t;
+
+typedef int (*api_stream_callback_t)
+  ( access_t *perm, void *opaque, const char *op,
+    htsmsg_t *args, htsmsg_t **resp, api_stream_t *as );
+
+/* Minimum rows to stream the reply, rows per batch */
+#define API_STREAM_MIN_ROWS 500
+#define API_STREAM_BATCH    256
+
 typedef struct api_hook
 {
-  const char         *ah_subsystem;
-  int                 ah_access;
-  api_callback_t      ah_callback;
-  void               *ah_opaque;
+  const char           *ah_subsystem;
+  int                   ah_access;
+  api_callback_t        ah_callback;
+  void                 *ah_opaque;
+  api_stream_callback_t ah_stream;
 } api_hook_t;
 
 /*
@@ -55,6 +82,21 @@ void api_register_all ( const api_hook_t *hooks );
 int  api_exec ( access_t *perm, const char *subsystem,
                 htsmsg_t *args, htsmsg_t **resp );
 
+/*
+ * Execute, the handler may stream the reply through \p as instead
+ * of returning \p resp (as->as_started is set then)
+ */
+int  api_exec_stream ( access_t *perm, const char *subsystem,
+                       htsmsg_t *args, htsmsg_t **resp, api_stream_t *as );
+
+/*
+ * Stream encoder - {"<name>":[<row>,...],<tail fields>}
+ */
+void api_stream_begin ( api_stream_t *as, const char *name );
+void api_stream_row   ( api_stream_t *as, htsmsg_t *row );
+int  api_stream_flush ( api_stream_t *as );
+int  api_stream_end   ( api_stream_t *as, htsmsg_t *tail );
+
 /*
  * Initialise
  */
@@ -62,10 +104,12 @@ void api_init               ( void );
 void api_done               ( void );
 void api_config_init        ( void );
 void api_idnode_init        ( void );
+void api_idnode_done        ( void );
 void api_input_init         ( void );
 void api_service_init       ( void );
 void api_channel_init       ( void );
 void api_bouquet_init       ( void );
+void api_mcast_output_init ( void );
 void api_mpegts_init        ( void );
 void api_epg_init           ( void );
 void api_epggrab_init       ( void );
@@ -104,6 +148,10 @@ htsmsg_t *api_idnode_flist_conf
 int api_idnode_grid
   ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp );
 
+int api_idnode_grid_stream
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp,
+    api_stream_t *as );
+
 int api_idnode_class
   ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp );
 
@@ -165,16 +165,16 @@ void api_access_init ( void )
 {
   static api_hook_t ah[] = {
     { "passwd/entry/class",  ACCESS_ADMIN, api_idnode_class, (void*)&passwd_entry_class },
-    { "passwd/entry/grid",   ACCESS_ADMIN, api_idnode_grid,  api_passwd_entry_grid },
+    { "passwd/entry/grid",   ACCESS_ADMIN, api_idnode_grid,  api_passwd_entry_grid, api_idnode_grid_stream },
     { "passwd/entry/create", ACCESS_ADMIN, api_passwd_entry_create, NULL },
 
     { "ipblock/entry/class",  ACCESS_ADMIN, api_idnode_class, (void*)&ipblock_entry_class },
-    { "ipblock/entry/grid",   ACCESS_ADMIN, api_idnode_grid,  api_ipblock_entry_grid },
+    { "ipblock/entry/grid",   ACCESS_ADMIN, api_idnode_grid,  api_ipblock_entry_grid, api_idnode_grid_stream },
     { "ipblock/entry/create", ACCESS_ADMIN, api_ipblock_entry_create, NULL },
 
     { "access/entry/class",  ACCESS_ADMIN, api_idnode_class, (void*)&access_entry_class },
     { "access/entry/userlist", ACCESS_ANONYMOUS, api_access_entry_userlist, NULL },
-    { "access/entry/grid",   ACCESS_ADMIN, api_idnode_grid,  api_access_entry_grid },
+    { "access/entry/grid",   ACCESS_ADMIN, api_idnode_grid,  api_access_entry_grid, api_idnode_grid_stream },
     { "access/entry/create", ACCESS_ADMIN, api_access_entry_create, NULL },
 
     { NULL },
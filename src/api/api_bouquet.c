@@ -86,7 +86,7 @@ void api_bouquet_init ( void )
   static api_hook_t ah[] = {
     { "bouquet/list",    ACCESS_ADMIN, api_bouquet_list, NULL },
     { "bouquet/class",   ACCESS_ADMIN, api_idnode_class, (void*)&bouquet_class },
-    { "bouquet/grid",    ACCESS_ADMIN, api_idnode_grid,  api_bouquet_grid },
+    { "bouquet/grid",    ACCESS_ADMIN, api_idnode_grid,  api_bouquet_grid, api_idnode_grid_stream },
     { "bouquet/create",  ACCESS_ADMIN, api_bouquet_create, NULL },
 
     { NULL },
@@ -161,12 +161,12 @@ void api_channel_init ( void )
 {
   static api_hook_t ah[] = {
     { "channel/class",   ACCESS_ANONYMOUS, api_idnode_class, (void*)&channel_class },
-    { "channel/grid",    ACCESS_ANONYMOUS, api_idnode_grid,  api_channel_grid },
+    { "channel/grid",    ACCESS_ANONYMOUS, api_idnode_grid,  api_channel_grid, api_idnode_grid_stream },
     { "channel/list",    ACCESS_ANONYMOUS, api_channel_list, NULL },
     { "channel/create",  ACCESS_ADMIN,     api_channel_create, NULL },
 
     { "channeltag/class",ACCESS_ANONYMOUS, api_idnode_class, (void*)&channel_tag_class },
-    { "channeltag/grid", ACCESS_ANONYMOUS, api_idnode_grid,  api_channel_tag_grid },
+    { "channeltag/grid", ACCESS_ANONYMOUS, api_idnode_grid,  api_channel_tag_grid, api_idnode_grid_stream },
     { "channeltag/list", ACCESS_ANONYMOUS, api_channel_tag_list, NULL },
     { "channeltag/create",  ACCESS_ADMIN,  api_channel_tag_create, NULL },
 
@@ -301,9 +301,46 @@ api_epg_decode_channel_num ( const char *s )
    return v;
 }
 
+/*
+ * Streamed grid rows - the global_lock is released between the batches,
+ * the broadcasts are looked up again by id (called with the global_lock
+ * held, returns unlocked)
+ */
+static void
+api_epg_grid_stream0
+  ( access_t *perm, epg_query_t *eq, uint32_t start, uint32_t end,
+    const char *lang, api_stream_t *as )
+{
+  epg_broadcast_t *ebc;
+  htsmsg_t *e;
+  uint32_t *ids, i, j, count = end - start;
+  int r;
+
+  ids = malloc(count * sizeof(uint32_t));
+  for (i = 0; i < count; i++)
+    ids[i] = eq->result[start + i]->id;
+
+  api_stream_begin(as, "entries");
+  for (i = 0; i < count; ) {
+    for (j = 0; j < API_STREAM_BATCH && i < count; j++, i++) {
+      if ((ebc = epg_broadcast_find_by_id(ids[i])) == NULL)
+        continue;
+      if ((e = api_epg_entry(ebc, lang, perm)))
+        api_stream_row(as, e);
+    }
+    pthread_mutex_unlock(&global_lock);
+    r = api_stream_flush(as);
+    if (r || i >= count)
+      break;
+    pthread_mutex_lock(&global_lock);
+  }
+
+  free(ids);
+}
+
 static int
-api_epg_grid
-  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+api_epg_grid0
+  ( access_t *perm, htsmsg_t *args, htsmsg_t **resp, api_stream_t *as )
 {
   int i;
   epg_query_t eq;
@@ -456,6 +493,18 @@ api_epg_grid
   /* Build response */
   start = MIN(eq.entries, start);
   end   = MIN(eq.entries, start + limit);
+
+  /* Large page - stream */
+  if (as && end - start >= API_STREAM_MIN_ROWS) {
+    api_epg_grid_stream0(perm, &eq, start, end, lang, as);
+    epg_query_free(&eq);
+    free(lang);
+    e = htsmsg_create_map();
+    htsmsg_add_u32(e, "totalCount", eq.entries);
+    api_stream_end(as, e);
+    return 0;
+  }
+
   l     = htsmsg_create_list();
   for (i = start; i < end; i++) {
     if (!(e = api_epg_entry(eq.result[i], lang, perm))) continue;
@@ -474,6 +523,21 @@ api_epg_grid
   return 0;
 }
 
+static int
+api_epg_grid
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+{
+  return api_epg_grid0(perm, args, resp, NULL);
+}
+
+static int
+api_epg_grid_stream
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp,
+    api_stream_t *as )
+{
+  return api_epg_grid0(perm, args, resp, as);
+}
+
 static void
 api_epg_episode_broadcasts
   ( access_t *perm, htsmsg_t *l, const char *lang, epg_episode_t *ep,
@@ -643,7 +707,7 @@ api_epg_content_type_list(access_t *perm, void *opaque, const char *op,
 void api_epg_init ( void )
 {
   static api_hook_t ah[] = {
-    { "epg/events/grid",        ACCESS_ANONYMOUS, api_epg_grid, NULL },
+    { "epg/events/grid",        ACCESS_ANONYMOUS, api_epg_grid, NULL, api_epg_grid_stream },
     { "epg/events/alternative", ACCESS_ANONYMOUS, api_epg_alternative, NULL },
     { "epg/events/related",     ACCESS_ANONYMOUS, api_epg_related, NULL },
     { "epg/events/load",        ACCESS_ANONYMOUS, api_epg_load, NULL },
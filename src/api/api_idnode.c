@@ -21,6 +21,7 @@
 #include "access.h"
 #include "idnode.h"
 #include "htsmsg.h"
+#include "htsmsg_json.h"
 #include "api.h"
 
 htsmsg_t *
@@ -115,43 +116,242 @@ api_idnode_grid_conf
     conf->sort.key = NULL;
 }
 
-int
-api_idnode_grid
-  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+/*
+ * Grid cursors - the filtered and sorted node sets are kept for a short
+ * time, so the paging requests (start/limit) do not rebuild and re-sort
+ * the whole set. A cursor is valid only while no idnode was created,
+ * changed or removed (the node pointers are not referenced otherwise).
+ */
+#define API_IDNODE_CURSOR_MAX     8
+#define API_IDNODE_CURSOR_TIMEOUT 15 /* seconds */
+
+typedef struct api_idnode_cursor {
+  LIST_ENTRY(api_idnode_cursor) aic_link;
+  void         *aic_opaque;
+  char         *aic_key;
+  int           aic_gen;
+  int64_t       aic_expire;
+  idnode_set_t  aic_set;
+} api_idnode_cursor_t;
+
+static LIST_HEAD(, api_idnode_cursor) api_idnode_cursors;
+static int api_idnode_cursor_count;
+
+static void
+api_idnode_cursor_destroy ( api_idnode_cursor_t *aic )
+{
+  LIST_REMOVE(aic, aic_link);
+  api_idnode_cursor_count--;
+  free(aic->aic_set.is_array);
+  free(aic->aic_key);
+  free(aic);
+}
+
+/*
+ * Everything except the paging arguments, plus the access fields
+ * used by the grid callbacks and idnode_perm()
+ */
+static char *
+api_idnode_cursor_key ( access_t *perm, htsmsg_t *args )
+{
+  htsbuf_queue_t q;
+  htsmsg_t *m = htsmsg_copy(args);
+  htsmsg_field_t *f;
+  char *s;
+  int i;
+
+  htsmsg_delete_field(m, "start");
+  htsmsg_delete_field(m, "limit");
+  htsbuf_queue_init(&q, 0);
+  s = htsmsg_json_serialize_to_str(m, 0);
+  htsbuf_qprintf(&q, "%s\n%s\n%s\n%s\n%08x\n", s ?: "",
+                 perm->aa_username ?: "", perm->aa_representative ?: "",
+                 perm->aa_lang_ui ?: "", perm->aa_rights);
+  free(s);
+  htsmsg_destroy(m);
+  for (i = 0; i < perm->aa_chrange_count; i++)
+    htsbuf_qprintf(&q, "%"PRIu64",", perm->aa_chrange[i]);
+  if (perm->aa_chtags)
+    HTSMSG_FOREACH(f, perm->aa_chtags)
+      htsbuf_qprintf(&q, "%s,", htsmsg_field_get_str(f) ?: "");
+  if (perm->aa_dvrcfgs)
+    HTSMSG_FOREACH(f, perm->aa_dvrcfgs)
+      htsbuf_qprintf(&q, "%s;", htsmsg_field_get_str(f) ?: "");
+  s = htsbuf_to_string(&q);
+  htsbuf_queue_flush(&q);
+  return s;
+}
+
+static api_idnode_cursor_t *
+api_idnode_cursor_find ( void *opaque, const char *key )
+{
+  api_idnode_cursor_t *aic, *aic_next;
+  int gen = idnode_generation();
+  int64_t now = mclk();
+
+  lock_assert(&global_lock);
+
+  for (aic = LIST_FIRST(&api_idnode_cursors); aic; aic = aic_next) {
+    aic_next = LIST_NEXT(aic, aic_link);
+    if (aic->aic_gen != gen || aic->aic_expire < now) {
+      api_idnode_cursor_destroy(aic);
+      continue;
+    }
+    if (aic->aic_opaque == opaque && !strcmp(aic->aic_key, key)) {
+      /* move to front (LRU) */
+      LIST_REMOVE(aic, aic_link);
+      LIST_INSERT_HEAD(&api_idnode_cursors, aic, aic_link);
+      return aic;
+    }
+  }
+  return NULL;
+}
+
+static api_idnode_cursor_t *
+api_idnode_cursor_create ( void *opaque, char *key, idnode_set_t *ins )
+{
+  api_idnode_cursor_t *aic, *last = NULL;
+
+  lock_assert(&global_lock);
+
+  if (api_idnode_cursor_count >= API_IDNODE_CURSOR_MAX) {
+    LIST_FOREACH(aic, &api_idnode_cursors, aic_link)
+      last = aic;
+    if (last)
+      api_idnode_cursor_destroy(last);
+  }
+  aic = calloc(1, sizeof(*aic));
+  aic->aic_opaque = opaque;
+  aic->aic_key    = key;
+  aic->aic_gen    = idnode_generation();
+  aic->aic_expire = mclk() + sec2mono(API_IDNODE_CURSOR_TIMEOUT);
+  aic->aic_set    = *ins;
+  LIST_INSERT_HEAD(&api_idnode_cursors, aic, aic_link);
+  api_idnode_cursor_count++;
+  return aic;
+}
+
+/* the grid response entries are allocated from one arena */
+#define API_IDNODE_GRID_ARENA (64*1024)
+
+/*
+ * Streamed grid rows - the global_lock is released between the batches,
+ * the node pointers are revalidated (by uuid) when some node changed
+ */
+static void
+api_idnode_grid_rows_stream
+  ( access_t *perm, idnode_set_t *ins, api_idnode_grid_conf_t *conf,
+    htsmsg_t *flist, api_stream_t *as )
+{
+  idnode_t **nodes, *in;
+  tvh_uuid_t *uuids;
+  htsmsg_t *e;
+  uint32_t i, j, k, count = ins->is_count - conf->start;
+  char ubuf[UUID_HEX_SIZE];
+  int gen, r;
+
+  nodes = malloc(count * sizeof(idnode_t *));
+  uuids = malloc(count * sizeof(tvh_uuid_t));
+  for (i = 0; i < count; i++) {
+    nodes[i] = ins->is_array[conf->start + i];
+    uuids[i] = nodes[i]->in_uuid;
+  }
+
+  api_stream_begin(as, "entries");
+  for (i = 0; i < count && conf->limit != 0; ) {
+    for (j = 0; j < API_STREAM_BATCH && i < count && conf->limit != 0; j++, i++) {
+      if ((in = nodes[i]) == NULL)
+        continue;
+      if (idnode_perm(in, perm, NULL))
+        continue;
+      e = htsmsg_create_map();
+      htsmsg_add_str(e, "uuid", idnode_uuid_as_str(in, ubuf));
+      idnode_read0(in, e, flist, 0, conf->sort.lang);
+      idnode_perm_unset(in);
+      api_stream_row(as, e);
+      if (conf->limit > 0) conf->limit--;
+    }
+    gen = idnode_generation();
+    pthread_mutex_unlock(&global_lock);
+    r = api_stream_flush(as);
+    pthread_mutex_lock(&global_lock);
+    if (r)
+      break;
+    if (gen != idnode_generation())
+      for (k = i; k < count; k++) {
+        bin2hex(ubuf, sizeof(ubuf), uuids[k].bin, sizeof(uuids[k].bin));
+        nodes[k] = idnode_find(ubuf, NULL, NULL);
+      }
+  }
+
+  free(uuids);
+  free(nodes);
+}
+
+static int
+api_idnode_grid0
+  ( access_t *perm, void *opaque, htsmsg_t *args, htsmsg_t **resp,
+    api_stream_t *as )
 {
   int i;
   htsmsg_t *list, *e;
   htsmsg_t *flist = api_idnode_flist_conf(args, "list");
   api_idnode_grid_conf_t conf = { 0 };
+  api_idnode_cursor_t *aic;
   idnode_t *in;
   idnode_set_t ins = { 0 };
   api_idnode_grid_callback_t cb = opaque;
   char ubuf[UUID_HEX_SIZE];
+  char *key;
 
   /* Grid configuration */
   api_idnode_grid_conf(perm, args, &conf);
+  key = api_idnode_cursor_key(perm, args);
 
-  /* Create list */
   pthread_mutex_lock(&global_lock);
-  cb(perm, &ins, &conf, args);
 
-  /* Sort */
-  if (conf.sort.key)
-    idnode_set_sort(&ins, &conf.sort);
+  if ((aic = api_idnode_cursor_find(opaque, key)) != NULL) {
+    /* Reuse the previous (sorted) list */
+    ins = aic->aic_set;
+    free(key);
+  } else {
+    /* Create list */
+    cb(perm, &ins, &conf, args);
+
+    /* Sort */
+    if (conf.sort.key)
+      idnode_set_sort(&ins, &conf.sort);
+
+    aic = api_idnode_cursor_create(opaque, key, &ins);
+  }
+
+  /* Large page - stream */
+  if (as && conf.start < ins.is_count &&
+      MIN(ins.is_count - conf.start, conf.limit) >= API_STREAM_MIN_ROWS) {
+    e = htsmsg_create_map();
+    htsmsg_add_u32(e, "total", ins.is_count);
+    api_idnode_grid_rows_stream(perm, &ins, &conf, flist, as);
+    pthread_mutex_unlock(&global_lock);
+    api_stream_end(as, e);
+    goto cleanup;
+  }
 
   /* Paginate */
-  list  = htsmsg_create_list();
+  list  = htsmsg_create_list_arena(API_IDNODE_GRID_ARENA);
   for (i = conf.start; i < ins.is_count && conf.limit != 0; i++) {
     in = ins.is_array[i];
-    e = htsmsg_create_map();
+    e = htsmsg_create_map_in(list);
     htsmsg_add_str(e, "uuid", idnode_uuid_as_str(in, ubuf));
-    if (idnode_perm(in, perm, NULL))
+    if (idnode_perm(in, perm, NULL)) {
+      htsmsg_destroy(e);
       continue;
+    }
     idnode_read0(in, e, flist, 0, conf.sort.lang);
     idnode_perm_unset(in);
     htsmsg_add_msg(list, NULL, e);
     if (conf.limit > 0) conf.limit--;
   }
+  htsmsg_arena_seal(list);
 
   pthread_mutex_unlock(&global_lock);
 
@@ -160,14 +360,28 @@ api_idnode_grid
   htsmsg_add_msg(*resp, "entries", list);
   htsmsg_add_u32(*resp, "total",   ins.is_count);
 
-  /* Cleanup */
-  free(ins.is_array);
+cleanup:
   idnode_filter_clear(&conf.filter);
   htsmsg_destroy(flist);
 
   return 0;
 }
 
+int
+api_idnode_grid
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+{
+  return api_idnode_grid0(perm, opaque, args, resp, NULL);
+}
+
+int
+api_idnode_grid_stream
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp,
+    api_stream_t *as )
+{
+  return api_idnode_grid0(perm, opaque, args, resp, as);
+}
+
 static int
 api_idnode_load_by_class0
   ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
@@ -739,3 +953,11 @@ void api_idnode_init ( void )
 
   api_register_all(ah);
 }
+
+void api_idnode_done ( void )
+{
+  api_idnode_cursor_t *aic;
+
+  while ((aic = LIST_FIRST(&api_idnode_cursors)) != NULL)
+    api_idnode_cursor_destroy(aic);
+}
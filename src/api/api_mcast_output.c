@@ -0,0 +1,70 @@
+/*
+ *  API - multicast output calls
+ *
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TVH_API_MCAST_OUTPUT_H__
+#define __TVH_API_MCAST_OUTPUT_H__
+
+#include "tvheadend.h"
+#include "mcast_output.h"
+#include "access.h"
+#include "api.h"
+
+static void
+api_mcast_output_grid
+  ( access_t *perm, idnode_set_t *ins, api_idnode_grid_conf_t *conf, htsmsg_t *args )
+{
+  mcast_output_t *mo;
+
+  TAILQ_FOREACH(mo, &mcast_outputs, mo_link)
+    idnode_set_add(ins, (idnode_t*)mo, &conf->filter, perm->aa_lang_ui);
+}
+
+static int
+api_mcast_output_create
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+{
+  htsmsg_t *conf;
+  mcast_output_t *mo;
+
+  if (!(conf = htsmsg_get_map(args, "conf")))
+    return EINVAL;
+
+  pthread_mutex_lock(&global_lock);
+  mo = mcast_output_create(NULL, conf);
+  if (mo)
+    idnode_changed(&mo->mo_id);
+  pthread_mutex_unlock(&global_lock);
+
+  return 0;
+}
+
+void api_mcast_output_init ( void )
+{
+  static api_hook_t ah[] = {
+    { "mcast_output/class",  ACCESS_ADMIN, api_idnode_class, (void*)&mcast_output_class },
+    { "mcast_output/grid",   ACCESS_ADMIN, api_idnode_grid,  api_mcast_output_grid, api_idnode_grid_stream },
+    { "mcast_output/create", ACCESS_ADMIN, api_mcast_output_create, NULL },
+
+    { NULL },
+  };
+
+  api_register_all(ah);
+}
+
+#endif /* __TVH_API_MCAST_OUTPUT_H__ */
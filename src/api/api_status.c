@@ -163,6 +163,46 @@ api_status_input_clear_stats
   return 0;
 }
 
+static int
+api_status_timers
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+{
+  htsmsg_t *l;
+  int reset = htsmsg_get_bool_or_default(args, "reset", 0);
+
+  pthread_mutex_lock(&global_lock);
+  l = tvh_timer_stats(reset);
+  pthread_mutex_unlock(&global_lock);
+
+  *resp = htsmsg_create_map();
+  htsmsg_add_msg(*resp, "entries", l);
+  htsmsg_add_u32(*resp, "totalCount", 2);
+
+  return 0;
+}
+
+static int
+api_status_tasklets
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+{
+  htsmsg_t *l = tasklet_stats(htsmsg_get_bool_or_default(args, "reset", 0));
+
+  *resp = htsmsg_create_map();
+  htsmsg_add_msg(*resp, "entries", l);
+  htsmsg_add_u32(*resp, "totalCount", 2);
+
+  return 0;
+}
+
+static int
+api_status_locks
+  ( access_t *perm, void *opaque, const char *op, htsmsg_t *args, htsmsg_t **resp )
+{
+  *resp = tvh_lockprof_stats(htsmsg_get_bool_or_default(args, "reset", 0),
+                             htsmsg_get_s32_or_default(args, "limit", 0));
+  return 0;
+}
+
 void api_status_init ( void )
 {
   static api_hook_t ah[] = {
@@ -170,6 +210,9 @@ void api_status_init ( void )
     { "status/subscriptions", ACCESS_ADMIN, api_status_subscriptions, NULL },
     { "status/inputs",        ACCESS_ADMIN, api_status_inputs, NULL },
     { "status/inputclrstats", ACCESS_ADMIN, api_status_input_clear_stats, NULL },
+    { "status/timers",        ACCESS_ADMIN, api_status_timers, NULL },
+    { "status/tasklets",      ACCESS_ADMIN, api_status_tasklets, NULL },
+    { "status/locks",         ACCESS_ADMIN, api_status_locks, NULL },
     { "connections/cancel",   ACCESS_ADMIN, api_connections_cancel, NULL },
     { NULL },
   };
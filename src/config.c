@@ -34,6 +34,7 @@
 #include "satip/server.h"
 #include "channels.h"
 #include "input/mpegts/scanfile.h"
+#include "input/mpegts/mpegts_prewarm.h"
 
 #include <netinet/ip.h>
 
@@ -483,7 +484,7 @@ config_migrate_v2 ( void )
 {
   htsmsg_t *m;
   tvh_uuid_t u;
-  char src[1024], dst[1024];
+  char dst[1024];
 
   /* Do we have IPTV config to migrate ? */
   if (hts_settings_exists("input/iptv/muxes")) {
@@ -498,11 +499,8 @@ config_migrate_v2 ( void )
     htsmsg_destroy(m);
 
     /* Move muxes */
-    hts_settings_buildpath(src, sizeof(src),
-                           "input/iptv/muxes");
-    hts_settings_buildpath(dst, sizeof(dst),
-                           "input/iptv/networks/%s/muxes", u.hex);
-    rename(src, dst);
+    snprintf(dst, sizeof(dst), "input/iptv/networks/%s/muxes", u.hex);
+    hts_settings_move("input/iptv/muxes", dst);
   }
 }
 
@@ -512,16 +510,11 @@ config_migrate_v2 ( void )
 static void
 config_migrate_v3 ( void )
 {
-  char src[1024], dst[1024];
-
   /* Due to having to potentially run this twice! */
-  hts_settings_buildpath(dst, sizeof(dst), "input/dvb/networks");
-  if (!access(dst, R_OK | W_OK))
+  if (hts_settings_exists("input/dvb/networks"))
     return;
 
-  hts_settings_makedirs(dst);
-  hts_settings_buildpath(src, sizeof(src), "input/linuxdvb/networks");
-  rename(src, dst);
+  hts_settings_move("input/linuxdvb/networks", "input/dvb/networks");
 }
 
 /*
@@ -1620,10 +1613,10 @@ config_check ( void )
 static int config_newcfg = 0;
 
 void
-config_boot ( const char *path, gid_t gid, uid_t uid )
+config_boot ( const char *path, int store, gid_t gid, uid_t uid )
 {
   struct stat st;
-  char buf[1024];
+  char buf[1024], lpath[PATH_MAX];
   htsmsg_t *config2;
   htsmsg_field_t *f;
   const char *s;
@@ -1637,7 +1630,12 @@ config_boot ( const char *path, gid_t gid, uid_t uid )
   config.cookie_expires = 7;
   config.dscp = -1;
   config.descrambler_buffer = 9000;
+  config.gop_cache = 4096;
+  config.prewarm_weight = SUBSCRIPTION_PRIO_KEEP;
+  config.prewarm_timeout = 600;
   config.epg_compress = 1;
+  config.hls_segment_duration = 4;
+  config.hls_segments = 6;
   config_scanfile_ok = 0;
   config.theme_ui = strdup("blue");
 
@@ -1684,6 +1682,12 @@ config_boot ( const char *path, gid_t gid, uid_t uid )
   if (chown(config_lock, uid, gid))
     tvhwarn("config", "unable to chown lock file %s UID:%d GID:%d", config_lock, uid, gid);
 
+  /* Single-file store */
+  if (hts_settings_store(store) &&
+      !hts_settings_buildpath(lpath, sizeof(lpath), "settings.log") &&
+      chown(lpath, uid, gid))
+    tvhwarn("config", "unable to chown %s UID:%d GID:%d", lpath, uid, gid);
+
   /* Load global settings */
   config2 = hts_settings_load("config");
   if (!config2) {
@@ -1759,6 +1763,7 @@ void config_done ( void )
   free(config.chicon_path);
   free(config.picon_path);
   free(config.cors_origin);
+  free(config.hls_spill_path);
   file_unlock(config_lock, config_lock_fd);
 }
 
@@ -1832,6 +1837,19 @@ config_class_language_set ( void *o, const void *v )
   return 0;
 }
 
+static int
+config_class_prewarm_tuners_set ( void *o, const void *v )
+{
+  uint32_t u32 = *(uint32_t *)v;
+
+  if (u32 == config.prewarm_tuners)
+    return 0;
+  config.prewarm_tuners = u32;
+  if (u32 == 0)
+    mpegts_prewarm_changed();
+  return 1;
+}
+
 static htsmsg_t *
 config_class_language_list ( void *o, const char *lang )
 {
@@ -1963,8 +1981,9 @@ config_muxconfpath_notify ( void *o, const char *lang )
 {
 #if ENABLE_MPEGTS_DVB
   config_scanfile_ok = 1;
-  tasklet_arm_alloc(config_muxconfpath_notify_cb,
-                    config.muxconf_path ? strdup(config.muxconf_path) : NULL);
+  tasklet_arm_alloc_flags(config_muxconfpath_notify_cb,
+                          config.muxconf_path ? strdup(config.muxconf_path) : NULL,
+                          TASKLET_SERIAL);
 #endif
 }
 
@@ -2008,6 +2027,10 @@ const idclass_t config_class = {
          .name   = N_("Picon"),
          .number = 6,
       },
+      {
+         .name   = N_("HLS streaming"),
+         .number = 7,
+      },
       {}
   },
   .ic_properties = (const property_t[]){
@@ -2142,6 +2165,68 @@ const idclass_t config_class = {
       .opts   = PO_EXPERT,
       .group  = 1
     },
+    {
+      .type   = PT_INT,
+      .id     = "iptv_threads",
+      .name   = N_("IPTV input threads"),
+      .desc   = N_("The number of threads receiving the IPTV streams. "
+                   "The muxes are distributed to the least loaded "
+                   "thread. Zero means one thread per CPU core. "
+                   "The change takes effect after restart."),
+      .off    = offsetof(config_t, iptv_threads),
+      .opts   = PO_EXPERT,
+      .group  = 1
+    },
+    {
+      .type   = PT_U32,
+      .id     = "gop_cache",
+      .name   = N_("GOP cache size (KB)"),
+      .desc   = N_("The maximum size of the cached last group of "
+                   "pictures (from the last video keyframe) per running "
+                   "service. The cache is sent to the new subscribers "
+                   "of an already running service, so the playback can "
+                   "start immediately without waiting for the next "
+                   "keyframe. Zero disables the cache."),
+      .off    = offsetof(config_t, gop_cache),
+      .opts   = PO_EXPERT,
+      .group  = 1
+    },
+    {
+      .type   = PT_U32,
+      .id     = "prewarm_tuners",
+      .name   = N_("Predictive tuning - inputs"),
+      .desc   = N_("The maximum number of idle inputs (tuners) kept "
+                   "tuned to the muxes of the channels predicted "
+                   "from the zapping history of the streaming clients "
+                   "(the next channel in the zapping direction and "
+                   "the last watched channel). Zero disables the "
+                   "predictive tuning."),
+      .off    = offsetof(config_t, prewarm_tuners),
+      .set    = config_class_prewarm_tuners_set,
+      .opts   = PO_EXPERT,
+      .group  = 1
+    },
+    {
+      .type   = PT_U32,
+      .id     = "prewarm_weight",
+      .name   = N_("Predictive tuning - weight"),
+      .desc   = N_("The subscription weight of the predictive tuning. "
+                   "Any subscription with a higher weight takes "
+                   "over the pre-tuned input."),
+      .off    = offsetof(config_t, prewarm_weight),
+      .opts   = PO_EXPERT,
+      .group  = 1
+    },
+    {
+      .type   = PT_U32,
+      .id     = "prewarm_timeout",
+      .name   = N_("Predictive tuning - client timeout (sec)"),
+      .desc   = N_("Forget the zapping history of a client which "
+                   "has no streaming subscription for this time."),
+      .off    = offsetof(config_t, prewarm_timeout),
+      .opts   = PO_EXPERT,
+      .group  = 1
+    },
     {
       .type   = PT_STR,
       .islist = 1,
@@ -2310,6 +2395,41 @@ const idclass_t config_class = {
       .opts   = PO_ADVANCED,
       .group  = 6,
     },
+    {
+      .type   = PT_U32,
+      .id     = "hls_segment_duration",
+      .name   = N_("Segment duration (sec)"),
+      .desc   = N_("The target duration of the HLS segments. A segment "
+                   "is cut at the first video keyframe (random access "
+                   "point) after this time. Streams without video and "
+                   "streams which do not mark the keyframes are cut at "
+                   "the first PAT packet (after twice this time for the "
+                   "latter)."),
+      .off    = offsetof(config_t, hls_segment_duration),
+      .opts   = PO_EXPERT,
+      .group  = 7,
+    },
+    {
+      .type   = PT_U32,
+      .id     = "hls_segments",
+      .name   = N_("Segments in playlist"),
+      .desc   = N_("The number of segments kept for each shared HLS "
+                   "stream and announced in the live playlist."),
+      .off    = offsetof(config_t, hls_segments),
+      .opts   = PO_EXPERT,
+      .group  = 7,
+    },
+    {
+      .type   = PT_STR,
+      .id     = "hls_spill_path",
+      .name   = N_("Segment spill path"),
+      .desc   = N_("Store the completed HLS segments to files in this "
+                   "directory instead of keeping them in memory. Leave "
+                   "empty to keep the segments in memory."),
+      .off    = offsetof(config_t, hls_spill_path),
+      .opts   = PO_EXPERT,
+      .group  = 7,
+    },
     {
       .type   = PT_STR,
       .id     = "wizard",
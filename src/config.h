@@ -57,12 +57,20 @@ typedef struct config {
   uint32_t descrambler_buffer;
   int parser_backlog;
   int epg_compress;
+  int iptv_threads;
+  uint32_t gop_cache;
+  uint32_t prewarm_tuners;
+  uint32_t prewarm_weight;
+  uint32_t prewarm_timeout;
+  uint32_t hls_segment_duration;
+  uint32_t hls_segments;
+  char *hls_spill_path;
 } config_t;
 
 extern const idclass_t config_class;
 extern config_t config;
 
-void        config_boot    ( const char *path, gid_t gid, uid_t uid );
+void        config_boot    ( const char *path, int store, gid_t gid, uid_t uid );
 void        config_init    ( int backup );
 void        config_done    ( void );
 
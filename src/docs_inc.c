@@ -0,0 +1,3973 @@
+const char *tvh_doc_root_before_begin[] = {
+"### ",
+LANGPREF N_("Before You Begin"),
+"\n\n",
+LANGPREF N_("There are some basic concepts that will make life much easier if you understand them from the outset."),
+"\n\n#### ",
+LANGPREF N_("Hardware/Software Fundamentals"),
+"\n\n* ",
+LANGPREF N_("A __tuner__ is the hardware (chipset) needed to interpret a digital television signal and extract from it the programme stream. The tuner hardware is also responsible for communicating with your satellite dish via the LNB in the case of DVB-S."),
+"\n* ",
+LANGPREF N_("__Network tuners__ are small (usually"),
+" [",
+LANGPREF N_("arm"),
+"](https://en.wikipedia.org/wiki/ARM_architecture) ",
+LANGPREF N_("based) computers that you connect to your network via Ethernet or Wifi, they often have a large number of tuners and are controlled via a web interface or software. Many work out-of-the-box with Tvheadend using SAT>IP or the HDHomeRun protocols."),
+"\n* ",
+LANGPREF N_("A __driver__ is the piece of software that your operating system uses to talk to the tuner. This can be built into the OS (e.g. 'supported since kernel X') or might be a separate piece of software that you need install, and maybe even compile, separately."),
+"\n* ",
+LANGPREF N_("__Firmware__ is a small piece of binary microcode that your system driver sends to the tuner upon initialisation. This is the cause of more problems than you'd imagine... if you find yourself in trouble, this is the first thing to check along with kernel support for your hardware."),
+"\n\n#### ",
+LANGPREF N_("Application/Tvheadend Fundamentals"),
+"\n\n",
+LANGPREF N_("The Tvheadend software then sets up a series of configuration elements, and the way in which these interact determines how a TV signal ends up in front of you. They all use what's known as a _many-to-many_ relationship, in that one configuration element can be related to multiple elements of the next type, and vice versa: one tuner has multiple networks, one network can exist on multiple tuners."),
+" \n\n* ",
+LANGPREF N_("The __network__ is the software definition of your carrier network. Broadly, it lays out what sort of network it is (such as DVB-T or DVB-S2), how it gets scanned, where the DVB-S satellite is in orbit, and similar. Networks are used by tuners so the hardware knows where to look for a signal."),
+"\n* ",
+LANGPREF N_("Networks then have __muxes__ . These are the carrier frequencies that exist on the old analogue channels that are used to transmit multiple digital signals rather than a single analogue one. These signals are multiplexed together, hence the name _mux_ ."),
+"\n* ",
+LANGPREF N_("Muxes then carry __services__ . These are the individual streams of data. They can be TV or radio programmes, they can provide data services such as digital teletext, or they can be used as part of the control code for catch-up IPTV services."),
+"\n* ",
+LANGPREF N_("And finally, services are mapped to __channels__ . These are what you and your client software think in terms of: _\"I'd like to watch BBC One now, please\"_ ."),
+"\n\n#### ",
+LANGPREF N_("Why The Complexity?"),
+"\n\n",
+LANGPREF N_("Simply, because 'BBC One' might exist in many different places... it might have regional variations on multiple frequencies (so different services on different muxes); it might exist on more than one source (perhaps on two different satellites); and it might thus be accessible through more than one piece of hardware (two satellite tuners, or one satellite and one terrestrial tuner)."),
+"\n\n",
+LANGPREF N_("When you select the channel you want to watch or record, Tvheadend can then map a path through all those variables to ask a particular tuner to go and get the signal for you."),
+"\n\n",
+LANGPREF N_("The following diagram explains the relationship between these components:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("Relationship Between Tuners, Neworks, Muxes, Services and Channels"),
+"](images/tvh_schematic.png)\n",
+
+NULL
+};
+
+const char *tvh_doc_root_cmdline_options[] = {
+"### ",
+LANGPREF N_("Command-line Options"),
+"\n\n",
+LANGPREF N_("Usage: `tvheadend [OPTIONS]`"),
+"\n\n#### ",
+LANGPREF N_("Generic Options"),
+"\n```no-highlight\n-h, --help                  Show this page\n-v, --version               Show version infomation\n```\n\n#### ",
+LANGPREF N_("Service Configuration"),
+"\n```no-highlight\n-c, --config                Alternate config path\n-B, --nobackup              Do not backup config tree at upgrade\n-f, --fork                  Fork and run as daemon\n-u, --user                  Run as user\n-g, --group                 Run as group\n-p, --pid                   Alternate pid path\n-C, --firstrun              If no user account exists then create one with\n                            no username and no password. Use with care as\n                            it will allow world-wide administrative access\n                            to your Tvheadend installation until you edit\n                            the access-control from within the Tvheadend UI\n-U, --dbus                  Enable DBus\n-e, --dbus_session          DBus - use the session message bus instead system one\n-a, --adapters              Only use specified DVB adapters (comma separated)\n    --satip_rtsp            SAT>IP RTSP port number for server\n                            (default: -1 = disable, 0 = webconfig, standard port is 554)\n    --satip_xml             URL with the SAT>IP server XML location\n```\n\n#### ",
+LANGPREF N_("Server Connectivity"),
+"\n```no-highlight\n-6, --ipv6                  Listen on IPv6\n-b, --bindaddr              Specify bind address\n    --http_port             Specify alternative http port\n    --http_root             Specify alternative http webroot\n    --htsp_port             Specify alternative htsp port\n    --htsp_port2            Specify extra htsp port\n    --useragent             Specify User-Agent header for the http client\n    --xspf                  Use xspf playlist instead M3U\n```\n\n#### ",
+LANGPREF N_("Debug Options"),
+"\n```no-highlight\n-d, --stderr                Enable debug on stderr\n-n, --nostderr              Disable debug on stderr\n-s, --syslog                Enable debug to syslog\n-S, --nosyslog              Disable syslog (all msgs)\n-l, --logfile               Enable debug to file\n    --debug                 Enable debug subsystems\n    --trace                 Enable trace subsystems\n    --fileline              Add file and line numbers to debug\n    --threadid              Add the thread ID to debug\n    --libav                 More verbose libav log\n    --uidebug               Enable webUI debug (non-minified JS)\n-A, --abort                 Immediately abort\n-D, --dump                  Enable coredumps for daemon\n    --noacl                 Disable all access control checks\n    --nobat                 Disable DVB bouquets\n-j, --join                  Subscribe to a service permanently\n```\n\n#### ",
+LANGPREF N_("Testing Options"),
+"\n```no-highlight\n--tsfile_tuners         Number of tsfile tuners\n--tsfile                tsfile input (mux file)\n```\n",
+
+NULL
+};
+
+const char *tvh_doc_root_configure_tvheadend[] = {
+"### ",
+LANGPREF N_("Configure Tvheadend"),
+"\n\n",
+LANGPREF N_("This section gives a high-level overview of the steps needed to get Tvheadend up and running. For more detailed information, please consult the rest of this guide - much of it is arranged in the same order as the tabs on the Tvheadend interface so you know where to look."),
+"\n\n",
+LANGPREF N_("You can also consult the in-application help text, which mirrors this guide to a very great extent."),
+"\n\n#### ",
+LANGPREF N_("1. Ensure Tuners are Available for Use"),
+"\n\n",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> DVB Inputs -> TV Adapters_ __"),
+" \n\n",
+LANGPREF N_("On this tab, you'll see a tree structure, with the Linux device list at the top level (e.g. `/dev/dvb/adapter0`)"),
+"\n\n",
+LANGPREF N_("Individual tuners are then the next level down (e.g. `DiBcom 7000PC : DVB-T #0`)"),
+"\n\n",
+LANGPREF N_("Click on each tuner that you want Tvheadend to use, and ensure \"Enabled\" is checked in the 'Parameters' list"),
+"\n\n",
+LANGPREF N_("If anything is obviously wrong at this point, you probably have a driver/firmware error which you'll need to resolve before going any further."),
+"\n\n#### ",
+LANGPREF N_("2. Set up Relevant Network(s)"),
+"\n\n",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> DVB Inputs -> Networks_ __"),
+" \n\n",
+LANGPREF N_("Create a network of the appropriate type here. You can have multiple networks of the same type as necessary, e.g. to have two DVB-T networks defined, one with HD muxes, one without."),
+"\n\n",
+LANGPREF N_("The creation process allows you to select from a series of pre-defined mux lists for common DVB sources. These are maintained outside of Tvheadend, and are downloaded from"),
+" [",
+LANGPREF N_("linuxtv"),
+"](http://git.linuxtv.org/cgit.cgi/dtv-scan-tables.git/) ",
+LANGPREF N_("- but they do go out of date as broadcasters move services around and national authorities change entire pieces of spectrum. As such, you should try the pre-defined values, but you may need to add muxes manually."),
+"\n\n* ",
+LANGPREF N_("When creating a DVB-S network, be sure to set the orbital position of the satellite to which your dish is pointing, as some satellites provide additional information related to other nearby satellites that you may not be able to receive."),
+"\n* ",
+LANGPREF N_("Network discovery (enabled by default) increases the likelihood of receiving all available muxes and services."),
+"\n\n#### ",
+LANGPREF N_("3. Associate the Network with the Respective Tuner(s)"),
+"\n\n",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> DVB Inputs -> TV Adapters_ __"),
+" \n\n",
+LANGPREF N_("Associate each of your tuners with the correct network through _Parameters -> Basic Settings_ ."),
+" \n\n",
+LANGPREF N_("This can be as simple or as complex as necessary. You may simply have, for example, a single DVB-S2 network defined and then associate this with all DVB-S2 tuners. Or, you might have multiple networks defined - different satellites, different encoding. So, as further examples, you might define and then associate an HD DVB-T2 (e.g. H.264) network with HD tuners, while having a separate SD network associated with an independent SD (e.g. MPEG-2) tuner."),
+" \n\n",
+LANGPREF N_("At this point, your tuners now know what networks to use: one network can appear on multiple tuners (many-to-one), and one tuner can have multiple networks."),
+"\n\n#### ",
+LANGPREF N_("4. If Necessary, Manually Add Muxes"),
+"\n\n",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> DVB Inputs -> Muxes_ __"),
+" \n\n",
+LANGPREF N_("Ideally, this is where you'll see a list of the pre-populated muxes as created when you set up your initial network. However, should there be any issues, this is where you can manually add missing muxes. You only really need to worry about this if the pre-defined list didn't work (e.g. because of out-of-date data as broadcasters re-arrange their services or because automatic detection (network discovery) hasn't successfully found all the muxes over time."),
+" \n\n",
+LANGPREF N_("If you do need to add something manually, you'll need to search the Internet for details of the appropriate transmitter and settings: satellites tend not to change much and are universal over a large area, but terrestrial muxes are typically very localised and you'll need to know which specific transmitter you're listening to."),
+" \n\n",
+LANGPREF N_("__Note__ : some tuners (or drivers) require more tuning parameters than others so __be sure to enter as many tuning parameters as possible__ ."),
+"\n\n",
+LANGPREF N_("Good sources of transmitter/mux information include:"),
+"\n\n* [",
+LANGPREF N_("KingofSat"),
+"](http://en.kingofsat.net) ",
+LANGPREF N_("for all European satellite information"),
+"\n* [",
+LANGPREF N_("ukfree.tv"),
+"](http://www.ukfree.tv/maps/freeview) ",
+LANGPREF N_("for UK DVB-T transmitters"),
+"\n* [",
+LANGPREF N_("Interactive EU DVB-T map"),
+"](http://www.dvbtmap.eu/mapmux.html) ",
+LANGPREF N_("for primarily central and northern Europe"),
+"\n* [",
+LANGPREF N_("Lyngsat"),
+"](http://www.lyngsat.com/) ",
+LANGPREF N_("for worldwide satellite information."),
+"\n\n",
+LANGPREF N_("You can also use"),
+" [",
+LANGPREF N_("dvbscan"),
+"](http://www.linuxtv.org/wiki/index.php/Dvbscan) ",
+LANGPREF N_("to force a scan and effectively ask your tuner what it can see."),
+"\n\n#### ",
+LANGPREF N_("5. Scan for Services"),
+"\n\n",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> DVB Inputs -> Services_ __"),
+" \n\n",
+LANGPREF N_("This is where the services will appear as your tuners tune to the muxes based on the network you told them to look on. Again, remember what's happening: Tvheadend is telling your tuner hardware (via the drivers) to sequentially tune to each mux it knows about, and then see what 'programmes' it can see on that mux, each of which is identified by a series of unique identifiers that describe the audio stream(s), the video stream(s), the subtitle stream(s) and language(s), and so on."),
+"\n\n",
+LANGPREF N_("(For the technically-minded, these unique identifiers - the elementary streams - are referred to as 'packet identifiers' or 'PIDs')."),
+"\n\n##### ",
+LANGPREF N_("5.1. Forcing a Scan"),
+"\n\n  ",
+LANGPREF N_("You may force a scan by going to:"),
+"\n\n  ",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> DVB Inputs -> Networks_ __"),
+" \n\n  ",
+LANGPREF N_("Highlight the network(s) you would like to force scan and then press the \"Force Scan\" button."),
+" \n\n  ",
+LANGPREF N_("Force scanning can take some time. You may continue to use Tvheadend while a scan is in progress, but doing so will increase the time needed for it to complete. Note that the time required can vary depending on a number of factors, such as how many tuners you have available and the number of muxes on each."),
+"\n\n  ",
+LANGPREF N_("__Tip__ : You may select more than one network by holding ctrl and clicking on additional networks."),
+" \n\n#### ",
+LANGPREF N_("6. Map Services to Channels"),
+"\n\n",
+LANGPREF N_("Once scanning for services is complete, you need to map the services to channels so your client can actually request them (i.e. so you can watch or record)."),
+"\n\n",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> DVB Inputs -> Services_ __"),
+" \n\n##### ",
+LANGPREF N_("6.1. Mapping All"),
+"\n\n  ",
+LANGPREF N_("Press the \"Map services\" button and then \"Map all services\"."),
+" \n\n  ",
+LANGPREF N_("A dialog will then appear with the list of available services and various other mapping options. The ticked check boxes [✓] indicate which services will be mapped, when you're happy with the selection press the \"Map services\" button. You will then be taken to the Service Mapper tab which will begin mapping services to channels."),
+" \n\n##### ",
+LANGPREF N_("6.2. Mapping Selected"),
+"\n\n  ",
+LANGPREF N_("While holding ctrl (single selection) or shift (to select a range), click on the services you would like to map as channels. Once you're done selecting, press the \"Map services\" button and then \"Map selected services\" - __be careful not to click on the grid or you'll lose your selection!__"),
+" \n\n  ",
+LANGPREF N_("A dialog will then appear with the list of available services and various other mapping options. The ticked check boxes [✓] indicate which services will be mapped, when you're happy with the selection press the \"Map services\" button. You will then be taken to the Service Mapper tab which will begin mapping services to channels."),
+" \n\n  ",
+LANGPREF N_("__Tip__ : By default Tvheadend will only show a small selection of available services - you can increase this by using the paging selector at the bottom right of the page."),
+"\n\n##### ",
+LANGPREF N_("6.3. Bouquets"),
+"\n\n  ",
+LANGPREF N_("__Tvheadend web interface: _Configuration -> Channel / EPG -> Bouquets_ __"),
+" \n\n  ",
+LANGPREF N_("Many service providers use bouquets for channel management and just like a standard set-top box Tvheadend can use these to automatically manage and keep your channels up-to-date."),
+"\n\n  ",
+LANGPREF N_("If you would like to use bouquets see"),
+" [",
+LANGPREF N_("Bouquets"),
+"](class/bouquet)",
+LANGPREF N_("."),
+"\n\n#### ",
+LANGPREF N_("7. Watch TV"),
+"\n\n",
+LANGPREF N_("That's it - you're done. You should now have a working basic Tvheadend installation with channels mapped and ready for use!"),
+"\n\n",
+LANGPREF N_("As required, you may now wish to look into:"),
+"\n\n* ",
+LANGPREF N_("Setting up different EPGs (inc. localised character sets and timing offsets)"),
+"\n* ",
+LANGPREF N_("Setting up channel icons"),
+"\n* ",
+LANGPREF N_("Setting up recording profiles"),
+"\n* ",
+LANGPREF N_("Setting up streaming profiles (including transcoding)"),
+"\n* ",
+LANGPREF N_("Arranging your channels into groups (channel tags)"),
+"\n* ",
+LANGPREF N_("Setting up softcams for descrambling"),
+"\n* ",
+LANGPREF N_("Setting up access control rules for different client types/permission levels"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_debugging[] = {
+"### ",
+LANGPREF N_("Debugging"),
+"\n\n#### ",
+LANGPREF N_("Trace Options"),
+"\n\n",
+LANGPREF N_("The following options can be passed to tvheadend to provide detailed debugging information while the application is running. Trace debugging has to be enabled at build time (`--enable-debugging`) and can then either be specified on the command- line (e.g. `tvheadend -u hts -g video --trace <module>`) or in the web interface (_Configuration -> Debugging_ )."),
+"\n\n",
+LANGPREF N_("More than one option can be used, e.g. _--trace cwc,dvr,linuxdvb_"),
+" \n\n",
+LANGPREF N_("no-highlight"),
+"\n```no-highlight\nall\naccess\nbouquet\ncapmt\ncwc\ndescrambler\ndiseqc\ndvbcam\ndvr\neit\nen50221\nepg\nepggrab\nfastscan\nfsmonitor\ngtimer\nhtsp\nhttpc\nidnode\nlinuxdvb\nmain\nmkv\nmpegts\nopentv\nparser\npass\npsi\nsatip\nsatips\nscanfile\nsdt\nservice\nservice_mapper\nsettings\nsubscription\ntcp\nthread\ntime\ntimeshift\ntranscode\ntsfile\ntvhdhomerun\nupnp\n```\n",
+
+NULL
+};
+
+const char *tvh_doc_root_doc_update[] = {
+"### ",
+LANGPREF N_("Updating the Documentation 5 April 2016"),
+"\n\n",
+LANGPREF N_("The documentation is written in markdown, and then converted for direct inclusion to tvheadend binary. The markdown processor in tvheadend binary adds also other information from the internal class system."),
+"\n\n",
+LANGPREF N_("The User Guide in"),
+" [",
+LANGPREF N_("documentatation repository"),
+"](https://github.com/tvheadend/tvheadend-documentation) ",
+LANGPREF N_("fetches the markdown files using the build-in web server and use them as source for mkdocs."),
+"\n\n##### ",
+LANGPREF N_("Instructions for on-line help"),
+"\n\n",
+LANGPREF N_("Change markdown files in docs/markdown, docs/classes, docs/wizard and type make. Follow"),
+" [",
+LANGPREF N_("development page"),
+"](https://tvheadend.org/projects/tvheadend/wiki/Development)",
+LANGPREF N_("."),
+"\n\n##### ",
+LANGPREF N_("Instructions for User Guide (FIXME!)"),
+"\n\n",
+LANGPREF N_("Broadly:"),
+"\n\n1. ",
+LANGPREF N_("Install dependencies ("),
+"[",
+LANGPREF N_("mkdocs"),
+"](http://www.mkdocs.org/) ",
+LANGPREF N_("and"),
+"  [",
+LANGPREF N_("git"),
+"](https://help.github.com/articles/set-up-git/)",
+LANGPREF N_(")"),
+"\n2. ",
+LANGPREF N_("Clone the"),
+" [",
+LANGPREF N_("documentation repository"),
+"](https://github.com/tvheadend/tvheadend-documentation)\n3. ",
+LANGPREF N_("Make changes locally. Pay close attention to formatting and syntax - use the live reload function (`mkdocs serve`) to preview them."),
+" \n4. ",
+LANGPREF N_("When you're happy, push the changes to your remote repository and open a pull request"),
+"\n\n> ",
+LANGPREF N_("Because we upload the theme as well, what it looks like locally should be 100% representative of what it looks like once it's pushed to the Internet."),
+"\n\n",
+LANGPREF N_("Command sequence (this presumes Linux, but Windows is very similar):"),
+"\n\n* `cd ~/tvheadend-documentation`\n* ",
+LANGPREF N_("`git add -A` (presumes to add everything, you can of course be selective)"),
+"\n* `git commit -m \"Summary of changes\"`\n* `git push`\n\n",
+LANGPREF N_("... and then open the PR on github"),
+"\n\n",
+LANGPREF N_("To update and resync, someone (me, probably!) needs to:"),
+"\n\n1. ",
+LANGPREF N_("Merge the changes"),
+"\n2. ",
+LANGPREF N_("Pull the latest revisions from the repository"),
+"\n3. ",
+LANGPREF N_("Convert the webui files: `./convert.sh docs/webui <target_directory>`"),
+"\n\n",
+LANGPREF N_("To merge the webui files into tvheadend, copy them into `<your tvheadend clone>/docs/html`, push them to your remote repository and open a PR to merge them into master."),
+"\n\n1. ",
+LANGPREF N_("Convert all files: `mkdocs build --clean`"),
+"\n2. ",
+LANGPREF N_("Copy the contents of the resultant `site` directory to gihub pages"),
+"\n\n",
+LANGPREF N_("To publish the entire User Guide to gihub, use `resync.sh` or use the following command sequence:"),
+"\n\n* `cd $YOUR_BASE_DIR/tvheadend.github.io`\n* `cp -r $YOUR_BASE_DIR/tvheadend-documentation/site/* .`\n* ",
+LANGPREF N_("`git add -A` (presumes to add everything)"),
+"\n* ",
+LANGPREF N_("`git commit -m \"Resync\"` (or whatever your commit message is)"),
+"\n* `git push`\n",
+
+NULL
+};
+
+const char *tvh_doc_root_epg[] = {
+"### ",
+LANGPREF N_("Electronic Program Guide"),
+"\n\n",
+LANGPREF N_("Tvheadend has a built-in Electronic Program Guide. The EPG is an in-memory database populated with all the information about events received from the DVB networks over-the-air or from external grabbers such as XMLTV."),
+"\n\n",
+LANGPREF N_("The EPG tab displays a filterable grid containing all events, sorted based on start time."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Electronic Program Guide' Tab"),
+"](docresources/epg.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n##### ",
+LANGPREF N_("Filtering (or searching)"),
+"\n\n",
+LANGPREF N_("In the EPG top tool bar you can access five input fields. These are used to filter/search for events. The form uses implicit AND between the input fields. This means that all filters must match for an event to be displayed."),
+"\n\n",
+LANGPREF N_("Filter"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Search title..."),
+"__  | ",
+LANGPREF N_("Only display events that match the given title."),
+"\n | ",
+LANGPREF N_("The filter uses case-insensitive regular expressions. If you don’t know what a regular expression is, this simply means that you can type just parts of the title and filter on that - there’s no need for full, exact matching. If the fulltext checkbox is checked, the title text is matched against title, subtitle, summary and description."),
+"\n__",
+LANGPREF N_("Filter channel..."),
+"__  | ",
+LANGPREF N_("Only display events from the selected channel."),
+"\n | ",
+LANGPREF N_("Channels in the drop down are ordered by name and can be filtered (by name) by typing in the box."),
+"\n__",
+LANGPREF N_("Filter tag..."),
+"__  | ",
+LANGPREF N_("Only display events from channels which are included in the selected tag."),
+"\n | ",
+LANGPREF N_("Tags are used for grouping channels together - such as ‘Radio’ or ‘HDTV’ - and are configured by the administrator. You can start typing a tag name to filter the list."),
+"\n__",
+LANGPREF N_("Filter content type..."),
+"__  | ",
+LANGPREF N_("Only display events that match the given content type tag."),
+"\n | ",
+LANGPREF N_("Most DVB networks classify their events into content groups. This field allows you to filter based on content type (e.g. “Sports” or “Game Show”). Supported tags are determined by your broadcaster. Again, simply start typing to filter the entries if you have a long list to choose from."),
+"\n__",
+LANGPREF N_("Filter duration..."),
+"__  | ",
+LANGPREF N_("Only display events that fall between the given minimum and maximum durations."),
+"\n | ",
+LANGPREF N_("This allows you to filter for or against, say, a daily broadcast and a weekly omnibus edition of a program, or only look for short news bulletins and not the 24-hour rolling broadcasts."),
+"\n\n",
+LANGPREF N_("_Title_ , _Channel_ , _Tag_ and _Content Type_ are dependent on your configuration and on what your broadcaster sends. Options for the _Duration_ are as follows:"),
+"\n\n",
+LANGPREF N_("Filter Range"),
+" | ",
+LANGPREF N_("Example Purpose"),
+"\n----- | -----\n",
+LANGPREF N_("00:00:01 to 00:15:00"),
+" | ",
+LANGPREF N_("Very short news bulletins, children's programs, etc."),
+"\n",
+LANGPREF N_("00:15:01 to 00:30:00"),
+" | ",
+LANGPREF N_("Short programs, e.g. daily soap operas"),
+"\n",
+LANGPREF N_("00:30:01 to 01:30:00"),
+" | ",
+LANGPREF N_("Medium-length programs, e.g. documentaries"),
+"\n",
+LANGPREF N_("01:30:01 to 03:00:00"),
+" | ",
+LANGPREF N_("Longer programs, e.g. films"),
+"\n",
+LANGPREF N_("03:00:00 to no maximum"),
+" | ",
+LANGPREF N_("Very long programs, e.g. major sporting events"),
+"\n\n",
+LANGPREF N_("So, if you only want to see Movies from your available HD channels, you would select ‘HDTV’ in the _[Filter tag…]_ field, and select ‘Movie / Drama’ in the _[Filter content type…]_ field. If you wish, you could then further limit the search to programs of between 90 minutes and 3 hours by selecting ‘01:30:01 to 03:00:00’ in the _[Filter duration…]_ field."),
+"\n\n",
+LANGPREF N_("Note that you don’t have to press a ‘Search’ button: the grid immediately updates itself as you change the filters."),
+"\n\n",
+LANGPREF N_("You can clear an individual filter by simply deleting its contents, or by selecting _‘(Clear filter)’_ as appropriate on all except the title filter. If you want to clear all filters, just press the _[Reset All]_ button."),
+"\n\n##### ",
+LANGPREF N_("Buttons"),
+"\n\n",
+LANGPREF N_("The following buttons are also available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Reset All"),
+"__  | ",
+LANGPREF N_("Clears all search filters."),
+"\n__",
+LANGPREF N_("Watch TV"),
+"__  | ",
+LANGPREF N_("Launches Live TV via HTML5 video (see below)."),
+"\n__",
+LANGPREF N_("Create Autorec"),
+"__  | ",
+LANGPREF N_("Creates an auto-recording rule based on the current filter criteria (see below)."),
+"\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Display this help page."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Grid Items"),
+"\n\n",
+LANGPREF N_("The main grid items have the following functions:"),
+"\n\n",
+LANGPREF N_("__Details__ : Displays the current status of a recording event for this program if one applies:"),
+" \n\n",
+LANGPREF N_("Icon"),
+" | ",
+LANGPREF N_("Description"),
+"\n----- | -----\n![",
+LANGPREF N_("Clock icon"),
+"](icons/scheduled.png) | ",
+LANGPREF N_("the program is scheduled for recording"),
+"\n![",
+LANGPREF N_("Recording icon"),
+"](icons/rec.png) | ",
+LANGPREF N_("the program is currently recording"),
+"\n![",
+LANGPREF N_("Broadcast details icon"),
+"](icons/broadcast_details.png) | ",
+LANGPREF N_("click to call up more detailed information about an event"),
+"\n![",
+LANGPREF N_("Exclamation icon"),
+"](icons/exclamation.png) | ",
+LANGPREF N_("the program failed to record"),
+"\n\n",
+LANGPREF N_("__Progress__ : A bar graph display of how far through a program we currently are."),
+"\n\n",
+LANGPREF N_("__Title__ : The title of the program. _You can automatically set a filter to the value of this field by clicking on it (e.g. click on 'Daily News' will automatically filter the whole grid to only show programs with the same name)._"),
+" \n\n",
+LANGPREF N_("__Subtitle__ : The subtitle of the program, if gien by your EPG provider. Note that some (notably, UK) providers use this for a program synopsis instead of a true subtitle."),
+"\n\n",
+LANGPREF N_("__Episode__ : Episode number, if given by your EPG provider."),
+"\n\n",
+LANGPREF N_("__Start Time__ : The scheduled start time of the program."),
+"\n\n",
+LANGPREF N_("__End Time__ : The scheduled end time of the program."),
+"\n\n",
+LANGPREF N_("__Duration__ : The scheduled duration (i.e. start time to end time) of the program."),
+" \n\n",
+LANGPREF N_("__Number__ : The channel number of the broadcasting channel, if defined."),
+"\n\n",
+LANGPREF N_("__Channel__ : The name of the broadcasting channel. _You can automatically set a filter to the value of this field by clicking on it (e.g. click on 'Channel 4 HD' will automatically filter the whole grid to only show programs from that channel)._"),
+" \n\n",
+LANGPREF N_("__Stars__ : Rating (in stars) of the program."),
+"\n\n",
+LANGPREF N_("__Age__ : Age rating of the program."),
+"\n\n",
+LANGPREF N_("__Content Type__ : Any content/genre information as provided by the EPG provider. _You can automatically set a filter to the value of this field by clicking on it (e.g. click on 'Movie/Drama' will automatically filter the whole grid to only show programs of the same type)._"),
+" \n\n---\n\n#### ",
+LANGPREF N_("Event details and recording"),
+"\n\n",
+LANGPREF N_("If you click on a single event, a popup will display detailed information about the event. It also allows you to schedule the event for recording by clicking on the _[Record program]_ button."),
+"\n\n",
+LANGPREF N_("For EPG providers that supply series link information there will also be a _[Record series]_ button that will record all entries in the series."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("EPG Detail 1"),
+"](docresources/epg2.png)\n\n",
+LANGPREF N_("For events without any series link information, an _[Autorec]_ button will be provided to create a pseudo-series link using the autorec feature."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("EPG Detail 2"),
+"](docresources/epg3.png)\n\n",
+LANGPREF N_("If you schedule any kind of recording from this point, you can choose a specific DVR profile that will apply to the recording or autorec rule. This will normally show as _(default)_ , but you can define different profiles in the __Configuration -> Recording -> Digital Video Recorder Profiles__ tab. This allows you to set, for example, more post- broadcast padding for a channel that always runs late, or perhaps define a different post-processing command to strip adverts out on a commercial channel."),
+"\n\n",
+LANGPREF N_("You will also see _[Search IMDB]_ and _[TheTVDB] buttons to look for the program by name on imdb.com/thetvdb.com, and a _ [Play program]* button to watch a program that’s already in progress. This second button downloads a playlist file (XSPF or M3U depending on your startup options); if your system is configured for it, this will automatically launch an appropriate player, otherwise you will need to manually open the playlist to start watching (normally a double-click on the downloaded file)."),
+"\n\n",
+LANGPREF N_("To close the popup, just click on the [X] window button. The popup isn’t modal, so you don’t have to close it before doing something else, and you can open as many detailed information popups as you want."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Autorecordings"),
+"\n\n",
+LANGPREF N_("Should you wish to record all events matching a specific query (to record your favourite show every week, for example) you can press the _[Create AutoRec]_ button in the top toolbar."),
+"\n\n",
+LANGPREF N_("A popup with details about the to-be-created autorecording rule needs to be confirmed before the rule takes effect."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("Autorec Dialogue Box"),
+"](docresources/autorecpopup.png)\n\n",
+LANGPREF N_("You can change or delete the autorec rules in the __Digital Video Recorder__ tab. Use that editor if you temporarily want to disable an autorecording or make adjustments to the channel, tag, or similar."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Watch TV"),
+"\n\n",
+LANGPREF N_("If you want to watch live TV in the web UI, the _[Watch TV]_ button will pop up a HTML5 video player, where you can select the channel to watch and a stream profile to use. A transcoding stream profile is required to transcode the stream to a format that is supported by your browser, as browsers only support certain formats and codecs."),
+"\n\n##### ",
+LANGPREF N_("Supported formats (containers)"),
+"\n\n",
+LANGPREF N_("Browser"),
+" | ",
+LANGPREF N_("MPEG-TS"),
+" | ",
+LANGPREF N_("MPEG-PS"),
+" | ",
+LANGPREF N_("Matroska"),
+" | ",
+LANGPREF N_("WebM"),
+"\n:---: | :---: | :---: | :---: | :---:\n",
+LANGPREF N_("Google Chrome"),
+" | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png) | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png)\n",
+LANGPREF N_("Mozilla Firefox"),
+" | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) |  | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png)\n\n##### ",
+LANGPREF N_("Supported video codecs"),
+"\n\n",
+LANGPREF N_("Browser"),
+" | ",
+LANGPREF N_("MPEG2 Video"),
+" | ",
+LANGPREF N_("H.264"),
+" | ",
+LANGPREF N_("VP8"),
+"\n:---: | :---: | :---: | :---:\n",
+LANGPREF N_("Google Chrome"),
+" | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png) | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png)\n",
+LANGPREF N_("Mozilla Firefox"),
+" | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) |  | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png)\n\n##### ",
+LANGPREF N_("Supported audio codecs"),
+"\n\n",
+LANGPREF N_("Browser"),
+" | ",
+LANGPREF N_("MPEG2 Audio"),
+" | ",
+LANGPREF N_("Dolby Digital (AC3)"),
+" | ",
+LANGPREF N_("AAC"),
+" | ",
+LANGPREF N_("Vorbis"),
+"\n:---: | :---: | :---: | :---: | :---:\n",
+LANGPREF N_("Google Chrome"),
+" | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png) | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png)\n",
+LANGPREF N_("Mozilla Firefox"),
+" | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) | ![",
+LANGPREF N_("no"),
+"](icons/exclamation.png) |  | ![",
+LANGPREF N_("yes"),
+"](icons/accept.png)\n",
+
+NULL
+};
+
+const char *tvh_doc_root_faqs[] = {
+"### ",
+LANGPREF N_("FAQ: Frequently-asked Questions"),
+"\n\n#### ",
+LANGPREF N_("Q: How do I get a playlist for all my channels?"),
+"\n\n",
+LANGPREF N_("Tvheadend can generate a playlist of all your mapped services (channels). You can download it from the webui at `http://IP:Port/playlist`, e.g. `http://192.168.0.2:9981/playlist`."),
+"\n\n#### ",
+LANGPREF N_("Q: Why am I getting a playlist when trying to view/stream a channel?"),
+"\n\n",
+LANGPREF N_("By default Tvheadend's _Play_ links are playlists, although not all players accept them (e.g. Media Player Classic Home Cinema). You can bypass this by removing the `/play/` path from the url."),
+"\n\n#### ",
+LANGPREF N_("Q: Tvheadend has scanned for services but some rows in the Service Name column are blank, is that normal?"),
+"\n\n",
+LANGPREF N_("Yes, not all services are given a name by providers. These services are usually hidden for a reason and are often used for things such as encrypted guide data for set-top boxes, interactive services, and so on."),
+"\n\n",
+LANGPREF N_("If you're not seeing any service names at all this may indicate an issue with your hardware and/or configuration."),
+"\n\n#### ",
+LANGPREF N_("Q: I get a blank page when trying to view the web interface!"),
+"\n\n",
+LANGPREF N_("This usually happens when Tvheadend is installed incorrectly. As a start, make sure that the web interface path `/usr/share/tvheadend/src/webui/static/` exists and isn't empty."),
+" \n\n",
+LANGPREF N_("Note: The above path only applies to Debian/Ubuntu systems others may differ."),
+"\n\n#### ",
+LANGPREF N_("Q: Why can't I see my tuners in Tvheadend's interface?"),
+"\n\n",
+LANGPREF N_("This is normally because they're not installed properly. Check syslog/dmesg (e.g. `dmesg | grep dvb`) and see that you have startup messages that indicate whether or not the tuners have initialized properly. Similarly, check `/dev/dvb` to see if the block device files (i.e. the files used to communicate with the tuner) have been created correctly."),
+"\n\n",
+LANGPREF N_("The other major cause of this issue is when you're running Tvheadend as a user who doesn't have sufficient access to the tuners, such as not being a member of the _video_ group."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_features[] = {
+"### ",
+LANGPREF N_("Features of Tvheadend"),
+"\n\n##### ",
+LANGPREF N_("SDTV and HDTV support"),
+"\n\n* ",
+LANGPREF N_("H.265 (HEVC), H.264 (MPEG-4 AVC) and MPEG2 video supported."),
+"\n* ",
+LANGPREF N_("AC-3, AAC and MP2 audio supported."),
+"\n* ",
+LANGPREF N_("DVB subtitles supported."),
+"\n* ",
+LANGPREF N_("Teletext subtitles supported."),
+"\n\n##### ",
+LANGPREF N_("Input Sources"),
+"\n\n* ",
+LANGPREF N_("Satellite signals via DVB-S and DVB-S2"),
+"\n* ",
+LANGPREF N_("Terrestrial/Over-the-Air signals via DVB-T, DVB-T2 and ATSC"),
+"\n* ",
+LANGPREF N_("Cable signals via DVB-C"),
+"\n* ",
+LANGPREF N_("LAN/IPTV signals such as IPTV, SAT>IP, HDHomeRun"),
+"\n* ",
+LANGPREF N_("A general-purpose MPEG-TS `pipe://` for analogue and non-broadcast sources"),
+"\n* ",
+LANGPREF N_("Support for multiple adapters of any mix, with each adapter able to receive simultaneously all programmes on the current mux."),
+"\n* ",
+LANGPREF N_("Powerful many-to-many channel:service:tuner mapping that allows you to select channels irrespective of the underlying carrier (for channels that broadcast on multiple sources)."),
+" \n\n##### ",
+LANGPREF N_("Output Targets"),
+"\n\n* ",
+LANGPREF N_("Local or remote disk, via the built-in digital video recorder."),
+"\n* ",
+LANGPREF N_("HTSP (Home TV Streaming Protocol)."),
+"\n* ",
+LANGPREF N_("HTTP streaming."),
+"\n* ",
+LANGPREF N_("SAT>IP server (including on-the-fly descrambling)."),
+"\n\n##### ",
+LANGPREF N_("Transcoding Support"),
+"\n\n* ",
+LANGPREF N_("Subject to your system's capabilities, support for on-the-fly transcoding for both live and recorded streams in various formats."),
+"\n\n##### ",
+LANGPREF N_("Digital Video Recorder"),
+"\n\n* ",
+LANGPREF N_("Built in video recorder stores recorded programs as Transport Stream (.ts) or Matroska (.mkv) files."),
+"\n* ",
+LANGPREF N_("Multiple simultaneous recordings are supported."),
+"\n* ",
+LANGPREF N_("All original streams (multiple audio tracks, etc) are recorded."),
+"\n* ",
+LANGPREF N_("Streams can be selected and filtered positively or negatively as required."),
+"\n* ",
+LANGPREF N_("Create rule sets manually or based on EPG queries."),
+"\n* ",
+LANGPREF N_("Multiple DVR profiles that support different target directories, post-processing options, filtering options, etc."),
+"\n\n##### ",
+LANGPREF N_("Electronic Program Guide"),
+"\n\n* ",
+LANGPREF N_("Rich EPG support, with data from DVB/OTA, XMLTV (scheduled and socket)."),
+"\n* ",
+LANGPREF N_("Searchable and filterable from the web user interface."),
+"\n* ",
+LANGPREF N_("Results can be scheduled for recording with a single click."),
+"\n\n##### ",
+LANGPREF N_("Rich Browser-Driven Interface"),
+"\n\n* ",
+LANGPREF N_("The entire application is loaded into the browser."),
+"\n* ",
+LANGPREF N_("Based on extJS, all pages are dynamic and self-refreshing."),
+"\n* ",
+LANGPREF N_("All sorting/filtering is then done in C by the main application for speed."),
+"\n\n##### ",
+LANGPREF N_("Easy to Configure and Administer"),
+"\n\n* ",
+LANGPREF N_("All setup and configuration is done from the built in web user interface."),
+"\n* ",
+LANGPREF N_("All settings are stored in human-readable text files."),
+"\n* ",
+LANGPREF N_("Initial setup can be done by choosing one of the pre-defined"),
+" [",
+LANGPREF N_("linuxtv"),
+"](http://git.linuxtv.org/cgit.cgi/dtv-scan-tables.git) ",
+LANGPREF N_("networks or manually configured."),
+"\n* ",
+LANGPREF N_("Idle scanning for automatic detection of muxes and services."),
+"\n* ",
+LANGPREF N_("Support for broadcaster (primarily DVB-S) bouquets for easy channel mapping."),
+" \n\n##### ",
+LANGPREF N_("Multi-User Support"),
+"\n\n* ",
+LANGPREF N_("Access to system features (streaming, administration, configurations) can be configured based on username/password and/or IP address."),
+"\n\n##### ",
+LANGPREF N_("Software-Based CSA Descrambling"),
+"\n\n* ",
+LANGPREF N_("Requires a card server (newcamd and capmt protocol is supported)."),
+"\n\n##### ",
+LANGPREF N_("Fully-Integrated with Mainstream Media Players"),
+"\n\n* ",
+LANGPREF N_("Movian and Kodi are the main targets."),
+"\n* ",
+LANGPREF N_("All channel data, channel groups/tags, EPG and TV streaming is carried over a single TCP connection."),
+"\n\n##### ",
+LANGPREF N_("Mobile/Remote Client Support"),
+"\n\n* ",
+LANGPREF N_("As well as the web interface, which is accessible through VPN if required, third-party clients are available for both"),
+" [",
+LANGPREF N_("Android"),
+"](https://play.google.com/store/apps/details?id=org.tvheadend.tvhclient&hl=en_GB) ",
+LANGPREF N_("and"),
+" [",
+LANGPREF N_("iOS"),
+"](https://itunes.apple.com/gb/app/tvhclient/id638900112?mt=8) ",
+LANGPREF N_("(other clients may also be available)."),
+"\n\n##### ",
+LANGPREF N_("Internationalisation"),
+"\n\n* ",
+LANGPREF N_("All text is encoded in UTF-8 to provide full international support."),
+"\n* ",
+LANGPREF N_("All major character encodings in DVB are supported (e.g. for localised EPG character sets)."),
+"\n* [",
+LANGPREF N_("Web interface internationalization"),
+"](https://tvheadend.org/projects/tvheadend/wiki/Internationalization)\n",
+
+NULL
+};
+
+const char *tvh_doc_root_index[] = {
+"## ",
+LANGPREF N_("Tvheadend 4.2 User Guide"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("Tvheadend Logo"),
+"](images/logomid.png)\n\n## ",
+LANGPREF N_("Purpose"),
+"\n\n",
+LANGPREF N_("This document is intended to give you a high-level overview of how to set up Tvheadend for the first time. It does not aim to provide a complete description of every step or answer every question: more details are available on the tvheadend"),
+" [",
+LANGPREF N_("wiki"),
+"](https://tvheadend.org/projects/tvheadend/wiki)",
+LANGPREF N_("."),
+"\n\n",
+LANGPREF N_("As you set things up, consult the on-line (web interface) help as well. Tvheadend includes copies of many of these pages in the application, which is easier to find when you're wondering what to do next."),
+"\n\n",
+LANGPREF N_("If you get really stuck, there's the"),
+" [",
+LANGPREF N_("forum"),
+"](https://tvheadend.org/projects/tvheadend/boards) ",
+LANGPREF N_("and IRC (_#hts_ on _freenode_ ) -"),
+" [",
+LANGPREF N_("Kiwi IRC"),
+"](https://kiwiirc.com/client/chat.freenode.net/?nick=tvhhelp|?#hts) ",
+LANGPREF N_("or Freenode's"),
+" [",
+LANGPREF N_("webchat"),
+"](http://webchat.freenode.net) ",
+LANGPREF N_("are good web clients if you don't already have an IRC client installed."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_install_hardware[] = {
+"### ",
+LANGPREF N_("Install Your Tuners"),
+"\n\n",
+LANGPREF N_("This section will give you some basic ideas on how to get your tuner working with your operating system. However, it's clearly way beyond the scope of this guide to tell you everything: consult specialist forums, search around, and at least do some research to work out what's likely to work or not before you hand over any money."),
+"\n\n",
+LANGPREF N_("There is a discussion about supported hardware on"),
+" [",
+LANGPREF N_("the Tvheadend forums"),
+"](https://tvheadend.org/boards/5/topics/5102)",
+LANGPREF N_("."),
+"\n\n#### ",
+LANGPREF N_("1. Install the Tuner Hardware"),
+"\n\n",
+LANGPREF N_("This is obviously a core requirement that's outside of the scope of this guide."),
+"\n\n",
+LANGPREF N_("You basically have the choice of:"),
+"\n\n* ",
+LANGPREF N_("External USB tuners that plug in"),
+"\n* ",
+LANGPREF N_("Internal (e.g. PCI) tuners that go inside the computer chassis"),
+"\n* ",
+LANGPREF N_("External SAT>IP tuners that send MPEG-TS streams over a LAN connection"),
+"\n* ",
+LANGPREF N_("External HDHomeRun tuners that send MPEG-TS streams over a LAN connection"),
+"\n\n",
+LANGPREF N_("Follow the appropriate installation instructions and, if relevant, the setup instruction (e.g. for SAT>IP, which are effectively small, standalone computers)."),
+"\n\n##### ",
+LANGPREF N_("A Note on USB Tuners"),
+"\n\n",
+LANGPREF N_("USB tuners are cheap, work well and are frequently well-matched to physically-smaller builds (e.g. HTPCs) which simply don't have the internal slots. However, please remember that many need external power, or need a powered hub to work properly."),
+"\n\n",
+LANGPREF N_("In addition, even USB3 doesn't have the greatest practical bandwidth per bus. That means you're probably asking for problems if you have four DVB-S2 dongles on the same USB connection to the motherboard."),
+"\n\n",
+LANGPREF N_("This is particularly true of systems such as the Raspberry Pi which share USB bandwidth with the Ethernet port. Don't be surprised if this kind of platform struggles and/or reports errors in a multi-tuner configuration, especially on high-bandwidth (e.g. HD) streams."),
+"\n\n#### ",
+LANGPREF N_("2. Install Firmware and/or Drivers"),
+"\n\n",
+LANGPREF N_("Similar to the above, Tvheadend can do nothing if your tuners aren't working properly. A good place to check how to set up your tuners is the"),
+" [",
+LANGPREF N_("LinuxTV wiki device library"),
+"](http://www.linuxtv.org/wiki/index.php/Hardware_Device_Information) ",
+LANGPREF N_("- this will not only tell you what's supported under Linux, but also how to get it all working."),
+"\n\n",
+LANGPREF N_("As a broad guide, though, you need two main components: a driver, and firmware."),
+" \n\n",
+LANGPREF N_("The __driver__ is the piece of software that, as far as the operating system is concerned, controls the tuner hardware."),
+" \n\n",
+LANGPREF N_("Driver software typically comes either built-in to the operating system (a clue here is documentation that says _\"supported since kernel 3.16\"_ , for example) or as an external program that needs to be compiled in (e.g. how you'd build TBS' or Digital Devices drivers, or perhaps where the driver is supported in a later version of LinuxTV V4L-DVB than has made it to your kernel - the giveaway here is _\"compile and install the latest media_build\"_ )."),
+"\n\n",
+LANGPREF N_("Many tuners then also require __firmware__ - normally, a binary file that's been extracted from the proprietary drivers used by Windows."),
+"\n\n",
+LANGPREF N_("Many Linux distros include a package for the most common devices (e.g. _linux-firmwares_ under Ubuntu or _firmware-linux-nonfree_ under Debian). If this isn't sufficient, a good source of firmware files is the"),
+" [",
+LANGPREF N_("OpenElec firmware library"),
+"](https://github.com/OpenELEC/dvb-firmware) ",
+LANGPREF N_("on their git repository."),
+"\n\n",
+LANGPREF N_("Typically, download the binary file and install it into `/lib/firmware`, owned by `root:root`, permissions `rw-r--r--` (0644)"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_install_tvheadend[] = {
+"### ",
+LANGPREF N_("Install Tvheadend"),
+"\n\n",
+LANGPREF N_("This section tells you how to get hold of the software in the first place, and how to get it onto your system."),
+"\n\n",
+LANGPREF N_("Follow the instructions that are specific to your Linux distribution (Ubuntu/Debian/Mint, Arch, Fedora...). This will typically be PPA-and-dpkg for Debian, but most other distros will need you to build your own version from source."),
+"\n\n* [",
+LANGPREF N_("Debian/Ubuntu installation instructions"),
+"](https://tvheadend.org/projects/tvheadend/wiki/AptRepository)\n* [",
+LANGPREF N_("Instructions on how to build from source"),
+"](https://tvheadend.org/projects/tvheadend/wiki/Building)\n\n",
+LANGPREF N_("Do not assume that your distro's package manager will give you the latest version of Tvheadend - indeed, give you any version at all. Always check."),
+"\n\n",
+LANGPREF N_("Where a pre-built package exists, this will usually get you the last official stable version. However, more advanced users may be interested in running a development version - either a nightly build or a self-compiled version."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_markdown_cribsheet[] = {
+"### ",
+LANGPREF N_("Markdown/Formatting Crib Sheet"),
+"\n\n",
+LANGPREF N_("Some notable items about how formatting is used on this particular site."),
+"\n\n",
+LANGPREF N_("In general, __keep it simple__ , especially if you're contributing to the pages that get carried over into the web help. The simpler the formatting, the cleaner the conversion, the less tidying up there is afterwards."),
+"\n\n#### ",
+LANGPREF N_("References"),
+"\n\n* ",
+LANGPREF N_("Markdown basics:"),
+" [",
+LANGPREF N_("GitHub mastering markdown"),
+"](https://guides.github.com/features/mastering-markdown)\n\n#### ",
+LANGPREF N_("Paragraphs Versus Definition Lists"),
+"\n\n",
+LANGPREF N_("Watch this one - indentation is key."),
+"\n\n",
+LANGPREF N_("__This is paragraph formatting__ : with a subsequent explanation"),
+"\n```no-highlight\n**This is paragraph formatting**\n: with a subsequent explanation\n\n```\n\n",
+LANGPREF N_("__This is definition list formatting__ : with a subsequent explanation"),
+"\n```no-highlight\n**This is definition list formatting**\n:   with a subsequent explanation\n\n```\n\n",
+LANGPREF N_("They may render the same here, but note the extra leading spaces in the second example: this means that they will convert differently for use in the web interface help. That in turn means your formatting will be all over the place unless you handle the dl/dt/dd formatting in Tvheadend's CSS."),
+" \n\n",
+LANGPREF N_("Stick to paragraph formatting unless and until you have a need for definition lists."),
+"\n\n#### ",
+LANGPREF N_("Lists"),
+"\n\n",
+LANGPREF N_("Mixed lists don't work without further python extensions. Be careful."),
+"\n```no-highlight\n1. First ordered list item\n2. Another item\n  * Unordered sub-list. \n1. Actual numbers don't matter, just that it's a number\n  1. Ordered sub-list\n4. And another item.\n\n   You can't have have properly indented paragraphs within list items. \n\n* Unordered list can use asterisks\n- Or minuses\n+ Or pluses\n\nOh, and\n\n77. Each numbered (ordered) list will restart from 1.\n```\n\n",
+LANGPREF N_("... produces:"),
+"\n\n1. ",
+LANGPREF N_("First ordered list item"),
+"\n2. ",
+LANGPREF N_("Another item"),
+"\n  * ",
+LANGPREF N_("Unordered sub-list."),
+" \n3. ",
+LANGPREF N_("Actual numbers don't matter, just that it's a number"),
+"\n  1. ",
+LANGPREF N_("Ordered sub-list"),
+"\n4. ",
+LANGPREF N_("And another item."),
+"\n  ",
+LANGPREF N_("You can't have have properly indented paragraphs within list items."),
+" \n5. ",
+LANGPREF N_("Unordered list can use asterisks"),
+"\n6. ",
+LANGPREF N_("Or minuses"),
+"\n7. ",
+LANGPREF N_("Or pluses"),
+"\n\n",
+LANGPREF N_("Oh, and"),
+"\n\n1. ",
+LANGPREF N_("Each numbered (ordered) list will restart from 1."),
+"\n\n#### ",
+LANGPREF N_("Tables"),
+"\n\n",
+LANGPREF N_("Tables can be constructed as follows."),
+"\n\n",
+LANGPREF N_("The markup code:"),
+"\n```no-highlight\nFirst Header                | Second Header\n--------------------------- | -------------\nContent from cell 1         | Content from cell 2\nContent in the first column | Content in the second column\n\n```\n\n",
+LANGPREF N_("Will generate:"),
+"\n\n",
+LANGPREF N_("First Header"),
+" | ",
+LANGPREF N_("Second Header"),
+"\n----- | -----\n",
+LANGPREF N_("Content from cell 1"),
+" | ",
+LANGPREF N_("Content from cell 2"),
+"\n",
+LANGPREF N_("Content in the first column"),
+" | ",
+LANGPREF N_("Content in the second column"),
+"\n\n",
+LANGPREF N_("And if you don't want a header, you can leave it out - but the cells remain in this theme, so I'd suggest you don't do this as it's ugly:"),
+"\n```no-highlight\n | \n--------------------------- | -------------\nHeadless table cell 1       | Content from cell 2\nContent in the first column | Content in the second column\n\n```\n\n ",
+LANGPREF N_("| --------------------------- | ------------- Headless table cell 1 | Content from cell 2 Content in the first column | Content in the second column"),
+"\n\n",
+LANGPREF N_("We're using default heading/cell justification, so it's consistent throughout."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_overview[] = {
+"### ",
+LANGPREF N_("Overview of Tvheadend"),
+"\n\n#### ",
+LANGPREF N_("Welcome to Tvheadend!"),
+"\n\n",
+LANGPREF N_("Tvheadend is a lightweight, easily-configured, general-purpose TV/video streaming server and recorder (PVR/DVR) for GNU/Linux, FreeBSD and Android."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("Tvheadend interface"),
+"](images/overall_screenshot.png)\n\n",
+LANGPREF N_("It supports input from:"),
+"\n\n* ",
+LANGPREF N_("Cable TV, delivered via a cable to your house (DVB-C)"),
+"\n* ",
+LANGPREF N_("Satellite, so any signal coming in via a dish (DVB-S and DVB-S2)"),
+"\n* ",
+LANGPREF N_("Terrestrial, so over-the-air broadcasts received through a traditional television aerial (DVB-T and DVB-T2 in much of the world, ATSC in north and central America)"),
+"\n* ",
+LANGPREF N_("Internet and LAN feeds, such as IPTV, SAT>IP, HDHomeRun and a general-purpose MPEG-TS `pipe://`"),
+"\n\n",
+LANGPREF N_("As well as being able to record the input, Tvheadend also offers it up to client applications via HTTP (VLC, MPlayer), HTSP (Kodi, Movian) and SAT>IP streaming."),
+"\n\n",
+LANGPREF N_("While supported in previous versions, analogue video (V4L) is no longer supported directly. If you still need this, or need to input signals from video cameras or other non-broadcast sources, use `pipe://`."),
+"\n\n",
+LANGPREF N_("The code is hosted at"),
+" [",
+LANGPREF N_("github"),
+"](https://github.com/tvheadend/tvheadend)",
+LANGPREF N_(". Please use github's features if you want to provide patches. Contributions and improvements are always welcome."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_requirements[] = {
+"### ",
+LANGPREF N_("Basic Requirements"),
+"\n\n#### ",
+LANGPREF N_("Physical Architecture"),
+"\n\n",
+LANGPREF N_("It's perfectly possible to install and run Tvheadend as a single-seat installation, with the software running on the same system as any client software (e.g. Kodi), with all files stored locally."),
+"\n\n",
+LANGPREF N_("Alternatively, you can run Tvheadend on a server, perhaps on an always-on system that houses your media, perhaps on a dedicated low-power system - it's your choice."),
+"\n\n",
+LANGPREF N_("Where you have aerial/coax connections might influence your choice - unless you use SAT>IP or have some other way to transport your TV signal over a LAN, your Tvheadend installation has to live where you can actually connect your tuners."),
+" \n\n#### ",
+LANGPREF N_("System Requirements"),
+"\n\n",
+LANGPREF N_("Wherever you install it, Tvheadend primarily runs on __Linux__ - pre-built binaries are available for most Debian-based distributions (Debian itself, Ubuntu, Mint...) and RPMs for Fedora, or you can build it yourself. It runs on both 32- and 64-bit x86 and ARM processors, and so also can be built for Android (which uses the Linux kernel)."),
+"\n\n",
+LANGPREF N_("You will only need __c. 30MB disk space__ for the application and associated files, and maybe anything up to __1GB__ for your configuration - depending on how many tuners of what type you have, how many channels you receive, your choice of programme guide, and so on. You'll clearly need much more for your recordings, though: as a guide, an hour of SD MPEG-2 video will take about 1GB, while high bitrate HD H.264 will easily consume 5GB+ per hour."),
+"\n\n",
+LANGPREF N_("Tvheadend is intended to be lightweight, so it will run on a NAS or similar __low-powered CPU__ . Note that the exception here is transcoding: if you want to convert high-definition video in real time then you will need a powerful, multi-core system. It will happily run in less than __1GB of RAM__ , and many people run it successfully on original Raspberry Pis with perhaps only 256MB of usable free memory. This does depend on what else you're using the computer for, though, as a GUI will drain your system as will any serious file serving."),
+"\n\n",
+LANGPREF N_("And, of course, you'll need one or more __TV tuners__ if you want to receive regular broadcast television - otherwise, you're limited to IP sources."),
+"\n\n",
+LANGPREF N_("An __Internet connection__ is recommended but not essential. You need to have an accurate clock for EPG timers to work, for example, but this can be synchronised from the broadcast signal if you're not in a position to use `ntp` or similar."),
+"\n\n#### ",
+LANGPREF N_("How Lightweight?"),
+"\n\n",
+LANGPREF N_("How about light enough to run on a travel router? Take a look at this"),
+" [",
+LANGPREF N_("example"),
+"](https://tvheadend.org/boards/4/topics/16579) ",
+LANGPREF N_("from one of our users..."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_status_connections[] = {
+"### ",
+LANGPREF N_("Status - Connections"),
+"\n\n",
+LANGPREF N_("This tab shows information about all active connections."),
+"\n\n",
+LANGPREF N_("This is a read-only tab; nothing is configurable."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Status - Subscriptions' Tab"),
+"](docresources/statusconnections.png)\n\n---\n\n##### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Display this help page."),
+"\n__",
+LANGPREF N_("View Level"),
+"__  | ",
+LANGPREF N_("Change the interface view level to show/hide more advanced options."),
+"\n\n---\n\n##### ",
+LANGPREF N_("Grid Items"),
+"\n\n",
+LANGPREF N_("The main grid items have the following functions:"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_status_service_mapper[] = {
+"### ",
+LANGPREF N_("Status - Service Mapper"),
+"\n\n",
+LANGPREF N_("This tab shows information about current service mapping activity."),
+"\n\n",
+LANGPREF N_("This is a read-only tab; nothing is configurable."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Status - Subscriptions' Tab"),
+"](docresources/statusservicemapper.png)\n\n---\n\n##### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Display this help page."),
+"\n\n---\n\n##### ",
+LANGPREF N_("Grid Items"),
+"\n\n",
+LANGPREF N_("The main grid items have the following functions:"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_status_stream[] = {
+"### ",
+LANGPREF N_("Status - Stream"),
+"\n\n",
+LANGPREF N_("This tab shows information about all currently-open streams."),
+"\n\n",
+LANGPREF N_("This is a read-only tab; nothing is configurable."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Status - Stream' Tab"),
+"](docresources/statusstream.png)\n\n---\n\n##### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Display this help page."),
+"\n\n---\n\n##### ",
+LANGPREF N_("Grid Items"),
+"\n\n",
+LANGPREF N_("The main grid items have the following functions:"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_status_subscriptions[] = {
+"### ",
+LANGPREF N_("Status - Subscriptions"),
+"\n\n",
+LANGPREF N_("This tab shows information about all active subscriptions to Tvheadend."),
+"\n\n",
+LANGPREF N_("This is a read-only tab; nothing is configurable."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Status - Subscriptions' Tab"),
+"](docresources/statussubscriptions.png)\n\n---\n\n##### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Display this help page."),
+"\n\n---\n\n##### ",
+LANGPREF N_("Grid Items"),
+"\n\n",
+LANGPREF N_("The main grid items have the following functions:"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n\n",
+LANGPREF N_("__Item__ : Description"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_toc[] = {
+"##### ",
+LANGPREF N_("Table of Contents"),
+"\n\n[",
+LANGPREF N_("Introduction"),
+"](index)\n\n* [",
+LANGPREF N_("To-do"),
+"](todo)\n* [",
+LANGPREF N_("Overview"),
+"](overview)\n* [",
+LANGPREF N_("Basic Requirements"),
+"](requirements)\n* [",
+LANGPREF N_("Features"),
+"](features)\n\n",
+LANGPREF N_("Getting Started"),
+"\n\n* [",
+LANGPREF N_("Before you begin (concepts)"),
+"](before_begin)\n* [",
+LANGPREF N_("Install hardware"),
+"](install_hardware)\n* [",
+LANGPREF N_("Install tvheadend"),
+"](install_tvheadend)\n* [",
+LANGPREF N_("Configure Tvheadend"),
+"](configure_tvheadend)\n\n",
+LANGPREF N_("Web Interface Guide"),
+"\n\n* [",
+LANGPREF N_("General"),
+"](webui_general)\n* ",
+LANGPREF N_("Electronic Program Guide"),
+"\n  * [",
+LANGPREF N_("EPG Grid"),
+"](epg)\n* ",
+LANGPREF N_("Digital Video Recorder"),
+"\n  * [",
+LANGPREF N_("DVR Entries"),
+"](class/dvrentry)\n  * [",
+LANGPREF N_("Upcoming/Current Recordings"),
+"](class/dvrentry)\n  * [",
+LANGPREF N_("Finished Recordings"),
+"](class/dvrentry)\n  * [",
+LANGPREF N_("Failed Recordings"),
+"](class/dvrentry)\n  * [",
+LANGPREF N_("Auto-recording (Autorecs)"),
+"](class/dvrautorec)\n  * [",
+LANGPREF N_("Time-based Recording (Timers)"),
+"](class/dvrtimerec)\n\n",
+LANGPREF N_("Web Interface Configuration Guide"),
+"\n\n* ",
+LANGPREF N_("General"),
+"\n  * [",
+LANGPREF N_("Base Config"),
+"](class/config)\n  * [",
+LANGPREF N_("Image Cache Config"),
+"](class/imagecache)\n  * [",
+LANGPREF N_("SAT>IP Server Config"),
+"](class/satip_server)\n* ",
+LANGPREF N_("Access Configuration (Users)"),
+"\n  * [",
+LANGPREF N_("Access Entries"),
+"](class/access)\n  * [",
+LANGPREF N_("Passwords"),
+"](class/passwd)\n  * [",
+LANGPREF N_("IP Address Block List"),
+"](class/ipblocking)\n* ",
+LANGPREF N_("DVB Inputs"),
+"\n  * [",
+LANGPREF N_("TV Adapters"),
+"](tv_adapters)\n  * [",
+LANGPREF N_("Networks"),
+"](class/mpegts_network)\n  * [",
+LANGPREF N_("Muxes"),
+"](class/mpegts_mux)\n  * [",
+LANGPREF N_("Services"),
+"](class/mpegts_service)\n  * [",
+LANGPREF N_("Mux Schedulers"),
+"](class/mpegts_mux_sched)\n* ",
+LANGPREF N_("Channel / EPG"),
+"\n  * [",
+LANGPREF N_("Channels"),
+"](class/channel)\n  * [",
+LANGPREF N_("Channel Tags"),
+"](class/channeltag)\n  * [",
+LANGPREF N_("Bouquets"),
+"](class/bouquet)\n  * [",
+LANGPREF N_("EPG Grabber Channels"),
+"](class/epggrab_channel)\n  * [",
+LANGPREF N_("EPG Grabber"),
+"](class/epggrab)\n  * ",
+LANGPREF N_("EPG Grabber Modules"),
+"\n    * [",
+LANGPREF N_("OTA Module"),
+"](class/epggrab_mod_ota)\n    * [",
+LANGPREF N_("Internal PyEPG"),
+"](class/epggrab_mod_int_pyepg)\n    * [",
+LANGPREF N_("Internal XMLTV"),
+"](class/epggrab_mod_int_xmltv)\n    * [",
+LANGPREF N_("External PyEPG"),
+"](class/epggrab_mod_ext_pyepg)\n    * [",
+LANGPREF N_("External XMLTV"),
+"](class/epggrab_mod_ext_xmltv)\n* ",
+LANGPREF N_("Stream"),
+"\n  * ",
+LANGPREF N_("Stream Profiles"),
+"\n    * [",
+LANGPREF N_("HTSP Profile"),
+"](class/profile-htsp)\n    * [",
+LANGPREF N_("MPEG-TS Pass-thru Profile"),
+"](class/profile-mpegts)\n    * [",
+LANGPREF N_("Matroska Profile"),
+"](class/profile-matroska)\n    * [",
+LANGPREF N_("MPEG-TS/libav Profile"),
+"](class/profile-libav-mpegts)\n    * [",
+LANGPREF N_("Matroska/libav Profile"),
+"](class/profile-libav-matroska)\n    * [",
+LANGPREF N_("MP4/libav Profile"),
+"](class/profile-libav-mp4)\n    * [",
+LANGPREF N_("Transcode Profile"),
+"](class/profile-transcode)\n  * [",
+LANGPREF N_("Video Stream Filters"),
+"](class/esfilter_video)\n  * [",
+LANGPREF N_("Audio Stream Filters"),
+"](class/esfilter_audio)\n  * [",
+LANGPREF N_("Teletext Stream Filters"),
+"](class/esfilter_teletext)\n  * [",
+LANGPREF N_("Subtitle Stream Filters"),
+"](class/esfilter_subtit)\n  * [",
+LANGPREF N_("CA Stream Filters"),
+"](class/esfilter_ca)\n  * [",
+LANGPREF N_("Other Stream Filters"),
+"](class/esfilter_other)\n* ",
+LANGPREF N_("Recording"),
+"\n  * [",
+LANGPREF N_("Digital Video Recorder Profiles"),
+"](class/dvrconfig)\n  * [",
+LANGPREF N_("Timeshift"),
+"](class/timeshift)\n* ",
+LANGPREF N_("Conditional Access (CA)"),
+"\n  * [",
+LANGPREF N_("CAPMT (Linux Network DVBAPI)"),
+"](class/caclient_capmt)\n  * [",
+LANGPREF N_("Code word client (newcamd)"),
+"](class/caclient_cwc)\n  * [",
+LANGPREF N_("DES constant code word client"),
+"](class/caclient_ccw_des)\n  * [",
+LANGPREF N_("AES constant code word client"),
+"](class/caclient_ccw_aes)\n* [",
+LANGPREF N_("Debugging"),
+"](class/tvhlog_conf)\n\n",
+LANGPREF N_("Web Status Tab"),
+"\n\n* [",
+LANGPREF N_("Stream"),
+"](status_stream)\n* [",
+LANGPREF N_("Subscriptions"),
+"](status_subscriptions)\n* [",
+LANGPREF N_("Connections"),
+"](status_connections)\n* [",
+LANGPREF N_("Server Mapper"),
+"](status_service_mapper)\n\n",
+LANGPREF N_("Appendices"),
+"\n\n* [",
+LANGPREF N_("Appendix 1 - URL syntax (Exports)"),
+"](url)\n* [",
+LANGPREF N_("Appendix 2 - FAQ"),
+"](faqs)\n* [",
+LANGPREF N_("Appendix 3 - Command-line Options"),
+"](cmdline_options)\n* [",
+LANGPREF N_("Appendix 4 - Debugging Options"),
+"](debugging)\n* [",
+LANGPREF N_("Appendix 5 - Updating this documentation"),
+"](doc_update)\n* [",
+LANGPREF N_("Appendix 6 - Markdown Cribsheet"),
+"](markdown_cribsheet)\n\n[",
+LANGPREF N_("About"),
+"](about)\n",
+
+NULL
+};
+
+const char *tvh_doc_root_todo[] = {
+"### ",
+LANGPREF N_("Things To Do on This Guide..."),
+"\n\n##### ",
+LANGPREF N_("Work-in-progress notes"),
+"\n\n",
+LANGPREF N_("These are not part of the final product, obviously!"),
+"\n\n",
+LANGPREF N_("They're just some of the areas I'm aware of that we need to close off before release"),
+"\n\n1. ",
+LANGPREF N_("Complete the content for 4.0 (4.2 can wait) - strip out what isn't stricly necessary now (we can come back)"),
+"\n2. ",
+LANGPREF N_("Check non-univeral (i.e. item-specific) configuration items (e.g. the IPTV mux parameters) and make sure they're documented"),
+"\n3. ",
+LANGPREF N_("Obviously, fill in the minor gaps as highlighted in the document: buttons, descriptions, etc."),
+"\n4. ",
+LANGPREF N_("Generate new webUI help pages and push them to the tvheadend repo"),
+"\n5. ",
+LANGPREF N_("Check all link from tvh (e.g. there are no help buttons on the 'Stream' tabs)"),
+"\n\n",
+LANGPREF N_("The following major content items/chapters are then missing - based on most FAQs on the forum:"),
+"\n\n* ",
+LANGPREF N_("Transcoding (updated for 4.2, so needs to be tagged properly and reversed as applicable to 4.0)"),
+"\n* ",
+LANGPREF N_("How to configure a recording"),
+"\n* ",
+LANGPREF N_("How to watch Live TV"),
+"\n* ",
+LANGPREF N_("How to set up conditional access (\"Conditional Access System Configuration\")"),
+"\n* ",
+LANGPREF N_("How to set up a multi-profile installation (access)"),
+"\n* ",
+LANGPREF N_("How to compile/install on _insert your distro here_"),
+" \n* ",
+LANGPREF N_("Setting up SAT>IP - as a client, as a server"),
+"\n* ",
+LANGPREF N_("Platform differences - what you need to transcode, or what you can expect from Android vs GNU/Linux"),
+"\n* ",
+LANGPREF N_("Platform differences - Ubuntu, Fedora, Red Hat, Arch, Android..."),
+"\n* ",
+LANGPREF N_("HD Homerun setup"),
+"\n* ",
+LANGPREF N_("/etc/default/tvheadend options"),
+"\n* ",
+LANGPREF N_("Expand a bit on command-line options and give some examples of common usage"),
+"\n\n",
+LANGPREF N_("And I'm left with these final open questions:"),
+"\n\n* ",
+LANGPREF N_("We need the webUI pages documented (as they are). How much should they be the how-tos, and how much should these be separate?"),
+"\n* ",
+LANGPREF N_("How deep do we want to (need to) get into setting up tuners - that's a constant source of woe for people?"),
+"\n* ",
+LANGPREF N_("If we do all the above, do we need the FAQ pages? Check existing manual/guide"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_tv_adapters[] = {
+"### ",
+LANGPREF N_("DVB Inputs - TV Adapters"),
+"\n\n",
+LANGPREF N_("The adapters and tuners are listed and edited in a tree."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'TV Adapter tree'"),
+"](docresources/tvadaptertree.png)\n\n---\n\n#### ",
+LANGPREF N_("Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save the current configuration."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n\n#### ",
+LANGPREF N_("Device Tree"),
+"\n\n",
+LANGPREF N_("The device tree lists the available frontends, LNB configuration and so on related to your device(s) in sections. Clicking on these sections will display all available parameters and various device information."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'TV Adapter params'"),
+"](docresources/tvadapterparams.png)\n\n",
+LANGPREF N_("__Tip__ : Remember to save your changes _before_ switching panels."),
+"\n\n---\n\n### ",
+LANGPREF N_("Device Configuration Options"),
+"\n\n",
+LANGPREF N_("You will generally see the following parameters for your device(s), however there are device-specific parameters too, see"),
+"  [",
+LANGPREF N_("Device-specific Parameters"),
+"](#device-specific-parameters) ",
+LANGPREF N_("for a full list."),
+"\n",
+ITEMSINCPREF "linuxdvb_frontend",
+"\n---\n\n### ",
+LANGPREF N_("Device-specific Parameters"),
+"\n\n#### ",
+LANGPREF N_("Satellite (DVB-S/ISDB-S)"),
+"\n\n* ",
+LANGPREF N_("Frontend"),
+"\n  * [",
+LANGPREF N_("Master"),
+"](class/linuxdvb_frontend_dvbs)\n  * [",
+LANGPREF N_("Master (ISDB-S)"),
+"](class/linuxdvb_frontend_isdb_s)\n  * [",
+LANGPREF N_("Slave"),
+"](class/linuxdvb_frontend_dvbs_slave)\n* ",
+LANGPREF N_("Satellite Configuration"),
+"\n  * [",
+LANGPREF N_("Universal LNB"),
+"](class/linuxdvb_satconf_lnbonly)\n  * [",
+LANGPREF N_("2 Port"),
+"](class/linuxdvb_satconf_2port)\n  * [",
+LANGPREF N_("4 Port"),
+"](class/linuxdvb_satconf_4port)\n* ",
+LANGPREF N_("Satellite Configuration (Advanced)"),
+"\n  * [",
+LANGPREF N_("Advanced LNB"),
+"](class/linuxdvb_satconf_advanced)\n  * [",
+LANGPREF N_("Unicable EN50494 (experimental)"),
+"](class/linuxdvb_satconf_en50494)\n  * [",
+LANGPREF N_("DiseqC Rotor"),
+"](class/linuxdvb_rotor)\n  * [",
+LANGPREF N_("DiSEqC Switch"),
+"](class/linuxdvb_switch)\n  * [",
+LANGPREF N_("Rotor (GOTOX)"),
+"](class/linuxdvb_rotor_gotox)\n  * [",
+LANGPREF N_("Rotor (USALS)"),
+"](class/linuxdvb_rotor_usals)\n\n---\n\n#### ",
+LANGPREF N_("Terrestrial (DVB-T/ATSC-T/ISDB-T)"),
+"\n\n* ",
+LANGPREF N_("Frontend"),
+"\n  * [",
+LANGPREF N_("DVB-T/DVB-T2"),
+"](class/linuxdvb_frontend_dvbt)\n  * [",
+LANGPREF N_("ATSC-T"),
+"](class/linuxdvb_frontend_atsc_t)\n  * [",
+LANGPREF N_("ISDB-T"),
+"](class/linuxdvb_frontend_isdb_t)\n\n---\n\n#### ",
+LANGPREF N_("Cable (DVB-C/ATSC-C/ISDB-C)"),
+"\n\n* ",
+LANGPREF N_("Frontend"),
+"\n  * [",
+LANGPREF N_("DVB-C"),
+"](class/linuxdvb_frontend_dvbc)\n  * [",
+LANGPREF N_("ATSC-C"),
+"](class/linuxdvb_frontend_atsc_c)\n  * [",
+LANGPREF N_("ISDB-C"),
+"](class/linuxdvb_frontend_isdb_c)\n",
+
+NULL
+};
+
+const char *tvh_doc_root_url[] = {
+"### ",
+LANGPREF N_("URL syntax"),
+"\n\n",
+LANGPREF N_("Please, add `http://IP:Port` to complete the URL."),
+"\n\n#### ",
+LANGPREF N_("/play/REMAIN"),
+"\n\n",
+LANGPREF N_("Return the playlist in _xspf_ or _m3u_ format. If the agent is in the list of direct agents (like wget/curl/vlc), the stream is returned instead."),
+"\n\n",
+LANGPREF N_("The remain part can be any URL starting with /stream ."),
+"\n\n",
+LANGPREF N_("Option"),
+" | ",
+LANGPREF N_("Explanation"),
+"\n----- | -----\n",
+LANGPREF N_("playlist"),
+" | ",
+LANGPREF N_("Playlist type, can be"),
+" _",
+LANGPREF N_("xspf"),
+"_  ",
+LANGPREF N_("or"),
+" _",
+LANGPREF N_("m3u"),
+"_ \n\n",
+LANGPREF N_("__Example:__ `http://127.0.0.1:9981/play/stream/channelname/Life?playlist=xspf`"),
+"\n\n#### ",
+LANGPREF N_("/playlist[/TYPE][/WHAT][/IDENTIFIER]"),
+"\n\n",
+LANGPREF N_("Return the m3u playlist in Enigma2 format. By default (if the rest of path is ommitted), an redirection answer will be sent where /channels remainder is used."),
+"\n\n",
+LANGPREF N_("TYPE"),
+" | ",
+LANGPREF N_("Playlist type"),
+"\n----- | -----\n_",
+LANGPREF N_("empty"),
+"_  | ",
+LANGPREF N_("M3U"),
+"\n",
+LANGPREF N_("e2"),
+" | ",
+LANGPREF N_("Enigma2"),
+"\n",
+LANGPREF N_("satip"),
+" | ",
+LANGPREF N_("M3U using SAT>IP extensions"),
+"\n\n",
+LANGPREF N_("WHAT"),
+" | ",
+LANGPREF N_("Playlist contents"),
+"\n----- | -----\n",
+LANGPREF N_("channels"),
+" | ",
+LANGPREF N_("All channels"),
+"\n",
+LANGPREF N_("tags"),
+" | ",
+LANGPREF N_("All tags, for Enigma2 - tags are converted to labels"),
+"\n",
+LANGPREF N_("recordings"),
+" | ",
+LANGPREF N_("All recordings"),
+"\n",
+LANGPREF N_("channelnumber"),
+" | ",
+LANGPREF N_("One channel specified by channel number"),
+"\n",
+LANGPREF N_("channelname"),
+" | ",
+LANGPREF N_("One channel specified by channel name"),
+"\n",
+LANGPREF N_("channelid"),
+" | ",
+LANGPREF N_("One channel specified by short channel ID"),
+"\n",
+LANGPREF N_("tag"),
+" | ",
+LANGPREF N_("Tagged channels specified by UUID or tag name"),
+"\n",
+LANGPREF N_("tagname"),
+" | ",
+LANGPREF N_("Tagged channels specified by tag name"),
+"\n",
+LANGPREF N_("tagid"),
+" | ",
+LANGPREF N_("Tagged channels specified by short tag ID"),
+"\n",
+LANGPREF N_("dvrid"),
+" | ",
+LANGPREF N_("One DVR record specified by short DVR ID"),
+"\n\n",
+LANGPREF N_("Option"),
+" | ",
+LANGPREF N_("Explanation"),
+"\n----- | -----\n",
+LANGPREF N_("profile"),
+" | ",
+LANGPREF N_("Override streaming profile, otherwise the default profile for the user is used."),
+"\n\n#### ",
+LANGPREF N_("/stream/WHAT/IDENTIFIER"),
+"\n\n",
+LANGPREF N_("This URL scheme is used for streaming. The stream contents depends on the streaming profile. It might be MPEG-TS, Matroska or MP4."),
+"\n\n",
+LANGPREF N_("WHAT"),
+" | ",
+LANGPREF N_("Stream for"),
+"\n----- | -----\n",
+LANGPREF N_("channelnumber"),
+" | ",
+LANGPREF N_("Channel specified by channel number"),
+"\n",
+LANGPREF N_("channelname"),
+" | ",
+LANGPREF N_("Channel specified by channel name"),
+"\n",
+LANGPREF N_("channel"),
+" | ",
+LANGPREF N_("Channel specified by channel UUID"),
+"\n",
+LANGPREF N_("channelid"),
+" | ",
+LANGPREF N_("Channel specified by short channel ID"),
+"\n",
+LANGPREF N_("service"),
+" | ",
+LANGPREF N_("Service specified by service UUID"),
+"\n",
+LANGPREF N_("mux"),
+" | ",
+LANGPREF N_("Mux specified by mux UUID"),
+"\n\n",
+LANGPREF N_("Option"),
+" | ",
+LANGPREF N_("Explanation"),
+"\n----- | -----\n",
+LANGPREF N_("profile"),
+" | ",
+LANGPREF N_("(except /mux) Override streaming profile"),
+"\n",
+LANGPREF N_("weight"),
+" | ",
+LANGPREF N_("Override subscription weight"),
+"\n",
+LANGPREF N_("qsize"),
+" | ",
+LANGPREF N_("Override queue size in bytes (default value is 1500000 for channel/service, 10000000 for mux)"),
+"\n",
+LANGPREF N_("descramble"),
+" | ",
+LANGPREF N_("(/service only) do not descramble (if set to 0)"),
+"\n",
+LANGPREF N_("emm"),
+" | ",
+LANGPREF N_("(/service only) pass EMM to the stream (if set to 1)"),
+"\n",
+LANGPREF N_("pids"),
+" | ",
+LANGPREF N_("(/mux only) list of subscribed PIDs (comma separated)"),
+"\n\n#### ",
+LANGPREF N_("/hls/WHAT/IDENTIFIER/index.m3u8"),
+"\n\n",
+LANGPREF N_("This URL scheme is used for the shared HLS live streaming. Only one subscription and one muxer instance is running for each channel and streaming profile, the MPEG-TS segments are shared by all clients. The streaming profile must produce MPEG-TS output. The segment duration, the number of segments and the spill directory are set in the _HLS streaming_ section of the base configuration."),
+"\n\n",
+LANGPREF N_("WHAT"),
+" | ",
+LANGPREF N_("Stream for"),
+"\n----- | -----\n",
+LANGPREF N_("channelnumber"),
+" | ",
+LANGPREF N_("Channel specified by channel number"),
+"\n",
+LANGPREF N_("channelname"),
+" | ",
+LANGPREF N_("Channel specified by channel name"),
+"\n",
+LANGPREF N_("channel"),
+" | ",
+LANGPREF N_("Channel specified by channel UUID"),
+"\n",
+LANGPREF N_("channelid"),
+" | ",
+LANGPREF N_("Channel specified by short channel ID"),
+"\n\n",
+LANGPREF N_("Option"),
+" | ",
+LANGPREF N_("Explanation"),
+"\n----- | -----\n",
+LANGPREF N_("profile"),
+" | ",
+LANGPREF N_("Override streaming profile"),
+"\n\n#### ",
+LANGPREF N_("/xmltv[/WHAT][/IDENTIFIER]"),
+"\n\n",
+LANGPREF N_("Return the XMLTV EPG export. By default (if the rest of path is ommitted), an redirection answer will be sent where /channels remainder is used."),
+"\n\n",
+LANGPREF N_("WHAT"),
+" | ",
+LANGPREF N_("Playlist contents"),
+"\n----- | -----\n",
+LANGPREF N_("channels"),
+" | ",
+LANGPREF N_("All channels"),
+"\n",
+LANGPREF N_("channelnumber"),
+" | ",
+LANGPREF N_("One channel specified by channel number"),
+"\n",
+LANGPREF N_("channelname"),
+" | ",
+LANGPREF N_("One channel specified by channel name"),
+"\n",
+LANGPREF N_("channelid"),
+" | ",
+LANGPREF N_("One channel specified by short channel ID"),
+"\n",
+LANGPREF N_("tag"),
+" | ",
+LANGPREF N_("Tagged channels specified by UUID or tag name"),
+"\n",
+LANGPREF N_("tagname"),
+" | ",
+LANGPREF N_("Tagged channels specified by tag name"),
+"\n",
+LANGPREF N_("tagid"),
+" | ",
+LANGPREF N_("Tagged channels specified by short tag ID"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_webui_general[] = {
+"### ",
+LANGPREF N_("General Overview of Web Interface"),
+"\n\n",
+LANGPREF N_("Tvheadend is operated primarily through a tabbed web interface."),
+" \n\n",
+LANGPREF N_("There are some basic navigation concepts that will help you get around and make the best of it."),
+"\n\n##### ",
+LANGPREF N_("Page Structure"),
+"\n\n",
+LANGPREF N_("The interface is made up of nested tabs, so similar functions are grouped together (e.g. all configuration items at the top level, then all configuration items for a particular topic are below that)."),
+"\n\n",
+LANGPREF N_("Each tab is then typically laid out with a menu bar across the top that provides access to Add/Save/Edit-type functions, and a grid like a spreadsheet below that. The grid items are frequently editable."),
+"\n\n",
+LANGPREF N_("Most configuration items - certainly the ones that are common to all types of item covered by that tab - are in this grid. However, some item-specific configuration items are then only available through the _Add_ and _Edit_ dialog boxes. For example, the main network configuration tab grid covers parameters common to DVB-S, -T, -C and IPTV networks, but specific things such as FEC rolloff or mux URL are then only in the dialogs for networks that need these values."),
+"\n\n##### ",
+LANGPREF N_("Displaying and Manipulating Columns"),
+"\n\n* ",
+LANGPREF N_("Not all columns are necessarily visible. If you hover your mouse over a column heading, you'll see a down arrow - click here, and a drop-down menu will appear to give you access to __which columns are shown and which are not__ ."),
+"\n* ",
+LANGPREF N_("The same drop-down menu gives you access to a __sort__ function if defined (it doesn't always make sense to have a sortable column for some parameters). You can also sort a column by simply clicking on the column header; reverse the sort order by clicking again."),
+"\n* ",
+LANGPREF N_("And the same drop-down menu also gives you access to a __filter__ function if defined. The filter does simple pattern-matching on any string you provide."),
+"\n* ",
+LANGPREF N_("__Re-arrange__ the columns by simply dragging he header to a new spot."),
+"\n* ",
+LANGPREF N_("__Re-size__ the columns by dragging the very edges of the column header as required."),
+" \n\n##### ",
+LANGPREF N_("Editing Fields"),
+"\n\n* ",
+LANGPREF N_("To edit a cell, double click on it. After a cell is changed, a small red flag or triangle will appear in the top-left corner to indicate that it has been changed. These changes can now be kept (_Save_ button), or abandoned (_Undo_ button)."),
+"\n* ",
+LANGPREF N_("To change a check box or radio button, click once."),
+"\n* ",
+LANGPREF N_("To add a new entry, press the _Add_ button. The new (empty) entry will be created on the server but will not be saved and will not necessarily be enabled. You can now change all the cells to the desired values, check the ‘enable’ box if applicable and then press _Save_ to activate the new entry."),
+"\n* ",
+LANGPREF N_("Most rows are multi-selectable, so you can carry out certain actions on more than one entry at the same time. So, for example, you can select multiple items by using ctrl+click on each entry or click, shift+click to select a range."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_inc_add_grid_entry[] = {
+"#### ",
+LANGPREF N_("Adding an Entry"),
+"\n\n",
+LANGPREF N_("To add an entry click the _[Add]_ button from the menu bar, the add dialog should now be displayed. A common set of fields is used for the add dialog, most of which can be seen in the grid view. Pressing the _[Save]_ button (at the bottom of the dialog) will commit your changes and close the dialog, pressing the _[Apply]_ button will commit your changes but won't close the dialog, pressing the _[Cancel]_ button closes the dialog - any unsaved changes will be lost."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_inc_common_button_table_end[] = {
+LANGPREF N_("__View Level__ | Change the interface view level to show/hide more advanced options.\n__Help__ | Display this help page."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_inc_common_button_table_start[] = {
+"#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save any changes made to the grid/entries."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Revert any changes made since the last save."),
+"\n__",
+LANGPREF N_("Add"),
+"__  | ",
+LANGPREF N_("Display the"),
+" _",
+LANGPREF N_("Add entry"),
+"_  ",
+LANGPREF N_("dialog."),
+"\n__",
+LANGPREF N_("Delete"),
+"__  | ",
+LANGPREF N_("Delete the selected entry/entries."),
+"\n__",
+LANGPREF N_("Edit"),
+"__  | ",
+LANGPREF N_("Edit the selected entries."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_inc_del_grid_entries[] = {
+"#### ",
+LANGPREF N_("Deleting an Entry"),
+"\n\n",
+LANGPREF N_("Highlight (select) the desired entries in the grid, then press the _[Delete]_ button on the menu bar."),
+" \n\n",
+LANGPREF N_("__Deleting can't be undone. You will be prompted to confirm. __"),
+" \n\n",
+LANGPREF N_("__Tip__ : Rather than deleting an entry, you can disable it instead by unchecking the \"Enabled\" check box (if available)."),
+"\n",
+MDINCLUDE "inc/selecting_entries_tip",
+MDINCLUDE "inc/paging_tip",
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_inc_edit_grid_entries[] = {
+"#### ",
+LANGPREF N_("Editing an Entry"),
+"\n\n",
+LANGPREF N_("There are two methods to editing an entry."),
+"\n",
+MDINCLUDE "inc/selecting_entries_tip",
+MDINCLUDE "inc/paging_tip",
+"\n##### ",
+LANGPREF N_("Editing in the Grid"),
+"\n\n",
+LANGPREF N_("Highlight (select) the desired entry and then..:"),
+"\n\n* ",
+LANGPREF N_("To edit a cell, double click on it."),
+" \n* ",
+LANGPREF N_("To change a check box or radio button, click once."),
+"\n\n",
+LANGPREF N_("After a cell is changed, a small red flag or triangle will appear in the top-left corner to indicate that it has been changed. These changes can now be kept (_[Save]_ button), or abandoned (_[Undo]_ button)."),
+"\n\n##### ",
+LANGPREF N_("Using the"),
+" _",
+LANGPREF N_("[Edit]"),
+"_  ",
+LANGPREF N_("Button"),
+"\n\n",
+LANGPREF N_("Highlight (select) the entries in the grid that you'd like to edit, then click the _[Edit]_ button from the menu bar, the edit dialog should now be displayed. A common set of fields is used for the edit dialog, most of which can be seen in the grid view. Note that when editing multiple entries there is an additional check box before each setting, ticking it will apply that setting to all selected entries."),
+"\n\n",
+LANGPREF N_("Pressing the _[Save]_ button (at the bottom of the dialog) will commit your changes and close the dialog, pressing the _[Apply]_ button will commit your changes but won't close the dialog, pressing the _[Cancel]_ button closes the dialog - any unsaved changes will be lost."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_inc_paging_tip[] = {
+LANGPREF N_("\n__Tip__ : By default Tvheadend will only show a small selection of entries - you can increase the number of entries displayed by using the paging selector at the bottom right of the page."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_root_inc_selecting_entries_tip[] = {
+LANGPREF N_("\n__Tip__ : You can select all entries within the grid by pressing ctrl+A. You can also ctrl+click to make additional selections, or shift+click to select a range."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_access_entry_class[] = {
+LANGPREF N_("Setting up access control is an important initial step as __the system is initially wide open__ ."),
+" \n\n",
+LANGPREF N_("Tvheadend verifies access by scanning through all enabled access control entries in sequence, from the top of the list to the bottom. The permission flags, streaming profiles, DVR config profiles, channel tags and so on are combined for all matching access entries. An access entry is said to match if the username matches and the IP source address of the requesting peer is within the prefix. There is also anonymous access, if the user is set to asterisk. Only network prefix is matched then."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Access Entries Grid'"),
+"](docresources/accessentriesgrid.png)\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n",
+LANGPREF N_("Entries are checked in order (when logging in, etc), the following functions allows you to change the ordering:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Move Up"),
+"__  | ",
+LANGPREF N_("Move the selected entry up the grid."),
+"\n__",
+LANGPREF N_("Move Down"),
+"__  | ",
+LANGPREF N_("Move the selected entry down the grid."),
+" \n\n---\n",
+MDINCLUDE "inc/add_grid_entry",
+"\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Access Entry Example'"),
+"](docresources/accessentriesnewuser.png)\n\n",
+LANGPREF N_("If you would like to allow anonymous access to your Tvheadend server you may set-up an anonymous account by entering an asterisk `*` in the username field. __WARNING: All access rights given to an anonymous account also apply to subsequent accounts.__"),
+" \n\n",
+LANGPREF N_("__Don't forget__ to also create a password entry for the user in the _"),
+"[",
+LANGPREF N_("Passwords"),
+"](class/passwd)",
+LANGPREF N_("_ tab!"),
+"\n\n",
+LANGPREF N_("__Tips__ :"),
+"\n\n* ",
+LANGPREF N_("Be as limiting as possible especially when making Tvheadend available over the Internet."),
+"\n* ",
+LANGPREF N_("For extra security, always enter (a comma-separated list of) network prefix(es) (_Allowed networks_ )."),
+"\n* ",
+LANGPREF N_("If you lock yourself out, you can use the backdoor account to regain access, or restart Tvheadend with the `--noacl` argument."),
+"\n* ",
+LANGPREF N_("You can have multiple entries using the same username with varying rights, allowing you to enable / disable each as needed. Keep in mind that matching account entry permissions are combined."),
+"\n* ",
+LANGPREF N_("If you create an anonymous account, it also requires a"),
+" [",
+LANGPREF N_("password"),
+"](class/passwd) ",
+LANGPREF N_("entry (enter an asterisk `*` for both the username and password fields when adding the entry)."),
+"\n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_caclient_class[] = {
+LANGPREF N_("Tvheadend supports connecting to card clients via the cwc (newcamd) and capmt (linux network dvbapi) protocols for so-called 'softcam' descrambling."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'CA Client Configuration Example'"),
+"](docresources/caclientconfig.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save any changes made to the CA client configuration"),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Undo any changes made to the CA client configuration since the last save."),
+"\n__",
+LANGPREF N_("Add"),
+"__  | ",
+LANGPREF N_("Add a new CA client configuration."),
+"\n__",
+LANGPREF N_("Delete"),
+"__  | ",
+LANGPREF N_("Delete an existing CA client configuration."),
+"\n__",
+LANGPREF N_("Clone"),
+"__  | ",
+LANGPREF N_("Clone the currently selected configuration."),
+"\n__",
+LANGPREF N_("Move Up"),
+"__  | ",
+LANGPREF N_("Move the selected CA client configuration up in the list."),
+"\n__",
+LANGPREF N_("Move Down"),
+"__  | ",
+LANGPREF N_("Move the selected CA client configuration down in the list."),
+"\n__",
+LANGPREF N_("Show/Hide Passwords"),
+"__  | ",
+LANGPREF N_("Reveal/Hide any stored CA client passwords."),
+"\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Display this help page."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Available CA types"),
+"\n\n",
+LANGPREF N_("The following configuration parameters are used, depending on the type of CA access:"),
+"\n\n* ",
+LANGPREF N_("List of types"),
+"\n  * [",
+LANGPREF N_("CAPMT (Linux Network DVBAPI)"),
+"](class/caclient_capmt)\n  * [",
+LANGPREF N_("Code word client (newcamd)"),
+"](class/caclient_cwc)\n  * [",
+LANGPREF N_("DES constant code word client"),
+"](class/caclient_ccw_des)\n  * [",
+LANGPREF N_("AES constant code word client"),
+"](class/caclient_ccw_aes)\n\n---\n\n#### ",
+LANGPREF N_("Connection Status"),
+"\n\n",
+LANGPREF N_("The icon next to each entry within the grid indicates the client's connection status."),
+"\n\n",
+LANGPREF N_("Icon"),
+" | ",
+LANGPREF N_("Description"),
+"\n----- | -----\n![",
+LANGPREF N_("'Accept/OK Icon'"),
+"](icons/accept.png) | ",
+LANGPREF N_("The client is connected."),
+"\n![",
+LANGPREF N_("'Error Icon'"),
+"](icons/exclamation.png) | ",
+LANGPREF N_("There was an error connecting."),
+"\n![",
+LANGPREF N_("'Stop/Disabled Icon'"),
+"](icons/stop.png) | ",
+LANGPREF N_("The client is disabled."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Adding/Editing a CA Configuration"),
+"\n\n",
+LANGPREF N_("To create a new CA configuration press the _[Add]_ button from the menu bar, you will then be asked to select a client type. Once you've selected a type you can then enter/select the desired options from the resultant _Add_ dialog."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add CA Config'"),
+"](docresources/configcaadd.png)\n\n",
+LANGPREF N_("To edit an existing configuration, click on it from within the grid, the _Parameters_ panel should then appear on the right hand side."),
+"\n\n",
+LANGPREF N_("__Tips__ :"),
+" \n\n* ",
+LANGPREF N_("Remember to _[Save]_ your changes before selecting another config from within the grid."),
+"\n* ",
+LANGPREF N_("You can clone an existing config by clicking the _[Clone]_ button."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Deleting a CA Configuration"),
+"\n\n",
+LANGPREF N_("Highlight (select) the desired entry from the grid, then press the _[Delete]_ button from the menu bar."),
+" \n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_channel_class[] = {
+LANGPREF N_("This tab lists all defined channels."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Channel lists'"),
+"](docresources/configchannellist.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save any changes made to the grid entries."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Undo any changes made since the last save."),
+"\n__",
+LANGPREF N_("Add"),
+"__  | ",
+LANGPREF N_("Create a new channel using the"),
+" _",
+LANGPREF N_("Add Channel"),
+"_  ",
+LANGPREF N_("dialog."),
+"\n__",
+LANGPREF N_("Delete"),
+"__  | ",
+LANGPREF N_("Delete the selected entries."),
+"\n__",
+LANGPREF N_("Edit"),
+"__  | ",
+LANGPREF N_("Edit the selected entries."),
+"\n__",
+LANGPREF N_("Map Services"),
+"__  | ",
+LANGPREF N_("Drop down menu: Map selected services, map"),
+" [",
+LANGPREF N_("services"),
+"](class/mpegts_service)",
+LANGPREF N_(". Map all services, map all available"),
+" [",
+LANGPREF N_("services"),
+"](class/mpegts_service) ",
+LANGPREF N_("as channels. Both options use the"),
+" _",
+LANGPREF N_("Map services to channels"),
+"_  ",
+LANGPREF N_("dialog."),
+" \n__",
+LANGPREF N_("Number Operations"),
+"__  | ",
+LANGPREF N_("Drop down menu: Assign Number, assign the lowest available channel number(s) to the selected channel(s). Number Up, increment the selected channel number(s) by 1. Number Down, decrement the selected channel numbers by 1. Swap Numbers, swap the numbers of"),
+" __",
+LANGPREF N_("two"),
+"__  ",
+LANGPREF N_("selected channels."),
+"\n__",
+LANGPREF N_("View Level"),
+"__  | ",
+LANGPREF N_("Change the interface view level to show/hide more advanced options."),
+"\n__",
+LANGPREF N_("Reset Icon"),
+"__  | ",
+LANGPREF N_("Reset the selected channel(s)"),
+" _",
+LANGPREF N_("User Icon"),
+"_  ",
+LANGPREF N_("/"),
+" _",
+LANGPREF N_("Icon URL"),
+"_ ",
+LANGPREF N_(", especially useful if you change your Picon settings."),
+"\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Displays this help page."),
+" \n\n---\n\n#### ",
+LANGPREF N_("Adding/Editing a Channel."),
+"\n\n",
+LANGPREF N_("To add a channel press the _[Add]_ button from the menu bar. To Edit a channel you can highlight the channel(s) you want to edit then press the _[Edit]_ button, or edit the an entry directly in the grid."),
+"\n\n",
+LANGPREF N_("The _Add_ and _Edit_ buttons use a dialog similar to the following."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Channel Edit (single)'"),
+"](docresources/channeleditsingle.png)\n\n",
+LANGPREF N_("If you've selected multiple entries the _Edit Channel_ dialog will look slightly different."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Channel Edit (multiple)'"),
+"](docresources/channeleditmultiple.png)\n\n",
+LANGPREF N_("Ticking the additional check box (before each setting) will apply that setting to all selected channels."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Deleting Channels"),
+"\n\n",
+LANGPREF N_("To delete channels highlight the desired channels from within the grid, and press the _[Delete]_ button from the menu bar."),
+" \n\n",
+LANGPREF N_("__Tip__ : You can select all channels within the grid by pressing ctrl+A. You can also ctrl+click to make additional selections, or shift+click to select a range."),
+" \n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_config_class[] = {
+LANGPREF N_("This tabs allow configuration of several general parameters that affect the core Tvheadend functionality."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'General Base' Tab Screenshot 1"),
+"](docresources/configbaseall.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The the following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save the current configuration."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Undo changes since the last save."),
+"\n__",
+LANGPREF N_("Start wizard"),
+"__  | ",
+LANGPREF N_("Display the first-run set-up wizard."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_dvrautorec_class[] = {
+LANGPREF N_("This tab controls EPG-driven recording rules."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Autorec' Tab"),
+"](docresources/dvrautorecentries.png)\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+MDINCLUDE "inc/add_grid_entry",
+"\n",
+LANGPREF N_("If you wanted to record any programs matching \"BBC News\" on BBC One you would enter something like this into the add entry dialog:"),
+" \n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Autorec' example entry"),
+"](docresources/dvrautorecadd.png)\n\n",
+LANGPREF N_("This uses a regular expression (regex) to match the program title \"BBC News\" exactly, otherwise event titles containing the phrase would also match, e.g \"BBC News at One\" and \"BBC News at Six\" etc."),
+"\n\n",
+LANGPREF N_("Regular expressions examples:"),
+"\n\n",
+LANGPREF N_("Regex"),
+" | ",
+LANGPREF N_("Description"),
+"\n----- | -----\n ",
+"`^BBC News$` | ",
+LANGPREF N_("Matches \"BBC News\" exactly."),
+"\n ",
+"`^(New\\: )?Regular Show$` | ",
+LANGPREF N_("Matches \"Regular Show\" and (if it exists) \"New: Regular Show\"."),
+"\n\n",
+LANGPREF N_("Matching events will be added to the _"),
+"[",
+LANGPREF N_("Upcoming/Current Recordings"),
+"](class/dvrentry)",
+LANGPREF N_("_ tab. __Note that if your rule matches any in-progress events they will automatically start being recorded.__"),
+" \n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Edit Autorec'"),
+"](docresources/editautorec.png)\n\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_dvrconfig_class[] = {
+"### ",
+LANGPREF N_("Configuration - Recording - Digital Video Recorder Profiles"),
+"\n\n",
+LANGPREF N_("This tab is used to configure operation of the Digital Video Recorder. It is not used for scheduling or administration of individual recordings."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Digital Video Recorder Profiles' Tab 1"),
+"](docresources/configdvrtab.png)\n",
+
+NULL
+};
+
+const char *tvh_doc_dvrentry_class[] = {
+LANGPREF N_("DVR entries are how Tvheadend manages upcoming/current, finished and failed recordings."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Digital Video Recorder' Tabs"),
+"](docresources/configdvrtabs4.png)\n\n",
+LANGPREF N_("Each entry is moved between the tabs depending on its state:"),
+"\n\n* ",
+LANGPREF N_("Upcoming and currently recording entries remain in the _Upcoming/Current Recordings_ tab."),
+"\n* ",
+LANGPREF N_("When a recording completes successfully the entry is moved to the _Finished Recordings_ tab."),
+"\n* ",
+LANGPREF N_("When a recording fails (or is aborted) the entry is moved to the _Failed Recordings_ tab."),
+"\n\n",
+LANGPREF N_("Please note that the grid in each tab may have different columns and not all entry information is available until it completes or fails, e.g filesize, total data errors, etc."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Delete"),
+"__  | ",
+LANGPREF N_("Delete the selected grid entries."),
+"\n__",
+LANGPREF N_("Edit"),
+"__  | ",
+LANGPREF N_("Edit the selected grid entries."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n",
+LANGPREF N_("The following functions are only available in the __Upcoming/Current Recordings__ tab."),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Add"),
+"__  | ",
+LANGPREF N_("Add a new (one-time-only) recording entry."),
+"\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save changes made to the grid entries."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Revert all changes made to the grid entries since the last save."),
+"\n__",
+LANGPREF N_("Stop"),
+"__  | ",
+LANGPREF N_("Gracefully stop the selected in-progress recording entries."),
+"\n__",
+LANGPREF N_("Abort"),
+"__  | ",
+LANGPREF N_("Abruptly stop the selected in-progress recording entries."),
+" \n\n",
+LANGPREF N_("The following functions are only available in the __Finished Recordings__ and __Failed Recordings__ tabs:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Download"),
+"__  | ",
+LANGPREF N_("Download the recording."),
+"\n__",
+LANGPREF N_("Re-record"),
+"__  | ",
+LANGPREF N_("Re-schedule the selected entry/recording if possible."),
+"\n\n",
+LANGPREF N_("The following functions are only available in the __Finished Recordings__ tab."),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Move to failed"),
+"__  | ",
+LANGPREF N_("Move the selected recording entries to the"),
+" __",
+LANGPREF N_("Failed Recordings"),
+"__  ",
+LANGPREF N_("tab."),
+"\n\n",
+LANGPREF N_("The following functions are only available in the __Failed Recordings__ tab."),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Move to finished"),
+"__  | ",
+LANGPREF N_("Move the selected recording entries to the"),
+" _",
+LANGPREF N_("Finished Recordings"),
+"_  ",
+LANGPREF N_("tab."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Entry Overview"),
+"\n\n",
+LANGPREF N_("The _Details_ column gives a quick overview as to the status of each entry:"),
+"\n\n",
+LANGPREF N_("Icon"),
+" | ",
+LANGPREF N_("Description"),
+"\n----- | -----\n![",
+LANGPREF N_("Clock icon"),
+"](icons/scheduled.png) | ",
+LANGPREF N_("the program is scheduled (upcoming)"),
+"\n![",
+LANGPREF N_("Recording icon"),
+"](icons/rec.png) | ",
+LANGPREF N_("recording of the program is active and underway (current)"),
+"\n![",
+LANGPREF N_("Information icon"),
+"](icons/information.png) | ",
+LANGPREF N_("click to display detailed information about the selected recording"),
+"\n![",
+LANGPREF N_("Exclamation icon"),
+"](icons/exclamation.png) | ",
+LANGPREF N_("the program failed to record"),
+"\n![",
+LANGPREF N_("Accept icon"),
+"](icons/accept.png) | ",
+LANGPREF N_("the program recorded successfully"),
+"\n\n---\n",
+MDINCLUDE "inc/add_grid_entry",
+"\n",
+LANGPREF N_("Note that the _[Add]_ functionality is only available in the _Upcoming/Current Recordings_ tab."),
+" \n\n##### ",
+LANGPREF N_("Manual Recording Entry Example"),
+"\n\n",
+LANGPREF N_("This is an example of a one-time recording entry:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add new recording dialog'"),
+"](docresources/addnewrecentry.png)\n\n##### ",
+LANGPREF N_("Adding an Entry Using the EPG"),
+"\n\n",
+LANGPREF N_("Using the Electronic Program Guide search functionality, find the program/event you would like to record. Click on it, then using the broadcast details dialog you can:"),
+"\n\n* ",
+LANGPREF N_("Record the event once by pressing the _[Record program]_ button."),
+"\n* ",
+LANGPREF N_("Automatically record all upcoming events matching the program's title by pressing the _[Autorec]_ button."),
+"\n* ",
+LANGPREF N_("Record all upcoming series episodes by pressing the _[Record series]_ button. __This replaces the _[Autorec]_ button when series link information is available.__"),
+" \n\n",
+LANGPREF N_("For full instructions on how to search and record using the EPG take a look at the"),
+" [",
+LANGPREF N_("EPG"),
+"](epg) ",
+LANGPREF N_("page."),
+"\n\n##### ",
+LANGPREF N_("Adding an Entry Using Autorec Rules"),
+"\n\n",
+LANGPREF N_("Autorec rules allow you to match events using various options."),
+" \n\n* ",
+LANGPREF N_("Record events using regular expressions, they can be as simple or as powerful as you like."),
+"\n* ",
+LANGPREF N_("Record events that broadcast between certain times or days of the week."),
+"\n\n",
+LANGPREF N_("See"),
+" [",
+LANGPREF N_("Autorec"),
+"](class/dvrautorec) ",
+LANGPREF N_("for more information."),
+"\n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n\n#### ",
+LANGPREF N_("Playing a Recording"),
+"\n\n",
+LANGPREF N_("You can play a recording by clicking the _Play_ icon. This will automatically launch an appropriate player, otherwise you will need to manually open the playlist to start watching (normally a double-click on the downloaded file)."),
+"\n\n",
+LANGPREF N_("Note that these are not links to an actual file but to a playlist."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Downloading a Recording"),
+"\n\n",
+LANGPREF N_("Highlight (select) the desired entry, then press the _[Download]_ button on the menu bar."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Re-recording an Entry/Re-schedule a Recording"),
+"\n\n",
+LANGPREF N_("You can re-schedule an entry by pressing the _[Re-record]_ button on the menu bar."),
+"\n\n",
+LANGPREF N_("__Note__ : Your EPG data must have another matching event to be able to re-schedule the entry."),
+"\n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_dvrtimerec_class[] = {
+LANGPREF N_("This tab controls timer-driven recording rules."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("Timer Tab"),
+"](docresources/timers.png)\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+MDINCLUDE "inc/add_grid_entry",
+"\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("Timer add example"),
+"](docresources/dvrtimeradd.png)\n\n",
+LANGPREF N_("Note that when you create a rule/entry it will also generate a"),
+" [",
+LANGPREF N_("DVR Entry"),
+"](class/dvrentry)",
+LANGPREF N_("."),
+"\n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_imagecache_class[] = {
+LANGPREF N_("This will cache any channel icons or other images (such as EPG metadata) to be served from the local webserver. This can be useful for multi-client systems and, generally, to reduce hits on upstream providers."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Configuration - Image Cache tab'"),
+"](docresources/configimagecache.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save any changes made to the tab."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Revert any changes made since the last save."),
+"\n__",
+LANGPREF N_("Clean image (icon) cache"),
+"__  | ",
+LANGPREF N_("Clean-up the stored image files (empty cache and re-fetch icons)."),
+"\n__",
+LANGPREF N_("Re-fetch images"),
+"__  | ",
+LANGPREF N_("Re-refresh image cache (reload images from upstream providers)."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_ipblocking_class[] = {
+LANGPREF N_("This tab allows to configure blocked IP ranges. Users within these ranges are not allowed to login (use any Tvheadend service)."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Access Control - Entries tab'"),
+"](docresources/accessconfigipblockentries.png)\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+MDINCLUDE "inc/add_grid_entry",
+"\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add Entries Dialog'"),
+"](docresources/accessipblockingedit.png)\n\n",
+LANGPREF N_("__Tip__ : You can enter a comma-separated list of network prefixes, if you're unsure as to what to enter in the _Network prefix_ field take a look at"),
+"  [",
+LANGPREF N_("this guide"),
+"](https://www.ripe.net/about-us/press-centre/understanding-ip-addressing)",
+LANGPREF N_("."),
+"\n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_linuxdvb_frontend_class[] = {
+LANGPREF N_("This is the list of available parameters for the linuxdvb frontend. It is used as a base for other frontends."),
+"\n\n",
+LANGPREF N_("See"),
+" [",
+LANGPREF N_("TV Adapters"),
+"](tv_adapters)",
+LANGPREF N_("."),
+"\n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_linuxdvb_frontend_dvbc_class[] = {
+LANGPREF N_("This panel lists all the available Cable (DVB-C/C2/ISDB-C/ATSC-C) frontend parameters."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'DVB-C frontend parameters'"),
+"](docresources/dvbcfrontendparams.png)\n\n---\n\n* ",
+LANGPREF N_("Other Frontends"),
+"\n  * [",
+LANGPREF N_("DVB-C"),
+"](class/linuxdvb_frontend_dvbc)\n  * [",
+LANGPREF N_("ATSC-C"),
+"](class/linuxdvb_frontend_atsc_c)\n  * [",
+LANGPREF N_("ISDB-C"),
+"](class/linuxdvb_frontend_isdb_c)\n* ",
+LANGPREF N_("Back to"),
+" [",
+LANGPREF N_("TV Adapters"),
+"](tv_adapters) \n\n---\n\n#### ",
+LANGPREF N_("Buttons"),
+"\n\n",
+LANGPREF N_("The following buttons are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save the current configuration."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_linuxdvb_frontend_dvbs_class[] = {
+LANGPREF N_("This panel lists all the available satellite (DVB-S/ISDB-S) frontend parameters."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'DVB-S frontend parameters'"),
+"](docresources/dvbsfrontendparams.png)\n\n---\n\n* ",
+LANGPREF N_("Other Frontends"),
+"\n  * [",
+LANGPREF N_("Master"),
+"](class/linuxdvb_frontend_dvbs)\n  * [",
+LANGPREF N_("Master (ISDB-S)"),
+"](class/linuxdvb_frontend_isdb_s)\n  * [",
+LANGPREF N_("Slave"),
+"](class/linuxdvb_frontend_dvbs_slave)\n* ",
+LANGPREF N_("Back to"),
+" [",
+LANGPREF N_("TV Adapters"),
+"](tv_adapters) \n\n---\n\n#### ",
+LANGPREF N_("Buttons"),
+"\n\n",
+LANGPREF N_("The following buttons are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save the current configuration."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_linuxdvb_frontend_dvbt_class[] = {
+LANGPREF N_("This panel lists all the available Terrestrial (DVB-T/T2/ISDB-T/ATSC-T) frontend parameters."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'DVB-T frontend parameters'"),
+"](docresources/dvbtfrontendparams.png)\n\n---\n\n* ",
+LANGPREF N_("Other Frontends"),
+"\n  * [",
+LANGPREF N_("DVB-T/DVB-T2"),
+"](class/linuxdvb_frontend_dvbt)\n  * [",
+LANGPREF N_("ATSC-T"),
+"](class/linuxdvb_frontend_atsc_t)\n  * [",
+LANGPREF N_("ISDB-T"),
+"](class/linuxdvb_frontend_isdb_t)\n* ",
+LANGPREF N_("Back to"),
+" [",
+LANGPREF N_("TV Adapters"),
+"](tv_adapters) \n\n---\n\n#### ",
+LANGPREF N_("Buttons"),
+"\n\n",
+LANGPREF N_("The following buttons are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save the current configuration."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_linuxdvb_satconf_class[] = {
+LANGPREF N_("This panel tab lists all the available satellite (DVB-S/ISDB-S) configuration parameters."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Example Configuration'"),
+"](docresources/dvbsatconf.png)\n\n---\n\n#### ",
+LANGPREF N_("Buttons"),
+"\n\n",
+LANGPREF N_("The following buttons are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save the current configuration."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n\n* ",
+LANGPREF N_("Satellite Configuration"),
+"\n  * [",
+LANGPREF N_("Universal LNB"),
+"](class/linuxdvb_satconf_lnbonly)\n  * [",
+LANGPREF N_("2 Port"),
+"](class/linuxdvb_satconf_2port)\n  * [",
+LANGPREF N_("4 Port"),
+"](class/linuxdvb_satconf_4port)\n* ",
+LANGPREF N_("Satellite Configuration (Advanced)"),
+"\n  * [",
+LANGPREF N_("Advanced LNB"),
+"](class/linuxdvb_satconf_advanced)\n  * [",
+LANGPREF N_("Unicable EN50494 (experimental)"),
+"](class/linuxdvb_satconf_en50494)\n  * [",
+LANGPREF N_("DiseqC Rotor"),
+"](class/linuxdvb_rotor)\n  * [",
+LANGPREF N_("DiSEqC Switch"),
+"](class/linuxdvb_switch)\n  * [",
+LANGPREF N_("Rotor (GOTOX)"),
+"](class/linuxdvb_rotor_gotox)\n  * [",
+LANGPREF N_("Rotor (USALS)"),
+"](class/linuxdvb_rotor_usals)\n* ",
+LANGPREF N_("Back to"),
+" [",
+LANGPREF N_("TV Adapters"),
+"](tv_adapters) \n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_mcast_output_class[] = {
+LANGPREF N_("This tab allows to re-stream channels to a multicast group. Each enabled entry keeps one permanent subscription for the channel and sends the MPEG-TS output of the selected stream profile to the given group and port, so any number of receivers in the local network can join the stream without additional load on the server."),
+"\n\n",
+LANGPREF N_("The datagrams carry 7 TS packets and may be wrapped with a RTP header (payload type 33). When _PCR pacing_ is enabled, the datagrams are sent at the rate given by the stream clock rather than in bursts. The optional SAP announcements allow players like VLC to list the stream automatically."),
+"\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+MDINCLUDE "inc/add_grid_entry",
+"\n",
+LANGPREF N_("__Tip__ : Use addresses from the administratively scoped range (239.0.0.0/8) and keep the _TTL_ low unless the routers in your network are configured to forward the multicast traffic."),
+"\n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_memoryinfo_class[] = {
+LANGPREF N_("This tab displays various memory usage information useful for debugging."),
+"\n\n",
+LANGPREF N_("__It does not have any user configurable options.__"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_mpegts_mux_class[] = {
+LANGPREF N_("Muxes are locations at which services can be found. On traditional networks (DVB-C, -T and -S), these are carrier signals on which the individual channels are multiplexed, hence the name. However, Tvheadend also uses the term ‘mux’ to describe a source for multiple IP streams - so an IP address, in effect."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Mux List'"),
+"](docresources/configdvbmux.png)\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n\n#### ",
+LANGPREF N_("Adding an Entry/Mux"),
+"\n\n",
+LANGPREF N_("To add a mux press the _[Add]_ button from the menu bar and select the network you want to add the mux to:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Network selection'"),
+"](docresources/addmuxnetworkselection.png)\n\n",
+LANGPREF N_("Then enter the mux information:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add Mux Dialog'"),
+"](docresources/configaddmuxexample.png)\n\n",
+LANGPREF N_("Pressing the _[Save]_ button (at the bottom of the dialog) will commit your changes and close the dialog, pressing the _[Apply]_ button will commit your changes but won't close the dialog, pressing the _[Cancel]_ button closes the dialog - any unsaved changes will be lost."),
+"\n\n",
+LANGPREF N_("Note: You only really need to add muxes if the pre-defined list didn't work, e.g. because of out-of-date data as broadcasters re-arrange their services or because automatic detection (network discovery) hasn't successfully found all the muxes over time."),
+"\n\n",
+LANGPREF N_("__Tips__ :"),
+" \n\n* ",
+LANGPREF N_("If you're not sure what to enter here, take a look at the \"If Necessary, Manually Add Muxes\" section on the"),
+" [",
+LANGPREF N_("Configure Tvheadend"),
+"](configure_tvheadend)  ",
+LANGPREF N_("page."),
+"\n* ",
+LANGPREF N_("Some tuners (or drivers) require more tuning parameters than others so be sure to enter as many tuning parameters as possible."),
+"\n* ",
+LANGPREF N_("Newly added muxes are automatically set to the _PEND_ state."),
+"\n* ",
+LANGPREF N_("Tvheadend won't scan the newly added mux instantly, it can take up to 10 minutes to begin an initial scan."),
+"\n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n\n#### ",
+LANGPREF N_("Deleting an Entry/Mux"),
+"\n\n",
+LANGPREF N_("To delete a mux highlight (select) the desired muxes from within the grid, and press the _[Delete]_ button from the menu bar."),
+" \n\n",
+LANGPREF N_("Deleting a mux will also remove any associated services, including those mapped to channels. If you have network discovery enabled any previously deleted muxes found in the NIT during a scan will automatically be re-added."),
+"\n",
+MDINCLUDE "inc/selecting_entries_tip",
+MDINCLUDE "inc/paging_tip",
+"\n---\n\n#### ",
+LANGPREF N_("Playing a Mux"),
+"\n\n",
+LANGPREF N_("You can stream a complete multiplex by copying/pasting the _Play_ icon link into the desired player/software."),
+"\n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("The links don't link to the actual stream but to a playlist for use with media players such as VLC, If you'd prefer to receive the raw transport stream instead, you can do so by removing the `/play/` path from the URL."),
+"\n* ",
+LANGPREF N_("Not all devices support receiving a complete mux, notably low powered set-top-boxes and older USB tuners."),
+" \n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_mpegts_mux_sched_class[] = {
+LANGPREF N_("Mux Schedulers enable Tvheadend to automatically play channels. This is useful to get EPG, services or access rights updates."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Mux Schedule Entries'"),
+"](docresources/configdvbmuxsched.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save any changes made."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Undo any changes made since the last save."),
+"\n__",
+LANGPREF N_("Add"),
+"__  | ",
+LANGPREF N_("Add a new entry."),
+"\n__",
+LANGPREF N_("Delete"),
+"__  | ",
+LANGPREF N_("Delete an existing entry."),
+"\n__",
+LANGPREF N_("Edit"),
+"__  | ",
+LANGPREF N_("Edit an existing schedule entry."),
+"\n__",
+LANGPREF N_("View Level"),
+"__  | ",
+LANGPREF N_("Change the interface view level to show/hide more advanced options."),
+"\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Displays this help page."),
+" \n\n---\n\n#### ",
+LANGPREF N_("Adding/Editing an Entry"),
+"\n\n",
+LANGPREF N_("You can add an entry by pressing the _[Add]_ button from the menu bar. To edit an entry highlight (select) the entry from within the grid, and press the _[Edit]_ button from the menu bar."),
+"\n\n",
+LANGPREF N_("A common set of fields is used for the Add or Edit functions, most of which can be seen in the grid view:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Mux Add/Edit Example'"),
+"](docresources/configdvbmuxsched1.png)\n\n",
+LANGPREF N_("__Tip__ : You can also edit entries directly within the grid."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Deleting an Entry"),
+"\n\n",
+LANGPREF N_("To delete an entry highlight (select) the entry from within the grid, and press the _[Delete]_ button from the menu bar."),
+"\n\n",
+LANGPREF N_("__Tip__ : You can select all entries within the grid by pressing ctrl+A. You can also ctrl+click to make additional selections, or shift+click to select a range."),
+" \n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_mpegts_network_class[] = {
+LANGPREF N_("A network is the type of carrier for your television signals. Tvheadend supports several different types of network, notably:"),
+"\n\n* [",
+LANGPREF N_("Network Types"),
+"](class/mpegts_network)\n  * ",
+LANGPREF N_("Cable TV, delivered via a cable to your house"),
+"\n    * [",
+LANGPREF N_("DVB-C"),
+"](class/dvb_network_dvbc) ",
+LANGPREF N_("- common in most of Europe"),
+"\n    * [",
+LANGPREF N_("ISDB-C"),
+"](class/dvb_network_isdb_c) ",
+LANGPREF N_("- common in Brazil and various other countries throughout south America"),
+"\n    * [",
+LANGPREF N_("ATSC-C"),
+"](class/dvb_network_atsc_c) ",
+LANGPREF N_("- common in north and central America and parts of south Asia"),
+"\n  * ",
+LANGPREF N_("Satellite, any signal coming in via a dish"),
+"\n    * [",
+LANGPREF N_("DVB-S"),
+"](class/dvb_network_dvbs) ",
+LANGPREF N_("- Available worldwide"),
+"\n    * [",
+LANGPREF N_("ISDB-S"),
+"](class/dvb_network_isdb_s) ",
+LANGPREF N_("- available worldwide but common in Brazil and various other countries throughout south America"),
+"\n  * ",
+LANGPREF N_("Terrestrial, over-the-air broadcasts received through a traditional television aerial"),
+"\n    * [",
+LANGPREF N_("DVB-T"),
+"](class/dvb_network_dvbt) ",
+LANGPREF N_("- common in most of Europe"),
+"\n    * [",
+LANGPREF N_("ISDB-T"),
+"](class/dvb_network_isdb_t) ",
+LANGPREF N_("- common in Brazil and various other countries throughout south America"),
+"\n    * [",
+LANGPREF N_("ATSC-T"),
+"](class/dvb_network_atsc_t) ",
+LANGPREF N_("- common in north and central America"),
+"\n  * ",
+LANGPREF N_("IPTV - TV over the Internet via your broadband connection"),
+"\n    * [",
+LANGPREF N_("IPTV"),
+"](class/iptv_network)\n    * [",
+LANGPREF N_("IPTV Automatic Network"),
+"](class/iptv_auto_network) ",
+LANGPREF N_("- IPTV using a playlist as the source"),
+"\n\n",
+LANGPREF N_("Click the desired network type (above) to see all available"),
+"  [",
+LANGPREF N_("parameters"),
+"](#items)",
+LANGPREF N_("."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Networks' Tab Screenshot"),
+"](docresources/dvbinputsnetwork.png)\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n",
+LANGPREF N_("The following tab specific buttons are available:"),
+" \n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Force Scan"),
+"__  | ",
+LANGPREF N_("Force a new scan (i.e. scan all muxes for services) for the selected networks."),
+"\n\n---\n\n#### ",
+LANGPREF N_("Adding an Entry/Network"),
+"\n\n",
+LANGPREF N_("To create a network click the _[Add]_ button from the menu bar and then select the required network type:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Network selection'"),
+"](docresources/networktypeselect.png)\n\n",
+LANGPREF N_("Then using the resultant dialog enter/select the desired network options. A common set of fields is used for the _[Add]_ dialog, most of which can be seen in the grid view."),
+" \n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add new network'"),
+"](docresources/addnewnetwork.png)\n\n",
+LANGPREF N_("Pressing the _[Save]_ button (at the bottom of the dialog) will commit your changes and close the dialog, pressing the _[Apply]_ button will commit your changes but won't close the dialog, pressing the _[Cancel]_ button closes the dialog - any unsaved changes will be lost."),
+"\n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("Once you've created a network (and added muxes) you must assign it to an __enabled__ adapter."),
+"\n* ",
+LANGPREF N_("There is a 5-10 minute delay before a scan starts, this is so you can make changes if needed (this does not apply to IPTV networks)."),
+"\n\n",
+LANGPREF N_("For more detailed information on networks and how to set them up, see"),
+"  [",
+LANGPREF N_("Configure Tvheadend."),
+"](configure_tvheadend) \n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add/Edit Network' Dialog - DVB-S/2"),
+"](docresources/dvbnetworkedit.png)\n\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n\n#### ",
+LANGPREF N_("Force Scanning"),
+"\n\n",
+LANGPREF N_("Highlight (select) the network(s) you would like to force scan, and then press the \"Force Scan\" button from the menu bar."),
+"\n\n",
+LANGPREF N_("Force scanning can take some time. You may continue to use Tvheadend while a scan is in progress, but doing so will increase the time needed for it to complete. Note that the time required can vary depending on a number of factors, such as how many tuners you have available and the number of muxes on each."),
+"\n",
+MDINCLUDE "inc/selecting_entries_tip",
+MDINCLUDE "inc/paging_tip",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_mpegts_service_class[] = {
+LANGPREF N_("Services are automatically pulled from muxes and can be mapped to Channels."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Services'"),
+"](docresources/configdvbservices.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n",
+LANGPREF N_("The following tab specific buttons are available:"),
+" \n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Map Services"),
+"__  | ",
+LANGPREF N_("Drop down menu: Map selected services, map the highlighted services within the grid. Map all services, map all available services as channels. Both options use the"),
+" _",
+LANGPREF N_("Map services to channels"),
+"_  ",
+LANGPREF N_("dialog."),
+" \n\n---\n\n#### ",
+LANGPREF N_("Mapping Services to Channels"),
+"\n\n",
+LANGPREF N_("There are a number of methods to mapping available services."),
+"\n\n",
+LANGPREF N_("_Map all services_ and _Map selected services_ functions use the following _Map services to channels_ dialog:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Service mapper dialog'"),
+"](docresources/mapservicesdialog.png)\n\n##### ",
+LANGPREF N_("Mapping All"),
+"\n\n",
+LANGPREF N_("Press the _[Map services]_ button and then _[Map all services]_ :"),
+" \n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Map All Services'"),
+"](docresources/mapservicesall.png)\n\n",
+LANGPREF N_("The _Map services to channels_ dialog will now appear, listing all available services and various other"),
+" [",
+LANGPREF N_("mapping options."),
+"](class/service_mapper) ",
+LANGPREF N_("The ticked check boxes [✓] indicate which services will be mapped, when you're happy with the selection press the \"Map services\" button. You will then be taken to the Service Mapper tab which will begin mapping services to channels."),
+" \n\n##### ",
+LANGPREF N_("Mapping Selected"),
+"\n\n",
+LANGPREF N_("Click on the services you would like to map as channels. Once you're done selecting, press the \"Map services\" button and then \"Map selected services\" - be careful not to click on the grid or you'll lose your selection!"),
+"\n",
+MDINCLUDE "inc/selecting_entries_tip",
+"\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Map selected'"),
+"](docresources/mapselectedservices.png)\n\n",
+LANGPREF N_("The _Map services to channels_ dialog will now appear, listing all available services and various other"),
+" [",
+LANGPREF N_("mapping options."),
+"](class/service_mapper) ",
+LANGPREF N_("The ticked check boxes [✓] indicate which services will be mapped, when you're happy with the selection press the \"Map services\" button. You will then be taken to the Service Mapper tab which will begin mapping services to channels."),
+" \n\n",
+LANGPREF N_("__Tip__ : By default Tvheadend will only show a small selection of available services - you can increase this by using the paging selector at the bottom right of the page."),
+"\n\n##### ",
+LANGPREF N_("Mapping/Removing a Service to/from an Existing Channel"),
+"\n\n",
+LANGPREF N_("You can map/remove a service to/from an existing channel by doing the following:"),
+"\n\n",
+LANGPREF N_("__1)__ Find the desired service from within the services grid."),
+" \n\n",
+LANGPREF N_("If you have a lot of services you may want to use filtering to limit the number of grid entries, you can do this by hovering your mouse over the _Service name_ column, a down arrow ▾ should now be visible. Clicking the arrow will then display a list of options, move your mouse down to \"Filters\", a text box should then appear, click on it and enter the desired service's name."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Service filtering'"),
+"](docresources/servicefilter.png)\n\n",
+LANGPREF N_("__Tip__ : Remember to remove the filter when you're finished (uncheck the check box next to the \"Filters\" option)."),
+" \n\n",
+LANGPREF N_("__2)__ Double click on the channel field, a drop down listing of all defined channels will appear, check/untick the check box next to the channel you'd like to associate/disassociate the service with."),
+" \n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add service to channel example'"),
+"](docresources/addservicetochannel.png)\n\n",
+LANGPREF N_("__3)__ Press the _[Save]_ button from the menu bar and you're done!"),
+"\n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_passwd_class[] = {
+LANGPREF N_("This tab is the second part of Tvheadend's access control mechanism. It is where you set and maintain all user passwords (e.g. for streaming or DVR access)."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Configuration - Passwords tab'"),
+"](docresources/configpasswordentries.png)\n\n---\n",
+MDINCLUDE "inc/common_button_table_start",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+MDINCLUDE "inc/add_grid_entry",
+"\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add Password dialog'"),
+"](docresources/configpasswdadd.png)\n\n",
+LANGPREF N_("Be aware that the username you enter must match a username/entry in the"),
+" [",
+LANGPREF N_("Access Entries"),
+"](class/access_entry) ",
+LANGPREF N_("tab for it to apply. You may have multiple password entries for the same username if you wish."),
+" \n\n---\n",
+MDINCLUDE "inc/edit_grid_entries",
+"\n---\n",
+MDINCLUDE "inc/del_grid_entries",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_profile_class[] = {
+"### ",
+LANGPREF N_("Configuration - Stream - Stream Profiles"),
+"\n\n",
+LANGPREF N_("Stream Profiles are the settings for output formats. These are used for Live TV streaming and recordings. The profiles are assigned through the Access Entries, DVR Profiles or as parameter for HTTP Streaming."),
+"\n\n* ",
+LANGPREF N_("Types"),
+"\n  * [",
+LANGPREF N_("HTSP Profile"),
+"](class/profile-htsp)\n  * [",
+LANGPREF N_("MPEG-TS Pass-thru Profile"),
+"](class/profile-mpegts)\n  * [",
+LANGPREF N_("Matroska Profile"),
+"](class/profile-matroska)\n  * [",
+LANGPREF N_("MPEG-TS/libav Profile"),
+"](class/profile-libav-mpegts)\n  * [",
+LANGPREF N_("Matroska/libav Profile"),
+"](class/profile-libav-matroska)\n  * [",
+LANGPREF N_("MP4/libav Profile"),
+"](class/profile-libav-mp4)\n  * [",
+LANGPREF N_("Transcode Profile"),
+"](class/profile-transcode)\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Stream Profiles'"),
+"](docresources/configstreamprofiles.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save any changes made to the stream profile configuration."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Undo any changes made to the stream profile configuration since the last save."),
+"\n__",
+LANGPREF N_("Add"),
+"__  | ",
+LANGPREF N_("Add a new stream profile."),
+"\n__",
+LANGPREF N_("Delete"),
+"__  | ",
+LANGPREF N_("Delete an existing stream profile."),
+"\n__",
+LANGPREF N_("View Level"),
+"__  | ",
+LANGPREF N_("Change the interface view level to show/hide more advanced options."),
+"\n__",
+LANGPREF N_("Help"),
+"__  | ",
+LANGPREF N_("Display this help page."),
+"\n\n---\n\n##### ",
+LANGPREF N_("Add/Edit Dialog Example"),
+"\n\n",
+LANGPREF N_("A common set of fields is used for the _Add_ or _Edit_ functions, most of which can be seen in the grid view:"),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add/Edit Stream Profiles' Dialog - mkv"),
+"](docresources/configstreamprofiles1.png)\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add/Edit Stream Profiles' Dialog - ts"),
+"](docresources/configstreamprofiles2.png)\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'Add/Edit Stream Profiles' Dialog - transcode"),
+"](docresources/configstreamprofiles3.png)\n\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_satip_server_class[] = {
+LANGPREF N_("SAT>IP Server is something like DVB network tuner. Tvheadend can forward mpegts input streams including on-the-fly descramling to SAT>IP clients."),
+"\n\n",
+LANGPREF N_("Only networks with the “SAT>IP Source” field set are exported through the SAT>IP protocol. This field is matched through the “src” parameter requested by the SAT>IP client. Usually (and by default) this value is 1. For satellite tuners, this value determines the satellite source (dish). By specification position 1 = DiseqC AA, 2 = DiseqC AB, 3 = DiseqC BA, 4 = DiseqC BB, but any numbers may be used - depends on the SAT>IP client. Note that if you use a similar number for multiple networks, the first matched network containing the mux with requested parameters will win (also for unknown mux)."),
+"\n\n",
+LANGPREF N_("!"),
+"[",
+LANGPREF N_("'SAT"),
+">",
+LANGPREF N_("IP Config tab'"),
+"](docresources/satipconfig.png)\n\n---\n\n#### ",
+LANGPREF N_("Menu Bar/Buttons"),
+"\n\n",
+LANGPREF N_("The following functions are available:"),
+"\n\n",
+LANGPREF N_("Button"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("Save"),
+"__  | ",
+LANGPREF N_("Save all changes."),
+"\n__",
+LANGPREF N_("Undo"),
+"__  | ",
+LANGPREF N_("Revert all changes since last save."),
+"\n__",
+LANGPREF N_("Discover SAT"),
+">",
+LANGPREF N_("IP servers"),
+"__  | ",
+LANGPREF N_("Attempt to discover more SAT>IP servers on the network."),
+"\n",
+MDINCLUDE "inc/common_button_table_end",
+"\n---\n",
+
+NULL
+};
+
+const char *tvh_doc_config_channelicon_path_property[] = {
+LANGPREF N_(":"),
+" \n\n",
+LANGPREF N_("The following placeholders are available:"),
+"\n\n",
+LANGPREF N_("Placeholder"),
+" | ",
+LANGPREF N_("Function"),
+"\n----- | -----\n__",
+LANGPREF N_("%C"),
+"__  | ",
+LANGPREF N_("The transliterated channel name in ASCII (safe characters, no spaces, etc. - so"),
+" `Das Erste HD` ",
+LANGPREF N_("will be"),
+" `Das_Erste_HD`",
+LANGPREF N_(", but"),
+" `WDR Köln` ",
+LANGPREF N_("will be"),
+" `WDR_Koln`",
+LANGPREF N_(")"),
+"\n__",
+LANGPREF N_("%c"),
+"__  | ",
+LANGPREF N_("The channel name (URL encoded ASCII)"),
+"\n\n",
+LANGPREF N_("Example: `file:///tmp/icons/%C.png` or `http://example.com/%c.png`"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_config_channelname_scheme_property[] = {
+LANGPREF N_(": You must correctly set the _Channel icon path_ (above) to be able to generate icon filenames. Note that changing this option __won't__ automatically (re-)generate icon filenames, you must manually (re-)generate them using the _[Reset Icons]_ button in the _Configuration -> Channel / EPG -> Channels_ tab."),
+"\n\n",
+LANGPREF N_("Scheme"),
+" | ",
+LANGPREF N_("Description"),
+"\n----- | -----\n",
+LANGPREF N_("No scheme"),
+" | ",
+LANGPREF N_("Use service name \"as is\" to generate the filename."),
+"\n",
+LANGPREF N_("All lower-case"),
+" | ",
+LANGPREF N_("Generate lower-case filenames."),
+"\n",
+LANGPREF N_("Service name picons"),
+" | ",
+LANGPREF N_("Generate lower-case filenames using picon formatting."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_config_picon_path_property[] = {
+LANGPREF N_("This can be named however you wish, as either a local (file://) or remote (http://) location - however, remember that it’s pointing to a directory as the picon names are automatically generated from the service parameters frequency, orbital position, etc.)."),
+"\n\n",
+LANGPREF N_("Example: `file:///home/hts/picons`"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_config_picon_servicetype_property[] = {
+LANGPREF N_(": You must set the _Picon path_ (above) to be able to correctly generate icon filenames. Note that changing this option __won't__ automatically (re-)generate icon filenames, you must manually (re-)generate them using the _[Reset Icons]_ button in the _Configuration -> Channel / EPG -> Channels_ tab."),
+"\n\n",
+LANGPREF N_("If your picon pack uses filenames that start with \"1_0_1_xxxx\" you'll want to use the _force service type to 1_ setting. If your filenames use the standard naming scheme, e.g \"1_0_19_xxxx\" leave it as _Standard_ ."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_cron_property[] = {
+LANGPREF N_(": Example : every day at 2am is : `0 2 * * *`"),
+" \n\n`┌───────────── min (0 - 59)` \n\n`│ ┌────────────── hour (0 - 23)` \n\n`│ │ ┌─────────────── day of month (1 - 31)` \n\n`│ │ │ ┌──────────────── month (1 - 12)` \n\n`│ │ │ │ ┌───────────────── day of week (0 - 6) (0 to 6 are Sunday to Saturday, or use names; 7 is Sunday, the same as 0)` \n\n`│ │ │ │ │` \n\n`│ │ │ │ │` \n\n`* * * * *` \n\n",
+LANGPREF N_("You cannot use non-standard predefined scheduling definitions for this field."),
+"\n\n",
+LANGPREF N_("See"),
+" [",
+LANGPREF N_("Wikipedia for a detailed look into Cron."),
+"](https://en.wikipedia.org/wiki/Cron)\n",
+
+NULL
+};
+
+const char *tvh_doc_dvr_start_extra_property[] = {
+LANGPREF N_(":"),
+"\n\n",
+LANGPREF N_("For example, if a program is to start at 13:00 and you set a padding of 5 minutes, it will start recording at 12:54:30 (including a warm-up time of 30 seconds (user configurable)). If this isn't specified, any pre-recording padding as set in the channel or DVR profile will be used."),
+" \n\n",
+LANGPREF N_("Be sure to check you have enough free tuners available to record all scheduled recordings if they overlap."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_dvr_status_property[] = {
+LANGPREF N_(":"),
+"\n\n",
+LANGPREF N_("Status"),
+" | ",
+LANGPREF N_("Description"),
+" \n----- | -----\n",
+LANGPREF N_("Aborted by user"),
+" | ",
+LANGPREF N_("The recording was interrupted by the user."),
+" \n",
+LANGPREF N_("File missing"),
+" | ",
+LANGPREF N_("The associated file(s) cannot be found on disk."),
+"\n",
+LANGPREF N_("Time missed"),
+" | ",
+LANGPREF N_("See below."),
+"\n\n",
+LANGPREF N_("Time missed can be caused by one (or more) of the following:"),
+"\n\n* ",
+LANGPREF N_("No free tuners - usually in-use by other subscription(s)."),
+"\n* ",
+LANGPREF N_("No tuners are enabled and/or have no network assigned."),
+"\n* ",
+LANGPREF N_("All available tuners failed to tune (this can indicate a signal, driver or hardware problem)."),
+"\n* ",
+LANGPREF N_("The underlying service for the channel is no longer available."),
+"\n* ",
+LANGPREF N_("Tvheadend wasn't running or crashed when a scheduled event/entry was to start."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_dvr_stop_extra_property[] = {
+LANGPREF N_(":"),
+"\n\n",
+LANGPREF N_("This is extremely useful for those programs you think/know will overrun. Any value selected here will keep a tuner busy for longer, so be sure to check you have enough free tuners to record all scheduled recordings if they overlap."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_dvr_timerec_title_format_property[] = {
+LANGPREF N_(":"),
+"\n\n",
+LANGPREF N_("String"),
+" | ",
+LANGPREF N_("Format Result"),
+"\n----- | -----\n",
+LANGPREF N_("%F"),
+" | ",
+LANGPREF N_("The date in ISO-format (e.g. 2015-02-28)."),
+"\n",
+LANGPREF N_("%R"),
+" | ",
+LANGPREF N_("The time in 24h HH:MM format (e.g. 19:45)."),
+"\n",
+LANGPREF N_("%x"),
+" | ",
+LANGPREF N_("The date, formatted according to your locale settings."),
+"\n\n",
+LANGPREF N_("The escape-codes use"),
+" [",
+LANGPREF N_("strftime"),
+"](http://man7.org/linux/man-pages/man3/strftime.3.html) ",
+LANGPREF N_("format."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_pathname_property[] = {
+LANGPREF N_(": The string allow to manually specify the full path generation using the predefined modifiers for strftime (see `man strftime`, except `%n` and `%t`) and Tvheadend specific. Note that you may modify some of this format string setting using the GUI fields below."),
+"\n\n",
+LANGPREF N_("Format"),
+" | ",
+LANGPREF N_("Description"),
+" | ",
+LANGPREF N_("Example"),
+"\n----- | ----- | -----\n`$t$n.$x` | ",
+LANGPREF N_("Default format (title, unique number, extension)"),
+" | ",
+LANGPREF N_("Tennis - Wimbledon-1.mkv"),
+"\n`$s` | ",
+LANGPREF N_("Event subtitle name"),
+" | ",
+LANGPREF N_("Sport"),
+"\n`$t` | ",
+LANGPREF N_("Event title name"),
+" | ",
+LANGPREF N_("Tennis - Wimbledon"),
+"\n`$e` | ",
+LANGPREF N_("Event episode name"),
+" | ",
+LANGPREF N_("S02-E06"),
+"\n`$c` | ",
+LANGPREF N_("Channel name"),
+" | ",
+LANGPREF N_("SkySport"),
+"\n`$g` | ",
+LANGPREF N_("Content type"),
+" | ",
+LANGPREF N_("Movie : Science fiction"),
+"\n`$n` | ",
+LANGPREF N_("Unique number added when the file already exists"),
+" | ",
+LANGPREF N_("-1"),
+"\n`$x` | ",
+LANGPREF N_("Filename extension (from the active stream muxer"),
+" | ",
+LANGPREF N_("mkv"),
+"\n`%F` | ",
+LANGPREF N_("ISO 8601 date format"),
+" | ",
+LANGPREF N_("2011-03-19"),
+"\n`%R` | ",
+LANGPREF N_("The time in 24-hour notation"),
+" | ",
+LANGPREF N_("14:12"),
+"\n\n",
+LANGPREF N_("The format strings `$t`,`$s`,`%e`,`$c` also have delimiter variants such as `$ t` (space after the dollar character), `$-t`, `$_t`, `$.t`, `$,t`, `$;t`. In these cases, the delimiter is applied only when the substituted string is not empty."),
+"\n\n",
+LANGPREF N_("For $t and $s format strings, you may also limit the number of output characters using $99-t format string where 99 means the limit. As you can see, the delimiter can be also applied."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_postprocessor_property[] = {
+LANGPREF N_(": Command to run after finishing a recording. The command will be run in background and is executed even if a recording is aborted or an error occurred. Use the %e error formatting string to check for errors, the error string is “OK” if recording finished successfully."),
+"\n\n ",
+LANGPREF N_("Supported format strings:"),
+"\n\n",
+LANGPREF N_("Format"),
+" | ",
+LANGPREF N_("Description"),
+" | ",
+LANGPREF N_("Example value"),
+"\n----- | ----- | -----\n`%f` | ",
+LANGPREF N_("Full path to recording"),
+" | ",
+LANGPREF N_("/home/user/Videos/News.mkv"),
+"\n`%b` | ",
+LANGPREF N_("Basename of recording"),
+" | ",
+LANGPREF N_("News.mkv"),
+"\n`%c` | ",
+LANGPREF N_("Channel name"),
+" | ",
+LANGPREF N_("BBC world"),
+"\n`%O` | ",
+LANGPREF N_("Owner of this recording"),
+" | ",
+LANGPREF N_("user"),
+"\n`%C` | ",
+LANGPREF N_("Who created this recording"),
+" | ",
+LANGPREF N_("user"),
+"\n`%t` | ",
+LANGPREF N_("Program title"),
+" | ",
+LANGPREF N_("News"),
+"\n`%s` | ",
+LANGPREF N_("Program subtitle"),
+" | ",
+LANGPREF N_("Afternoon"),
+"\n`%p` | ",
+LANGPREF N_("Program episode"),
+" | ",
+LANGPREF N_("S02.E07"),
+"\n`%d` | ",
+LANGPREF N_("Program description"),
+" | ",
+LANGPREF N_("News and stories…"),
+"\n`%e` | ",
+LANGPREF N_("Error message"),
+" | ",
+LANGPREF N_("Aborted by user"),
+"\n`%S` | ",
+LANGPREF N_("Start time stamp of recording, UNIX epoch"),
+" | ",
+LANGPREF N_("1224421200"),
+"\n`%E` | ",
+LANGPREF N_("Stop time stamp of recording, UNIX epoch"),
+" | ",
+LANGPREF N_("1224426600"),
+"\n`%r` | ",
+LANGPREF N_("Number of errors during recording"),
+" | ",
+LANGPREF N_("0"),
+"\n`%R` | ",
+LANGPREF N_("Number of data errors during recording"),
+" | ",
+LANGPREF N_("6"),
+"\n`%i` | ",
+LANGPREF N_("Streams (comma separated)"),
+" | ",
+LANGPREF N_("H264,AC3,TELETEXT"),
+"\n\n",
+LANGPREF N_("_Example usage_"),
+" \n\n",
+LANGPREF N_("To use special characters (e.g. spaces), either put the string in quotes or escape the individual characters."),
+"\n\n`/path/to/ffmpeg -i \"%f\" -vcodec libx264 -acodec copy \"/path/with white space/%b\"`\n",
+
+NULL
+};
+
+const char *tvh_doc_postremove_property[] = {
+LANGPREF N_(": Command to run after finishing a recording. The command will be run in background and is executed even if a recording is aborted or an error occurred. Use the %e error formatting string to check for errors, the error string is “OK” if recording finished successfully."),
+"\n\n ",
+LANGPREF N_("Supported format strings:"),
+"\n\n",
+LANGPREF N_("Format"),
+" | ",
+LANGPREF N_("Description"),
+" | ",
+LANGPREF N_("Example value"),
+"\n----- | ----- | -----\n`%f` | ",
+LANGPREF N_("Full path to recording"),
+" | ",
+LANGPREF N_("/home/user/Videos/News.mkv"),
+"\n`%b` | ",
+LANGPREF N_("Basename of recording"),
+" | ",
+LANGPREF N_("News.mkv"),
+"\n`%c` | ",
+LANGPREF N_("Channel name"),
+" | ",
+LANGPREF N_("BBC world"),
+"\n`%O` | ",
+LANGPREF N_("Owner of this recording"),
+" | ",
+LANGPREF N_("user"),
+"\n`%C` | ",
+LANGPREF N_("Who created this recording"),
+" | ",
+LANGPREF N_("user"),
+"\n`%t` | ",
+LANGPREF N_("Program title"),
+" | ",
+LANGPREF N_("News"),
+"\n`%s` | ",
+LANGPREF N_("Program subtitle"),
+" | ",
+LANGPREF N_("Afternoon"),
+"\n`%p` | ",
+LANGPREF N_("Program episode"),
+" | ",
+LANGPREF N_("S02.E07"),
+"\n`%d` | ",
+LANGPREF N_("Program description"),
+" | ",
+LANGPREF N_("News and stories…"),
+"\n`%e` | ",
+LANGPREF N_("Error message"),
+" | ",
+LANGPREF N_("Aborted by user"),
+"\n`%S` | ",
+LANGPREF N_("Start time stamp of recording, UNIX epoch"),
+" | ",
+LANGPREF N_("1224421200"),
+"\n`%E` | ",
+LANGPREF N_("Stop time stamp of recording, UNIX epoch"),
+" | ",
+LANGPREF N_("1224426600"),
+"\n`%r` | ",
+LANGPREF N_("Number of errors during recording"),
+" | ",
+LANGPREF N_("0"),
+"\n`%R` | ",
+LANGPREF N_("Number of data errors during recording"),
+" | ",
+LANGPREF N_("6"),
+"\n`%i` | ",
+LANGPREF N_("Streams (comma separated)"),
+" | ",
+LANGPREF N_("H264,AC3,TELETEXT"),
+"\n\n",
+LANGPREF N_("_Example usage_"),
+" \n\n",
+LANGPREF N_("To use special characters (e.g. spaces), either put the string in quotes or escape the individual characters."),
+"\n\n`/usr/bin/tvh_file_removed \"%f\"`\n",
+
+NULL
+};
+
+const char *tvh_doc_predefinedmuxlist_property[] = {
+LANGPREF N_(":"),
+"\n\n",
+LANGPREF N_("Generally an out of date mux list isn't an issue provided that you have _Network Discovery_ enabled and a mux (in the list) with"),
+" [",
+LANGPREF N_("NIT"),
+"](https://en.wikipedia.org/wiki/Program-specific_information#NIT_.28network_information_specific_data.29)  ",
+LANGPREF N_("data scans successfully, Tvheadend will parse the NIT and then add/scan newly discovered muxes automatically."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_preprocessor_property[] = {
+LANGPREF N_(": Command to run when a recording starts. The command will be run in background."),
+"\n\n ",
+LANGPREF N_("Supported format strings:"),
+"\n\n",
+LANGPREF N_("Format"),
+" | ",
+LANGPREF N_("Description"),
+" | ",
+LANGPREF N_("Example value"),
+"\n----- | ----- | -----\n`%f` | ",
+LANGPREF N_("Full path to recording"),
+" | ",
+LANGPREF N_("/home/user/Videos/News.mkv"),
+"\n`%b` | ",
+LANGPREF N_("Basename of recording"),
+" | ",
+LANGPREF N_("News.mkv"),
+"\n`%c` | ",
+LANGPREF N_("Channel name"),
+" | ",
+LANGPREF N_("BBC world"),
+"\n`%O` | ",
+LANGPREF N_("Owner of this recording"),
+" | ",
+LANGPREF N_("user"),
+"\n`%C` | ",
+LANGPREF N_("Who created this recording"),
+" | ",
+LANGPREF N_("user"),
+"\n`%t` | ",
+LANGPREF N_("Program title"),
+" | ",
+LANGPREF N_("News"),
+"\n`%s` | ",
+LANGPREF N_("Program subtitle"),
+" | ",
+LANGPREF N_("Afternoon"),
+"\n`%p` | ",
+LANGPREF N_("Program episode"),
+" | ",
+LANGPREF N_("S02.E07"),
+"\n`%d` | ",
+LANGPREF N_("Program description"),
+" | ",
+LANGPREF N_("News and stories…"),
+"\n`%S` | ",
+LANGPREF N_("Start time stamp of recording, UNIX epoch"),
+" | ",
+LANGPREF N_("1224421200"),
+"\n`%E` | ",
+LANGPREF N_("Stop time stamp of recording, UNIX epoch"),
+" | ",
+LANGPREF N_("1224426600"),
+"\n\n",
+LANGPREF N_("_Example usage_"),
+" \n\n",
+LANGPREF N_("To use special characters (e.g. spaces), either put the string in quotes or escape the individual characters."),
+"\n\n`/usr/bin/lcd_show \"%f\"`\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_channels[] = {
+LANGPREF N_("You are now finished."),
+"\n\n",
+LANGPREF N_("You may further customize your settings by editing channel numbers, etc."),
+"\n\n",
+LANGPREF N_("If you confirm this dialog, the default administrator account will be removed. Please then the use credentials you defined thru this wizard."),
+"\n\n",
+LANGPREF N_("If you require further help, check out"),
+" [",
+LANGPREF N_("Tvheadend.org"),
+"](http://tvheadend.org) ",
+LANGPREF N_("or chat to us on"),
+" [",
+LANGPREF N_("IRC"),
+"](https://kiwiirc.com/client/chat.freenode.net/?nick=tvhhelp|?#hts)",
+LANGPREF N_("."),
+"\n\n",
+LANGPREF N_("Thank you for using Tvheadend (and don't forget to"),
+" [",
+LANGPREF N_("donate"),
+"](http://tvheadend.org/projects/tvheadend/wiki/Donate)",
+LANGPREF N_(")! :)"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_channels2[] = {
+LANGPREF N_("You are now finished."),
+"\n\n",
+LANGPREF N_("You may further customize your settings by editing channel numbers, etc."),
+"\n\n",
+LANGPREF N_("If you require further help, check out"),
+" [",
+LANGPREF N_("Tvheadend.org"),
+"](http://tvheadend.org) ",
+LANGPREF N_("or chat to us on"),
+" [",
+LANGPREF N_("IRC"),
+"](https://kiwiirc.com/client/chat.freenode.net/?nick=tvhhelp|?#hts)",
+LANGPREF N_("."),
+"\n\n",
+LANGPREF N_("Thank you for using Tvheadend (and don't forget to"),
+" [",
+LANGPREF N_("donate"),
+"](http://tvheadend.org/projects/tvheadend/wiki/Donate)",
+LANGPREF N_(")! :)"),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_hello[] = {
+LANGPREF N_("Welcome to Tvheadend, your TV streaming server and video recorder. This wizard will help you get up and running fast. Let's start by configuring the basic language settings. Please select the default user interface and EPG language(s)."),
+"\n\n",
+LANGPREF N_("__This wizard should only be run on initial setup. Please cancel it if you're not willing to touch the current configuration, as continuing in such cases can lead to misconfiguration and not all changes made thru this wizard will take effect.__"),
+" \n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("If you cannot see your preferred language in the language list and would like to help translate Tvheadend see"),
+"  [",
+LANGPREF N_("here"),
+"](https://tvheadend.org/projects/tvheadend/wiki/Internationalization)",
+LANGPREF N_("."),
+" \n* ",
+LANGPREF N_("If you don't enter a preferred language, US English will be used as a default."),
+" \n* ",
+LANGPREF N_("Not selecting the correct EPG language can result in garbled EPG text; if this happens, don't panic, as you can easily change it later."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_login[] = {
+LANGPREF N_("Enter the access control details to secure your system. The first part of this covers the network details for address-based access to the system; for example, 192.168.1.0/24 to allow local access only to 192.168.1.x clients, or 0.0.0.0/0 or empty value for access from any system."),
+"\n\n",
+LANGPREF N_("This works alongside the second part, which is a familiar username/password combination, so provide these for both an administrator and regular (day-to-day) user."),
+"\n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("You may enter a comma-separated list of network prefixes (IPv4/IPv6). If you were asked to enter a username and password during installation, we'd recommend not using the same details for a user here as it may cause unexpected behavior, incorrect permissions etc."),
+"\n* ",
+LANGPREF N_("To allow anonymous access for any account (administrative or regular user) enter an asterisk (*) in the username and password fields. ___It is not_ __ recommended that you allow anonymous access to the admin account."),
+"\n* ",
+LANGPREF N_("If you plan on accessing Tvheadend over the Internet, make sure you use strong credentials and ___do not allow anonymous access at all_ __ ."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_mapping[] = {
+LANGPREF N_("Map all discovered services to channels."),
+"\n\n",
+LANGPREF N_("In order for your frontend client(s) (such as Kodi, Movian, and similar) to see/play channels, you must first map discovered services to channels."),
+"\n\n",
+LANGPREF N_("If you would like Tvheadend to do this for you, check the 'Map all services' option below, but be aware that this will also map encrypted services you may not have access to."),
+"\n\n",
+LANGPREF N_("__You may omit this step (do not check 'Map all services') and map services to channels manually.__"),
+" \n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("Many providers include undesirable services - Teleshopping, Adult Entertainment, etc; using the 'Map all services' will include these."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_muxes[] = {
+LANGPREF N_("Assign predefined muxes to networks. To save you from manually entering muxes, Tvheadend includes predefined mux lists. Please select a list for each network below."),
+"\n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("Select the closest transmitter if using an antenna (T); if using cable (C), select your provider; if using satellite (S), the orbital position of the satellite your dish is pointing towards; or if using IPTV, enter the URL to your playlist."),
+"\n* ",
+LANGPREF N_("If you're unsure as to which list(s) to select you may want to look online for details about the various television reception choices available in your area."),
+"\n* ",
+LANGPREF N_("Networks already configured will not be shown below."),
+"\n* ",
+LANGPREF N_("Selecting the wrong list may cause the scan (on the next page) to fail."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_network[] = {
+LANGPREF N_("Now let's get your tuners configured. Go ahead and select a network for each of the tuners you would like to use. if you do not assign a network to a tuner it will __not__ be used."),
+"\n\n",
+LANGPREF N_("__Selecting the Right Network__ :"),
+"\n\n",
+LANGPREF N_("Many tuners are able to receive different signal types.."),
+"\n\n",
+LANGPREF N_("__If you receive your channels through an antenna (also known as an aerial)__ then you would select the network under the tuners with DVB-T/ATSC-T/ISDB-T in the name."),
+"\n\n",
+LANGPREF N_("__If you receive your channels through a satellite dish__ then you would select the network under the tuners with DVB-S/S2 in the name."),
+"\n\n",
+LANGPREF N_("__If you receive your channels via cable__ then you would select the network under the tuners with DVB-C/ATSC-C/ISDB-C in the name."),
+"\n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("Tuners already in use will not appear below."),
+"\n* ",
+LANGPREF N_("If using IPTV, the playlist you enter must contain valid links to streams using codecs supported by Tvheadend."),
+"\n* ",
+LANGPREF N_("For devices with multiple tuners (e.g. either cable or terrestrial), be aware that many only allow you to use one tuner at a time. Selecting more than one tuner per device can thus result in unexpected behavior."),
+"\n",
+
+NULL
+};
+
+const char *tvh_doc_wizard_status[] = {
+LANGPREF N_("Tvheadend is now scanning for available services. Please wait until the scan completes.."),
+"\n\n",
+LANGPREF N_("__Notes__ :"),
+"\n\n* ",
+LANGPREF N_("During scanning, the number of muxes and services shown below should increase. If this doesn't happen, check the connection(s) to your device(s).."),
+"\n* ",
+LANGPREF N_("The status tab (behind this wizard) will display signal information. If you notice a lot of errors or the signal strength appears low then this usually indicates a physical issue with your antenna, satellite dish or cable.."),
+"\n* ",
+LANGPREF N_("If you don't see any signal information at all, but the number of muxes or services is increasing anyway, the driver used by your device isn't supplying signal information to Tvheadend. In most cases this isn't an issue.."),
+"\n",
+
+NULL
+};
+
+
+
+const struct tvh_doc_page tvh_doc_markdown_pages[] = {
+  { "before_begin", tvh_doc_root_before_begin },
+  { "cmdline_options", tvh_doc_root_cmdline_options },
+  { "configure_tvheadend", tvh_doc_root_configure_tvheadend },
+  { "debugging", tvh_doc_root_debugging },
+  { "doc_update", tvh_doc_root_doc_update },
+  { "epg", tvh_doc_root_epg },
+  { "faqs", tvh_doc_root_faqs },
+  { "features", tvh_doc_root_features },
+  { "index", tvh_doc_root_index },
+  { "install_hardware", tvh_doc_root_install_hardware },
+  { "install_tvheadend", tvh_doc_root_install_tvheadend },
+  { "markdown_cribsheet", tvh_doc_root_markdown_cribsheet },
+  { "overview", tvh_doc_root_overview },
+  { "requirements", tvh_doc_root_requirements },
+  { "status_connections", tvh_doc_root_status_connections },
+  { "status_service_mapper", tvh_doc_root_status_service_mapper },
+  { "status_stream", tvh_doc_root_status_stream },
+  { "status_subscriptions", tvh_doc_root_status_subscriptions },
+  { "toc", tvh_doc_root_toc },
+  { "todo", tvh_doc_root_todo },
+  { "tv_adapters", tvh_doc_root_tv_adapters },
+  { "url", tvh_doc_root_url },
+  { "webui_general", tvh_doc_root_webui_general },
+  { "inc/add_grid_entry", tvh_doc_root_inc_add_grid_entry },
+  { "inc/common_button_table_end", tvh_doc_root_inc_common_button_table_end },
+  { "inc/common_button_table_start", tvh_doc_root_inc_common_button_table_start },
+  { "inc/del_grid_entries", tvh_doc_root_inc_del_grid_entries },
+  { "inc/edit_grid_entries", tvh_doc_root_inc_edit_grid_entries },
+  { "inc/paging_tip", tvh_doc_root_inc_paging_tip },
+  { "inc/selecting_entries_tip", tvh_doc_root_inc_selecting_entries_tip },
+  { NULL, NULL },
+};
@@ -52,6 +52,7 @@ typedef struct dvr_config {
   profile_t *dvr_profile;
   char *dvr_storage;
   int dvr_clone;
+  int dvr_share;
   uint32_t dvr_rerecord_errors;
   uint32_t dvr_retention_days;
   uint32_t dvr_removal_days;
@@ -237,6 +238,13 @@ typedef struct dvr_entry {
    * Last error, see SM_CODE_ defines
    */
   uint32_t de_last_error;
+
+  /**
+   * File writer statistics (only to be modified by the recording thread)
+   */
+  uint32_t de_write_latency;
+  uint32_t de_write_latency_max;
+  uint32_t de_write_queue;
   
 
   /**
@@ -324,7 +332,15 @@ typedef struct dvr_autorec_entry {
 
   char *dae_title;
   regex_t dae_title_preg;
+  char *dae_title_literal;  /* lowercase text required by dae_title */
   int dae_fulltext;
+
+  /* Compiled rule set (see dvr_autorec_check_event) */
+  LIST_ENTRY(dvr_autorec_entry) dae_match_link;
+  int dae_match_type;
+  uint32_t dae_match_key;
+  uint32_t dae_match_seq;
+  uint32_t dae_match_gen;
   
   uint32_t dae_content_type;
 
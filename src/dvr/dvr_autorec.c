@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define _GNU_SOURCE /* for strcasestr() */
 #include <pthread.h>
 #include <ctype.h>
 #include <assert.h>
@@ -36,6 +37,42 @@
 
 struct dvr_autorec_entry_queue autorec_entries;
 
+/*
+ * Compiled rule set - each rule is in exactly one bucket:
+ *
+ * - rules with a literal text required by the title regex are indexed
+ *   using one trigram of this text (title or fulltext index)
+ * - rules bound to a channel are evaluated from ch->ch_autorecs
+ * - rules bound to a channel tag are evaluated from ct->ct_autorecs
+ * - all other rules are evaluated for each event
+ */
+enum {
+  DAE_MATCH_NONE = 0,
+  DAE_MATCH_TITLE,
+  DAE_MATCH_FULLTEXT,
+  DAE_MATCH_CHANNEL,
+  DAE_MATCH_TAG,
+  DAE_MATCH_ANY
+};
+
+#define DAE_TRIGRAM_BITS 12
+#define DAE_TRIGRAM_SIZE (1 << DAE_TRIGRAM_BITS)
+
+typedef struct dvr_autorec_trigram_index {
+  struct dvr_autorec_entry_list dti_hash[DAE_TRIGRAM_SIZE];
+  uint32_t dti_count[DAE_TRIGRAM_SIZE];
+  uint32_t dti_total;
+} dvr_autorec_trigram_index_t;
+
+static dvr_autorec_trigram_index_t dvr_autorec_title_index;
+static dvr_autorec_trigram_index_t dvr_autorec_fulltext_index;
+static struct dvr_autorec_entry_list dvr_autorec_any;
+static int dvr_autorec_match_dirty = 1;
+static uint32_t dvr_autorec_match_gen;
+static dvr_autorec_entry_t **dvr_autorec_candidates;
+static uint32_t dvr_autorec_candidates_size;
+static uint32_t dvr_autorec_candidates_count;
+
 /*
  *
  */
@@ -130,6 +167,149 @@ dvr_autorec_completed(dvr_autorec_entry_t *dae, int error_code)
   }
 }
 
+/**
+ * Extract the longest literal text which must be present in any string
+ * matched by the (extended, case insensitive) regex. Only plain ASCII
+ * is used, so the case folding is not locale dependent.
+ */
+static char *
+autorec_regex_literal(const char *re)
+{
+  char run[128], best[128];
+  size_t rlen = 0, blen = 0;
+  int depth = 0, c;
+
+#define RUN_END() do { \
+  if (rlen > blen) { memcpy(best, run, rlen); blen = rlen; } \
+  rlen = 0; \
+} while (0)
+
+  while ((c = (unsigned char)*re++) != '\0') {
+    switch (c) {
+    case '|':
+      if (depth == 0)
+        return NULL; /* top level alternation */
+      break;
+    case '(':
+      RUN_END();
+      depth++;
+      break;
+    case ')':
+      if (depth > 0) depth--;
+      break;
+    case '[':
+      RUN_END();
+      if (*re == '^') re++;
+      if (*re == ']') re++;
+      while (*re && *re != ']') {
+        if (*re == '[' && (re[1] == ':' || re[1] == '.' || re[1] == '=')) {
+          const char *p = strchr(re + 2, re[1]);
+          re = p && p[1] == ']' ? p + 2 : re + 1;
+        } else {
+          re++;
+        }
+      }
+      if (*re) re++;
+      break;
+    case '*':
+    case '?':
+    case '{':
+      /* previous character is optional */
+      if (depth == 0 && rlen > 0) rlen--;
+      RUN_END();
+      if (c == '{')
+        while (*re && *re != '}') re++;
+      if (*re == '}') re++;
+      break;
+    case '+':
+      RUN_END();
+      break;
+    case '\\':
+      c = (unsigned char)*re;
+      if (c == '\0')
+        break;
+      re++;
+      /* GNU anchors, word boundaries and classes */
+      if (strchr("<>`'bBwWsS", c)) {
+        RUN_END();
+        break;
+      }
+      if (depth == 0 && c < 0x80 && ispunct(c) && rlen < sizeof(run)) {
+        run[rlen++] = c;
+      } else {
+        RUN_END();
+      }
+      break;
+    default:
+      if (depth > 0)
+        break;
+      if (c < 0x80 && c >= ' ' && c != '.' && c != '^' && c != '$' &&
+          rlen < sizeof(run)) {
+        run[rlen++] = tolower(c);
+      } else {
+        RUN_END();
+      }
+      break;
+    }
+  }
+  RUN_END();
+#undef RUN_END
+
+  if (blen < 3)
+    return NULL;
+  best[blen] = '\0';
+  return strdup(best);
+}
+
+#if AUTOREC_TESTSUITE
+static void
+autorec_regex_literal_testsuite_run(void)
+{
+  static const struct {
+    const char *re;
+    const char *literal;
+  } tests[] = {
+    { "news",                 "news" },
+    { "\\<news\\>",           "news" },
+    { "\\`news\\'",           "news" },
+    { "\\bnews\\b",           "news" },
+    { "the\\Bnews",           "news" },
+    { "\\wnews\\W",           "news" },
+    { "\\Snews\\s",           "news" },
+    { "star\\s+trek",         "star" },
+    { "doctor who\\?",        "doctor who?" },
+    { "^The (Simpsons|Wire)", "the " },
+    { "news|sport",           NULL },
+    { "caf\xc3\xa9 ol\xc3\xa9",   "caf" },
+    { "\\\xc3\xa9news",         "news" },
+  };
+  char *l;
+  unsigned int i, fails = 0;
+
+  for (i = 0; i < ARRAY_SIZE(tests); i++) {
+    l = autorec_regex_literal(tests[i].re);
+    if (strcmp(l ?: "", tests[i].literal ?: "")) {
+      fprintf(stderr, "AUTORECTS: '%s' literal '%s' expected '%s'\n",
+              tests[i].re, l ?: "", tests[i].literal ?: "");
+      fails++;
+    }
+    free(l);
+  }
+  fprintf(stderr, "AUTORECTS: %u tests, %u failures\n", i, fails);
+}
+#endif
+
+/**
+ * Run the title regex, the literal test is much cheaper
+ */
+static inline int
+autorec_regexec(dvr_autorec_entry_t *dae, const char *str)
+{
+  if (dae->dae_title_literal && strcasestr(str, dae->dae_title_literal) == NULL)
+    return 0;
+  return !regexec(&dae->dae_title_preg, str, 0, NULL, 0);
+}
+
 /**
  * return 1 if the event 'e' is matched by the autorec rule 'dae'
  */
@@ -177,22 +357,22 @@ autorec_cmp(dvr_autorec_entry_t *dae, epg_broadcast_t *e)
     lang_str_ele_t *ls;
     if (!dae->dae_fulltext) {
       if(!e->episode->title) return 0;
-      RB_FOREACH(ls, e->episode->title, link)
-        if (!regexec(&dae->dae_title_preg, ls->str, 0, NULL, 0)) break;
+      LANG_STR_FOREACH(ls, e->episode->title)
+        if (autorec_regexec(dae, ls->str)) break;
     } else {
       ls = NULL;
       if (e->episode->title)
-        RB_FOREACH(ls, e->episode->title, link)
-          if (!regexec(&dae->dae_title_preg, ls->str, 0, NULL, 0)) break;
+        LANG_STR_FOREACH(ls, e->episode->title)
+          if (autorec_regexec(dae, ls->str)) break;
       if (!ls && e->episode->subtitle)
-        RB_FOREACH(ls, e->episode->subtitle, link)
-          if (!regexec(&dae->dae_title_preg, ls->str, 0, NULL, 0)) break;
+        LANG_STR_FOREACH(ls, e->episode->subtitle)
+          if (autorec_regexec(dae, ls->str)) break;
       if (!ls && e->summary)
-        RB_FOREACH(ls, e->summary, link)
-          if (!regexec(&dae->dae_title_preg, ls->str, 0, NULL, 0)) break;
+        LANG_STR_FOREACH(ls, e->summary)
+          if (autorec_regexec(dae, ls->str)) break;
       if (!ls && e->description)
-        RB_FOREACH(ls, e->description, link)
-          if (!regexec(&dae->dae_title_preg, ls->str, 0, NULL, 0)) break;
+        LANG_STR_FOREACH(ls, e->description)
+          if (autorec_regexec(dae, ls->str)) break;
     }
     if (!ls) return 0;
   }
@@ -296,6 +476,8 @@ dvr_autorec_create(const char *uuid, htsmsg_t *conf)
 
   idnode_load(&dae->dae_id, conf);
 
+  dvr_autorec_match_dirty = 1;
+
   htsp_autorec_entry_add(dae);
 
   return dae;
@@ -323,6 +505,7 @@ void
 dvr_autorec_update_htsp(dvr_autorec_entry_t *dae, htsmsg_t *conf)
 {
   idnode_update(&dae->dae_id, conf);
+  dvr_autorec_match_dirty = 1;
   idnode_changed(&dae->dae_id);
   tvhlog(LOG_INFO, "autorec", "\"%s\" on \"%s\": Updated", dae->dae_title ? dae->dae_title : "",
       (dae->dae_channel && dae->dae_channel->ch_name) ? dae->dae_channel->ch_name : "any channel");
@@ -383,6 +566,10 @@ autorec_entry_destroy(dvr_autorec_entry_t *dae, int delconf)
   TAILQ_REMOVE(&autorec_entries, dae, dae_link);
   idnode_unlink(&dae->dae_id);
 
+  if (dae->dae_match_type != DAE_MATCH_NONE)
+    LIST_REMOVE(dae, dae_match_link);
+  dvr_autorec_match_dirty = 1;
+
   if(dae->dae_config)
     LIST_REMOVE(dae, dae_config_link);
 
@@ -396,6 +583,7 @@ autorec_entry_destroy(dvr_autorec_entry_t *dae, int delconf)
     free(dae->dae_title);
     regfree(&dae->dae_title_preg);
   }
+  free(dae->dae_title_literal);
 
   if(dae->dae_channel != NULL)
     LIST_REMOVE(dae, dae_channel_link);
@@ -422,6 +610,7 @@ dvr_autorec_entry_class_changed(idnode_t *self)
 {
   dvr_autorec_entry_t *dae = (dvr_autorec_entry_t *)self;
 
+  dvr_autorec_match_dirty = 1;
   dvr_autorec_changed(dae, 1);
   dvr_autorec_completed(dae, 0);
   htsp_autorec_entry_update(dae);
@@ -480,6 +669,7 @@ dvr_autorec_entry_class_channel_set(void *o, const void *v)
     if (dae->dae_channel) {
       LIST_REMOVE(dae, dae_channel_link);
       dae->dae_channel = NULL;
+      dvr_autorec_match_dirty = 1;
       return 1;
     }
   } else if (dae->dae_channel != ch) {
@@ -490,6 +680,7 @@ dvr_autorec_entry_class_channel_set(void *o, const void *v)
       LIST_REMOVE(dae, dae_channel_link);
     dae->dae_channel = ch;
     LIST_INSERT_HEAD(&ch->ch_autorecs, dae, dae_channel_link);
+    dvr_autorec_match_dirty = 1;
     return 1;
   }
   return 0;
@@ -526,10 +717,15 @@ dvr_autorec_entry_class_title_set(void *o, const void *v)
        free(dae->dae_title);
        dae->dae_title = NULL;
     }
+    free(dae->dae_title_literal);
+    dae->dae_title_literal = NULL;
     if (title[0] != '\0' &&
         !regcomp(&dae->dae_title_preg, title,
-                 REG_ICASE | REG_EXTENDED | REG_NOSUB))
+                 REG_ICASE | REG_EXTENDED | REG_NOSUB)) {
       dae->dae_title = strdup(title);
+      dae->dae_title_literal = autorec_regex_literal(title);
+    }
+    dvr_autorec_match_dirty = 1;
     return 1;
   }
   return 0;
@@ -544,12 +740,14 @@ dvr_autorec_entry_class_tag_set(void *o, const void *v)
   if (tag == NULL && dae->dae_channel_tag) {
     LIST_REMOVE(dae, dae_channel_tag_link);
     dae->dae_channel_tag = NULL;
+    dvr_autorec_match_dirty = 1;
     return 1;
   } else if (dae->dae_channel_tag != tag) {
     if (dae->dae_channel_tag)
       LIST_REMOVE(dae, dae_channel_tag_link);
     dae->dae_channel_tag = tag;
     LIST_INSERT_HEAD(&tag->ct_autorecs, dae, dae_channel_tag_link);
+    dvr_autorec_match_dirty = 1;
     return 1;
   }
   return 0;
@@ -1296,6 +1494,9 @@ dvr_autorec_init(void)
   htsmsg_t *l, *c;
   htsmsg_field_t *f;
 
+#if AUTOREC_TESTSUITE
+  autorec_regex_literal_testsuite_run();
+#endif
   TAILQ_INIT(&autorec_entries);
   idclass_register(&dvr_autorec_entry_class);
   if((l = hts_settings_load("dvr/autorec")) != NULL) {
@@ -1316,6 +1517,9 @@ dvr_autorec_done(void)
   pthread_mutex_lock(&global_lock);
   while ((dae = TAILQ_FIRST(&autorec_entries)) != NULL)
     autorec_entry_destroy(dae, 0);
+  free(dvr_autorec_candidates);
+  dvr_autorec_candidates = NULL;
+  dvr_autorec_candidates_size = 0;
   pthread_mutex_unlock(&global_lock);
 }
 
@@ -1332,16 +1536,174 @@ dvr_autorec_update(void)
 /**
  *
  */
+static inline uint32_t
+dvr_autorec_trigram_hash(uint32_t key)
+{
+  return (key * 2654435761U) >> (32 - DAE_TRIGRAM_BITS);
+}
+
+static inline int
+dvr_autorec_trigram_char(int c)
+{
+  return c < 0x80 ? tolower(c) : c;
+}
+
+static void
+dvr_autorec_match_rebuild(void)
+{
+  dvr_autorec_trigram_index_t *idx;
+  dvr_autorec_entry_t *dae;
+  const uint8_t *p;
+  uint32_t key, h, best, seq = 0;
+
+  memset(&dvr_autorec_title_index, 0, sizeof(dvr_autorec_title_index));
+  memset(&dvr_autorec_fulltext_index, 0, sizeof(dvr_autorec_fulltext_index));
+  LIST_INIT(&dvr_autorec_any);
+
+  TAILQ_FOREACH(dae, &autorec_entries, dae_link) {
+    dae->dae_match_seq = seq++;
+    dae->dae_match_gen = 0;
+    if (dae->dae_title_literal) {
+      /* use the least populated trigram of the literal text */
+      idx = dae->dae_fulltext ? &dvr_autorec_fulltext_index :
+                                &dvr_autorec_title_index;
+      best = 0;
+      for (p = (const uint8_t *)dae->dae_title_literal; p[2]; p++) {
+        key = (p[0] << 16) | (p[1] << 8) | p[2];
+        if (p == (const uint8_t *)dae->dae_title_literal ||
+            idx->dti_count[dvr_autorec_trigram_hash(key)] <
+              idx->dti_count[dvr_autorec_trigram_hash(best)])
+          best = key;
+      }
+      h = dvr_autorec_trigram_hash(best);
+      dae->dae_match_key = best;
+      dae->dae_match_type = dae->dae_fulltext ? DAE_MATCH_FULLTEXT :
+                                                DAE_MATCH_TITLE;
+      LIST_INSERT_HEAD(&idx->dti_hash[h], dae, dae_match_link);
+      idx->dti_count[h]++;
+      idx->dti_total++;
+    } else if (dae->dae_channel) {
+      dae->dae_match_type = DAE_MATCH_CHANNEL;
+      LIST_INSERT_HEAD(&dvr_autorec_any, dae, dae_match_link);
+    } else if (dae->dae_channel_tag) {
+      dae->dae_match_type = DAE_MATCH_TAG;
+      LIST_INSERT_HEAD(&dvr_autorec_any, dae, dae_match_link);
+    } else {
+      dae->dae_match_type = DAE_MATCH_ANY;
+      LIST_INSERT_HEAD(&dvr_autorec_any, dae, dae_match_link);
+    }
+  }
+  dvr_autorec_match_dirty = 0;
+  tvhtrace("autorec", "compiled %u rules (title index %u, fulltext index %u)",
+           seq, dvr_autorec_title_index.dti_total,
+           dvr_autorec_fulltext_index.dti_total);
+}
+
+static void
+dvr_autorec_candidate(dvr_autorec_entry_t *dae)
+{
+  dvr_autorec_entry_t **n;
+
+  if (dae->dae_match_gen == dvr_autorec_match_gen)
+    return;
+  dae->dae_match_gen = dvr_autorec_match_gen;
+  if (dvr_autorec_candidates_count >= dvr_autorec_candidates_size) {
+    n = realloc(dvr_autorec_candidates,
+                (dvr_autorec_candidates_size + 64) * sizeof(*n));
+    if (n == NULL)
+      return;
+    dvr_autorec_candidates = n;
+    dvr_autorec_candidates_size += 64;
+  }
+  dvr_autorec_candidates[dvr_autorec_candidates_count++] = dae;
+}
+
+static void
+dvr_autorec_candidates_by_text
+  (dvr_autorec_trigram_index_t *idx, const lang_str_t *ls)
+{
+  lang_str_ele_t *lse;
+  dvr_autorec_entry_t *dae;
+  const uint8_t *p;
+  uint32_t key;
+
+  if (idx->dti_total == 0)
+    return;
+  LANG_STR_FOREACH(lse, ls) {
+    p = (const uint8_t *)lse->str;
+    if (p[0] == '\0' || p[1] == '\0')
+      continue;
+    key = (dvr_autorec_trigram_char(p[0]) << 8) | dvr_autorec_trigram_char(p[1]);
+    for (p += 2; *p; p++) {
+      key = ((key << 8) | dvr_autorec_trigram_char(*p)) & 0xffffff;
+      LIST_FOREACH(dae, &idx->dti_hash[dvr_autorec_trigram_hash(key)], dae_match_link)
+        if (dae->dae_match_key == key)
+          dvr_autorec_candidate(dae);
+    }
+  }
+}
+
+static int
+dvr_autorec_candidate_cmp(const void *a, const void *b)
+{
+  uint32_t s1 = (*(dvr_autorec_entry_t **)a)->dae_match_seq;
+  uint32_t s2 = (*(dvr_autorec_entry_t **)b)->dae_match_seq;
+  return s1 < s2 ? -1 : (s1 > s2 ? 1 : 0);
+}
+
 void
 dvr_autorec_check_event(epg_broadcast_t *e)
 {
   dvr_autorec_entry_t *dae;
+  idnode_list_mapping_t *ilm;
+  channel_tag_t *ct;
+  uint32_t i;
 
   if (e->channel && !e->channel->ch_enabled)
     return;
-  TAILQ_FOREACH(dae, &autorec_entries, dae_link)
+  if (e->channel == NULL || e->episode == NULL)
+    return;
+
+  if (dvr_autorec_match_dirty)
+    dvr_autorec_match_rebuild();
+  if (++dvr_autorec_match_gen == 0)
+    dvr_autorec_match_gen = 1;
+  dvr_autorec_candidates_count = 0;
+
+  /* Rules with the literal text - trigram lookup */
+  dvr_autorec_candidates_by_text(&dvr_autorec_title_index, e->episode->title);
+  if (dvr_autorec_fulltext_index.dti_total) {
+    dvr_autorec_candidates_by_text(&dvr_autorec_fulltext_index, e->episode->title);
+    dvr_autorec_candidates_by_text(&dvr_autorec_fulltext_index, e->episode->subtitle);
+    dvr_autorec_candidates_by_text(&dvr_autorec_fulltext_index, e->summary);
+    dvr_autorec_candidates_by_text(&dvr_autorec_fulltext_index, e->description);
+  }
+
+  /* Rules bound to this channel or to the channel tags */
+  LIST_FOREACH(dae, &e->channel->ch_autorecs, dae_channel_link)
+    if (dae->dae_match_type == DAE_MATCH_CHANNEL)
+      dvr_autorec_candidate(dae);
+  LIST_FOREACH(ilm, &e->channel->ch_ctms, ilm_in2_link) {
+    ct = (channel_tag_t *)ilm->ilm_in1;
+    LIST_FOREACH(dae, &ct->ct_autorecs, dae_channel_tag_link)
+      if (dae->dae_match_type == DAE_MATCH_TAG)
+        dvr_autorec_candidate(dae);
+  }
+
+  /* Everything else */
+  LIST_FOREACH(dae, &dvr_autorec_any, dae_match_link)
+    if (dae->dae_match_type == DAE_MATCH_ANY)
+      dvr_autorec_candidate(dae);
+
+  /* Keep the configuration order */
+  if (dvr_autorec_candidates_count > 1)
+    qsort(dvr_autorec_candidates, dvr_autorec_candidates_count,
+          sizeof(dvr_autorec_entry_t *), dvr_autorec_candidate_cmp);
+  for (i = 0; i < dvr_autorec_candidates_count; i++) {
+    dae = dvr_autorec_candidates[i];
     if(autorec_cmp(dae, e))
       dvr_entry_create_by_autorec(1, e, dae);
+  }
   // Note: no longer updating event here as it will be done from EPG
   //       anyway
 }
@@ -1379,6 +1741,8 @@ dvr_autorec_changed(dvr_autorec_entry_t *dae, int purge)
 
   CHANNEL_FOREACH(ch) {
     if (!ch->ch_enabled) continue;
+    /* only the bound channel can match */
+    if (dae->dae_channel && dae->dae_channel != ch) continue;
     RB_FOREACH(e, &ch->ch_epg_schedule, sched_link) {
       if(autorec_cmp(dae, e)) {
         enabled = 1;
@@ -1418,6 +1782,7 @@ autorec_destroy_by_channel_tag(channel_tag_t *ct, int delconf)
   while((dae = LIST_FIRST(&ct->ct_autorecs)) != NULL) {
     LIST_REMOVE(dae, dae_channel_tag_link);
     dae->dae_channel_tag = NULL;
+    dvr_autorec_match_dirty = 1;
     idnode_notify_changed(&dae->dae_id);
     if (delconf)
       idnode_changed(&dae->dae_id);
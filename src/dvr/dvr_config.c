@@ -180,6 +180,7 @@ dvr_config_create(const char *name, const char *uuid, htsmsg_t *conf)
   cfg->dvr_retention_days = DVR_RET_ONREMOVE;
   cfg->dvr_removal_days = DVR_RET_FOREVER;
   cfg->dvr_clone = 1;
+  cfg->dvr_share = 0;
   cfg->dvr_tag_files = 1;
   cfg->dvr_skip_commercials = 1;
   dvr_charset_update(cfg, intlconv_filesystem_charset());
@@ -926,6 +927,21 @@ const idclass_t dvr_config_class = {
       .def.u32  = 1,
       .group    = 1,
     },
+    {
+      .type     = PT_BOOL,
+      .id       = "share",
+      .name     = N_("Share streaming chain"),
+      .desc     = N_("Recordings of the same channel which use a compatible "
+                     "stream profile share one streaming chain. Each "
+                     "recording still writes its own file. Only the "
+                     "matroska profiles can share the chain and the "
+                     "saving is marginal (the tsfix and global headers "
+                     "stages run once per channel)."),
+      .off      = offsetof(dvr_config_t, dvr_share),
+      .opts     = PO_EXPERT,
+      .def.u32  = 0,
+      .group    = 1,
+    },
     {
       .type     = PT_U32,
       .id       = "rerecord-errors",
@@ -3088,6 +3088,33 @@ const idclass_t dvr_entry_class = {
       .off      = offsetof(dvr_entry_t, de_data_errors),
       .opts     = PO_RDONLY | PO_ADVANCED,
     },
+    {
+      .type     = PT_U32,
+      .id       = "write_latency",
+      .name     = N_("Write latency (us)"),
+      .desc     = N_("Average time needed to write a buffer "
+                     "to the recording file."),
+      .off      = offsetof(dvr_entry_t, de_write_latency),
+      .opts     = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+    },
+    {
+      .type     = PT_U32,
+      .id       = "write_latency_max",
+      .name     = N_("Maximum write latency (us)"),
+      .desc     = N_("Maximum time needed to write a buffer "
+                     "to the recording file."),
+      .off      = offsetof(dvr_entry_t, de_write_latency_max),
+      .opts     = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+    },
+    {
+      .type     = PT_U32,
+      .id       = "write_queue",
+      .name     = N_("Write queue (KB)"),
+      .desc     = N_("Amount of data waiting to be written "
+                     "to the recording file."),
+      .off      = offsetof(dvr_entry_t, de_write_queue),
+      .opts     = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+    },
     {
       .type     = PT_U16,
       .id       = "dvb_eid",
@@ -39,6 +39,7 @@
 #include "notify.h"
 
 #include "muxer.h"
+#include "muxer/muxer_writer.h"
 
 /**
  *
@@ -69,7 +70,7 @@ dvr_rec_subscribe(dvr_entry_t *de)
   struct sockaddr sa;
   access_t *aa;
   uint32_t rec_count, net_count;
-  int c1, c2;
+  int c1, c2, flags;
 
   assert(de->de_s == NULL);
   assert(de->de_chain == NULL);
@@ -109,16 +110,17 @@ dvr_rec_subscribe(dvr_entry_t *de)
   }
   access_destroy(aa);
 
+  flags = de->de_config->dvr_share ? PROFILE_CHAIN_SHARE : 0;
   pro = de->de_config->dvr_profile;
   prch = malloc(sizeof(*prch));
   profile_chain_init(prch, pro, de->de_channel);
-  if (profile_chain_open(prch, &de->de_config->dvr_muxcnf, 0, 0)) {
+  if (profile_chain_open(prch, &de->de_config->dvr_muxcnf, flags, 0)) {
     profile_chain_close(prch);
     tvherror("dvr", "unable to create new channel streaming chain '%s' for '%s', using default",
              profile_get_name(pro), channel_get_name(de->de_channel));
     pro = profile_find_by_name(NULL, NULL);
     profile_chain_init(prch, pro, de->de_channel);
-    if (profile_chain_open(prch, &de->de_config->dvr_muxcnf, 0, 0)) {
+    if (profile_chain_open(prch, &de->de_config->dvr_muxcnf, flags, 0)) {
       tvherror("dvr", "unable to create channel streaming default chain '%s' for '%s'",
                profile_get_name(pro), channel_get_name(de->de_channel));
       profile_chain_close(prch);
@@ -879,7 +881,16 @@ dvr_rec_fatal_error(dvr_entry_t *de, const char *fmt, ...)
 static void
 dvr_notify(dvr_entry_t *de)
 {
+  muxer_t *muxer;
+  muxer_writer_stats_t stats;
+
   if (de->de_last_notify + sec2mono(5) < mclk()) {
+    if (de->de_chain && (muxer = de->de_chain->prch_muxer) && muxer->m_writer) {
+      muxer_writer_stats(muxer->m_writer, &stats);
+      de->de_write_latency     = stats.mws_latency;
+      de->de_write_latency_max = stats.mws_latency_max;
+      de->de_write_queue       = stats.mws_queued / 1024;
+    }
     idnode_notify_changed(&de->de_id);
     de->de_last_notify = mclk();
     htsp_dvr_entry_update(de);
@@ -1581,6 +1592,7 @@ dvr_thread_epilog(dvr_entry_t *de, const char *dvr_postproc)
   muxer_close(prch->prch_muxer);
   muxer_destroy(prch->prch_muxer);
   prch->prch_muxer = NULL;
+  de->de_write_queue = 0;
 
   if ((f = htsmsg_field_last(de->de_files)) != NULL &&
       (e = htsmsg_field_get_map(f)) != NULL)
@@ -424,7 +424,8 @@ dvr_get_disk_space_cb(void *aux)
   cfg = dvr_config_find_by_name_default(NULL);
   if (cfg->dvr_storage && cfg->dvr_storage[0]) {
     path = strdup(cfg->dvr_storage);
-    tasklet_arm(&dvr_disk_space_tasklet, dvr_get_disk_space_tcb, path);
+    tasklet_arm_flags(&dvr_disk_space_tasklet, dvr_get_disk_space_tcb,
+                      path, TASKLET_BULK);
   }
   mtimer_arm_rel(&dvr_disk_space_timer, dvr_get_disk_space_cb, NULL, sec2mono(15));
 }
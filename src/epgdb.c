@@ -548,7 +548,8 @@ void epg_save ( void )
     }
   }
 
-  tasklet_arm_alloc(epg_save_tsk_callback, sb);
+  tasklet_arm_alloc_flags(epg_save_tsk_callback, sb,
+                          TASKLET_BULK | TASKLET_SERIAL);
 
   /* Stats */
   tvhinfo("epgdb", "queued to save (size %d)", sb->sb_ptr);
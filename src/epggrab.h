@@ -252,6 +252,10 @@ struct epggrab_module_ota
   int  (*start) ( epggrab_ota_map_t *map, struct mpegts_mux *mm );
   int  (*tune)  ( epggrab_ota_map_t *map, epggrab_ota_mux_t *om,
                   struct mpegts_mux *mm );
+
+  /* Section cache statistics */
+  int      cache_hit;                   ///< Unchanged sections skipped
+  int      cache_miss;                  ///< Sections decoded
 };
 
 /*
@@ -212,6 +212,25 @@ const idclass_t epggrab_mod_ota_class = {
   .ic_class      = "epggrab_mod_ota",
   .ic_caption    = N_("Over-the-air EPG grabber"),
   .ic_properties = (const property_t[]){
+    {
+      .type   = PT_INT,
+      .id     = "cache_hit",
+      .name   = N_("Unchanged sections"),
+      .desc   = N_("Number of received sections skipped because "
+                   "their content was already processed."),
+      .off    = offsetof(epggrab_module_ota_t, cache_hit),
+      .opts   = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+      .group  = 1
+    },
+    {
+      .type   = PT_INT,
+      .id     = "cache_miss",
+      .name   = N_("Decoded sections"),
+      .desc   = N_("Number of received sections fully decoded."),
+      .off    = offsetof(epggrab_module_ota_t, cache_miss),
+      .opts   = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+      .group  = 1
+    },
     {}
   }
 };
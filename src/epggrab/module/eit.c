@@ -27,6 +27,7 @@
 #include "input.h"
 #include "input/mpegts/dvb_charset.h"
 #include "dvr/dvr.h"
+#include "atomic.h"
 
 /* ************************************************************************
  * Status handling
@@ -42,6 +43,7 @@ typedef struct eit_event
   lang_str_t       *desc;
 
   const char       *default_charset;
+  dvb_string_conv_t *conv;
 
   htsmsg_t         *extra;
 
@@ -55,6 +57,26 @@ typedef struct eit_event
 
 } eit_event_t;
 
+/*
+ * Per-mux section cache: schedule and other-TS sections are repeated
+ * continuously with identical content, remember a checksum of what was
+ * last decoded so the repeats can be dropped before descriptor parsing
+ */
+#define EIT_CACHE_SIZE    4096 /* entries, power of two */
+#define EIT_CACHE_TIMEOUT 3600 /* seconds */
+
+typedef struct eit_cache_ent
+{
+  uint64_t          key;       /* tableid, section, onid, tsid, sid */
+  uint32_t          crc;       /* payload + channel mapping */
+  uint32_t          stamp;     /* monotonic seconds */
+} eit_cache_ent_t;
+
+typedef struct eit_cache
+{
+  eit_cache_ent_t   ents[EIT_CACHE_SIZE];
+} eit_cache_t;
+
 /* ************************************************************************
  * Diagnostics
  * ***********************************************************************/
@@ -92,23 +114,12 @@ static dvb_string_conv_t _eit_freesat_conv[2] = {
  * Get string
  */
 static int _eit_get_string_with_len
-  ( epggrab_module_t *m,
+  ( eit_event_t *ev,
     char *dst, size_t dstlen, 
-		const uint8_t *src, size_t srclen, const char *charset )
+		const uint8_t *src, size_t srclen )
 {
-  dvb_string_conv_t *cptr = NULL;
-
-  /* Enable huffman decode (for freeview and/or freesat) */
-  m = epggrab_module_find_by_id("uk_freesat");
-  if (m && m->enabled) {
-    cptr = _eit_freesat_conv;
-  } else {
-    m = epggrab_module_find_by_id("uk_freeview");
-    if (m && m->enabled) cptr = _eit_freesat_conv;
-  }
-
-  /* Convert */
-  return dvb_get_string_with_len(dst, dstlen, src, srclen, charset, cptr);
+  return dvb_get_string_with_len(dst, dstlen, src, srclen,
+                                 ev->default_charset, ev->conv);
 }
 
 /*
@@ -130,8 +141,8 @@ static int _eit_desc_short_event
   ptr += 3;
 
   /* Title */
-  if ( (r = _eit_get_string_with_len(mod, buf, sizeof(buf),
-                                     ptr, len, ev->default_charset)) < 0 ) {
+  if ( (r = _eit_get_string_with_len(ev, buf, sizeof(buf),
+                                     ptr, len)) < 0 ) {
     return -1;
   } else if ( r > 1 ) {
     if (!ev->title) ev->title = lang_str_create();
@@ -143,8 +154,8 @@ static int _eit_desc_short_event
   if ( len < 1 ) return -1;
 
   /* Summary */
-  if ( (r = _eit_get_string_with_len(mod, buf, sizeof(buf),
-                                     ptr, len, ev->default_charset)) < 0 ) {
+  if ( (r = _eit_get_string_with_len(ev, buf, sizeof(buf),
+                                     ptr, len)) < 0 ) {
     return -1;
   } else if ( r > 1 ) {
     if (!ev->summary) ev->summary = lang_str_create();
@@ -192,16 +203,16 @@ static int _eit_desc_ext_event
   while (ilen) {
 
     /* Key */
-    if ( (r = _eit_get_string_with_len(mod, ikey, sizeof(ikey),
-                                       iptr, ilen, ev->default_charset)) < 0 )
+    if ( (r = _eit_get_string_with_len(ev, ikey, sizeof(ikey),
+                                       iptr, ilen)) < 0 )
       break;
     
     ilen -= r;
     iptr += r;
 
     /* Value */
-    if ( (r = _eit_get_string_with_len(mod, ival, sizeof(ival),
-                                       iptr, ilen, ev->default_charset)) < 0 )
+    if ( (r = _eit_get_string_with_len(ev, ival, sizeof(ival),
+                                       iptr, ilen)) < 0 )
       break;
 
     ilen -= r;
@@ -218,10 +229,9 @@ static int _eit_desc_ext_event
   }
 
   /* Description */
-  if ( _eit_get_string_with_len(mod,
+  if ( _eit_get_string_with_len(ev,
                                 buf, sizeof(buf),
-                                ptr, len,
-                                ev->default_charset) > 1 ) {
+                                ptr, len) > 1 ) {
     if (!ev->desc) ev->desc = lang_str_create();
     lang_str_append(ev->desc, buf, lang);
   }
@@ -356,9 +366,8 @@ static int _eit_desc_crid
       crid = NULL;
       type = *ptr >> 2;
 
-      r = _eit_get_string_with_len(mod, buf, sizeof(buf),
-                                   ptr+1, len-1,
-                                   ev->default_charset);
+      r = _eit_get_string_with_len(ev, buf, sizeof(buf),
+                                   ptr+1, len-1);
       if (r < 0) return -1;
       if (r == 0) continue;
 
@@ -407,7 +416,7 @@ static int _eit_desc_crid
 static int _eit_process_event_one
   ( epggrab_module_t *mod, int tableid, int sect,
     mpegts_service_t *svc, channel_t *ch,
-    const uint8_t *ptr, int len,
+    const uint8_t *ptr, int len, dvb_string_conv_t *conv,
     int local, int *resched, int *save )
 {
   int dllen, save2 = 0;
@@ -449,6 +458,7 @@ static int _eit_process_event_one
   /* Process tags */
   memset(&ev, 0, sizeof(ev));
   ev.default_charset = dvb_charset_find(NULL, NULL, svc);
+  ev.conv = conv;
 
   while (dllen > 2) {
     int r;
@@ -584,7 +594,7 @@ static int _eit_process_event_one
 static int _eit_process_event
   ( epggrab_module_t *mod, int tableid, int sect,
     mpegts_service_t *svc, const uint8_t *ptr, int len,
-    int local, int *resched, int *save )
+    dvb_string_conv_t *conv, int local, int *resched, int *save )
 {
   idnode_list_mapping_t *ilm;
   channel_t *ch;
@@ -595,12 +605,74 @@ static int _eit_process_event
     ch = (channel_t *)ilm->ilm_in2;
     if (!ch->ch_enabled || ch->ch_epg_parent) continue;
     if (_eit_process_event_one(mod, tableid, sect, svc, ch,
-                               ptr, len, local, resched, save) < 0)
+                               ptr, len, conv, local, resched, save) < 0)
       return -1;
   }
   return 12 + (((ptr[10] & 0x0f) << 8) | ptr[11]);
 }
 
+/* ************************************************************************
+ * Section cache
+ * ***********************************************************************/
+
+static dvb_string_conv_t *
+_eit_cache_conv ( void )
+{
+  epggrab_module_t *m;
+
+  /* Enable huffman decode (for freeview and/or freesat) */
+  m = epggrab_module_find_by_id("uk_freesat");
+  if (m && m->enabled)
+    return _eit_freesat_conv;
+  m = epggrab_module_find_by_id("uk_freeview");
+  if (m && m->enabled)
+    return _eit_freesat_conv;
+  return NULL;
+}
+
+static eit_cache_ent_t *
+_eit_cache_find
+  ( eit_cache_t *ec, mpegts_table_t *mt, mpegts_service_t *svc,
+    int tableid, const uint8_t *ptr, int len, uint32_t *crc )
+{
+  idnode_list_mapping_t *ilm;
+  channel_t *ch;
+  eit_cache_ent_t *ece;
+  uint64_t key;
+  uint32_t c;
+
+  /* version is ignored, only the section content matters */
+  key = ((uint64_t)tableid << 56) | ((uint64_t)ptr[3] << 48) |
+        ((uint64_t)ptr[7] << 40) | ((uint64_t)ptr[8] << 32) |
+        ((uint64_t)ptr[5] << 24) | ((uint64_t)ptr[6] << 16) |
+        (ptr[0] << 8) | ptr[1];
+  ece = &ec->ents[(key * 0x9E3779B97F4A7C15ULL) >> 52];
+
+  c = tvh_crc32(ptr + 3, len - 3, mt->mt_pid);
+  LIST_FOREACH(ilm, &svc->s_channels, ilm_in1_link) {
+    ch = (channel_t *)ilm->ilm_in2;
+    if (!ch->ch_enabled || ch->ch_epg_parent) continue;
+    c = tvh_crc32((uint8_t *)&ch, sizeof(ch), c);
+  }
+  *crc = c;
+
+  if (ece->key != key) {
+    ece->key = key;
+    ece->stamp = 0;
+  }
+  return ece;
+}
+
+static int
+_eit_cache_hit ( eit_cache_ent_t *ece, uint32_t crc, uint32_t now )
+{
+  return ece->stamp && ece->crc == crc &&
+         now - ece->stamp < EIT_CACHE_TIMEOUT;
+}
+
+/* ************************************************************************
+ * Table callback
+ * ***********************************************************************/
 
 static int
 _eit_callback
@@ -610,9 +682,12 @@ _eit_callback
   int sect, last, ver, save, resched;
   uint8_t  seg;
   uint16_t onid, tsid, sid;
-  uint32_t extraid;
+  uint32_t extraid, crc = 0, now = 0;
   mpegts_service_t     *svc;
   mpegts_mux_t         *mm;
+  eit_cache_t          *ec;
+  eit_cache_ent_t      *ece = NULL;
+  dvb_string_conv_t    *conv;
   epggrab_ota_map_t    *map;
   epggrab_module_t     *mod;
   epggrab_ota_mux_t    *ota = NULL;
@@ -626,6 +701,7 @@ _eit_callback
   mm  = mt->mt_mux;
   map = mt->mt_opaque;
   mod = (epggrab_module_t *)map->om_module;
+  ec  = mm->mm_eit_cache;
 
   /* Statistics */
   ths = mpegts_mux_find_subscription_by_name(mm, "epggrab");
@@ -712,6 +788,20 @@ _eit_callback
   if (svc->s_dvb_ignore_eit)
     goto done;
 
+  /* Unchanged section (now/next is always processed for running state) */
+  if (ec && tableid != 0x4e) {
+    now = mono2sec(mclk());
+    ece = _eit_cache_find(ec, mt, svc, tableid, ptr, len, &crc);
+    if (_eit_cache_hit(ece, crc, now)) {
+      atomic_add(&((epggrab_module_ota_t *)mod)->cache_hit, 1);
+      goto done;
+    }
+    atomic_add(&((epggrab_module_ota_t *)mod)->cache_miss, 1);
+  }
+
+  /* Huffman decoder (the module setup might change at any time) */
+  conv = _eit_cache_conv();
+
   /* Process events */
   save = resched = 0;
   len -= 11;
@@ -719,6 +809,7 @@ _eit_callback
   while (len) {
     int r;
     if ((r = _eit_process_event(mod, tableid, sect, svc, ptr, len,
+                                conv,
                                 mm->mm_network->mn_localtime,
                                 &resched, &save)) < 0)
       break;
@@ -727,6 +818,11 @@ _eit_callback
     ptr += r;
   }
 
+  if (ece) {
+    ece->crc   = crc;
+    ece->stamp = now ?: 1;
+  }
+
   /* Update EPG */
   if (resched) epggrab_resched();
   if (save)    epg_updated();
@@ -778,6 +874,8 @@ static int _eit_start
     pid  = DVB_EIT_PID;
     opts = MT_RECORD;
   }
+  if (dm->mm_eit_cache == NULL)
+    dm->mm_eit_cache = calloc(1, sizeof(eit_cache_t));
   mpegts_table_add(dm, 0, 0, _eit_callback, map, m->id, MT_CRC | opts, pid, MPS_WEIGHT_EIT);
   // TODO: might want to limit recording to EITpf only
   tvhlog(LOG_DEBUG, m->id, "installed table handlers");
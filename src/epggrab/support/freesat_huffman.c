@@ -5757,8 +5757,215 @@ unsigned fsat_index_2[] = {
 		3160  /* 128 */
 };
 
+/*
+ * Lookup tables: for each table and previous character, the characters
+ * decoded from the next FSAT_LUT_BITS bits (several short codes are
+ * chained), built once on first use
+ */
+#define FSAT_LUT_BITS  8
+#define FSAT_LUT_CHARS 4
+
+typedef struct fsat_lut {
+	uint8_t bits;		/* 0 = ambiguous, scan the table */
+	uint8_t count;
+	char ch[FSAT_LUT_CHARS];
+} fsat_lut_t;
+
+static fsat_lut_t *fsat_lut[2];
+static pthread_once_t fsat_lut_once[2] = { PTHREAD_ONCE_INIT, PTHREAD_ONCE_INIT };
+
+static inline unsigned int fsat_mask(int bits)
+{
+	return bits ? 0xffffffffU << (32 - bits) : 0;
+}
+
+/*
+ * First code of the context matching value; -1 = none, -2 = undecidable
+ * within the first maxbits bits of value
+ */
+static int fsat_match(struct fsattab *fsat_table, unsigned int *fsat_index,
+                      unsigned int indx, unsigned int value, int maxbits)
+{
+	unsigned int j;
+
+	for (j = fsat_index[indx]; j < fsat_index[indx + 1]; j++) {
+		if (fsat_table[j].bits > maxbits) {
+			if ((value & fsat_mask(maxbits)) ==
+			    (fsat_table[j].value & fsat_mask(maxbits)))
+				return -2;
+		} else if ((value & fsat_mask(fsat_table[j].bits)) == fsat_table[j].value) {
+			return j;
+		}
+	}
+	return -1;
+}
+
+#if HUFFMAN_TESTSUITE
+static void freesat_huffman_testsuite_run(int t);
+#endif
+
+static void fsat_lut_build(int t)
+{
+	struct fsattab *fsat_table = t ? fsat_table_2 : fsat_table_1;
+	unsigned int *fsat_index = t ? fsat_index_2 : fsat_index_1;
+	fsat_lut_t *lut, *l;
+	unsigned int indx, i, value;
+	int j, used;
+	char ch;
+
+	lut = calloc(128 << FSAT_LUT_BITS, sizeof(fsat_lut_t));
+	if (!lut) return;
+	for (indx = 0; indx < 128; indx++) {
+		for (i = 0; i < (1 << FSAT_LUT_BITS); i++) {
+			l = &lut[(indx << FSAT_LUT_BITS) | i];
+			ch = indx;
+			used = 0;
+			while (l->count < FSAT_LUT_CHARS && used < FSAT_LUT_BITS) {
+				value = (i << (32 - FSAT_LUT_BITS + used));
+				j = fsat_match(fsat_table, fsat_index, (unsigned char)ch,
+				               value, FSAT_LUT_BITS - used);
+				if (j < 0 || fsat_table[j].bits == 0)
+					break;
+				ch = fsat_table[j].next;
+				l->ch[l->count++] = ch;
+				used += fsat_table[j].bits;
+				if (ch == STOP || ch == ESCAPE || (ch & 0x80))
+					break;
+			}
+			l->bits = used;
+		}
+	}
+	fsat_lut[t] = lut;
+#if HUFFMAN_TESTSUITE
+	freesat_huffman_testsuite_run(t);
+#endif
+}
+
+static void fsat_lut_build_1(void) { fsat_lut_build(0); }
+static void fsat_lut_build_2(void) { fsat_lut_build(1); }
+
+/* 32 bits starting at bit position pos, zero padded */
+static inline unsigned int fsat_peek(const uint8_t *src, size_t srclen, size_t pos)
+{
+	uint64_t v = 0;
+	size_t i, b = pos >> 3;
+
+	for (i = 0; i < 5; i++, b++)
+		v = (v << 8) | (b < srclen ? src[b] : 0);
+	return (v >> (8 - (pos & 7))) & 0xffffffff;
+}
+
+static size_t fsat_decode
+  (char *dst, size_t* dstlen, const uint8_t *src, size_t srclen)
+{
+	struct fsattab *fsat_table;
+	unsigned int *fsat_index;
+	fsat_lut_t *lut, *l;
+	size_t p, pos, byte0;
+	unsigned int value;
+	char lastch;
+	int j, k;
+	unsigned int bitShift;
+	char nextCh;
+
+  if (src[0] != 0x1f) return -1;
+  if (src[1] != 1 && src[1] != 2) return -1;
+
+	if (src[1] == 1) {
+		fsat_table = fsat_table_1;
+		fsat_index = fsat_index_1;
+		lut = fsat_lut[0];
+	} else {
+		fsat_table = fsat_table_2;
+		fsat_index = fsat_index_2;
+		lut = fsat_lut[1];
+	}
+
+	/* Byte position as counted by the original bit shifting decoder */
+#define FSAT_BYTE(pos) (byte0 + (((pos) - 16) >> 3))
+	p = 0;
+	pos = 16;
+	byte0 = srclen < 6 ? (srclen > 2 ? srclen : 2) : 6;
+	lastch = START;
+
+	do {
+		/* Table step */
+		if (lut && lastch != ESCAPE && !(lastch & 0x80)) {
+			l = &lut[((unsigned char)lastch << FSAT_LUT_BITS) |
+			         (fsat_peek(src, srclen, pos) >> (32 - FSAT_LUT_BITS))];
+			if (l->bits && FSAT_BYTE(pos + l->bits) < srclen + 4) {
+				for (k = 0; k < l->count; k++) {
+					nextCh = l->ch[k];
+					if (nextCh != STOP && nextCh != ESCAPE) {
+						if (p >= *dstlen) return 0;
+						dst[p++] = nextCh;
+					}
+				}
+				lastch = l->ch[l->count - 1];
+				pos += l->bits;
+				continue;
+			}
+		}
+
+		/* Single code */
+		value = fsat_peek(src, srclen, pos);
+		bitShift = 0;
+		nextCh = STOP;
+		if (lastch == ESCAPE) {
+			// Encoded in the next 8 bits.
+			// Terminated by the first ASCII character.
+			nextCh = (value >> 24) & 0xff;
+			bitShift = 8;
+			if ((nextCh & 0x80) == 0) {
+				if (nextCh < ' ')
+					nextCh = STOP;
+				lastch = nextCh;
+			}
+		} else {
+			j = fsat_match(fsat_table, fsat_index, (unsigned int)lastch, value, 32);
+			if (j < 0)
+				return -1;
+			nextCh = fsat_table[j].next;
+			bitShift = fsat_table[j].bits;
+			lastch = nextCh;
+		}
+		if (nextCh != STOP && nextCh != ESCAPE) {
+			if (p >= *dstlen) return 0;
+			dst[p++] = nextCh;
+		}
+		// Shift up by the number of bits.
+		pos += bitShift;
+	} while (lastch != STOP && FSAT_BYTE(pos) < srclen + 4);
+#undef FSAT_BYTE
+
+	dst[p] = '\0';
+    *dstlen = p;
+	return 0;
+}
+
 size_t freesat_huffman_decode
   (char *dst, size_t* dstlen, const uint8_t *src, size_t srclen)
+{
+	if (src[0] == 0x1f) {
+		if (src[1] == 1)
+			pthread_once(&fsat_lut_once[0], fsat_lut_build_1);
+		else if (src[1] == 2)
+			pthread_once(&fsat_lut_once[1], fsat_lut_build_2);
+	}
+	return fsat_decode(dst, dstlen, src, srclen);
+}
+
+/*
+ *
+ * TESTSUITE
+ *
+ */
+
+#if HUFFMAN_TESTSUITE
+
+/* Reference bit-by-bit decoder */
+static size_t freesat_huffman_decode_ref
+  (char *dst, size_t* dstlen, const uint8_t *src, size_t srclen)
 {
 	struct fsattab *fsat_table;
 	unsigned int *fsat_index;
@@ -5860,3 +6067,30 @@ size_t freesat_huffman_decode
     return -1;
 	}
 }
+
+static void freesat_huffman_testsuite_run(int t)
+{
+	uint8_t src[64];
+	char dst1[256], dst2[256];
+	size_t r1, r2, l1, l2;
+	int i, j, len, fails = 0;
+
+	for (i = 0; i < 100000; i++) {
+		len = 3 + random() % (sizeof(src) - 2);
+		src[0] = 0x1f;
+		src[1] = t + 1;
+		for (j = 2; j < len; j++)
+			src[j] = random();
+		l1 = l2 = 1 + random() % (sizeof(dst1) - 1);
+		dst1[0] = dst2[0] = '\0';
+		r1 = fsat_decode(dst1, &l1, src, len);
+		r2 = freesat_huffman_decode_ref(dst2, &l2, src, len);
+		if (r1 != r2 || l1 != l2 || (r1 == 0 && memcmp(dst1, dst2, l1))) {
+			fprintf(stderr, "FSATTS: mismatch table %d len %d\n", t + 1, len);
+			fails++;
+		}
+	}
+	fprintf(stderr, "FSATTS: table %d, %d mismatches\n", t + 1, fails);
+}
+
+#endif
@@ -23,7 +23,9 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
+#include <pthread.h>
 #include "build.h"
+#include "atomic.h"
 #include "htsmsg.h"
 #include "misc/dbl.h"
 #include "htsmsg_json.h"
@@ -37,6 +39,276 @@ memoryinfo_t htsmsg_field_memoryinfo = { .my_name = "htsmsg field" };
 static void htsmsg_clear(htsmsg_t *msg);
 static htsmsg_t *htsmsg_field_get_msg ( htsmsg_field_t *f, int islist );
 
+/*
+ * Arena
+ *
+ * Fields of large messages (deserialized trees, grid responses) are
+ * carved from a few large blocks instead of one malloc per field. Each
+ * message (header or embedded) using the arena holds one reference,
+ * the blocks are freed when the last reference is dropped. Once the
+ * tree is built, the arena is sealed and the later additions are
+ * allocated from the heap (the arena memory is never reclaimed).
+ */
+
+#define HTSMSG_ARENA_BLOCK_MIN  1024
+#define HTSMSG_ARENA_BLOCK_MAX  (256*1024)
+
+typedef struct htsmsg_arena_block {
+  struct htsmsg_arena_block *hab_next;
+  size_t hab_size;
+  size_t hab_used;
+  int64_t hab_data[0];
+} htsmsg_arena_block_t;
+
+typedef struct htsmsg_arena {
+  int ha_refcount;
+  int ha_sealed;
+  size_t ha_bsize;
+  htsmsg_arena_block_t *ha_blocks;
+} htsmsg_arena_t;
+
+static htsmsg_arena_t *
+htsmsg_arena_create(size_t size)
+{
+  htsmsg_arena_t *ha = malloc(sizeof(*ha));
+  if (ha) {
+    ha->ha_refcount = 1;
+    ha->ha_sealed = 0;
+    ha->ha_bsize = size < HTSMSG_ARENA_BLOCK_MIN ? HTSMSG_ARENA_BLOCK_MIN :
+                   size > HTSMSG_ARENA_BLOCK_MAX ? HTSMSG_ARENA_BLOCK_MAX :
+                   size;
+    ha->ha_blocks = NULL;
+  }
+  return ha;
+}
+
+static inline htsmsg_arena_t *
+htsmsg_arena_ref(htsmsg_arena_t *ha)
+{
+  if (ha)
+    atomic_add(&ha->ha_refcount, 1);
+  return ha;
+}
+
+static void
+htsmsg_arena_release(htsmsg_arena_t *ha)
+{
+  htsmsg_arena_block_t *hab;
+
+  if (ha == NULL || atomic_add(&ha->ha_refcount, -1) > 1)
+    return;
+  while ((hab = ha->ha_blocks) != NULL) {
+    ha->ha_blocks = hab->hab_next;
+    free(hab);
+  }
+  free(ha);
+}
+
+static void *
+htsmsg_arena_alloc(htsmsg_arena_t *ha, size_t size)
+{
+  htsmsg_arena_block_t *hab = ha->ha_blocks;
+  void *r;
+
+  size = (size + 7) & ~(size_t)7;
+  if (hab == NULL || hab->hab_size - hab->hab_used < size) {
+    if (size > ha->ha_bsize / 4) {
+      /* large chunk - separate block, keep the current one active */
+      hab = malloc(sizeof(*hab) + size);
+      if (hab == NULL)
+        return NULL;
+      hab->hab_size = hab->hab_used = size;
+      if (ha->ha_blocks) {
+        hab->hab_next = ha->ha_blocks->hab_next;
+        ha->ha_blocks->hab_next = hab;
+      } else {
+        hab->hab_next = NULL;
+        ha->ha_blocks = hab;
+      }
+      return hab->hab_data;
+    }
+    hab = malloc(sizeof(*hab) + ha->ha_bsize);
+    if (hab == NULL)
+      return NULL;
+    hab->hab_size = ha->ha_bsize;
+    hab->hab_used = 0;
+    hab->hab_next = ha->ha_blocks;
+    ha->ha_blocks = hab;
+  }
+  r = (char *)hab->hab_data + hab->hab_used;
+  hab->hab_used += size;
+  return r;
+}
+
+/*
+ * Name index
+ *
+ * Open addressing table over the field names of a map. It is built
+ * when the map reaches HTSMSG_INDEX_THRESHOLD fields and kept up to date
+ * by htsmsg_field_link() / htsmsg_field_destroy(), so the lookups never
+ * modify the message (concurrent readers of a message which is not
+ * modified are safe). Only the first field of a given name is indexed
+ * (htsmsg_field_find() semantics).
+ */
+
+#define HTSMSG_INDEX_THRESHOLD 16
+#define HTSMSG_INDEX_TOMB      ((htsmsg_field_t *)&htsmsg_index_tomb)
+
+typedef struct htsmsg_index {
+  uint32_t hi_mask;
+  uint32_t hi_used;
+  int      hi_dups;
+  htsmsg_field_t *hi_slot[0];
+} htsmsg_index_t;
+
+static int64_t htsmsg_index_tomb;
+
+static inline uint32_t
+htsmsg_index_hash(const char *s)
+{
+  uint32_t h = 2166136261u;
+  for ( ; *s; s++)
+    h = (h ^ (uint8_t)*s) * 16777619u;
+  return h;
+}
+
+static void
+htsmsg_index_put(htsmsg_index_t *hi, htsmsg_field_t *f)
+{
+  htsmsg_field_t *g, **tomb = NULL;
+  uint32_t h;
+
+  if (f->hmf_name == NULL)
+    return;
+  h = htsmsg_index_hash(f->hmf_name) & hi->hi_mask;
+  while ((g = hi->hi_slot[h]) != NULL) {
+    if (g == HTSMSG_INDEX_TOMB) {
+      if (tomb == NULL)
+        tomb = &hi->hi_slot[h];
+    } else if (!strcmp(g->hmf_name, f->hmf_name)) {
+      hi->hi_dups = 1;
+      return;
+    }
+    h = (h + 1) & hi->hi_mask;
+  }
+  if (tomb) {
+    *tomb = f;
+  } else {
+    hi->hi_slot[h] = f;
+    hi->hi_used++;
+  }
+}
+
+static void
+htsmsg_index_drop(htsmsg_t *msg)
+{
+  free(msg->hm_index);
+  msg->hm_index = NULL;
+}
+
+static void
+htsmsg_index_build(htsmsg_t *msg)
+{
+  htsmsg_index_t *hi;
+  htsmsg_field_t *f;
+  uint32_t size = 32;
+
+  while (size < msg->hm_nfields * 2)
+    size <<= 1;
+  hi = calloc(1, sizeof(*hi) + size * sizeof(htsmsg_field_t *));
+  if (hi == NULL)
+    return;
+  hi->hi_mask = size - 1;
+  TAILQ_FOREACH(f, &msg->hm_fields, hmf_link)
+    htsmsg_index_put(hi, f);
+  msg->hm_index = hi;
+}
+
+static htsmsg_field_t *
+htsmsg_index_find(htsmsg_index_t *hi, const char *name)
+{
+  htsmsg_field_t *f;
+  uint32_t h = htsmsg_index_hash(name) & hi->hi_mask;
+
+  while ((f = hi->hi_slot[h]) != NULL) {
+    if (f != HTSMSG_INDEX_TOMB && !strcmp(f->hmf_name, name))
+      return f;
+    h = (h + 1) & hi->hi_mask;
+  }
+  return NULL;
+}
+
+static void
+htsmsg_index_insert(htsmsg_t *msg, htsmsg_field_t *f)
+{
+  htsmsg_index_t *hi = msg->hm_index;
+
+  /* too full - rebuild bigger (f is already linked) */
+  if ((hi->hi_used + 1) * 4 > (hi->hi_mask + 1) * 3) {
+    htsmsg_index_drop(msg);
+    htsmsg_index_build(msg);
+    return;
+  }
+  htsmsg_index_put(hi, f);
+}
+
+static void
+htsmsg_index_remove(htsmsg_t *msg, htsmsg_field_t *f)
+{
+  htsmsg_index_t *hi = msg->hm_index;
+  htsmsg_field_t *g;
+  uint32_t h;
+
+  if (f->hmf_name == NULL)
+    return;
+  h = htsmsg_index_hash(f->hmf_name) & hi->hi_mask;
+  while ((g = hi->hi_slot[h]) != NULL) {
+    if (g == f) {
+      /* the next field with the same name is not known (f is unlinked) */
+      if (hi->hi_dups) {
+        htsmsg_index_drop(msg);
+        htsmsg_index_build(msg);
+      } else
+        hi->hi_slot[h] = HTSMSG_INDEX_TOMB;
+      return;
+    }
+    if (g != HTSMSG_INDEX_TOMB && !strcmp(g->hmf_name, f->hmf_name))
+      return;
+    h = (h + 1) & hi->hi_mask;
+  }
+}
+
+/*
+ * Move all fields (and arena reference and index) to an empty message
+ */
+static void
+htsmsg_move(htsmsg_t *dst, htsmsg_t *src)
+{
+  TAILQ_MOVE(&dst->hm_fields, &src->hm_fields, hmf_link);
+  dst->hm_islist = src->hm_islist;
+  dst->hm_data = NULL;
+  dst->hm_data_size = 0;
+  dst->hm_arena = src->hm_arena;
+  src->hm_arena = NULL;
+  dst->hm_index = src->hm_index;
+  src->hm_index = NULL;
+  dst->hm_nfields = src->hm_nfields;
+  src->hm_nfields = 0;
+}
+
+/*
+ * Free a message header (fields must be already released)
+ */
+static void
+htsmsg_free_header(htsmsg_t *msg)
+{
+#if ENABLE_SLOW_MEMORYINFO
+  memoryinfo_free(&htsmsg_memoryinfo, sizeof(htsmsg_t));
+#endif
+  if (!msg->hm_inarena)
+    free(msg);
+}
+
 /**
  *
  */
@@ -83,6 +355,9 @@ htsmsg_field_destroy(htsmsg_t *msg, htsmsg_field_t *f)
 #endif
 
   TAILQ_REMOVE(&msg->hm_fields, f, hmf_link);
+  msg->hm_nfields--;
+  if (msg->hm_index)
+    htsmsg_index_remove(msg, f);
 
   htsmsg_field_data_destroy(f);
 
@@ -96,7 +371,21 @@ htsmsg_field_destroy(htsmsg_t *msg, htsmsg_field_t *f)
   memoryinfo_free(&htsmsg_field_memoryinfo,
                   sizeof(*f) + f->hmf_edata_size + asize);
 #endif
-  free(f);
+  if (!(f->hmf_flags & HMF_ARENA))
+    free(f);
+}
+
+/*
+ *
+ */
+void
+htsmsg_field_free(htsmsg_field_t *f, size_t size)
+{
+#if ENABLE_SLOW_MEMORYINFO
+  memoryinfo_free(&htsmsg_field_memoryinfo, size);
+#endif
+  if (!(f->hmf_flags & HMF_ARENA))
+    free(f);
 }
 
 /*
@@ -107,8 +396,46 @@ htsmsg_clear(htsmsg_t *msg)
 {
   htsmsg_field_t *f;
 
+  if (msg->hm_index)
+    htsmsg_index_drop(msg);
   while((f = TAILQ_FIRST(&msg->hm_fields)) != NULL)
     htsmsg_field_destroy(msg, f);
+  htsmsg_arena_release(msg->hm_arena);
+  msg->hm_arena = NULL;
+}
+
+
+/*
+ *
+ */
+htsmsg_field_t *
+htsmsg_field_alloc(htsmsg_t *msg, size_t size, int *flags)
+{
+  htsmsg_field_t *f;
+
+  if (msg->hm_arena && !msg->hm_arena->ha_sealed) {
+    if ((f = htsmsg_arena_alloc(msg->hm_arena, size)) != NULL)
+      *flags |= HMF_ARENA;
+    return f;
+  }
+  return malloc(size);
+}
+
+
+/*
+ *
+ */
+void
+htsmsg_init_submsg(htsmsg_t *parent, htsmsg_t *sub, int islist)
+{
+  TAILQ_INIT(&sub->hm_fields);
+  sub->hm_islist = islist;
+  sub->hm_inarena = 0;
+  sub->hm_data = NULL;
+  sub->hm_data_size = 0;
+  sub->hm_arena = htsmsg_arena_ref(parent->hm_arena);
+  sub->hm_index = NULL;
+  sub->hm_nfields = 0;
 }
 
 
@@ -126,10 +453,9 @@ htsmsg_field_add(htsmsg_t *msg, const char *name, int type, int flags, size_t es
   
   if((flags & HMF_NAME_INALLOCED) && name)
     nsize = strlen(name) + 1;
-  f = malloc(sizeof(htsmsg_field_t) + nsize + esize);
+  f = htsmsg_field_alloc(msg, sizeof(htsmsg_field_t) + nsize + esize, &flags);
   if(f == NULL)
     return NULL;
-  TAILQ_INSERT_TAIL(&msg->hm_fields, f, hmf_link);
 
   if(msg->hm_islist) {
     assert(name == NULL);
@@ -167,10 +493,26 @@ htsmsg_field_add(htsmsg_t *msg, const char *name, int type, int flags, size_t es
   memoryinfo_alloc(&htsmsg_field_memoryinfo,
                    sizeof(htsmsg_field_t) + f->hmf_edata_size + asize);
 #endif
+  htsmsg_field_link(msg, f);
   return f;
 }
 
 
+/*
+ * Append a field with the name already set (keeps the name index)
+ */
+void
+htsmsg_field_link(htsmsg_t *msg, htsmsg_field_t *f)
+{
+  TAILQ_INSERT_TAIL(&msg->hm_fields, f, hmf_link);
+  msg->hm_nfields++;
+  if (msg->hm_index)
+    htsmsg_index_insert(msg, f);
+  else if (msg->hm_nfields >= HTSMSG_INDEX_THRESHOLD && !msg->hm_islist)
+    htsmsg_index_build(msg);
+}
+
+
 /*
  *
  */
@@ -181,11 +523,12 @@ htsmsg_field_find(htsmsg_t *msg, const char *name)
 
   if (msg == NULL || name == NULL)
     return NULL;
-  TAILQ_FOREACH(f, &msg->hm_fields, hmf_link) {
+  if (msg->hm_index)
+    return htsmsg_index_find(msg->hm_index, name);
+  TAILQ_FOREACH(f, &msg->hm_fields, hmf_link)
     if(f->hmf_name != NULL && !strcmp(f->hmf_name, name))
-      return f;
-  }
-  return NULL;
+      break;
+  return f;
 }
 
 
@@ -233,17 +576,23 @@ htsmsg_is_empty(htsmsg_t *msg)
 /*
  *
  */
-htsmsg_t *
-htsmsg_create_map(void)
+static htsmsg_t *
+htsmsg_create(htsmsg_arena_t *ha, int islist)
 {
   htsmsg_t *msg;
 
-  msg = malloc(sizeof(htsmsg_t));
+  if (ha && ha->ha_sealed)
+    ha = NULL;
+  msg = ha ? htsmsg_arena_alloc(ha, sizeof(htsmsg_t)) : malloc(sizeof(htsmsg_t));
   if (msg) {
     TAILQ_INIT(&msg->hm_fields);
     msg->hm_data = NULL;
     msg->hm_data_size = 0;
-    msg->hm_islist = 0;
+    msg->hm_islist = islist;
+    msg->hm_inarena = ha != NULL;
+    msg->hm_arena = htsmsg_arena_ref(ha);
+    msg->hm_index = NULL;
+    msg->hm_nfields = 0;
 #if ENABLE_SLOW_MEMORYINFO
     memoryinfo_alloc(&htsmsg_memoryinfo, sizeof(htsmsg_t));
 #endif
@@ -251,27 +600,77 @@ htsmsg_create_map(void)
   return msg;
 }
 
+/*
+ *
+ */
+htsmsg_t *
+htsmsg_create_map(void)
+{
+  return htsmsg_create(NULL, 0);
+}
+
 /*
  *
  */
 htsmsg_t *
 htsmsg_create_list(void)
 {
+  return htsmsg_create(NULL, 1);
+}
+
+/*
+ *
+ */
+static htsmsg_t *
+htsmsg_create_arena(size_t size, int islist)
+{
+  htsmsg_arena_t *ha = htsmsg_arena_create(size);
   htsmsg_t *msg;
 
-  msg = malloc(sizeof(htsmsg_t));
-  if (msg) {
-    TAILQ_INIT(&msg->hm_fields);
-    msg->hm_data = NULL;
-    msg->hm_data_size = 0;
-    msg->hm_islist = 1;
-#if ENABLE_SLOW_MEMORYINFO
-    memoryinfo_alloc(&htsmsg_memoryinfo, sizeof(htsmsg_t));
-#endif
-  }
+  if (ha == NULL)
+    return NULL;
+  msg = htsmsg_create(ha, islist);
+  htsmsg_arena_release(ha);
   return msg;
 }
 
+htsmsg_t *
+htsmsg_create_map_arena(size_t size)
+{
+  return htsmsg_create_arena(size, 0);
+}
+
+htsmsg_t *
+htsmsg_create_list_arena(size_t size)
+{
+  return htsmsg_create_arena(size, 1);
+}
+
+/*
+ *
+ */
+htsmsg_t *
+htsmsg_create_map_in(htsmsg_t *owner)
+{
+  return htsmsg_create(owner ? owner->hm_arena : NULL, 0);
+}
+
+htsmsg_t *
+htsmsg_create_list_in(htsmsg_t *owner)
+{
+  return htsmsg_create(owner ? owner->hm_arena : NULL, 1);
+}
+
+/*
+ *
+ */
+void
+htsmsg_arena_seal(htsmsg_t *msg)
+{
+  if (msg && msg->hm_arena)
+    msg->hm_arena->ha_sealed = 1;
+}
+
 
 /*
  *
@@ -279,24 +678,23 @@ htsmsg_create_list(void)
 void
 htsmsg_destroy(htsmsg_t *msg)
 {
-#if ENABLE_SLOW_MEMORYINFO
-  size_t size = 0;
-#endif
+  htsmsg_arena_t *ha;
 
   if(msg == NULL)
     return;
 
+  /* the header itself may live in the arena, release it as last */
+  ha = msg->hm_arena;
+  msg->hm_arena = NULL;
   htsmsg_clear(msg);
   if (msg->hm_data) {
     free((void *)msg->hm_data);
 #if ENABLE_SLOW_MEMORYINFO
-    size += msg->hm_data_size;
+    memoryinfo_remove(&htsmsg_memoryinfo, msg->hm_data_size);
 #endif
   }
-#if ENABLE_SLOW_MEMORYINFO
-  memoryinfo_free(&htsmsg_memoryinfo, sizeof(htsmsg_t) + size);
-#endif
-  free(msg);
+  htsmsg_free_header(msg);
+  htsmsg_arena_release(ha);
 }
 
 /*
@@ -477,14 +875,8 @@ static htsmsg_t *
 htsmsg_field_set_msg(htsmsg_field_t *f, htsmsg_t *sub)
 {
   assert(sub->hm_data == NULL);
-  f->hmf_msg.hm_data = NULL;
-  f->hmf_msg.hm_data_size = 0;
-  f->hmf_msg.hm_islist = sub->hm_islist;
-  TAILQ_MOVE(&f->hmf_msg.hm_fields, &sub->hm_fields, hmf_link);
-#if ENABLE_SLOW_MEMORYINFO
-  memoryinfo_free(&htsmsg_memoryinfo, sizeof(htsmsg_t));
-#endif
-  free(sub);
+  htsmsg_move(&f->hmf_msg, sub);
+  htsmsg_free_header(sub);
 
   if (f->hmf_type == (f->hmf_msg.hm_islist ? HMF_LIST : HMF_MAP))
     return &f->hmf_msg;
@@ -531,14 +923,8 @@ htsmsg_add_msg_extname(htsmsg_t *msg, const char *name, htsmsg_t *sub)
   f = htsmsg_field_add(msg, name, sub->hm_islist ? HMF_LIST : HMF_MAP, 0, 0);
 
   assert(sub->hm_data == NULL);
-  f->hmf_msg.hm_data = NULL;
-  f->hmf_msg.hm_data_size = 0;
-  TAILQ_MOVE(&f->hmf_msg.hm_fields, &sub->hm_fields, hmf_link);
-  f->hmf_msg.hm_islist = sub->hm_islist;
-#if ENABLE_SLOW_MEMORYINFO
-  memoryinfo_free(&htsmsg_memoryinfo, sizeof(htsmsg_t));
-#endif
-  free(sub);
+  htsmsg_move(&f->hmf_msg, sub);
+  htsmsg_free_header(sub);
 }
 
 
@@ -924,14 +1310,8 @@ htsmsg_field_get_msg ( htsmsg_field_t *f, int islist )
         free((void*)f->hmf_str);
       }
       f->hmf_type          = m->hm_islist ? HMF_LIST : HMF_MAP;
-      f->hmf_msg.hm_islist = m->hm_islist;
-      f->hmf_msg.hm_data   = NULL;
-      f->hmf_msg.hm_data_size = 0;
-      TAILQ_MOVE(&f->hmf_msg.hm_fields, &m->hm_fields, hmf_link);
-#if ENABLE_SLOW_MEMORYINFO
-      memoryinfo_free(&htsmsg_memoryinfo, sizeof(htsmsg_t));
-#endif
-      free(m);
+      htsmsg_move(&f->hmf_msg, m);
+      htsmsg_free_header(m);
     }
   }
 
@@ -947,10 +1327,16 @@ htsmsg_field_get_msg ( htsmsg_field_t *f, int islist )
 htsmsg_t *
 htsmsg_detach_submsg(htsmsg_field_t *f)
 {
-  htsmsg_t *r = htsmsg_create_map();
+  htsmsg_t *r;
 
-  TAILQ_MOVE(&r->hm_fields, &f->hmf_msg.hm_fields, hmf_link);
-  TAILQ_INIT(&f->hmf_msg.hm_fields);
+  if (f->hmf_msg.hm_arena) {
+    /* do not keep the whole parent arena alive for this submessage */
+    r = htsmsg_copy(&f->hmf_msg);
+    htsmsg_clear(&f->hmf_msg);
+  } else {
+    r = htsmsg_create_map();
+    htsmsg_move(r, &f->hmf_msg);
+  }
   r->hm_islist = f->hmf_type == HMF_LIST;
   return r;
 }
@@ -27,6 +27,9 @@
 
 TAILQ_HEAD(htsmsg_field_queue, htsmsg_field);
 
+struct htsmsg_arena;
+struct htsmsg_index;
+
 typedef struct htsmsg {
   /**
    * fields 
@@ -38,11 +41,31 @@ typedef struct htsmsg {
    */
   int hm_islist;
 
+  /**
+   * Set if this message header lives in an arena (not free'd alone).
+   */
+  int hm_inarena;
+
   /**
    * Data to be free'd when the message is destroyed
    */
   const void *hm_data;
   size_t hm_data_size;
+
+  /**
+   * Arena the fields are allocated from (referenced), or NULL for heap.
+   */
+  struct htsmsg_arena *hm_arena;
+
+  /**
+   * Name lookup index, built on insert for large maps.
+   */
+  struct htsmsg_index *hm_index;
+
+  /**
+   * Number of fields.
+   */
+  uint32_t hm_nfields;
 } htsmsg_t;
 
 
@@ -64,6 +87,7 @@ typedef struct htsmsg_field {
 #define HMF_INALLOCED      0x2
 #define HMF_NAME_INALLOCED 0x4
 #define HMF_NAME_ALLOCED   0x8
+#define HMF_ARENA          0x10
 
   union {
     int64_t  s64;
@@ -109,6 +133,32 @@ htsmsg_t *htsmsg_create_map(void);
  */
 htsmsg_t *htsmsg_create_list(void);
 
+/**
+ * Create a new map or list whose fields (and the fields of all
+ * submessages created with htsmsg_create_map_in()) are allocated from
+ * one arena. The arena is released in one shot when the last message
+ * referencing it is destroyed. Messages sharing an arena must not be
+ * modified from multiple threads at the same time.
+ *
+ * @param size Expected size of the whole tree (block size hint)
+ */
+htsmsg_t *htsmsg_create_map_arena(size_t size);
+htsmsg_t *htsmsg_create_list_arena(size_t size);
+
+/**
+ * Create a new map/list allocated from the arena of \p owner (or from
+ * the heap when \p owner does not use an arena).
+ */
+htsmsg_t *htsmsg_create_map_in(htsmsg_t *owner);
+htsmsg_t *htsmsg_create_list_in(htsmsg_t *owner);
+
+/**
+ * Stop allocating from the arena of \p msg (the tree is complete).
+ * The fields and submessages added later are allocated from the heap,
+ * so they are freed with the field and do not grow the arena.
+ */
+void htsmsg_arena_seal(htsmsg_t *msg);
+
 /**
  * Remove a given field from a msg
  */
@@ -390,6 +440,27 @@ void htsmsg_print(htsmsg_t *msg);
 htsmsg_field_t *htsmsg_field_add(htsmsg_t *msg, const char *name,
 				 int type, int flags, size_t esize);
 
+/**
+ * Append a deserialized field (the name must be set), keeps the index.
+ */
+void htsmsg_field_link(htsmsg_t *msg, htsmsg_field_t *f);
+
+/**
+ * Release a field allocated by a deserializer which was not linked yet.
+ */
+void htsmsg_field_free(htsmsg_field_t *f, size_t size);
+
+/**
+ * Init a submessage embedded in a field of \p parent.
+ */
+void htsmsg_init_submsg(htsmsg_t *parent, htsmsg_t *sub, int islist);
+
+/**
+ * Allocate storage for a new field (arena or heap) in \p msg.
+ * The HMF_ARENA flag is returned in \p flags when appropriate.
+ */
+htsmsg_field_t *htsmsg_field_alloc(htsmsg_t *msg, size_t size, int *flags);
+
 /**
  * Get a field, return NULL if it does not exist
  */
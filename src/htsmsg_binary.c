@@ -26,6 +26,8 @@
 #include "htsmsg_binary.h"
 #include "memoryinfo.h"
 
+#define HTSMSG_BINARY_ARENA_MIN 4096
+
 /*
  *
  */
@@ -37,7 +39,7 @@ htsmsg_binary_des0(htsmsg_t *msg, const uint8_t *buf, size_t len)
   htsmsg_field_t *f;
   htsmsg_t *sub;
   uint64_t u64;
-  int i, bin = 0;
+  int i, flags, bin = 0;
 
   while(len > 5) {
 
@@ -57,7 +59,8 @@ htsmsg_binary_des0(htsmsg_t *msg, const uint8_t *buf, size_t len)
     tlen = sizeof(htsmsg_field_t) +
            (namelen ? namelen + 1 : 0) +
            (type == HMF_STR ? datalen + 1 : 0);
-    f = malloc(tlen);
+    flags = 0;
+    f = htsmsg_field_alloc(msg, tlen, &flags);
     if (f == NULL)
       return -1;
 #if ENABLE_SLOW_MEMORYINFO
@@ -73,11 +76,11 @@ htsmsg_binary_des0(htsmsg_t *msg, const uint8_t *buf, size_t len)
 
       buf += namelen;
       len -= namelen;
-      f->hmf_flags = HMF_NAME_INALLOCED;
+      f->hmf_flags = flags | HMF_NAME_INALLOCED;
 
     } else {
       f->hmf_name  = NULL;
-      f->hmf_flags = 0;
+      f->hmf_flags = flags;
     }
 
     switch(type) {
@@ -103,16 +106,12 @@ htsmsg_binary_des0(htsmsg_t *msg, const uint8_t *buf, size_t len)
     case HMF_MAP:
     case HMF_LIST:
       sub = &f->hmf_msg;
-      TAILQ_INIT(&sub->hm_fields);
-      sub->hm_data = NULL;
+      htsmsg_init_submsg(msg, sub, type == HMF_LIST);
+      /* link first, so the partial submessage is released on error */
+      htsmsg_field_link(msg, f);
       i = htsmsg_binary_des0(sub, buf, datalen);
-      if (i < 0) {
-#if ENABLE_SLOW_MEMORYINFO
-        memoryinfo_free(&htsmsg_field_memoryinfo, tlen);
-#endif
-        free(f);
+      if (i < 0)
         return -1;
-      }
       if (i > 0)
         bin = 1;
       break;
@@ -122,14 +121,12 @@ htsmsg_binary_des0(htsmsg_t *msg, const uint8_t *buf, size_t len)
       break;
 
     default:
-#if ENABLE_SLOW_MEMORYINFO
-      memoryinfo_free(&htsmsg_field_memoryinfo, tlen);
-#endif
-      free(f);
+      htsmsg_field_free(f, tlen);
       return -1;
     }
 
-    TAILQ_INSERT_TAIL(&msg->hm_fields, f, hmf_link);
+    if (type != HMF_MAP && type != HMF_LIST)
+      htsmsg_field_link(msg, f);
     buf += datalen;
     len -= datalen;
   }
@@ -144,12 +141,22 @@ htsmsg_binary_des0(htsmsg_t *msg, const uint8_t *buf, size_t len)
 htsmsg_t *
 htsmsg_binary_deserialize(void *data, size_t len, const void *buf)
 {
-  htsmsg_t *msg = htsmsg_create_map();
-  int r = htsmsg_binary_des0(msg, data, len);
+  htsmsg_t *msg;
+  int r;
+
+  /* large messages (EPG, channel lists) are built in one arena */
+  if (len >= HTSMSG_BINARY_ARENA_MIN)
+    msg = htsmsg_create_map_arena(len + len / 2);
+  else
+    msg = htsmsg_create_map();
+  if (msg == NULL)
+    return NULL;
+  r = htsmsg_binary_des0(msg, data, len);
   if (r < 0) {
     htsmsg_destroy(msg);
     return NULL;
   }
+  htsmsg_arena_seal(msg);
   if (r > 0) {
     msg->hm_data = buf;
     msg->hm_data_size = len;
@@ -28,6 +28,8 @@
 #include "misc/json.h"
 #include "misc/dbl.h"
 
+#define HTSMSG_JSON_ARENA_MIN 4096
+
 
 /**
  *
@@ -132,13 +134,13 @@ htsmsg_json_serialize_to_str(htsmsg_t *msg, int pretty)
 static void *
 create_map(void *opaque)
 {
-  return htsmsg_create_map();
+  return htsmsg_create_map_in(opaque);
 }
 
 static void *
 create_list(void *opaque)
 {
-  return htsmsg_create_list();
+  return htsmsg_create_list_in(opaque);
 }
 
 static void
@@ -205,5 +207,16 @@ static const json_deserializer_t json_to_htsmsg = {
 htsmsg_t *
 htsmsg_json_deserialize(const char *src)
 {
-  return json_deserialize(src, &json_to_htsmsg, NULL, NULL, 0);
+  htsmsg_t *owner, *r;
+  size_t len = strlen(src);
+
+  if (len < HTSMSG_JSON_ARENA_MIN)
+    return json_deserialize(src, &json_to_htsmsg, NULL, NULL, 0);
+
+  /* large documents - allocate the whole tree from one arena */
+  owner = htsmsg_create_map_arena(len + len / 2);
+  r = json_deserialize(src, &json_to_htsmsg, owner, NULL, 0);
+  htsmsg_arena_seal(owner);
+  htsmsg_destroy(owner);
+  return r;
 }
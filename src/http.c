@@ -197,6 +197,7 @@ http_rc2str(int code)
   case HTTP_STATUS_OK:              /* 200 */ return "OK";
   case HTTP_STATUS_PARTIAL_CONTENT: /* 206 */ return "Partial Content";
   case HTTP_STATUS_FOUND:           /* 302 */ return "Found";
+  case HTTP_STATUS_NOT_MODIFIED:    /* 304 */ return "Not Modified";
   case HTTP_STATUS_BAD_REQUEST:     /* 400 */ return "Bad Request";
   case HTTP_STATUS_UNAUTHORIZED:    /* 401 */ return "Unauthorized";
   case HTTP_STATUS_FORBIDDEN:       /* 403 */ return "Forbidden";
@@ -604,6 +605,120 @@ http_output_content(http_connection_t *hc, const char *content)
 
 
 
+/**
+ * Start a streamed reply. The length is not known in advance, the body
+ * is sent in chunks (HTTP/1.1) or terminated by the connection close.
+ */
+void
+http_stream_begin(http_connection_t *hc, int rc, const char *content)
+{
+  http_arg_list_t args;
+  const char *encoding = NULL;
+
+  http_arg_init(&args);
+  hc->hc_stream = 1;
+  hc->hc_stream_chunked = hc->hc_version == HTTP_VERSION_1_1;
+  if (hc->hc_stream_chunked)
+    http_arg_set(&args, "Transfer-Encoding", "chunked");
+  else
+    hc->hc_keep_alive = 0;
+
+#if ENABLE_ZLIB
+  if (http_encoding_valid(hc, "gzip") &&
+      (hc->hc_stream_gzip = tvh_gzip_deflate_stream_init(3)) != NULL)
+    encoding = "gzip";
+#endif
+
+  pthread_mutex_lock(&hc->hc_fd_lock);
+  http_send_header(hc, rc, content, 0, encoding, NULL, 0, NULL, NULL, &args);
+  pthread_mutex_unlock(&hc->hc_fd_lock);
+
+  http_arg_flush(&args);
+}
+
+/**
+ *
+ */
+static int
+http_stream_chunk(http_connection_t *hc, htsbuf_queue_t *q)
+{
+  htsbuf_queue_t c;
+  int r;
+
+  if (hc->hc_no_output || q->hq_size == 0) {
+    htsbuf_queue_flush(q);
+    return 0;
+  }
+  if (hc->hc_stream_chunked) {
+    htsbuf_queue_init(&c, 0);
+    htsbuf_qprintf(&c, "%x\r\n", q->hq_size);
+    htsbuf_appendq(&c, q);
+    htsbuf_append(&c, "\r\n", 2);
+    q = &c;
+  }
+  pthread_mutex_lock(&hc->hc_fd_lock);
+  r = tcp_write_queue(hc->hc_fd, q);
+  pthread_mutex_unlock(&hc->hc_fd_lock);
+  return r;
+}
+
+/**
+ * Send a part of the streamed reply (the queue is consumed)
+ */
+int
+http_stream_write(http_connection_t *hc, htsbuf_queue_t *q)
+{
+#if ENABLE_ZLIB
+  htsbuf_queue_t z;
+  int r;
+
+  if (hc->hc_stream_gzip) {
+    htsbuf_queue_init(&z, 0);
+    r = tvh_gzip_deflate_stream(hc->hc_stream_gzip, q, &z, 0);
+    htsbuf_queue_flush(q);
+    if (r == 0)
+      r = http_stream_chunk(hc, &z);
+    htsbuf_queue_flush(&z);
+    return r;
+  }
+#endif
+  return http_stream_chunk(hc, q);
+}
+
+/**
+ * Finish the streamed reply
+ */
+int
+http_stream_end(http_connection_t *hc)
+{
+  htsbuf_queue_t q, empty;
+  int r = 0;
+
+  if (!hc->hc_stream)
+    return 0;
+  htsbuf_queue_init(&q, 0);
+#if ENABLE_ZLIB
+  if (hc->hc_stream_gzip) {
+    htsbuf_queue_init(&empty, 0);
+    r = tvh_gzip_deflate_stream(hc->hc_stream_gzip, &empty, &q, 1);
+    tvh_gzip_deflate_stream_end(hc->hc_stream_gzip);
+    hc->hc_stream_gzip = NULL;
+  }
+#endif
+  if (r == 0)
+    r = http_stream_chunk(hc, &q);
+  if (r == 0 && hc->hc_stream_chunked && !hc->hc_no_output) {
+    pthread_mutex_lock(&hc->hc_fd_lock);
+    r = tvh_write(hc->hc_fd, "0\r\n\r\n", 5);
+    pthread_mutex_unlock(&hc->hc_fd_lock);
+  }
+  htsbuf_queue_flush(&q);
+  hc->hc_stream = hc->hc_stream_chunked = 0;
+  if (r)
+    hc->hc_keep_alive = 0;
+  return r;
+}
+
 /**
  * Send an HTTP REDIRECT
  */
@@ -1477,6 +1592,16 @@ http_serve_requests(http_connection_t *hc)
 
     htsbuf_queue_flush(&hc->hc_reply);
 
+    if (hc->hc_stream) {
+      /* unfinished streamed reply - the client must see the close */
+#if ENABLE_ZLIB
+      tvh_gzip_deflate_stream_end(hc->hc_stream_gzip);
+      hc->hc_stream_gzip = NULL;
+#endif
+      hc->hc_stream = 0;
+      break;
+    }
+
     if (r)
       break;
 
@@ -166,6 +166,11 @@ typedef struct http_connection {
   char *hc_post_data;
   unsigned int hc_post_len;
 
+  /* Streamed reply (unknown length) */
+  int hc_stream;
+  int hc_stream_chunked;
+  struct z_stream_s *hc_stream_gzip;
+
 } http_connection_t;
 
 extern void *http_server;
@@ -200,6 +205,12 @@ void http_output_html(http_connection_t *hc);
 
 void http_output_content(http_connection_t *hc, const char *content);
 
+void http_stream_begin(http_connection_t *hc, int rc, const char *content);
+
+int http_stream_write(http_connection_t *hc, htsbuf_queue_t *q);
+
+int http_stream_end(http_connection_t *hc);
+
 void http_redirect(http_connection_t *hc, const char *location,
                    struct http_arg_list *req_args, int external);
 
@@ -283,6 +294,7 @@ struct http_client {
   int          hc_port;
   char        *hc_bindaddr;
   tvhpoll_t   *hc_efd;
+  struct http_client_thread *hc_thread;
   int          hc_pevents;
   int          hc_pevents_pause;
 
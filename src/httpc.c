@@ -81,8 +81,17 @@ http_client_testsuite_run( void );
 /*
  * Global state
  */
+#define HTTP_CLIENT_THREADS 4
+
+typedef struct http_client_thread {
+  tvhpoll_t *ht_poll;
+  pthread_t  ht_tid;
+  int        ht_clients;
+} http_client_thread_t;
+
 static int                      http_running;
-static tvhpoll_t               *http_poll;
+static http_client_thread_t     http_threads[HTTP_CLIENT_THREADS];
+static int                      http_threads_count;
 static TAILQ_HEAD(,http_client) http_clients;
 static pthread_mutex_t          http_lock;
 static tvh_cond_t               http_cond;
@@ -142,9 +151,11 @@ http_client_shutdown ( http_client_t *hc, int force, int reconnect )
     memset(&ev, 0, sizeof(ev));
     ev.fd       = hc->hc_fd;
     tvhpoll_rem(hc->hc_efd, &ev, 1);
-    if (hc->hc_efd == http_poll && !reconnect) {
+    if (hc->hc_thread && !reconnect) {
       pthread_mutex_lock(&http_lock);
       TAILQ_REMOVE(&http_clients, hc, hc_link);
+      hc->hc_thread->ht_clients--;
+      hc->hc_thread = NULL;
       hc->hc_efd = NULL;
       pthread_mutex_unlock(&http_lock);
     } else {
@@ -1362,23 +1373,20 @@ http_client_ssl_peer_verify( http_client_t *hc, int verify )
 static void *
 http_client_thread ( void *p )
 {
+  http_client_thread_t *ht = p;
   int n;
   tvhpoll_event_t ev;
   http_client_t *hc;
-  char c;
 
   while (atomic_get(&http_running)) {
-    n = tvhpoll_wait(http_poll, &ev, 1, -1);
+    n = tvhpoll_wait(ht->ht_poll, &ev, 1, -1);
     if (n < 0) {
       if (atomic_get(&http_running) && !ERRNO_AGAIN(errno))
         tvherror("httpc", "tvhpoll_wait() error");
     } else if (n > 0) {
       if (&http_pipe == ev.data.ptr) {
-        if (read(http_pipe.rd, &c, 1) == 1) {
-          /* end-of-task */
-          break;
-        }
-        continue;
+        /* end-of-task, the pipe is not drained to wake all threads */
+        break;
       }
       pthread_mutex_lock(&http_lock);
       TAILQ_FOREACH(hc, &http_clients, hc_link)
@@ -1545,6 +1553,9 @@ http_client_connect
 void
 http_client_register( http_client_t *hc )
 {
+  http_client_thread_t *ht;
+  int i;
+
   assert(hc->hc_data_received || hc->hc_conn_closed || hc->hc_data_complete);
   assert(hc->hc_efd == NULL);
   
@@ -1552,7 +1563,13 @@ http_client_register( http_client_t *hc )
 
   TAILQ_INSERT_TAIL(&http_clients, hc, hc_link);
 
-  hc->hc_efd  = http_poll;
+  /* the least loaded thread */
+  for (i = 1, ht = http_threads; i < http_threads_count; i++)
+    if (http_threads[i].ht_clients < ht->ht_clients)
+      ht = &http_threads[i];
+  ht->ht_clients++;
+  hc->hc_thread = ht;
+  hc->hc_efd    = ht->ht_poll;
 
   pthread_mutex_unlock(&http_lock);
 }
@@ -1572,16 +1589,18 @@ http_client_close ( http_client_t *hc )
   if (hc == NULL)
     return;
 
-  if (hc->hc_efd == http_poll) { /* http_client_thread */
+  if (hc->hc_thread) { /* http_client_thread */
     pthread_mutex_lock(&http_lock);
     hc->hc_shutdown_wait = 1;
     while (hc->hc_running)
       tvh_cond_wait(&http_cond, &http_lock);
-    if (hc->hc_efd) {
+    if (hc->hc_thread) {
       memset(&ev, 0, sizeof(ev));
       ev.fd = hc->hc_fd;
       tvhpoll_rem(hc->hc_efd, &ev, 1);
       TAILQ_REMOVE(&http_clients, hc, hc_link);
+      hc->hc_thread->ht_clients--;
+      hc->hc_thread = NULL;
       hc->hc_efd = NULL;
     }
     pthread_mutex_unlock(&http_lock);
@@ -1617,12 +1636,12 @@ http_client_close ( http_client_t *hc )
 /*
  * Initialise subsystem
  */
-pthread_t http_client_tid;
-
 void
 http_client_init ( const char *user_agent )
 {
+  http_client_thread_t *ht;
   tvhpoll_event_t ev;
+  int i;
 
   http_user_agent = user_agent ? strdup(user_agent) : NULL;
 
@@ -1634,17 +1653,20 @@ http_client_init ( const char *user_agent )
   /* Setup pipe */
   tvh_pipe(O_NONBLOCK, &http_pipe);
 
-  /* Setup poll */
-  http_poll   = tvhpoll_create(10);
-  memset(&ev, 0, sizeof(ev));
-  ev.fd       = http_pipe.rd;
-  ev.events   = TVHPOLL_IN;
-  ev.data.ptr = &http_pipe;
-  tvhpoll_add(http_poll, &ev, 1);
-
-  /* Setup thread */
+  /* Setup threads, one slow server should not block the others */
+  http_threads_count = sysconf(_SC_NPROCESSORS_ONLN);
+  http_threads_count = MINMAX(http_threads_count, 2, HTTP_CLIENT_THREADS);
   atomic_set(&http_running, 1);
-  tvhthread_create(&http_client_tid, NULL, http_client_thread, NULL, "httpc");
+  for (i = 0; i < http_threads_count; i++) {
+    ht = &http_threads[i];
+    ht->ht_poll = tvhpoll_create(10);
+    memset(&ev, 0, sizeof(ev));
+    ev.fd       = http_pipe.rd;
+    ev.events   = TVHPOLL_IN;
+    ev.data.ptr = &http_pipe;
+    tvhpoll_add(ht->ht_poll, &ev, 1);
+    tvhthread_create(&ht->ht_tid, NULL, http_client_thread, ht, "httpc");
+  }
 #if HTTPCLIENT_TESTSUITE
   http_client_testsuite_run();
 #endif
@@ -1654,17 +1676,22 @@ void
 http_client_done ( void )
 {
   http_client_t *hc;
+  int i;
 
   atomic_set(&http_running, 0);
   tvh_write(http_pipe.wr, "", 1);
-  pthread_join(http_client_tid, NULL);
+  for (i = 0; i < http_threads_count; i++)
+    pthread_join(http_threads[i].ht_tid, NULL);
   tvh_pipe_close(&http_pipe);
   pthread_mutex_lock(&http_lock);
-  TAILQ_FOREACH(hc, &http_clients, hc_link)
-    if (hc->hc_efd == http_poll)
-      hc->hc_efd = NULL;
-  tvhpoll_destroy(http_poll);
-  http_poll = NULL;
+  TAILQ_FOREACH(hc, &http_clients, hc_link) {
+    hc->hc_thread = NULL;
+    hc->hc_efd = NULL;
+  }
+  for (i = 0; i < http_threads_count; i++) {
+    tvhpoll_destroy(http_threads[i].ht_poll);
+    http_threads[i].ht_poll = NULL;
+  }
   pthread_mutex_unlock(&http_lock);
   free(http_user_agent);
 }
@@ -29,6 +29,7 @@ void huffman_tree_destroy ( huffman_node_t *n )
   huffman_tree_destroy(n->b0);
   huffman_tree_destroy(n->b1);
   if (n->data) free(n->data);
+  free(n->lut);
   free(n);
 }
 
@@ -42,6 +43,46 @@ huffman_node_t *huffman_tree_load ( const char *path )
   return ret;
 }
 
+/*
+ * Build the lookup table, each entry holds the codes completed within
+ * the next HUFFMAN_LUT_BITS bits when starting from the root
+ */
+static huffman_lut_t *huffman_lut_build ( huffman_node_t *root )
+{
+  huffman_lut_t *lut, *l;
+  huffman_node_t *node;
+  int i, b, used;
+
+  lut = calloc(1 << HUFFMAN_LUT_BITS, sizeof(huffman_lut_t));
+  if (!lut) return NULL;
+  for (i = 0; i < (1 << HUFFMAN_LUT_BITS); i++) {
+    l    = &lut[i];
+    node = root;
+    used = 0;
+    for (b = HUFFMAN_LUT_BITS - 1; b >= 0; b--) {
+      node = (i >> b) & 1 ? node->b1 : node->b0;
+      if (!node) break;
+      if (node->data) {
+        l->syms[l->count++] = node->data;
+        used = HUFFMAN_LUT_BITS - b;
+        node = root;
+        if (l->count == HUFFMAN_LUT_SYMS) break;
+      }
+    }
+    if (l->count) {
+      l->bits = used;
+    } else {
+      l->bits = HUFFMAN_LUT_BITS;
+      l->node = node; /* NULL for invalid code */
+    }
+  }
+  return lut;
+}
+
+#if HUFFMAN_TESTSUITE
+static void huffman_testsuite_run ( huffman_node_t *tree );
+#endif
+
 huffman_node_t *huffman_tree_build ( htsmsg_t *m )
 {
   const char *code, *data, *c;
@@ -70,12 +111,87 @@ huffman_node_t *huffman_tree_build ( htsmsg_t *m )
       node->data = strdup(data);
     }
   }
+  root->lut = huffman_lut_build(root);
+#if HUFFMAN_TESTSUITE
+  huffman_testsuite_run(root);
+#endif
   return root; 
 }
 
+static inline int huffman_emit ( const char *t, char **outb, int *outl )
+{
+  while (*t && *outl) {
+    **outb = *t;
+    (*outb)++; t++; (*outl)--;
+  }
+  return *outl == 0;
+}
+
+static inline uint32_t huffman_peek
+  ( const uint8_t *data, size_t len, size_t pos )
+{
+  size_t i = pos >> 3;
+  uint32_t v = (uint32_t)data[i] << 16;
+  if (i + 1 < len) v |= (uint32_t)data[i+1] << 8;
+  if (i + 2 < len) v |= data[i+2];
+  v >>= 24 - HUFFMAN_LUT_BITS - (pos & 7);
+  return v & ((1 << HUFFMAN_LUT_BITS) - 1);
+}
+
 char *huffman_decode 
   ( huffman_node_t *tree, const uint8_t *data, size_t len, uint8_t mask,
     char *outb, int outl )
+{
+  char           *ret  = outb;
+  huffman_node_t *node = tree;
+  huffman_lut_t  *l;
+  size_t          pos, end;
+  int             i;
+  if (!len) return NULL;
+
+  /* Bit position of the first (most significant) mask bit */
+  for (pos = 0; pos < 8 && !(mask & (0x80 >> pos)); pos++);
+  end = len * 8;
+
+  outl--; // leave space for NULL
+  while (pos < end) {
+    if (node == tree && tree->lut && pos + HUFFMAN_LUT_BITS <= end) {
+      l = &tree->lut[huffman_peek(data, len, pos)];
+      for (i = 0; i < l->count; i++)
+        if (huffman_emit(l->syms[i], &outb, &outl)) goto end;
+      if (!l->count && !(node = l->node)) goto end;
+      pos += l->bits;
+      continue;
+    }
+    if (data[pos >> 3] & (0x80 >> (pos & 7))) {
+      node = node->b1;
+    } else {
+      node = node->b0;
+    }
+    pos++;
+    if (!node) goto end;
+    if (node->data) {
+      if (huffman_emit(node->data, &outb, &outl)) goto end;
+      node = tree;
+    }
+  }
+end:
+  *outb = '\0';
+  return ret;
+}
+
+/*
+ *
+ * TESTSUITE
+ *
+ */
+
+#if HUFFMAN_TESTSUITE
+
+/* Reference bit-by-bit tree walker */
+static char *huffman_decode_tree
+  ( huffman_node_t *tree, const uint8_t *data, size_t len, uint8_t mask,
+    char *outb, int outl )
 {
   char           *ret  = outb;
   huffman_node_t *node = tree;
@@ -109,3 +225,28 @@ end:
   *outb = '\0';
   return ret;
 }
+
+static void
+huffman_testsuite_run ( huffman_node_t *tree )
+{
+  uint8_t data[64];
+  char out1[256], out2[256];
+  int i, j, len, outl, fails = 0;
+
+  for (i = 0; i < 100000; i++) {
+    len  = 1 + random() % sizeof(data);
+    outl = 1 + random() % sizeof(out1);
+    for (j = 0; j < len; j++)
+      data[j] = random();
+    huffman_decode(tree, data, len, 0x20, out1, outl);
+    huffman_decode_tree(tree, data, len, 0x20, out2, outl);
+    if (strcmp(out1, out2)) {
+      fprintf(stderr, "HUFFMANTS: mismatch len=%d outl=%d '%s' != '%s'\n",
+              len, outl, out1, out2);
+      fails++;
+    }
+  }
+  fprintf(stderr, "HUFFMANTS: %d mismatches\n", fails);
+}
+
+#endif
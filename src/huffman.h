@@ -22,11 +22,24 @@
 #include <sys/types.h>
 #include "htsmsg.h"
 
+/* Multi-bit lookup: decode up to HUFFMAN_LUT_SYMS codes per table step */
+#define HUFFMAN_LUT_BITS 10
+#define HUFFMAN_LUT_SYMS 4
+
+typedef struct huffman_lut
+{
+  const char          *syms[HUFFMAN_LUT_SYMS];
+  struct huffman_node *node;  ///< Position reached if no code completed
+  uint8_t              count; ///< Number of complete codes
+  uint8_t              bits;  ///< Bits consumed
+} huffman_lut_t;
+
 typedef struct huffman_node
 {
   struct huffman_node *b0;
   struct huffman_node *b1;
   char                *data;
+  huffman_lut_t       *lut;   ///< Root only
 } huffman_node_t;
 
 void huffman_tree_destroy ( huffman_node_t *tree );
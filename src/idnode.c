@@ -49,6 +49,7 @@ static TAILQ_HEAD(,idnode_save) idnodes_save;
 tvh_cond_t save_cond;
 pthread_t save_tid;
 static int save_running;
+static int idnode_gen;
 static mtimer_t save_timer;
 
 SKEL_DECLARE(idclasses_skel, idclass_link_t);
@@ -295,6 +296,8 @@ idnode_find_prop
 {
   const idclass_t *idc = self->in_class;
   const property_t *p;
+  if (!prop_index_find(idc, key, &p))
+    return p;
   while (idc) {
     if ((p = prop_find(idc->ic_properties, key))) return p;
     idc = idc->ic_super;
@@ -339,6 +342,163 @@ idnode_get_display
   return NULL;
 }
 
+/*
+ * Resolve property, remember the result for the last seen class
+ * (used by the sort and filter passes over many nodes)
+ */
+static inline const property_t *
+idnode_find_prop_cached
+  ( idnode_t *self, const char *key,
+    const idclass_t **idc, const property_t **p )
+{
+  if (*idc != self->in_class) {
+    *idc = self->in_class;
+    *p = idnode_find_prop(self, key);
+  }
+  return *p;
+}
+
+/*
+ * Get pointer to the field value
+ */
+static inline const void *
+idnode_prop_ptr
+  ( idnode_t *self, const property_t *p )
+{
+  if (p->islist)
+    return NULL;
+  if (p->get)
+    return p->get(self);
+  return ((void*)self) + p->off;
+}
+
+static const char *
+idnode_prop_get_str
+  ( idnode_t *self, const property_t *p )
+{
+  if (p && p->type == PT_STR)
+    return *(const char**)idnode_prop_ptr(self, p);
+  return NULL;
+}
+
+static int
+idnode_prop_get_u32
+  ( idnode_t *self, const property_t *p, uint32_t *u32 )
+{
+  const void *ptr;
+  if (p == NULL || (ptr = idnode_prop_ptr(self, p)) == NULL)
+    return 1;
+  switch (p->type) {
+    case PT_INT:
+    case PT_BOOL:
+      *u32 = *(int*)ptr;
+      return 0;
+    case PT_U16:
+      *u32 = *(uint16_t*)ptr;
+      return 0;
+    case PT_U32:
+      *u32 = *(uint32_t*)ptr;
+      return 0;
+    default:
+      break;
+  }
+  return 1;
+}
+
+static int
+idnode_prop_get_s64
+  ( idnode_t *self, const property_t *p, int64_t *s64 )
+{
+  const void *ptr;
+  if (p == NULL || (ptr = idnode_prop_ptr(self, p)) == NULL)
+    return 1;
+  switch (p->type) {
+    case PT_INT:
+    case PT_BOOL:
+      *s64 = *(int*)ptr;
+      return 0;
+    case PT_U16:
+      *s64 = *(uint16_t*)ptr;
+      return 0;
+    case PT_U32:
+      *s64 = *(uint32_t*)ptr;
+      return 0;
+    case PT_S64:
+      *s64 = *(int64_t*)ptr;
+      return 0;
+    case PT_DBL:
+      *s64 = *(double*)ptr;
+      return 0;
+    case PT_TIME:
+      *s64 = *(time_t*)ptr;
+      return 0;
+    default:
+      break;
+  }
+  return 1;
+}
+
+static int
+idnode_prop_get_s64_atomic
+  ( idnode_t *self, const property_t *p, int64_t *s64 )
+{
+  const void *ptr;
+  if (p == NULL || (ptr = idnode_prop_ptr(self, p)) == NULL)
+    return 1;
+  if (p->type == PT_S64_ATOMIC) {
+    *s64 = atomic_get_s64((int64_t*)ptr);
+    return 0;
+  }
+  return 1;
+}
+
+static int
+idnode_prop_get_dbl
+  ( idnode_t *self, const property_t *p, double *dbl )
+{
+  const void *ptr;
+  if (p == NULL || (ptr = idnode_prop_ptr(self, p)) == NULL)
+    return 1;
+  switch (p->type) {
+    case PT_INT:
+    case PT_BOOL:
+      *dbl = *(int*)ptr;
+      return 0;
+    case PT_U16:
+      *dbl = *(uint16_t*)ptr;
+      return 0;
+    case PT_U32:
+      *dbl = *(uint32_t*)ptr;
+      return 0;
+    case PT_S64:
+      *dbl = *(int64_t*)ptr;
+      return 0;
+    case PT_DBL:
+      *dbl = *(double *)ptr;
+      return 0;
+    case PT_TIME:
+      *dbl = *(time_t*)ptr;
+      return 0;
+    default:
+      break;
+  }
+  return 1;
+}
+
+static int
+idnode_prop_get_time
+  ( idnode_t *self, const property_t *p, time_t *tm )
+{
+  const void *ptr;
+  if (p == NULL || (ptr = idnode_prop_ptr(self, p)) == NULL)
+    return 1;
+  if (p->type == PT_TIME) {
+    *tm = *(time_t*)ptr;
+    return 0;
+  }
+  return 1;
+}
+
 /*
  * Get field as string
  */
@@ -346,17 +506,7 @@ const char *
 idnode_get_str
   ( idnode_t *self, const char *key )
 {
-  const property_t *p = idnode_find_prop(self, key);
-  if (p && p->type == PT_STR) {
-    const void *ptr;
-    if (p->get)
-      ptr = p->get(self);
-    else
-      ptr = ((void*)self) + p->off;
-    return *(const char**)ptr;
-  }
-
-  return NULL;
+  return idnode_prop_get_str(self, idnode_find_prop(self, key));
 }
 
 /*
@@ -366,31 +516,7 @@ int
 idnode_get_u32
   ( idnode_t *self, const char *key, uint32_t *u32 )
 {
-  const property_t *p = idnode_find_prop(self, key);
-  if (p) {
-    const void *ptr;
-    if (p->islist)
-      return 1;
-    else if (p->get)
-      ptr = p->get(self);
-    else
-      ptr = ((void*)self) + p->off;
-    switch (p->type) {
-      case PT_INT:
-      case PT_BOOL:
-        *u32 = *(int*)ptr;
-        return 0;
-      case PT_U16:
-        *u32 = *(uint16_t*)ptr;
-        return 0;
-      case PT_U32:
-        *u32 = *(uint32_t*)ptr;
-        return 0;
-      default:
-        break;
-    }
-  }
-  return 1;
+  return idnode_prop_get_u32(self, idnode_find_prop(self, key), u32);
 }
 
 /*
@@ -400,40 +526,7 @@ int
 idnode_get_s64
   ( idnode_t *self, const char *key, int64_t *s64 )
 {
-  const property_t *p = idnode_find_prop(self, key);
-  if (p) {
-    const void *ptr;
-    if (p->islist)
-      return 1;
-    else if (p->get)
-      ptr = p->get(self);
-    else
-      ptr = ((void*)self) + p->off;
-    switch (p->type) {
-      case PT_INT:
-      case PT_BOOL:
-        *s64 = *(int*)ptr;
-        return 0;
-      case PT_U16:
-        *s64 = *(uint16_t*)ptr;
-        return 0;
-      case PT_U32:
-        *s64 = *(uint32_t*)ptr;
-        return 0;
-      case PT_S64:
-        *s64 = *(int64_t*)ptr;
-        return 0;
-      case PT_DBL:
-        *s64 = *(double*)ptr;
-        return 0;
-      case PT_TIME:
-        *s64 = *(time_t*)ptr;
-        return 0;
-      default:
-        break;
-    }
-  }
-  return 1;
+  return idnode_prop_get_s64(self, idnode_find_prop(self, key), s64);
 }
 
 /*
@@ -443,24 +536,7 @@ int
 idnode_get_s64_atomic
   ( idnode_t *self, const char *key, int64_t *s64 )
 {
-  const property_t *p = idnode_find_prop(self, key);
-  if (p) {
-    const void *ptr;
-    if (p->islist)
-      return 1;
-    else if (p->get)
-      ptr = p->get(self);
-    else
-      ptr = ((void*)self) + p->off;
-    switch (p->type) {
-      case PT_S64_ATOMIC:
-        *s64 = atomic_get_s64((int64_t*)ptr);
-        return 0;
-      default:
-        break;
-    }
-  }
-  return 1;
+  return idnode_prop_get_s64_atomic(self, idnode_find_prop(self, key), s64);
 }
 
 /*
@@ -470,40 +546,7 @@ int
 idnode_get_dbl
   ( idnode_t *self, const char *key, double *dbl )
 {
-  const property_t *p = idnode_find_prop(self, key);
-  if (p) {
-    const void *ptr;
-    if (p->islist)
-      return 1;
-    else if (p->get)
-      ptr = p->get(self);
-    else
-      ptr = ((void*)self) + p->off;
-    switch (p->type) {
-      case PT_INT:
-      case PT_BOOL:
-        *dbl = *(int*)ptr;
-        return 0;
-      case PT_U16:
-        *dbl = *(uint16_t*)ptr;
-        return 0;
-      case PT_U32:
-        *dbl = *(uint32_t*)ptr;
-        return 0;
-      case PT_S64:
-        *dbl = *(int64_t*)ptr;
-        return 0;
-      case PT_DBL:
-        *dbl = *(double *)ptr;
-        return 0;
-      case PT_TIME:
-        *dbl = *(time_t*)ptr;
-        return 0;
-      default:
-        break;
-    }
-  }
-  return 1;
+  return idnode_prop_get_dbl(self, idnode_find_prop(self, key), dbl);
 }
 
 /*
@@ -540,24 +583,7 @@ int
 idnode_get_time
   ( idnode_t *self, const char *key, time_t *tm )
 {
-  const property_t *p = idnode_find_prop(self, key);
-  if (p) {
-    const void *ptr;
-    if (p->islist)
-      return 1;
-    if (p->get)
-      ptr = p->get(self);
-    else
-      ptr = ((void*)self) + p->off;
-    switch (p->type) {
-      case PT_TIME:
-        *tm = *(time_t*)ptr;
-        return 0;
-      default:
-        break;
-    }
-  }
-  return 1;
+  return idnode_prop_get_time(self, idnode_find_prop(self, key), tm);
 }
 
 /* **************************************************************************
@@ -689,110 +715,88 @@ idnode_cmp_title
 
 #define safecmp(a, b) ((a) > (b) ? 1 : ((a) < (b) ? -1 : 0))
 
-static int
-idnode_cmp_sort
-  ( const void *a, const void *b, void *s )
+/*
+ * Sort keys are extracted once per node (the property lookup, getters
+ * and display string rendering are too expensive to be repeated for
+ * every comparison), the comparison works with the typed values only
+ */
+typedef struct idnode_sort_key {
+  idnode_t *in;
+  enum {
+    ISK_NONE,
+    ISK_STR,
+    ISK_S64,
+    ISK_DBL
+  } type;
+  union {
+    char    *str;
+    int64_t  s64;
+    double   dbl;
+  } u;
+} idnode_sort_key_t;
+
+static void
+idnode_sort_key_get
+  ( idnode_sort_key_t *k, const property_t *p, const char *lang )
 {
-  idnode_t      *ina  = *(idnode_t**)a;
-  idnode_t      *inb  = *(idnode_t**)b;
-  idnode_sort_t *sort = s;
-  const property_t *p = idnode_find_prop(ina, sort->key);
-  if (!p) return 0;
+  idnode_t *in = k->in;
+
+  k->type = ISK_NONE;
+  if (p == NULL)
+    return;
 
   /* Get display string */
   if (p->islist || (p->list && !(p->opts & PO_SORTKEY))) {
-    int r;
-    char *stra = idnode_get_display(ina, p, sort->lang);
-    char *strb = idnode_get_display(inb, p, sort->lang);
-    if (sort->dir == IS_ASC)
-      r = strcmp(stra ?: "", strb ?: "");
-    else
-      r = strcmp(strb ?: "", stra ?: "");
-    free(stra);
-    free(strb);
-    return r;
+    k->type = ISK_STR;
+    k->u.str = idnode_get_display(in, p, lang);
+    return;
   }
 
   switch (p->type) {
     case PT_STR:
-      {
-        int r;
-        const char *stra = tvh_strdupa(idnode_get_str(ina, sort->key) ?: "");
-        const char *strb = idnode_get_str(inb, sort->key) ?: "";
-        if (sort->dir == IS_ASC)
-          r = strcmp(stra, strb);
-        else
-          r = strcmp(strb, stra);
-        return r;
-      }
+      k->type = ISK_STR;
+      k->u.str = strdup(idnode_prop_get_str(in, p) ?: "");
       break;
     case PT_INT:
     case PT_U16:
     case PT_BOOL:
     case PT_PERM:
       {
-        int32_t i32a = 0, i32b = 0;
-        idnode_get_u32(ina, sort->key, (uint32_t *)&i32a);
-        idnode_get_u32(inb, sort->key, (uint32_t *)&i32b);
-        if (sort->dir == IS_ASC)
-          return safecmp(i32a, i32b);
-        else
-          return safecmp(i32b, i32a);
+        int32_t i32 = 0;
+        idnode_prop_get_u32(in, p, (uint32_t *)&i32);
+        k->type = ISK_S64;
+        k->u.s64 = i32;
       }
       break;
     case PT_U32:
       {
-        uint32_t u32a = 0, u32b = 0;
-        idnode_get_u32(ina, sort->key, &u32a);
-        idnode_get_u32(inb, sort->key, &u32b);
-        if (sort->dir == IS_ASC)
-          return safecmp(u32a, u32b);
-        else
-          return safecmp(u32b, u32a);
+        uint32_t u32 = 0;
+        idnode_prop_get_u32(in, p, &u32);
+        k->type = ISK_S64;
+        k->u.s64 = u32;
       }
       break;
     case PT_S64:
-      {
-        int64_t s64a = 0, s64b = 0;
-        idnode_get_s64(ina, sort->key, &s64a);
-        idnode_get_s64(inb, sort->key, &s64b);
-        if (sort->dir == IS_ASC)
-          return safecmp(s64a, s64b);
-        else
-          return safecmp(s64b, s64a);
-      }
+      k->type = ISK_S64;
+      k->u.s64 = 0;
+      idnode_prop_get_s64(in, p, &k->u.s64);
       break;
     case PT_S64_ATOMIC:
-      {
-        int64_t s64a = 0, s64b = 0;
-        idnode_get_s64_atomic(ina, sort->key, &s64a);
-        idnode_get_s64_atomic(inb, sort->key, &s64b);
-        if (sort->dir == IS_ASC)
-          return safecmp(s64a, s64b);
-        else
-          return safecmp(s64b, s64a);
-      }
+      k->type = ISK_S64;
+      k->u.s64 = 0;
+      idnode_prop_get_s64_atomic(in, p, &k->u.s64);
       break;
     case PT_DBL:
-      {
-        double dbla = 0, dblb = 0;
-        idnode_get_dbl(ina, sort->key, &dbla);
-        idnode_get_dbl(inb, sort->key, &dblb);
-        if (sort->dir == IS_ASC)
-          return safecmp(dbla, dblb);
-        else
-          return safecmp(dblb, dbla);
-      }
+      k->type = ISK_DBL;
+      k->u.dbl = 0;
+      idnode_prop_get_dbl(in, p, &k->u.dbl);
       break;
     case PT_TIME:
       {
-        time_t ta = 0, tb = 0;
-        idnode_get_time(ina, sort->key, &ta);
-        idnode_get_time(inb, sort->key, &tb);
-        if (sort->dir == IS_ASC)
-          return safecmp(ta, tb);
-        else
-          return safecmp(tb, ta);
+        time_t t = 0;
+        idnode_prop_get_time(in, p, &t);
+        k->type = ISK_S64;
+        k->u.s64 = t;
       }
       break;
     case PT_LANGSTR:
@@ -800,6 +804,32 @@ idnode_cmp_sort
     case PT_NONE:
       break;
   }
+}
+
+static int
+idnode_cmp_sort
+  ( const void *a, const void *b, void *s )
+{
+  const idnode_sort_key_t *ka = a;
+  const idnode_sort_key_t *kb = b;
+  idnode_sort_t *sort = s;
+
+  if (sort->dir == IS_DSC) {
+    ka = b;
+    kb = a;
+  }
+  if (ka->type != kb->type)
+    return safecmp(ka->type, kb->type);
+  switch (ka->type) {
+    case ISK_STR:
+      return strcmp(ka->u.str ?: "", kb->u.str ?: "");
+    case ISK_S64:
+      return safecmp(ka->u.s64, kb->u.s64);
+    case ISK_DBL:
+      return safecmp(ka->u.dbl, kb->u.dbl);
+    case ISK_NONE:
+      break;
+  }
   return 0;
 }
 
@@ -833,17 +863,19 @@ idnode_filter
   ( idnode_t *in, idnode_filter_t *filter, const char *lang )
 {
   idnode_filter_ele_t *f;
+  const property_t *p;
   
   LIST_FOREACH(f, filter, link) {
     if (!f->checked)
       idnode_filter_init(in, filter);
+    p = idnode_find_prop_cached(in, f->key, &f->cls, &f->prop);
     if (f->type == IF_STR) {
       const char *str;
       char *strdisp;
       int r = 1;
-      str = strdisp = idnode_get_display(in, idnode_find_prop(in, f->key), lang);
+      str = strdisp = idnode_get_display(in, p, lang);
       if (!str)
-        if (!(str = idnode_get_str(in, f->key)))
+        if (!(str = idnode_prop_get_str(in, p)))
           return 1;
       switch(f->comp) {
         case IC_IN: r = strstr(str, f->u.s) == NULL; break;
@@ -858,7 +890,7 @@ idnode_filter
         return r;
     } else if (f->type == IF_NUM || f->type == IF_BOOL) {
       int64_t a, b;
-      if (idnode_get_s64(in, f->key, &a))
+      if (idnode_prop_get_s64(in, p, &a))
         return 1;
       b = (f->type == IF_NUM) ? f->u.n.n : f->u.b;
       switch (f->comp) {
@@ -880,7 +912,7 @@ idnode_filter
       }
     } else if (f->type == IF_DBL) {
       double a, b;
-      if (idnode_get_dbl(in, f->key, &a))
+      if (idnode_prop_get_dbl(in, p, &a))
         return 1;
       b = f->u.dbl;
       switch (f->comp) {
@@ -1056,7 +1088,27 @@ void
 idnode_set_sort
   ( idnode_set_t *is, idnode_sort_t *sort )
 {
-  tvh_qsort_r(is->is_array, is->is_count, sizeof(idnode_t*), idnode_cmp_sort, (void*)sort);
+  idnode_sort_key_t *keys;
+  const idclass_t *idc = NULL;
+  const property_t *p = NULL;
+  size_t i;
+
+  if (is->is_count < 2)
+    return;
+  keys = malloc(is->is_count * sizeof(*keys));
+  for (i = 0; i < is->is_count; i++) {
+    keys[i].in = is->is_array[i];
+    idnode_sort_key_get(&keys[i],
+                        idnode_find_prop_cached(keys[i].in, sort->key, &idc, &p),
+                        sort->lang);
+  }
+  tvh_qsort_r(keys, is->is_count, sizeof(*keys), idnode_cmp_sort, (void*)sort);
+  for (i = 0; i < is->is_count; i++) {
+    is->is_array[i] = keys[i].in;
+    if (keys[i].type == ISK_STR)
+      free(keys[i].u.str);
+  }
+  free(keys);
 }
 
 void
@@ -1366,6 +1418,26 @@ idclass_root_register(const idclass_t *idc)
   tvhtrace("idnode", "register root class %s", idc->ic_class);
 }
 
+/*
+ * Hashed property lookups: one table with the inherited properties
+ * (for idnode_find_prop) and one for the class property array
+ * (for prop_find)
+ */
+static void
+idclass_index(const idclass_t *idc)
+{
+  const property_t *lists[32];
+  const idclass_t *c;
+  int count = 0;
+
+  if (idc->ic_properties)
+    prop_index_build(idc->ic_properties, &idc->ic_properties, 1);
+  for (c = idc; c && count < ARRAY_SIZE(lists); c = c->ic_super)
+    lists[count++] = c->ic_properties;
+  if (c == NULL)
+    prop_index_build(idc, lists, count);
+}
+
 void
 idclass_register(const idclass_t *idc)
 {
@@ -1380,6 +1452,7 @@ idclass_register(const idclass_t *idc)
     RB_INIT(&idclasses_skel->nodes); /* not used, but for sure */
     SKEL_USED(idclasses_skel);
     tvhtrace("idnode", "register class %s", idc->ic_class);
+    idclass_index(idc);
     prev = idc;
     idc = idc->ic_super;
   }
@@ -1845,6 +1918,8 @@ idnode_notify ( idnode_t *in, const char *action )
   char ubuf[UUID_HEX_SIZE];
   const char *uuid = idnode_uuid_as_str(in, ubuf);
 
+  atomic_add(&idnode_gen, 1);
+
   if (!tvheadend_is_running())
     return;
 
@@ -1859,6 +1934,16 @@ idnode_notify ( idnode_t *in, const char *action )
   }
 }
 
+/**
+ * Generation counter - incremented for each node creation, change
+ * and removal
+ */
+int
+idnode_generation ( void )
+{
+  return atomic_get(&idnode_gen);
+}
+
 void
 idnode_notify_changed (void *in)
 {
@@ -1894,6 +1979,13 @@ save_thread ( void *aux )
   while (atomic_get(&save_running)) {
     if ((ise = TAILQ_FIRST(&idnodes_save)) == NULL ||
         (ise->ise_reqtime + IDNODE_SAVE_DELAY > mclk())) {
+      /* End of the batch - commit */
+      if (hts_settings_dirty()) {
+        pthread_mutex_unlock(&global_lock);
+        hts_settings_sync();
+        pthread_mutex_lock(&global_lock);
+        continue;
+      }
       if (ise)
         mtimer_arm_abs(&save_timer, idnode_save_trigger_thread_cb, NULL,
                        ise->ise_reqtime + IDNODE_SAVE_DELAY);
@@ -1971,6 +2063,7 @@ idnode_done(void)
     free(il);
   }
   SKEL_FREE(idclasses_skel);
+  prop_index_done();
 }
 
 /******************************************************************************
@@ -164,6 +164,8 @@ typedef struct idnode_filter_ele
 
   int checked;
   char *key;                          ///< Filter key
+  const struct idclass *cls;          ///< Last resolved class
+  const property_t *prop;             ///< Property for cls
   enum {
     IF_STR,
     IF_NUM,
@@ -222,6 +224,7 @@ idnode_set_t *idnode_find_all(const idclass_t *idc, const idnodes_rb_t *nodes);
 void idnode_notify (idnode_t *in, const char *action);
 void idnode_notify_changed (void *in);
 void idnode_notify_title_changed (void *in, const char *lang);
+int  idnode_generation (void);
 
 void idclass_register ( const idclass_t *idc );
 const idclass_t *idclass_find ( const char *name );
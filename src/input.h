@@ -160,6 +160,7 @@ void tvh_input_instance_clear_stats ( tvh_input_instance_t *tii );
 #include "input/mpegts.h"
 #include "input/mpegts/mpegts_mux_sched.h"
 #include "input/mpegts/mpegts_network_scan.h"
+#include "input/mpegts/mpegts_prewarm.h"
 #if ENABLE_MPEGTS_DVB
 #include "input/mpegts/mpegts_dvb.h"
 #endif
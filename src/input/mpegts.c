@@ -76,6 +76,7 @@ mpegts_init ( int linuxdvb_mask, int nosatip, str_list_t *satip_client,
   /* Mux schedulers */
 #if ENABLE_MPEGTS
   mpegts_mux_sched_init();
+  mpegts_prewarm_init();
 #endif
 
 }
@@ -85,6 +86,7 @@ mpegts_done ( void )
 {
   tvhftrace("main", mpegts_network_scan_done);
   tvhftrace("main", mpegts_mux_sched_done);
+  tvhftrace("main", mpegts_prewarm_done);
 #if ENABLE_MPEGTS_DVB
   tvhftrace("main", dvb_network_done);
 #endif
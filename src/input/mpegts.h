@@ -509,6 +509,11 @@ struct mpegts_mux
   int   mm_pmt_ac3;
   int   mm_eit_tsid_nocheck;
 
+  /*
+   * EIT section cache (epggrab/module/eit.c), freed when the mux stops
+   */
+  void *mm_eit_cache;
+
   /*
    * TSDEBUG
    */
@@ -592,6 +597,7 @@ struct mpegts_service
    */
   sbuf_t s_tsbuf;
   int64_t s_tsbuf_last;
+  int s_tsbuf_key;
 
   /**
    * PCR drift compensation. This should really be per-packet.
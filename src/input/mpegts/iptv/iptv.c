@@ -25,6 +25,7 @@
 #include "channels.h"
 #include "bouquet.h"
 #include "packet.h"
+#include "config.h"
 
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -44,9 +45,34 @@
  * *************************************************************************/
 
 iptv_input_t   *iptv_input;
-tvhpoll_t      *iptv_poll;
-pthread_t       iptv_thread;
-pthread_mutex_t iptv_lock;
+
+/*
+ * The muxes are spread over a pool of input threads, each thread
+ * has own poll set and the mux is assigned to the least loaded one
+ */
+#define IPTV_THREADS_MAX 16
+#define IPTV_EVENTS      16
+
+typedef struct iptv_thread {
+  tvhpoll_t      *it_poll;
+  pthread_t       it_tid;
+  int             it_muxes;
+} iptv_thread_t;
+
+static iptv_thread_t  *iptv_threads;
+static int             iptv_threads_count;
+static pthread_mutex_t iptv_threads_lock;
+
+static void
+iptv_input_thread_release ( iptv_mux_t *im )
+{
+  if (im->im_thread < 0)
+    return;
+  pthread_mutex_lock(&iptv_threads_lock);
+  iptv_threads[im->im_thread].it_muxes--;
+  pthread_mutex_unlock(&iptv_threads_lock);
+  im->im_thread = -1;
+}
 
 /* **************************************************************************
  * IPTV handlers
@@ -347,17 +373,19 @@ iptv_input_start_mux ( mpegts_input_t *mi, mpegts_mux_instance_t *mmi, int weigh
   }
 
   /* Start */
-  pthread_mutex_lock(&iptv_lock);
+  pthread_mutex_lock(&im->im_lock);
   s = im->mm_iptv_url_raw;
   im->mm_iptv_url_raw = strdup(raw);
   im->mm_active = mmi; // Note: must set here else mux_started call
                        // will not realise we're ready to accept pid open calls
   ret = ih->start(im, raw, &url);
-  if (!ret)
+  if (!ret) {
     im->im_handler = ih;
-  else
+  } else {
     im->mm_active  = NULL;
-  pthread_mutex_unlock(&iptv_lock);
+    iptv_input_thread_release(im);
+  }
+  pthread_mutex_unlock(&im->im_lock);
 
   urlreset(&url);
   free(s);
@@ -369,7 +397,7 @@ iptv_input_stop_mux ( mpegts_input_t *mi, mpegts_mux_instance_t *mmi )
 {
   iptv_mux_t *im = (iptv_mux_t*)mmi->mmi_mux;
 
-  pthread_mutex_lock(&iptv_lock);
+  pthread_mutex_lock(&im->im_lock);
 
   mtimer_disarm(&im->im_pause_timer);
 
@@ -397,7 +425,9 @@ iptv_input_stop_mux ( mpegts_input_t *mi, mpegts_mux_instance_t *mmi )
   /* Clear bw limit */
   ((iptv_network_t *)im->mm_network)->in_bw_limited = 0;
 
-  pthread_mutex_unlock(&iptv_lock);
+  iptv_input_thread_release(im);
+
+  pthread_mutex_unlock(&im->im_lock);
 }
 
 static void
@@ -435,7 +465,7 @@ iptv_input_unpause ( void *aux )
 {
   iptv_mux_t *im = aux;
   int pause;
-  pthread_mutex_lock(&iptv_lock);
+  pthread_mutex_lock(&im->im_lock);
   if (iptv_input_pause_check(im)) {
     pause = 1;
   } else {
@@ -443,21 +473,39 @@ iptv_input_unpause ( void *aux )
     im->im_handler->pause(im, 0);
     pause = 0;
   }
-  pthread_mutex_unlock(&iptv_lock);
+  pthread_mutex_unlock(&im->im_lock);
   if (pause)
     mtimer_arm_rel(&im->im_pause_timer, iptv_input_unpause, im, sec2mono(1));
 }
 
+static void
+iptv_input_poll_rem ( tvhpoll_t *poll, iptv_mux_t *im )
+{
+  tvhpoll_event_t ev = { 0 };
+
+  ev.events   = TVHPOLL_IN;
+  ev.data.ptr = im;
+  if (im->mm_iptv_fd > 0) {
+    ev.fd = im->mm_iptv_fd;
+    tvhpoll_rem(poll, &ev, 1);
+  }
+  if (im->mm_iptv_fd2 > 0) {
+    ev.fd = im->mm_iptv_fd2;
+    tvhpoll_rem(poll, &ev, 1);
+  }
+}
+
 static void *
 iptv_input_thread ( void *aux )
 {
-  int nfds, r;
+  iptv_thread_t *it = aux;
+  int nfds, i, r;
   ssize_t n;
   iptv_mux_t *im;
-  tvhpoll_event_t ev;
+  tvhpoll_event_t ev[IPTV_EVENTS];
 
   while ( tvheadend_is_running() ) {
-    nfds = tvhpoll_wait(iptv_poll, &ev, 1, -1);
+    nfds = tvhpoll_wait(it->it_poll, ev, IPTV_EVENTS, -1);
     if ( nfds < 0 ) {
       if (tvheadend_is_running() && !ERRNO_AGAIN(errno)) {
         tvhlog(LOG_ERR, "iptv", "poll() error %s, sleeping 1 second",
@@ -465,39 +513,56 @@ iptv_input_thread ( void *aux )
         sleep(1);
       }
       continue;
-    } else if ( nfds == 0 ) {
-      continue;
     }
-    im = ev.data.ptr;
-    r  = 0;
-
-    pthread_mutex_lock(&iptv_lock);
-
-    /* Only when active */
-    if (im->mm_active) {
-      /* Get data */
-      if ((n = im->im_handler->read(im)) < 0) {
-        tvhlog(LOG_ERR, "iptv", "read() error %s", strerror(errno));
-        im->im_handler->stop(im);
-        break;
+    for (i = 0; i < nfds; i++) {
+      im = ev[i].data.ptr;
+      r  = 0;
+
+      pthread_mutex_lock(&im->im_lock);
+
+      /* Only when active */
+      if (im->mm_active) {
+        /* Get data */
+        if ((n = im->im_handler->read(im)) < 0) {
+          tvhlog(LOG_ERR, "iptv", "read() error %s", strerror(errno));
+          iptv_input_poll_rem(it->it_poll, im);
+        } else {
+          r = iptv_input_recv_packets(im, n);
+          if (r == 1)
+            im->im_handler->pause(im, 1);
+        }
       }
-      r = iptv_input_recv_packets(im, n);
-      if (r == 1)
-        im->im_handler->pause(im, 1);
-    }
 
-    pthread_mutex_unlock(&iptv_lock);
+      pthread_mutex_unlock(&im->im_lock);
 
-    if (r == 1) {
-      pthread_mutex_lock(&global_lock);
-      if (im->mm_active)
-        mtimer_arm_rel(&im->im_pause_timer, iptv_input_unpause, im, sec2mono(1));
-      pthread_mutex_unlock(&global_lock);
+      if (r == 1) {
+        pthread_mutex_lock(&global_lock);
+        if (im->mm_active)
+          mtimer_arm_rel(&im->im_pause_timer, iptv_input_unpause, im, sec2mono(1));
+        pthread_mutex_unlock(&global_lock);
+      }
     }
   }
   return NULL;
 }
 
+static tvhpoll_t *
+iptv_input_poll ( iptv_mux_t *im )
+{
+  int i, t;
+
+  if (im->im_thread < 0) {
+    pthread_mutex_lock(&iptv_threads_lock);
+    for (i = t = 0; i < iptv_threads_count; i++)
+      if (iptv_threads[i].it_muxes < iptv_threads[t].it_muxes)
+        t = i;
+    iptv_threads[t].it_muxes++;
+    pthread_mutex_unlock(&iptv_threads_lock);
+    im->im_thread = t;
+  }
+  return iptv_threads[im->im_thread].it_poll;
+}
+
 void
 iptv_input_pause_handler ( iptv_mux_t *im, int pause )
 {
@@ -507,9 +572,9 @@ iptv_input_pause_handler ( iptv_mux_t *im, int pause )
   ev.events   = TVHPOLL_IN;
   ev.data.ptr = im;
   if (pause)
-    tvhpoll_rem(iptv_poll, &ev, 1);
+    tvhpoll_rem(iptv_input_poll(im), &ev, 1);
   else
-    tvhpoll_add(iptv_poll, &ev, 1);
+    tvhpoll_add(iptv_input_poll(im), &ev, 1);
 }
 
 void
@@ -527,7 +592,7 @@ iptv_input_recv_flush ( iptv_mux_t *im )
 int
 iptv_input_recv_packets ( iptv_mux_t *im, ssize_t len )
 {
-  static time_t t1 = 0, t2;
+  time_t t1, t2;
   iptv_network_t *in = (iptv_network_t*)im->mm_network;
   mpegts_mux_instance_t *mmi;
   mpegts_pcr_t pcr;
@@ -536,19 +601,20 @@ iptv_input_recv_packets ( iptv_mux_t *im, ssize_t len )
   pcr.pcr_first = PTS_UNSET;
   pcr.pcr_last  = PTS_UNSET;
   pcr.pcr_pid   = im->im_pcr_pid;
-  in->in_bps += len * 8;
+  atomic_add(&in->in_bps, len * 8);
   time(&t2);
-  if (t2 != t1) {
+  t1 = atomic_get_time_t(&in->in_bps_time);
+  if (t2 != t1 && atomic_exchange_time_t(&in->in_bps_time, t2) == t1) {
     if (in->in_max_bandwidth &&
-        in->in_bps > in->in_max_bandwidth * 1024) {
+        atomic_exchange(&in->in_bps, 0) > in->in_max_bandwidth * 1024) {
       if (!in->in_bw_limited) {
         tvhinfo("iptv", "%s bandwidth limited exceeded",
                 idnode_get_title(&in->mn_id, NULL));
         in->in_bw_limited = 1;
       }
+    } else {
+      atomic_set(&in->in_bps, 0);
     }
-    in->in_bps = 0;
-    t1 = t2;
   }
 
   /* Pass on, but with timing */
@@ -592,6 +658,7 @@ int
 iptv_input_fd_started ( iptv_mux_t *im )
 {
   char buf[256];
+  tvhpoll_t *poll = iptv_input_poll(im);
   tvhpoll_event_t ev = { 0 };
 
   /* Setup poll */
@@ -601,7 +668,7 @@ iptv_input_fd_started ( iptv_mux_t *im )
     ev.data.ptr = im;
 
     /* Error? */
-    if (tvhpoll_add(iptv_poll, &ev, 1) == -1) {
+    if (tvhpoll_add(poll, &ev, 1) == -1) {
       mpegts_mux_nice_name((mpegts_mux_t*)im, buf, sizeof(buf));
       tvherror("iptv", "%s - failed to add to poll q", buf);
       close(im->mm_iptv_fd);
@@ -617,7 +684,7 @@ iptv_input_fd_started ( iptv_mux_t *im )
     ev.data.ptr = im;
 
     /* Error? */
-    if (tvhpoll_add(iptv_poll, &ev, 1) == -1) {
+    if (tvhpoll_add(poll, &ev, 1) == -1) {
       mpegts_mux_nice_name((mpegts_mux_t*)im, buf, sizeof(buf));
       tvherror("iptv", "%s - failed to add to poll q (2)", buf);
       close(im->mm_iptv_fd2);
@@ -760,6 +827,18 @@ const idclass_t iptv_network_class = {
       .def.i    = 15,
       .opts     = PO_ADVANCED
     },
+    {
+      .type     = PT_U32,
+      .id       = "hls_prefetch",
+      .name     = N_("HLS prefetch (segments)"),
+      .desc     = N_("The number of HLS segments downloaded in advance "
+                     "while the current segment is received. Zero "
+                     "disables the prefetch (the segments are fetched "
+                     "one by one)."),
+      .off      = offsetof(iptv_network_t, in_hls_prefetch),
+      .def.i    = 2,
+      .opts     = PO_ADVANCED
+    },
     {
       .type     = PT_STR,
       .id       = "icon_url",
@@ -923,6 +1002,7 @@ iptv_network_create0
   in->in_scan_create        = 1;
   in->in_priority           = 1;
   in->in_streaming_priority = 1;
+  in->in_hls_prefetch       = 2;
   if (idc == &iptv_auto_network_class)
     in->in_remove_args = strdup("ticket");
   if (!mpegts_network_create0((mpegts_network_t *)in, idc,
@@ -1038,6 +1118,8 @@ iptv_input_wizard_set( tvh_input_t *ti, htsmsg_t *conf, const char *lang )
 
 void iptv_init ( void )
 {
+  int i;
+
   /* Register handlers */
   iptv_http_init();
   iptv_udp_init();
@@ -1065,17 +1147,30 @@ void iptv_init ( void )
   /* Init Network */
   iptv_network_init();
 
-  /* Setup TS thread */
-  iptv_poll = tvhpoll_create(10);
-  pthread_mutex_init(&iptv_lock, NULL);
-  tvhthread_create(&iptv_thread, NULL, iptv_input_thread, NULL, "iptv");
+  /* Setup TS threads */
+  iptv_threads_count = config.iptv_threads;
+  if (iptv_threads_count <= 0)
+    iptv_threads_count = sysconf(_SC_NPROCESSORS_ONLN);
+  iptv_threads_count = MINMAX(iptv_threads_count, 1, IPTV_THREADS_MAX);
+  iptv_threads = calloc(iptv_threads_count, sizeof(iptv_thread_t));
+  pthread_mutex_init(&iptv_threads_lock, NULL);
+  for (i = 0; i < iptv_threads_count; i++) {
+    iptv_threads[i].it_poll = tvhpoll_create(10);
+    tvhthread_create(&iptv_threads[i].it_tid, NULL, iptv_input_thread,
+                     &iptv_threads[i], "iptv");
+  }
+  tvhdebug("iptv", "using %d input thread(s)", iptv_threads_count);
 }
 
 void iptv_done ( void )
 {
-  pthread_kill(iptv_thread, SIGTERM);
-  pthread_join(iptv_thread, NULL);
-  tvhpoll_destroy(iptv_poll);
+  int i;
+
+  for (i = 0; i < iptv_threads_count; i++) {
+    pthread_kill(iptv_threads[i].it_tid, SIGTERM);
+    pthread_join(iptv_threads[i].it_tid, NULL);
+    tvhpoll_destroy(iptv_threads[i].it_poll);
+  }
   pthread_mutex_lock(&global_lock);
   mpegts_network_unregister_builder(&iptv_auto_network_class);
   mpegts_network_unregister_builder(&iptv_network_class);
@@ -1084,6 +1179,8 @@ void iptv_done ( void )
   mpegts_input_stop_all((mpegts_input_t*)iptv_input);
   mpegts_input_delete((mpegts_input_t *)iptv_input, 0);
   pthread_mutex_unlock(&global_lock);
+  free(iptv_threads);
+  iptv_threads = NULL;
 }
 
 /******************************************************************************
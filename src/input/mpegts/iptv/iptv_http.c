@@ -28,6 +28,39 @@
 #error "Wrong openssl!"
 #endif
 
+/*
+ * HLS prefetch
+ *
+ * The media segments are downloaded by separate HTTP clients, up to
+ * 1 + in_hls_prefetch segments in parallel. The data of the first
+ * (oldest) segment are passed to the mux immediately, the data of the
+ * following segments are kept in memory until the segment becomes the
+ * first one. The clients are created and closed from the timer callback,
+ * because httpc does not allow to close a client from the callbacks.
+ */
+#define HLS_PF_QUEUED   0
+#define HLS_PF_LOADING  1
+#define HLS_PF_DONE     2
+
+struct http_priv;
+
+typedef struct http_prefetch {
+  TAILQ_ENTRY(http_prefetch) link;
+  struct http_priv *hp;
+  http_client_t    *hc;
+  char             *url;
+  int64_t           seq;
+  int               state;
+  int               head;
+  sbuf_t            sb;
+  int               sb_off;
+  int64_t           start;
+  int64_t           first;
+  int64_t           last;
+  uint64_t          bytes;
+  int               closing;
+} http_prefetch_t;
+
 typedef struct http_priv {
   iptv_mux_t    *im;
   http_client_t *hc;
@@ -54,6 +87,21 @@ typedef struct http_priv {
     AES_KEY       key;
     unsigned char iv[AES_BLOCK_SIZE];
   } hls_aes128;
+  uint8_t        hls_pf_mode;
+  uint8_t        hls_pf_endlist;
+  uint8_t        hls_pf_hold;
+  uint8_t        hls_pf_m3u_busy;
+  uint8_t        hls_pf_unpause;
+  int            hls_pf_m3u_closing;
+  int64_t        hls_pf_seq;
+  int64_t        hls_pf_target;
+  int64_t        hls_pf_m3u_next;
+  http_client_t *hls_pf_m3u;
+  sbuf_t         hls_pf_m3u_sbuf;
+  http_client_t *hls_pf_pause;
+  mtimer_t       hls_pf_timer;
+  TAILQ_HEAD(, http_prefetch) hls_pf;
+  TAILQ_HEAD(, http_prefetch) hls_pf_done;
 } http_priv_t;
 
 /***/
@@ -61,16 +109,18 @@ typedef struct http_priv {
 static int iptv_http_complete_key ( http_client_t *hc );
 
 /*
- *
+ * Take global_lock from the http client callbacks, gives up when
+ * the mux stops or when the client is being closed (*closing set)
  */
 static int
-iptv_http_safe_global_lock( http_priv_t *hp )
+iptv_http_safe_global_lock( http_priv_t *hp, int *closing )
 {
   iptv_mux_t *im = hp->im;
   int r;
 
   while (1) {
-    if (im->mm_active == NULL || hp->shutdown)
+    if (im->mm_active == NULL || hp->shutdown ||
+        (closing && atomic_get(closing)))
       return 0;
     r = pthread_mutex_trylock(&global_lock);
     if (r == 0)
@@ -78,7 +128,8 @@ iptv_http_safe_global_lock( http_priv_t *hp )
     if (r != EBUSY)
       continue;
     sched_yield();
-    if (im->mm_active == NULL || hp->shutdown)
+    if (im->mm_active == NULL || hp->shutdown ||
+        (closing && atomic_get(closing)))
       return 0;
     r = pthread_mutex_trylock(&global_lock);
     if (r == 0)
@@ -247,7 +298,7 @@ iptv_http_header ( http_client_t *hc )
 
   hp->m3u_header = 0;
   hp->off = 0;
-  if (iptv_http_safe_global_lock(hp)) {
+  if (iptv_http_safe_global_lock(hp, NULL)) {
     if (!hp->started) {
       iptv_input_mux_started(hp->im);
     } else {
@@ -259,6 +310,45 @@ iptv_http_header ( http_client_t *hc )
   return 0;
 }
 
+/*
+ * Pass the received data (already appended to the mux buffer)
+ */
+static int
+iptv_http_process
+  ( http_priv_t *hp, void *buf, size_t len )
+{
+  iptv_mux_t *im = hp->im;
+  uint8_t tsbuf[188];
+  int rem;
+
+  tsdebug_write((mpegts_mux_t *)im, buf, len);
+  hp->off += len;
+
+  if (hp->hls_url && hp->off == 0 && len >= 2*188) {
+    free(hp->hls_si);
+    hp->hls_si = malloc(2*188);
+    memcpy(hp->hls_si, buf, 2*188);
+  }
+
+  if (hp->hls_last_si + sec2mono(1) <= mclk() && hp->hls_si) {
+    /* do rounding to start of the last MPEG-TS packet */
+    rem = 188 - (hp->off % 188);
+    if (im->mm_iptv_buffer.sb_ptr >= rem) {
+      im->mm_iptv_buffer.sb_ptr -= rem;
+      memcpy(tsbuf, im->mm_iptv_buffer.sb_data + im->mm_iptv_buffer.sb_ptr, rem);
+      sbuf_append(&im->mm_iptv_buffer, hp->hls_si, 2*188);
+      hp->hls_last_si = mclk();
+      sbuf_append(&im->mm_iptv_buffer, tsbuf, rem);
+      hp->off += rem;
+    }
+  }
+
+  if (len > 0)
+    if (iptv_input_recv_packets(im, len) == 1)
+      return 1;
+  return 0;
+}
+
 /*
  * Receive data
  */
@@ -269,7 +359,6 @@ iptv_http_data
   http_priv_t *hp = hc->hc_aux;
   iptv_mux_t *im;
   int pause = 0, off, rem;
-  uint8_t tsbuf[188];
 
   if (hp == NULL || hp->im == NULL || hc->hc_code != HTTP_STATUS_OK)
     return 0;
@@ -285,7 +374,7 @@ iptv_http_data
     return 0;
   }
 
-  pthread_mutex_lock(&iptv_lock);
+  pthread_mutex_lock(&im->im_lock);
 
   if (hp->hls_encrypted) {
     off = im->mm_iptv_buffer.sb_ptr;
@@ -305,8 +394,10 @@ iptv_http_data
     }
     memcpy(hp->hls_aes128.tmp + hp->hls_aes128.tmp_len, buf, len);
     hp->hls_aes128.tmp_len += len;
-    if (off == im->mm_iptv_buffer.sb_ptr)
+    if (off == im->mm_iptv_buffer.sb_ptr) {
+      pthread_mutex_unlock(&im->im_lock);
       return 0;
+    }
     buf = im->mm_iptv_buffer.sb_data + im->mm_iptv_buffer.sb_ptr;
     len = im->mm_iptv_buffer.sb_ptr - off;
     assert((len % 16) == 0);
@@ -314,42 +405,557 @@ iptv_http_data
   } else {
     sbuf_append(&im->mm_iptv_buffer, buf, len);
   }
-  tsdebug_write((mpegts_mux_t *)im, buf, len);
-  hp->off += len;
+  pause = iptv_http_process(hp, buf, len);
+  if (pause)
+    hc->hc_pause = 1;
 
-  if (hp->hls_url && hp->off == 0 && len >= 2*188) {
-    free(hp->hls_si);
-    hp->hls_si = malloc(2*188);
-    memcpy(hp->hls_si, buf, 2*188);
-  }
+  pthread_mutex_unlock(&im->im_lock);
 
-  if (hp->hls_last_si + sec2mono(1) <= mclk() && hp->hls_si) {
-    /* do rounding to start of the last MPEG-TS packet */
-    rem = 188 - (hp->off % 188);
-    if (im->mm_iptv_buffer.sb_ptr >= rem) {
-      im->mm_iptv_buffer.sb_ptr -= rem;
-      memcpy(tsbuf, im->mm_iptv_buffer.sb_data + im->mm_iptv_buffer.sb_ptr, rem);
-      sbuf_append(&im->mm_iptv_buffer, hp->hls_si, 2*188);
-      hp->hls_last_si = mclk();
-      sbuf_append(&im->mm_iptv_buffer, tsbuf, rem);
-      hp->off += rem;
-    }
+  if (pause && iptv_http_safe_global_lock(hp, NULL)) {
+    if (im->mm_active && !hp->shutdown)
+      mtimer_arm_rel(&im->im_pause_timer, iptv_input_unpause, im, sec2mono(1));
+    pthread_mutex_unlock(&global_lock);
   }
+  return 0;
+}
 
-  if (len > 0)
-    if (iptv_input_recv_packets(im, len) == 1)
-      pause = hc->hc_pause = 1;
+/*
+ * HLS prefetch - segment and playlist clients
+ */
+static void iptv_http_pf_timer ( void *aux );
 
-  pthread_mutex_unlock(&iptv_lock);
+/*
+ * The timer closes the clients with global_lock held and waits for
+ * their callbacks, so it sets *closing first and the callback leaves
+ * the unpause timer to it (hls_pf_unpause) instead of taking the lock
+ */
+static void
+iptv_http_pf_kick ( http_priv_t *hp, int kick, int pause, int *closing )
+{
+  iptv_mux_t *im = hp->im;
 
-  if (pause && iptv_http_safe_global_lock(hp)) {
-    if (im->mm_active && !hp->shutdown)
+  if (iptv_http_safe_global_lock(hp, closing)) {
+    if (kick)
+      mtimer_arm_rel(&hp->hls_pf_timer, iptv_http_pf_timer, hp, 0);
+    if (pause)
       mtimer_arm_rel(&im->im_pause_timer, iptv_input_unpause, im, sec2mono(1));
     pthread_mutex_unlock(&global_lock);
+  } else if (pause) {
+    pthread_mutex_lock(&im->im_lock);
+    hp->hls_pf_unpause = 1;
+    pthread_mutex_unlock(&im->im_lock);
+  }
+}
+
+static void
+iptv_http_pf_done ( http_priv_t *hp, http_prefetch_t *pf, int failed )
+{
+  iptv_mux_t *im = hp->im;
+  int64_t mono = getfastmonoclock(), d;
+  int v;
+
+  pf->state = HLS_PF_DONE;
+  if (failed) {
+    im->im_hls_errors++;
+    tvhwarn("iptv", "HLS - segment %"PRId64" failed (%s)", pf->seq, pf->url);
+    return;
+  }
+  im->im_hls_segments++;
+  if (pf->first) {
+    v = (pf->first - pf->start) / 1000;
+    im->im_hls_latency = im->im_hls_latency ? (im->im_hls_latency * 7 + v) / 8 : v;
+  }
+  d = mono - pf->start;
+  if (d > 0) {
+    v = pf->bytes * 8000 / d;
+    im->im_hls_bandwidth = im->im_hls_bandwidth ? (im->im_hls_bandwidth * 7 + v) / 8 : v;
+  }
+  tvhtrace("iptv", "HLS - segment %"PRId64" received, %"PRIu64" bytes, %"PRId64"ms",
+           pf->seq, pf->bytes, d / 1000);
+}
+
+/*
+ * Pass the segments from the head of the queue to the mux,
+ * returns 1 when the input was just paused (the unpause timer
+ * should be armed)
+ */
+static int
+iptv_http_pf_advance ( http_priv_t *hp )
+{
+  iptv_mux_t *im = hp->im;
+  http_prefetch_t *pf;
+  int len;
+
+  while ((pf = TAILQ_FIRST(&hp->hls_pf)) != NULL && pf->state != HLS_PF_QUEUED) {
+    if (hp->hls_pf_hold)
+      return 0;
+    if (!pf->head) {
+      pf->head = 1;
+      iptv_input_recv_flush(im);
+      hp->off = 0;
+    }
+    while (pf->sb_off < pf->sb.sb_ptr) {
+      len = MIN(pf->sb.sb_ptr - pf->sb_off, 64*188);
+      sbuf_append(&im->mm_iptv_buffer, pf->sb.sb_data + pf->sb_off, len);
+      pf->sb_off += len;
+      if (iptv_http_process(hp, pf->sb.sb_data + pf->sb_off - len, len)) {
+        hp->hls_pf_hold = 1;
+        return 1;
+      }
+    }
+    if (pf->state != HLS_PF_DONE)
+      break;
+    TAILQ_REMOVE(&hp->hls_pf, pf, link);
+    TAILQ_INSERT_TAIL(&hp->hls_pf_done, pf, link);
+  }
+  return 0;
+}
+
+static int
+iptv_http_pf_header ( http_client_t *hc )
+{
+  http_prefetch_t *pf = hc->hc_aux;
+  http_priv_t *hp;
+
+  if (pf == NULL || (hp = pf->hp) == NULL)
+    return 0;
+  pthread_mutex_lock(&hp->im->im_lock);
+  if (pf->first == 0)
+    pf->first = getfastmonoclock();
+  pthread_mutex_unlock(&hp->im->im_lock);
+  return 0;
+}
+
+static int
+iptv_http_pf_data ( http_client_t *hc, void *buf, size_t len )
+{
+  http_prefetch_t *pf = hc->hc_aux;
+  http_priv_t *hp;
+  iptv_mux_t *im;
+  int pause = 0;
+
+  if (pf == NULL || (hp = pf->hp) == NULL || hc->hc_code != HTTP_STATUS_OK)
+    return 0;
+  im = hp->im;
+  pthread_mutex_lock(&im->im_lock);
+  if (!hp->shutdown && pf->state == HLS_PF_LOADING) {
+    pf->bytes += len;
+    pf->last = getfastmonoclock();
+    if (pf->head && !hp->hls_pf_hold && pf->sb_off == pf->sb.sb_ptr) {
+      sbuf_append(&im->mm_iptv_buffer, buf, len);
+      if (iptv_http_process(hp, buf, len)) {
+        pause = hc->hc_pause = 1;
+        hp->hls_pf_pause = hc;
+      }
+    } else {
+      sbuf_append(&pf->sb, buf, len);
+    }
+  }
+  pthread_mutex_unlock(&im->im_lock);
+  if (pause)
+    iptv_http_pf_kick(hp, 0, 1, &pf->closing);
+  return 0;
+}
+
+/*
+ * Called with im_lock held, returns 1 when the timer should be kicked,
+ * *pause is set when the unpause timer should be armed
+ */
+static int
+iptv_http_pf_finish0 ( http_priv_t *hp, http_prefetch_t *pf, int failed, int *pause )
+{
+  if (hp->shutdown || pf->state != HLS_PF_LOADING)
+    return 0;
+  iptv_http_pf_done(hp, pf, failed);
+  *pause |= iptv_http_pf_advance(hp);
+  return 1;
+}
+
+static void
+iptv_http_pf_finish ( http_prefetch_t *pf, int failed )
+{
+  http_priv_t *hp;
+  int pause = 0, kick;
+
+  if (pf == NULL || (hp = pf->hp) == NULL)
+    return;
+  pthread_mutex_lock(&hp->im->im_lock);
+  kick = iptv_http_pf_finish0(hp, pf, failed, &pause);
+  pthread_mutex_unlock(&hp->im->im_lock);
+  if (kick)
+    iptv_http_pf_kick(hp, 1, pause, &pf->closing);
+}
+
+static int
+iptv_http_pf_complete ( http_client_t *hc )
+{
+  if (hc->hc_code == HTTP_STATUS_MOVED ||
+      hc->hc_code == HTTP_STATUS_FOUND ||
+      hc->hc_code == HTTP_STATUS_SEE_OTHER ||
+      hc->hc_code == HTTP_STATUS_NOT_MODIFIED)
+    return 0; /* redirect */
+  iptv_http_pf_finish(hc->hc_aux, hc->hc_code != HTTP_STATUS_OK);
+  return 0;
+}
+
+static void
+iptv_http_pf_closed ( http_client_t *hc, int err )
+{
+  iptv_http_pf_finish(hc->hc_aux, 1);
+}
+
+static void
+iptv_http_pf_create_header
+  ( http_client_t *hc, http_arg_list_t *h, const url_t *url, int keepalive )
+{
+  http_prefetch_t *pf = hc->hc_aux;
+
+  http_client_basic_args(hc, h, url, keepalive);
+  if (pf && pf->hp)
+    http_client_add_args(hc, h, pf->hp->im->mm_iptv_hdr);
+}
+
+static void
+iptv_http_pf_m3u_create_header
+  ( http_client_t *hc, http_arg_list_t *h, const url_t *url, int keepalive )
+{
+  http_priv_t *hp = hc->hc_aux;
+
+  http_client_basic_args(hc, h, url, keepalive);
+  if (hp)
+    http_client_add_args(hc, h, hp->im->mm_iptv_hdr);
+}
+
+static http_client_t *
+iptv_http_pf_connect
+  ( void *aux, const char *raw,
+    void (*hdr_create)(http_client_t *, http_arg_list_t *, const url_t *, int),
+    int (*hdr_received)(http_client_t *),
+    int (*data_received)(http_client_t *, void *, size_t),
+    int (*data_complete)(http_client_t *),
+    void (*conn_closed)(http_client_t *, int) )
+{
+  http_client_t *hc = NULL;
+  url_t u;
+
+  urlinit(&u);
+  if (urlparse(raw, &u)) {
+    tvherror("iptv", "HLS - invalid url '%s'", raw);
+    goto end;
   }
+  hc = http_client_connect(aux, HTTP_VERSION_1_1, u.scheme, u.host, u.port, NULL);
+  if (hc == NULL)
+    goto end;
+  hc->hc_hdr_create      = hdr_create;
+  hc->hc_hdr_received    = hdr_received;
+  hc->hc_data_received   = data_received;
+  hc->hc_data_complete   = data_complete;
+  hc->hc_conn_closed     = conn_closed;
+  hc->hc_handle_location = 1;
+  hc->hc_io_size         = 128*1024;
+  http_client_register(hc);
+  if (http_client_simple(hc, &u) < 0) {
+    http_client_close(hc);
+    hc = NULL;
+  }
+end:
+  urlreset(&u);
+  return hc;
+}
+
+/*
+ * Add the new segments from the media playlist to the queue
+ */
+static void
+iptv_http_pf_queue ( http_priv_t *hp, htsmsg_t *m )
+{
+  htsmsg_t *items, *item;
+  htsmsg_field_t *f;
+  http_prefetch_t *pf;
+  int64_t seq, d;
+  const char *s;
+  int count = 0;
+
+  seq = htsmsg_get_s64_or_default(m, "media-sequence", 0);
+  d = htsmsg_get_s64_or_default(m, "targetduration", 0);
+  if (d > 0)
+    hp->hls_pf_target = sec2mono(d);
+  if (htsmsg_get_bool_or_default(m, "x-endlist", 0))
+    hp->hls_pf_endlist = 1;
+  if ((items = htsmsg_get_list(m, "items")) == NULL)
+    return;
+  HTSMSG_FOREACH(f, items)
+    count++;
+  if (seq > hp->hls_pf_seq) {
+    tvhwarn("iptv", "HLS - %"PRId64" segment(s) skipped", seq - hp->hls_pf_seq);
+    hp->hls_pf_seq = seq;
+  } else if (seq + 2 * count < hp->hls_pf_seq) {
+    tvhwarn("iptv", "HLS - media sequence restarted");
+    hp->hls_pf_seq = seq;
+  }
+  count = 0;
+  HTSMSG_FOREACH(f, items) {
+    if (seq++ < hp->hls_pf_seq) continue;
+    if ((item = htsmsg_field_get_map(f)) == NULL) continue;
+    s = htsmsg_get_str(item, "m3u-url");
+    if (s == NULL || s[0] == '\0') continue;
+    pf = calloc(1, sizeof(*pf));
+    pf->hp = hp;
+    pf->url = strdup(s);
+    pf->seq = seq - 1;
+    sbuf_init(&pf->sb);
+    TAILQ_INSERT_TAIL(&hp->hls_pf, pf, link);
+    hp->hls_pf_seq = seq;
+    count++;
+  }
+  hp->hls_pf_m3u_next = mclk() + (count ? hp->hls_pf_target : hp->hls_pf_target / 2);
+}
+
+static int
+iptv_http_pf_m3u_data ( http_client_t *hc, void *buf, size_t len )
+{
+  http_priv_t *hp = hc->hc_aux;
+
+  if (hp == NULL || hc->hc_code != HTTP_STATUS_OK)
+    return 0;
+  pthread_mutex_lock(&hp->im->im_lock);
+  if (hp->hls_pf_m3u_sbuf.sb_ptr + len < 1024*1024)
+    sbuf_append(&hp->hls_pf_m3u_sbuf, buf, len);
+  pthread_mutex_unlock(&hp->im->im_lock);
   return 0;
 }
 
+/*
+ * Called with im_lock held, returns 1 when the timer should be kicked
+ */
+static int
+iptv_http_pf_m3u_finish0 ( http_priv_t *hp, int failed )
+{
+  htsmsg_t *m;
+
+  if (hp->shutdown || !hp->hls_pf_m3u_busy)
+    return 0;
+  hp->hls_pf_m3u_busy = 0;
+  if (failed) {
+    tvhwarn("iptv", "HLS - playlist update failed");
+    hp->hls_pf_m3u_next = mclk() + sec2mono(1);
+  } else {
+    sbuf_append(&hp->hls_pf_m3u_sbuf, "", 1);
+    m = parse_m3u((char *)hp->hls_pf_m3u_sbuf.sb_data, NULL, hp->hls_url);
+    iptv_http_pf_queue(hp, m);
+    htsmsg_destroy(m);
+  }
+  sbuf_free(&hp->hls_pf_m3u_sbuf);
+  return 1;
+}
+
+static void
+iptv_http_pf_m3u_finish ( http_priv_t *hp, int failed )
+{
+  int kick;
+
+  if (hp == NULL)
+    return;
+  pthread_mutex_lock(&hp->im->im_lock);
+  kick = iptv_http_pf_m3u_finish0(hp, failed);
+  pthread_mutex_unlock(&hp->im->im_lock);
+  if (kick)
+    iptv_http_pf_kick(hp, 1, 0, &hp->hls_pf_m3u_closing);
+}
+
+static int
+iptv_http_pf_m3u_complete ( http_client_t *hc )
+{
+  if (hc->hc_code == HTTP_STATUS_MOVED ||
+      hc->hc_code == HTTP_STATUS_FOUND ||
+      hc->hc_code == HTTP_STATUS_SEE_OTHER ||
+      hc->hc_code == HTTP_STATUS_NOT_MODIFIED)
+    return 0; /* redirect */
+  iptv_http_pf_m3u_finish(hc->hc_aux, hc->hc_code != HTTP_STATUS_OK);
+  return 0;
+}
+
+static void
+iptv_http_pf_m3u_closed ( http_client_t *hc, int err )
+{
+  iptv_http_pf_m3u_finish(hc->hc_aux, 1);
+}
+
+static void
+iptv_http_pf_free ( http_prefetch_t *pf )
+{
+  sbuf_free(&pf->sb);
+  free(pf->url);
+  free(pf);
+}
+
+/*
+ * Maintain the download window and the playlist updates,
+ * called with global_lock held
+ */
+static void
+iptv_http_pf_timer ( void *aux )
+{
+  http_priv_t *hp = aux;
+  iptv_mux_t *im = hp->im;
+  iptv_network_t *in = (iptv_network_t *)im->mm_network;
+  http_prefetch_t *pf, *start[16];
+  TAILQ_HEAD(, http_prefetch) done;
+  http_client_t *m3u_old = NULL, *hc;
+  int64_t mono = getfastmonoclock(), tmo;
+  int i, n = 0, depth, fetch_m3u = 0, pause = 0;
+
+  pthread_mutex_lock(&im->im_lock);
+  if (hp->shutdown) {
+    pthread_mutex_unlock(&im->im_lock);
+    return;
+  }
+
+  /* abort the stalled downloads */
+  tmo = hp->hls_pf_target * 2 + sec2mono(5);
+  TAILQ_FOREACH(pf, &hp->hls_pf, link)
+    if (pf->state == HLS_PF_LOADING && pf->hc != hp->hls_pf_pause &&
+        MAX(pf->start, pf->last) + tmo < mono)
+      iptv_http_pf_done(hp, pf, 1);
+  pause = iptv_http_pf_advance(hp);
+
+  /* the delivered segments */
+  TAILQ_MOVE(&done, &hp->hls_pf_done, link);
+  TAILQ_FOREACH(pf, &done, link) {
+    atomic_set(&pf->closing, 1);
+    if (pf->hc && pf->hc == hp->hls_pf_pause)
+      hp->hls_pf_pause = NULL;
+  }
+
+  /* start the downloads in the window */
+  depth = MIN(1 + in->in_hls_prefetch, ARRAY_SIZE(start));
+  i = 0;
+  TAILQ_FOREACH(pf, &hp->hls_pf, link) {
+    if (i++ >= depth)
+      break;
+    if (pf->state == HLS_PF_QUEUED) {
+      pf->state = HLS_PF_LOADING;
+      pf->start = mono;
+      start[n++] = pf;
+    }
+  }
+
+  /* playlist update */
+  if (!hp->hls_pf_m3u_busy && !hp->hls_pf_endlist &&
+      mclk() >= hp->hls_pf_m3u_next) {
+    hp->hls_pf_m3u_busy = 1;
+    m3u_old = hp->hls_pf_m3u;
+    hp->hls_pf_m3u = NULL;
+    atomic_set(&hp->hls_pf_m3u_closing, 1);
+    sbuf_reset(&hp->hls_pf_m3u_sbuf, 8192);
+    fetch_m3u = 1;
+  }
+  pthread_mutex_unlock(&im->im_lock);
+
+  while ((pf = TAILQ_FIRST(&done)) != NULL) {
+    TAILQ_REMOVE(&done, pf, link);
+    http_client_close(pf->hc);
+    iptv_http_pf_free(pf);
+  }
+  if (fetch_m3u) {
+    http_client_close(m3u_old);
+    atomic_set(&hp->hls_pf_m3u_closing, 0);
+  }
+
+  for (i = 0; i < n; i++) {
+    pf = start[i];
+    tvhtrace("iptv", "HLS - fetch segment %"PRId64" (%s)", pf->seq, pf->url);
+    pf->hc = iptv_http_pf_connect(pf, pf->url,
+                                  iptv_http_pf_create_header,
+                                  iptv_http_pf_header,
+                                  iptv_http_pf_data,
+                                  iptv_http_pf_complete,
+                                  iptv_http_pf_closed);
+    if (pf->hc == NULL) {
+      /* global_lock is held - the timer is re-armed below (no kick) */
+      pthread_mutex_lock(&im->im_lock);
+      iptv_http_pf_finish0(hp, pf, 1, &pause);
+      pthread_mutex_unlock(&im->im_lock);
+    }
+  }
+
+  if (fetch_m3u) {
+    hc = iptv_http_pf_connect(hp, hp->hls_url,
+                              iptv_http_pf_m3u_create_header,
+                              NULL,
+                              iptv_http_pf_m3u_data,
+                              iptv_http_pf_m3u_complete,
+                              iptv_http_pf_m3u_closed);
+    pthread_mutex_lock(&im->im_lock);
+    hp->hls_pf_m3u = hc;
+    if (hc == NULL)
+      iptv_http_pf_m3u_finish0(hp, 1);
+    pthread_mutex_unlock(&im->im_lock);
+  }
+
+  /* the unpause requests of the callbacks of the closed clients */
+  pthread_mutex_lock(&im->im_lock);
+  if (hp->hls_pf_unpause) {
+    hp->hls_pf_unpause = 0;
+    pause = 1;
+  }
+  pthread_mutex_unlock(&im->im_lock);
+
+  if (pause)
+    mtimer_arm_rel(&im->im_pause_timer, iptv_input_unpause, im, sec2mono(1));
+  mtimer_arm_rel(&hp->hls_pf_timer, iptv_http_pf_timer, hp,
+                 MINMAX(hp->hls_pf_target / 4, sec2mono(1) / 4, sec2mono(2)));
+}
+
+/*
+ * Switch to the prefetch mode for the plain media playlists
+ */
+static int
+iptv_http_pf_start ( http_client_t *hc, http_priv_t *hp, htsmsg_t *m )
+{
+  iptv_network_t *in = (iptv_network_t *)hp->im->mm_network;
+  htsmsg_t *items, *item, *key;
+  htsmsg_field_t *f;
+
+  if (in->in_hls_prefetch == 0 || hp->hls_pf_mode)
+    return 0;
+  if ((items = htsmsg_get_list(m, "items")) == NULL || htsmsg_is_empty(items))
+    return 0;
+  HTSMSG_FOREACH(f, items) {
+    if ((item = htsmsg_field_get_map(f)) == NULL) continue;
+    if (htsmsg_get_map(item, "stream-inf"))
+      return 0;
+    key = htsmsg_get_map(item, "x-key");
+    if (key && strcmp(htsmsg_get_str(key, "METHOD") ?: "NONE", "NONE"))
+      return 0;
+  }
+
+  if (hp->hls_url == NULL) {
+    if (hc->hc_url == NULL)
+      return 0;
+    hp->hls_url = strdup(hc->hc_url);
+  }
+  tvhdebug("iptv", "HLS - prefetch %u segment(s) for %s",
+           in->in_hls_prefetch, hp->hls_url);
+
+  pthread_mutex_lock(&hp->im->im_lock);
+  hp->hls_pf_mode = 1;
+  hp->hls_pf_target = sec2mono(2);
+  hp->hls_pf_seq = htsmsg_get_s64_or_default(m, "media-sequence", 0);
+  iptv_http_pf_queue(hp, m);
+  pthread_mutex_unlock(&hp->im->im_lock);
+
+  if (iptv_http_safe_global_lock(hp, NULL)) {
+    if (!hp->started) {
+      iptv_input_mux_started(hp->im);
+      hp->started = 1;
+    }
+    mtimer_arm_rel(&hp->hls_pf_timer, iptv_http_pf_timer, hp, 0);
+    pthread_mutex_unlock(&global_lock);
+  }
+  return 1;
+}
+
 /*
  * Complete data
  */
@@ -395,6 +1001,10 @@ iptv_http_complete
     }
     m = parse_m3u((char *)hp->m3u_sbuf.sb_data, NULL, hp->host_url);
     sbuf_free(&hp->m3u_sbuf);
+    if (iptv_http_pf_start(hc, hp, m)) {
+      htsmsg_destroy(m);
+      return 0;
+    }
 url:
     url = iptv_http_get_url(hp, m);
     if (hp->hls_m3u == m)
@@ -529,6 +1139,9 @@ iptv_http_start
   im->im_data = hp;
   sbuf_init(&hp->m3u_sbuf);
   sbuf_init(&hp->key_sbuf);
+  sbuf_init(&hp->hls_pf_m3u_sbuf);
+  TAILQ_INIT(&hp->hls_pf);
+  TAILQ_INIT(&hp->hls_pf_done);
   sbuf_init_fixed(&im->mm_iptv_buffer, IPTV_BUF_SIZE);
   http_client_register(hc);          /* register to the HTTP thread */
   r = http_client_simple(hc, u);
@@ -550,15 +1163,33 @@ iptv_http_stop
   ( iptv_mux_t *im )
 {
   http_priv_t *hp = im->im_data;
+  http_prefetch_t *pf;
 
+  mtimer_disarm(&hp->hls_pf_timer);
   hp->hc->hc_aux = NULL;
   hp->shutdown = 1;
-  pthread_mutex_unlock(&iptv_lock);
+  TAILQ_CONCAT(&hp->hls_pf_done, &hp->hls_pf, link);
+  if (hp->hls_pf_m3u)
+    hp->hls_pf_m3u->hc_aux = NULL;
+  TAILQ_FOREACH(pf, &hp->hls_pf_done, link) {
+    pf->hp = NULL;
+    if (pf->hc)
+      pf->hc->hc_aux = NULL;
+  }
+  pthread_mutex_unlock(&im->im_lock);
   http_client_close(hp->hc);
-  pthread_mutex_lock(&iptv_lock);
+  http_client_close(hp->hls_pf_m3u);
+  TAILQ_FOREACH(pf, &hp->hls_pf_done, link)
+    http_client_close(pf->hc);
+  pthread_mutex_lock(&im->im_lock);
+  while ((pf = TAILQ_FIRST(&hp->hls_pf_done)) != NULL) {
+    TAILQ_REMOVE(&hp->hls_pf_done, pf, link);
+    iptv_http_pf_free(pf);
+  }
   im->im_data = NULL;
   sbuf_free(&hp->m3u_sbuf);
   sbuf_free(&hp->key_sbuf);
+  sbuf_free(&hp->hls_pf_m3u_sbuf);
   htsmsg_destroy(hp->hls_m3u);
   htsmsg_destroy(hp->hls_key);
   free(hp->hls_url);
@@ -580,6 +1211,16 @@ iptv_http_pause
   http_priv_t *hp = im->im_data;
 
   assert(pause == 0);
+  if (hp->hls_pf_mode) {
+    if (hp->hls_pf_pause) {
+      http_client_unpause(hp->hls_pf_pause);
+      hp->hls_pf_pause = NULL;
+    }
+    hp->hls_pf_hold = 0;
+    if (iptv_http_pf_advance(hp))
+      mtimer_arm_rel(&im->im_pause_timer, iptv_input_unpause, im, sec2mono(1));
+    return;
+  }
   http_client_unpause(hp->hc);
 }
 
@@ -257,6 +257,39 @@ const idclass_t iptv_mux_class =
       .off      = offsetof(iptv_mux_t, mm_iptv_buffer_limit),
       .opts     = PO_ADVANCED,
     },
+    {
+      .type     = PT_INT,
+      .id       = "hls_latency",
+      .name     = N_("HLS latency (ms)"),
+      .desc     = N_("The average time to receive the response for "
+                     "the HLS segment requests."),
+      .off      = offsetof(iptv_mux_t, im_hls_latency),
+      .opts     = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+    },
+    {
+      .type     = PT_INT,
+      .id       = "hls_bandwidth",
+      .name     = N_("HLS bandwidth (kbit/s)"),
+      .desc     = N_("The average download rate of the HLS segments."),
+      .off      = offsetof(iptv_mux_t, im_hls_bandwidth),
+      .opts     = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+    },
+    {
+      .type     = PT_U32,
+      .id       = "hls_segments",
+      .name     = N_("HLS segments"),
+      .desc     = N_("The number of the received HLS segments."),
+      .off      = offsetof(iptv_mux_t, im_hls_segments),
+      .opts     = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+    },
+    {
+      .type     = PT_U32,
+      .id       = "hls_errors",
+      .name     = N_("HLS errors"),
+      .desc     = N_("The number of the failed HLS segment requests."),
+      .off      = offsetof(iptv_mux_t, im_hls_errors),
+      .opts     = PO_RDONLY | PO_NOSAVE | PO_EXPERT,
+    },
     {}
   }
 };
@@ -286,6 +319,10 @@ iptv_mux_delete ( mpegts_mux_t *mm, int delconf )
                         idnode_uuid_as_str(&mm->mm_network->mn_id, ubuf1),
                         idnode_uuid_as_str(&mm->mm_id, ubuf2));
 
+  /* the input threads are done with the mux once it is stopped */
+  mm->mm_stop(mm, 1, SM_CODE_ABORTED);
+  pthread_mutex_destroy(&im->im_lock);
+
   copy = *im; /* keep pointers */
   mpegts_mux_delete(mm, delconf);
   free(copy.mm_iptv_url);
@@ -340,6 +377,8 @@ iptv_mux_create0 ( iptv_network_t *in, const char *uuid, htsmsg_t *conf )
   if (!im->mm_iptv_kill_timeout)
     im->mm_iptv_kill_timeout = 5;
 
+  pthread_mutex_init(&im->im_lock, NULL);
+  im->im_thread = -1;
   sbuf_init(&im->mm_iptv_buffer);
 
   /* Create Instance */
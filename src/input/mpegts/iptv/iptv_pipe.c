@@ -128,9 +128,9 @@ iptv_pipe_read ( iptv_mux_t *im )
                  r < 0 ? strerror(errno) : "No data");
       } else {
         /* avoid deadlock here */
-        pthread_mutex_unlock(&iptv_lock);
+        pthread_mutex_unlock(&im->im_lock);
         pthread_mutex_lock(&global_lock);
-        pthread_mutex_lock(&iptv_lock);
+        pthread_mutex_lock(&im->im_lock);
         if (im->mm_active) {
           if (iptv_pipe_start(im, im->mm_iptv_url_raw, NULL)) {
             tvherror("iptv", "unable to respawn %s", im->mm_iptv_url_raw);
@@ -139,9 +139,9 @@ iptv_pipe_read ( iptv_mux_t *im )
             im->mm_iptv_respawn_last = mclk();
           }
         }
-        pthread_mutex_unlock(&iptv_lock);
+        pthread_mutex_unlock(&im->im_lock);
         pthread_mutex_unlock(&global_lock);
-        pthread_mutex_lock(&iptv_lock);
+        pthread_mutex_lock(&im->im_lock);
       }
       break;
     }
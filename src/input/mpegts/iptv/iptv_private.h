@@ -38,8 +38,6 @@
 
 struct bouquet;
 
-extern pthread_mutex_t iptv_lock;
-
 typedef struct iptv_input   iptv_input_t;
 typedef struct iptv_network iptv_network_t;
 typedef struct iptv_mux     iptv_mux_t;
@@ -78,6 +76,7 @@ struct iptv_network
   mpegts_network_t;
 
   int in_bps;
+  time_t in_bps_time;
   int in_bw_limited;
 
   int in_scan_create;
@@ -89,6 +88,7 @@ struct iptv_network
   uint32_t in_max_streams;
   uint32_t in_max_bandwidth;
   uint32_t in_max_timeout;
+  uint32_t in_hls_prefetch;
 
   char    *in_url;
   char    *in_url_sane;
@@ -146,8 +146,10 @@ struct iptv_mux
 
   uint32_t              mm_iptv_buffer_limit;
 
+  pthread_mutex_t       im_lock;
   iptv_handler_t       *im_handler;
   mtimer_t              im_pause_timer;
+  int                   im_thread;
 
   int64_t               im_pcr;
   int64_t               im_pcr_start;
@@ -156,6 +158,11 @@ struct iptv_mux
 
   void                 *im_data;
 
+  int                   im_hls_latency;   /* ms, average */
+  int                   im_hls_bandwidth; /* kbit/s, average */
+  uint32_t              im_hls_segments;
+  uint32_t              im_hls_errors;
+
   int                   im_delete_flag;
 };
 
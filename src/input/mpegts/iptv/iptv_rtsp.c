@@ -224,7 +224,7 @@ iptv_rtsp_stop
   rp->hc->hc_aux = NULL;
   if (play)
     rtsp_teardown(rp->hc, rp->path, "");
-  pthread_mutex_unlock(&iptv_lock);
+  pthread_mutex_unlock(&im->im_lock);
   mtimer_disarm(&rp->alive_timer);
   udp_multirecv_free(&rp->um);
   if (!play)
@@ -234,7 +234,7 @@ iptv_rtsp_stop
   rtcp_destroy(rp->rtcp_info);
   free(rp->rtcp_info);
   free(rp);
-  pthread_mutex_lock(&iptv_lock);
+  pthread_mutex_lock(&im->im_lock);
 }
 
 static void
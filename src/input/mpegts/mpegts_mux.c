@@ -705,6 +705,7 @@ mpegts_mux_delete ( mpegts_mux_t *mm, int delconf )
   free(mm->mm_provider_network_name);
   free(mm->mm_crid_authority);
   free(mm->mm_charset);
+  free(mm->mm_eit_cache);
   free(mm);
 }
 
@@ -802,6 +803,10 @@ mpegts_mux_stop ( mpegts_mux_t *mm, int force, int reason )
   /* Flush table data queue */
   mpegts_input_flush_mux(mi, mm);
 
+  /* The EIT section cache is rebuilt on the next tune */
+  free(mm->mm_eit_cache);
+  mm->mm_eit_cache = NULL;
+
   /* Ensure PIDs are cleared */
   pthread_mutex_lock(&mi->mi_output_lock);
   mm->mm_last_pid = -1;
@@ -0,0 +1,329 @@
+/*
+ *  Tvheadend - Predictive mux warm-up
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * The zapping history of the streaming clients is used to predict the
+ * next channels (the next one in the zapping direction and the last
+ * watched one). The muxes of these channels are kept tuned using low
+ * weight "prewarm" mux subscriptions on the idle inputs, so the channel
+ * change reuses the already running mux instance. Any real subscription
+ * overrides the prewarm subscriptions when it needs the input.
+ */
+
+#include "input.h"
+#include "channels.h"
+#include "streaming.h"
+#include "config.h"
+
+#define PREWARM_NAME        "prewarm"
+#define PREWARM_CLIENTS_MAX 32
+#define PREWARM_CANDIDATES  3
+
+typedef struct mpegts_prewarm_client {
+  LIST_ENTRY(mpegts_prewarm_client) mpc_link;
+  char   *mpc_key;
+  char    mpc_cur[UUID_HEX_SIZE];
+  char    mpc_prev[UUID_HEX_SIZE];
+  int     mpc_dir;
+  int64_t mpc_last;
+} mpegts_prewarm_client_t;
+
+static LIST_HEAD(, mpegts_prewarm_client) mpegts_prewarm_clients;
+static int mpegts_prewarm_clients_count;
+static mtimer_t mpegts_prewarm_timer;
+
+/******************************************************************************
+ * Prediction
+ *****************************************************************************/
+
+/* The neighbour channel by number (dir > 0 - up, dir < 0 - down) */
+static channel_t *
+mpegts_prewarm_neighbour ( channel_t *ch, int dir )
+{
+  channel_t *ch2, *res = NULL;
+  int64_t n, n2, best = 0;
+
+  if (ch == NULL || (n = channel_get_number(ch)) <= 0)
+    return NULL;
+  CHANNEL_FOREACH(ch2) {
+    if (ch2 == ch || !ch2->ch_enabled)
+      continue;
+    if ((n2 = channel_get_number(ch2)) <= 0)
+      continue;
+    if (dir > 0 ? n2 <= n : n2 >= n)
+      continue;
+    if (res == NULL || (dir > 0 ? n2 < best : n2 > best)) {
+      res = ch2;
+      best = n2;
+    }
+  }
+  return res;
+}
+
+/* The mux of the first usable service */
+static mpegts_mux_t *
+mpegts_prewarm_channel_mux ( channel_t *ch )
+{
+  idnode_list_mapping_t *ilm;
+  mpegts_service_t *s;
+  mpegts_mux_t *mm;
+
+  if (ch == NULL || !ch->ch_enabled)
+    return NULL;
+  LIST_FOREACH(ilm, &ch->ch_services, ilm_in2_link) {
+    s = (mpegts_service_t *)ilm->ilm_in1;
+    if (!idnode_is_instance(&s->s_id, &mpegts_service_class))
+      continue;
+    if (!s->s_enabled || (mm = s->s_dvb_mux) == NULL)
+      continue;
+    if (mm->mm_is_enabled(mm))
+      return mm;
+  }
+  return NULL;
+}
+
+static int
+mpegts_prewarm_candidates
+  ( mpegts_prewarm_client_t *mpc, channel_t **chs )
+{
+  channel_t *cur = channel_find_by_uuid(mpc->mpc_cur);
+  channel_t *prev = channel_find_by_uuid(mpc->mpc_prev);
+  int n = 0;
+
+  if (mpc->mpc_dir) {
+    chs[n++] = mpegts_prewarm_neighbour(cur, mpc->mpc_dir);
+    chs[n++] = prev;
+    chs[n++] = mpegts_prewarm_neighbour(cur, -mpc->mpc_dir);
+  } else {
+    chs[n++] = prev;
+    chs[n++] = mpegts_prewarm_neighbour(cur, 1);
+    chs[n++] = mpegts_prewarm_neighbour(cur, -1);
+  }
+  return n;
+}
+
+/******************************************************************************
+ * Timer
+ *****************************************************************************/
+
+static mpegts_mux_t *
+mpegts_prewarm_sub_mux ( th_subscription_t *s )
+{
+  service_t *t = s->ths_raw_service;
+
+  if (t == NULL || t->s_type != STYPE_RAW || strcmp(s->ths_title, PREWARM_NAME))
+    return NULL;
+  return ((mpegts_service_t *)t)->s_dvb_mux;
+}
+
+static int
+mpegts_prewarm_client_active ( mpegts_prewarm_client_t *mpc )
+{
+  th_subscription_t *s;
+  const char *key;
+
+  LIST_FOREACH(s, &subscriptions, ths_global_link) {
+    if (s->ths_channel == NULL || (s->ths_flags & SUBSCRIPTION_STREAMING) == 0)
+      continue;
+    key = s->ths_username ?: s->ths_hostname;
+    if (key && !strcmp(key, mpc->mpc_key))
+      return 1;
+  }
+  return 0;
+}
+
+static void
+mpegts_prewarm_client_free ( mpegts_prewarm_client_t *mpc )
+{
+  LIST_REMOVE(mpc, mpc_link);
+  mpegts_prewarm_clients_count--;
+  free(mpc->mpc_key);
+  free(mpc);
+}
+
+static void
+mpegts_prewarm_timer_cb ( void *aux )
+{
+  mpegts_prewarm_client_t *mpc, *mpc_next;
+  th_subscription_t *s, *s_next;
+  mpegts_mux_t *mm, *want[16];
+  channel_t *chs[PREWARM_CANDIDATES];
+  char buf[256];
+  int i, j, n, budget, count = 0, subs = 0, r;
+
+  lock_assert(&global_lock);
+
+  budget = MIN(config.prewarm_tuners, ARRAY_SIZE(want));
+
+  /* Forget the inactive clients */
+  for (mpc = LIST_FIRST(&mpegts_prewarm_clients); mpc; mpc = mpc_next) {
+    mpc_next = LIST_NEXT(mpc, mpc_link);
+    if (mpegts_prewarm_client_active(mpc))
+      mpc->mpc_last = mclk();
+    else if (budget == 0 ||
+             mpc->mpc_last + sec2mono(config.prewarm_timeout) < mclk())
+      mpegts_prewarm_client_free(mpc);
+  }
+
+  /* Collect the predicted muxes (the most recent clients first) */
+  LIST_FOREACH(mpc, &mpegts_prewarm_clients, mpc_link) {
+    n = mpegts_prewarm_candidates(mpc, chs);
+    for (i = 0; i < n && count < budget; i++) {
+      if ((mm = mpegts_prewarm_channel_mux(chs[i])) == NULL)
+        continue;
+      if (mm == mpegts_prewarm_channel_mux(channel_find_by_uuid(mpc->mpc_cur)))
+        continue;
+      for (j = 0; j < count; j++)
+        if (want[j] == mm) break;
+      if (j >= count)
+        want[count++] = mm;
+    }
+  }
+
+  /* Release the muxes which are not predicted anymore */
+  for (s = LIST_FIRST(&subscriptions); s; s = s_next) {
+    s_next = LIST_NEXT(s, ths_global_link);
+    if ((mm = mpegts_prewarm_sub_mux(s)) == NULL)
+      continue;
+    for (j = 0; j < count; j++)
+      if (want[j] == mm) break;
+    if (j >= count) {
+      mpegts_mux_nice_name(mm, buf, sizeof(buf));
+      tvhdebug("mpegts", "%s - prewarm released", buf);
+      subscription_unsubscribe(s, UNSUBSCRIBE_QUIET | UNSUBSCRIBE_FINAL);
+    } else {
+      want[j] = NULL;
+      subs++;
+    }
+  }
+
+  /* Tune the new ones on the idle inputs */
+  for (j = 0; j < count; j++) {
+    if ((mm = want[j]) == NULL || mm->mm_active)
+      continue;
+    r = mpegts_mux_subscribe(mm, NULL, PREWARM_NAME, config.prewarm_weight,
+                             SUBSCRIPTION_ONESHOT | SUBSCRIPTION_TABLES);
+    mpegts_mux_nice_name(mm, buf, sizeof(buf));
+    if (r == 0) {
+      tvhdebug("mpegts", "%s - prewarm started", buf);
+      subs++;
+    } else {
+      tvhtrace("mpegts", "%s - prewarm failed (%s)", buf, streaming_code2txt(r));
+      if (r == SM_CODE_NO_FREE_ADAPTER || r == SM_CODE_NO_ADAPTERS)
+        break;
+    }
+  }
+
+  /* keep running while a prewarm subscription may need the release */
+  if (!LIST_EMPTY(&mpegts_prewarm_clients) || subs)
+    mtimer_arm_rel(&mpegts_prewarm_timer, mpegts_prewarm_timer_cb, NULL,
+                   sec2mono(10));
+}
+
+/******************************************************************************
+ * Events
+ *****************************************************************************/
+
+void
+mpegts_prewarm_zap
+  ( channel_t *ch, const char *hostname, const char *username )
+{
+  mpegts_prewarm_client_t *mpc;
+  const char *key = username ?: hostname;
+  char ubuf[UUID_HEX_SIZE];
+  channel_t *prev;
+
+  lock_assert(&global_lock);
+
+  if (config.prewarm_tuners == 0 || key == NULL || *key == '\0' || ch == NULL)
+    return;
+
+  LIST_FOREACH(mpc, &mpegts_prewarm_clients, mpc_link)
+    if (!strcmp(mpc->mpc_key, key))
+      break;
+  if (mpc == NULL) {
+    if (mpegts_prewarm_clients_count >= PREWARM_CLIENTS_MAX)
+      mpegts_prewarm_client_free(LIST_LAST(mpegts_prewarm_client_t,
+                                           &mpegts_prewarm_clients,
+                                           mpc_link));
+    mpc = calloc(1, sizeof(*mpc));
+    mpc->mpc_key = strdup(key);
+    mpegts_prewarm_clients_count++;
+  } else {
+    LIST_REMOVE(mpc, mpc_link);
+  }
+  LIST_INSERT_HEAD(&mpegts_prewarm_clients, mpc, mpc_link);
+  mpc->mpc_last = mclk();
+
+  idnode_uuid_as_str(&ch->ch_id, ubuf);
+  if (strcmp(ubuf, mpc->mpc_cur)) {
+    strcpy(mpc->mpc_prev, mpc->mpc_cur);
+    strcpy(mpc->mpc_cur, ubuf);
+    prev = channel_find_by_uuid(mpc->mpc_prev);
+    if (prev && prev == mpegts_prewarm_neighbour(ch, -1))
+      mpc->mpc_dir = 1;
+    else if (prev && prev == mpegts_prewarm_neighbour(ch, 1))
+      mpc->mpc_dir = -1;
+    else
+      mpc->mpc_dir = 0;
+  }
+
+  /* Let the zapping subscription take its input first */
+  mtimer_arm_rel(&mpegts_prewarm_timer, mpegts_prewarm_timer_cb, NULL,
+                 sec2mono(2));
+}
+
+/*
+ * The configuration was changed - release the prewarm subscriptions
+ * without waiting for the next zap when the feature is disabled
+ */
+void
+mpegts_prewarm_changed ( void )
+{
+  lock_assert(&global_lock);
+
+  mtimer_arm_rel(&mpegts_prewarm_timer, mpegts_prewarm_timer_cb, NULL, 0);
+}
+
+/******************************************************************************
+ * Init / Teardown
+ *****************************************************************************/
+
+void
+mpegts_prewarm_init ( void )
+{
+  LIST_INIT(&mpegts_prewarm_clients);
+}
+
+void
+mpegts_prewarm_done ( void )
+{
+  mpegts_prewarm_client_t *mpc;
+
+  pthread_mutex_lock(&global_lock);
+  mtimer_disarm(&mpegts_prewarm_timer);
+  while ((mpc = LIST_FIRST(&mpegts_prewarm_clients)) != NULL)
+    mpegts_prewarm_client_free(mpc);
+  pthread_mutex_unlock(&global_lock);
+}
+
+/******************************************************************************
+ * Editor Configuration
+ *
+ * vim:sts=2:ts=2:sw=2:et
+ *****************************************************************************/
@@ -0,0 +1,45 @@
+/*
+ *  Tvheadend - Predictive mux warm-up
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TVH_MPEGTS_PREWARM_H__
+#define __TVH_MPEGTS_PREWARM_H__
+
+#include "tvheadend.h"
+
+struct channel;
+
+/*
+ * Events
+ */
+void mpegts_prewarm_zap ( struct channel *ch, const char *hostname,
+                          const char *username );
+void mpegts_prewarm_changed ( void );
+
+/*
+ * Init / Teardown
+ */
+void mpegts_prewarm_init ( void );
+void mpegts_prewarm_done ( void );
+
+#endif /* __TVH_MPEGTS_PREWARM_H__*/
+
+/******************************************************************************
+ * Editor Configuration
+ *
+ * vim:sts=2:ts=2:sw=2:et
+ *****************************************************************************/
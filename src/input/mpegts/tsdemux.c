@@ -39,10 +39,12 @@
 #include "input.h"
 #include "parsers/parser_teletext.h"
 #include "tsdemux.h"
+#include "config.h"
 
 #define TS_REMUX_BUFSIZE (188 * 100)
 
-static void ts_remux(mpegts_service_t *t, const uint8_t *tsb, int len, int errors);
+static void ts_remux(mpegts_service_t *t, elementary_stream_t *st,
+                     const uint8_t *tsb, int len, int errors);
 static void ts_skip(mpegts_service_t *t, const uint8_t *tsb, int len);
 
 /**
@@ -102,7 +104,7 @@ ts_recv_packet0
 
 skip_cc:
   if(streaming_pad_probe_type(&t->s_streaming_pad, SMT_MPEGTS))
-    ts_remux(t, tsb, len, errors);
+    ts_remux(t, st, tsb, len, errors);
 
   for(off = 0; off < t->s_masters.is_count; off++) {
     m = (mpegts_service_t *)t->s_masters.is_array[off];
@@ -110,7 +112,7 @@ skip_cc:
     if(streaming_pad_probe_type(&m->s_streaming_pad, SMT_MPEGTS)) {
       pid = (tsb[1] & 0x1f) << 8 | tsb[2];
       if (mpegts_pid_rexists(m->s_slaves_pids, pid))
-        ts_remux(m, tsb, len, errors);
+        ts_remux(m, NULL, tsb, len, errors);
     }
     pthread_mutex_unlock(&m->s_stream_mutex);
     /* mark service live even without real subscribers */
@@ -306,7 +308,7 @@ ts_recv_raw(mpegts_service_t *t, const uint8_t *tsb, int len)
   }
   if (!parent) {
     if (streaming_pad_probe_type(&t->s_streaming_pad, SMT_MPEGTS)) {
-      ts_remux(t, tsb, len, 0);
+      ts_remux(t, NULL, tsb, len, 0);
     } else {
       /* No subscriber - set OK markers */
       service_set_streaming_status_flags((service_t*)t, TSS_PACKETS);
@@ -332,6 +334,8 @@ ts_flush(mpegts_service_t *t, sbuf_t *sb)
 
   sm.sm_type = SMT_MPEGTS;
   sm.sm_data = pb;
+  service_gop_cache_add((service_t *)t, &sm, t->s_tsbuf_key);
+  t->s_tsbuf_key = 0;
   streaming_pad_deliver(&t->s_streaming_pad, streaming_msg_clone(&sm));
 
   pktbuf_ref_dec(pb);
@@ -346,13 +350,31 @@ ts_flush(mpegts_service_t *t, sbuf_t *sb)
  *
  */
 static void
-ts_remux(mpegts_service_t *t, const uint8_t *src, int len, int errors)
+ts_remux(mpegts_service_t *t, elementary_stream_t *st,
+         const uint8_t *src, int len, int errors)
 {
   sbuf_t *sb = &t->s_tsbuf;
+  int off;
 
   if (sb->sb_data == NULL)
     sbuf_init_fixed(sb, TS_REMUX_BUFSIZE);
 
+  /* start a new buffer with the video random access point (GOP cache) */
+  if (st && config.gop_cache && SCT_ISVIDEO(st->es_type)) {
+    for (off = 0; off < len; off += 188)
+      if ((src[off+1] & 0x40) && (src[off+3] & 0x20) &&
+          src[off+4] > 0 && (src[off+5] & 0x40))
+        break;
+    if (off < len) {
+      sbuf_append(sb, src, off);
+      if (sb->sb_ptr > 0)
+        ts_flush(t, sb);
+      t->s_tsbuf_key = 1;
+      src += off;
+      len -= off;
+    }
+  }
+
   sbuf_append(sb, src, len);
   sb->sb_err += errors;
 
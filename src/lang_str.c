@@ -19,21 +19,187 @@
 #include <string.h>
 #include <stdlib.h>
 
-#include "redblack.h"
 #include "lang_codes.h"
 #include "lang_str.h"
 #include "tvheadend.h"
+#include "memoryinfo.h"
 
-SKEL_DECLARE(lang_str_ele_skel, lang_str_ele_t);
+/* ************************************************************************
+ * Interned string pool
+ * ***********************************************************************/
+
+/*
+ * EPG titles, genre texts and boilerplate descriptions repeat many
+ * thousands of times, so all lang_str strings are kept once in a
+ * refcounted hash pool. The string pointer handed out points directly
+ * to the entry payload.
+ */
+typedef struct lang_str_pool_ent {
+  struct lang_str_pool_ent *lse_next;
+  uint32_t                  lse_hash;
+  uint32_t                  lse_refcnt;
+  char                      lse_str[0];
+} lang_str_pool_ent_t;
+
+#define LANG_STR_POOL_MIN 1024
+
+memoryinfo_t lang_str_memoryinfo = { .my_name = "Interned strings" };
+
+static pthread_mutex_t       lang_str_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static lang_str_pool_ent_t **lang_str_pool;
+static uint32_t              lang_str_pool_size;
+static uint32_t              lang_str_pool_count;
+
+static inline lang_str_pool_ent_t *_lang_str_pool_ent ( const char *str )
+{
+  return (lang_str_pool_ent_t *)(str - offsetof(lang_str_pool_ent_t, lse_str));
+}
+
+static inline uint32_t _lang_str_pool_hash ( const char *s, size_t *len )
+{
+  const char *p = s;
+  uint32_t v = 5381;
+  while (*p)
+    v += (v << 5) + v + *p++;
+  *len = p - s;
+  return v;
+}
+
+static void _lang_str_pool_resize ( uint32_t size )
+{
+  lang_str_pool_ent_t **pool, *e, *n;
+  uint32_t i;
+
+  pool = calloc(size, sizeof(*pool));
+  if (pool == NULL)
+    return;
+  for (i = 0; i < lang_str_pool_size; i++)
+    for (e = lang_str_pool[i]; e; e = n) {
+      n = e->lse_next;
+      e->lse_next = pool[e->lse_hash & (size - 1)];
+      pool[e->lse_hash & (size - 1)] = e;
+    }
+  free(lang_str_pool);
+  lang_str_pool = pool;
+  lang_str_pool_size = size;
+}
+
+/* Get a shared copy of the string (refcount incremented) */
+const char *lang_str_intern ( const char *str )
+{
+  lang_str_pool_ent_t *e;
+  uint32_t hash;
+  size_t len;
+
+  if (str == NULL)
+    return NULL;
+  hash = _lang_str_pool_hash(str, &len);
+  pthread_mutex_lock(&lang_str_pool_mutex);
+  if (lang_str_pool_size == 0)
+    _lang_str_pool_resize(LANG_STR_POOL_MIN);
+  for (e = lang_str_pool[hash & (lang_str_pool_size - 1)]; e; e = e->lse_next)
+    if (e->lse_hash == hash && !strcmp(e->lse_str, str)) {
+      e->lse_refcnt++;
+      pthread_mutex_unlock(&lang_str_pool_mutex);
+      return e->lse_str;
+    }
+  e = malloc(sizeof(*e) + len + 1);
+  e->lse_hash = hash;
+  e->lse_refcnt = 1;
+  memcpy(e->lse_str, str, len + 1);
+  e->lse_next = lang_str_pool[hash & (lang_str_pool_size - 1)];
+  lang_str_pool[hash & (lang_str_pool_size - 1)] = e;
+  if (++lang_str_pool_count > 2 * lang_str_pool_size)
+    _lang_str_pool_resize(2 * lang_str_pool_size);
+  memoryinfo_alloc(&lang_str_memoryinfo, sizeof(*e) + len + 1);
+  pthread_mutex_unlock(&lang_str_pool_mutex);
+  return e->lse_str;
+}
+
+/* Take another reference to an already interned string */
+void lang_str_intern_ref ( const char *str )
+{
+  if (str == NULL)
+    return;
+  pthread_mutex_lock(&lang_str_pool_mutex);
+  _lang_str_pool_ent(str)->lse_refcnt++;
+  pthread_mutex_unlock(&lang_str_pool_mutex);
+}
+
+/* Drop a reference to an interned string */
+void lang_str_intern_free ( const char *str )
+{
+  lang_str_pool_ent_t *e, **pe;
+
+  if (str == NULL)
+    return;
+  e = _lang_str_pool_ent(str);
+  pthread_mutex_lock(&lang_str_pool_mutex);
+  assert(e->lse_refcnt > 0);
+  if (--e->lse_refcnt == 0) {
+    pe = &lang_str_pool[e->lse_hash & (lang_str_pool_size - 1)];
+    while (*pe != e)
+      pe = &(*pe)->lse_next;
+    *pe = e->lse_next;
+    lang_str_pool_count--;
+    memoryinfo_free(&lang_str_memoryinfo, sizeof(*e) + strlen(e->lse_str) + 1);
+    free(e);
+  }
+  pthread_mutex_unlock(&lang_str_pool_mutex);
+}
 
 /* ************************************************************************
  * Support
  * ***********************************************************************/
 
-/* Compare language codes */
-static int _lang_cmp ( void *a, void *b )
+static inline lang_str_ele_t *_lang_str_elements ( const lang_str_t *ls )
 {
-  return strcmp(((lang_str_ele_t*)a)->lang, ((lang_str_ele_t*)b)->lang);
+  return ls->ls_count > 1 ? ls->ls_ext : (lang_str_ele_t *)&ls->ls_one;
+}
+
+/* Find language element, *pos is set to the insert position if not found */
+static lang_str_ele_t *_lang_str_find
+  ( const lang_str_t *ls, const char *lang, uint32_t *pos )
+{
+  lang_str_ele_t *e = _lang_str_elements(ls);
+  uint32_t i;
+  int r;
+
+  /* Elements are sorted by the language code */
+  for (i = 0; i < ls->ls_count; i++, e++) {
+    r = strcmp(e->lang, lang);
+    if (r == 0)
+      return e;
+    if (r > 0)
+      break;
+  }
+  if (pos) *pos = i;
+  return NULL;
+}
+
+/* Insert new element to the sorted position */
+static lang_str_ele_t *_lang_str_insert
+  ( lang_str_t *ls, uint32_t pos, const char *lang, const char *str )
+{
+  lang_str_ele_t *ext, *e;
+
+  if (ls->ls_count == 0) {
+    e = &ls->ls_one;
+  } else {
+    ext = ls->ls_count > 1 ? ls->ls_ext : NULL;
+    ext = realloc(ext, (ls->ls_count + 1) * sizeof(*ext));
+    if (ext == NULL)
+      return NULL;
+    if (ls->ls_count == 1)
+      ext[0] = ls->ls_one;
+    memmove(ext + pos + 1, ext + pos, (ls->ls_count - pos) * sizeof(*ext));
+    ls->ls_ext = ext;
+    e = ext + pos;
+  }
+  e->lang = lang;
+  e->str  = str;
+  ls->ls_count++;
+  return e;
 }
 
 /* ************************************************************************
@@ -60,11 +226,10 @@ void lang_str_destroy ( lang_str_t *ls )
   lang_str_ele_t *e;
   if (ls == NULL)
     return;
-  while ((e = RB_FIRST(ls))) {
-    if (e->str)  free(e->str);
-    RB_REMOVE(ls, e, link);
-    free(e);
-  }
+  LANG_STR_FOREACH(e, ls)
+    lang_str_intern_free(e->str);
+  if (ls->ls_count > 1)
+    free(ls->ls_ext);
   free(ls);
 }
 
@@ -73,8 +238,17 @@ lang_str_t *lang_str_copy ( const lang_str_t *ls )
 {
   lang_str_t *ret = lang_str_create();
   lang_str_ele_t *e;
-  RB_FOREACH(e, ls, link)
-    lang_str_add(ret, e->str, e->lang, 0);
+  if (ls == NULL)
+    return ret;
+  if (ls->ls_count > 1) {
+    ret->ls_ext = malloc(ls->ls_count * sizeof(*e));
+    memcpy(ret->ls_ext, ls->ls_ext, ls->ls_count * sizeof(*e));
+  } else {
+    ret->ls_one = ls->ls_one;
+  }
+  ret->ls_count = ls->ls_count;
+  LANG_STR_FOREACH(e, ret)
+    lang_str_intern_ref(e->str);
   return ret;
 }
 
@@ -84,16 +258,19 @@ lang_str_ele_t *lang_str_get2
 {
   int i;
   const char **langs;
-  lang_str_ele_t skel, *e = NULL;
+  lang_str_ele_t *e = NULL;
 
-  if (!ls) return NULL;
+  if (!ls || !ls->ls_count) return NULL;
+
+  /* Single language - nothing to choose from */
+  if (ls->ls_count == 1)
+    return (lang_str_ele_t *)&ls->ls_one;
   
   /* Check config/requested langs */
   if ((langs = lang_code_split(lang))) {
     i = 0;
     while (langs[i]) {
-      skel.lang = langs[i];
-      if ((e = RB_FIND(ls, &skel, link, _lang_cmp)))
+      if ((e = _lang_str_find(ls, langs[i], NULL)))
         break;
       i++;
     }
@@ -101,7 +278,7 @@ lang_str_ele_t *lang_str_get2
   }
 
   /* Use first available */
-  if (!e) e = RB_FIRST(ls);
+  if (!e) e = lang_str_first(ls);
 
   /* Return */
   return e;
@@ -121,6 +298,10 @@ static int _lang_str_add
 {
   int save = 0;
   lang_str_ele_t *e;
+  uint32_t pos;
+  const char *s;
+  char *tmp;
+  size_t l;
 
   if (!str) return 0;
 
@@ -128,27 +309,33 @@ static int _lang_str_add
   if (!lang) lang = lang_code_preferred();
   if (!(lang = lang_code_get(lang))) return 0;
 
-  /* Create skel */
-  SKEL_ALLOC(lang_str_ele_skel);
-  lang_str_ele_skel->lang = lang;
+  e = _lang_str_find(ls, lang, &pos);
 
   /* Create */
-  e = RB_INSERT_SORTED(ls, lang_str_ele_skel, link, _lang_cmp);
   if (!e) {
-    lang_str_ele_skel->str = strdup(str);
-    SKEL_USED(lang_str_ele_skel);
+    s = lang_str_intern(str);
+    if (_lang_str_insert(ls, pos, lang, s) == NULL) {
+      lang_str_intern_free(s);
+      return 0;
+    }
     save = 1;
 
   /* Append */
   } else if (append) {
-    e->str = realloc(e->str, strlen(e->str) + strlen(str) + 1);
-    strcat(e->str, str);
+    l = strlen(e->str);
+    tmp = alloca(l + strlen(str) + 1);
+    memcpy(tmp, e->str, l);
+    strcpy(tmp + l, str);
+    s = lang_str_intern(tmp);
+    lang_str_intern_free(e->str);
+    e->str = s;
     save = 1;
 
   /* Update */
   } else if (update && strcmp(str, e->str)) {
-    free(e->str);
-    e->str = strdup(str);
+    s = lang_str_intern(str);
+    lang_str_intern_free(e->str);
+    e->str = s;
     save = 1;
   }
   
@@ -173,27 +360,15 @@ int lang_str_append
 int lang_str_set
   ( lang_str_t **dst, const char *str, const char *lang )
 {
-  lang_str_ele_t *e;
-  int found;
-  if (*dst == NULL) goto change1;
+  if (*dst == NULL) goto change;
   if (!lang) lang = lang_code_preferred();
   if (!(lang = lang_code_get(lang))) return 0;
-  if (*dst) {
-    found = 0;
-    RB_FOREACH(e, *dst, link) {
-      if (found)
-        goto change;
-      found = strcmp(e->lang, lang) == 0 &&
-              strcmp(e->str, str) == 0;
-      if (!found)
-        goto change;
-    }
-    if (found)
-      return 0;
-  }
-change:
+  if ((*dst)->ls_count == 1 &&
+      strcmp((*dst)->ls_one.lang, lang) == 0 &&
+      strcmp((*dst)->ls_one.str, str) == 0)
+    return 0;
   lang_str_destroy(*dst);
-change1:
+change:
   *dst = lang_str_create();
   lang_str_add(*dst, str, lang, 1);
   return 1;
@@ -218,7 +393,7 @@ htsmsg_t *lang_str_serialize_map ( lang_str_t *ls )
   lang_str_ele_t *e;
   if (!ls) return NULL;
   htsmsg_t *a = htsmsg_create_map();
-  RB_FOREACH(e, ls, link) {
+  LANG_STR_FOREACH(e, ls) {
     htsmsg_add_str(a, e->lang, e->str);
   }
   return a;
@@ -265,8 +440,7 @@ lang_str_t *lang_str_deserialize ( htsmsg_t *m, const char *n )
 /* Compare */
 int lang_str_compare( const lang_str_t *ls1, const lang_str_t *ls2 )
 {
-  lang_str_ele_t *e;
-  const char *s1, *s2;
+  lang_str_ele_t *e1, *e2;
   int r;
 
   if (ls1 == NULL && ls2)
@@ -275,31 +449,21 @@ int lang_str_compare( const lang_str_t *ls1, const lang_str_t *ls2 )
     return 1;
   if (ls1 == ls2)
     return 0;
-  /* Note: may be optimized to not check languages twice */
-  RB_FOREACH(e, ls1, link) {
-    s1 = lang_str_get(ls1, e->lang);
-    s2 = lang_str_get(ls2, e->lang);
-    if (s1 == NULL && s2 != NULL)
-      return -1;
-    if (s2 == NULL && s1 != NULL)
-      return 1;
-    if (s1 == NULL || s2 == NULL)
-      continue;
-    r = strcmp(s1, s2);
-    if (r) return r;
-  }
-  RB_FOREACH(e, ls2, link) {
-    s1 = lang_str_get(ls1, e->lang);
-    s2 = lang_str_get(ls2, e->lang);
-    if (s1 == NULL && s2 != NULL)
-      return -1;
-    if (s2 == NULL && s1 != NULL)
-      return 1;
-    if (s1 == NULL || s2 == NULL)
-      continue;
-    r = strcmp(s1, s2);
-    if (r) return r;
+  /* Both element arrays are sorted by the language code */
+  e1 = lang_str_first(ls1);
+  e2 = lang_str_first(ls2);
+  while (e1 && e2) {
+    r = strcmp(e1->lang, e2->lang);
+    if (r)
+      return r > 0 ? -1 : 1;
+    /* Interned strings are equal only if the pointers are equal */
+    if (e1->str != e2->str)
+      return strcmp(e1->str, e2->str);
+    e1 = lang_str_next(ls1, e1);
+    e2 = lang_str_next(ls2, e2);
   }
+  if (e1) return 1;
+  if (e2) return -1;
   return 0;
 }
 
@@ -311,21 +475,33 @@ int lang_str_empty(lang_str_t* str) {
   return strempty(lang_str_get(str, NULL));
 }
 
+/* Note: the shared strings are accounted proportionally to the refcount */
 size_t lang_str_size(const lang_str_t *ls)
 {
   lang_str_ele_t *e;
+  lang_str_pool_ent_t *pe;
   size_t size;
   if (!ls) return 0;
   size = sizeof(*ls);
-  RB_FOREACH(e, ls, link) {
-    size += sizeof(*e);
-    size += tvh_strlen(e->str);
-    size += tvh_strlen(e->lang);
+  if (ls->ls_count > 1)
+    size += ls->ls_count * sizeof(*e);
+  LANG_STR_FOREACH(e, ls) {
+    pe = _lang_str_pool_ent(e->str);
+    size += (sizeof(*pe) + strlen(pe->lse_str) + 1) / MAX(1, pe->lse_refcnt);
   }
   return size;
 }
 
 void lang_str_done( void )
 {
-  SKEL_FREE(lang_str_ele_skel);
+  pthread_mutex_lock(&lang_str_pool_mutex);
+  if (lang_str_pool_count)
+    tvhtrace("lang_str", "%u interned strings were not released",
+             lang_str_pool_count);
+  else {
+    free(lang_str_pool);
+    lang_str_pool = NULL;
+    lang_str_pool_size = 0;
+  }
+  pthread_mutex_unlock(&lang_str_pool_mutex);
 }
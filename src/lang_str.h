@@ -19,17 +19,44 @@
 #ifndef __TVH_LANG_STR_H__
 #define __TVH_LANG_STR_H__
 
-#include "redblack.h"
+#include <stdint.h>
 #include "htsmsg.h"
 
+struct memoryinfo;
+extern struct memoryinfo lang_str_memoryinfo;
+
 typedef struct lang_str_ele
 {
-  RB_ENTRY(lang_str_ele) link;
   const char *lang;
-  char *str;
+  const char *str;  /* interned, shared between all lang_str instances */
 } lang_str_ele_t;
 
-typedef RB_HEAD(lang_str, lang_str_ele) lang_str_t;
+/*
+ * Most EPG strings carry exactly one language, so the first element
+ * is stored inline and an external (sorted) array is only allocated
+ * for multi-language strings.
+ */
+typedef struct lang_str
+{
+  uint32_t        ls_count;
+  lang_str_ele_t *ls_ext;   /* all elements when ls_count > 1 */
+  lang_str_ele_t  ls_one;   /* the element when ls_count == 1 */
+} lang_str_t;
+
+static inline lang_str_ele_t *lang_str_first ( const lang_str_t *ls )
+{
+  if (ls == NULL || ls->ls_count == 0) return NULL;
+  return ls->ls_count > 1 ? ls->ls_ext : (lang_str_ele_t *)&ls->ls_one;
+}
+
+static inline lang_str_ele_t *lang_str_next
+  ( const lang_str_t *ls, lang_str_ele_t *e )
+{
+  return ls->ls_count > 1 && e + 1 < ls->ls_ext + ls->ls_count ? e + 1 : NULL;
+}
+
+#define LANG_STR_FOREACH(e, ls) \
+  for ((e) = lang_str_first(ls); (e); (e) = lang_str_next(ls, e))
 
 /* Create/Destroy */
 void            lang_str_destroy ( lang_str_t *ls );
@@ -71,6 +98,11 @@ int             lang_str_empty(lang_str_t* str);
 /* Size in bytes */
 size_t          lang_str_size ( const lang_str_t *ls );
 
+/* Interned string pool */
+const char     *lang_str_intern     ( const char *str );
+void            lang_str_intern_ref ( const char *str );
+void            lang_str_intern_free( const char *str );
+
 /* Init/Done */
 void            lang_str_done( void );
 
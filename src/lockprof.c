@@ -0,0 +1,343 @@
+/*
+ *  Tvheadend - mutex contention profiler
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define LOCKPROF_IMPL
+#include "tvheadend.h"
+#include "htsbuf.h"
+#include "clock.h"
+#include "lockprof.h"
+
+#if ENABLE_LOCK_PROFILE
+
+#define LOCKPROF_HELD_MAX 16
+
+static const char *lockprof_bucket_names[LOCKPROF_BUCKETS] = {
+  "<1us", "<2us", "<4us", "<8us", "<16us", "<32us", "<64us", "<128us",
+  "<256us", "<512us", "<1ms", "<2ms", "<4ms", "<8ms", "<16ms", ">=16ms"
+};
+
+typedef struct lockprof_held {
+  pthread_mutex_t     *lh_mutex;
+  tvh_lockprof_site_t *lh_site;
+  int64_t              lh_locked;
+} lockprof_held_t;
+
+static pthread_mutex_t lockprof_lock = PTHREAD_MUTEX_INITIALIZER;
+static tvh_lockprof_site_t *lockprof_sites;
+
+/* the locks held by the current thread */
+static __thread lockprof_held_t lockprof_held[LOCKPROF_HELD_MAX];
+static __thread int lockprof_nheld;
+
+/*
+ *
+ */
+static inline int
+lockprof_bucket(int64_t us)
+{
+  int b;
+
+  if (us <= 0)
+    return 0;
+  b = 64 - __builtin_clzll((uint64_t)us);
+  return MIN(b, LOCKPROF_BUCKETS - 1);
+}
+
+static inline void
+lockprof_account(uint64_t *total, int64_t *max, uint32_t *hist, int64_t us)
+{
+  atomic_add_u64(total, us);
+  if (us > atomic_get_s64(max))
+    atomic_set_s64(max, us);
+  atomic_add((int *)&hist[lockprof_bucket(us)], 1);
+}
+
+static void
+lockprof_register(tvh_lockprof_site_t *site)
+{
+  pthread_mutex_lock(&lockprof_lock);
+  if (!site->lps_registered) {
+    site->lps_next = lockprof_sites;
+    lockprof_sites = site;
+    atomic_set(&site->lps_registered, 1);
+  }
+  pthread_mutex_unlock(&lockprof_lock);
+}
+
+/*
+ *
+ */
+int
+tvh_lockprof_lock(pthread_mutex_t *mutex, tvh_lockprof_site_t *site)
+{
+  lockprof_held_t *lh;
+  int64_t t0, t1;
+  int r;
+
+  if (!atomic_get(&site->lps_registered))
+    lockprof_register(site);
+
+  if ((r = pthread_mutex_trylock(mutex)) == 0) {
+    t1 = getmonoclock();
+    t0 = t1;
+  } else {
+    if (r != EBUSY)
+      return r;
+    t0 = getmonoclock();
+    if ((r = pthread_mutex_lock(mutex)) != 0)
+      return r;
+    t1 = getmonoclock();
+    atomic_add_u64(&site->lps_contended, 1);
+  }
+
+  atomic_add_u64(&site->lps_count, 1);
+  lockprof_account(&site->lps_wait_total, &site->lps_wait_max,
+                   site->lps_wait_hist, t1 - t0);
+
+  if (lockprof_nheld < LOCKPROF_HELD_MAX) {
+    lh = &lockprof_held[lockprof_nheld++];
+    lh->lh_mutex  = mutex;
+    lh->lh_site   = site;
+    lh->lh_locked = t1;
+  }
+  return 0;
+}
+
+/*
+ *
+ */
+static lockprof_held_t *
+lockprof_find(pthread_mutex_t *mutex)
+{
+  int i;
+
+  for (i = lockprof_nheld - 1; i >= 0; i--)
+    if (lockprof_held[i].lh_mutex == mutex)
+      return &lockprof_held[i];
+  return NULL;
+}
+
+static void
+lockprof_hold_done(lockprof_held_t *lh, int64_t now)
+{
+  tvh_lockprof_site_t *site = lh->lh_site;
+
+  lockprof_account(&site->lps_hold_total, &site->lps_hold_max,
+                   site->lps_hold_hist, now - lh->lh_locked);
+}
+
+int
+tvh_lockprof_unlock(pthread_mutex_t *mutex)
+{
+  lockprof_held_t *lh = lockprof_find(mutex);
+
+  if (lh) {
+    lockprof_hold_done(lh, getmonoclock());
+    memmove(lh, lh + 1,
+            (lockprof_held + --lockprof_nheld - lh) * sizeof(*lh));
+  }
+  return pthread_mutex_unlock(mutex);
+}
+
+/*
+ * The mutex is released while waiting on the condition, account
+ * the hold time up to now and restart it when the wait finishes.
+ */
+void
+tvh_lockprof_cond_enter(pthread_mutex_t *mutex)
+{
+  lockprof_held_t *lh = lockprof_find(mutex);
+
+  if (lh)
+    lockprof_hold_done(lh, getmonoclock());
+}
+
+void
+tvh_lockprof_cond_leave(pthread_mutex_t *mutex)
+{
+  lockprof_held_t *lh = lockprof_find(mutex);
+
+  if (lh)
+    lh->lh_locked = getmonoclock();
+}
+
+/*
+ *
+ */
+static int
+lockprof_cmp(const void *_a, const void *_b)
+{
+  const tvh_lockprof_site_t *a = *(tvh_lockprof_site_t **)_a;
+  const tvh_lockprof_site_t *b = *(tvh_lockprof_site_t **)_b;
+
+  if (a->lps_wait_total != b->lps_wait_total)
+    return a->lps_wait_total < b->lps_wait_total ? 1 : -1;
+  if (a->lps_hold_total != b->lps_hold_total)
+    return a->lps_hold_total < b->lps_hold_total ? 1 : -1;
+  return 0;
+}
+
+static tvh_lockprof_site_t **
+lockprof_sorted(int *count)
+{
+  tvh_lockprof_site_t *site, **sites;
+  int i = 0;
+
+  pthread_mutex_lock(&lockprof_lock);
+  for (site = lockprof_sites; site; site = site->lps_next)
+    i++;
+  sites = malloc(MAX(i, 1) * sizeof(*sites));
+  for (i = 0, site = lockprof_sites; site; site = site->lps_next)
+    sites[i++] = site;
+  pthread_mutex_unlock(&lockprof_lock);
+  qsort(sites, i, sizeof(*sites), lockprof_cmp);
+  *count = i;
+  return sites;
+}
+
+static const char *
+lockprof_name(tvh_lockprof_site_t *site)
+{
+  const char *s = site->lps_name;
+  return s[0] == '&' ? s + 1 : s;
+}
+
+static void
+lockprof_reset(tvh_lockprof_site_t *site)
+{
+  site->lps_count = site->lps_contended = 0;
+  site->lps_wait_total = site->lps_hold_total = 0;
+  site->lps_wait_max = site->lps_hold_max = 0;
+  memset(site->lps_wait_hist, 0, sizeof(site->lps_wait_hist));
+  memset(site->lps_hold_hist, 0, sizeof(site->lps_hold_hist));
+}
+
+static htsmsg_t *
+lockprof_hist(uint32_t *hist)
+{
+  htsmsg_t *l = htsmsg_create_list();
+  int i;
+
+  for (i = 0; i < LOCKPROF_BUCKETS; i++)
+    htsmsg_add_u32(l, NULL, hist[i]);
+  return l;
+}
+
+/*
+ *
+ */
+htsmsg_t *
+tvh_lockprof_stats(int reset, int limit)
+{
+  tvh_lockprof_site_t *site, **sites;
+  htsmsg_t *m, *l, *e;
+  char buf[256];
+  int i, count;
+
+  sites = lockprof_sorted(&count);
+  l = htsmsg_create_list();
+  for (i = 0; i < count; i++) {
+    site = sites[i];
+    if (site->lps_count == 0)
+      continue;
+    if (limit <= 0 || i < limit) {
+      e = htsmsg_create_map();
+      htsmsg_add_str(e, "name", lockprof_name(site));
+      snprintf(buf, sizeof(buf), "%s:%d", site->lps_file, site->lps_line);
+      htsmsg_add_str(e, "site", buf);
+      htsmsg_add_s64(e, "count", site->lps_count);
+      htsmsg_add_s64(e, "contended", site->lps_contended);
+      htsmsg_add_s64(e, "wait_total_us", site->lps_wait_total);
+      htsmsg_add_s64(e, "wait_max_us", site->lps_wait_max);
+      htsmsg_add_s64(e, "hold_total_us", site->lps_hold_total);
+      htsmsg_add_s64(e, "hold_max_us", site->lps_hold_max);
+      htsmsg_add_msg(e, "wait_hist", lockprof_hist(site->lps_wait_hist));
+      htsmsg_add_msg(e, "hold_hist", lockprof_hist(site->lps_hold_hist));
+      htsmsg_add_msg(l, NULL, e);
+    }
+    if (reset)
+      lockprof_reset(site);
+  }
+  free(sites);
+
+  m = htsmsg_create_map();
+  htsmsg_add_u32(m, "enabled", 1);
+  htsmsg_add_msg(m, "entries", l);
+  l = htsmsg_create_list();
+  for (i = 0; i < LOCKPROF_BUCKETS; i++)
+    htsmsg_add_str(l, NULL, lockprof_bucket_names[i]);
+  htsmsg_add_msg(m, "buckets", l);
+  return m;
+}
+
+static void
+lockprof_dump_hist(struct htsbuf_queue *hq, const char *title, uint32_t *hist)
+{
+  int i;
+
+  htsbuf_qprintf(hq, "    %s:", title);
+  for (i = 0; i < LOCKPROF_BUCKETS; i++)
+    if (hist[i])
+      htsbuf_qprintf(hq, " %s=%u", lockprof_bucket_names[i], hist[i]);
+  htsbuf_append(hq, "\n", 1);
+}
+
+void
+tvh_lockprof_dump(struct htsbuf_queue *hq, int limit)
+{
+  tvh_lockprof_site_t *site, **sites;
+  int i, count;
+
+  sites = lockprof_sorted(&count);
+  for (i = 0; i < count && (limit <= 0 || i < limit); i++) {
+    site = sites[i];
+    if (site->lps_count == 0)
+      continue;
+    htsbuf_qprintf(hq, "%s (%s:%d)\n"
+                       "  count %"PRIu64" contended %"PRIu64"\n"
+                       "  wait total %"PRIu64"us max %"PRId64"us\n"
+                       "  hold total %"PRIu64"us max %"PRId64"us\n",
+                   lockprof_name(site), site->lps_file, site->lps_line,
+                   site->lps_count, site->lps_contended,
+                   site->lps_wait_total, site->lps_wait_max,
+                   site->lps_hold_total, site->lps_hold_max);
+    lockprof_dump_hist(hq, "wait", site->lps_wait_hist);
+    lockprof_dump_hist(hq, "hold", site->lps_hold_hist);
+  }
+  free(sites);
+}
+
+#else /* ENABLE_LOCK_PROFILE */
+
+htsmsg_t *
+tvh_lockprof_stats(int reset, int limit)
+{
+  htsmsg_t *m = htsmsg_create_map();
+
+  htsmsg_add_u32(m, "enabled", 0);
+  htsmsg_add_msg(m, "entries", htsmsg_create_list());
+  return m;
+}
+
+void
+tvh_lockprof_dump(struct htsbuf_queue *hq, int limit)
+{
+  htsbuf_qprintf(hq, "Not available (configure with --enable-lock_profile)\n");
+}
+
+#endif /* ENABLE_LOCK_PROFILE */
@@ -0,0 +1,90 @@
+/*
+ *  Tvheadend - mutex contention profiler
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TVHEADEND_LOCKPROF_H
+#define TVHEADEND_LOCKPROF_H
+
+/*
+ * With --enable-lock_profile, pthread_mutex_lock() / unlock() in all
+ * files including tvheadend.h record the wait and hold times for each
+ * call site. The call site state is a static variable created by the
+ * macro, so no lookup is required. Without the option, the mutex calls
+ * are not touched at all.
+ */
+
+#define LOCKPROF_BUCKETS 16 /* <1us, <2us, <4us ... >=16ms */
+
+struct htsbuf_queue;
+
+#if ENABLE_LOCK_PROFILE
+
+typedef struct tvh_lockprof_site {
+  struct tvh_lockprof_site *lps_next;
+  const char *lps_name;
+  const char *lps_file;
+  int         lps_line;
+  int         lps_registered;
+  uint64_t    lps_count;
+  uint64_t    lps_contended;
+  uint64_t    lps_wait_total;   /* us */
+  uint64_t    lps_hold_total;   /* us */
+  int64_t     lps_wait_max;     /* us */
+  int64_t     lps_hold_max;     /* us */
+  uint32_t    lps_wait_hist[LOCKPROF_BUCKETS];
+  uint32_t    lps_hold_hist[LOCKPROF_BUCKETS];
+} tvh_lockprof_site_t;
+
+int tvh_lockprof_lock(pthread_mutex_t *mutex, tvh_lockprof_site_t *site);
+int tvh_lockprof_unlock(pthread_mutex_t *mutex);
+void tvh_lockprof_cond_enter(pthread_mutex_t *mutex);
+void tvh_lockprof_cond_leave(pthread_mutex_t *mutex);
+
+#ifndef LOCKPROF_IMPL
+
+#define pthread_mutex_lock(m) ({ \
+  static tvh_lockprof_site_t __lps = \
+    { .lps_name = #m, .lps_file = __FILE__, .lps_line = __LINE__ }; \
+  tvh_lockprof_lock((m), &__lps); \
+})
+
+#define pthread_mutex_unlock(m) tvh_lockprof_unlock(m)
+
+#define pthread_cond_wait(c, m) ({ \
+  int __r; \
+  tvh_lockprof_cond_enter(m); \
+  __r = pthread_cond_wait((c), (m)); \
+  tvh_lockprof_cond_leave(m); \
+  __r; \
+})
+
+#define pthread_cond_timedwait(c, m, t) ({ \
+  int __r; \
+  tvh_lockprof_cond_enter(m); \
+  __r = pthread_cond_timedwait((c), (m), (t)); \
+  tvh_lockprof_cond_leave(m); \
+  __r; \
+})
+
+#endif /* LOCKPROF_IMPL */
+
+#endif /* ENABLE_LOCK_PROFILE */
+
+htsmsg_t *tvh_lockprof_stats(int reset, int limit);
+void tvh_lockprof_dump(struct htsbuf_queue *hq, int limit);
+
+#endif /* TVHEADEND_LOCKPROF_H */
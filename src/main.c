@@ -64,12 +64,14 @@
 #include "timeshift.h"
 #include "fsmonitor.h"
 #include "lang_codes.h"
+#include "lang_str.h"
 #include "esfilter.h"
 #include "intlconv.h"
 #include "dbus.h"
 #include "libav.h"
 #include "profile.h"
 #include "bouquet.h"
+#include "mcast_output.h"
 #include "tvhtime.h"
 #include "packet.h"
 #include "memoryinfo.h"
@@ -178,16 +180,76 @@ pthread_mutex_t atomic_lock;
 /*
  * Locals
  */
-static LIST_HEAD(, mtimer) mtimers;
+
+/*
+ * Timers are kept in the 4-ary min-heap ordered by the expiration time,
+ * the entries store the key to avoid the pointer chasing while sifting.
+ * All operations are protected by global_lock.
+ */
+#define TIMER_HEAP_ARITY  4
+#define TIMER_SLOW_CB     10000 /* us */
+
+typedef struct timer_heap_entry {
+  int64_t   he_expire;
+  uint32_t  he_seq;
+  uint32_t *he_idx;       /* back-pointer to mti_heapidx / gti_heapidx */
+} timer_heap_entry_t;
+
+typedef struct timer_heap {
+  const char         *th_name;
+  timer_heap_entry_t *th_nodes;
+  uint32_t            th_count;
+  uint32_t            th_alloc;
+  uint32_t            th_seq;
+  /* statistics */
+  uint32_t            th_peak;
+  uint64_t            th_arms;
+  uint64_t            th_fires;
+  uint64_t            th_cb_total;  /* us */
+  uint64_t            th_cb_slow;
+  int64_t             th_cb_max;    /* us */
+  char                th_cb_max_name[64];
+} timer_heap_t;
+
+static timer_heap_t mtimers = { .th_name = "mtimer" };
 static tvh_cond_t mtimer_cond;
 static int64_t mtimer_periodic;
 static pthread_t mtimer_tid;
 static pthread_t mtimer_tick_tid;
-static LIST_HEAD(, gtimer) gtimers;
+static timer_heap_t gtimers = { .th_name = "gtimer" };
 static pthread_cond_t gtimer_cond;
-static TAILQ_HEAD(, tasklet) tasklets;
+
+/*
+ * Tasklets are executed by a small pool of workers. The bulk (I/O heavy)
+ * class is served by all workers but one, so the latency sensitive
+ * tasklets are never stuck behind a slow file operation. All fields are
+ * protected by tasklet_lock.
+ */
+#define TASKLET_WORKERS   3
+#define TASKLET_CLASSES   2
+
+typedef struct tasklet_class {
+  const char *tc_name;
+  TAILQ_HEAD(, tasklet) tc_queue;
+  uint32_t tc_depth;
+  uint32_t tc_running;
+  int      tc_serial_running;
+  /* statistics */
+  uint32_t tc_peak;
+  uint64_t tc_done;
+  uint64_t tc_wait_total;   /* us */
+  int64_t  tc_wait_max;     /* us */
+  uint64_t tc_run_total;    /* us */
+  int64_t  tc_run_max;      /* us */
+} tasklet_class_t;
+
+static tasklet_class_t tasklet_classes[TASKLET_CLASSES] = {
+  { .tc_name = "normal" },
+  { .tc_name = "bulk" },
+};
+static tasklet_t *tasklet_running[TASKLET_WORKERS];
 static tvh_cond_t tasklet_cond;
-static pthread_t tasklet_tid;
+static pthread_t tasklet_tid[TASKLET_WORKERS];
 static memoryinfo_t tasklet_memoryinfo = { .my_name = "Tasklet" };
 
 static void
@@ -236,17 +298,171 @@ get_user_groups (const struct passwd *pw, gid_t* glist, size_t gmax)
 }
 
 /**
- *
+ * Timer heap
  */
+static inline int
+timer_heap_before(timer_heap_entry_t *a, timer_heap_entry_t *b)
+{
+  if (a->he_expire != b->he_expire)
+    return a->he_expire < b->he_expire;
+  /* the last armed timer is dispatched first for the same time */
+  return (int32_t)(a->he_seq - b->he_seq) > 0;
+}
+
+static inline void
+timer_heap_set(timer_heap_t *th, uint32_t idx, timer_heap_entry_t *e)
+{
+  th->th_nodes[idx] = *e;
+  *e->he_idx = idx;
+}
+
+static void
+timer_heap_sift(timer_heap_t *th, uint32_t idx)
+{
+  timer_heap_entry_t e = th->th_nodes[idx], *c;
+  uint32_t parent, child, i, last;
+
+  while (idx > 0) {
+    parent = (idx - 1) / TIMER_HEAP_ARITY;
+    if (!timer_heap_before(&e, &th->th_nodes[parent]))
+      break;
+    timer_heap_set(th, idx, &th->th_nodes[parent]);
+    idx = parent;
+  }
 
-#define safecmp(a, b) ((a) > (b) ? 1 : ((a) < (b) ? -1 : 0))
+  while (1) {
+    child = idx * TIMER_HEAP_ARITY + 1;
+    if (child >= th->th_count)
+      break;
+    last = MIN(child + TIMER_HEAP_ARITY, th->th_count);
+    c = &th->th_nodes[child];
+    for (i = child + 1; i < last; i++)
+      if (timer_heap_before(&th->th_nodes[i], c)) {
+        c = &th->th_nodes[i];
+        child = i;
+      }
+    if (!timer_heap_before(c, &e))
+      break;
+    timer_heap_set(th, idx, c);
+    idx = child;
+  }
+  timer_heap_set(th, idx, &e);
+}
 
+/*
+ * Insert or move the armed timer, returns 1 when it's the first one
+ */
 static int
-mtimercmp(mtimer_t *a, mtimer_t *b)
+timer_heap_arm(timer_heap_t *th, uint32_t *idx, int armed, int64_t expire)
 {
-  return safecmp(a->mti_expire, b->mti_expire);
+  timer_heap_entry_t *e;
+
+  if (!armed) {
+    if (th->th_count == th->th_alloc) {
+      th->th_alloc = MAX(64, th->th_alloc * 2);
+      th->th_nodes = realloc(th->th_nodes,
+                             th->th_alloc * sizeof(timer_heap_entry_t));
+      if (th->th_nodes == NULL)
+        abort();
+    }
+    *idx = th->th_count++;
+    if (th->th_count > th->th_peak)
+      th->th_peak = th->th_count;
+  }
+  e = &th->th_nodes[*idx];
+  e->he_expire = expire;
+  e->he_seq = ++th->th_seq;
+  e->he_idx = idx;
+  th->th_arms++;
+  timer_heap_sift(th, *idx);
+  return *idx == 0;
+}
+
+static void
+timer_heap_disarm(timer_heap_t *th, uint32_t *idx)
+{
+  uint32_t i = *idx;
+
+  assert(i < th->th_count && th->th_nodes[i].he_idx == idx);
+  th->th_count--;
+  if (i != th->th_count) {
+    timer_heap_set(th, i, &th->th_nodes[th->th_count]);
+    timer_heap_sift(th, i);
+  }
+}
+
+static inline uint32_t *
+timer_heap_first(timer_heap_t *th, int64_t *expire)
+{
+  if (th->th_count == 0)
+    return NULL;
+  *expire = th->th_nodes[0].he_expire;
+  return th->th_nodes[0].he_idx;
+}
+
+/*
+ * Account the callback duration
+ */
+static void
+timer_heap_stats(timer_heap_t *th, int64_t duration, void *cb,
+                 const char *id, const char *fcn)
+{
+  th->th_fires++;
+  th->th_cb_total += duration;
+  if (duration > TIMER_SLOW_CB)
+    th->th_cb_slow++;
+  if (duration > th->th_cb_max) {
+    th->th_cb_max = duration;
+    if (id)
+      snprintf(th->th_cb_max_name, sizeof(th->th_cb_max_name), "%s:%s", id, fcn);
+    else
+      snprintf(th->th_cb_max_name, sizeof(th->th_cb_max_name), "%p", cb);
+  }
+}
+
+static htsmsg_t *
+timer_heap_stats_msg(timer_heap_t *th, int reset)
+{
+  htsmsg_t *m = htsmsg_create_map();
+
+  htsmsg_add_str(m, "name", th->th_name);
+  htsmsg_add_u32(m, "armed", th->th_count);
+  htsmsg_add_u32(m, "peak", th->th_peak);
+  htsmsg_add_s64(m, "arms", th->th_arms);
+  htsmsg_add_s64(m, "fires", th->th_fires);
+  htsmsg_add_s64(m, "cb_total_us", th->th_cb_total);
+  htsmsg_add_s64(m, "cb_avg_us", th->th_fires ? th->th_cb_total / th->th_fires : 0);
+  htsmsg_add_s64(m, "cb_max_us", th->th_cb_max);
+  htsmsg_add_str(m, "cb_max_fcn", th->th_cb_max_name);
+  htsmsg_add_s64(m, "cb_slow", th->th_cb_slow);
+  if (reset) {
+    th->th_peak = th->th_count;
+    th->th_arms = th->th_fires = th->th_cb_total = th->th_cb_slow = 0;
+    th->th_cb_max = 0;
+    th->th_cb_max_name[0] = '\0';
+  }
+  return m;
 }
 
+/**
+ *
+ */
+htsmsg_t *
+tvh_timer_stats(int reset)
+{
+  htsmsg_t *l = htsmsg_create_list();
+
+  lock_assert(&global_lock);
+  htsmsg_add_msg(l, NULL, timer_heap_stats_msg(&mtimers, reset));
+  htsmsg_add_msg(l, NULL, timer_heap_stats_msg(&gtimers, reset));
+  return l;
+}
+
+#define mtimer_from_idx(idx) \
+  ((mtimer_t *)((char *)(idx) - offsetof(mtimer_t, mti_heapidx)))
+#define gtimer_from_idx(idx) \
+  ((gtimer_t *)((char *)(idx) - offsetof(gtimer_t, gti_heapidx)))
+
 /**
  *
  */
@@ -254,10 +470,11 @@ void
 GTIMER_FCN(mtimer_arm_abs)
   (GTIMER_TRACEID_ mtimer_t *mti, mti_callback_t *callback, void *opaque, int64_t when)
 {
+  int armed;
+
   lock_assert(&global_lock);
 
-  if (mti->mti_callback != NULL)
-    LIST_REMOVE(mti, mti_link);
+  armed = mti->mti_callback != NULL;
 
   mti->mti_callback = callback;
   mti->mti_opaque   = opaque;
@@ -267,9 +484,7 @@ GTIMER_FCN(mtimer_arm_abs)
   mti->mti_fcn      = fcn;
 #endif
 
-  LIST_INSERT_SORTED(&mtimers, mti, mti_link, mtimercmp);
-
-  if (LIST_FIRST(&mtimers) == mti)
+  if (timer_heap_arm(&mtimers, &mti->mti_heapidx, armed, when))
     tvh_cond_signal(&mtimer_cond, 0); // force timer re-check
 }
 
@@ -294,20 +509,11 @@ void
 mtimer_disarm(mtimer_t *mti)
 {
   if(mti->mti_callback) {
-    LIST_REMOVE(mti, mti_link);
+    timer_heap_disarm(&mtimers, &mti->mti_heapidx);
     mti->mti_callback = NULL;
   }
 }
 
-/**
- *
- */
-static int
-gtimercmp(gtimer_t *a, gtimer_t *b)
-{
-  return safecmp(a->gti_expire, b->gti_expire);
-}
-
 /**
  *
  */
@@ -315,10 +521,11 @@ void
 GTIMER_FCN(gtimer_arm_absn)
   (GTIMER_TRACEID_ gtimer_t *gti, gti_callback_t *callback, void *opaque, time_t when)
 {
+  int armed;
+
   lock_assert(&global_lock);
 
-  if (gti->gti_callback != NULL)
-    LIST_REMOVE(gti, gti_link);
+  armed = gti->gti_callback != NULL;
 
   gti->gti_callback = callback;
   gti->gti_opaque   = opaque;
@@ -328,9 +535,7 @@ GTIMER_FCN(gtimer_arm_absn)
   gti->gti_fcn      = fcn;
 #endif
 
-  LIST_INSERT_SORTED(&gtimers, gti, gti_link, gtimercmp);
-
-  if (LIST_FIRST(&gtimers) == gti)
+  if (timer_heap_arm(&gtimers, &gti->gti_heapidx, armed, when))
     pthread_cond_signal(&gtimer_cond); // force timer re-check
 }
 
@@ -355,22 +560,40 @@ void
 gtimer_disarm(gtimer_t *gti)
 {
   if(gti->gti_callback) {
-    LIST_REMOVE(gti, gti_link);
+    timer_heap_disarm(&gtimers, &gti->gti_heapidx);
     gti->gti_callback = NULL;
   }
 }
 
+/**
+ *
+ */
+static inline tasklet_class_t *
+tasklet_class(tasklet_t *tsk)
+{
+  return &tasklet_classes[(tsk->tsk_flags & TASKLET_BULK) ? 1 : 0];
+}
+
+static void
+tasklet_remove(tasklet_t *tsk)
+{
+  tasklet_class_t *tc = tasklet_class(tsk);
+
+  TAILQ_REMOVE(&tc->tc_queue, tsk, tsk_link);
+  tc->tc_depth--;
+}
+
 /**
  *
  */
 tasklet_t *
-tasklet_arm_alloc(tsk_callback_t *callback, void *opaque)
+tasklet_arm_alloc_flags(tsk_callback_t *callback, void *opaque, int flags)
 {
   tasklet_t *tsk = calloc(1, sizeof(*tsk));
   if (tsk) {
     memoryinfo_alloc(&tasklet_memoryinfo, sizeof(*tsk));
     tsk->tsk_allocated = 1;
-    tasklet_arm(tsk, callback, opaque);
+    tasklet_arm_flags(tsk, callback, opaque, flags);
   }
   return tsk;
 }
@@ -379,20 +602,26 @@ tasklet_arm_alloc(tsk_callback_t *callback, void *opaque)
  *
  */
 void
-tasklet_arm(tasklet_t *tsk, tsk_callback_t *callback, void *opaque)
+tasklet_arm_flags(tasklet_t *tsk, tsk_callback_t *callback, void *opaque, int flags)
 {
+  tasklet_class_t *tc;
+
   pthread_mutex_lock(&tasklet_lock);
 
   if (tsk->tsk_callback != NULL)
-    TAILQ_REMOVE(&tasklets, tsk, tsk_link);
+    tasklet_remove(tsk);
 
   tsk->tsk_callback = callback;
   tsk->tsk_opaque   = opaque;
+  tsk->tsk_flags    = flags;
+  tsk->tsk_queued   = getmonoclock();
 
-  TAILQ_INSERT_TAIL(&tasklets, tsk, tsk_link);
+  tc = tasklet_class(tsk);
+  TAILQ_INSERT_TAIL(&tc->tc_queue, tsk, tsk_link);
+  if (++tc->tc_depth > tc->tc_peak)
+    tc->tc_peak = tc->tc_depth;
 
-  if (TAILQ_FIRST(&tasklets) == tsk)
-    tvh_cond_signal(&tasklet_cond, 0);
+  tvh_cond_signal(&tasklet_cond, 0);
 
   pthread_mutex_unlock(&tasklet_lock);
 }
@@ -406,7 +635,7 @@ tasklet_disarm(tasklet_t *tsk)
   pthread_mutex_lock(&tasklet_lock);
 
   if(tsk->tsk_callback) {
-    TAILQ_REMOVE(&tasklets, tsk, tsk_link);
+    tasklet_remove(tsk);
     tsk->tsk_callback(tsk->tsk_opaque, 1);
     tsk->tsk_callback = NULL;
     if (tsk->tsk_allocated)
@@ -419,63 +648,157 @@ tasklet_disarm(tasklet_t *tsk)
 static void
 tasklet_flush()
 {
+  tasklet_class_t *tc;
   tasklet_t *tsk;
 
   pthread_mutex_lock(&tasklet_lock);
 
-  while ((tsk = TAILQ_FIRST(&tasklets)) != NULL) {
-    TAILQ_REMOVE(&tasklets, tsk, tsk_link);
-    tsk->tsk_callback(tsk->tsk_opaque, 1);
-    tsk->tsk_callback = NULL;
-    if (tsk->tsk_allocated) {
-      memoryinfo_free(&tasklet_memoryinfo, sizeof(*tsk));
-      free(tsk);
+  for (tc = tasklet_classes; tc < tasklet_classes + TASKLET_CLASSES; tc++)
+    while ((tsk = TAILQ_FIRST(&tc->tc_queue)) != NULL) {
+      tasklet_remove(tsk);
+      tsk->tsk_callback(tsk->tsk_opaque, 1);
+      tsk->tsk_callback = NULL;
+      if (tsk->tsk_allocated) {
+        memoryinfo_free(&tasklet_memoryinfo, sizeof(*tsk));
+        free(tsk);
+      }
     }
-  }
 
   pthread_mutex_unlock(&tasklet_lock);
 }
 
+/**
+ * Pick the next runnable tasklet (tasklet_lock must be held)
+ */
+static tasklet_t *
+tasklet_next(void)
+{
+  tasklet_class_t *tc;
+  tasklet_t *tsk;
+  int i;
+
+  for (tc = tasklet_classes; tc < tasklet_classes + TASKLET_CLASSES; tc++) {
+    if (tc != tasklet_classes && tc->tc_running >= TASKLET_WORKERS - 1)
+      continue;
+    TAILQ_FOREACH(tsk, &tc->tc_queue, tsk_link) {
+      if (tsk->tsk_flags & TASKLET_SERIAL) {
+        if (tc->tc_serial_running)
+          continue;
+      }
+      /* the static tasklet might be re-armed from its own callback */
+      if (!tsk->tsk_allocated) {
+        for (i = 0; i < TASKLET_WORKERS; i++)
+          if (tasklet_running[i] == tsk)
+            break;
+        if (i < TASKLET_WORKERS)
+          continue;
+      }
+      return tsk;
+    }
+  }
+  return NULL;
+}
+
 /**
  *
  */
 static void *
 tasklet_thread ( void *aux )
 {
+  int worker = (intptr_t)aux;
+  tasklet_class_t *tc;
   tasklet_t *tsk;
   tsk_callback_t *tsk_cb;
   void *opaque;
+  int64_t mono, t;
+  int serial;
 
   tvhtread_renice(20);
 
   pthread_mutex_lock(&tasklet_lock);
   while (tvheadend_is_running()) {
-    tsk = TAILQ_FIRST(&tasklets);
+    tsk = tasklet_next();
     if (tsk == NULL) {
       tvh_cond_wait(&tasklet_cond, &tasklet_lock);
       continue;
     }
     /* the callback might re-initialize tasklet, save everythin */
-    TAILQ_REMOVE(&tasklets, tsk, tsk_link);
+    tc = tasklet_class(tsk);
+    tasklet_remove(tsk);
     tsk_cb = tsk->tsk_callback;
     opaque = tsk->tsk_opaque;
+    serial = (tsk->tsk_flags & TASKLET_SERIAL) != 0;
+    mono = getmonoclock();
+    t = mono - tsk->tsk_queued;
+    tc->tc_wait_total += t;
+    if (t > tc->tc_wait_max)
+      tc->tc_wait_max = t;
     tsk->tsk_callback = NULL;
     if (tsk->tsk_allocated) {
       memoryinfo_free(&tasklet_memoryinfo, sizeof(*tsk));
       free(tsk);
+      tsk = NULL;
     }
     /* now, the callback can be safely called */
     if (tsk_cb) {
+      tasklet_running[worker] = tsk;
+      tc->tc_running++;
+      if (serial)
+        tc->tc_serial_running = 1;
+      /* wake up other worker for the remaining tasklets */
+      if (tasklet_classes[0].tc_depth || tasklet_classes[1].tc_depth)
+        tvh_cond_signal(&tasklet_cond, 0);
       pthread_mutex_unlock(&tasklet_lock);
       tsk_cb(opaque, 0);
       pthread_mutex_lock(&tasklet_lock);
+      if (serial)
+        tc->tc_serial_running = 0;
+      tc->tc_running--;
+      tasklet_running[worker] = NULL;
+      t = getmonoclock() - mono;
+      tc->tc_run_total += t;
+      if (t > tc->tc_run_max)
+        tc->tc_run_max = t;
     }
+    tc->tc_done++;
   }
   pthread_mutex_unlock(&tasklet_lock);
 
   return NULL;
 }
 
+/**
+ *
+ */
+htsmsg_t *
+tasklet_stats(int reset)
+{
+  htsmsg_t *l = htsmsg_create_list(), *m;
+  tasklet_class_t *tc;
+
+  pthread_mutex_lock(&tasklet_lock);
+  for (tc = tasklet_classes; tc < tasklet_classes + TASKLET_CLASSES; tc++) {
+    m = htsmsg_create_map();
+    htsmsg_add_str(m, "name", tc->tc_name);
+    htsmsg_add_u32(m, "depth", tc->tc_depth);
+    htsmsg_add_u32(m, "peak", tc->tc_peak);
+    htsmsg_add_u32(m, "running", tc->tc_running);
+    htsmsg_add_s64(m, "done", tc->tc_done);
+    htsmsg_add_s64(m, "wait_avg_us", tc->tc_done ? tc->tc_wait_total / tc->tc_done : 0);
+    htsmsg_add_s64(m, "wait_max_us", tc->tc_wait_max);
+    htsmsg_add_s64(m, "run_avg_us", tc->tc_done ? tc->tc_run_total / tc->tc_done : 0);
+    htsmsg_add_s64(m, "run_max_us", tc->tc_run_max);
+    htsmsg_add_msg(l, NULL, m);
+    if (reset) {
+      tc->tc_peak = tc->tc_depth;
+      tc->tc_done = tc->tc_wait_total = tc->tc_run_total = 0;
+      tc->tc_wait_max = tc->tc_run_max = 0;
+    }
+  }
+  pthread_mutex_unlock(&tasklet_lock);
+  return l;
+}
+
 /**
  * Show version info
  */
@@ -583,12 +906,10 @@ mtimer_thread(void *aux)
 {
   mtimer_t *mti;
   mti_callback_t *cb;
-  int64_t now, next;
-#if ENABLE_GTIMER_CHECK
-  int64_t mtm;
-  const char *id;
-  const char *fcn;
-#endif
+  uint32_t *idx;
+  int64_t now, next, expire, mtm;
+  const char *id = NULL;
+  const char *fcn = NULL;
 
   while (tvheadend_is_running()) {
     now = mdispatch_clock_update();
@@ -598,28 +919,30 @@ mtimer_thread(void *aux)
 
     next = now + sec2mono(3600);
 
-    while((mti = LIST_FIRST(&mtimers)) != NULL) {
-      
-      if (mti->mti_expire > now) {
-        next = mti->mti_expire;
+    while((idx = timer_heap_first(&mtimers, &expire)) != NULL) {
+
+      if (expire > now) {
+        next = expire;
         break;
       }
 
-#if ENABLE_GTIMER_CHECK
+      mti = mtimer_from_idx(idx);
       mtm = getmonoclock();
+#if ENABLE_GTIMER_CHECK
       id = mti->mti_id;
       fcn = mti->mti_fcn;
 #endif
       cb = mti->mti_callback;
 
-      LIST_REMOVE(mti, mti_link);
+      timer_heap_disarm(&mtimers, idx);
       mti->mti_callback = NULL;
 
       cb(mti->mti_opaque);
 
-#if ENABLE_GTIMER_CHECK
       mtm = getmonoclock() - mtm;
-      if (mtm > 10000)
+      timer_heap_stats(&mtimers, mtm, cb, id, fcn);
+#if ENABLE_GTIMER_CHECK
+      if (mtm > TIMER_SLOW_CB)
         tvhtrace("mtimer", "%s:%s duration %"PRId64"us", id, fcn, mtm);
 #endif
     }
@@ -644,13 +967,12 @@ mainloop(void)
 {
   gtimer_t *gti;
   gti_callback_t *cb;
+  uint32_t *idx;
   time_t now;
   struct timespec ts;
-#if ENABLE_GTIMER_CHECK
-  int64_t mtm;
-  const char *id;
-  const char *fcn;
-#endif
+  int64_t expire, mtm;
+  const char *id = NULL;
+  const char *fcn = NULL;
 
   while (tvheadend_is_running()) {
     now = gdispatch_clock_update();
@@ -661,37 +983,33 @@ mainloop(void)
     // TODO: there is a risk that if timers re-insert themselves to
     //       the top of the list with a 0 offset we could loop indefinitely
     
-#if 0
-    tvhdebug("gtimer", "now %"PRItime_t, ts.tv_sec);
-    LIST_FOREACH(gti, &gtimers, gti_link)
-      tvhdebug("gtimer", "  gti %p expire %"PRItimet, gti, gti->gti_expire.tv_sec);
-#endif
-
     ts.tv_sec += 3600;
     ts.tv_nsec = 0;
 
-    while((gti = LIST_FIRST(&gtimers)) != NULL) {
-      
-      if (gti->gti_expire > now) {
-        ts.tv_sec = gti->gti_expire;
+    while((idx = timer_heap_first(&gtimers, &expire)) != NULL) {
+
+      if (expire > now) {
+        ts.tv_sec = expire;
         break;
       }
 
-#if ENABLE_GTIMER_CHECK
+      gti = gtimer_from_idx(idx);
       mtm = getmonoclock();
+#if ENABLE_GTIMER_CHECK
       id = gti->gti_id;
       fcn = gti->gti_fcn;
 #endif
       cb = gti->gti_callback;
 
-      LIST_REMOVE(gti, gti_link);
+      timer_heap_disarm(&gtimers, idx);
       gti->gti_callback = NULL;
 
       cb(gti->gti_opaque);
 
-#if ENABLE_GTIMER_CHECK
       mtm = getmonoclock() - mtm;
-      if (mtm > 10000)
+      timer_heap_stats(&gtimers, mtm, cb, id, fcn);
+#if ENABLE_GTIMER_CHECK
+      if (mtm > TIMER_SLOW_CB)
         tvhtrace("gtimer", "%s:%s duration %"PRId64"us", id, fcn, mtm);
 #endif
     }
@@ -703,6 +1021,16 @@ mainloop(void)
 }
 
 
+/**
+ * Log the time spent in the subsystem initialization
+ */
+#define tvh_init_timed(fcn, ...) do { \
+  int64_t __mono = getfastmonoclock(); \
+  fcn(__VA_ARGS__); \
+  tvhdebug("START", "%s() took %"PRId64"ms", #fcn, \
+           (getfastmonoclock() - __mono) / 1000); \
+} while (0)
+
 /**
  *
  */
@@ -711,6 +1039,7 @@ main(int argc, char **argv)
 {
   int i;
   sigset_t set;
+  int64_t mono_start;
 #if ENABLE_MPEGTS
   uint32_t adapter_mask = 0;
 #endif
@@ -738,7 +1067,8 @@ main(int argc, char **argv)
   tvh_cond_init(&mtimer_cond);
   pthread_cond_init(&gtimer_cond, NULL);
   tvh_cond_init(&tasklet_cond);
-  TAILQ_INIT(&tasklets);
+  TAILQ_INIT(&tasklet_classes[0].tc_queue);
+  TAILQ_INIT(&tasklet_classes[1].tc_queue);
 
   /* Defaults */
   tvheadend_webui_port      = 9981;
@@ -774,6 +1104,8 @@ main(int argc, char **argv)
               opt_dbus         = 0,
               opt_dbus_session = 0,
               opt_nobackup     = 0,
+              opt_settings_log = 0,
+              opt_settings_export = 0,
               opt_nobat        = 0;
   const char *opt_config       = NULL,
              *opt_user         = NULL,
@@ -798,6 +1130,10 @@ main(int argc, char **argv)
     {   0, NULL,        N_("Service configuration"),   OPT_BOOL, NULL         },
     { 'c', "config",    N_("Alternate configuration path"), OPT_STR,  &opt_config  },
     { 'B', "nobackup",  N_("Don't backup configuration tree at upgrade"), OPT_BOOL, &opt_nobackup },
+    {   0, "settings_log", N_("Store configuration in a single file (settings.log)"),
+      OPT_BOOL, &opt_settings_log },
+    {   0, "settings_export", N_("Export settings.log to the configuration tree"),
+      OPT_BOOL, &opt_settings_export },
     { 'f', "fork",      N_("Fork and run as daemon"),  OPT_BOOL, &opt_fork    },
     { 'u', "user",      N_("Run as user"),             OPT_STR,  &opt_user    },
     { 'g', "group",     N_("Run as group"),            OPT_STR,  &opt_group   },
@@ -1055,7 +1391,10 @@ main(int argc, char **argv)
 
   uuid_init();
   idnode_boot();
-  config_boot(opt_config, gid, uid);
+  config_boot(opt_config,
+              opt_settings_export ? HTS_SETTINGS_EXPORT :
+              (opt_settings_log ? HTS_SETTINGS_LOG : HTS_SETTINGS_DIR),
+              gid, uid);
   tcp_server_preinit(opt_ipv6);
   http_server_init(opt_bindaddr);    // bind to ports only
   htsp_init(opt_bindaddr);	     // bind to ports only
@@ -1146,92 +1485,103 @@ main(int argc, char **argv)
   memoryinfo_register(&pkt_memoryinfo);
   memoryinfo_register(&pktbuf_memoryinfo);
   memoryinfo_register(&pktref_memoryinfo);
+  memoryinfo_register(&lang_str_memoryinfo);
 
   /**
    * Initialize subsystems
    */
 
   epg_in_load = 1;
+  mono_start = getfastmonoclock();
+
+  tvh_init_timed(hts_settings_prefetch);
 
   tvhthread_create(&mtimer_tick_tid, NULL, mtimer_tick_thread, NULL, "mtick");
-  tvhthread_create(&tasklet_tid, NULL, tasklet_thread, NULL, "tasklet");
+  for (i = 0; i < TASKLET_WORKERS; i++)
+    tvhthread_create(&tasklet_tid[i], NULL, tasklet_thread,
+                     (void *)(intptr_t)i, "tasklet");
 
-  tvh_hardware_init();
+  tvh_init_timed(tvh_hardware_init);
 
-  dbus_server_init(opt_dbus, opt_dbus_session);
+  tvh_init_timed(dbus_server_init, opt_dbus, opt_dbus_session);
 
-  intlconv_init();
+  tvh_init_timed(intlconv_init);
   
-  api_init();
+  tvh_init_timed(api_init);
 
-  fsmonitor_init();
+  tvh_init_timed(fsmonitor_init);
 
-  libav_init();
+  tvh_init_timed(libav_init);
 
-  tvhtime_init();
+  tvh_init_timed(tvhtime_init);
 
-  profile_init();
+  tvh_init_timed(profile_init);
 
-  imagecache_init();
+  tvh_init_timed(imagecache_init);
 
-  http_client_init(opt_user_agent);
-  esfilter_init();
+  tvh_init_timed(http_client_init, opt_user_agent);
+  tvh_init_timed(esfilter_init);
 
-  bouquet_init();
+  tvh_init_timed(bouquet_init);
 
-  service_init();
+  tvh_init_timed(service_init);
 
-  dvb_init();
+  tvh_init_timed(dvb_init);
 
 #if ENABLE_MPEGTS
-  mpegts_init(adapter_mask, opt_nosatip, &opt_satip_xml,
-              &opt_tsfile, opt_tsfile_tuner);
+  tvh_init_timed(mpegts_init, adapter_mask, opt_nosatip, &opt_satip_xml,
+                 &opt_tsfile, opt_tsfile_tuner);
 #endif
 
-  channel_init();
+  tvh_init_timed(channel_init);
 
-  bouquet_service_resolve();
+  tvh_init_timed(bouquet_service_resolve);
 
-  subscription_init();
+  tvh_init_timed(subscription_init);
 
-  dvr_config_init();
+  tvh_init_timed(dvr_config_init);
 
-  access_init(opt_firstrun, opt_noacl);
+  tvh_init_timed(access_init, opt_firstrun, opt_noacl);
 
 #if ENABLE_TIMESHIFT
-  timeshift_init();
+  tvh_init_timed(timeshift_init);
 #endif
 
-  tcp_server_init();
-  webui_init(opt_xspf);
+  tvh_init_timed(tcp_server_init);
+  tvh_init_timed(webui_init, opt_xspf);
 #if ENABLE_UPNP
-  upnp_server_init(opt_bindaddr);
+  tvh_init_timed(upnp_server_init, opt_bindaddr);
 #endif
 
-  service_mapper_init();
+  tvh_init_timed(service_mapper_init);
 
-  descrambler_init();
+  tvh_init_timed(descrambler_init);
 
-  epggrab_init();
-  epg_init();
+  tvh_init_timed(epggrab_init);
+  tvh_init_timed(epg_init);
 
-  dvr_init();
+  tvh_init_timed(dvr_init);
+  tvh_init_timed(mcast_output_init);
 
-  dbus_server_start();
+  tvh_init_timed(dbus_server_start);
 
-  http_server_register();
-  satip_server_register();
-  htsp_register();
+  tvh_init_timed(http_server_register);
+  tvh_init_timed(satip_server_register);
+  tvh_init_timed(htsp_register);
 
   if(opt_subscribe != NULL)
     subscription_dummy_join(opt_subscribe, 1);
 
-  avahi_init();
-  bonjour_init();
+  tvh_init_timed(avahi_init);
+  tvh_init_timed(bonjour_init);
 
   epg_updated(); // cleanup now all prev ref's should have been created
   epg_in_load = 0;
 
+  hts_settings_prefetch_done();
+  tvhinfo("START", "subsystems initialized in %"PRId64"ms",
+          (getfastmonoclock() - mono_start) / 1000);
+
   pthread_mutex_unlock(&global_lock);
 
   /**
@@ -1273,6 +1623,7 @@ main(int argc, char **argv)
   tvhftrace("main", htsp_done);
   tvhftrace("main", http_server_done);
   tvhftrace("main", webui_done);
+  tvhftrace("main", mcast_output_done);
   tvhftrace("main", fsmonitor_done);
   tvhftrace("main", http_client_done);
   tvhftrace("main", tcp_server_done);
@@ -1307,8 +1658,9 @@ main(int argc, char **argv)
   tvhftrace("main", api_done);
 
   tvhtrace("main", "tasklet enter");
-  tvh_cond_signal(&tasklet_cond, 0);
-  pthread_join(tasklet_tid, NULL);
+  tvh_cond_signal(&tasklet_cond, 1);
+  for (i = 0; i < TASKLET_WORKERS; i++)
+    pthread_join(tasklet_tid[i], NULL);
   tvhtrace("main", "tasklet thread end");
   tasklet_flush();
   tvhtrace("main", "tasklet leave");
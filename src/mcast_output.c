@@ -0,0 +1,771 @@
+/*
+ *  tvheadend, multicast re-streaming output
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <arpa/inet.h>
+#include "tvheadend.h"
+#include "settings.h"
+#include "channels.h"
+#include "subscriptions.h"
+#include "streaming.h"
+#include "muxer.h"
+#include "mcast_output.h"
+
+/*
+ * Each enabled output keeps a permanent channel subscription and sends
+ * the MPEG-TS muxer output (7 TS packets per datagram, optionally with
+ * a RTP header) to one multicast group, so the cost depends on the
+ * number of channels, not on the number of the receivers.
+ *
+ * With the PCR pacing, the datagrams are still sent in batches: a batch
+ * is closed when it is full or when it spans more than MO_PACE_WINDOW
+ * of the PCR time, the thread sleeps until the time of the first PCR
+ * in the batch and then sends the whole batch at once.
+ */
+
+#define MO_TS_PACKETS   7
+#define MO_PAYLOAD      (MO_TS_PACKETS * 188)
+#define MO_BATCH        32
+#define MO_PACE_WINDOW  ms2mono(20)
+#define MO_PERIOD       5       /* seconds, status check / SAP period */
+#define MO_RETRY        30      /* seconds, restart after a failure */
+#define MO_SAP_PERIOD   10
+#define MO_SAP_ADDRESS  "224.2.127.254"
+#define MO_SAP_PORT     9875
+
+struct mcast_output_queue mcast_outputs;
+
+static void mcast_output_timer(void *aux);
+
+/*
+ * Output thread - datagrams
+ */
+static void
+mcast_output_flush(mcast_output_t *mo)
+{
+  struct iovec *iov = mo->mo_iovec;
+  size_t partial, bytes = 0;
+  int i, r;
+
+  if (mo->mo_packets == 0)
+    return;
+  r = udp_multisend_send(&mo->mo_um, mo->mo_uc->fd, mo->mo_packets);
+  if (r < 0) {
+    if (!ERRNO_AGAIN(errno))
+      tvhtrace("mcast", "%s: send failed [%s]", mo->mo_name ?: "", strerror(errno));
+  } else {
+    for (i = 0; i < r; i++)
+      bytes += iov[i].iov_len;
+    subscription_add_bytes_out(mo->mo_sub, bytes);
+  }
+  /* move the partially filled datagram to the first slot */
+  partial = mo->mo_packets < MO_BATCH ? iov[mo->mo_packets].iov_len : 0;
+  if (partial)
+    memcpy(iov[0].iov_base, iov[mo->mo_packets].iov_base, partial);
+  udp_multisend_clean(&mo->mo_um);
+  iov[0].iov_len = partial;
+  mo->mo_packets = 0;
+  mo->mo_batch_due = 0;
+}
+
+/*
+ * Wait for the send time of the current batch (PCR pacing)
+ */
+static void
+mcast_output_batch_wait(mcast_output_t *mo)
+{
+  int64_t now = getfastmonoclock();
+
+  if (mo->mo_batch_due > now)
+    tvh_safe_usleep(mo->mo_batch_due - now);
+}
+
+static int64_t
+mcast_output_pcr(mcast_output_t *mo, const uint8_t *tsb)
+{
+  const uint8_t *pkt;
+  int64_t pcr = PTS_UNSET;
+  int i, pid;
+
+  for (i = 0, pkt = tsb; i < MO_TS_PACKETS; i++, pkt += 188) {
+    if (pkt[0] != 0x47 || (pkt[3] & 0x20) == 0 || pkt[4] < 7 ||
+        (pkt[5] & 0x10) == 0)
+      continue;
+    pid = ((pkt[1] & 0x1f) << 8) | pkt[2];
+    if (mo->mo_pcr_pid < 0)
+      mo->mo_pcr_pid = pid;
+    else if (mo->mo_pcr_pid != pid)
+      continue;
+    pcr = ((int64_t)pkt[6] << 25) | (pkt[7] << 17) | (pkt[8] << 9) |
+          (pkt[9] << 1) | (pkt[10] >> 7);
+  }
+  return pcr;
+}
+
+/*
+ * Compute the send time of a completed (not yet queued) datagram from
+ * its PCR, send the queued batch when the datagram does not fit to
+ * the batch pacing window
+ */
+static void
+mcast_output_pace(mcast_output_t *mo, const uint8_t *tsb)
+{
+  int64_t pcr = mcast_output_pcr(mo, tsb), now, due;
+
+  if (pcr == PTS_UNSET)
+    return;
+  now = getfastmonoclock();
+  due = now;
+  if (mo->mo_pcr_last == PTS_UNSET ||
+      ((pcr - mo->mo_pcr_last) & PTS_MASK) > 90000) {
+    /* start or discontinuity */
+    mo->mo_pcr0 = pcr;
+    mo->mo_clk0 = now;
+  } else {
+    due = mo->mo_clk0 + ((pcr - mo->mo_pcr0) & PTS_MASK) * 100 / 9;
+    if (due > now + MONOCLOCK_RESOLUTION || due < now - MONOCLOCK_RESOLUTION) {
+      mo->mo_pcr0 = pcr;
+      mo->mo_clk0 = now;
+      due = now;
+    }
+  }
+  mo->mo_pcr_last = pcr;
+  if (mo->mo_batch_due && due - mo->mo_batch_due >= MO_PACE_WINDOW) {
+    mcast_output_batch_wait(mo);
+    mcast_output_flush(mo);
+  }
+  if (mo->mo_batch_due == 0)
+    mo->mo_batch_due = due;
+}
+
+static void
+mcast_output_rtp_header(mcast_output_t *mo, uint8_t *b)
+{
+  uint32_t ts = getfastmonoclock() * 9 / 100;
+
+  b[0] = 0x80;
+  b[1] = 33;                    /* MP2T */
+  b[2] = mo->mo_seq >> 8;
+  b[3] = mo->mo_seq & 0xff;
+  b[4] = ts >> 24;
+  b[5] = ts >> 16;
+  b[6] = ts >> 8;
+  b[7] = ts;
+  b[8] = mo->mo_ssrc >> 24;
+  b[9] = mo->mo_ssrc >> 16;
+  b[10] = mo->mo_ssrc >> 8;
+  b[11] = mo->mo_ssrc;
+  mo->mo_seq++;
+}
+
+/*
+ * Muxer output callback
+ */
+static void
+mcast_output_sink(void *opaque, const void *data, size_t size)
+{
+  mcast_output_t *mo = opaque;
+  const uint8_t *p = data;
+  size_t hlen = mo->mo_rtp ? 12 : 0, l;
+  struct iovec *iov;
+
+  while (size > 0) {
+    iov = &mo->mo_iovec[mo->mo_packets];
+    if (iov->iov_len == 0 && hlen) {
+      mcast_output_rtp_header(mo, iov->iov_base);
+      iov->iov_len = hlen;
+    }
+    l = MIN(size, hlen + MO_PAYLOAD - iov->iov_len);
+    memcpy(iov->iov_base + iov->iov_len, p, l);
+    iov->iov_len += l;
+    p += l;
+    size -= l;
+    if (iov->iov_len < hlen + MO_PAYLOAD)
+      break;
+    /* the flush moves this datagram to the first slot of the next batch */
+    if (mo->mo_pacing)
+      mcast_output_pace(mo, iov->iov_base + hlen);
+    mo->mo_packets++;
+    if (mo->mo_packets == MO_BATCH) {
+      if (mo->mo_pacing)
+        mcast_output_batch_wait(mo);
+      mcast_output_flush(mo);
+    }
+  }
+}
+
+static void *
+mcast_output_thread(void *aux)
+{
+  mcast_output_t *mo = aux;
+  streaming_queue_t *sq = &mo->mo_prch->prch_sq;
+  muxer_t *mux = mo->mo_prch->prch_muxer;
+  streaming_message_t *sm;
+  streaming_start_t *ss_copy;
+  int run = 1, started = 0;
+
+  while (run) {
+    pthread_mutex_lock(&sq->sq_mutex);
+    if (!mo->mo_run) {
+      pthread_mutex_unlock(&sq->sq_mutex);
+      break;
+    }
+    sm = TAILQ_FIRST(&sq->sq_queue);
+    if (sm == NULL) {
+      tvh_cond_timedwait(&sq->sq_cond, &sq->sq_mutex, mclk() + sec2mono(1));
+      pthread_mutex_unlock(&sq->sq_mutex);
+      continue;
+    }
+    streaming_queue_remove(sq, sm);
+    pthread_mutex_unlock(&sq->sq_mutex);
+
+    switch (sm->sm_type) {
+    case SMT_MPEGTS:
+    case SMT_PACKET:
+      if (started) {
+        muxer_write_pkt(mux, sm->sm_type, sm->sm_data);
+        sm->sm_data = NULL;
+        if (!mo->mo_pacing)
+          mcast_output_flush(mo);
+      }
+      break;
+
+    case SMT_START:
+      if (!started) {
+        ss_copy = streaming_start_copy((streaming_start_t *)sm->sm_data);
+        if (muxer_init(mux, ss_copy, mo->mo_name) < 0)
+          run = 0;
+        streaming_start_unref(ss_copy);
+        started = 1;
+      } else if (muxer_reconfigure(mux, sm->sm_data) < 0) {
+        tvhwarn("mcast", "%s: unable to reconfigure stream", mo->mo_name);
+      }
+      break;
+
+    case SMT_STOP:
+      if (sm->sm_code != SM_CODE_SOURCE_RECONFIGURED) {
+        tvhwarn("mcast", "%s: stop, %s", mo->mo_name,
+                streaming_code2txt(sm->sm_code));
+        run = 0;
+      }
+      break;
+
+    case SMT_NOSTART:
+      tvhwarn("mcast", "%s: couldn't start, %s", mo->mo_name,
+              streaming_code2txt(sm->sm_code));
+      run = 0;
+      break;
+
+    case SMT_EXIT:
+      run = 0;
+      break;
+
+    default:
+      break;
+    }
+
+    streaming_msg_free(sm);
+
+    if (mux->m_errors) {
+      tvhwarn("mcast", "%s: muxer reported errors", mo->mo_name);
+      run = 0;
+    }
+  }
+
+  if (started)
+    muxer_close(mux);
+  atomic_set(&mo->mo_exited, 1);
+  return NULL;
+}
+
+/*
+ * SAP announcement (RFC 2974), IPv4 only
+ */
+static void
+mcast_output_sap(mcast_output_t *mo, int deletion)
+{
+  struct sockaddr_storage src;
+  socklen_t srclen = sizeof(src);
+  char sdp[1024], srcip[64];
+  uint8_t buf[1200];
+  size_t l;
+
+  if (mo->mo_sap_uc == NULL)
+    return;
+  memset(&src, 0, sizeof(src));
+  if (getsockname(mo->mo_uc->fd, (struct sockaddr *)&src, &srclen) ||
+      src.ss_family != AF_INET)
+    return;
+  inet_ntop(AF_INET, IP_IN_ADDR(src), srcip, sizeof(srcip));
+  snprintf(sdp, sizeof(sdp),
+           "v=0\r\n"
+           "o=- %u %u IN IP4 %s\r\n"
+           "s=%s\r\n"
+           "c=IN IP4 %s/%d\r\n"
+           "t=0 0\r\n"
+           "a=tool:tvheadend\r\n"
+           "a=type:broadcast\r\n"
+           "m=video %d %s 33\r\n",
+           mo->mo_sap_id, mo->mo_sap_id, srcip, mo->mo_name,
+           mo->mo_address, mo->mo_ttl, mo->mo_port,
+           mo->mo_rtp ? "RTP/AVP" : "udp");
+  buf[0] = 0x20 | (deletion ? 0x04 : 0);
+  buf[1] = 0;
+  buf[2] = mo->mo_sap_id >> 8;
+  buf[3] = mo->mo_sap_id & 0xff;
+  memcpy(buf + 4, IP_IN_ADDR(src), 4);
+  l = 8;
+  memcpy(buf + l, "application/sdp", 16);
+  l += 16;
+  l += snprintf((char *)buf + l, sizeof(buf) - l, "%s", sdp);
+  if (send(mo->mo_sap_uc->fd, buf, MIN(l, sizeof(buf)), MSG_DONTWAIT) < 0)
+    tvhtrace("mcast", "%s: SAP send failed [%s]", mo->mo_name, strerror(errno));
+}
+
+/*
+ * Start / stop, called with global_lock held
+ */
+static void
+mcast_output_sap_open(mcast_output_t *mo)
+{
+  if (mo->mo_sap_uc || mo->mo_uc->peer.ss_family != AF_INET)
+    return;
+  mo->mo_sap_uc = udp_sendinit("mcast", "SAP", mo->mo_ifname,
+                               MO_SAP_ADDRESS, MO_SAP_PORT, 16 * 1024);
+  if (mo->mo_sap_uc == UDP_FATAL_ERROR)
+    mo->mo_sap_uc = NULL;
+  uuid_random((uint8_t *)&mo->mo_sap_id, sizeof(mo->mo_sap_id));
+  mo->mo_sap_next = 0;
+}
+
+static void
+mcast_output_sap_close(mcast_output_t *mo)
+{
+  if (mo->mo_sap_uc == NULL)
+    return;
+  mcast_output_sap(mo, 1);
+  udp_close(mo->mo_sap_uc);
+  mo->mo_sap_uc = NULL;
+}
+
+static void
+mcast_output_stop(mcast_output_t *mo)
+{
+  streaming_queue_t *sq;
+
+  if (mo->mo_prch == NULL)
+    return;
+  tvhdebug("mcast", "%s: stop", mo->mo_name);
+  sq = &mo->mo_prch->prch_sq;
+  if (mo->mo_tid) {
+    pthread_mutex_lock(&sq->sq_mutex);
+    mo->mo_run = 0;
+    tvh_cond_signal(&sq->sq_cond, 0);
+    pthread_mutex_unlock(&sq->sq_mutex);
+    pthread_join(mo->mo_tid, NULL);
+    mo->mo_tid = 0;
+  }
+  if (mo->mo_sub) {
+    subscription_unsubscribe(mo->mo_sub, UNSUBSCRIBE_FINAL);
+    mo->mo_sub = NULL;
+  }
+  profile_chain_close(mo->mo_prch);
+  free(mo->mo_prch);
+  mo->mo_prch = NULL;
+  mcast_output_sap_close(mo);
+  udp_close(mo->mo_uc);
+  mo->mo_uc = NULL;
+  udp_multisend_free(&mo->mo_um);
+  mo->mo_iovec = NULL;
+}
+
+static int
+mcast_output_start(mcast_output_t *mo)
+{
+  channel_t *ch;
+  profile_t *pro;
+  muxer_t *mux;
+  int family;
+
+  if (mo->mo_prch)
+    return 0;
+  ch = mo->mo_channel ? channel_find_by_uuid(mo->mo_channel) : NULL;
+  if (ch == NULL || mo->mo_address == NULL || mo->mo_address[0] == '\0' ||
+      mo->mo_port <= 0 || mo->mo_port > 65535)
+    return 0;
+
+  pro = mo->mo_profile ? profile_find_by_uuid(mo->mo_profile) : NULL;
+  if (pro == NULL)
+    pro = profile_find_by_name(NULL, NULL);
+
+  free(mo->mo_name);
+  mo->mo_name = strdup(channel_get_name(ch));
+  tvhdebug("mcast", "%s: start %s:%d (profile %s)", mo->mo_name,
+           mo->mo_address, mo->mo_port, profile_get_name(pro));
+
+  mo->mo_uc = udp_sendinit("mcast", mo->mo_name, mo->mo_ifname,
+                           mo->mo_address, mo->mo_port, 1024 * 1024);
+  if (mo->mo_uc == NULL || mo->mo_uc == UDP_FATAL_ERROR) {
+    mo->mo_uc = NULL;
+    return -1;
+  }
+  family = mo->mo_uc->peer.ss_family;
+  if (mo->mo_uc->multicast && mo->mo_ttl > 0) {
+    if (family == AF_INET6) {
+      if (setsockopt(mo->mo_uc->fd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS,
+                     &mo->mo_ttl, sizeof(mo->mo_ttl)))
+        tvhwarn("mcast", "%s: cannot set hop limit [%s]", mo->mo_name, strerror(errno));
+    } else {
+      if (setsockopt(mo->mo_uc->fd, IPPROTO_IP, IP_MULTICAST_TTL,
+                     &mo->mo_ttl, sizeof(mo->mo_ttl)))
+        tvhwarn("mcast", "%s: cannot set TTL [%s]", mo->mo_name, strerror(errno));
+    }
+  }
+  udp_multisend_init(&mo->mo_um, MO_BATCH + 1, 12 + MO_PAYLOAD, &mo->mo_iovec);
+  mo->mo_packets = 0;
+  mo->mo_pcr_pid = -1;
+  mo->mo_pcr_last = PTS_UNSET;
+  mo->mo_batch_due = 0;
+  uuid_random((uint8_t *)&mo->mo_ssrc, sizeof(mo->mo_ssrc));
+
+  mo->mo_prch = calloc(1, sizeof(profile_chain_t));
+  profile_chain_init(mo->mo_prch, pro, ch);
+  if (profile_chain_open(mo->mo_prch, NULL, 0, 0))
+    goto fail;
+  mux = mo->mo_prch->prch_muxer;
+  if (mux == NULL ||
+      (mux->m_config.m_type != MC_PASS && mux->m_config.m_type != MC_MPEGTS) ||
+      muxer_open_sink(mux, mcast_output_sink, mo)) {
+    tvherror("mcast", "%s: profile '%s' does not produce MPEG-TS output",
+             mo->mo_name, profile_get_name(pro));
+    goto fail;
+  }
+
+  mo->mo_sub = subscription_create_from_channel(mo->mo_prch, NULL,
+                 mo->mo_weight, "multicast",
+                 mo->mo_prch->prch_flags | SUBSCRIPTION_STREAMING |
+                 SUBSCRIPTION_RESTART,
+                 NULL, NULL, NULL, NULL);
+  if (mo->mo_sub == NULL)
+    goto fail;
+
+  if (mo->mo_sap)
+    mcast_output_sap_open(mo);
+
+  atomic_set(&mo->mo_exited, 0);
+  mo->mo_run = 1;
+  tvhthread_create(&mo->mo_tid, NULL, mcast_output_thread, mo, "mcast");
+  return 0;
+
+fail:
+  mcast_output_stop(mo);
+  return -1;
+}
+
+static void
+mcast_output_timer(void *aux)
+{
+  mcast_output_t *mo = aux;
+  int64_t period = sec2mono(MO_PERIOD);
+
+  if (mo->mo_prch && atomic_get(&mo->mo_exited)) {
+    tvhwarn("mcast", "%s: stream stopped, restarting", mo->mo_name);
+    mcast_output_stop(mo);
+    period = sec2mono(MO_RETRY);
+  } else if (mo->mo_prch == NULL) {
+    if (mcast_output_start(mo))
+      period = sec2mono(MO_RETRY);
+  }
+  if (mo->mo_sap_uc && mclk() >= mo->mo_sap_next) {
+    mcast_output_sap(mo, 0);
+    mo->mo_sap_next = mclk() + sec2mono(MO_SAP_PERIOD);
+  }
+  if (mo->mo_enabled)
+    mtimer_arm_rel(&mo->mo_timer, mcast_output_timer, mo, period);
+}
+
+static void
+mcast_output_restart(mcast_output_t *mo, int64_t delay)
+{
+  mcast_output_stop(mo);
+  mtimer_disarm(&mo->mo_timer);
+  if (mo->mo_enabled)
+    mtimer_arm_rel(&mo->mo_timer, mcast_output_timer, mo, delay);
+}
+
+/*
+ * Class
+ */
+mcast_output_t *
+mcast_output_create(const char *uuid, htsmsg_t *conf)
+{
+  mcast_output_t *mo;
+
+  lock_assert(&global_lock);
+
+  mo = calloc(1, sizeof(mcast_output_t));
+  mo->mo_ttl = 4;
+  mo->mo_rtp = 1;
+  mo->mo_pacing = 1;
+
+  if (idnode_insert(&mo->mo_id, uuid, &mcast_output_class, 0)) {
+    if (uuid)
+      tvherror("mcast", "invalid uuid '%s'", uuid);
+    free(mo);
+    return NULL;
+  }
+
+  if (conf)
+    idnode_load(&mo->mo_id, conf);
+  mo->mo_restart = 0;
+
+  TAILQ_INSERT_TAIL(&mcast_outputs, mo, mo_link);
+
+  /* give the inputs some time to settle at startup */
+  mcast_output_restart(mo, sec2mono(2));
+  return mo;
+}
+
+static void
+mcast_output_destroy(mcast_output_t *mo, int delconf)
+{
+  mtimer_disarm(&mo->mo_timer);
+  mcast_output_stop(mo);
+  idnode_save_check(&mo->mo_id, delconf);
+  TAILQ_REMOVE(&mcast_outputs, mo, mo_link);
+  idnode_unlink(&mo->mo_id);
+  free(mo->mo_name);
+  free(mo->mo_channel);
+  free(mo->mo_profile);
+  free(mo->mo_address);
+  free(mo->mo_ifname);
+  free(mo->mo_comment);
+  free(mo);
+}
+
+static htsmsg_t *
+mcast_output_class_save(idnode_t *self, char *filename, size_t fsize)
+{
+  mcast_output_t *mo = (mcast_output_t *)self;
+  htsmsg_t *c = htsmsg_create_map();
+  char ubuf[UUID_HEX_SIZE];
+  idnode_save(&mo->mo_id, c);
+  snprintf(filename, fsize, "mcast_output/%s", idnode_uuid_as_str(&mo->mo_id, ubuf));
+  return c;
+}
+
+static void
+mcast_output_class_changed(idnode_t *self)
+{
+  mcast_output_t *mo = (mcast_output_t *)self;
+
+  if (mo->mo_restart) {
+    mo->mo_restart = 0;
+    mcast_output_restart(mo, 0);
+    return;
+  }
+  /* the output thread picks up the RTP and pacing settings itself */
+  if (mo->mo_prch == NULL)
+    return;
+  if (mo->mo_sub)
+    subscription_change_weight(mo->mo_sub, mo->mo_weight);
+  if (mo->mo_sap)
+    mcast_output_sap_open(mo);
+  else
+    mcast_output_sap_close(mo);
+}
+
+static void
+mcast_output_class_notify_restart(void *obj, const char *lang)
+{
+  ((mcast_output_t *)obj)->mo_restart = 1;
+}
+
+static void
+mcast_output_class_delete(idnode_t *self)
+{
+  mcast_output_t *mo = (mcast_output_t *)self;
+  char ubuf[UUID_HEX_SIZE];
+
+  hts_settings_remove("mcast_output/%s", idnode_uuid_as_str(&mo->mo_id, ubuf));
+  mcast_output_destroy(mo, 1);
+}
+
+static const char *
+mcast_output_class_get_title(idnode_t *self, const char *lang)
+{
+  mcast_output_t *mo = (mcast_output_t *)self;
+
+  if (mo->mo_comment && mo->mo_comment[0] != '\0')
+    return mo->mo_comment;
+  if (mo->mo_name)
+    return mo->mo_name;
+  return N_("Multicast output");
+}
+
+CLASS_DOC(mcast_output)
+
+const idclass_t mcast_output_class = {
+  .ic_class      = "mcast_output",
+  .ic_caption    = N_("Stream - Multicast Output"),
+  .ic_event      = "mcast_output",
+  .ic_perm_def   = ACCESS_ADMIN,
+  .ic_doc        = tvh_doc_mcast_output_class,
+  .ic_save       = mcast_output_class_save,
+  .ic_changed    = mcast_output_class_changed,
+  .ic_get_title  = mcast_output_class_get_title,
+  .ic_delete     = mcast_output_class_delete,
+  .ic_properties = (const property_t[]){
+    {
+      .type     = PT_BOOL,
+      .id       = "enabled",
+      .name     = N_("Enabled"),
+      .desc     = N_("Enable/disable the output."),
+      .off      = offsetof(mcast_output_t, mo_enabled),
+      .notify   = mcast_output_class_notify_restart,
+    },
+    {
+      .type     = PT_STR,
+      .id       = "channel",
+      .name     = N_("Channel"),
+      .desc     = N_("The channel to transmit."),
+      .off      = offsetof(mcast_output_t, mo_channel),
+      .notify   = mcast_output_class_notify_restart,
+      .list     = channel_class_get_list,
+    },
+    {
+      .type     = PT_STR,
+      .id       = "profile",
+      .name     = N_("Stream profile"),
+      .desc     = N_("The stream profile, it must produce MPEG-TS "
+                     "output (pass-through or a MPEG-TS transcoding "
+                     "profile). The default profile is used when not set."),
+      .off      = offsetof(mcast_output_t, mo_profile),
+      .notify   = mcast_output_class_notify_restart,
+      .list     = profile_class_get_list,
+    },
+    {
+      .type     = PT_STR,
+      .id       = "address",
+      .name     = N_("Group address"),
+      .desc     = N_("The multicast group (or unicast) address, "
+                     "e.g. 239.1.1.1 ."),
+      .off      = offsetof(mcast_output_t, mo_address),
+      .notify   = mcast_output_class_notify_restart,
+    },
+    {
+      .type     = PT_INT,
+      .id       = "port",
+      .name     = N_("Port"),
+      .desc     = N_("The destination UDP port."),
+      .off      = offsetof(mcast_output_t, mo_port),
+      .notify   = mcast_output_class_notify_restart,
+    },
+    {
+      .type     = PT_STR,
+      .id       = "interface",
+      .name     = N_("Interface"),
+      .desc     = N_("The network interface to send the stream from."),
+      .off      = offsetof(mcast_output_t, mo_ifname),
+      .notify   = mcast_output_class_notify_restart,
+      .list     = network_interfaces_enum,
+    },
+    {
+      .type     = PT_INT,
+      .id       = "ttl",
+      .name     = N_("TTL"),
+      .desc     = N_("The multicast time-to-live (hop limit)."),
+      .off      = offsetof(mcast_output_t, mo_ttl),
+      .notify   = mcast_output_class_notify_restart,
+      .opts     = PO_ADVANCED,
+    },
+    {
+      .type     = PT_BOOL,
+      .id       = "rtp",
+      .name     = N_("RTP"),
+      .desc     = N_("Send RTP (RFC 2250) datagrams instead of raw UDP."),
+      .off      = offsetof(mcast_output_t, mo_rtp),
+    },
+    {
+      .type     = PT_BOOL,
+      .id       = "pacing",
+      .name     = N_("PCR pacing"),
+      .desc     = N_("Send the datagrams at the rate given by the PCR "
+                     "to avoid bursts. The datagrams are sent in "
+                     "batches covering up to 20ms of the stream."),
+      .off      = offsetof(mcast_output_t, mo_pacing),
+      .opts     = PO_ADVANCED,
+    },
+    {
+      .type     = PT_BOOL,
+      .id       = "sap",
+      .name     = N_("SAP announce"),
+      .desc     = N_("Announce the stream using the Session Announcement "
+                     "Protocol (IPv4 only)."),
+      .off      = offsetof(mcast_output_t, mo_sap),
+    },
+    {
+      .type     = PT_INT,
+      .id       = "weight",
+      .name     = N_("Subscription weight"),
+      .desc     = N_("The subscription weight, the profile priority "
+                     "is used when set to zero."),
+      .off      = offsetof(mcast_output_t, mo_weight),
+      .opts     = PO_EXPERT,
+    },
+    {
+      .type     = PT_STR,
+      .id       = "comment",
+      .name     = N_("Comment"),
+      .desc     = N_("Free-form text field, enter whatever you like here."),
+      .off      = offsetof(mcast_output_t, mo_comment),
+    },
+    {}
+  }
+};
+
+/*
+ *
+ */
+void
+mcast_output_init(void)
+{
+  htsmsg_t *c, *m;
+  htsmsg_field_t *f;
+
+  TAILQ_INIT(&mcast_outputs);
+  idclass_register(&mcast_output_class);
+
+  if ((c = hts_settings_load("mcast_output")) != NULL) {
+    HTSMSG_FOREACH(f, c) {
+      if (!(m = htsmsg_field_get_map(f))) continue;
+      (void)mcast_output_create(f->hmf_name, m);
+    }
+    htsmsg_destroy(c);
+  }
+}
+
+void
+mcast_output_done(void)
+{
+  mcast_output_t *mo;
+
+  pthread_mutex_lock(&global_lock);
+  while ((mo = TAILQ_FIRST(&mcast_outputs)) != NULL)
+    mcast_output_destroy(mo, 0);
+  pthread_mutex_unlock(&global_lock);
+}
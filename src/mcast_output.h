@@ -0,0 +1,82 @@
+/*
+ *  tvheadend, multicast re-streaming output
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TVH_MCAST_OUTPUT_H__
+#define __TVH_MCAST_OUTPUT_H__
+
+#include "tvheadend.h"
+#include "idnode.h"
+#include "profile.h"
+#include "udp.h"
+
+typedef TAILQ_HEAD(mcast_output_queue, mcast_output) mcast_output_queue_t;
+
+extern struct mcast_output_queue mcast_outputs;
+
+typedef struct mcast_output {
+  idnode_t                   mo_id;
+  TAILQ_ENTRY(mcast_output)  mo_link;
+
+  int                        mo_enabled;
+  char                      *mo_name;
+  char                      *mo_channel;
+  char                      *mo_profile;
+  char                      *mo_address;
+  int                        mo_port;
+  char                      *mo_ifname;
+  int                        mo_ttl;
+  int                        mo_rtp;
+  int                        mo_pacing;
+  int                        mo_sap;
+  int                        mo_weight;
+  char                      *mo_comment;
+
+  /* Runtime */
+  int                        mo_restart;
+  mtimer_t                   mo_timer;
+  profile_chain_t           *mo_prch;
+  struct th_subscription    *mo_sub;
+  pthread_t                  mo_tid;
+  int                        mo_run;
+  int                        mo_exited;
+  udp_connection_t          *mo_uc;
+  udp_connection_t          *mo_sap_uc;
+  int64_t                    mo_sap_next;
+  uint16_t                   mo_sap_id;
+
+  /* Output thread */
+  udp_multisend_t            mo_um;
+  struct iovec              *mo_iovec;
+  int                        mo_packets;
+  uint16_t                   mo_seq;
+  uint32_t                   mo_ssrc;
+  int                        mo_pcr_pid;
+  int64_t                    mo_pcr0;
+  int64_t                    mo_clk0;
+  int64_t                    mo_pcr_last;
+  int64_t                    mo_batch_due;   /* 0 = no PCR in the batch */
+} mcast_output_t;
+
+extern const idclass_t mcast_output_class;
+
+mcast_output_t *mcast_output_create(const char *uuid, htsmsg_t *conf);
+
+void mcast_output_init(void);
+void mcast_output_done(void);
+
+#endif /* __TVH_MCAST_OUTPUT_H__ */
@@ -321,9 +321,9 @@ muxer_cache_txt2type(const char *str)
  * cache scheme
  */
 void
-muxer_cache_update(muxer_t *m, int fd, off_t pos, size_t size)
+muxer_cache_fd(int cache, int fd, off_t pos, size_t size)
 {
-  switch (m->m_config.m_cache) {
+  switch (cache) {
   case MC_CACHE_UNKNOWN:
   case MC_CACHE_SYSTEM:
     break;
@@ -345,6 +345,12 @@ muxer_cache_update(muxer_t *m, int fd, off_t pos, size_t size)
   }
 }
 
+void
+muxer_cache_update(muxer_t *m, int fd, off_t pos, size_t size)
+{
+  muxer_cache_fd(m->m_config.m_cache, fd, pos, size);
+}
+
 /**
  * Get a list of supported cache schemes
  */
@@ -66,6 +66,10 @@ typedef struct muxer_config {
 
 struct muxer;
 struct streaming_start;
+
+/* In-memory output, used instead of a file descriptor */
+typedef void (muxer_sink_t)(void *opaque, const void *data, size_t size);
+
 struct th_pkt;
 struct epg_broadcast;
 struct service;
@@ -73,6 +77,8 @@ struct service;
 typedef struct muxer {
   int         (*m_open_stream)(struct muxer *, int fd);                 /* Open for socket streaming */
   int         (*m_open_file)  (struct muxer *, const char *filename);   /* Open for file storage */
+  int         (*m_open_sink)  (struct muxer *, muxer_sink_t *,          /* Open for in-memory output */
+                               void *opaque);                           /* (optional) */
   const char* (*m_mime)       (struct muxer *,                          /* Figure out the mimetype */
 			       const struct streaming_start *);
   int         (*m_init)       (struct muxer *,                          /* Init The muxer with streams */
@@ -92,6 +98,7 @@ typedef struct muxer {
   int                    m_eos;        /* End of stream */
   int                    m_errors;     /* Number of errors */
   muxer_config_t         m_config;     /* general configuration */
+  struct muxer_writer   *m_writer;     /* asynchronous file writer */
 } muxer_t;
 
 
@@ -115,6 +122,9 @@ static inline int muxer_open_file (muxer_t *m, const char *filename)
 static inline int muxer_open_stream (muxer_t *m, int fd)
   { if(m && fd >= 0) return m->m_open_stream(m, fd); return -1; }
 
+static inline int muxer_open_sink (muxer_t *m, muxer_sink_t *sink, void *opaque)
+  { if(m && sink && m->m_open_sink) return m->m_open_sink(m, sink, opaque); return -1; }
+
 static inline int muxer_init (muxer_t *m, struct streaming_start *ss, const char *name)
   { if(m && ss) return m->m_init(m, ss, name); return -1; }
 
@@ -144,6 +154,7 @@ const char* muxer_suffix      (muxer_t *m, const struct streaming_start *ss);
 /* Cache */
 const char *       muxer_cache_type2txt(muxer_cache_type_t t);
 muxer_cache_type_t muxer_cache_txt2type(const char *str);
+void               muxer_cache_fd(int cache, int fd, off_t off, size_t size);
 void               muxer_cache_update(muxer_t *m, int fd, off_t off, size_t size);
 int                muxer_cache_list(htsmsg_t *array);
 
@@ -38,6 +38,8 @@ typedef struct lav_muxer {
   AVBitStreamFilterContext *lm_hevc_filter;
   int lm_fd;
   int lm_init;
+  muxer_sink_t *lm_sink;
+  void *lm_sink_opaque;
 } lav_muxer_t;
 
 #define MUX_BUF_SIZE 4096
@@ -59,6 +61,11 @@ lav_muxer_write(void *opaque, uint8_t *buf, int buf_size)
     return buf_size;
   }
 
+  if (lm->lm_sink) {
+    lm->lm_sink(lm->lm_sink_opaque, buf, buf_size);
+    return buf_size;
+  }
+
   r = write(lm->lm_fd, buf, buf_size);
   if (r != buf_size)
     lm->m_errors++;
@@ -391,6 +398,21 @@ lav_muxer_open_stream(muxer_t *m, int fd)
 }
 
 
+/**
+ * Open the muxer for the in-memory output
+ */
+static int
+lav_muxer_open_sink(muxer_t *m, muxer_sink_t *sink, void *opaque)
+{
+  lav_muxer_t *lm = (lav_muxer_t*)m;
+
+  lm->lm_sink = sink;
+  lm->lm_sink_opaque = opaque;
+
+  return lav_muxer_open_stream(m, -1);
+}
+
+
 static int
 lav_muxer_open_file(muxer_t *m, const char *filename)
 {
@@ -634,6 +656,7 @@ lav_muxer_create(const muxer_config_t *m_cfg)
 
   lm = calloc(1, sizeof(lav_muxer_t));
   lm->m_open_stream  = lav_muxer_open_stream;
+  lm->m_open_sink    = lav_muxer_open_sink;
   lm->m_open_file    = lav_muxer_open_file;
   lm->m_init         = lav_muxer_init;
   lm->m_reconfigure  = lav_muxer_reconfigure;
@@ -41,6 +41,7 @@
 #include "parsers/parser_avc.h"
 #include "parsers/parser_hevc.h"
 #include "muxer_mkv.h"
+#include "muxer_writer.h"
 
 extern int dvr_iov_max;
 
@@ -461,6 +462,19 @@ mk_write_to_fd(mk_muxer_t *mk, htsbuf_queue_t *hq)
   int i = 0;
   off_t oldpos = mk->fdpos;
 
+  if (mk->m_writer) {
+    TAILQ_FOREACH(hd, &hq->hq_q, hd_link) {
+      i = muxer_writer_write(mk->m_writer, hd->hd_data + hd->hd_data_off,
+                             hd->hd_data_len - hd->hd_data_off);
+      if (i) {
+        mk->error = errno = i;
+        return -1;
+      }
+      mk->fdpos += hd->hd_data_len - hd->hd_data_off;
+    }
+    return 0;
+  }
+
   TAILQ_FOREACH(hd, &hq->hq_q, hd_link)
     i++;
 
@@ -492,6 +506,25 @@ mk_write_to_fd(mk_muxer_t *mk, htsbuf_queue_t *hq)
 }
 
 
+/**
+ *
+ */
+static int
+mk_seek(mk_muxer_t *mk, off_t pos)
+{
+  int r;
+
+  if (mk->m_writer) {
+    if ((r = muxer_writer_seek(mk->m_writer, pos)) != 0) {
+      errno = r;
+      return -1;
+    }
+    return 0;
+  }
+  return lseek(mk->fd, pos, SEEK_SET) == pos ? 0 : -1;
+}
+
+
 /**
  *
  */
@@ -749,13 +782,13 @@ _mk_build_metadata(const dvr_entry_t *de, const epg_broadcast_t *ebc,
 
   if (ls) {
     lang_str_ele_t *e;
-    RB_FOREACH(e, ls, link)
+    LANG_STR_FOREACH(e, ls)
       addtag(q, build_tag_string("SUMMARY", e->str, e->lang, 0, NULL));
   }
 
   if (ls2 && ls != ls2) {
     lang_str_ele_t *e;
-    RB_FOREACH(e, ls2, link)
+    LANG_STR_FOREACH(e, ls2)
       addtag(q, build_tag_string("DESCRIPTION", e->str, e->lang, 0, NULL));
   }
 
@@ -857,12 +890,12 @@ mk_write_metaseek(mk_muxer_t *mk, int first)
   } else if(mk->seekable) {
     off_t prev = mk->fdpos;
     mk->fdpos = mk->segment_pos;
-    if(lseek(mk->fd, mk->segment_pos, SEEK_SET) == (off_t) -1)
+    if(mk_seek(mk, mk->segment_pos))
       mk->error = errno;
 
     mk_write_queue(mk, &q);
     mk->fdpos = prev;
-    if(lseek(mk->fd, mk->fdpos, SEEK_SET) == (off_t) -1)
+    if(mk_seek(mk, mk->fdpos))
       mk->error = errno;
   }
   htsbuf_queue_flush(&q);
@@ -1168,6 +1201,7 @@ static int
 mk_mux_close(mk_muxer_t *mk)
 {
   int64_t totsize;
+  int r;
   mk_close_cluster(mk);
   mk_write_cues(mk);
   mk_write_chapters(mk);
@@ -1177,7 +1211,7 @@ mk_mux_close(mk_muxer_t *mk)
 
   if(mk->seekable) {
     // Rewrite segment info to update duration
-    if(lseek(mk->fd, mk->segmentinfo_pos, SEEK_SET) == mk->segmentinfo_pos)
+    if(mk_seek(mk, mk->segmentinfo_pos) == 0)
       mk_write_master(mk, 0x1549a966, mk_build_segment_info(mk));
     else {
       mk->error = errno;
@@ -1186,7 +1220,7 @@ mk_mux_close(mk_muxer_t *mk)
     }
 
     // Rewrite segment header to update total size
-    if(lseek(mk->fd, mk->segment_header_pos, SEEK_SET) == mk->segment_header_pos) {
+    if(mk_seek(mk, mk->segment_header_pos) == 0) {
       mk_write_segment_header(mk, totsize - mk->segment_header_pos - 12);
     } else {
       mk->error = errno;
@@ -1194,6 +1228,13 @@ mk_mux_close(mk_muxer_t *mk)
 	     mk->filename, strerror(errno));
     }
 
+    if(mk->m_writer) {
+      r = muxer_writer_destroy(mk->m_writer);
+      mk->m_writer = NULL;
+      if(r && !mk->error)
+        mk->error = r;
+    }
+
     if(close(mk->fd)) {
       mk->error = errno;
       tvhlog(LOG_ERR, "mkv", "%s: Unable to close the file descriptor, close failed -- %s",
@@ -1356,6 +1397,7 @@ mkv_muxer_open_file(muxer_t *m, const char *filename)
   mk->fd = fd;
   mk->cluster_maxsize = 2000000;
   mk->seekable = 1;
+  mk->m_writer = muxer_writer_create(fd, filename, mk->m_config.m_cache);
 
   return 0;
 }
@@ -1436,6 +1478,9 @@ mkv_muxer_destroy(muxer_t *m)
   mk_muxer_t *mk = (mk_muxer_t*)m;
   mk_chapter_t *ch;
 
+  if(mk->m_writer)
+    muxer_writer_destroy(mk->m_writer);
+
   while((ch = TAILQ_FIRST(&mk->chapters)) != NULL) {
     TAILQ_REMOVE(&mk->chapters, ch, link);
     free(ch);
@@ -28,6 +28,7 @@
 #include "service.h"
 #include "input/mpegts/dvb.h"
 #include "muxer_pass.h"
+#include "muxer_writer.h"
 #include "dvr/dvr.h"
 
 typedef struct pass_muxer {
@@ -39,6 +40,10 @@ typedef struct pass_muxer {
   int   pm_seekable;
   int   pm_error;
 
+  /* In-memory output */
+  muxer_sink_t *pm_sink;
+  void *pm_sink_opaque;
+
   /* Filename is also used for logging */
   char *pm_filename;
 
@@ -366,6 +371,24 @@ pass_muxer_open_stream(muxer_t *m, int fd)
 }
 
 
+/**
+ * Open the muxer for the in-memory output
+ */
+static int
+pass_muxer_open_sink(muxer_t *m, muxer_sink_t *sink, void *opaque)
+{
+  pass_muxer_t *pm = (pass_muxer_t*)m;
+
+  pm->pm_off         = 0;
+  pm->pm_seekable    = 0;
+  pm->pm_sink        = sink;
+  pm->pm_sink_opaque = opaque;
+  pm->pm_filename    = strdup("Live sink");
+
+  return 0;
+}
+
+
 /**
  * Open the file and set the file descriptor
  */
@@ -396,6 +419,7 @@ pass_muxer_open_file(muxer_t *m, const char *filename)
   pm->pm_seekable = 1;
   pm->pm_fd       = fd;
   pm->pm_filename = strdup(filename);
+  pm->m_writer    = muxer_writer_create(fd, filename, pm->m_config.m_cache);
   return 0;
 }
 
@@ -410,6 +434,13 @@ pass_muxer_write(muxer_t *m, const void *data, size_t size)
 
   if(pm->pm_error) {
     pm->m_errors++;
+  } else if(pm->pm_sink) {
+    pm->pm_sink(pm->pm_sink_opaque, data, size);
+    pm->pm_off += size;
+  } else if(pm->m_writer) {
+    if((pm->pm_error = muxer_writer_write(pm->m_writer, data, size)) != 0)
+      m->m_errors++;
+    pm->pm_off += size;
   } else if(tvh_write(pm->pm_fd, data, size)) {
     pm->pm_error = errno;
     if (!MC_IS_EOS_ERROR(errno))
@@ -540,6 +571,16 @@ static int
 pass_muxer_close(muxer_t *m)
 {
   pass_muxer_t *pm = (pass_muxer_t*)m;
+  int r;
+
+  if(pm->m_writer) {
+    r = muxer_writer_destroy(pm->m_writer);
+    pm->m_writer = NULL;
+    if(r && !pm->pm_error) {
+      pm->pm_error = r;
+      pm->m_errors++;
+    }
+  }
 
   if(pm->pm_seekable && close(pm->pm_fd)) {
     pm->pm_error = errno;
@@ -561,6 +602,9 @@ pass_muxer_destroy(muxer_t *m)
 {
   pass_muxer_t *pm = (pass_muxer_t*)m;
 
+  if(pm->m_writer)
+    muxer_writer_destroy(pm->m_writer);
+
   if(pm->pm_filename)
     free(pm->pm_filename);
 
@@ -590,6 +634,7 @@ pass_muxer_create(const muxer_config_t *m_cfg)
   pm = calloc(1, sizeof(pass_muxer_t));
   pm->m_open_stream  = pass_muxer_open_stream;
   pm->m_open_file    = pass_muxer_open_file;
+  pm->m_open_sink    = pass_muxer_open_sink;
   pm->m_init         = pass_muxer_init;
   pm->m_reconfigure  = pass_muxer_reconfigure;
   pm->m_mime         = pass_muxer_mime;
@@ -0,0 +1,350 @@
+/*
+ *  tvheadend, asynchronous file writer for the muxers
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <htmlui://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include <unistd.h>
+
+#include "tvheadend.h"
+#include "muxer.h"
+#include "muxer_writer.h"
+
+#define MW_BUF_SIZE     (1024 * 1024)
+#define MW_BUF_ALIGN    4096
+#define MW_BUF_MAXQUEUE 32
+#define MW_BUF_MAXFREE  4
+#define MW_BUF_MAXAGE   sec2mono(1)
+
+typedef struct muxer_writer_buf {
+  TAILQ_ENTRY(muxer_writer_buf) mwb_link;
+  off_t    mwb_pos;
+  size_t   mwb_len;
+  int64_t  mwb_created;
+  uint8_t *mwb_data;
+} muxer_writer_buf_t;
+
+TAILQ_HEAD(muxer_writer_buf_queue, muxer_writer_buf);
+
+typedef struct muxer_writer {
+  int                  mw_fd;
+  int                  mw_cache;
+  char                *mw_filename;
+
+  pthread_t            mw_tid;
+  pthread_mutex_t      mw_lock;
+  tvh_cond_t           mw_cond;      /* data for the writer thread */
+  tvh_cond_t           mw_space;     /* free space for the producer */
+  int                  mw_run;
+  int                  mw_error;
+
+  /* Producer side */
+  muxer_writer_buf_t  *mw_cur;
+  off_t                mw_pos;
+
+  /* Shared (mw_lock) */
+  struct muxer_writer_buf_queue mw_queue;
+  struct muxer_writer_buf_queue mw_free;
+  int                  mw_nqueue;
+  int                  mw_nfree;
+  size_t               mw_queued;
+  int64_t              mw_latency;
+  int64_t              mw_latency_max;
+} muxer_writer_t;
+
+/**
+ *
+ */
+static muxer_writer_buf_t *
+muxer_writer_buf_get(muxer_writer_t *mw)
+{
+  muxer_writer_buf_t *mwb;
+  void *data;
+
+  pthread_mutex_lock(&mw->mw_lock);
+  mwb = TAILQ_FIRST(&mw->mw_free);
+  if (mwb) {
+    TAILQ_REMOVE(&mw->mw_free, mwb, mwb_link);
+    mw->mw_nfree--;
+  }
+  pthread_mutex_unlock(&mw->mw_lock);
+  if (mwb == NULL) {
+    if (posix_memalign(&data, MW_BUF_ALIGN, MW_BUF_SIZE))
+      return NULL;
+    mwb = malloc(sizeof(*mwb));
+    mwb->mwb_data = data;
+  }
+  mwb->mwb_pos = mw->mw_pos;
+  mwb->mwb_len = 0;
+  mwb->mwb_created = mclk();
+  return mwb;
+}
+
+/**
+ *
+ */
+static void
+muxer_writer_buf_free(muxer_writer_buf_t *mwb)
+{
+  free(mwb->mwb_data);
+  free(mwb);
+}
+
+/**
+ * Pass the current buffer to the writer thread, wait when
+ * the queue is full (the disk is too slow)
+ */
+static int
+muxer_writer_submit(muxer_writer_t *mw)
+{
+  muxer_writer_buf_t *mwb = mw->mw_cur;
+  int r;
+
+  if (mwb == NULL)
+    return mw->mw_error;
+  mw->mw_cur = NULL;
+  pthread_mutex_lock(&mw->mw_lock);
+  while (mw->mw_nqueue >= MW_BUF_MAXQUEUE && !mw->mw_error)
+    tvh_cond_wait(&mw->mw_space, &mw->mw_lock);
+  if ((r = mw->mw_error) == 0) {
+    TAILQ_INSERT_TAIL(&mw->mw_queue, mwb, mwb_link);
+    mw->mw_nqueue++;
+    mw->mw_queued += mwb->mwb_len;
+    tvh_cond_signal(&mw->mw_cond, 0);
+    mwb = NULL;
+  }
+  pthread_mutex_unlock(&mw->mw_lock);
+  if (mwb)
+    muxer_writer_buf_free(mwb);
+  return r;
+}
+
+/**
+ *
+ */
+static int
+muxer_writer_pwrite(muxer_writer_t *mw, muxer_writer_buf_t *mwb)
+{
+  uint8_t *data = mwb->mwb_data;
+  size_t len = mwb->mwb_len;
+  off_t pos = mwb->mwb_pos;
+  ssize_t r;
+
+  while (len > 0) {
+    r = pwrite(mw->mw_fd, data, len, pos);
+    if (r < 0) {
+      if (ERRNO_AGAIN(errno))
+        continue;
+      return errno;
+    }
+    data += r;
+    pos += r;
+    len -= r;
+  }
+  muxer_cache_fd(mw->mw_cache, mw->mw_fd, mwb->mwb_pos, mwb->mwb_len);
+  return 0;
+}
+
+/**
+ *
+ */
+static void *
+muxer_writer_thread(void *aux)
+{
+  muxer_writer_t *mw = aux;
+  muxer_writer_buf_t *mwb;
+  int64_t t;
+  int r;
+
+  pthread_mutex_lock(&mw->mw_lock);
+  while (1) {
+    mwb = TAILQ_FIRST(&mw->mw_queue);
+    if (mwb == NULL) {
+      if (!mw->mw_run)
+        break;
+      tvh_cond_wait(&mw->mw_cond, &mw->mw_lock);
+      continue;
+    }
+    TAILQ_REMOVE(&mw->mw_queue, mwb, mwb_link);
+    pthread_mutex_unlock(&mw->mw_lock);
+
+    r = 0;
+    t = getmonoclock();
+    if (!mw->mw_error)
+      r = muxer_writer_pwrite(mw, mwb);
+    t = getmonoclock() - t;
+
+    pthread_mutex_lock(&mw->mw_lock);
+    if (r && !mw->mw_error) {
+      mw->mw_error = r;
+      tvhlog(LOG_ERR, "muxer", "%s: Write failed -- %s",
+             mw->mw_filename, strerror(r));
+    }
+    mw->mw_nqueue--;
+    mw->mw_queued -= mwb->mwb_len;
+    mw->mw_latency = mw->mw_latency ? (mw->mw_latency * 7 + t) / 8 : t;
+    if (t > mw->mw_latency_max)
+      mw->mw_latency_max = t;
+    if (mw->mw_nfree < MW_BUF_MAXFREE) {
+      TAILQ_INSERT_TAIL(&mw->mw_free, mwb, mwb_link);
+      mw->mw_nfree++;
+    } else {
+      muxer_writer_buf_free(mwb);
+    }
+    tvh_cond_signal(&mw->mw_space, 0);
+  }
+  pthread_mutex_unlock(&mw->mw_lock);
+  return NULL;
+}
+
+/**
+ * Create the writer for an open file descriptor
+ */
+muxer_writer_t *
+muxer_writer_create(int fd, const char *filename, int cache)
+{
+  muxer_writer_t *mw = calloc(1, sizeof(*mw));
+
+  mw->mw_fd = fd;
+  mw->mw_cache = cache;
+  mw->mw_filename = strdup(filename);
+  mw->mw_run = 1;
+  TAILQ_INIT(&mw->mw_queue);
+  TAILQ_INIT(&mw->mw_free);
+  pthread_mutex_init(&mw->mw_lock, NULL);
+  tvh_cond_init(&mw->mw_cond);
+  tvh_cond_init(&mw->mw_space);
+  if (tvhthread_create(&mw->mw_tid, NULL, muxer_writer_thread, mw, "mwriter")) {
+    tvh_cond_destroy(&mw->mw_space);
+    tvh_cond_destroy(&mw->mw_cond);
+    free(mw->mw_filename);
+    free(mw);
+    return NULL;
+  }
+  return mw;
+}
+
+/**
+ * Append data at the current position, returns a (sticky) error
+ * from the writer thread
+ */
+int
+muxer_writer_write(muxer_writer_t *mw, const void *data, size_t size)
+{
+  muxer_writer_buf_t *mwb;
+  const uint8_t *p = data;
+  size_t l;
+  int r;
+
+  if (mw->mw_error)
+    return mw->mw_error;
+  while (size > 0) {
+    if ((mwb = mw->mw_cur) == NULL) {
+      if ((mwb = mw->mw_cur = muxer_writer_buf_get(mw)) == NULL)
+        return ENOMEM;
+    }
+    l = MIN(size, MW_BUF_SIZE - mwb->mwb_len);
+    memcpy(mwb->mwb_data + mwb->mwb_len, p, l);
+    mwb->mwb_len += l;
+    mw->mw_pos += l;
+    p += l;
+    size -= l;
+    if (mwb->mwb_len == MW_BUF_SIZE)
+      if ((r = muxer_writer_submit(mw)) != 0)
+        return r;
+  }
+  /* do not hold the data too long for low bitrate streams */
+  if (mw->mw_cur && mw->mw_cur->mwb_created + MW_BUF_MAXAGE < mclk())
+    return muxer_writer_submit(mw);
+  return 0;
+}
+
+/**
+ * Change the write position (the next write starts a new buffer)
+ */
+int
+muxer_writer_seek(muxer_writer_t *mw, off_t pos)
+{
+  int r = 0;
+
+  if (mw->mw_cur) {
+    if (mw->mw_cur->mwb_len == 0)
+      mw->mw_cur->mwb_pos = pos;
+    else
+      r = muxer_writer_submit(mw);
+  }
+  mw->mw_pos = pos;
+  return r;
+}
+
+/**
+ *
+ */
+off_t
+muxer_writer_pos(muxer_writer_t *mw)
+{
+  return mw->mw_pos;
+}
+
+/**
+ * Flush all data to the disk and free the writer, the file
+ * descriptor is not closed
+ */
+int
+muxer_writer_destroy(muxer_writer_t *mw)
+{
+  muxer_writer_buf_t *mwb;
+  int r;
+
+  if (mw->mw_cur && mw->mw_cur->mwb_len == 0) {
+    muxer_writer_buf_free(mw->mw_cur);
+    mw->mw_cur = NULL;
+  }
+  muxer_writer_submit(mw);
+  pthread_mutex_lock(&mw->mw_lock);
+  mw->mw_run = 0;
+  tvh_cond_signal(&mw->mw_cond, 0);
+  pthread_mutex_unlock(&mw->mw_lock);
+  pthread_join(mw->mw_tid, NULL);
+  r = mw->mw_error;
+  while ((mwb = TAILQ_FIRST(&mw->mw_free)) != NULL) {
+    TAILQ_REMOVE(&mw->mw_free, mwb, mwb_link);
+    muxer_writer_buf_free(mwb);
+  }
+  tvh_cond_destroy(&mw->mw_space);
+  tvh_cond_destroy(&mw->mw_cond);
+  free(mw->mw_filename);
+  free(mw);
+  return r;
+}
+
+/**
+ *
+ */
+void
+muxer_writer_stats(muxer_writer_t *mw, muxer_writer_stats_t *stats)
+{
+  pthread_mutex_lock(&mw->mw_lock);
+  stats->mws_latency     = mw->mw_latency;
+  stats->mws_latency_max = mw->mw_latency_max;
+  stats->mws_queued      = mw->mw_queued;
+  stats->mws_buffers     = mw->mw_nqueue;
+  pthread_mutex_unlock(&mw->mw_lock);
+  if (mw->mw_cur) {
+    stats->mws_queued += mw->mw_cur->mwb_len;
+    stats->mws_buffers++;
+  }
+}
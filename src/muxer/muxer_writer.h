@@ -0,0 +1,52 @@
+/*
+ *  tvheadend, asynchronous file writer for the muxers
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <htmlui://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUXER_WRITER_H_
+#define MUXER_WRITER_H_
+
+#include <sys/types.h>
+
+/*
+ * The writer collects the muxed data into large aligned buffers and
+ * hands them over to a dedicated thread, so a slow disk does not
+ * block the recording thread. The cache scheme (sync / fadvise)
+ * is applied from the writer thread, too.
+ */
+
+struct muxer_writer;
+
+typedef struct muxer_writer_stats {
+  int64_t  mws_latency;      /* average write latency (us) */
+  int64_t  mws_latency_max;  /* maximal write latency (us) */
+  size_t   mws_queued;       /* bytes waiting for the disk */
+  int      mws_buffers;      /* buffers waiting for the disk */
+} muxer_writer_stats_t;
+
+struct muxer_writer *muxer_writer_create(int fd, const char *filename, int cache);
+
+int   muxer_writer_write(struct muxer_writer *mw, const void *data, size_t size);
+
+int   muxer_writer_seek(struct muxer_writer *mw, off_t pos);
+
+off_t muxer_writer_pos(struct muxer_writer *mw);
+
+int   muxer_writer_destroy(struct muxer_writer *mw);
+
+void  muxer_writer_stats(struct muxer_writer *mw, muxer_writer_stats_t *stats);
+
+#endif
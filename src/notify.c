@@ -36,6 +36,7 @@ void
 notify_by_msg(const char *class, htsmsg_t *m, int rewrite)
 {
   htsmsg_add_str(m, "notificationClass", class);
+  page_cache_notify(class);
   comet_mailbox_add_message(m, 0, rewrite);
   htsmsg_destroy(m);
 }
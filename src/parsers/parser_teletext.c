@@ -703,6 +703,7 @@ extract_subtitle(mpegts_service_t *t, elementary_stream_t *st,
   uint8_t sub[2000];
   uint8_t *cset, ch;
   int is_box = 0;
+  streaming_message_t *sm;
 
   if ((cset = get_cset((ttm->ttm_charset[0] & ~7) + ttm->ttm_national)) == NULL)
     if ((cset = get_cset(ttm->ttm_charset[0])) == NULL)
@@ -801,7 +802,9 @@ extract_subtitle(mpegts_service_t *t, elementary_stream_t *st,
   th_pkt_t *pkt = pkt_alloc(sub, off, pts, pts);
   pkt->pkt_componentindex = st->es_index;
 
-  streaming_pad_deliver(&t->s_streaming_pad, streaming_msg_create_pkt(pkt));
+  sm = streaming_msg_create_pkt(pkt);
+  service_gop_cache_add((service_t *)t, sm, 0);
+  streaming_pad_deliver(&t->s_streaming_pad, sm);
 
   /* Decrease our own reference to the packet */
   pkt_ref_dec(pkt);
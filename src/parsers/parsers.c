@@ -1811,6 +1811,8 @@ parse_teletext(service_t *t, elementary_stream_t *st, const uint8_t *data,
 static void
 parser_deliver(service_t *t, elementary_stream_t *st, th_pkt_t *pkt)
 {
+  streaming_message_t *sm;
+
   if(SCT_ISAUDIO(st->es_type) && pkt->pkt_pts != PTS_UNSET &&
      (t->s_current_pts == PTS_UNSET ||
       pkt->pkt_pts > t->s_current_pts ||
@@ -1846,7 +1848,10 @@ parser_deliver(service_t *t, elementary_stream_t *st, th_pkt_t *pkt)
   /* Forward packet */
   pkt->pkt_componentindex = st->es_index;
 
-  streaming_pad_deliver(&t->s_streaming_pad, streaming_msg_create_pkt(pkt));
+  sm = streaming_msg_create_pkt(pkt);
+  service_gop_cache_add(t, sm, SCT_ISVIDEO(st->es_type) &&
+                               pkt->pkt_frametype == PKT_I_FRAME);
+  streaming_pad_deliver(&t->s_streaming_pad, sm);
 
   /* Decrease our own reference to the packet */
   pkt_ref_dec(pkt);
@@ -594,7 +594,10 @@ profile_get_htsp_list(htsmsg_t *array, htsmsg_t *filter)
 static void
 profile_deliver(profile_chain_t *prch, streaming_message_t *sm)
 {
-  if (prch->prch_start_pending) {
+  if (sm && sm->sm_type == SMT_START) {
+    /* the chain became master, the pending start is replaced */
+    prch->prch_start_pending = 0;
+  } else if (prch->prch_start_pending) {
     profile_sharer_t *prsh = prch->prch_sharer;
     streaming_message_t *sm2;
     if (!prsh->prsh_start_msg) {
@@ -702,6 +705,10 @@ profile_sharer_input(void *opaque, streaming_message_t *sm)
     if (prsh->prsh_start_msg)
       streaming_start_unref(prsh->prsh_start_msg);
     prsh->prsh_start_msg = NULL;
+  } else if (sm->sm_type == SMT_START) {
+    /* the shared timeline restarts (service restart), rebase the joiners */
+    LIST_FOREACH(prch, &prsh->prsh_chains, prch_sharer_link)
+      prch->prch_ts_delta = prch == prsh->prsh_master ? 0 : PTS_UNSET;
   }
   for (prch = LIST_FIRST(&prsh->prsh_chains); prch; prch = next) {
     next = LIST_NEXT(prch, prch_sharer_link);
@@ -716,6 +723,8 @@ profile_sharer_input(void *opaque, streaming_message_t *sm)
       run = prch;
       continue;
     } else if (sm->sm_type == SMT_STOP) {
+      if (run)
+        profile_sharer_deliver(run, streaming_msg_clone(sm));
       run = prch;
       continue;
     }
@@ -1228,18 +1237,46 @@ profile_matroska_reopen(profile_chain_t *prch,
   return 0;
 }
 
+static int
+profile_matroska_can_share(profile_chain_t *prch,
+                           profile_chain_t *joiner)
+{
+  profile_matroska_t *pro1 = (profile_matroska_t *)prch->prch_pro;
+  profile_matroska_t *pro2 = (profile_matroska_t *)joiner->prch_pro;
+  if (pro1 == pro2)
+    return 1;
+  if (!idnode_is_instance(&pro2->pro_id, &profile_matroska_class))
+    return 0;
+  /* only the muxer setup is per chain */
+  return pro1->pro_webm == pro2->pro_webm;
+}
+
 static int
 profile_matroska_open(profile_chain_t *prch,
                       muxer_config_t *m_cfg, int flags, size_t qsize)
 {
+  profile_sharer_t *prsh;
   streaming_target_t *dst;
 
   prch->prch_flags = SUBSCRIPTION_PACKET;
   prch->prch_sq.sq_maxsize = qsize;
 
-  dst = prch->prch_gh    = globalheaders_create(&prch->prch_sq.sq_st);
-  dst = prch->prch_tsfix = tsfix_create(dst);
-  prch->prch_st    = dst;
+  if (flags & PROFILE_CHAIN_SHARE) {
+    prsh = profile_sharer_find(prch);
+    prch->prch_can_share = profile_matroska_can_share;
+    dst = prch->prch_gh = globalheaders_create(&prch->prch_sq.sq_st);
+    if (profile_sharer_create(prsh, prch, dst))
+      return -1;
+    if (!prsh->prsh_tsfix)
+      prsh->prsh_tsfix = tsfix_create(&prsh->prsh_input);
+    prch->prch_share = prsh->prsh_tsfix;
+    streaming_target_init(&prch->prch_input, profile_input, prch, 0);
+    prch->prch_st = &prch->prch_input;
+  } else {
+    dst = prch->prch_gh    = globalheaders_create(&prch->prch_sq.sq_st);
+    dst = prch->prch_tsfix = tsfix_create(dst);
+    prch->prch_st    = dst;
+  }
 
   profile_matroska_reopen(prch, m_cfg, flags);
 
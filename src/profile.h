@@ -43,6 +43,9 @@ typedef enum {
   PROFILE_SVF_HD
 } profile_svfilter_t;
 
+/* profile_chain_open() flags */
+#define PROFILE_CHAIN_SHARE  (1<<0)  /* join a compatible chain with the same id */
+
 struct profile;
 struct muxer;
 struct streaming_target;
@@ -50,9 +50,133 @@ const static struct strtab typetab[] = {
 };
 
 
+/* **************************************************************************
+ * Lookup
+ * *************************************************************************/
+
+/*
+ * Hashed property tables (open addressing) - one table per owner
+ * (property array or flattened class hierarchy), the owners are
+ * hashed by pointer to a fixed number of buckets. Tables are never
+ * modified after they are published, so the lookups are lock-free.
+ */
+#define PROP_INDEX_BUCKETS 512
+
+typedef struct prop_index {
+  struct prop_index  *next;
+  const void         *owner;
+  uint32_t            mask;
+  const property_t  **slots;
+} prop_index_t;
+
+static prop_index_t *prop_index[PROP_INDEX_BUCKETS];
+
+static inline uint32_t
+prop_index_owner_hash(const void *owner)
+{
+  uintptr_t v = (uintptr_t)owner;
+  return (uint32_t)((v >> 4) ^ (v >> 13)) & (PROP_INDEX_BUCKETS - 1);
+}
+
+static inline uint32_t
+prop_index_id_hash(const char *id)
+{
+  uint32_t h = 2166136261U;
+  for ( ; *id; id++)
+    h = (h ^ (uint8_t)*id) * 16777619U;
+  return h;
+}
+
+void
+prop_index_build
+  (const void *owner, const property_t * const *lists, int count)
+{
+  prop_index_t *pi;
+  const property_t *p, **slot;
+  uint32_t bucket = prop_index_owner_hash(owner), size, h;
+  int i, n = 0;
+
+  for (pi = prop_index[bucket]; pi; pi = pi->next)
+    if (pi->owner == owner)
+      return;
+
+  for (i = 0; i < count; i++)
+    if (lists[i])
+      for (p = lists[i]; p->id; p++)
+        n++;
+  for (size = 8; size < n * 2; size <<= 1);
+
+  pi = calloc(1, sizeof(*pi));
+  pi->owner = owner;
+  pi->mask  = size - 1;
+  pi->slots = calloc(size, sizeof(property_t *));
+  for (i = 0; i < count; i++) {
+    if (lists[i] == NULL)
+      continue;
+    for (p = lists[i]; p->id; p++) {
+      for (h = prop_index_id_hash(p->id); ; h++) {
+        slot = &pi->slots[h & pi->mask];
+        /* the first definition wins (like the linear walk) */
+        if (*slot == NULL)
+          *slot = p;
+        else if (strcmp((*slot)->id, p->id))
+          continue;
+        break;
+      }
+    }
+  }
+  pi->next = prop_index[bucket];
+  __sync_synchronize();
+  prop_index[bucket] = pi;
+}
+
+/*
+ * Returns -1 if the owner is not indexed, otherwise 0 and *res
+ * is set (NULL when the property does not exist)
+ */
+int
+prop_index_find
+  (const void *owner, const char *id, const property_t **res)
+{
+  prop_index_t *pi;
+  const property_t *p;
+  uint32_t h;
+
+  for (pi = prop_index[prop_index_owner_hash(owner)]; pi; pi = pi->next) {
+    if (pi->owner != owner)
+      continue;
+    for (h = prop_index_id_hash(id); ; h++) {
+      p = pi->slots[h & pi->mask];
+      if (p == NULL || !strcmp(p->id, id)) {
+        *res = p;
+        return 0;
+      }
+    }
+  }
+  return -1;
+}
+
+void
+prop_index_done(void)
+{
+  prop_index_t *pi;
+  int i;
+
+  for (i = 0; i < PROP_INDEX_BUCKETS; i++)
+    while ((pi = prop_index[i]) != NULL) {
+      prop_index[i] = pi->next;
+      free(pi->slots);
+      free(pi);
+    }
+}
+
 const property_t *
 prop_find(const property_t *p, const char *id)
 {
+  const property_t *r;
+
+  if (!prop_index_find(p, id, &r))
+    return r;
   for(; p->id; p++)
     if(!strcmp(id, p->id))
       return p;
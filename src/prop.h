@@ -128,6 +128,12 @@ typedef struct property {
 extern char prop_sbuf[PROP_SBUF_LEN];
 extern char *prop_sbuf_ptr;
 
+void prop_index_build
+  (const void *owner, const property_t * const *lists, int count);
+int prop_index_find
+  (const void *owner, const char *id, const property_t **res);
+void prop_index_done(void);
+
 const property_t *prop_find(const property_t *p, const char *name);
 
 int prop_write_values
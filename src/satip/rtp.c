@@ -17,6 +17,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define _GNU_SOURCE /* for sendmmsg() */
 #include <signal.h>
 #include <ctype.h>
 #include "tvheadend.h"
@@ -31,6 +32,9 @@
 
 #define RTP_PACKETS 128
 #define RTP_PAYLOAD (7*188+12)
+#define RTP_IOVECS  (RTP_PACKETS*4)
+#define RTP_PKTBUFS (RTP_PACKETS*2)
+#define RTP_GSO_SEGS 48 /* 48 * 1328 bytes = cca 64kB per datagram */
 #define RTP_TCP_PAYLOAD (87*188+12+4) /* cca 16kB */
 #define RTCP_PAYLOAD (1420)
 
@@ -41,6 +45,32 @@ typedef struct satip_rtp_table {
   int remove_mark;
 } satip_rtp_table_t;
 
+/*
+ * UDP output - the iovecs point directly to the TS data in the
+ * refcounted packet buffers, only the RTP headers are built here.
+ * A partial RTP packet is copied to the carry buffer when the batch
+ * is sent, so the packet buffers are released after each batch.
+ */
+typedef struct satip_rtp_batch {
+  int packets;                    /* started RTP packets */
+  int iovs;
+  int npbs;
+  int carry_idx;
+  int gso;
+  struct iovec iov[RTP_IOVECS];
+  int pkt_iov[RTP_PACKETS + 1];   /* first iovec of the packet */
+  int pkt_len[RTP_PACKETS];
+  uint8_t hdr[RTP_PACKETS][12];
+  pktbuf_t *pbs[RTP_PKTBUFS];
+  uint8_t carry[2][RTP_PAYLOAD];
+  struct mmsghdr msg[RTP_PACKETS];
+  uint8_t cmsg[RTP_PACKETS / RTP_GSO_SEGS + 1][UDP_GSO_CMSG_SPACE];
+  /* statistics */
+  uint64_t syscalls;
+  uint64_t bytes;
+  uint64_t dropped;
+} satip_rtp_batch_t;
+
 typedef struct satip_rtp_session {
   TAILQ_ENTRY(satip_rtp_session) link;
   pthread_t tid;
@@ -57,10 +87,10 @@ typedef struct satip_rtp_session {
   dvb_mux_conf_t dmc;
   mpegts_apids_t pids;
   TAILQ_HEAD(, satip_rtp_table) pmt_tables;
-  udp_multisend_t um;
-  struct iovec *um_iovec;
+  uint32_t pid_map[8192 / 32];    /* accepted PIDs */
+  uint32_t pmt_map[8192 / 32];    /* PIDs with a PMT table to rewrite */
+  satip_rtp_batch_t *batch;
   struct iovec tcp_data;
-  int um_packet;
   uint16_t seq;
   signal_status_t sig;
   int sig_lock;
@@ -137,125 +167,287 @@ satip_rtp_pmt_cb(mpegts_psi_table_t *mt, const uint8_t *buf, int len)
 }
 
 static void
-satip_rtp_header(satip_rtp_session_t *rtp, struct iovec *v, uint32_t off)
+satip_rtp_header_data(satip_rtp_session_t *rtp, uint8_t *data)
 {
-  uint8_t *data = v->iov_base;
   uint32_t tstamp = mono2sec(mclk()) + rtp->seq;
 
   rtp->seq++;
 
+  data[0] = 0x80;
+  data[1] = 33;
+  data[2] = (rtp->seq >> 8) & 0xff;
+  data[3] = rtp->seq & 0xff;
+  data[4] = (tstamp >> 24) & 0xff;
+  data[5] = (tstamp >> 16) & 0xff;
+  data[6] = (tstamp >> 8) & 0xff;
+  data[7] = tstamp & 0xff;
+  memset(data + 8, 0xa5, 4);
+}
+
+static void
+satip_rtp_header(satip_rtp_session_t *rtp, struct iovec *v, uint32_t off)
+{
   v->iov_len = off + 12;
-  data[off+0] = 0x80;
-  data[off+1] = 33;
-  data[off+2] = (rtp->seq >> 8) & 0xff;
-  data[off+3] = rtp->seq & 0xff;
-  data[off+4] = (tstamp >> 24) & 0xff;
-  data[off+5] = (tstamp >> 16) & 0xff;
-  data[off+6] = (tstamp >> 8) & 0xff;
-  data[off+7] = tstamp & 0xff;
-  memset(data + off + 8, 0xa5, 4);
+  satip_rtp_header_data(rtp, (uint8_t *)v->iov_base + off);
 }
 
 static int
-satip_rtp_send(satip_rtp_session_t *rtp)
+satip_rtp_sendmsg(satip_rtp_session_t *rtp, int complete)
 {
-  struct iovec *v = rtp->um_iovec, *v2;
-  int packets, copy, len, r;
-  if (v->iov_len == RTP_PAYLOAD) {
-    packets = rtp->um_packet;
-    v2 = v + packets;
-    copy = 1;
-    if (v2->iov_len == RTP_PAYLOAD) {
-      packets++;
-      copy = 0;
-    }
-    r = udp_multisend_send(&rtp->um, rtp->fd_rtp, packets);
-    if (r < 0)
+  satip_rtp_batch_t *b = rtp->batch;
+  struct msghdr *mh;
+  int i, n, segs, msgs, r;
+
+  /* one datagram per packet or one GSO datagram per RTP_GSO_SEGS packets */
+  segs = b->gso ? RTP_GSO_SEGS : 1;
+  for (i = msgs = 0; i < complete; i += n, msgs++) {
+    n = MIN(segs, complete - i);
+    mh = &b->msg[msgs].msg_hdr;
+    memset(mh, 0, sizeof(*mh));
+    mh->msg_iov = &b->iov[b->pkt_iov[i]];
+    mh->msg_iovlen = b->pkt_iov[i + n] - b->pkt_iov[i];
+    if (n > 1)
+      udp_gso_set(mh, b->cmsg[msgs], RTP_PAYLOAD);
+  }
+  r = udp_sendmmsg(rtp->fd_rtp, b->msg, msgs);
+  b->syscalls++;
+  if (r < 0 && b->gso && (errno == EIO || errno == EINVAL ||
+                          errno == ENOPROTOOPT || errno == EOPNOTSUPP)) {
+    tvhdebug("satips", "RTP GSO is not available (%s)", strerror(errno));
+    b->gso = 0;
+    return satip_rtp_sendmsg(rtp, complete);
+  }
+  if (r < 0) {
+    if (!ERRNO_AGAIN(errno) && errno != ENOBUFS)
       return r;
-    if (copy)
-      memcpy(v->iov_base, v2->iov_base, len = v2->iov_len);
-    else
-      len = 0;
-    rtp->um_packet = 0;
-    udp_multisend_clean(&rtp->um);
-    v->iov_len = len;
+    r = 0;
   }
-  if (v->iov_len == 0)
-    satip_rtp_header(rtp, rtp->um_iovec + rtp->um_packet, 0);
+  for (i = 0; i < r; i++)
+    b->bytes += b->msg[i].msg_len;
+  for (i = r; i < msgs; i++)
+    b->dropped++;
   return 0;
 }
 
-static inline int
-satip_rtp_append_data(satip_rtp_session_t *rtp, struct iovec **_v, uint8_t *data)
+/*
+ * Send the complete RTP packets, the partial one is kept
+ */
+static int
+satip_rtp_send(satip_rtp_session_t *rtp)
 {
-  struct iovec *v = *_v;
-  int r;
-  assert(v->iov_len + 188 <= RTP_PAYLOAD);
-  memcpy(v->iov_base + v->iov_len, data, 188);
-  v->iov_len += 188;
-  if (v->iov_len == RTP_PAYLOAD) {
-    if ((rtp->um_packet + 1) == RTP_PACKETS) {
-      r = satip_rtp_send(rtp);
-      if (r < 0)
-        return r;
-    } else {
-      rtp->um_packet++;
-      satip_rtp_header(rtp, rtp->um_iovec + rtp->um_packet, 0);
+  satip_rtp_batch_t *b = rtp->batch;
+  struct iovec *v;
+  uint8_t *carry;
+  int i, complete, len, r = 0;
+
+  complete = b->packets;
+  if (complete > 0 && b->pkt_len[complete - 1] != RTP_PAYLOAD)
+    complete--;
+  if (complete > 0) {
+    b->pkt_iov[complete] = complete < b->packets ? b->pkt_iov[complete] : b->iovs;
+    r = satip_rtp_sendmsg(rtp, complete);
+  }
+
+  if (complete < b->packets) {
+    /* partial packet - carry the payload to the next batch */
+    b->carry_idx ^= 1;
+    carry = b->carry[b->carry_idx];
+    for (i = b->pkt_iov[complete] + 1, len = 0; i < b->iovs; i++) {
+      v = &b->iov[i];
+      memcpy(carry + len, v->iov_base, v->iov_len);
+      len += v->iov_len;
+    }
+    if (complete > 0)
+      memcpy(b->hdr[0], b->hdr[complete], 12);
+    b->packets = 1;
+    b->iov[0].iov_base = b->hdr[0];
+    b->iov[0].iov_len = 12;
+    b->iovs = 1;
+    if (len > 0) {
+      b->iov[1].iov_base = carry;
+      b->iov[1].iov_len = len;
+      b->iovs = 2;
     }
-    *_v = rtp->um_iovec + rtp->um_packet;
+    b->pkt_iov[0] = 0;
+    b->pkt_len[0] = 12 + len;
   } else {
-    assert(v->iov_len < RTP_PAYLOAD);
+    b->packets = b->iovs = 0;
+  }
+
+  for (i = 0; i < b->npbs; i++)
+    pktbuf_ref_dec(b->pbs[i]);
+  b->npbs = 0;
+  return r;
+}
+
+/*
+ * Append the continuous TS data, the memory belongs to pb
+ */
+static int
+satip_rtp_append_data(satip_rtp_session_t *rtp, pktbuf_t *pb,
+                      uint8_t *data, int len)
+{
+  satip_rtp_batch_t *b = rtp->batch;
+  struct iovec *v;
+  int n, pkt, r;
+
+  while (len > 0) {
+    pkt = b->packets - 1;
+    if (pkt < 0 || b->pkt_len[pkt] == RTP_PAYLOAD) {
+      if (b->packets == RTP_PACKETS || b->iovs + 2 > RTP_IOVECS) {
+        if ((r = satip_rtp_send(rtp)) < 0)
+          return r;
+        continue;
+      }
+      pkt = b->packets++;
+      satip_rtp_header_data(rtp, b->hdr[pkt]);
+      b->pkt_iov[pkt] = b->iovs;
+      b->pkt_len[pkt] = 12;
+      v = &b->iov[b->iovs++];
+      v->iov_base = b->hdr[pkt];
+      v->iov_len = 12;
+    }
+    if (b->npbs == 0 || b->pbs[b->npbs - 1] != pb) {
+      if (b->npbs == RTP_PKTBUFS || b->iovs == RTP_IOVECS) {
+        if ((r = satip_rtp_send(rtp)) < 0)
+          return r;
+        continue;
+      }
+      b->pbs[b->npbs++] = pktbuf_ref_inc(pb);
+    }
+    n = MIN(len, RTP_PAYLOAD - b->pkt_len[pkt]);
+    v = &b->iov[b->iovs - 1];
+    if (b->pkt_len[pkt] > 12 && (uint8_t *)v->iov_base + v->iov_len == data) {
+      v->iov_len += n;
+    } else {
+      if (b->iovs == RTP_IOVECS) {
+        if ((r = satip_rtp_send(rtp)) < 0)
+          return r;
+        continue;
+      }
+      v = &b->iov[b->iovs++];
+      v->iov_base = data;
+      v->iov_len = n;
+    }
+    b->pkt_len[pkt] += n;
+    data += n;
+    len -= n;
+    if (b->pkt_len[pkt] == RTP_PAYLOAD && b->packets == RTP_PACKETS)
+      if ((r = satip_rtp_send(rtp)) < 0)
+        return r;
   }
   return 0;
 }
 
+static inline int
+satip_rtp_pid_test(const uint32_t *map, int pid)
+{
+  return (map[pid >> 5] >> (pid & 31)) & 1;
+}
+
+static inline void
+satip_rtp_pid_set(uint32_t *map, int pid)
+{
+  map[(pid & 0x1fff) >> 5] |= 1u << (pid & 31);
+}
+
+/*
+ * Rebuild the PID bitmaps, called with rtp->lock held (or before
+ * the session thread is started)
+ */
+static void
+satip_rtp_update_pid_map(satip_rtp_session_t *rtp)
+{
+  satip_rtp_table_t *tbl;
+  int i;
+
+  memset(rtp->pid_map, 0, sizeof(rtp->pid_map));
+  memset(rtp->pmt_map, 0, sizeof(rtp->pmt_map));
+  if (rtp->pids.all) {
+    memset(rtp->pid_map, 0xff, sizeof(rtp->pid_map));
+    return;
+  }
+  for (i = 0; i < rtp->pids.count; i++)
+    satip_rtp_pid_set(rtp->pid_map, rtp->pids.pids[i].pid);
+  TAILQ_FOREACH(tbl, &rtp->pmt_tables, link)
+    satip_rtp_pid_set(rtp->pmt_map, tbl->pid);
+}
+
+static satip_rtp_table_t *
+satip_rtp_pmt_table(satip_rtp_session_t *rtp, int pid)
+{
+  satip_rtp_table_t *tbl;
+
+  TAILQ_FOREACH(tbl, &rtp->pmt_tables, link)
+    if (tbl->pid == pid)
+      break;
+  return tbl;
+}
+
 static int
-satip_rtp_loop(satip_rtp_session_t *rtp, uint8_t *data, int len)
+satip_rtp_loop(satip_rtp_session_t *rtp, pktbuf_t *pb)
 {
-  int i, j, pid, last_pid = -1, r;
-  mpegts_apid_t *pids = rtp->pids.pids;
-  struct iovec *v = rtp->um_iovec + rtp->um_packet;
+  int pid, r;
   satip_rtp_table_t *tbl;
+  uint8_t *data = pktbuf_ptr(pb), *run = NULL;
+  int len = pktbuf_len(pb);
+  pktbuf_t *tpb;
 
   assert((len % 188) == 0);
   if (len > 0)
     rtp->sig_lock = 1;
   for ( ; len >= 188 ; data += 188, len -= 188) {
     pid = ((data[1] & 0x1f) << 8) | data[2];
-    if (pid != last_pid && !rtp->pids.all) {
-      for (i = 0; i < rtp->pids.count; i++) {
-        j = pids[i].pid;
-        if (pid < j) break;
-        if (j == pid) goto found;
+    if (satip_rtp_pid_test(rtp->pid_map, pid)) {
+      if (!satip_rtp_pid_test(rtp->pmt_map, pid)) {
+        if (run == NULL)
+          run = data;
+        continue;
       }
+    }
+    /* the run ends here - filtered PID or rewritten PMT */
+    if (run) {
+      r = satip_rtp_append_data(rtp, pb, run, data - run);
+      if (r < 0)
+        return r;
+      run = NULL;
+    }
+    if (!satip_rtp_pid_test(rtp->pid_map, pid))
       continue;
-found:
-      TAILQ_FOREACH(tbl, &rtp->pmt_tables, link)
-        if (tbl->pid == pid) {
-          dvb_table_parse(&tbl->tbl, "-", data, 188, 1, 0, satip_rtp_pmt_cb);
-          if (rtp->table_data && rtp->table_data_len) {
-            for (i = 0; i < rtp->table_data_len; i += 188) {
-              r = satip_rtp_append_data(rtp, &v, rtp->table_data + i);
-              if (r < 0)
-                return r;
-            }
-            free(rtp->table_data);
-            rtp->table_data = NULL;
-            rtp->table_data_len = 0;
-          }
-          break;
-        }
-      if (tbl)
-        continue;
-      last_pid = pid;
+    tbl = satip_rtp_pmt_table(rtp, pid);
+    if (tbl == NULL)
+      continue;
+    dvb_table_parse(&tbl->tbl, "-", data, 188, 1, 0, satip_rtp_pmt_cb);
+    if (rtp->table_data && rtp->table_data_len) {
+      tpb = pktbuf_make(rtp->table_data, rtp->table_data_len);
+      r = tpb ? satip_rtp_append_data(rtp, tpb, pktbuf_ptr(tpb),
+                                      pktbuf_len(tpb)) : 0;
+      pktbuf_ref_dec(tpb);
+      rtp->table_data = NULL;
+      rtp->table_data_len = 0;
+      if (r < 0)
+        return r;
     }
-    r = satip_rtp_append_data(rtp, &v, data);
-    if (r < 0)
-      return r;
   }
+  if (run)
+    return satip_rtp_append_data(rtp, pb, run, data - run);
   return 0;
 }
 
+static void
+satip_rtp_batch_done(satip_rtp_session_t *rtp)
+{
+  satip_rtp_batch_t *b = rtp->batch;
+  int i;
+
+  if (b == NULL)
+    return;
+  for (i = 0; i < b->npbs; i++)
+    pktbuf_ref_dec(b->pbs[i]);
+  free(b);
+  rtp->batch = NULL;
+}
+
 static void
 satip_rtp_tcp_data(satip_rtp_session_t *rtp, uint8_t stream, uint8_t *data, size_t data_len)
 {
@@ -280,19 +472,25 @@ satip_rtp_flush_tcp_data(satip_rtp_session_t *rtp)
   v->iov_len = 0;
 }
 
-static inline int
+static int
 satip_rtp_append_tcp_data(satip_rtp_session_t *rtp, uint8_t *data, size_t len)
 {
   struct iovec *v = &rtp->tcp_data;
-  if (v->iov_base == NULL) {
-    v->iov_base = malloc(RTP_TCP_PAYLOAD);
-    satip_rtp_header(rtp, v, 4);
+  size_t l;
+
+  while (len > 0) {
+    if (v->iov_base == NULL) {
+      v->iov_base = malloc(RTP_TCP_PAYLOAD);
+      satip_rtp_header(rtp, v, 4);
+    }
+    l = MIN(len, RTP_TCP_PAYLOAD - v->iov_len);
+    memcpy(v->iov_base + v->iov_len, data, l);
+    v->iov_len += l;
+    data += l;
+    len -= l;
+    if (v->iov_len == RTP_TCP_PAYLOAD)
+      satip_rtp_flush_tcp_data(rtp);
   }
-  assert(v->iov_len + len <= RTP_TCP_PAYLOAD);
-  memcpy(v->iov_base + v->iov_len, data, len);
-  v->iov_len += len;
-  if (v->iov_len == RTP_TCP_PAYLOAD)
-    satip_rtp_flush_tcp_data(rtp);
   return 0;
 }
 
@@ -300,42 +498,43 @@ satip_rtp_append_tcp_data(satip_rtp_session_t *rtp, uint8_t *data, size_t len)
 static int
 satip_rtp_tcp_loop(satip_rtp_session_t *rtp, uint8_t *data, int len)
 {
-  int i, j, pid, last_pid = -1, r;
-  mpegts_apid_t *pids = rtp->pids.pids;
+  int pid, r;
   satip_rtp_table_t *tbl;
+  uint8_t *run = NULL;
 
   assert((len % 188) == 0);
   if (len > 0)
     rtp->sig_lock = 1;
   for ( ; len >= 188 ; data += 188, len -= 188) {
     pid = ((data[1] & 0x1f) << 8) | data[2];
-    if (pid != last_pid && !rtp->pids.all) {
-      for (i = 0; i < rtp->pids.count; i++) {
-        j = pids[i].pid;
-        if (pid < j) break;
-        if (j == pid) goto found;
+    if (satip_rtp_pid_test(rtp->pid_map, pid)) {
+      if (!satip_rtp_pid_test(rtp->pmt_map, pid)) {
+        if (run == NULL)
+          run = data;
+        continue;
       }
+    }
+    if (run) {
+      r = satip_rtp_append_tcp_data(rtp, run, data - run);
+      if (r < 0)
+        return r;
+      run = NULL;
+    }
+    if (!satip_rtp_pid_test(rtp->pid_map, pid))
       continue;
-found:
-      TAILQ_FOREACH(tbl, &rtp->pmt_tables, link)
-        if (tbl->pid == pid) {
-          dvb_table_parse(&tbl->tbl, "-", data, 188, 1, 0, satip_rtp_pmt_cb);
-          if (rtp->table_data && rtp->table_data_len) {
-            satip_rtp_append_tcp_data(rtp, rtp->table_data, rtp->table_data_len);
-            free(rtp->table_data);
-            rtp->table_data = NULL;
-            rtp->table_data_len = 0;
-          }
-          break;
-        }
-      if (tbl)
-        continue;
-      last_pid = pid;
+    tbl = satip_rtp_pmt_table(rtp, pid);
+    if (tbl == NULL)
+      continue;
+    dvb_table_parse(&tbl->tbl, "-", data, 188, 1, 0, satip_rtp_pmt_cb);
+    if (rtp->table_data && rtp->table_data_len) {
+      satip_rtp_append_tcp_data(rtp, rtp->table_data, rtp->table_data_len);
+      free(rtp->table_data);
+      rtp->table_data = NULL;
+      rtp->table_data_len = 0;
     }
-    r = satip_rtp_append_tcp_data(rtp, data, 188);
-    if (r < 0)
-      return r;
   }
+  if (run)
+    return satip_rtp_append_tcp_data(rtp, run, data - run);
   return 0;
 }
 
@@ -390,7 +589,7 @@ satip_rtp_thread(void *aux)
       if (tcp)
         r = satip_rtp_tcp_loop(rtp, pktbuf_ptr(pb), pktbuf_len(pb));
       else
-        r = satip_rtp_loop(rtp, pktbuf_ptr(pb), pktbuf_len(pb));
+        r = satip_rtp_loop(rtp, pb);
       pthread_mutex_unlock(&rtp->lock);
       if (r) fatal = 1;
       break;
@@ -423,6 +622,12 @@ satip_rtp_thread(void *aux)
   tvhdebug("satips", "RTP streaming to %s:%d closed (%s request)%s",
            peername, rtp->port, alive ? "remote" : "streaming",
            fatal ? " (fatal)" : "");
+  if (!tcp && rtp->batch->bytes)
+    tvhdebug("satips", "RTP streaming to %s:%d: %"PRIu64" syscalls, "
+                       "%"PRIu64" bytes, %.1f syscalls/MB, %"PRIu64" dropped%s",
+             peername, rtp->port, rtp->batch->syscalls, rtp->batch->bytes,
+             (double)rtp->batch->syscalls * 1048576 / rtp->batch->bytes,
+             rtp->batch->dropped, rtp->batch->gso ? " (GSO)" : "");
 
   return NULL;
 }
@@ -472,9 +677,16 @@ void satip_rtp_queue(void *id, th_subscription_t *subs,
   mpegts_pid_init(&rtp->pids);
   mpegts_pid_copy(&rtp->pids, pids);
   TAILQ_INIT(&rtp->pmt_tables);
+  satip_rtp_update_pid_map(rtp);
   if (port != RTSP_TCP_DATA) {
-    udp_multisend_init(&rtp->um, RTP_PACKETS, RTP_PAYLOAD, &rtp->um_iovec);
-    satip_rtp_header(rtp, rtp->um_iovec, 0);
+    rtp->batch = calloc(1, sizeof(satip_rtp_batch_t));
+    if (rtp->batch == NULL) {
+      free(rtp);
+      return;
+    }
+#ifdef __linux__
+    rtp->batch->gso = 1;
+#endif
   }
   rtp->frontend = frontend;
   rtp->dmc = *dmc;
@@ -510,6 +722,7 @@ void satip_rtp_update_pids(void *id, mpegts_apids_t *pids)
   if (rtp) {
     pthread_mutex_lock(&rtp->lock);
     mpegts_pid_copy(&rtp->pids, pids);
+    satip_rtp_update_pid_map(rtp);
     pthread_mutex_unlock(&rtp->lock);
   }
   pthread_mutex_unlock(&satip_rtp_lock);
@@ -547,6 +760,7 @@ void satip_rtp_update_pmt_pids(void *id, mpegts_apids_t *pmt_pids)
         free(tbl);
       }
     }
+    satip_rtp_update_pid_map(rtp);
     pthread_mutex_unlock(&rtp->lock);
   }
   pthread_mutex_unlock(&satip_rtp_lock);
@@ -576,7 +790,7 @@ void satip_rtp_close(void *id)
       pthread_mutex_unlock(rtp->tcp_lock);
       free(rtp->tcp_data.iov_base);
     } else {
-      udp_multisend_free(&rtp->um);
+      satip_rtp_batch_done(rtp);
     }
     mpegts_pid_done(&rtp->pids);
     while ((tbl = TAILQ_FIRST(&rtp->pmt_tables)) != NULL) {
@@ -48,6 +48,7 @@
 #include "access.h"
 #include "esfilter.h"
 #include "bouquet.h"
+#include "config.h"
 #include "memoryinfo.h"
 
 static void service_data_timeout(void *aux);
@@ -362,6 +363,8 @@ service_stop(service_t *t)
   TAILQ_FOREACH(st, &t->s_components, es_link)
     stream_clean(st);
 
+  service_gop_cache_flush(t);
+
   t->s_status = SERVICE_IDLE;
   tvhlog_limit_reset(&t->s_tei_log);
 
@@ -998,6 +1001,8 @@ service_create0
   t->s_last_pid = -1;
 
   streaming_pad_init(&t->s_streaming_pad);
+  TAILQ_INIT(&t->s_gop_pkt.sgc_queue);
+  TAILQ_INIT(&t->s_gop_ts.sgc_queue);
 
   /* Load config */
   if (conf)
@@ -1353,6 +1358,8 @@ service_restart(service_t *t)
 
   service_build_filter(t);
 
+  service_gop_cache_flush(t);
+
   if(TAILQ_FIRST(&t->s_filt_components) != NULL) {
     if (had_components)
       streaming_pad_deliver(&t->s_streaming_pad,
@@ -1379,6 +1386,99 @@ refresh:
   descrambler_service_start(t);
 }
 
+/**
+ * GOP cache
+ */
+static void
+service_gop_cache_clear(service_gop_cache_t *sgc)
+{
+  streaming_queue_clear(&sgc->sgc_queue);
+  sgc->sgc_size = 0;
+  sgc->sgc_valid = 0;
+}
+
+static size_t
+service_gop_cache_msg_size(streaming_message_t *sm)
+{
+  th_pkt_t *pkt;
+
+  if (sm->sm_type == SMT_MPEGTS)
+    return pktbuf_len(sm->sm_data);
+  pkt = sm->sm_data;
+  return sizeof(*pkt) + pktbuf_len(pkt->pkt_meta) + pktbuf_len(pkt->pkt_payload);
+}
+
+/**
+ * Remember the delivered message, the key flag starts a new GOP.
+ * Service stream lock must be held.
+ */
+void
+service_gop_cache_add(service_t *t, streaming_message_t *sm, int key)
+{
+  service_gop_cache_t *sgc;
+  streaming_message_t *sm2;
+  size_t size;
+
+  lock_assert(&t->s_stream_mutex);
+
+  if (config.gop_cache == 0 || t->s_type != STYPE_STD)
+    return;
+
+  sgc = sm->sm_type == SMT_MPEGTS ? &t->s_gop_ts : &t->s_gop_pkt;
+  if (key) {
+    service_gop_cache_clear(sgc);
+    sgc->sgc_valid = 1;
+  } else if (!sgc->sgc_valid) {
+    return;
+  }
+
+  size = service_gop_cache_msg_size(sm);
+  if (sgc->sgc_size + size > (size_t)config.gop_cache * 1024) {
+    /* too long GOP, wait for the next keyframe */
+    service_gop_cache_clear(sgc);
+    return;
+  }
+  sm2 = streaming_msg_clone(sm);
+  TAILQ_INSERT_TAIL(&sgc->sgc_queue, sm2, sm_link);
+  sgc->sgc_size += size;
+}
+
+/**
+ * Service stream lock must be held
+ */
+void
+service_gop_cache_flush(service_t *t)
+{
+  lock_assert(&t->s_stream_mutex);
+
+  service_gop_cache_clear(&t->s_gop_pkt);
+  service_gop_cache_clear(&t->s_gop_ts);
+}
+
+/**
+ * Send the cached GOP to a newly linked target (after the start message).
+ * Service stream lock must be held.
+ */
+void
+service_gop_cache_replay(service_t *t, streaming_target_t *st)
+{
+  streaming_message_t *sm;
+  service_gop_cache_t *sgc;
+  int i;
+
+  lock_assert(&t->s_stream_mutex);
+
+  for (i = 0; i < 2; i++) {
+    sgc = i ? &t->s_gop_ts : &t->s_gop_pkt;
+    if (!sgc->sgc_valid)
+      continue;
+    tvhtrace("service", "%s: GOP cache replay (%zu bytes)",
+             service_nicename(t), sgc->sgc_size);
+    TAILQ_FOREACH(sm, &sgc->sgc_queue, sm_link)
+      streaming_target_deliver2(st, streaming_msg_clone(sm));
+  }
+}
+
 
 /**
  * Generate a message containing info about all components
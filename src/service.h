@@ -207,6 +207,16 @@ typedef struct service_lcn {
 #define SERVICE_AUTO_OFF          1
 #define SERVICE_AUTO_PAT_MISSING  2
 
+/**
+ * GOP cache - the stream messages since the last video keyframe,
+ * replayed to the newly linked subscriptions
+ */
+typedef struct service_gop_cache {
+  struct streaming_message_queue sgc_queue;
+  size_t sgc_size;
+  int    sgc_valid;
+} service_gop_cache_t;
+
 /**
  *
  */
@@ -475,6 +485,13 @@ typedef struct service {
    */
   streaming_pad_t s_streaming_pad;
 
+  /**
+   * GOP caches for the parsed packets and for the MPEG-TS output,
+   * protected by s_stream_mutex
+   */
+  service_gop_cache_t s_gop_pkt;
+  service_gop_cache_t s_gop_ts;
+
   tvhlog_limit_t s_tei_log;
 
   int64_t s_current_pts;
@@ -586,6 +603,12 @@ struct streaming_start *service_build_stream_start(service_t *t);
 
 void service_restart(service_t *t);
 
+void service_gop_cache_add(service_t *t, streaming_message_t *sm, int key);
+
+void service_gop_cache_flush(service_t *t);
+
+void service_gop_cache_replay(service_t *t, streaming_target_t *st);
+
 void service_stream_destroy(service_t *t, elementary_stream_t *st);
 
 void service_request_save(service_t *t, int restart);
@@ -36,6 +36,63 @@
 
 static char *settingspath = NULL;
 
+/*
+ * Single-file store (settings.log)
+ *
+ * An append-only log of JSON records. The live records are kept in
+ * memory (RB tree sorted by path, so directory loads are range scans),
+ * the log is fsync'ed once per batch (hts_settings_sync) and it is
+ * rewritten (compacted) when the dead records prevail. All writers mark
+ * the log dirty through settings_log_dirty_set(), which wakes the sync
+ * thread, so records written outside the idnode save batches are
+ * committed within SETTINGS_LOG_SYNC, too.
+ */
+#define SETTINGS_LOG_NAME     "settings.log"
+#define SETTINGS_LOG_MAGIC    "TVHSLOG1"
+#define SETTINGS_LOG_COMPACT  (1024*1024)
+#define SETTINGS_LOG_SYNC     ms2mono(500)
+
+#define SETTINGS_REC_SET      'S'
+#define SETTINGS_REC_REMOVE   'R'
+#define SETTINGS_REC_HDR      11
+
+typedef struct settings_ent {
+  RB_ENTRY(settings_ent) se_link;
+  char   *se_key;
+  char   *se_data; /* JSON, NUL terminated */
+  size_t  se_size;
+} settings_ent_t;
+
+static RB_HEAD(, settings_ent) settings_ents;
+static pthread_mutex_t settings_lock;
+static int     settings_log_fd = -1;
+static int     settings_log_dirty;
+static int64_t settings_log_size;
+static int64_t settings_log_live;
+static pthread_t  settings_sync_tid;
+static tvh_cond_t settings_sync_cond;
+static int        settings_sync_run;
+
+/*
+ * Prefetched (decoded) configuration files, sorted by path
+ */
+#define SETTINGS_PREFETCH_THREADS 8
+
+typedef struct settings_prefetch {
+  char     *sp_path;
+  htsmsg_t *sp_msg;
+} settings_prefetch_t;
+
+static pthread_mutex_t      settings_prefetch_lock;
+static settings_prefetch_t *settings_prefetch;
+static int                  settings_prefetch_count;
+static int                  settings_prefetch_alloc;
+static int                  settings_prefetch_next;
+
+static void hts_settings_save_file(htsmsg_t *record, const char *path);
+static htsmsg_t *hts_settings_load_one(const char *filename);
+static void settings_prefetch_drop(const char *path);
+
 /**
  *
  */
@@ -45,22 +102,555 @@ hts_settings_get_root(void)
   return settingspath;
 }
 
+/* **************************************************************************
+ * Single-file store
+ * *************************************************************************/
+
+static int
+settings_ent_cmp(const settings_ent_t *a, const settings_ent_t *b)
+{
+  return strcmp(a->se_key, b->se_key);
+}
+
+static settings_ent_t *
+settings_ent_find(const char *key)
+{
+  settings_ent_t skel;
+  skel.se_key = (char *)key;
+  return RB_FIND(&settings_ents, &skel, se_link, settings_ent_cmp);
+}
+
+/*
+ * First entry with the key greater or equal to "prefix" + "c"
+ */
+static settings_ent_t *
+settings_ent_find_ge(const char *prefix, char c)
+{
+  settings_ent_t skel;
+  size_t l = strlen(prefix);
+  char *key = alloca(l + 2);
+  memcpy(key, prefix, l);
+  key[l] = c;
+  key[l + 1] = '\0';
+  skel.se_key = key;
+  return RB_FIND_GE(&settings_ents, &skel, se_link, settings_ent_cmp);
+}
+
+static inline int
+settings_ent_is_child(settings_ent_t *se, const char *prefix, size_t plen)
+{
+  return se && !strncmp(se->se_key, prefix, plen) && se->se_key[plen] == '/';
+}
+
+static void
+settings_ent_destroy(settings_ent_t *se)
+{
+  RB_REMOVE(&settings_ents, se, se_link);
+  settings_log_live -= SETTINGS_REC_HDR + strlen(se->se_key) + se->se_size;
+  free(se->se_key);
+  free(se->se_data);
+  free(se);
+}
+
+/*
+ * Remove the entry and all entries "below" it (directory)
+ */
+static int
+settings_ent_remove(const char *key)
+{
+  settings_ent_t *se, *next;
+  size_t l = strlen(key);
+  int r = 0;
+
+  if ((se = settings_ent_find(key)) != NULL) {
+    settings_ent_destroy(se);
+    r = 1;
+  }
+  for (se = settings_ent_find_ge(key, '/'); settings_ent_is_child(se, key, l); se = next) {
+    next = RB_NEXT(se, se_link);
+    settings_ent_destroy(se);
+    r = 1;
+  }
+  return r;
+}
+
+static void
+settings_ent_set(const char *key, const char *data, size_t size)
+{
+  settings_ent_t *se;
+  char *k = tvh_strdupa(key), *p;
+
+  /* A file replaces the directory and vice versa */
+  for (p = k; (p = strchr(p, '/')) != NULL; p++) {
+    *p = '\0';
+    if ((se = settings_ent_find(k)) != NULL)
+      settings_ent_destroy(se);
+    *p = '/';
+  }
+  settings_ent_remove(key);
+
+  se = malloc(sizeof(*se));
+  se->se_key  = strdup(key);
+  se->se_data = malloc(size + 1);
+  memcpy(se->se_data, data, size);
+  se->se_data[size] = '\0';
+  se->se_size = size;
+  RB_INSERT_SORTED(&settings_ents, se, se_link, settings_ent_cmp);
+  settings_log_live += SETTINGS_REC_HDR + strlen(key) + size;
+}
+
+static void
+settings_log_record
+  (htsbuf_queue_t *q, int type, const char *key, const char *data, size_t size)
+{
+  size_t klen = strlen(key), len = 3 + klen + size;
+  uint8_t *buf = malloc(8 + len);
+  uint32_t crc;
+
+  buf[8]  = type;
+  buf[9]  = klen >> 8;
+  buf[10] = klen;
+  memcpy(buf + 11, key, klen);
+  if (size)
+    memcpy(buf + 11 + klen, data, size);
+  crc = tvh_crc32(buf + 8, len, 0);
+  buf[0] = len >> 24; buf[1] = len >> 16; buf[2] = len >> 8; buf[3] = len;
+  buf[4] = crc >> 24; buf[5] = crc >> 16; buf[6] = crc >> 8; buf[7] = crc;
+  htsbuf_append_prealloc(q, buf, 8 + len);
+}
+
+static int
+settings_log_write(int fd, htsbuf_queue_t *q)
+{
+  htsbuf_data_t *hd;
+  int r = 0;
+
+  TAILQ_FOREACH(hd, &q->hq_q, hd_link) {
+    if (tvh_write(fd, hd->hd_data + hd->hd_data_off, hd->hd_data_len)) {
+      r = -1;
+      break;
+    }
+    if (fd == settings_log_fd)
+      settings_log_size += hd->hd_data_len;
+  }
+  htsbuf_queue_flush(q);
+  return r;
+}
+
+/*
+ * Called with settings_lock held after a record was appended
+ */
+static void
+settings_log_dirty_set(void)
+{
+  if (!settings_log_dirty) {
+    atomic_set(&settings_log_dirty, 1);
+    tvh_cond_signal(&settings_sync_cond, 0);
+  }
+}
+
+/*
+ * Make the directory entry changes (create, rename) durable
+ */
+static void
+settings_log_sync_dir(void)
+{
+  int fd;
+
+  if ((fd = open(settingspath, O_RDONLY | O_DIRECTORY)) < 0)
+    return;
+  if (fsync(fd))
+    tvherror("settings", "unable to sync \"%s\" - %s", settingspath, strerror(errno));
+  close(fd);
+}
+
+/*
+ * Apply one record (type, key length, key, data)
+ */
+static int
+settings_log_replay_one(const uint8_t *rec, size_t len)
+{
+  size_t klen = (rec[1] << 8) | rec[2];
+  char *key;
+
+  if (klen == 0 || 3 + klen > len)
+    return -1;
+  key = alloca(klen + 1);
+  memcpy(key, rec + 3, klen);
+  key[klen] = '\0';
+  if (rec[0] == SETTINGS_REC_SET)
+    settings_ent_set(key, (const char *)rec + 3 + klen, len - 3 - klen);
+  else
+    settings_ent_remove(key);
+  return 0;
+}
+
+/*
+ * Replay the log, returns the offset after the last valid record
+ */
+static size_t
+settings_log_replay(const uint8_t *buf, size_t size)
+{
+  size_t off = sizeof(SETTINGS_LOG_MAGIC) - 1, len;
+  uint32_t crc;
+
+  while (off + 8 + 3 <= size) {
+    len = ((size_t)buf[off] << 24) | (buf[off+1] << 16) |
+          (buf[off+2] << 8) | buf[off+3];
+    crc = ((uint32_t)buf[off+4] << 24) | (buf[off+5] << 16) |
+          (buf[off+6] << 8) | buf[off+7];
+    if (len < 3 || off + 8 + len > size)
+      break;
+    if (tvh_crc32(buf + off + 8, len, 0) != crc)
+      break;
+    if (settings_log_replay_one(buf + off + 8, len))
+      break;
+    off += 8 + len;
+  }
+  return off;
+}
+
+static int
+settings_log_path(char *dst, size_t dstsize, const char *suffix)
+{
+  return snprintf(dst, dstsize, "%s/%s%s", settingspath,
+                  SETTINGS_LOG_NAME, suffix) >= dstsize;
+}
+
+static int
+settings_log_open(void)
+{
+  char path[PATH_MAX];
+  struct stat st;
+  uint8_t *buf;
+  size_t off;
+  int fd;
+
+  settings_log_path(path, sizeof(path), "");
+  if ((fd = tvh_open(path, O_CREAT | O_RDWR, S_IRUSR | S_IWUSR)) < 0) {
+    tvherror("settings", "unable to open \"%s\" - %s", path, strerror(errno));
+    return -1;
+  }
+  if (fstat(fd, &st)) {
+    close(fd);
+    return -1;
+  }
+  if (st.st_size == 0) {
+    if (tvh_write(fd, SETTINGS_LOG_MAGIC, sizeof(SETTINGS_LOG_MAGIC) - 1)) {
+      close(fd);
+      return -1;
+    }
+    settings_log_size = sizeof(SETTINGS_LOG_MAGIC) - 1;
+    if (fsync(fd)) {
+      close(fd);
+      return -1;
+    }
+    settings_log_sync_dir();
+  } else {
+    buf = malloc(st.st_size);
+    if (read(fd, buf, st.st_size) != st.st_size ||
+        st.st_size < sizeof(SETTINGS_LOG_MAGIC) - 1 ||
+        memcmp(buf, SETTINGS_LOG_MAGIC, sizeof(SETTINGS_LOG_MAGIC) - 1)) {
+      tvherror("settings", "\"%s\" is corrupted", path);
+      free(buf);
+      close(fd);
+      return -1;
+    }
+    off = settings_log_replay(buf, st.st_size);
+    free(buf);
+    if (off != st.st_size) {
+      tvhwarn("settings", "\"%s\" - dropping %zd bytes of incomplete records",
+              path, (size_t)st.st_size - off);
+      if (ftruncate(fd, off))
+        tvherror("settings", "\"%s\" - truncate failed - %s", path, strerror(errno));
+    }
+    settings_log_size = off;
+    lseek(fd, off, SEEK_SET);
+  }
+  settings_log_fd = fd;
+  return 0;
+}
+
+/*
+ * Rewrite the log with the live records only
+ */
+static void
+settings_log_compact(void)
+{
+  char path[PATH_MAX], tmppath[PATH_MAX];
+  htsbuf_queue_t q;
+  settings_ent_t *se;
+  int fd;
+
+  settings_log_path(path, sizeof(path), "");
+  settings_log_path(tmppath, sizeof(tmppath), ".tmp");
+  if ((fd = tvh_open(tmppath, O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR)) < 0) {
+    tvherror("settings", "unable to create \"%s\" - %s", tmppath, strerror(errno));
+    return;
+  }
+  htsbuf_queue_init(&q, 0);
+  htsbuf_append(&q, SETTINGS_LOG_MAGIC, sizeof(SETTINGS_LOG_MAGIC) - 1);
+  RB_FOREACH(se, &settings_ents, se_link)
+    settings_log_record(&q, SETTINGS_REC_SET, se->se_key, se->se_data, se->se_size);
+  if (settings_log_write(fd, &q) || fsync(fd) || rename(tmppath, path)) {
+    tvherror("settings", "unable to compact \"%s\" - %s", path, strerror(errno));
+    close(fd);
+    unlink(tmppath);
+    return;
+  }
+  settings_log_sync_dir();
+  tvhdebug("settings", "compacted \"%s\" (%"PRId64" -> %"PRId64" bytes)",
+           path, settings_log_size, (int64_t)lseek(fd, 0, SEEK_END));
+  close(settings_log_fd);
+  settings_log_fd = fd;
+  settings_log_size = lseek(fd, 0, SEEK_END);
+  settings_log_dirty = 0;
+}
+
+static inline int
+settings_log_compact_required(void)
+{
+  return settings_log_size > SETTINGS_LOG_COMPACT &&
+         settings_log_size > 2 * settings_log_live;
+}
+
+/*
+ * Walk the configuration files in the directory tree (the original layout)
+ */
+static int
+settings_walk
+  (const char *fullpath, const char *key,
+   int (*cb)(const char *path, const char *key))
+{
+  char child[PATH_MAX], ckey[PATH_MAX];
+  struct dirent *d;
+  struct stat st;
+  DIR *dir;
+  int count = 0;
+
+  if ((dir = opendir(fullpath)) == NULL)
+    return 0;
+  while ((d = readdir(dir)) != NULL) {
+    if (d->d_name[0] == '.')
+      continue;
+    snprintf(ckey, sizeof(ckey), "%s%s%s", key, key[0] ? "/" : "", d->d_name);
+    if (!strncmp(ckey, SETTINGS_LOG_NAME, strlen(SETTINGS_LOG_NAME)) ||
+        !strcmp(ckey, "backup") || !strncmp(ckey, "epgdb", 5) ||
+        !strcmp(ckey, "imagecache/data") || !strcmp(ckey, "timeshift") ||
+        strstr(ckey, ".tmp") || strstr(ckey, ".sock"))
+      continue;
+    snprintf(child, sizeof(child), "%s/%s", fullpath, d->d_name);
+    if (stat(child, &st))
+      continue;
+    if (S_ISDIR(st.st_mode))
+      count += settings_walk(child, ckey, cb);
+    else if (S_ISREG(st.st_mode))
+      count += cb(child, ckey);
+  }
+  closedir(dir);
+  return count;
+}
+
+static int
+settings_log_import_cb(const char *path, const char *key)
+{
+  htsmsg_t *m;
+  char *json;
+  int r = 0;
+
+  if ((m = hts_settings_load_one(path)) == NULL)
+    return 0;
+  if ((json = htsmsg_json_serialize_to_str(m, 0)) != NULL) {
+    settings_ent_set(key, json, strlen(json));
+    r = 1;
+  }
+  free(json);
+  htsmsg_destroy(m);
+  return r;
+}
+
+static int
+settings_log_prune_cb(const char *path, const char *key)
+{
+  htsmsg_t *m;
+
+  if (settings_ent_find(key))
+    return 0;
+  if ((m = hts_settings_load_one(path)) == NULL)
+    return 0;
+  htsmsg_destroy(m);
+  unlink(path);
+  return 1;
+}
+
+/*
+ * Write the store back to the directory tree
+ */
+static void
+settings_log_export(void)
+{
+  char path[PATH_MAX], bakpath[PATH_MAX];
+  settings_ent_t *se;
+  htsmsg_t *m;
+  int count = 0;
+
+  /* Remove the files which are not in the store */
+  settings_walk(settingspath, "", settings_log_prune_cb);
+
+  RB_FOREACH(se, &settings_ents, se_link) {
+    if ((m = htsmsg_json_deserialize(se->se_data)) == NULL)
+      continue;
+    snprintf(path, sizeof(path), "%s/%s", settingspath, se->se_key);
+    hts_settings_save_file(m, path);
+    htsmsg_destroy(m);
+    count++;
+  }
+  settings_log_path(path, sizeof(path), "");
+  settings_log_path(bakpath, sizeof(bakpath), ".exported");
+  if (rename(path, bakpath))
+    tvherror("settings", "unable to rename \"%s\" - %s", path, strerror(errno));
+  tvhinfo("settings", "exported %d records from \"%s\"", count, path);
+}
+
+static void
+settings_log_free(void)
+{
+  settings_ent_t *se;
+
+  while ((se = RB_FIRST(&settings_ents)) != NULL)
+    settings_ent_destroy(se);
+}
+
 /**
  *
  */
 void
 hts_settings_init(const char *confpath)
 {
+  pthread_mutex_init(&settings_lock, NULL);
+  pthread_mutex_init(&settings_prefetch_lock, NULL);
+  tvh_cond_init(&settings_sync_cond);
+  RB_INIT(&settings_ents);
   if (confpath)
     settingspath = realpath(confpath, NULL);
 }
 
+/**
+ * Group commit - called by the save thread at the end of each batch
+ */
+int
+hts_settings_dirty(void)
+{
+  return atomic_get(&settings_log_dirty);
+}
+
+static void
+settings_log_sync(void)
+{
+  if (settings_log_fd >= 0 && settings_log_dirty) {
+    if (settings_log_compact_required()) {
+      settings_log_compact();
+    } else {
+      atomic_set(&settings_log_dirty, 0);
+      if (fdatasync(settings_log_fd))
+        tvherror("settings", "unable to sync the configuration - %s", strerror(errno));
+    }
+  }
+}
+
+void
+hts_settings_sync(void)
+{
+  pthread_mutex_lock(&settings_lock);
+  settings_log_sync();
+  pthread_mutex_unlock(&settings_lock);
+}
+
+/*
+ * Commit the records written outside the save thread batches
+ */
+static void *
+settings_sync_thread(void *aux)
+{
+  pthread_mutex_lock(&settings_lock);
+  while (settings_sync_run) {
+    if (!settings_log_dirty) {
+      tvh_cond_wait(&settings_sync_cond, &settings_lock);
+      continue;
+    }
+    /* group the writes which follow */
+    tvh_cond_timedwait(&settings_sync_cond, &settings_lock,
+                       mclk() + SETTINGS_LOG_SYNC);
+    settings_log_sync();
+  }
+  pthread_mutex_unlock(&settings_lock);
+  return NULL;
+}
+
+/**
+ * Select the storage backend, returns 1 when the single-file store is used
+ */
+int
+hts_settings_store(int store)
+{
+  char path[PATH_MAX];
+  int count;
+
+  if (settingspath == NULL)
+    return 0;
+
+  settings_log_path(path, sizeof(path), "");
+  if (store == HTS_SETTINGS_DIR && access(path, F_OK))
+    return 0;
+
+  if (settings_log_open()) {
+    tvherror("settings", "using the directory layout");
+    settings_log_free();
+    return 0;
+  }
+
+  if (store == HTS_SETTINGS_EXPORT) {
+    settings_log_export();
+    close(settings_log_fd);
+    settings_log_fd = -1;
+    settings_log_free();
+    return 0;
+  }
+
+  if (RB_FIRST(&settings_ents) == NULL) {
+    count = settings_walk(settingspath, "", settings_log_import_cb);
+    if (count > 0) {
+      tvhinfo("settings", "imported %d records to \"%s\"", count, path);
+      settings_log_compact();
+    }
+  } else if (settings_log_compact_required()) {
+    settings_log_compact();
+  }
+  tvhinfo("settings", "using single-file store \"%s\"", path);
+  settings_sync_run = 1;
+  tvhthread_create(&settings_sync_tid, NULL, settings_sync_thread, NULL, "settings");
+  return 1;
+}
+
 /**
  *
  */
 void
 hts_settings_done(void)
 {
+  if (settings_sync_run) {
+    pthread_mutex_lock(&settings_lock);
+    settings_sync_run = 0;
+    tvh_cond_signal(&settings_sync_cond, 0);
+    pthread_mutex_unlock(&settings_lock);
+    pthread_join(settings_sync_tid, NULL);
+  }
+  if (settings_log_fd >= 0) {
+    hts_settings_sync();
+    close(settings_log_fd);
+    settings_log_fd = -1;
+  }
+  settings_log_free();
   free(settingspath);
 }
 
@@ -125,25 +715,15 @@ hts_settings_buildpath
 /**
  *
  */
-void
-hts_settings_save(htsmsg_t *record, const char *pathfmt, ...)
+static void
+hts_settings_save_file(htsmsg_t *record, const char *path)
 {
-  char path[PATH_MAX];
   char tmppath[PATH_MAX];
   int fd;
-  va_list ap;
   htsbuf_queue_t hq;
   htsbuf_data_t *hd;
   int ok, r, pack;
 
-  if(settingspath == NULL)
-    return;
-
-  /* Clean the path */
-  va_start(ap, pathfmt);
-  _hts_settings_buildpath(path, sizeof(path), pathfmt, ap, settingspath);
-  va_end(ap);
-
   /* Create directories */
   if (hts_settings_makedirs(path)) return;
 
@@ -211,11 +791,56 @@ hts_settings_save(htsmsg_t *record, const char *pathfmt, ...)
     unlink(tmppath);
 }
 
+/**
+ *
+ */
+void
+hts_settings_save(htsmsg_t *record, const char *pathfmt, ...)
+{
+  char path[PATH_MAX];
+  htsbuf_queue_t q;
+  va_list ap;
+  char *json;
+
+  if(settingspath == NULL)
+    return;
+
+  /* Single-file store */
+  if (settings_log_fd >= 0 && *pathfmt != '/') {
+    va_start(ap, pathfmt);
+    _hts_settings_buildpath(path, sizeof(path), pathfmt, ap, NULL);
+    va_end(ap);
+    if ((json = htsmsg_json_serialize_to_str(record, 0)) == NULL)
+      return;
+    tvhdebug("settings", "saving to %s/%s", SETTINGS_LOG_NAME, path);
+    htsbuf_queue_init(&q, 0);
+    settings_log_record(&q, SETTINGS_REC_SET, path, json, strlen(json));
+    pthread_mutex_lock(&settings_lock);
+    settings_ent_set(path, json, strlen(json));
+    if (settings_log_write(settings_log_fd, &q))
+      tvhalert("settings", "Failed to write to \"%s\" - %s",
+               SETTINGS_LOG_NAME, strerror(errno));
+    settings_log_dirty_set();
+    pthread_mutex_unlock(&settings_lock);
+    free(json);
+    return;
+  }
+
+  /* Clean the path */
+  va_start(ap, pathfmt);
+  _hts_settings_buildpath(path, sizeof(path), pathfmt, ap, settingspath);
+  va_end(ap);
+
+  if (settings_prefetch_count)
+    settings_prefetch_drop(path);
+  hts_settings_save_file(record, path);
+}
+
 /**
  *
  */
 static htsmsg_t *
-hts_settings_load_one(const char *filename)
+hts_settings_load_file(const char *filename)
 {
   ssize_t n, size;
   char *mem;
@@ -256,6 +881,162 @@ hts_settings_load_one(const char *filename)
   return r;
 }
 
+/* **************************************************************************
+ * Prefetch - parallel parsing of the configuration tree at startup
+ * *************************************************************************/
+
+static int
+settings_prefetch_add_cb(const char *path, const char *key)
+{
+  if (settings_prefetch_count == settings_prefetch_alloc) {
+    settings_prefetch_alloc = MAX(1024, settings_prefetch_alloc * 2);
+    settings_prefetch = realloc(settings_prefetch,
+                                settings_prefetch_alloc * sizeof(*settings_prefetch));
+  }
+  settings_prefetch[settings_prefetch_count].sp_path = strdup(path);
+  settings_prefetch[settings_prefetch_count].sp_msg  = NULL;
+  settings_prefetch_count++;
+  return 1;
+}
+
+static int
+settings_prefetch_cmp(const void *a, const void *b)
+{
+  return strcmp(((settings_prefetch_t *)a)->sp_path,
+                ((settings_prefetch_t *)b)->sp_path);
+}
+
+static void *
+settings_prefetch_thread(void *aux)
+{
+  settings_prefetch_t *sp;
+  int i;
+
+  while ((i = atomic_add(&settings_prefetch_next, 1)) < settings_prefetch_count) {
+    sp = &settings_prefetch[i];
+    sp->sp_msg = hts_settings_load_file(sp->sp_path);
+  }
+  return NULL;
+}
+
+static settings_prefetch_t *
+settings_prefetch_find(const char *path)
+{
+  settings_prefetch_t skel;
+
+  if (settings_prefetch_count == 0)
+    return NULL;
+  skel.sp_path = (char *)path;
+  return bsearch(&skel, settings_prefetch, settings_prefetch_count,
+                 sizeof(*settings_prefetch), settings_prefetch_cmp);
+}
+
+/*
+ * Read and decode all configuration files using a few threads,
+ * the subsystems then take the decoded messages (hts_settings_load)
+ */
+void
+hts_settings_prefetch(void)
+{
+  pthread_t tids[SETTINGS_PREFETCH_THREADS];
+  int64_t mono = getfastmonoclock();
+  int i, threads;
+
+  if (settingspath == NULL || settings_log_fd >= 0)
+    return;
+
+  settings_walk(settingspath, "", settings_prefetch_add_cb);
+  if (settings_prefetch_count == 0)
+    return;
+  qsort(settings_prefetch, settings_prefetch_count,
+        sizeof(*settings_prefetch), settings_prefetch_cmp);
+
+  threads = sysconf(_SC_NPROCESSORS_ONLN);
+  threads = MINMAX(threads, 1, SETTINGS_PREFETCH_THREADS);
+  threads = MIN(threads, settings_prefetch_count / 64 + 1);
+  settings_prefetch_next = 0;
+  for (i = 0; i < threads; i++)
+    tvhthread_create(&tids[i], NULL, settings_prefetch_thread, NULL, "setload");
+  for (i = 0; i < threads; i++)
+    pthread_join(tids[i], NULL);
+
+  tvhinfo("settings", "prefetched %d files in %"PRId64"ms (%d threads)",
+          settings_prefetch_count, (getfastmonoclock() - mono) / 1000, threads);
+}
+
+/*
+ * Free the messages which were not used
+ */
+void
+hts_settings_prefetch_done(void)
+{
+  int i, unused = 0;
+
+  pthread_mutex_lock(&settings_prefetch_lock);
+  for (i = 0; i < settings_prefetch_count; i++) {
+    if (settings_prefetch[i].sp_msg) {
+      htsmsg_destroy(settings_prefetch[i].sp_msg);
+      unused++;
+    }
+    free(settings_prefetch[i].sp_path);
+  }
+  free(settings_prefetch);
+  settings_prefetch = NULL;
+  settings_prefetch_count = settings_prefetch_alloc = 0;
+  pthread_mutex_unlock(&settings_prefetch_lock);
+  if (unused)
+    tvhdebug("settings", "prefetch - %d unused files", unused);
+}
+
+/*
+ * The file is modified - drop the prefetched message (and all messages
+ * below it for the directories)
+ */
+static void
+settings_prefetch_drop(const char *path)
+{
+  size_t l = strlen(path);
+  settings_prefetch_t *sp;
+  int i;
+
+  pthread_mutex_lock(&settings_prefetch_lock);
+  if ((sp = settings_prefetch_find(path)) != NULL) {
+    htsmsg_destroy(sp->sp_msg);
+    sp->sp_msg = NULL;
+  } else {
+    for (i = 0; i < settings_prefetch_count; i++) {
+      sp = &settings_prefetch[i];
+      if (sp->sp_msg && !strncmp(sp->sp_path, path, l) && sp->sp_path[l] == '/') {
+        htsmsg_destroy(sp->sp_msg);
+        sp->sp_msg = NULL;
+      }
+    }
+  }
+  pthread_mutex_unlock(&settings_prefetch_lock);
+}
+
+/**
+ *
+ */
+static htsmsg_t *
+hts_settings_load_one(const char *filename)
+{
+  settings_prefetch_t *sp;
+  htsmsg_t *r = NULL;
+
+  if (settings_prefetch_count) {
+    pthread_mutex_lock(&settings_prefetch_lock);
+    if ((sp = settings_prefetch_find(filename)) != NULL) {
+      r = sp->sp_msg;
+      sp->sp_msg = NULL;
+    }
+    pthread_mutex_unlock(&settings_prefetch_lock);
+    if (r)
+      return r;
+  }
+  return hts_settings_load_file(filename);
+}
+
 /**
  *
  */
@@ -306,6 +1087,43 @@ hts_settings_load_path(const char *fullpath, int depth)
   return r;
 }
 
+/**
+ *
+ */
+static htsmsg_t *
+settings_log_load(const char *key, int depth)
+{
+  settings_ent_t *se;
+  htsmsg_t *r = NULL, *c;
+  size_t klen = strlen(key);
+  char *name, *slash;
+
+  /* File */
+  if ((se = settings_ent_find(key)) != NULL)
+    return htsmsg_json_deserialize(se->se_data);
+
+  /* Directory */
+  se = settings_ent_find_ge(key, '/');
+  while (settings_ent_is_child(se, key, klen)) {
+    name = tvh_strdupa(se->se_key);
+    if ((slash = strchr(name + klen + 1, '/')) == NULL) {
+      c = htsmsg_json_deserialize(se->se_data);
+      se = RB_NEXT(se, se_link);
+    } else {
+      /* name = "key/subdir" */
+      *slash = '\0';
+      c = depth > 0 ? settings_log_load(name, depth - 1) : NULL;
+      /* skip the subdirectory */
+      se = settings_ent_find_ge(name, '/' + 1);
+    }
+    if (r == NULL)
+      r = htsmsg_create_map();
+    if (c != NULL)
+      htsmsg_add_msg(r, name + klen + 1, c);
+  }
+  return r;
+}
+
 /**
  *
  */
@@ -318,9 +1136,17 @@ hts_settings_vload(const char *pathfmt, va_list ap, int depth)
   va_copy(ap2, ap);
 
   /* Try normal path */
-  _hts_settings_buildpath(fullpath, sizeof(fullpath), 
-                          pathfmt, ap, settingspath);
-  ret = hts_settings_load_path(fullpath, depth);
+  if (settings_log_fd >= 0 && *pathfmt != '/') {
+    _hts_settings_buildpath(fullpath, sizeof(fullpath),
+                            pathfmt, ap, NULL);
+    pthread_mutex_lock(&settings_lock);
+    ret = settings_log_load(fullpath, depth);
+    pthread_mutex_unlock(&settings_lock);
+  } else {
+    _hts_settings_buildpath(fullpath, sizeof(fullpath),
+                            pathfmt, ap, settingspath);
+    ret = hts_settings_load_path(fullpath, depth);
+  }
 
   /* Try bundle path */
   if (!ret && *pathfmt != '/') {
@@ -372,10 +1198,30 @@ hts_settings_remove(const char *pathfmt, ...)
   va_list ap;
   struct stat st;
 
+  if (settings_log_fd >= 0 && *pathfmt != '/') {
+    htsbuf_queue_t q;
+    va_start(ap, pathfmt);
+    _hts_settings_buildpath(fullpath, sizeof(fullpath), pathfmt, ap, NULL);
+    va_end(ap);
+    pthread_mutex_lock(&settings_lock);
+    if (settings_ent_remove(fullpath)) {
+      htsbuf_queue_init(&q, 0);
+      settings_log_record(&q, SETTINGS_REC_REMOVE, fullpath, NULL, 0);
+      if (settings_log_write(settings_log_fd, &q))
+        tvhalert("settings", "Failed to write to \"%s\" - %s",
+                 SETTINGS_LOG_NAME, strerror(errno));
+      settings_log_dirty_set();
+    }
+    pthread_mutex_unlock(&settings_lock);
+    return;
+  }
+
   va_start(ap, pathfmt);
   _hts_settings_buildpath(fullpath, sizeof(fullpath),
                           pathfmt, ap, settingspath);
   va_end(ap);
+  if (settings_prefetch_count)
+    settings_prefetch_drop(fullpath);
   if (stat(fullpath, &st) == 0) {
     if (S_ISDIR(st.st_mode))
       rmtree(fullpath);
@@ -420,6 +1266,19 @@ hts_settings_exists ( const char *pathfmt, ... )
   va_list ap;
   char path[PATH_MAX];
   struct stat st;
+  int r;
+
+  /* Single-file store */
+  if (settings_log_fd >= 0 && *pathfmt != '/') {
+    va_start(ap, pathfmt);
+    _hts_settings_buildpath(path, sizeof(path), pathfmt, ap, NULL);
+    va_end(ap);
+    pthread_mutex_lock(&settings_lock);
+    r = settings_ent_find(path) != NULL ||
+        settings_ent_is_child(settings_ent_find_ge(path, '/'), path, strlen(path));
+    pthread_mutex_unlock(&settings_lock);
+    return r;
+  }
 
   /* Build path */
   va_start(ap, pathfmt);
@@ -428,3 +1287,61 @@ hts_settings_exists ( const char *pathfmt, ... )
 
   return (stat(path, &st) == 0);
 }
+
+/*
+ * Move a file or directory
+ */
+int
+hts_settings_move ( const char *src, const char *dst )
+{
+  char spath[PATH_MAX], dpath[PATH_MAX];
+  settings_ent_t *se, *next;
+  htsbuf_queue_t q;
+  htsbuf_data_t *hd;
+  size_t slen = strlen(src);
+  char *key;
+  int r = 0;
+
+  if (settings_log_fd < 0) {
+    if (hts_settings_buildpath(spath, sizeof(spath), "%s", src) ||
+        hts_settings_buildpath(dpath, sizeof(dpath), "%s", dst))
+      return -1;
+    if (settings_prefetch_count) {
+      settings_prefetch_drop(spath);
+      settings_prefetch_drop(dpath);
+    }
+    hts_settings_makedirs(dpath);
+    return rename(spath, dpath);
+  }
+
+  pthread_mutex_lock(&settings_lock);
+  htsbuf_queue_init(&q, 0);
+  se = settings_ent_find(src);
+  if (se == NULL)
+    se = settings_ent_find_ge(src, '/');
+  for ( ; se && (!strcmp(se->se_key, src) ||
+                 settings_ent_is_child(se, src, slen)); se = next) {
+    next = RB_NEXT(se, se_link);
+    key = malloc(strlen(dst) + strlen(se->se_key + slen) + 1);
+    strcpy(key, dst);
+    strcat(key, se->se_key + slen);
+    settings_log_record(&q, SETTINGS_REC_SET, key, se->se_data, se->se_size);
+    free(key);
+    r++;
+  }
+  if (r) {
+    settings_log_record(&q, SETTINGS_REC_REMOVE, src, NULL, 0);
+    /* apply the new records in the same way as the log replay */
+    TAILQ_FOREACH(hd, &q.hq_q, hd_link)
+      if (hd->hd_data_len > 8)
+        settings_log_replay_one(hd->hd_data + 8, hd->hd_data_len - 8);
+    if (settings_log_write(settings_log_fd, &q))
+      tvhalert("settings", "Failed to write to \"%s\" - %s",
+               SETTINGS_LOG_NAME, strerror(errno));
+    settings_log_dirty_set();
+  } else {
+    htsbuf_queue_flush(&q);
+  }
+  pthread_mutex_unlock(&settings_lock);
+  return r ? 0 : -1;
+}
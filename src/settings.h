@@ -23,10 +23,24 @@
 
 #include "htsmsg.h"
 
+#define HTS_SETTINGS_DIR    0 /* directory layout (or settings.log if exists) */
+#define HTS_SETTINGS_LOG    1 /* single-file store, import the directories */
+#define HTS_SETTINGS_EXPORT 2 /* export the single-file store to directories */
+
 void hts_settings_init(const char *confpath);
 
+int hts_settings_store(int store);
+
 void hts_settings_done(void);
 
+void hts_settings_prefetch(void);
+
+void hts_settings_prefetch_done(void);
+
+int hts_settings_dirty(void);
+
+void hts_settings_sync(void);
+
 void hts_settings_save(htsmsg_t *record, const char *pathfmt, ...);
 
 htsmsg_t *hts_settings_load(const char *pathfmt, ...);
@@ -45,4 +59,6 @@ int hts_settings_makedirs ( const char *path );
 
 int hts_settings_exists ( const char *pathfmt, ... );
 
+int hts_settings_move ( const char *src, const char *dst );
+
 #endif /* HTSSETTINGS_H__ */ 
@@ -125,6 +125,9 @@ subscription_link_service(th_subscription_t *s, service_t *t)
     sm = streaming_msg_create_code(SMT_SERVICE_STATUS, 
 				   t->s_streaming_status);
     streaming_target_deliver(s->ths_output, sm);
+
+    // Start with the last GOP
+    service_gop_cache_replay(t, &s->ths_input);
   }
 
   pthread_mutex_unlock(&t->s_stream_mutex);
@@ -798,6 +801,8 @@ subscription_create_from_channel_or_service(profile_chain_t *prch,
     s->ths_raw_service = service;
     LIST_INSERT_HEAD(&mm->mm_raw_subs, s, ths_mux_link);
   }
+  if (ch && (flags & SUBSCRIPTION_STREAMING))
+    mpegts_prewarm_zap(ch, hostname, username);
 #endif
 
   if (flags & SUBSCRIPTION_ONESHOT) {
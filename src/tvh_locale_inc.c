@@ -0,0 +1,13189 @@
+static const char *tvh_locale_1[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nЗа повече информация посетете сайта на Tvheadend\nhttps://tvheadend.org\n",
+"# Channels", "#Канали",
+"# Mapped channels", "# Селектирани Канали",
+"# Muxes", "# Муксове",
+"# Services", "# Услуги",
+"# Services seen", "Намерени услуги",
+"# tune repeats", "Повтаряне на търсенето",
+"(Default profile)", "Профил по подразбиране",
+"1 day", "1 ден",
+"1 month", "1 месец",
+"1 week", "1 седмица",
+"1 year", "1 година",
+"2 months", "2 месеца",
+"2 weeks", "2 седмици",
+"2 years", "2 години",
+"2-Port switch (universal LNB)", "2-портов ключ (универсален конвертор)",
+"3 days", "3 дни",
+"3 months", "3 месеца",
+"3 weeks", "3 седмици",
+"3 years", "3 години",
+"4-Port switch (universal LNB)", "4-портов ключ (универсален конвертор)",
+"5 days", "5 дни",
+"6 months", "6 месеца",
+"AC-3 = descriptor 6", "AC-3 = декриптор 6",
+"AC-3 detection", "АС-3 търсене",
+"ACTIVE", "Активни",
+"AES constant code word client", "AES постоянна парола на клиент",
+"ANY", "всички",
+"ATSC source ID", "ATSC ID на източника",
+"ATSC-C network", "ATSC-C мрежа",
+"ATSC-T network", "ATSC-T мрежа",
+"AUTO", "Автоматично",
+"Aborted by user", "Прекратено от потребителя",
+"Accept remote subscription weight", "Преиемане значението на дистанционния абонамент",
+"Accept the remote subscription weight (from the SAT>IP client).", "Преиемане значението на дистанционния абонамент (от SAT>IP клиент)",
+"Access", "Достъп",
+"Action", "Действие",
+"Adapter in use by another subscription", "Адаптера е зает от друг абонамент",
+"Add file and line numbers to debug", "Добави файл или ред за дебъг",
+"Add the thread ID to debug", "Добави ID на задачата за дебъг",
+"Admin", "Администратор",
+"Admin password", "Парола на администратор",
+"Admin username", "Име за администратор",
+"Administrator login", "Администратор логин",
+"Adult movie", "Филм за възрастни",
+"Advanced", "Подробно",
+"Advanced (non-universal LNBs, rotors, etc.)", "Подробно (неуниверсален конвертор, мотор и др.)",
+"Advanced streaming", "Подробно стрииминг",
+"Adventure", "Приключения",
+"Advertisement / Shopping", "Реклама/пазаруване",
+"All (Streaming plus DVR)", "Всички(стриим плюс DVR",
+"All DVR (rw)", "Всички DVR презаписваеми",
+"All characters that could possibly cause problems for filenaming will be replaced with an underscore. See Help for details.", "Всички символи които могат да представляват проблем ще бъдат заменени с почертаващ символ. Погледнете помоща за детайли.",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Всички постъпления се използват за потдръжка на сървърната инфраструктура, тестове и оборудване",
+"Allow to show the quick tips for the form fields.", "Разреши показване на бързи указания в полетата",
+"Allowed network", "Разрешена мрежа",
+"Alternate PID path", "Алтернативен PID път",
+"Alternate configuration path", "Път към алтернативна конфигурация",
+"Altitude (meters)", "Височина (метри)",
+"Animals", "Животни",
+"Any", "Всички",
+"Arts", "Изкуства",
+"Athletics", "Атлетика",
+"Audio bitrate (kb/s) (0=auto)", "Аудио битрейт (kb/s) (0=auto) ",
+"Audio codec", "Аудио кодек",
+"Audio stream filter", "Филтър на аудиостриима",
+"Auto", "Авто",
+"Auto check disabled", "Автоматична проверка изключена",
+"Auto check enabled", "Автоматична проверка влючена",
+"Auto record", "Автоматичен запис",
+"Auto record caption", "Автоматичен запис на надписите",
+"Auto recording%s%s", "Автоматично записване%s%s",
+"Auto time record", "Автоматочно време за запис",
+"Auto-Map to channels", "Автоматично мапване към каналите ",
+"Automatic checking", "Автоматично проверяване",
+"Automatically map EPG source", "Автоматично мапване на  EPG източника",
+"Automatically name from network", "Автоматично именоване от мрежата",
+"Autorec maximum count (0=unlimited)", "Максимален брой на автоматичните записи (0=unlimited)",
+"Autorec maximum schedules limit (0=unlimited)", "Максимален брой на задачите за автом.запис (0=unlimited)",
+"Bad", "Лош",
+"Ballet", "Балет",
+"Bandwidth", "Пропускателната способност",
+"Based on software from", "Базиран на софтуер от",
+"Basic", "Основни",
+"Bind to specific local IP address.", "Обвържи към специфичен локален IP адрес",
+"Bouquet", "Букет",
+"Bouquet (auto)", "Букет (авто)",
+"Brand", "Марка",
+"Broadcast", "Предаване",
+"Broadcasting", "Излъчване на предаване",
+"Build", "Създаване",
+"CA client %i", "CA клиент %i",
+"CA identification", "CA идентифициране",
+"CA provider", "CA провайдер",
+"CA stream filter", "CA стриим филтър",
+"CAPMT interval (ms)", "CAPMT интервал (ms)",
+"CAPMT query interval (ms)", "CAPMT интервал за запитване (ms)",
+"CRID authority", "CRID пълномощно",
+"Cache scheme", "Схема на кеша",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket име на файла / IP adres (TCP режим)",
+"Cartoons", "Детски",
+"Channel", "Канал",
+"Channel icon", "Иконка на канала",
+"Channel icon path (see Help)", "Път към иконката на канала(виж помощ)",
+"Channel name", "Име на канала",
+"Channel number", "Номера на канала",
+"Channel number offset", "Отместване номера на канала",
+"Channel numbers from", "Номера на канала от",
+"Channel tag", "Отбелязване на канала",
+"Channel tag reference", "Описание на канала",
+"Channel tags", "Отбелязване на каналите",
+"Channels", "Канали",
+"Character set", "Енкодинг",
+"Check availability", "Проверка на наличноста",
+"Children's / Youth programs", "Детски / Младежки ",
+"Cinema", "Кино",
+"Class", "Клас",
+"Classical", "Класически",
+"Classical music", "Класическа музика",
+"Clean effects", "Изчистване ефекти",
+"Client name", "Име на клиента",
+"Clone scheduled entry on error", "Клонирай входящата задача при грешка",
+"Code word client (newcamd)", "Кодова дума за клиент(newcamd)",
+"Comedy", "Комедия",
+"Command delay time (ms) (10-200)", "Времезакъснение на командата (ms) (10-200)",
+"Command time (ms) (10-100)", "Време за командата (ms) (10-100)",
+"Comment", "Коментар",
+"Commercial break", "Рекламна пауза",
+"Committed", "Ангажиран",
+"Completed OK", "Завършено ОК",
+"Conditional access client", "Клиент на Условен достъп ",
+"Configuration", "Настройки",
+"Configuration ID", "конфигурация на ID",
+"Configuration name", "Име на конфигурацията",
+"Configuration version", "Версия на конфигурацията",
+"Connection limit type", "Тип на ограничение на връзката",
+"Constellation", "Съзвездие",
+"Container", "Контейнер",
+"Content character set", "Определяне знаците за съдържанието",
+"Content reference identifier authority.", "Бележка за съдържанието на пълномощното за идентификация",
+"Content type", "Съдържание Тип",
+"Contest", "Състезание",
+"Continue even if descrambling fails", "Продължи дори ако декодирането е неуспешно",
+"Cookie expiration (days)", "Запазване на бисквитките (days)",
+"Cooking", "Готварство",
+"Copy codec type", "Копиране на типа кодек",
+"Copy layout", "Копиране на макета",
+"Create bouquet", "Създаване на букет",
+"Create network name tags", "Създаване бележка към името на мрежата",
+"Create provider name tags", "Създаване на бележка към името на провайдера",
+"Create type based tags", "Създаване на бележка базирана на типа",
+"Created", "Създаден",
+"Creator", "Създател",
+"Cron", "Планирани задачи",
+"Cron multi-line", "мултилиния на Cron",
+"Culture (without music)", "Култура",
+"Current RTSP port.", "Текущ RTSP порт",
+"Current affairs", "Актуални въпроси",
+"Current tuner configuration.", "Конфигурация на избрания тунер",
+"Custom HTTP headers", "Персонални HTTP хедъри",
+"DBus - use the session message bus instead of the system one", "DBus - използвайте съобщението на сесията вместо системното",
+"DES constant code word client", "DES постоянна кодова дума на клиент",
+"DES key", "DES ключ",
+"DSCP/TOS for streaming", "DSCP/TOS за стрииминг",
+"DVB scan files", "DVB сканиране на файлове",
+"DVB scan files path", "Път за DVB сканиране на файлове",
+"DVB-C network", "DVB-C мрежа",
+"DVB-S 4-port", "DVB-S 4-портов",
+"DVB-S advanced", "DVB-S подробно",
+"DVB-S network", "DVB-S мрежа",
+"DVB-S satellite configuration", "DVB-S сателитна конфигурация",
+"DVB-S simple", "DVB-S опростено",
+"DVB-T network", "DVB-T мрежа",
+"DVR", "Дигитален видео рекордер",
+"DVR Auto-record entry", "DVR автом.запис вписване",
+"DVR behavior", "DVR режим на работа",
+"DVR configuration", "DVR конфигурация",
+"DVR configuration profile", "DVR профил на конфигурацията",
+"DVR configuration profiles", "DVR профили на конфигурациите",
+"DVR file retention period", "DVR период за задържане на файла",
+"DVR log retention", "DVR задържане на лога",
+"DVR log retention period", "DVR период за задържане на лога",
+"DVR override: high", "DVR презапис: висок приоритет",
+"DVR override: important", "DVR презапис: важен приоритет",
+"DVR override: low", "DVR презапис: нисък приоритет",
+"DVR override: normal", "DVR презапис: нормален приоритет",
+"DVR override: unimportant", "DVR презапис: неважен приоритет",
+"DVR time record entry", "DVR вписване на време за запис",
+"Dance", "Танци",
+"Data errors", "Грешка в данните",
+"Days of Week", "Ден от седмицата",
+"Days of week", "Дни от седмицата",
+"Debate", "Дебати",
+"Debug libav log", "откриване грешки в libav лога",
+"Debug log path", "откриване грешки в пътя на лога",
+"Debug options", "Опции за откриване грешки",
+"Debug subsystems", "откриване грешки в субсистемите",
+"Debug to syslog", "откриване грешки в системния лог",
+"Debug trace (low-level)", "Трасиране на грешките (ниско ниво)",
+"Debugging", "Дебъгване",
+"Default", "По подразбиране",
+"Default language(s)", "Език(езици) по подразбиране",
+"Default priority", "Приоритет По подразбиране",
+"Delivery system", "Система за доставка",
+"Demux path", "Път за разделяне",
+"Descramble services (limit per mux)", "Декодиращи услуги (ограничение по mux)",
+"Descrambler buffer (TS packets)", "Буфер за декодиране (TS пакети)",
+"Description", "Описание",
+"Detective", "Детективски",
+"Device ID", "Устройство ID",
+"Device model", "Устройство Модел",
+"Device path", "Път до устройството",
+"Directory", "Папка",
+"Directory permissions (octal, e.g. 0775)", "Разрешения за директориите  (octal, e.g. 0775)",
+"Disable", "Изключи",
+"Disable DVB bouquets", "Изключи DVB букети",
+"Disable SAT>IP client", "изключване на SAT>IP клиент",
+"Disable all access control checks", "Изключи всички проверки за достъп",
+"Disable debug on stderr", "Изключване откриването на грешки при stderr",
+"Disable device/firmware-specific workarounds", "Изключи устройство",
+"Disable syslog (all messages)", "Изключи системния лог",
+"Disabled", "Изключен",
+"Discussion", "Дискусии",
+"DiseqC repeats", "DiSEqC повторения",
+"DiseqC rotor", "DiseqC мотор",
+"DiseqC switch", "DiseqC ключ",
+"Do not use", "Не използвай",
+"Documentary", "Документални",
+"Don't backup configuration tree at upgrade", "Не прави бекъп на конфигурацията по време на ъпгрейд",
+"Don't include title in filename", "Не влючвай заглавието в името на файла",
+"Don't keep", "Не запазвай",
+"Don't re-record", "Не презаписвай",
+"Don't reschedule", "Не променяй задачите",
+"Drama", "Драма",
+"Duplicate handling", "Дублиране на потдръжката",
+"EIT - skip TSID check", "EIT скрии TSID проверката",
+"EPG grabber", "EPG грабер",
+"EPG grabber channel", "EPG прихващане на канал",
+"EPG grabber configuration", "Конфигуриране на EPG прихващането",
+"EPG name", "Име на EPG",
+"EPG scan", "Сканиране на EPG",
+"EPG scan timeout in seconds (30-7200)", "EPG таймаут на сканирането в секунди (30-7200)",
+"EPG source", "EPG източник",
+"EPG update window", "EPG обновяване на прозореца",
+"Economics", "Икономични",
+"Education", "Образование",
+"Educational", "Образователни",
+"Elementary stream filter", "Филтър на елементарния стриим",
+"Enable (auto)", "Разреши (автоматично)",
+"Enable DBus", "Разреши DBus",
+"Enable NTP driver", "Разрешаване на NTP драйвера",
+"Enable coredumps for daemon", "Разреши подтискане на ядрото на демона",
+"Enable debug on stderr", "Разреши stderr да открива грешки ",
+"Enable debug subsystems", "Разреши субсистемата за грешки",
+"Enable debug to file", "Разреши запис на грешките във файл",
+"Enable debug to syslog", "Разреши запис на грешките във системния лог",
+"Enable trace subsystems", "Разреши проследяване на субсистемата",
+"Enabled", "Разрешено",
+"Encrypted", "Кодирано",
+"Environment", "Среда",
+"Environment (pipe)", "Среда (pipe)",
+"Episode", "Епизод",
+"Episode %d", "Епизод %d",
+"Errors", "Грешки",
+"Every day", "Всеки ден",
+"Expeditions", "Експедиция",
+"Experimental film", "Експериментален филм",
+"Expert", "Напреднал",
+"FAIL", "ПРОВАЛ",
+"Factual topics", "Фактически теми",
+"Failed DVR", "Неуспешно DVR",
+"Fantasy", "Фантастични",
+"File missing", "Файла Отсъства",
+"File not created", "Файла не е създаден",
+"Filename", "Име на файла",
+"Film", "Фимл",
+"Fine arts", "Изящни изкуства",
+"Fitness and health", "Фитнес и здраве",
+"Folk", "Фолк",
+"Folkloric", "Фолклорни",
+"Football", "Футбол",
+"Force (auto)", "Принудително (автоматично)",
+"Force CA ID (e.g. 0x2600)", "Принудително CA ID (e.g. 0x2600)",
+"Force pilot for DVB-S2", "Принудително пилот за DVB-S2",
+"Force priority", "Принудителен приоритет",
+"Force teardown delay", "Принудително закъснение на прекъсването",
+"Foreign countries", "Чужди страни",
+"Fork and run as daemon", "Отделяне и стартиране като демон",
+"Frequency", "Честота",
+"Frequency (Hz)", "Честота (Hz)",
+"Frequency (MHz)", "Честота (MHz)",
+"Frequency (kHz)", "Честота (kHz)",
+"Fri", "Пет",
+"Friendly name", "Кратко име",
+"Full DiseqC", "Пълен DiseqC",
+"Full-text", "Пълен текст",
+"Further education", "Бъдещо образование",
+"Game show", "Шоу",
+"Gardening", "Градинарство",
+"General", "Основни",
+"Generic", "Общ",
+"Generic options", "Основно настройки",
+"HTSP Default Stream Settings", "HTSP основни стриим настройки",
+"HTSP stream profile", "HTSP стриим профил",
+"Handicraft", "Занаят",
+"Hearing impaired", "Увреден слух",
+"Hierarchy", "йерархия",
+"High", "Високо",
+"Historical movie", "Исторически филми",
+"Horror", "Ужаси",
+"Hostname/IP", "Име на хоста/IP",
+"IDLE", "ПРЕСТОЙ",
+"IP address", "IP Адрес",
+"IP blocking", "ИП блокиране",
+"Icon (full URL)", "Икона (пълен адрес URL",
+"Icon URL", "икона URL",
+"Icon has title", "Иконата има заглавие",
+"Icons from", "Икони от",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Ако няма съществуващ акаунт, тогава създайте един без потребител и парола. Използвайте го внимателно тъй като той ще даде административен достъп на всички по света до вашата Tvheadend инсталация след като я създадете и редактирате, чрез уеб интерфейса.",
+"If you'd like to support the project, please consider a donation.", "Ако искате да помогнете за проекта, направете дарение. ",
+"Ignore EPG (EIT)", "Игнорирай EPG",
+"Ignore descriptor 5", "Игнорирай дескриптор 5",
+"Ignore invalid SSL certificate", "Игнорирай валидния SSL сертификат",
+"Immediately abort", "Незабавно прекрати",
+"Important", "Важно",
+"Index", "Индекс",
+"Informational", "Информационни",
+"Initial scan", "Начално сканиране",
+"Interface", "Интерфейс",
+"Internal", "Вътрешен",
+"Interview", "Интервю",
+"Invalid", "Невалидно",
+"Invalid adapter number '%s'\n", "Невалиден номер на адаптер '%s'\n",
+"Invalid target", "Невалиден обект",
+"Jazz", "Джаз",
+"LNB", "Конвертор",
+"Language", "Език",
+"Languages", "Езици",
+"Last seen", "Последно видян",
+"Leisure hobbies", "услуги за свободното време хобита",
+"Limit connections", "Ограничение на връзките",
+"Listen on IPv6", "Очакване на IPv6",
+"Literature", "Литература",
+"Local bind IP address", "Локално привързани IP адреси",
+"Local channel number", "Локален номер на канал",
+"Location", "Местонахождение",
+"Log", "Лог",
+"Login/Logout", "Вписване/Отписване",
+"Low", "Ниско",
+"Magazines", "Списания",
+"Manufacturer", "Производител",
+"Manufacturer URL", " URL Производител",
+"Map all services", "Впиши всички",
+"Maximum PIDs", "Максимален брой PIDs",
+"Maximum bandwidth (Kbps)", "Максимална честотна лента(Kbps)",
+"Maximum length of PIDs", "Максимална дължина на PIDs",
+"Maximum timeout (seconds)", "Таймаут максимум(секунди)",
+"Medicine", "Медицина",
+"Melodrama", "Мелодрама",
+"Missing In PAT/SDT", "Липсва в PAT/SDT",
+"Mode", "Режим",
+"Model description", "Описание на Модела",
+"Model name", "Име на Модела",
+"Model number", "Номер на Модела",
+"Modulation", "Модулация",
+"Mon", "Понеделник",
+"Mono", "Моно",
+"More verbose libav log", "По-подробен libav лог",
+"Motor sport", "Моторни спортове",
+"Motoring", "Мониторинг",
+"Movie", "Филми",
+"Music", "Музика",
+"Musical", "Музикални",
+"Mux", "Мукс",
+"Mux UUID", "Мукс UUID",
+"Mux not enabled", "Мукса не е разрешен",
+"NONE", "ПРАЗНО",
+"Name", "Име",
+"Natural sciences", "Природни науки",
+"Nature", "Природа",
+"Network", "Мрежа",
+"Network A", "Мрежа А",
+"Network B", "Мрежа Б",
+"Network ID (limit scanning)", "ИД на мрежата(ограничено сканиране",
+"Network UUID", "UUID Мрежа",
+"Network discovery", "Мрежово сканиране",
+"Network name", "Име на мрежата",
+"Network prefix", "Мрежов префикс",
+"Network type", "Вид на мрежата",
+"Networks", "Мрежи",
+"News", "Новини",
+"News magazine", "Новини от списания",
+"Next tune delay in ms (0-2000)", "Максимално закъснение на настройката в милисекунди",
+"No PIN", "Без ПИН",
+"No access", "Без достъп",
+"No adapters specified!\n", "Няма определен адаптер\n",
+"No days", "Няма дни",
+"No descrambler", "Няма декодиране",
+"No free adapter", "Няма свободен адаптер",
+"No input detected", "Няма намерен вход",
+"No service assigned to channel", "Няма услуга към канала",
+"No service enabled", "Няма разрешена услуга",
+"No source available", "Не е наличен източник",
+"None", "Празно",
+"Normal", "Нормален",
+"Not set", "Не зададен",
+"Not set (none or channel configuration)", "Не настроен(няма или не конфигуриран канал",
+"Not set (use channel or DVR configuration)", "Не настроен(използвай конфигурация на канала или DVR",
+"Number", "Номер",
+"Number of tsfile tuners", "Номер на тунерите от tsfile",
+"OSCam net protocol (rev >= 10389)", "OSCam net протокол (rev >= 10389)",
+"Off", "Изключен",
+"Older OSCam", "По-стар OSCam",
+"On", "Включен",
+"Only Bulsatcom 39E", "Само Булсатком 39И",
+"Only EIT", "Само EIT",
+"Only OpenTV Sky Ausat", "Само OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Само OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Само OpenTV Sky UK",
+"Only UK Freesat", "Само UK Freesat",
+"Only UK Freeview", "Само UK Freeview",
+"Only Viasat Baltic", "Само Viasat Baltic",
+"Opera", "Опера",
+"Output directory for tsdebug", "Изходна директория за TS дебъг",
+"Over-the-air EPG", "Онлайн програмна таблица",
+"Owner", "Притежател",
+"PIDs 21 in setup", "PIDS 21 в настройката",
+"PIDs in setup", "PIDS в настройката",
+"Password", "Парола",
+"Password2", "Парола2",
+"Passwords", "Пароли",
+"Performing arts", "Приложни изкуства",
+"Physiology", "Физиология",
+"Pilot", "Пилот",
+"Political issues", "Политически въпроси",
+"Pop", "Поп",
+"Popular culture", "Популярна култура",
+"Port", "Порт",
+"Position", "Позиция",
+"Preferred CA PID", "Предпочитан CA PID",
+"Presentation", "Презентация",
+"Press", "Преса",
+"Priority", "Приоритет",
+"Priority (-10..10)", "Приоритет (-10..10)",
+"Private", "Лично",
+"Profile name", "Име на профила",
+"Provider", "Провайдър",
+"Provider ID", "Провайдър ID",
+"Psychology", "Психология",
+"Puppets", "Куклени детски",
+"Quiz", "Викторина",
+"Record all", "Запиши всичко",
+"Religion", "Религия",
+"Religious", "Религиозни",
+"Remarkable people", "Забележителни хора",
+"Reports", "Рапорт",
+"Rerun of", "Върни от",
+"Rescan", "Пресканирай",
+"Reserved", "Резервирано",
+"Respawn (pipe)", "Respawn",
+"Rewrite EIT", "Презапиши EIT",
+"Rewrite PAT", "Презапиши PAT",
+"Rewrite PMT", "Презапиши PMT",
+"Rewrite SDT", "Презапиши SDT",
+"Rock", "Рок",
+"Rolloff", "Пропадане",
+"Romance", "Романтика",
+"Run as group", "Стартирай като група",
+"Run as user", "Стартирай като потребител",
+"Running", "Стартиран",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP номер на порта за сървър\n(по подразбиране: -1 = изключено, 0 = уебконфиг, стандарния порт е 554)",
+"Sat", "Сателит",
+"Satconf", "Сателитна конфигурация",
+"Scheduled for recording", "Програмиране на записване",
+"Science", "Наука",
+"Science fiction", "Научна фантастика",
+"Season", "Сезон",
+"Season %d", "Сезон %d",
+"Send full PLAY cmd", "Изпрати full Play команда",
+"Serious", "Сериозни",
+"Serious music", "Сериозна музика",
+"Server", "Сървър",
+"Service", "Услуги",
+"Service ID", "ИД на услугата",
+"Services", "Услуги",
+"Settings", "Настройки",
+"Show", "Покажи",
+"Show this page", "Покажи тази страница",
+"Show version information", "Покажи информация за версията",
+"Signal quality too poor", "Качеството на сигнала е много лишо",
+"Signal scale (240 or 100)", "Скала на сигнала (240 или 100)",
+"Soap", "Сапунки",
+"Soccer", "Футбол",
+"Social", "Социални",
+"Social advisory", "Социални съвети",
+"Source", "Източник",
+"Source deleted", "Изтечника е изтрит",
+"Source quality is bad", "Качеството на източника е лошо",
+"Source reconfigured", "Източника е реконфигуриран",
+"Special events (Olympic Games, World Cup, etc.)", "Специални събития(Оломпиади, Световни купи и т.н.",
+"Specify User-Agent header for the http client", "Определяне на User-Agent заглавие за http клиент",
+"Specify alternative htsp port", "Определяне на алтернативен https порт",
+"Specify alternative http port", "Определяне на алтернативен http порт",
+"Specify alternative http webroot", "Определяне на алтернативен http руут",
+"Specify bind address", "Определяне на свързан адрес",
+"Specify extra htsp port", "Определяне на extra htsp порт",
+"Spiritual sciences", "Духовна наука",
+"Sports", "Спорт",
+"Sports magazines", "Спопртни списания",
+"Squash", "Скуош",
+"Standard", "Стандарт",
+"Start", "Старт",
+"Status", "Статус",
+"Stereo", "Стерео",
+"Stop", "Спри",
+"Storage space", "Място за съхранение",
+"Stream type", "Тип на стриима",
+"Streaming", "Стрииминг",
+"Subscribe to a service permanently", "Абониране за услугата за постоянно",
+"Subscription overridden", "Презаписване на абонамента",
+"Subtitle", "Субтитри",
+"Sun", "Неделя",
+"Switch: %s", "Ключ:  %s",
+"Sync", "Синхронизиране",
+"Sync + Don't keep", "Синхронизирай + Не запазвай",
+"System", "Система",
+"Tags", "Етикети",
+"Talk show", "Интервюта",
+"Team sports (excluding football)", "Отборни спортове (без футбол)",
+"Technology", "Технологии",
+"Tennis", "Тенис",
+"Testing options", "Тестови опции",
+"Thriller", "Трилър",
+"Thu", "Четвъртък",
+"Time missed", "Липсващо време",
+"Time recording%s%s", "Време на записа%s%s",
+"Timeout (sec) (0=infinite)", "Таймаут (sec) (0=неограничено)",
+"Timeout (seconds)", "Таймаут (sec)",
+"Timeshift", "ТаймШифт",
+"Timout (secs)", "Таймаут (sec)",
+"Title", "Заглавие",
+"Toggle details", "Toggle детайли",
+"Tourism / Travel", "Туризъм/Пътуване",
+"Traditional arts", "Традиционни изкуства",
+"Traditional music", "Традиционна музика",
+"Transcode/av-lib", "Транскодиране/av-lib",
+"Transponder ID", "Транспондер ID",
+"Tue", "Вторник",
+"Tuner bind IP address", "Ай пи адрес свързан с тунера",
+"Tuning failed", "Нстройката неуспешна",
+"Turn off LNB when idle", "Изключи конвертора когато бездейства",
+"Type", "Вид",
+"URL with the SAT>IP server XML location", "URL със SAT>IP сървър XML локация",
+"Uncommitted", "Необвързани",
+"Unimportant", "Маловажни",
+"Universal LNB only", "Само универсален конвертор",
+"Unknown", "Непознат",
+"Unknown reason (%i)", "Неизвестна причина (%i)",
+"Unset (default)", "Ненастроено(по подразбиране)",
+"Usage: %s [OPTIONS]\n", "Натоварване: %s [OPTIONS]\n",
+"Use Windows-compatible filenames", "Използвай Уиндоус съвместими файлови имена",
+"Use XSPF playlist instead of M3U", "Използвай XSPF плейлисти вместо M3U",
+"Use original", "Използвай оргинала",
+"User access error", "Грешка в достъпа на потребителя",
+"User limit reached", "Лимита на юзери е достигнат",
+"Username", "Име на потребител",
+"Variety show", "Вариететно шоу",
+"Video", "Видео",
+"Visually impaired commentary/audio description", "За хора с увредено зрение/аудио описания",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV профил H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV профил H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV профил VP8/Vorbis/WEBM",
+"Waiting for program start", "Изчакване за започване на програмата",
+"Waiting for stream", "Изчакване на стриим",
+"War", "Война",
+"Water sport", "Воден спорт",
+"Weather report", "Прогнози за времето",
+"Wed", "Сряда",
+"Western", "Уестърн",
+"addpids/delpids supported", "Потдръжка на изтриване/добавяне на пидове",
+"hrs", "часа",
+"invalid option specified [%s]", "попълнена е невалидна стойност [%s]",
+"min", "мин",
+"mins", "мин",
+"option %s requires a value", "опция %s изисква стойност",
+"tsfile input (mux file)", "Входен TS файл (mux файл)",
+NULL, NULL
+};
+
+static const char *tvh_locale_2[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nPro získání více informací navštivte webovou stránku programu Tvheadend:\nhttps://tvheadend.org\n",
+"# Channels", "# Programů",
+"# Mapped channels", "# Mapovaných programů",
+"# Muxes", "# Muxů",
+"# Services", "# Služeb",
+"# Services seen", "# Viděných služeb",
+"# tune repeats", "Opakování ladění",
+"(Default profile)", "(Výchozí profil)",
+"(Read-only)", "(Pouze pro čtení)",
+"1 day", "1 den",
+"1 month", "1 měsíc",
+"1 week", "1 týden",
+"1 year", "1 rok",
+"2 months", "2 měsíce",
+"2 weeks", "2 týdny",
+"2 years", "2 roky",
+"2-Port switch (universal LNB)", "2-portový přepínač (Univerzální LNB)",
+"3 days", "3 dny",
+"3 months", "3 měsíce",
+"3 weeks", "3 týdny",
+"3 years", "3 roky",
+"4-Port switch (universal LNB)", "4-portový přepínač (Univerzální LNB)",
+"5 days", "5 dnů",
+"6 months", "6 měsíců",
+"A channel tag (e.g. a group of channels) to which this rule applies.", "Štítek programu (t.j. skupina programů) pro které bude aplikováno toto pravidlo.",
+"AC-3 = descriptor 6", "AC-3 = deskriptor 6",
+"AC-3 detection", "AC-3 detekce",
+"ACTIVE", "AKTIVNÍ",
+"ANY", "Jakýkoliv",
+"ATSC source ID", "ATSC zdrojové ID",
+"ATSC-C network", "Síť ATSC-C",
+"ATSC-T network", "Síť ATSC-T",
+"Aborted by user", "Zrušeno uživatelem",
+"Accept remote subscription weight", "Akceptovat vzdálenou váhu odběru",
+"Accept the remote subscription weight (from the SAT>IP client).", "Akceptovat vzdálenou váhu odběru (od SAT>IP klienta)",
+"Access", "Přístup",
+"Access Entries", "Přístupové položky",
+"Action", "Akce",
+"Adapter in use by another subscription", "Adaptéry používané jiným odběratelem",
+"Add file and line numbers to debug", "Přidá název souboru a řádek do ladícího výstupu",
+"Add the thread ID to debug", "Přidá identifikaci vlákna do ladícího výstupu",
+"Additional arguments to pass to the grabber.", "Dodatečné argumenty pro příkaz grabberu.",
+"Additional service names found in EPG data.", "Dodatečné názvy služeb nalezené v EPG datech.",
+"Admin", "Administrátor",
+"Admin password", "Heslo administrátora",
+"Admin username", "Uživatelské jméno administrátora",
+"Administrator login", "Uživatelské jméno administrátora",
+"Adult movie", "Film pro dospělé",
+"Advanced", "Rozšířené",
+"Advanced (non-universal LNBs, rotors, etc.)", "Pokročílé (neuniverzální LNB, rotory, apod.)",
+"Advanced streaming", "Pokročilé streamování",
+"Adventure", "Dobrodružství",
+"Advertisement / Shopping", "Reklama / Nakupování",
+"All (Streaming plus DVR)", "Vše (streamování plus DVR)",
+"All DVR (rw)", "Vše DVR (rw)",
+"All lower-case", "Vše malá písmena",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Všechny příspěvky jsou použity pro serverovou infrastrukturu a pro nákup testovacího vybavení.",
+"All: Record if different description", "Vše: Zaznamenat pokud je jiný popis",
+"All: Record if different episode number", "Vše: Zaznamenat pokud je jiné číslo epizody",
+"All: Record if different subtitle", "Vše: Zaznamenat pokud je jiný podtitulek",
+"All: Record once per day", "Vše: Zaznamenat jednou denně",
+"All: Record once per week", "Vše: Zaznamenat jednou týdně",
+"Allow high bitrate mode (CI+ CAMs only).", "Povolit vyšší datovou propustnost (pouze CI+ CAMs).",
+"Allow idle scan tuning on this device.", "Povolit skenování pokud zařízení není využíváno.",
+"Allow to show the quick tips for the form fields.", "Povolit zobrazování rychlých tipů (nápovědy) pro položky formuláře.",
+"Allow/disallow HTTP streaming.", "Povolit/zakázat HTTP streamování.",
+"Allowed network", "Povolené síťě",
+"Allowed networks", "Povolené síťě",
+"Alternate PID path", "Alternativní cesta k PID",
+"Alternate configuration path", "Alternativní cesta ke konfiguraci",
+"Altitude (in meters).", "Nadmořská výška (metry)",
+"Altitude (meters)", "Výška (metry)",
+"Animals", "Zvířata",
+"Anonymize HTSP access", "Anonymizace přístupu přes HTSP",
+"Any", "Libovolný",
+"Arts", "Umění",
+"Assign predefined muxes to networks", "Přiřadit předdefinované muxy k sítím.",
+"Athletics", "Atletika",
+"Audio birate to use for transcoding.", "Nastavení použité rychlosti pro audio pro transkódování.",
+"Audio bitrate (kb/s) (0=auto)", "Audio bitrate (kb/s) (0=Auto)",
+"Audio channel layout.", "Konfigurace audio kanálů.",
+"Audio codec", "Audio kodek",
+"Audio language (Not currently used).", "Jazyk pro audio (momentálně nepoužito).",
+"Audio stream filter", "Filtr audio streamu",
+"Auto", "Automatické",
+"Auto check disabled", "Zakázána automatická kontrola",
+"Auto check enabled", "Povolena automatická kontrola",
+"Auto record", "Automatický rekordér",
+"Auto record caption", "Titulek pro automatický rekordér",
+"Auto recording%s%s", "Automatický rekordér%s%s",
+"Auto time record", "Automatický časový rekordér",
+"Auto-Map to channels", "Automatické mapování do programů",
+"Automatic checking", "Automatická kontrola",
+"Automatic recording caption.", "Titulek pro automatický rekordér.",
+"Automatically map EPG source", "Automatické mapování EPG zdroje",
+"Automatically name from network", "Automatický název ze sítě",
+"Automatically record.", "Automatický záznam.",
+"Autorec maximum count (0=unlimited)", "Autorekordér - maximální počet (0=neomezeno)",
+"Autorec maximum schedules limit (0=unlimited)", "Autorekordér - maximálni počet časovačů (0=neomezeno)",
+"Bad", "Špatný",
+"Bad request", "Chybný požadavek",
+"Ballet", "Balet",
+"Bandwidth", "Šířka pásma",
+"Based on software from", "Použitý software od",
+"Basic", "Základní",
+"Bind to specific local IP address.", "Naslouchej na specifikované lokální IP adrese.",
+"Blue", "Modrý",
+"Bouquet", "Buket",
+"Bouquet (auto)", "Buket (automatický)",
+"Bouquet source.", "Zdroj pro buket.",
+"Brand", "Značka",
+"Branding information (if available).", "Informace o značení (pokud je dostupné).",
+"Broadcast", "Vysílání",
+"Broadcast type", "Typ vysílání",
+"Broadcast.", "Vysílání.",
+"Broadcasting", "Vysílání",
+"Buffering limit (ms)", "Limit pro vyrovnávací paměť (ms)",
+"Build", "Sestavení",
+"CA client %i", "CA klient %i",
+"CA identification", "CA identifikace",
+"CA provider", "CA poskytovatel",
+"CAPMT interval (in ms).", "CAPMT interval (v ms).",
+"CAPMT interval (ms)", "CAPMT Interval (ms)",
+"CAPMT query interval (ms)", "CAPMT interval dotazů (ms)",
+"CAPMT query interval (ms).", "CAPMT interval dotazu (ms).",
+"CRID authority", "CRID autorita",
+"Cache scheme", "Schéma mezipaměti",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket soubor / IP adresa (TCP mód)",
+"Cartoons", "Animované pohádky",
+"Channel", "Program",
+"Channel does not exist", "Kanál neexistuje",
+"Channel icon", "Ikona programu",
+"Channel icon path (see Help)", "Cesta k ikoně programu (viz. nápověda)",
+"Channel name", "Název programu",
+"Channel not found", "Program nebyl nalezen",
+"Channel number", "Číslo programu",
+"Channel number offset", "Přidej k číslu programu",
+"Channel numbers from", "Počáteční číslo programu",
+"Channel tag", "Štítek programu",
+"Channel tag reference", "Reference štítku programu",
+"Channel tags", "Štítky programů",
+"Channels", "Programy",
+"Character set", "Znaková sada",
+"Check availability", "Kontrola dostupnosti",
+"Children's / Youth programs", "Dětské / programy pro mladé",
+"Cinema", "Kino",
+"Class", "Třída",
+"Classical", "Klasické",
+"Classical music", "Klasická hudba",
+"Clean effects", "Čisté efekty",
+"Client name", "Název klienta",
+"Clone scheduled entry on error", "Klonovat naplánovaný záznam při chybě",
+"Comedy", "Komedie",
+"Command delay time (ms) (10-200)", "Zpoždění příkazu (ms) (10-200)",
+"Command time (ms) (10-100)", "Čas pro příkaz (ms) (10-100)",
+"Comment", "Komentář",
+"Commercial break", "Komerční přestávka",
+"Completed OK", "Dokončeno v pořádku",
+"Compress EPG database", "Komprimovat EPG databázi",
+"Conditional access client", "Klient systém podmíněného přístupu",
+"Configuration", "Konfigurace",
+"Configuration ID", "ID konfigurace",
+"Configuration name", "Název konfigurace",
+"Configuration version", "Verze konfigurace",
+"Connection limit type", "Typ limitu pro spojení",
+"Constellation", "Konstelace",
+"Container", "Kontejner",
+"Content character set", "Znaková sada pro obsah",
+"Content type", "Typ obsahu",
+"Content type.", "Typ obsahu.",
+"Contest", "Soutěž",
+"Continue even if descrambling fails", "Pokračovat i při chybě dekódování",
+"Continue recording for x minutes after scheduled stop time", "Pokračovat v záznamu dalších x minut po naplánovaném konci",
+"Continue recording for x minutes after scheduled stop time.", "Pokračovat v záznamu dalších x minut po naplánovaném konci.",
+"Cookie expiration (days)", "Expirace cookie (dny)",
+"Cooking", "Vaření",
+"Copy codec type", "Kopíruj typ kodeku",
+"Copy layout", "Kopíruj dispozici",
+"Count of objects", "Počet objektů",
+"Create SDTV/HDTV/Radio tags.", "Vytvořit SDTV/HDTV/Radio štítky.",
+"Create a provider name tag.", "Vytvořit štítek poskytovatele.",
+"Create bouquet", "Vytvořit buket",
+"Create network name tags", "Vytvořit štítky pro názvy sítí",
+"Create network name tags (set by provider).", "Vytvořit štítky pro názvy sítí (od poskytovatele obsahu).",
+"Create network tags", "Vytvořit štítky pro sítě",
+"Create provider name tags", "Vytvořit štítek poskytovatele",
+"Create provider tags", "Vytvořit štítek poskytovatele",
+"Create tags", "Vytvořit štítky",
+"Created", "Vytvořeno",
+"Creator", "Vytvořil",
+"Cron multi-line", "Víceřádkový cron",
+"Culture (without music)", "Kultura (bez hudby)",
+"Current RTSP port.", "Současný RTSP port.",
+"Current affairs", "Aktuální události",
+"Custom HTTP headers", "Zvláštní HTTP hlavičky",
+"DAB network", "Síť DAB",
+"DBus - use the session message bus instead of the system one", "DBUs - použije se 'session' sběrnice pro zprávy místo systémové",
+"DES constant code word client", "DES constant code word klient",
+"DES key", "Klíč DES",
+"DSCP/TOS for streaming", "DSCP/TOS pro streamování",
+"DVB scan files", "DVB scan soubory",
+"DVB scan files path", "Cesta k souborům pro DVB scan",
+"DVB-C network", "DVB-C síť",
+"DVB-S 4-port", "DVB-S 4-portový",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, experimentální)",
+"DVB-S advanced", "DVB-S rozšířený",
+"DVB-S network", "DVB-S síť",
+"DVB-S satellite configuration", "DVB-S satelitní konfigurace",
+"DVB-S simple", "DVB-S jednoduchý",
+"DVB-T network", "DVB-T síť",
+"DVR Auto-record entry", "Položka DVR auto-rekordéru",
+"DVR Entries", "Položky DVR",
+"DVR behavior", "Chování DVR",
+"DVR configuration", "Konfigurace DVR",
+"DVR configuration profile", "Konfigurační profil DVR",
+"DVR configuration profiles", "Konfigurační profily DVR",
+"DVR entry not found", "Položka DVR nebyla nalezena",
+"DVR file retention period", "Čas vymazání DVR souborů",
+"DVR log retention", "Čas držení DVR logů",
+"DVR log retention period", "Čas vymazání DVR souborů",
+"DVR override: high", "Vynucení vysoké DVR priority",
+"DVR override: important", "Vynucení důležité DVR priority",
+"DVR override: low", "Vynucení nízké DVR priority",
+"DVR override: normal", "Vynucení standardní DVR priority",
+"DVR override: unimportant", "Vynucení nedůležité DVR priority",
+"DVR time record entry", "Time-rekordér položka",
+"Dance", "Tanec",
+"Data errors", "Chyby v datech",
+"Data path (if applicable).", "Datová cesta (pokud je nutná).",
+"Days of Week", "Dny v týdnu",
+"Days of week", "Dny v týdnu",
+"Debate", "Debata",
+"Debug libav log", "Ladící výstup z libav",
+"Debug log path", "Soubor pro ladící výstup",
+"Debug options", "Ladící možnosti",
+"Debug subsystems", "Povolit ladící podsystémy",
+"Debug to syslog", "Povolit ladící výstop pro syslog",
+"Debug trace (low-level)", "Povol trasování (velmi podrobné)",
+"Debugging", "Ladění",
+"Default", "Standardní",
+"Default language(s)", "Výchozí jazyk(y)",
+"Default language.", "Výchozí jazyk.",
+"Default priority", "Výchozí priorita",
+"Default user interface level.", "Výchozí úroveň uživatelského rozhraní.",
+"Delivery system", "Systém doručení",
+"Demux path", "Cesta k demuxu",
+"Descramble services (limit per mux)", "Dekóduj služby (limit pro mux)",
+"Descrambler buffer (TS packets)", "Vyrovnávací paměť dekódéru (TS pakety)",
+"Description", "Popis",
+"Detective", "Detektivka",
+"Device ID", "ID zařízení",
+"Device model", "Model zařízení",
+"Device path", "Cesta k zařízení",
+"Directory", "Adresář",
+"Directory permissions (octal, e.g. 0775)", "Práva k adresáři (osmičkové, např. 0775)",
+"Disable", "Zakázat",
+"Disable DVB bouquets", "Zakázat DVB bukety",
+"Disable SAT>IP client", "Zakázat SAT>IP klienta",
+"Disable all access control checks", "Zakázat veškeré přístupové kontroly",
+"Disable debug on stderr", "Povolit ladící pro syslog",
+"Disable device/firmware-specific workarounds", "Zakaž specifické workaroundy pro zařízení/firmware",
+"Disable syslog (all messages)", "Zakázat veškerý výstup pro syslog",
+"Disabled", "Zakázáno",
+"Discussion", "Diskuze",
+"DiseqC repeats", "DiseqC opakování",
+"DiseqC switch", "DiseqC přepínač",
+"Do not use", "Nepoužívat",
+"Documentary", "Dokumentární",
+"Don't backup configuration tree at upgrade", "Nezálohovat konfigurační strom při aktualizaci",
+"Don't include title in filename", "Nevkládat název vysílání do jména souboru",
+"Don't keep", "Nezanechávej",
+"Don't re-record", "Nezaznamenávej znovu",
+"Don't reschedule", "Nepřeplánovávat",
+"Duplicate handling", "Zacházení s duplicitami",
+"EIT - skip TSID check", "EIT - nekotrolovat TSID",
+"EIT time offset", "EIT časový posun",
+"EPG Language (priority order)", "Jazyk EPG (dle priority)",
+"EPG data ID.", "Identifikátor EPG dat.",
+"EPG grabber", "EPG graber",
+"EPG grabber channel", "Program EPG graberu",
+"EPG grabber configuration", "Konfigurace EPG graberu",
+"EPG name", "Název EPG",
+"EPG scan timeout in seconds (30-7200)", "Timeout pro EPG scan v sekundách (30-7200)",
+"EPG source", "Zdroj EPG",
+"EPG update window", "EPG časové okno aktualizace",
+"Economics", "Ekonomika",
+"Education", "Vzdělání",
+"Educational", "Vzdělávací",
+"Elementary stream filter", "Filtr elementárního streamu",
+"Enable (auto)", "Povolit (auto)",
+"Enable DBus", "Povolit DBus",
+"Enable NTP driver", "Povolit NTP ovladač",
+"Enable coredumps for daemon", "Povolit coredump pro démona",
+"Enable debug on stderr", "Povolit ladící výstup na stderr",
+"Enable debug subsystems", "Povolit ladící podsystémy",
+"Enable debug to file", "Povolit ladící výstup do souboru",
+"Enable debug to syslog", "Povolit ladící výstop pro syslog",
+"Enable or disable fast input switching.", "Povolit nebo zakázat rychlé přepínání vstupů.",
+"Enable or disable full mux mode.", "Povolit nebo zakázat příjem celého muxu.",
+"Enable or disable the mux.", "Povolit nebo zakázat mux.",
+"Enable or disable this configuration.", "Povolit nebo zakázat tuto konfiguraci.",
+"Enable syslog", "Povolit syslog",
+"Enable this filter.", "Povolit tento filtr.",
+"Enable trace subsystems", "Povolit trasovací subsystémy",
+"Enable web UI debug (non-minified JS)", "Povolit ladění webUI (neminimalizované JS)",
+"Enable/disable LNA.", "Povolit/zakázat LNA.",
+"Enable/disable profile.", "Povolit/zakázat profil.",
+"Enable/disable the tag.", "Povolit/zakázat štítek.",
+"Enabled", "Povoleno",
+"Encrypted", "Zakódováno",
+"Encrypted service", "Zakódovaná služba",
+"Enter external IP if behind Network address translation (NAT).", "Vložit externí IP, pokud je hostitelský počítač za bránou NAT.",
+"Entertainment programs for 10 to 16", "Zábavné programy od 10 do 16",
+"Entertainment programs for 6 to 14", "Zábavné programy od 6 do 14",
+"Environment", "Životní prostředí",
+"Environment (pipe)", "Prostředí (roura)",
+"Episode", "Epizoda",
+"Episode %d", "Epizoda %d",
+"Episode number/ID.", "Číslo epizody/identifikátor",
+"Error code", "Kód chyby",
+"Error code of entry.", "Kód chyby pro položku.",
+"Errors", "Chyby",
+"Even key", "Sudý klíč",
+"Event does not exist", "Událost neexistuje",
+"Every day", "Každý den",
+"Exclude channel tags", "Vyjmout štítky programů",
+"Expeditions", "Expedice",
+"Experimental film", "Experimentální film",
+"Exported tuners", "Exportované tunery",
+"External", "Externí",
+"External EPG grabber", "Externí EPG graber",
+"External IP (NAT)", "Externí IP (NAT)",
+"External PyEPG grabber", "Externí PyEPG graber",
+"External URL", "Externí URL",
+"Extra arguments", "Extra argumenty",
+"Extra start time", "Extra začáteční čas",
+"Extra stop time", "Extra koncový čas ",
+"Extra warming up time (seconds)", "Extra zahřívací čas (sekundy)",
+"FAIL", "NEÚSPĚŠNÝ",
+"Factual topics", "Fakta",
+"Failed", "Nezdařené",
+"Failed DVR", "Neuspěšné DVR",
+"Failed to open image", "Nemohu otevřít soubor",
+"Fast input switch", "Rychlé přepnutí vstupu",
+"File missing", "Soubor chybí",
+"File not created", "Soubor nebyl vytvořen",
+"File permissions (octal, e.g. 0664)", "Práva souboru (osmičkové, např. 0664)",
+"File size", "Velikost souboru",
+"Filename", "Jméno souboru",
+"Filename character set", "Znaková sada jména souboru",
+"Filename options", "Volby pro jméno souboru",
+"Fine arts", "Výtvarné umění",
+"Finished", "Ukončený",
+"First word", "První slovo",
+"Fit to RAM (cut rewind)", "Pouze v RAM (omezit přetáčení dozadu)",
+"Fitness and health", "Fitnes a zdraví",
+"Folk", "Lidový",
+"Folkloric", "Folkról",
+"Football", "Fotbal",
+"Force (auto)", "Vynutit (auto)",
+"Force CA ID (e.g. 0x2600)", "Vynutit CA ID (e.g. 0x2600)",
+"Force old status", "Vynutit starý status",
+"Force pilot for DVB-S2", "Vynutit pilot pro DVB-S2",
+"Force priority", "Vynutit prioritu",
+"Force service type to 1", "Vynutit typ služby jako 1",
+"Force teardown delay", "Vynutit zpoždění teardown",
+"Foreign countries", "Cizí země",
+"Forever", "Navždy",
+"Fork and run as daemon", "Démon mód",
+"Format string", "Řetězec formátu",
+"Found muxes", "Nalezeno multiplexů",
+"Found services", "Nalezeno služeb",
+"Frequency", "Frekvence",
+"Frequency (Hz)", "Frekvence (Hz)",
+"Frequency (MHz)", "Frekvence (MHz)",
+"Frequency (in MHz).", "Frekvence (v MHz).",
+"Frequency (kHz)", "Frekvence (kHz)",
+"Fri", "Pát",
+"Friendly name", "Přátelské jméno",
+"Frontend number", "Číslo frontendu",
+"Frontend path", "Cesta k frontendu",
+"Full DiseqC", "Celý DiseqC",
+"Full mux RX mode supported", "Podporován plný mux rx mód",
+"Full pathname specification", "Plná specifikace cesty",
+"Further education", "Další vzdělání",
+"GOTOX position", "GOTOX pozice",
+"Game show", "Herní show",
+"Gardening", "Zahradničení",
+"General", "Základní",
+"General configuration", "Základní konfigurace",
+"Generic", "Obecný",
+"Generic options", "Generické možnosti",
+"Gray", "Šedivý",
+"HD: high definition", "HD: vysoké rozlišení",
+"HTSP Default Stream Settings", "HTSP standardní nastavení streamu",
+"HTSP stream profile", "HTSP profil streamu",
+"HTSP streaming", "HTSP streamování",
+"Handicraft", "Řemeslo",
+"Hearing impaired", "Zhoršený sluch",
+"Hierarchy", "Hierarchie",
+"High", "Vysoká",
+"High bitrate mode (CI+ CAMs only)", "High bitrate mód (CI+ CAMs Only)",
+"Historical movie", "Historický film",
+"Horror", "Horor",
+"Hostname/IP", "Jméno /IP",
+"IDLE", "NEČINNÝ",
+"IP address", "IP adresa",
+"IP blocking", "Blokování IP",
+"IPTV automatic network", "Automatická IPTV síť",
+"IPTV input", "IPTV vstup",
+"IPTV network", "IPTV síť",
+"Icon", "Ikona",
+"Icon (full URL)", "Ikona (celé URL)",
+"Icon URL", "URL ikony",
+"Icon base URL", "Základní URL pro ikony",
+"Icon has title", "Ikona má název",
+"Icons from", "Ikony jsou od",
+"Idle", "Nečinný",
+"Idle scan", "Vyhledávání při nečinnosti",
+"Idle scan muxes", "Vyhledávání muxů při nečinnosti",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Pokud není vytvořený žádný uživatelský účet,\ntak se vytvoří účet bez uživatelského jména\na hesla. Je doporučené tento administrátorský\núčet okamžitě změnit (uživatelské jméno a heslo)",
+"If you'd like to support the project, please consider a donation.", "Pokud se Vám tento projekt líbí, prosíme, zvažte příspěvek.",
+"Ignore EPG (EIT)", "Ignorovat EPG (EIT)",
+"Ignore descriptor 5", "Igoruj deskritor 5",
+"Ignore invalid SSL certificate", "Ignorovat neplatné SSL certifikáty",
+"Ignore provider's channel numbers", "Ignorovat čísla programů od poskytovatele",
+"Image cache", "Mezipaměť pro obrázky",
+"Immediately abort", "Okamžitě ukonči činnost",
+"Important", "Důležíté",
+"Include channel name in filename", "Vložit název programu do jména souboru",
+"Include date in filename", "Vložit datum do jména souboru",
+"Include episode in filename", "Vložit epizodu do jména souboru",
+"Include subtitle in filename", "Vložit podtitulek do jména souboru",
+"Include time in filename", "Vložit čas do jména souboru",
+"Information area", "Informační oblast",
+"Informational", "Informační",
+"Initial scan", "Počáteční vyhledávání",
+"Input base", "Základní vstup",
+"Input buffer (bytes)", "Vstupní paměť (byty)",
+"Input instance", "Instance vstupu",
+"Input path", "Cesta k zařízení",
+"Interface", "Interfejs",
+"Internal", "Interní",
+"Internal EPG grabber", "Interní EPG graber",
+"Internal error", "Interní chyba",
+"Internal grabber", "Interní graber",
+"Invalid", "Chybný",
+"Invalid adapter number '%s'\n", "Chybné číslo adaptéru '%s'\n",
+"Invalid arguments", "Chybné argumenty",
+"Invalid file", "Chybný soubor",
+"Invalid parameters", "Chybné parametry",
+"Invalid target", "Chybný cíl",
+"Items", "Položky",
+"Keep", "Zachovat",
+"Kill signal (pipe)", "Signál pro kill (roura)",
+"Kill timeout (pipe/secs)", "Timeout pro kill (roura/sek)",
+"LNB type", "Typ LNB",
+"Language", "Jazyk",
+"Language 1", "Jazyk 1",
+"Language 2", "Jazyk 2",
+"Language 3", "Jazyk 3",
+"Language settings", "Jazykové nastavení",
+"Languages", "Jazyky",
+"Last seen", "Naposledy viděn",
+"Last updated from", "Naposledy aktualizováno z",
+"Layer A: Constellation", "Vrstva A: Konstelace",
+"Layer A: FEC", "Vrstva A: FEC",
+"Layer A: Segment count", "Vrstva A: Počet segmentů",
+"Layer A: Time interleaving", "Vrstva A: Časové prokládání",
+"Layer B: Constellation", "Vrstva B: Konstelace",
+"Layer B: FEC", "Vrstva B: FEC",
+"Layer B: Segment count", "Vrstva B: Počet segmentů",
+"Layer B: Time interleaving", "Vrstva B: Časové prokládání",
+"Layer C: Constellation", "Vrstva C: Konstelace",
+"Layer C: FEC", "Vrstva C: FEC",
+"Layer C: Segment count", "Vrstva C: Počet segmentů",
+"Layer C: Time interleaving", "Vrstva C: Časové prokládání",
+"Leisure hobbies", "Volný čas / koníčky",
+"Limit connections", "Limit spojení",
+"Linked input", "Spojený vstup",
+"Linux DVB-S slave frontend", "Linux DVB-S podřízený frontend",
+"LinuxDVB adapter", "LinuxDVB adaptér",
+"LinuxDVB network", "LinuxDVB síť",
+"Listen / Connect port", "Port pro příjem/vysílání",
+"Listen on IPv6", "Poslouchej na IPv6",
+"Literature", "Literatura",
+"Local (server) time", "Lokální čas (na serveru)",
+"Local bind IP address", "Lokální IP adresa pro komunikaci",
+"Local channel minor", "Lokální číslo programu - vedlejší",
+"Local channel number", "Lokální číslo programu",
+"Local discovery IP address", "Lokální IP adresa pro vyhledávání",
+"Location", "Umístění",
+"Lock preferred CA PID", "Pouze preferovaná CA PID",
+"Login/Logout", "Přihlášení/Odhlášení",
+"Low", "Nízká",
+"MPEG-TS input", "MPEG-TS vstup",
+"MPEG-TS network", "MPEG-TS síť",
+"MPEG-TS raw service", "MPEG-TS holá služba",
+"MPEG-TS service", "MPEG-TS služba",
+"Magazines", "Magazíny",
+"Maintained space", "Udržovaný prostor",
+"Make subdirectories per channel", "Vytvořit podadresáře pro každý programu",
+"Make subdirectories per day", "Vytvořit podadresáře pro každý den",
+"Make subdirectories per title", "Vytvořit podadresáře pro každý název",
+"Manufacturer", "Výrobce",
+"Manufacturer URL", "URL výrobce",
+"Map all services", "Mapuj všechny služby",
+"Map encrypted services", "Mapovat šifrované služby",
+"Map radio channels", "Mapuj rádio programy",
+"Map unnamed channels", "Mapuj nepojmenované programy",
+"Map zero-numbered channels", "Mapování nulových čísel",
+"Master tuner", "Hlavní tuner",
+"Matroska specific", "Specifické pro matroska formát",
+"Maximal channel number", "Maximální číslo programu",
+"Maximum # input streams", "Maximální počet vstupních streamů",
+"Maximum PIDs", "Max. počet PID",
+"Maximum RAM size (MB)", "Maximální velikost RAM (MB)",
+"Maximum bandwidth (Kbps)", "Maximální šířka pásma (Kbps)",
+"Maximum count (0=default)", "Maximální počet (0=výchozí)",
+"Maximum duration", "Maximální doba",
+"Maximum length of PIDs", "Maximální velikost PID",
+"Maximum period (mins)", "Maximální perioda (minuty)",
+"Maximum schedules limit (0=default)", "Maximálni počet časovačů (0=výchozí)",
+"Maximum size (MB)", "Maximální velikost (MB)",
+"Maximum timeout (seconds)", "Maximální čas odezvy (sekund)",
+"Medicine", "Lékařství",
+"Memory Information", "Informace o paměti",
+"Merge same name", "Spoj stejný název",
+"Method not found", "Metoda nebyla nalezena",
+"Minimal channel number", "Minimální číslo programu",
+"Minimum duration", "Minimální doba",
+"Minimum rotor time (seconds)", "Min. čas rotoru (sekundy)",
+"Missing In PAT/SDT", "Chybí v PAT/SDT",
+"Mode", "Mód",
+"Model description", "Popis modelu",
+"Model name", "Název modelu",
+"Model number", "Číslo modelu",
+"Modulation", "Modulace",
+"Module", "Modul",
+"Module ID", "ID modulu",
+"Mon", "Pon",
+"More verbose libav log", "Více upovídaný log pro libav",
+"Motor rate (in milliseconds/deg).", "Rychlost motoru (v milisekundách/stupeň).",
+"Motor rate (milliseconds/deg)", "Rychlost motoru (ms/stupeň)",
+"Motor sport", "Motorové sporty",
+"Motoring", "Automobilismus",
+"Movie", "Film",
+"Music", "Hudba",
+"Musical", "Muzikál",
+"Mux UUID", "UUID muxu",
+"Mux handling", "Zacházení s muxy",
+"Mux name", "Jméno muxu",
+"Mux not enabled", "Mux není povolen",
+"Mux schedule entry", "Položka plánovače muxů",
+"NONE", "NIC",
+"Name", "Název",
+"Name (or date) of program the entry is a rerun of.", "Název (nebo čas) opakování události.",
+"Name of the entry.", "Název položky.",
+"Name of the network.", "Název sítě.",
+"Name of the profile.", "Název profilu.",
+"Name of the tag.", "Název štítku.",
+"Name of the tuner.", "Název tuneru.",
+"Name of the tuner/adapter.", "Název tuneru/adaptéru.",
+"Name. The name given to/of the channel (This is how it'll appear in your EPG.)", "Název programu (takto bude program prezentován v EPG).",
+"Names", "Jména",
+"Natural sciences", "Přírodní vědy",
+"Nature", "Příroda",
+"Network", "Síť",
+"Network ", "Síť",
+"Network A", "Síť A",
+"Network B", "Síť B",
+"Network ID (limit scanning)", "ID síťě (limit pro vyhledávání)",
+"Network UUID", "UUID sítě",
+"Network access", "Přístup k síti",
+"Network discovery", "Vyhledávání sítí",
+"Network group", "Skupina sítě",
+"Network name", "Název sítě",
+"Network prefix", "Prefix sítě",
+"Network settings", "Nastavení sítě",
+"Network type", "Typ sítě",
+"Networks", "Sítě",
+"News", "Zprávy",
+"News magazine", "Magazín se zprávami",
+"Next tune delay in ms (0-2000)", "Zpoždění pro další ladění v ms (0-2000)",
+"No", "Ne",
+"No PIN", "Žádný PIN",
+"No access", "Přístup nepovolen",
+"No adapters specified!\n", "Žádné adaptéry nebyly specifikovány!\n",
+"No assigned adapters", "Žádné adaptéry nejsou přiřazeny",
+"No days", "Žádné dny",
+"No descrambler", "Žádný dešifrátor",
+"No free adapter", "Žádný adaptér není volný",
+"No input detected", "Žádný vstup nebyl detekován",
+"No scheme", "Žádné schéma",
+"No service assigned to channel", "Žádná služba není přiřazena programu",
+"No service enabled", "Žádná služba není povolená",
+"No source available", "Žádný zdroj není dostupný",
+"None", "Žádný",
+"Normal", "Standardní",
+"Not enough memory", "Nedostatek paměti",
+"Not linked", "Nespojeno",
+"Not set", "Nenastaveno",
+"Not set (none or channel configuration)", "Nenastaveno (žádný nebo z konfigurace programu)",
+"Not set (use channel or DVR configuration)", "Nenastaveno (použij konfiguraci programu nebo DVR)",
+"Number", "Číslo",
+"Number of muxes found.", "Počet nalezených muxů.",
+"Number of services.", "Počet služeb.",
+"Number of tsfile tuners", "Počet tsfile tunerů",
+"OK (partial)", "OK (částečný)",
+"OSCam net protocol (rev >= 10389)", "OSCam net protokol (rev >= 10389)",
+"Odd key", "Lichý klíč",
+"Off", "Vypnuto",
+"Older OSCam", "Starší OSCam",
+"On", "Zapnuto",
+"On file removal", "Vymazání souborů",
+"Once per auto channel", "Jednou pro automatický program",
+"Only Bulsatcom 39E", "Pouze Bulsatcom 39E",
+"Only EIT", "Pouze EIT",
+"Only OpenTV Sky Ausat", "Pouze OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Pouze OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Pouze OpenTV Sky UK",
+"Only PSIP (ATSC)", "Pouze PSIP (ATSC)",
+"Only UK Freesat", "Pouze UK Freesat",
+"Only UK Freeview", "Pouze UK Freeview",
+"Only Viasat Baltic", "Pouze Viasat Baltic",
+"Only digits", "Pouze čislovky",
+"Only preferred CA PID", "Pouze preferovaná CA PID",
+"OpenTV channel number", "OpenTV číslo programu",
+"Orbital position", "Orbitální pozice",
+"Orbital positions", "Orbitální pozice",
+"Orbital positions.", "Orbitální pozice.",
+"Original network ID", "Originální ID sítě",
+"Other stream filter", "Filtr jiného streamu",
+"Output directory for tsdebug", "Výstupní adresář pro tsdebug",
+"Over-the-air Cron multi-line", "Over-the-air víceřádkový cron",
+"Over-the-air EPG grabber", "Over-the-air EPG graber",
+"Over-the-air grabbers", "Over-the-air grabery",
+"Owner", "Majitel",
+"PEND", "NEDOKONČENÝ",
+"PIDs 21 in setup", "PID číslo 21 v setup příkazu",
+"PIDs in setup", "PID čísla v setup příkazu",
+"PIN inquiry match string", "PIN pro dotaz z karty",
+"Parent entry", "Rodičovská položka",
+"Parent entry.", "Rodičovská položka.",
+"Password", "Heslo",
+"Password for the entry.", "Heslo pro položku.",
+"Password2", "Heslo2",
+"Passwords", "Hesla",
+"Path", "Cesta",
+"Path used by the device.", "Cesta použitá zařízením.",
+"Peak count of objects", "Největší počet objektů",
+"Peak size", "Největší velikost",
+"Performing arts", "Múzických umění",
+"Periodically save EPG to disk (hours)", "Periodické ukládáni EPG na disk (hod)",
+"Persistent user interface level", "Neměnná úroveň uživatelského rozhraní",
+"Physiology", "Fyziologie",
+"Picon name scheme", "Schéma pro názvy picon",
+"Picon path (see Help)", "Cesta pro pikony (viz. nápověda)",
+"Polarization", "Polarizace",
+"Political issues", "Politické problémy",
+"Popular culture", "Populární kultura",
+"Position", "Pozice",
+"Post-processor command", "Příkaz pro další zpracování",
+"Post-recording padding", "Přidat čas na konci",
+"Post-remove command", "Příkaz po vymazání souboru",
+"Power save", "Úspora energie",
+"Power-up time (ms) (15-200)", "Startovací čas (ms) (15-200)",
+"Pre-defined muxes", "Předdefinované muxy",
+"Pre-recording padding", "Přidat čas na začátku",
+"Pre-school children's programs", "Programy pro předškolní děti",
+"Prefer picons over channel name", "Preferuj picony před názvy programů",
+"Preferred CA PID", "Preferovaná CA PID",
+"Preferred service video type", "Preferovaný typ videa pro službu",
+"Presentation", "Prezentace",
+"Presentation details.", "Detaily prezentace.",
+"Press", "Tisk",
+"Priority", "Priorita",
+"Priority (-10..10)", "Priorita (-10..10)",
+"Priority of the entry.", "Priorita položky.",
+"Priority of the recording.", "Priorita záznamu.",
+"Private", "Privátní",
+"Profile name", "Název profilu",
+"Provider", "Poskytovatel",
+"Provider ID", "ID poskytovatele",
+"Provider network name", "Název sítě poskytovatele",
+"Psychology", "Psychologie",
+"Puppets", "Batolata",
+"Quiz", "Kvíz",
+"RAM only", "Pouze RAM",
+"RTSP port", "RTSP Port",
+"RTSP port (554 or 9983, 0 = disable)", "RTSP port (554 or 9983), 0 = zakázat",
+"Radio", "Rádio",
+"Re-fetch period (hours)", "Perioda opětovního načtení (v hodinách)",
+"Re-fetch period (mins)", "Perioda pro nový pokus (v minutách)",
+"Re-record%s%s", "Opětovný rekordér%s%s",
+"Re-try period (hours)", "Perioda pro nový pokus (v hodinách)",
+"Read error", "Chyba čtení",
+"Record all", "Zaznamenat vše",
+"Recording file options", "Volby souboru pro záznam",
+"Recording system path", "Systémový adresář pro záznamy",
+"Reject", "Odmítnout",
+"Religion", "Náboženství",
+"Religious", "Náboženský",
+"Remarkable people", "Pozoruhodní lidé",
+"Remove HTTP arguments", "Vyjmout HTTP argumenty",
+"Remove all unsafe characters from filename", "Odebrat všechny nebezpečné znaky z jména souboru",
+"Repeated", "Opakovaný",
+"Replace whitespace in title with '-'", "Nahradit mezery v názvu znakem '-'",
+"Reply to CAM PIN inquiries", "Odpovědět na CAM PIN dotazy",
+"Reply to PIN inquiries.", "Odpovědět na CAM PIN dotazy",
+"Reports", "Zprávy",
+"Rerun of", "Opakovaní",
+"Rescan", "Nový scan",
+"Reserved", "Rezervováno",
+"Resolution (height)", "Rozlišení (výška)",
+"Respawn (pipe)", "Znovu spustit (roura)",
+"Restart on error", "Restartuj při chybě",
+"Reuse EPG from", "Použij EPG z",
+"Rewrite EIT", "Přepisovat EIT",
+"Rewrite MPEG-TS SI tables", "Přepsat MPEG-TS SI tabulky",
+"Rewrite PAT", "Přepisovat PAT",
+"Rewrite PMT", "Přepisovat PMT",
+"Rewrite SDT", "Přepisovat SDT",
+"Rotor initialization time (seconds)", "Počateční čas rotoru (sekundy)",
+"Rotor type", "Typ rotoru",
+"Run as group", "Skupina pro běh",
+"Run as user", "Uživatel pro běh",
+"Running", "Běží",
+"SAT->IP frontend number.", "Číslo SAT->IP frontendu.",
+"SAT>IP DVB-T frequency (Hz)", "SAT>IP DVB-T frekvence (Hz)",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP číslo portu pro server\n(defaultní: -1 = disable, 0 = webová konfigurace, standardní port je 554)",
+"SAT>IP client", "SAT>IP klient",
+"SAT>IP source number", "SAT>IP číslo zdroje",
+"SD: standard definition", "SD: standardní rozlišení",
+"SSL verify peer", "Verifikovat SSL",
+"Satconf", "Sat.konf.",
+"Satellite config", "Konfigurace satelitu",
+"Satellite longitude", "Zeměpisná délka satelitu",
+"Satellite positions", "Satelitní pozice",
+"Scan after creation", "Skenovat po vytvoření",
+"Scan progress", "Postup skenu",
+"Scan queue length", "Velikost fronty skenu",
+"Scan result", "Výsledek scanu",
+"Scan status", "Stav scanu",
+"Schedule a re-recording if more errors than (0=off)", "Zaznamenat znovu, pokud je počet chyb vyšší než (0=vypnout)",
+"Schedule status", "Stav plánovače",
+"Scheduled for recording", "Naplánované k záznamu",
+"Scheduled start time", "Naplánovaný čas začátku",
+"Scheduled stop time", "Naplánovaný čas konce",
+"School programs", "Školní programy",
+"Science", "Věda",
+"Science fiction", "Sci-fi",
+"Season", "Sezóna",
+"Season %d", "Sezóna %d",
+"Seek error", "Chyba nastavení pozice",
+"Select services to map.", "Vybrat služby k mapování.",
+"Select the time offset for EIT events.", "Nastavení časového posunu pro EIT události.",
+"Send CAPMT query", "Poslat CAPMT dotaz",
+"Send full PLAY cmd", "Poslat plný PLAY příkaz",
+"Serial number", "Sériové číslo",
+"Series link", "Odkaz série",
+"Series link ID.", "Identifikátor spojení pro série.",
+"Serious", "Vážný",
+"Serious music", "Vážná hudba",
+"Server UUID", "UUID serveru",
+"Server connectivity", "Konektivita serveru",
+"Server details.", "Detaily serveru.",
+"Service", "Služba",
+"Service ID", "ID služby",
+"Service configuration", "Konfigurace služeb",
+"Service count %zi", "Počet služeb %zi",
+"Service mapper", "Mapování služeb",
+"Service mapping", "Mapování služeb",
+"Service name", "Název služby",
+"Service name picons", "Picony s názvy služeb",
+"Service raw", "Základní služba",
+"Service type", "Typ služby",
+"Services", "Služby",
+"Set profile as default.", "Nastav profil jako výchozí.",
+"Set the display name.", "Nastaví název pro zobrazení.",
+"Settings", "Nastavení",
+"Show this page", "Ukaž tuto stránku",
+"Show version information", "Ukaž informace o verzi",
+"Signal quality too poor", "Kvalita signálu je velmi nízká",
+"Signal scale (240 or 100)", "Škála signálu (240 nebo 100)",
+"Site latitude", "Zeměpisná šířka umistění",
+"Site latitude.", "Zeměpisná šířka umistění.",
+"Site longitude", "Zeměpisná délka umístění",
+"Site longitude.", "Zeměpisná délka umístění.",
+"Size", "Velikost",
+"Skip TS packets (0-200)", "Přeskočit TS pakety (0-200)",
+"Skip commercials", "Přeskočit reklamy",
+"Skip initial bytes", "Přeskoč počáteční byty",
+"Skip initial scan", "Přeskoč počáteční vyhledávání",
+"Slave entry", "Závislá položka",
+"Slave entry.", "Závislá položka",
+"Slot state", "Stav slotu",
+"Soap", "Telenovely",
+"Soccer", "Fotbal",
+"Social", "Sociální",
+"Social advisory", "Sociální poradenství",
+"Sort index", "Index třídění",
+"Sort index.", "Index pro třídění.",
+"Source", "Zdroj",
+"Source deleted", "Zdroj smazán",
+"Source quality is bad", "Kvalita zdroje je špatná",
+"Source reconfigured", "Zdroj byl rekonfigurován",
+"Southern hemisphere (latitude direction)", "Jižní polokoule (směr zem. šířky)",
+"Southern hemisphere (latitude direction).", "Jižní polokoule (směr zem. šířky).",
+"Special events (Olympic Games, World Cup, etc.)", "Speciální události (Olympijské hry, Světový pohár, apod.)",
+"Specify User-Agent header for the http client", "Specifikuj hlavičku User-Agent pro http klienta",
+"Specify alternative htsp port", "Specifikuj alternativní htsp port",
+"Specify alternative http port", "Specifikuj alternativní http port",
+"Specify alternative http webroot", "Specifikuj alternativní http webroot",
+"Specify bind address", "Specifikuj IP adresu pro příjem",
+"Specify extra htsp port", "Specifikuj extra htsp port",
+"Spiritual sciences", "Spirituální vědy",
+"Sports", "Sporty",
+"Sports magazines", "Sportovní magazíny",
+"Standard", "Standardní",
+"Start", "Začátek",
+"Start after", "Začátek za",
+"Start before", "Začátek před",
+"Start time", "Začátek",
+"Status", "Stav",
+"Status period (ms)", "Perioda čtení statusu (ms)",
+"Stop", "Zastavit",
+"Stop time", "Konec",
+"Storage path", "Cesta k úložišti",
+"Storage space", "Místo na úložišti",
+"Stream ID", "Identifikace streamu",
+"Stream index", "Index streamu",
+"Stream profile", "Profil streamu",
+"Stream setup error", "Chyba v založení streamu",
+"Stream type", "Typ streamu",
+"Streaming", "Streamování",
+"Streaming priority", "Priorita streamu",
+"Streaming profiles", "Profily streamů",
+"Subdirectory options", "Volby podadresáře",
+"Subscribe to a service permanently", "Odebírej tuto službu permanentně",
+"Subscription does not exist", "Odběr neexistuje",
+"Subscription overridden", "Odběr přehlasován jiným požadavkem",
+"Subscription weight", "Váha odběru",
+"Substitute formatters", "Nahraď formátovací znaky",
+"Subtitle", "Podtitulek",
+"Subtitle codec", "Kodek podtitulků",
+"Subtitle stream filter", "Filtr streamu podtitilků",
+"Sun", "Ned",
+"Surround (2 front, rear mono)", "Surround (2 přední, zadní mono)",
+"Switch before rotor", "Přepínač pak rotor",
+"Switch type", "Typ přepínače",
+"Switch: %s", "Přepínač: %s",
+"Sync", "Synchronizovat",
+"Sync + Don't keep", "Synch. ₊ nezanechávej",
+"System", "Systém",
+"Tag files with metadata", "Vlož metadata do souborů",
+"Tags", "Štítky",
+"Team sports (excluding football)", "Týmové sporty (vyjma fotbalu)",
+"Technology", "Technologie",
+"Teletext stream filter", "Filtr streamu teletextu",
+"Tennis", "Tenis",
+"Testing", "Testování",
+"Testing options", "Testovací volby",
+"The CAM slot status.", "Stav CAM vstupu.",
+"The PIN to use.", "Použít toto PIN.",
+"The SAT>IP server's name.", "Název SAT>IP serveru.",
+"The name of the profile.", "Název profilu.",
+"The provider's name.", "Název poskytovatele.",
+"The recording/entry status.", "Stav záznamu/položky.",
+"The service's encryption status.", "Stav šifrování služby.",
+"The symbol rate.", "Přenosová rychlost.",
+"Theme", "Téma",
+"This tuner", "Tento tuner",
+"Thu", "Čtv",
+"Time", "Čas",
+"Time missed", "Čas byl zmeškán",
+"Time record caption", "Titulek pro automatický časový rekordér",
+"Time recording%s%s", "Časový rekordér%s%s",
+"Time update", "Aktualizace času",
+"Timeout (sec) (0=infinite)", "Časový limit (sek.) (0=bez limitu)",
+"Timeout (seconds)", "Časový limit (sekundy)",
+"Timer-based automatic recording.", "Automatický záznam na základě časovačů.",
+"Timout (secs)", "Časový limit (sek.)",
+"Title", "Název",
+"Title (regexp)", "Název (regexp)",
+"Title of the program.", "Název vysílání.",
+"Title of the recording.", "Název záznamu.",
+"Toggle details", "Přepnout detaily",
+"Tone burst", "Tone Burst",
+"Too many data errors", "Příliš mnoho chyb v datech",
+"Total number of services seen.", "Celkový počet viděných služeb.",
+"Total number of services.", "Celkový počet služeb.",
+"Tourism / Travel", "Turismus / Cestování",
+"Trace subsystems", "Subsystémy pro trasování",
+"Traditional arts", "Tradiční umění",
+"Traditional music", "Tradiční hudba",
+"Transcoding", "Transkódování",
+"Transmission mode", "Mód vysílání",
+"Transponder ID", "ID transpodéru",
+"Transport stream ID", "ID streamu transpondéru",
+"Tue", "Úte",
+"Tune before DiseqC", "Ladit před DiseqC",
+"Tuner bind IP address", "IP adresa pro komunikaci s tunerem",
+"Tuner configuration", "Konfigurace tuneru",
+"Tuner configuration.", "Konfigurace tuneru",
+"Tuning failed", "Ladění selhalo",
+"Turn off LNB when idle", "Vypni LNB při nečinnosti",
+"Tvheadend server name", "Jméno Tvheadend serveru",
+"Type", "Typ",
+"Type override", "Vynutit typ služby",
+"UDP RTP port number (2 ports)", "UDP RTP číslo portu (2 porty)",
+"URL of the M3U playlist.", "URL pro M3U playlist.",
+"URL with the SAT>IP server XML location", "URL s umístěním XML souboru na SAT>IP serveru",
+"Unable to get system UTC time", "Nemohu získat systémový UTC čas",
+"Unable to get system local time", "Nemohu získat systémový lokální čas",
+"Unable to get system time", "Nemohu získat systémový čas",
+"Unable to open file", "Nemohu otevřít soubor",
+"Unable to stat path", "Nemohu zjistit informace o cestě",
+"Uncommitted first", "Preferuj uncommited",
+"Unicable switch (universal LNB, experimental)", "Unicable přepínač (univerzální LNB, experimentální)",
+"Unicable type", "Typ unicable",
+"Unimportant", "Nedůležité",
+"Universal LNB only", "Pouze univerzální LNB",
+"Universally unique identifier. Read only.", "Univerzální unikátní identifikátor. Pouze pro čtení.",
+"Unknown", "Neznámé",
+"Unknown file", "Neznámý soubor",
+"Unknown reason (%i)", "Neznámá příčina (%i)",
+"Unlimited size", "Nelimitovaná velikost",
+"Unlimited time", "Nelimitovaná doba",
+"Unset (default)", "Nenastaveno (standardní)",
+"Update card (EMM)", "Aktualizovat kartu (EMM)",
+"Update channel icon", "Aktualizovat ikonu programu",
+"Update channel name", "Aktualizovat název programu",
+"Update channel number", "Aktualizovat číslo programu",
+"Update disabled", "Aktualizace zakázána",
+"Update time", "Aktualizovat čas",
+"Update tolerance (ms)", "Tolerance aktualizace (ms)",
+"Updated", "Aktualizováno",
+"Updates from one mux (EMM)", "Aktualizace pouze z jednoho muxu (EMM)",
+"Upon start, Tvheadend doesn't know the last rotor position. This value defines the initial rotor movement. TVHeadend waits the specified time when the first movement is requested.", "Při startu, Tvheadend nezná poslední pozici rotoru. Tato hodnota definuje počáteční pohyb rotoru. Tvheadend čeká specifikovanou dobu po požadavku na nastavení první pozice.",
+"Usage: %s [OPTIONS]\n", "Použití: %s [VOLBY]\n",
+"Use AC-3 detection on the mux.", "Použitá AC-3 detekce na tomto muxu.",
+"Use EPG running state", "Použít stav vysílání z EPG ",
+"Use HTTP digest authentication", "Použít 'HTTP digest' autorizaci",
+"Use WEBM format.", "Použij formát WEBM.",
+"Use Windows-compatible filenames", "Použij názvy souborů kompatibilní s Windows",
+"Use XSPF playlist instead of M3U", "Použít XSPF playlist místo M3U",
+"Use original", "Použít originál",
+"Use packet backlog", "Používat neúplné snímky",
+"Use service IDs as channel numbers", "ID služby jako čísla programů",
+"User access error", "Chyba přístupu uživatele",
+"User does not have access", "Uživatel nemá přístup",
+"User does not have access to channel", "Uživatel nemá přístup k programu",
+"User icon", "Uživatelská ikona",
+"User interface level", "Úroveň uživatelského rozhraní",
+"User interface quick tips", "Rychlé tipy v uživatelském rozhraní",
+"User language", "Jazyk uživatele",
+"User limit reached", "Dosažen limit uživatele",
+"User login", "Uživatelské jméno",
+"User request", "Požadavek od uživatele",
+"Username", "Uživatelské jméno",
+"Variety show", "Varietní show",
+"Verify the SSL certificate.", "Ověřit SSL certifikát.",
+"Video bitrate (kb/s) (0=auto)", "Šířka pásma pro video (kb/s) (0=Auto)",
+"Video codec", "Video kodek",
+"Video codec preset", "Nastavení pro video kodek",
+"Video codec preset to use for transcoding.", "Nastavení pro video kodek použité pro transkódování.",
+"Video recorder", "Video rekordér",
+"Video stream filter", "Filtr video streamu",
+"View all DVR entries", "Zobrazit všechny digitální nahrávky",
+"Visually impaired commentary/audio description", "Komentář pro zrakově postižené",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV profil H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV profil H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV profil VP8/Vorbis/WEBM",
+"Waiting for EPG running flag", "Čekám na stav vysílání z EPG",
+"Waiting for program start", "Čekám na start programu",
+"Waiting for stream", "Čekám na stream",
+"War", "Válka",
+"Water sport", "Vodní sporty",
+"Weak stream", "Slabý proud dat",
+"Weather report", "Zprávy o počasí",
+"Web interface", "Webové rozhraní",
+"Web interface language", "Jazyk pro webové rozhraní",
+"Web theme", "Webové téma",
+"Web user interface", "Uživatelské webové rozhraní",
+"Wed", "Stř",
+"Welcome - Tvheadend - your TV streaming server and video recorder", "Vítejte - Tvheadend - Váš TV server pro streamování a video rekordér",
+"Western hemisphere (latitude direction)", "Západní polokoule (směr zem. délky)",
+"Western hemisphere (latitude direction).", "Západní polokoule (směr zem. délky).",
+"When the service was first identified and recorded.", "Čas, kdy byla služba poprvé nalezena a uložena.",
+"When the service was last seen during a mux scan.", "Čas, kdy byla služba naposledy viděna při skenu muxu.",
+"Wizard", "Pomocník",
+"Yes", "Ano",
+"addpids/delpids supported", "podpora addpids/delpids",
+"hrs", "hod",
+"invalid option specified [%s]", "specifikována chybná volba [%s]",
+"mins", "min",
+"option %s requires a value", "volba %s vyžaduje argument",
+"tsfile input (mux file)", "tsfile vstup (mux soubor)",
+"tvhdhomerun client", "Klient tvhdhomerun",
+NULL, NULL
+};
+
+static const char *tvh_locale_3[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nFor mere information besøg Tvheadend web-siden:\nhttps://tvheadend.org\n",
+"# Channels", "# Kanaler",
+"# Mapped channels", "Kortlagte Kanaler",
+"# Muxes", "# Mux'er",
+"# Services", "# Tjenester",
+"# Services seen", "# Synlige tjenester",
+"# tune repeats", "# indstilling, gentagelse",
+"(Default profile)", "(Standard-profil)",
+"1 day", "1 dag",
+"1 month", "1 måned",
+"1 week", "1 uge",
+"1 year", "1 år",
+"2 months", "2 måneder",
+"2 weeks", "2 uger",
+"2 years", "2 år",
+"3 days", "3 dage",
+"3 months", "3 måneder",
+"3 weeks", "3 uger",
+"3 years", "3 år",
+"5 days", "5 dage",
+"6 months", "6 måneder",
+"AC-3 detection", "AC-3 Registrering",
+"ACTIVE", "AKTIV",
+"AES constant code word client", "AES-konstant, Kodeordsklient",
+"ANY", "ENHVER",
+"ATSC source ID", "ATSC kilde ID",
+"ATSC-C network", "ATSC-C Netværk",
+"ATSC-T network", "ATSC-T netværk",
+"Aborted by user", "Afbrudt af bruger",
+"Accept remote subscription weight", "tillad fjern-abonnementens prioritet ",
+"Accept the remote subscription weight (from the SAT>IP client).", "Tillad fjern-abonnementens prioritet (fra SAT>IP klient)",
+"Access", "Adgang",
+"Action", "Aktion",
+"Adapter in use by another subscription", "Adapter i brug af anden abonnement",
+"Add file and line numbers to debug", "Tilføj fil og linje numer til fejlsøgning",
+"Add the thread ID to debug", "Tilføj tråd-ID til fejlsøgning",
+"Additional arguments to pass to the grabber.", "Yderligere kommandoer, der sendes videre til grabber.",
+"Additional service names found in EPG data.", "Yderligere tjeneste navne fundet i EPG data.",
+"Additional time (in seconds) in which to get the tuner ready for recording. This is useful for those with tuners that take some time to tune and/or send garbage data at the beginning. ", "Yderligere tid (i sekunder) tuner skal bruge for at være klar til at optage. Dette bruges hvis din tuner tager længere tid end normalt.",
+"Admin password", "Admin kodeord",
+"Admin username", "Admin brugernavn",
+"Adult movie", "Voksen film",
+"Advanced", "Avanceret",
+"Advanced (non-universal LNBs, rotors, etc.)", "Avanceret (ikke-universelle LNB'ere, rotorer, mm.)",
+"Advanced streaming", "Avanceret Streaming",
+"Adventure", "Eventyr",
+"Advertisement / Shopping", "Reklame / Indkøb",
+"All (Streaming plus DVR)", "Alt (Streaming + DVR)",
+"All DVR (rw)", "Alle DVR (læs,skriv)",
+"All characters that could possibly cause problems for filenaming will be replaced with an underscore. See Help for details.", "Alle karakterer som kunne give problemer ved navngivning af filen, vil blive erstattet af en _. Se hjælp for detaljer",
+"All lower-case", "Kun små bogstaver",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Alle tilskud anvendes til at forbedre server infrastruktur og købe testudstyr.",
+"Allow to show the quick tips for the form fields.", "Tillad visning af hurtig tips i form felter",
+"Allow/disallow HTTP streaming.", "Tillad/forbyd HTTP visning.",
+"Allow/disallow access to DVR via the HTSP protocol.", "Tillad/forbyd adgang til DVR via HTSP protokol.",
+"Allow/disallow access to all failed DVR entries.", "Tillad/forbyd adgang til all fejlede DVR optagelser.",
+"Allow/disallow access to other users DVR entries (read only).", "Tillad/forbyd adgang til andre brugeres DVR optagelser (kun se)",
+"Allow/disallow access to the 'Configuration' tab.", "Tillad/forbyd adgang til 'Konfigurations fanen'.",
+"Allow/disallow access to video recorder functionality (including Autorecs).", "Tillad/forbyd adgang til 'video optage funktionen' (inkl. Auto optagelser).",
+"Allow/disallow advanced http streaming, e.g, direct service or mux links.", "Tillad/forbyd advanceret http visning, fx. direkte tjenester eller mux link.",
+"Allow/disallow read/write access to other users' DVR entries.", "Tillad/forbyd læse/skrive rettigheder til andre brugeres DVR optagelser.",
+"Allow/disallow web interface access (this  includes access to the EPG).", "Tillad/forbyd GUI adgang (dette gælder også adgang til EPG).",
+"Allowed DVR profiles. This limits the profiles the user has access to.", "Tillad DVR profiler. Dette begrænser de profiler brugeren har adgang til.",
+"Allowed network", "Tilladte netværk",
+"Allowed networks", "Tilladte netværk",
+"Alternate PID path", "Alternativ PID sti",
+"Alternate configuration path", "Alternativ konfigurationssti",
+"Altitude (in meters).", "Højde (i meter).",
+"Altitude (meters)", "Højde (Meter)",
+"Animals", "Dyr",
+"Anonymize HTSP access", "Anonymiser HTSP adgang",
+"Any", "Enhver",
+"Arts", "Kunst",
+"Assign predefined muxes to networks", "Tilføj forudindtastede mux til netværk",
+"Associate this device with one or more networks.", "Forbind denne enhed med mere et eller flere netværk.",
+"Athletics", "Atletik",
+"Audio birate to use for transcoding.", "Lyd bitrate, der bruges til transcoding.",
+"Audio bitrate (kb/s) (0=auto)", "Lyd bitrate (kb/s) (0=auto)",
+"Audio channel layout.", "Lyd kanal layout.",
+"Audio codec", "Lyd codec",
+"Audio codec to use for the transcode. \"Do not use\" will disable audio output.", "Lyd codec der bruges til transcoding. \"Brug ikke\" vil slå lyden fra.",
+"Audio language (Not currently used).", "Lyd sprog (Bruges ikke lige nu).",
+"Audio stream filter", "Lyd stream filter",
+"Auto check disabled", "Autocheck Deaktiveret",
+"Auto check enabled", "Autocheck Aktiveret",
+"Auto record", "Auto-optagelse",
+"Auto record caption", "Auto-optag undertekster",
+"Auto recording%s%s", "Auto-optagelse%s%s",
+"Auto time record", "Automatisk tidsoptagelse",
+"Auto-Map to channels", "Kortlæg Kanaler Automatisk ",
+"Automatic checking", "Automatisk kontrol",
+"Automatic recording caption.", "Automatisk optage navngiving.",
+"Automatic schedule entry not found", "Automatisk tidsplan for denne post blev ikke fundet",
+"Automatically map EPG source", "Kortlæg EPG-kilde Automatisk ",
+"Automatically map all available services to channels.", "Automatisk tilføj alle tilgængelige tjenester til kanaler.",
+"Automatically name from network", "Navngiv automatisk fra netværk",
+"Automatically record.", "Automatisk optagelse.",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Opdatere automatisk kanalikoner ved hjælp af oplysninger fra de aktiverede EPG udbydere. Bemærk : dette kan medføre uønskede ændringer i allerede definerede kanalikoner.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Opdatere automatisk kanal navne ved hjælp af oplysninger fra de aktiverede EPG udbydere. Bemærk : dette kan medføre uønskede ændringer i allerede definerede kanal navne.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Opdatere automatisk kanalnumre ved hjælp fra oplysninger i de aktiverede EPG udbydere. Bemærk : dette kan medføre uønskede ændringer i allerede definerede kanalnumre.",
+"Autorec maximum count (0=unlimited)", "Antal automatiske optagelser (0=ubegrænset)",
+"Autorec maximum schedules limit (0=unlimited)", "Maximum antal planlagte automatiske optagelser (0=ubegrænset)",
+"Bad", "Dårlig",
+"Bad request", "Dårlig anmodning.",
+"Bandwidth", "Båndbredde",
+"Based on software from", "Baseret på software fra",
+"Basic", "Grundlæggende",
+"Bind to specific local IP address.", "Bind til specifik lokal IP-adresse.",
+"Brand", "Mærke",
+"Broadcast", "Udsende",
+"Broadcasting", "Udsendelse",
+"Build", "Version",
+"CA client %i", "CA klient %i",
+"CA identification", "CA-identifikation",
+"CA provider", "CA-udbyder",
+"CA stream filter", "CA-stream filter",
+"CAPMT interval (ms)", "CAPMT-interval (ms)",
+"CAPMT query interval (ms)", "CAPMT Forespørgselsinterval (ms)",
+"CRID authority", "CRID-autoritet",
+"Cache scheme", "Cache skema",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket filnavn / IP Addresse (TCP mode)",
+"Cartoons", "Tegnefilm",
+"Channel", "Kanal",
+"Channel icon", "Kanal-ikon",
+"Channel icon path (see Help)", "Kanal-ikonsti (Se hjælp)",
+"Channel name", "Kanalnavn",
+"Channel not found", "Kanal ikke fundet",
+"Channel number", "Kanalnummer",
+"Channel number offset", "Kanalnummer-forskydning",
+"Channel numbers from", "Kanalnumre fra",
+"Channel tag", "Kanal gruppe",
+"Channel tag does not exist", "Kanal gruppen findes ikke",
+"Channel tag reference", "Kanal gruppe reference",
+"Channel tags", "Kanal gruppe",
+"Channel tags the user is allowed access to/excluded from.", "Kanal grupper, som brugeren har/ikke har adgang til.",
+"Channels", "Kanaler",
+"Character set", "Karaktersæt",
+"Check availability", "Kontroller tilgængelighed",
+"Children's / Youth programs", "Børn og Unge-programmer",
+"Cinema", "Biograf",
+"Class", "Klasse",
+"Classical", "Klassisk",
+"Classical music", "Klassisk musik",
+"Clean effects", "Ryd effekter",
+"Client name", "Klient navn",
+"Clone scheduled entry on error", "Kopiér Planlagt Post ved Fejl",
+"Code word client (newcamd)", "Kodeords-klient (newcamd)",
+"Comedy", "Komedie",
+"Command delay time (ms) (10-200)", "Kommando forsinkelsestid (ms) (10-200)",
+"Command time (ms) (10-100)", "Kommandotid (ms) (10-100)",
+"Comment", "Kommentar",
+"Commercial break", "Reklamepause",
+"Committed", "Tilføjet",
+"Completed OK", "Færdiggjort OK",
+"Compress EPG database", "Komprimer EPG database",
+"Conditional access client", "Klientens adgangs betingelser",
+"Configuration", "Konfiguration",
+"Configuration ID", "Konfigurations-ID",
+"Configuration name", "Konfigurations navn",
+"Configuration version", "Konfigurations-version",
+"Connection limit type", "Forbindelses begrænsnings type",
+"Constellation", "Opstilling",
+"Container", "Beholder",
+"Content character set", "Indhold, karaktersæt",
+"Content reference identifier authority.", "Indholds reference identifikations autoritet",
+"Content type", "Indholdstype",
+"Content type.", "Indholdstype.",
+"Contest", "Konkurrence",
+"Continue even if descrambling fails", "Fortsæt selv hvis descrambling fejler",
+"Cookie expiration (days)", "Cookie udløbstid (dage)",
+"Cooking", "Madlavning",
+"Copy codec type", "kopi-codec-type",
+"Copy layout", "Kopiér Layout",
+"Create SDTV/HDTV/Radio tags.", "Opret SDTV/HDTV/Radio grupper.",
+"Create a provider name tag.", "Opret en gruppe for udbydere",
+"Create and associate a network tag to created channels.", "Opret og knyt et netværk til gruppen.",
+"Create and associate a provider tag to created channels.", "Opret og knyt en udbyder til de oprettede kanaler.",
+"Create bouquet", "Opret Buket",
+"Create network name tags", "Lav en gruppe til netværk",
+"Create network name tags (set by provider).", "Opret grupper til netværk (bestemt af udbyder).",
+"Create network tags", "Opret netværks gruppe",
+"Create provider name tags", "Lav en gruppe til udbydere",
+"Create provider tags", "Opret udbyder grupper",
+"Create tags", "Opret grupper",
+"Create type based tags", "Lav type baseret gruppe",
+"Created", "Oprettet",
+"Creator", "Opretter",
+"Cron multi-line", "Cron, flerliniet",
+"Culture (without music)", "Kultur (eksl. Musik)",
+"Current RTSP port.", "Aktuelle RTSP port.",
+"Current affairs", "Aktuelt",
+"Current tuner configuration.", "Aktuelle tuner konfiguration",
+"Custom HTTP headers", "Brugerdefinerede HTTP headere",
+"DAB multiplex", "DAB Multiplex",
+"DAB network", "DAB netværk",
+"DBus - use the session message bus instead of the system one", "DBus - brug 'session message bus' istedet for systemets",
+"DES constant code word client", "DES-konstant kodeordsklient",
+"DES key", "DES nøgle",
+"DSCP/TOS for streaming", "DSCP/TOS til streaming",
+"DVB scan files", "DVB Skan Filer",
+"DVB scan files path", "DVB Skan fil-stier",
+"DVB-C network", "DVB-C Netværk",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, experimentalt)",
+"DVB-S advanced", "DVB-S Avanceret",
+"DVB-S network", "DVB-S Netværk",
+"DVB-S satellite configuration", "DVB-S Satelitkonfiguration",
+"DVB-S simple", "DVB-S, Simpel",
+"DVB-S tone burst", "DBS-S, Tone Burst",
+"DVB-T network", "DVB-T Netværk",
+"DVR Auto-record entry", "DVR Auto-optag Post",
+"DVR behavior", "DVR-politik",
+"DVR configuration", "DVR Konfiguration",
+"DVR configuration profile", "DVR Konfigurationspolitik",
+"DVR configuration profiles", "DVR Konfigurationsprofil",
+"DVR entry not found", "DVR optagelse ikke fundet",
+"DVR file retention period", "DVR filens levetids periode",
+"DVR log retention", "DVR loggens levetid",
+"DVR log retention period", "DVR loggens levetids periode",
+"DVR override: high", "DVR override: høj",
+"DVR override: important", "DVR override: vigtig",
+"DVR override: low", "DVR override: lav",
+"DVR override: unimportant", "DVR override: ligegyldig",
+"DVR profile to use/used for the recording.", "DVR profil der skal bruges til denne optagelse.",
+"DVR schedule does not exist", "DVR plan findes ikke.",
+"DVR schedule not found", "DVR plan ikke fundet",
+"DVR time record entry", "DVR tidspost",
+"Dance", "Dans",
+"Data errors", "Datafejl",
+"Data path (if applicable).", "Data sti (hvis relevant).",
+"Days of Week", "Ugedage",
+"Days of week", "Ugedage",
+"Debate", "Debat",
+"Debug libav log", "Fejlfind libav log",
+"Debug log path", "Fejlfind log-sti",
+"Debug options", "Fejlfindings-indstillinger",
+"Debug subsystems", "Fejlfind undersystemer",
+"Debug to syslog", "Fejlfind til syslog",
+"Debug trace (low-level)", "Fejlfind, trace (low-level)",
+"Debugging", "Debugge",
+"Default", "Standard",
+"Default language(s)", "Standardsprog",
+"Default language.", "Standard sprog.",
+"Default priority", "standards-prioritering",
+"Default user interface level.", "Standard brugergrænseflade niveau.",
+"Delivery system", "Leveringssytem",
+"Demux path", "Demux-sti",
+"Descramble services (limit per mux)", "Afkodnings tjeneste (begræns per mux)",
+"Descrambler buffer (TS packets)", "Descramble-buffer (TS-pakker)",
+"Description", "Beskrivelse",
+"Detective", "Detektiv",
+"Device ID", "Enheds-ID",
+"Device model", "Enheds-model",
+"Device path", "Enheds-sti",
+"Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected this tells your router the prority in which to give packets sent from Tvheadend, this option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ", "Differentiated Services Code Point / Type of Service : Indstil tjenesten klassen Tvheadend sender med hver pakke . Afhængigt af den valgte indstilling, fortæller dette din router den PRIORITERET som den skal give pakker, der sendes fra Tvheadend, denne indstilling behøver man normalt ikke at ændre. Se https://en.wikipedia.org/wiki/Differentiated_services for yderligere information.",
+"Directory", "Mappe",
+"Directory permissions (octal, e.g. 0775)", "Mappe-tilladelser (octal, f.eks. 0775)",
+"Disable", "Deaktiver",
+"Disable DVB bouquets", "Deaktiver DVB bouquets",
+"Disable SAT>IP client", "Deaktiver SAT>IP-klient",
+"Disable all access control checks", "Deaktiver alt adganskontrol",
+"Disable debug on stderr", "Deaktiver fejlsøgning på stderr",
+"Disable device/firmware-specific workarounds", "Deaktiver enheds/firmware-specifikke løsninger",
+"Disable syslog (all messages)", "Deaktiver syslog (alle meddelelser)",
+"Disabled", "Deaktiveret",
+"Discussion", "Diskussion",
+"DiseqC repeats", "DiseqC gentagelser",
+"DiseqC switch", "DiseqC kontakt",
+"Do not use", "Brug ikke",
+"Documentary", "Dokumentar",
+"Don't backup configuration tree at upgrade", "Lav ikke backup af configurations-træet ved opgradering",
+"Don't include title in filename", "Inkludér ikke titel i filnavn",
+"Don't keep", "Behold ikke",
+"Don't re-record", "Genoptag ikke",
+"Don't re-schedule if recording fails.", "Planlæg ikke optagelsen igen, hvis den fejler.",
+"Don't reschedule", "planlæg ikke igen",
+"Duplicate handling", "Duplikér handling",
+"EIT - skip TSID check", "EIT - skip TSID-check",
+"EPG grabber", "EPG-grabber",
+"EPG grabber channel", "EPG-grabberkanal",
+"EPG grabber configuration", "EPG-grabber konfiguration",
+"EPG name", "EPG-navn",
+"EPG scan", "EPG-scan",
+"EPG scan timeout in seconds (30-7200)", "EPG-skan timeout i sekunder (30-7200)",
+"EPG source", "EPG-kilde",
+"EPG update window", "EPG-opdateringsvindue",
+"Economics", "Økonomi",
+"Education", "Uddannelse",
+"Educational", "Uddannelses",
+"Elementary stream filter", "Elementær streamfilter",
+"Enable (auto)", "Slå til (auto)",
+"Enable DBus", "Slå DBus til",
+"Enable NTP driver", "Slå NTP driver til",
+"Enable coredumps for daemon", "Slå coredumps for daemon til",
+"Enable debug on stderr", "Slå debug ved stderr til",
+"Enable debug subsystems", "Slå debug af undersystemer til",
+"Enable debug to file", "Slå debug til fil til",
+"Enable debug to syslog", "Slå debug til syslog til",
+"Enable if the SAT>IP box requests plts=on parameter in the SETUP RTSP command for DVB-S2 muxes.", "Aktiver hvis SAT>IP boksen efterspørger plts=on parameteren i SETUP RTSP kommandoen til DVB-S2 mux'er.",
+"Enable if the SAT>IP box requires pids=0 parameter in the SETUP RTSP command.", "Aktiver hvis SAT>IP boksen efterspørger pids=0 parameteren i SETUP RTSP kommandoen.",
+"Enable if the SAT>IP box requires pids=21 parameter in the SETUP RTSP command", "Aktiver hvis SAT>IP boksen efterspørger pids=21 parameteren i SETUP RTSP kommandoen.",
+"Enable if the SAT>IP box supports the addpids/delpids commands.", "Aktiver hvis SAT>IP boksen understøtter addpids/delpids kommandoer.",
+"Enable or disable RTSP/TCP (embedded data) support.", "Aktiver eller deaktiver RTSP/TCP (indlejrede data) understøttelse.",
+"Enable or disable fast input switching.", "Aktiver eller deaktiver hurtig skift af indgang.",
+"Enable or disable full mux mode.", "Aktiver eller deaktiver full mux tilstand.",
+"Enable or disable ignoring of Event Information Table (EIT) data on this mux.", "Aktiver eller deaktiver ignorere \"Event Information Tabel\" (EIT) data på denne mux.",
+"Enable or disable the mux.", "Aktiver eller deaktiver denne mux.",
+"Enable or disable this configuration.", "Aktiver eller deaktiver denne konfiguration.",
+"Enable syslog", "Aktiver syslog",
+"Enable system time updates. This will only work if the user running Tvheadend has rights to update the system clock (normally only root).", "Aktiver system tids opdateringer. Dette vil kun virke hvis brugeren, som kører Tvheadend har rettighederne til at opdatere systemets tid (normalt kun \"root\").",
+"Enable this filter.", "Aktiver dette filter.",
+"Enable trace subsystems", "Slå trace undersystemer til",
+"Enable web UI debug (non-minified JS)", "Slå web UI debug (non-minified JS) til",
+"Enable/disable LNA.", "Aktiver/deaktiver LNA.",
+"Enable/disable auto-rec rule.", "Aktiver/deaktiver auto-optagelses reglen.",
+"Enable/disable logging to syslog.", "Aktiver/deaktiver logning til syslog.",
+"Enable/disable profile.", "Aktiver/deaktiver profilen.",
+"Enable/disable the channel.", "Aktiver/deaktiver kanalen.",
+"Enable/disable the device.", "Aktiver/deaktiver enheden.",
+"Enable/disable the profile.", "Aktiver/deaktiver profilen.",
+"Enable/disable the tag.", "Aktiver/deaktiver gruppen.",
+"Enable/disable timeshift.", "Aktiver/deaktiver tidsforskydning.",
+"Enable/disable tuner/adapter.", "Aktiver/deaktiver tuner/adapter.",
+"Enabled", "Slået til",
+"Encrypted", "Krypteret",
+"Encrypted service", "Krypteret tjeneste",
+"Enter external IP if behind Network address translation (NAT).", "Indtast ekstern IP, hvis du er bag en NAT IP",
+"Entertainment programs for 10 to 16", "Underholdningsprogram (10 - 16)",
+"Entertainment programs for 6 to 14", "Underholdningsprogram (6 - 14)",
+"Environment", "Miljø",
+"Environment (pipe)", "Miljø (pipe)",
+"Error code", "Fejlkode",
+"Errors", "Fejl",
+"Even key", "Lige nøgle",
+"Every day", "Hver dag",
+"Exclude channel tags", "Udeluk Kanal grupper",
+"Expeditions", "Ekspeditioner",
+"Experimental film", "Eksperimental-film",
+"Expert", "Ekspert",
+"Exported tuners", "Eksporterede tunere",
+"External", "Ekstern",
+"External EPG grabber", "Ekstern EPG-grabber",
+"External IP (NAT)", "Ekstern IP (NAT)",
+"External URL", "Ekstern URL",
+"Extra arguments", "Ekstra agumenter",
+"Extra start time", "Ekstra starttid",
+"Extra stop time", "Ekstra stoptid",
+"Extra warming up time (seconds)", "Extra opvarmnings tid (sekunder)",
+"FEC high", "FEC høj",
+"FEC low", "FEC lav",
+"Factual topics", "Faktulle emner",
+"Failed", "Fejlede",
+"Failed DVR", "Fejlede DVR",
+"Fast input switch", "Hurtig-indgangsskift",
+"File missing", "Manglende fejl",
+"File not created", "Fil ikke oprettet",
+"File permissions (octal, e.g. 0664)", "Filtilladelser (octal, f.eks. 0664)",
+"File size", "Fil størrelse",
+"Filename", "Filnavn",
+"Filename character set", "Filnavn karaktersæt",
+"Filename options", "Filnavns muligheder",
+"Fine arts", " Æstetik",
+"Finished", "Slut",
+"Fitness and health", "Fitness og sundhed",
+"Folkloric", "Folklore",
+"Football", "Fodbold",
+"Force (auto)", "Tving (auto)",
+"Force CA ID (e.g. 0x2600)", "Tving CA ID (f.eks. 0x2600)",
+"Force old status", "Fremtving gammel status",
+"Force pilot for DVB-S2", "Fremtving pilot for DVB-S2",
+"Force priority", "Fremtving prioritet",
+"Force service type to 1", "Tving tjeneste type til 1",
+"Force teardown delay", "Fremtving teardown-forsinkelse",
+"Force usage of entered CA ID on this service.", "Tving CA ID til at bruges den indtastede værdi, for denne tjeneste.",
+"Foreign countries", "Andre lande",
+"Forever", "For altid",
+"Fork and run as daemon", "Opsplit og kør som daemon",
+"Format string", "Formaterings streng",
+"Found muxes", "Fundet mux'ere",
+"Found services", "Fundet tjenester",
+"Free subscription weight", "Ledig abonnements prioritet",
+"Free-format text field. Enter whatever you like here.", "Frit formaterings tekst felt. Indtast lige hvad du har lyst til",
+"Frequency", "Frekvens",
+"Frequency (Hz)", "Frekvens (Hz)",
+"Frequency (MHz)", "Frekvens (MHz)",
+"Frequency (kHz)", "Frekvens (kHz)",
+"Fri", "Fre",
+"Friendly name", "Nemt navn",
+"Frontend number", "Frontend nummer",
+"Frontend path", "Frontend sti",
+"Full mux RX mode supported", "Fuld mux RX mode understøttet",
+"Full pathname specification", "Fuld stinavns-specifikation",
+"Full-text", "Fuldtekst",
+"Further education", "Videre uddannelse",
+"Game show", "Gameshow",
+"Gardening", "Havebrug",
+"General", "Generelt",
+"General configuration", "Generel konfiguration",
+"Generic", "Generisk",
+"Generic options", "Generisk valg",
+"Guard interval", "Vagtinterval",
+"HTSP Default Stream Settings", "HTSP Standardindstillinger",
+"HTSP stream profile", "HTSP stream-profil",
+"HTTP CORS origin", "HTTP CORS oprindelse",
+"Handicraft", "Håndværk",
+"Hearing impaired", "Hørehæmmede",
+"Hierarchy", "Hierarki",
+"High", "Høj",
+"High bitrate mode (CI+ CAMs only)", "Høj bitrate mode (kun CI+ CAM)",
+"Historical movie", "Historisk Film",
+"Horror", "Horro",
+"Hostname/IP", "Hostnavn/IP",
+"IP address", "IP-adresse",
+"IP blocking", "IP-blokering",
+"IPTV automatic network", "IPTV automatisk netværk",
+"IPTV input", "IPTV indgang",
+"IPTV network", "IPTV netværk",
+"Icon", "Ikon",
+"Icon (full URL)", "Ikon (fuld URL)",
+"Icon URL", "Ikon URL",
+"Icon base URL", "Ikon Basis-URL",
+"Icon has title", "Ikon har Titel",
+"Icons from", "Ikoner fra ",
+"Idle scan", "Idle-skan",
+"Idle scan muxes", "Idle skan muxes",
+"If both a picon and a channel-specific (e.g. channelname.jpg) icon are defined, use the picon.", "Hvis både en picon og et kanal-specifik (f.eks channelname.jpg) ikon er defineret, så brug picon.",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Hvis ingen brugerkonto eksisterer, opret een uden\nbrugernavn og password. Brug med omtanke, idet\nden vil tillade fulde brugerrettigheder til din \nTvheadend-installation indtil du opretter eller retter\nadgangskontrollen fra Tvheadend webinterfacet.",
+"If you'd like to support the project, please consider a donation.", "Hvis du gerne vil støtte projektet, så overvej venligst en donation",
+"Ignore EPG (EIT)", "Ignorer EPG (EIT)",
+"Ignore descriptor 5", "Ignorér descriptor 5",
+"Ignore encryption flag, include encrypted services anyway.", "Ignorere krypterede flag, inkl. krypterede tjeneste alligevel.",
+"Ignore invalid SSL certificate", "Ignorér ugyldigt SSL-certifikat",
+"Ignore provider's channel numbers", "Ignorér udbyders kanalnumre",
+"Image cache", "billedcache",
+"Immediately abort", "Stop øjeblikkeligt",
+"Important", "Vigtigt",
+"Include channel name in filename", "Inkudér kanalnavn i filnavn",
+"Include date in filename", "Medtag dato i filnavn  ",
+"Include episode in filename", "Inkludér episode i filnavn",
+"Include subtitle in filename", "Inkludér undertekster i filnavn",
+"Include time in filename", "Medtag klokkeslæt i filnavn",
+"Index", "Indeks",
+"Information area", "Informationsområde",
+"Informational", "Informerende",
+"Initial scan", "Først skanning",
+"Input base", "Indgangs bund",
+"Input buffer (bytes)", "Indgangs buffer (bytes)",
+"Input instance", "Indgangs instans",
+"Input path", "Indgangs sti",
+"Internal", "Internt",
+"Internal EPG grabber", "intern EPG-grabber",
+"Internal grabber", "Intern grabber",
+"Invalid", "Ugyldig",
+"Invalid adapter number '%s'\n", "Ugyldig adapternummer '%s'\n",
+"Invalid target", "Ugyldigt mål",
+"Keep", "Behold",
+"Kill signal (pipe)", "Dræb signal (pipe)",
+"Kill timeout (pipe/secs)", "Dræb timeout (pipe/sek)",
+"LNA (low noise amplifier)", "LNA (støjsvag forstærker)",
+"Language", "Sprog",
+"Language settings", "Sprogindstillinger",
+"Languages", "Sprog",
+"Last seen", "Sidst set",
+"Last updated from", "Sidst opdateret fra",
+"Leisure hobbies", "Hobbyer",
+"Limit connections", "Begræns forbindelser",
+"Linked input", "Forbundet Indgang",
+"LinuxDVB adapter", "Linux DVB-adapter",
+"LinuxDVB network", "Linux DVB-netværk",
+"Listen / Connect port", "Listen / Connect-port",
+"Listen on IPv6", "Lyt på IPv6",
+"Literature", "Literatur",
+"Local bind IP address", "Local bind IP-adresse",
+"Local channel minor", "Lokal mindre kanal",
+"Local channel number", "Lokalt kanalnummer",
+"Local discovery IP address", "Lokal discovery IP-adresse",
+"Location", "Lokation",
+"Location details of the SAT>IP Server.", "Placerings detaljer fra SAT>IP serveren.",
+"Lock preferred CA PID", "Lås foretrukket CA PID",
+"Login/Logout", "Login/logout",
+"Low", "Lav",
+"MPEG-TS Pass-thru/built-in", "MPEG-TS Pass-thru/indbygget",
+"MPEG-TS input", "MPEG-TS indgang",
+"MPEG-TS network", "MPEG-TS netværk",
+"MPEG-TS raw service", "MPEG-TS rå tjeneste",
+"MPEG-TS service", "MPEG-TS tjeneste",
+"Magazines", "Magasiner",
+"Maintain free storage space in MiB", "Vedligehold ledig diskplads i MiB",
+"Maintain used storage space in MiB (0=disabled)", "Vedligehold brugt diskplads i MiB (0=deaktiveret)",
+"Maintained space", "Vedligeholdt plads",
+"Make subdirectories per channel", "Opret underfoldere per kanal",
+"Make subdirectories per day", "Opret underfoldere per dag",
+"Make subdirectories per title", "Opret underfoldere per titel",
+"Manufacturer", "Producent",
+"Manufacturer URL", "Producent-URL",
+"Manufacturer's model number.", "Fabrikantens modelnummer.",
+"Manufacturer's product description.", "Fabrikantens produkt beskrivelse.",
+"Manufacturer's product information page for the device.", "Fabrikantens produktinformations side for denne enhed.",
+"Manufacturer's product name.", "Fabrikantens produkt navn.",
+"Map all services", "Tilføj alle tjenester",
+"Map encrypted services", "Tilføj krypterede tjenester",
+"Map radio channels", "Kortlæg radiokanaler",
+"Map unnamed channels", "Kortlæg unavngivne kanaler",
+"Map zero-numbered channels", "Kortlæg nul-numererede kanaler",
+"Master tuner", "Hovedindstiller",
+"Matroska (mkv)/built-in", "Matroska (mkv)/indbygget",
+"Matroska specific", "Matroska specifik",
+"Maximal channel number", "Maksimalt kanalnummer",
+"Maximum # input streams", "Maksimalt # indgangsstreams",
+"Maximum PIDs", "Maximal PIDs",
+"Maximum RAM size (MB)", "Maximal RAM-størrelse (MB)",
+"Maximum bandwidth (Kbps)", "Maximal båndbrede (Kbps)",
+"Maximum count (0=default)", "Maximum nummer (0=ubegrænset)",
+"Maximum duration", "Maximal varighed",
+"Maximum length of PIDs", "Maximal længde af PID'er",
+"Maximum period (mins)", "Maximal periode (min)",
+"Maximum schedules limit (0=default)", "Maximal planlægning begrænsning (0=standard)",
+"Maximum size (MB)", "Maksimal størrelse (MB)",
+"Maximum timeout (seconds)", "Maksimal timeout (sekunder)",
+"Medicine", "Medicin",
+"Merge same name", "Flet ved samme navn",
+"Merge services with the same name to one channel.", "Flet tjenester med det samme navn til en kanal.",
+"Minimal channel number", "Minimal kanalnummer",
+"Minimum duration", "Minimal varighed",
+"Minimum rotor time (seconds)", "Minimal rotortid (sekunder)",
+"Missing In PAT/SDT", "Mangler i PAT/SDT",
+"Model description", "Modelbeskrivelse",
+"Model name", "Modelnavn",
+"Model number", "Modelnummer",
+"Module", "Modul",
+"Module ID", "Modul-ID",
+"Mon", "Man",
+"More verbose libav log", "Mere dybdegående libav-log",
+"Motor rate (milliseconds/deg)", "Motorrate (millisekunder/grader)",
+"Motoring", "Motorstyring",
+"Movie", "Film",
+"Music", "Musik",
+"Mux handling", "Mux-styring",
+"Mux name", "MUX-navn",
+"Mux not enabled", "Mux slået fra",
+"Mux schedule entry", "Mux planlægningspost",
+"NONE", "INGEN",
+"Name", "Navn",
+"Name of the tag.", "Navn på gruppen.",
+"Names", "Navne",
+"Natural sciences", "Naturvidenskab",
+"Nature", "Natur",
+"Network", "Netværk",
+"Network A", "Netværk A",
+"Network B", "Netværk B",
+"Network ID (limit scanning)", "Netværks-ID (Begrænset Skanning)",
+"Network UUID", "Netværks-UUID",
+"Network access", "Netværks adgang",
+"Network discovery", "Netværks-søgning",
+"Network name", "Netværks-navn",
+"Network prefix", "Netværks-prefix",
+"Network settings", "Netværks indstillinger",
+"Network type", "Netværks-type",
+"Networks", "Netværk",
+"News", "Nyheder",
+"News magazine", "Nyhedsmagasin",
+"Next tune delay in ms (0-2000)", "Næste indstillings-forsinkelse i ms (0-2000)",
+"No", "Nej",
+"No PIN", "Ingen PIN",
+"No access", "Ingen Adgang",
+"No adapters specified!\n", "Ingen Adapter valgt\n",
+"No assigned adapters", "Ingen adapter tilføjet",
+"No days", "Ingen dage",
+"No descrambler", "In descambler",
+"No free adapter", "Ingen tilgængelig Adapter",
+"No input detected", "Ingen indgang opdaget",
+"No service assigned to channel", "Ingen tjeneste tildelt kanal",
+"No service enabled", "Ingen tjeneste er aktiveret.",
+"No source available", "Ingen Kilde til rådighed",
+"None", "Ingen",
+"Not linked", "ikke tilknyttet",
+"Not set", "Ikke sat",
+"Not set (none or channel configuration)", "Ikke sat (none eller kanal-konfiguration)",
+"Not set (use channel or DVR configuration)", "Ikke sat (brug kanal eller DVR-konfiguration)",
+"Number", "Nummer",
+"Number of seconds to wait before timing out.", "Antal sekunder der ventes, før timeout",
+"Number of tsfile tuners", "Antal ts-fil-tunere",
+"OK (partial)", "OK (delvist)",
+"OSCam net protocol (rev >= 10389)", "OSCam netprotokol (rev >= 10389)",
+"OSCam new pc-nodmx (rev >= 10389)", "OSCam ny pc-nodmx (rev >= 10389)",
+"Odd key", "Ulige Nøgle",
+"Off", "Slukket",
+"Older OSCam", "Ældre OSCAM",
+"On", "Til",
+"On file removal", "Ved fjernelse af fil",
+"Only Bulsatcom 39E", "Kun Bulsatcom 39E",
+"Only EIT", "Kun EIT",
+"Only OpenTV Sky Ausat", "Kun OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Kun OpenTV Sky Italia ",
+"Only OpenTV Sky UK", "Kun OpenTV Sky UK",
+"Only PSIP (ATSC)", "Kun PSIP (ATSC)",
+"Only UK Freesat", "Kun UK Freesat",
+"Only UK Freeview", "Kun UK Freeview",
+"Only Viasat Baltic", "Kun Viasat Baltic",
+"Only preferred CA PID", "Kun foretrukket CA PID",
+"OpenTV channel number", "OpenTV-kanalnummer",
+"Orbital position", "Baneposition",
+"Orbital positions", "Bbanepositioner",
+"Original network ID", "Oprindeligt NetværksID",
+"Other stream filter", "Andet Stream-filter",
+"Output directory for tsdebug", "Destiantionsmappe for tsdebug",
+"Over-the-air Cron multi-line", "Over-the-air Cron multi-linie",
+"Over-the-air EPG grabber", "Over-the-air EPG-grabber",
+"Over-the-air grabbers", "Over-the-air Grabbere",
+"Owner", "Ejer",
+"PIDs 21 in setup", "PID 21 i opsætning",
+"PIDs in setup", "PID i opsætning",
+"PIN inquiry match string", "PIN forespørgsels-matchstreng",
+"PLS code", "PLS-kode",
+"PLS mode", "PLS-mode",
+"Parent entry", "Foregående Post",
+"Pass subscription weight", "Passer abonnement-prioritet",
+"Password", "Adgangskode",
+"Password2", "Password 2",
+"Passwords", "Adgangskoder",
+"Path", "Sti",
+"Performing arts", "Scenekunst",
+"Periodically save EPG to disk (hours)", "Gem EPG periodisk til dsik (Timer)",
+"Physiology", "Fysiologi",
+"Picon path (see Help)", "Picon-sti (se Hjælp)",
+"Polarization", "Polarisering",
+"Political issues", "Politisk Emne",
+"Popular culture", "Populær-kultur",
+"Position of the input.", "Position af indgang",
+"Post-processor command", "Post-processorkommando",
+"Post-recording padding", "Post-processor padding",
+"Power save", "Strømsparer",
+"Power-up time (ms) (15-200)", "Opvågningstid (ms) (15-200)",
+"Pre-defined muxes", "Præ-definerede muxer",
+"Pre-recording padding", "Fyld før Optagelse",
+"Pre-school children's programs", "Førskole børneprogram",
+"Prefer picons over channel name", "Foretræk picon'er frem for kanalnavne",
+"Preferred CA PID", "Foretræk CA PID",
+"Preferred service video type", "Foretrukken tjenestes videotype",
+"Presentation", "Præsentation",
+"Press", "Presse",
+"Priority", "Prioritet",
+"Priority (-10..10)", "Prioritet (-10..10)",
+"Private", "Privat",
+"Profile name", "Profilnavn",
+"Provider", "Udbyder",
+"Provider ID", "UdbyderID",
+"Provider network name", "Udbyderens netværks navn",
+"Psychology", "Psykologi",
+"Puppets", "Dukker",
+"RAM only", "Kun RAM",
+"RTSP port (554 or 9983, 0 = disable)", "RTSP Port (554 or 9983, 0=deaktiver)",
+"Re-fetch period (hours)", "Gen-hentnings-periode (timer)",
+"Re-fetch period (mins)", "Gen-hentnings-periode (Minutter)",
+"Re-record%s%s", "Gen-optag%s%s",
+"Re-try period (hours)", "Prøv-igen-periode (timer)",
+"Real Time Streaming Protocol (RTSP) port the server should listen on (554 or 9983, 0 = disable).", "Real Time Streaming Protocol (RTSP) porten som serveren skal lytte til er (554 eller 9983, 0=deaktiveret).",
+"Record all", "Optag alt",
+"Recording file options", "Optagelse, fil-muligheder",
+"Recording system path", "Optagelses-systemsti",
+"Reject", "Afslå",
+"Religious", "Reilgiøst",
+"Remarkable people", "Bemærkelsesværdige mennesker",
+"Remove HTTP arguments", "Fjern HTTp-argumenter",
+"Remove all unsafe characters from filename", "Fjern alle farlige karaktere fra filnavn",
+"Replace whitespace in title with '-'", "Erstat mellemrum i titel med '-'",
+"Reply to CAM PIN inquiries", "Svar på CAM PIN-forespørgsler",
+"Reports", "Rapporter",
+"Rerun of", "Genudsendelse af",
+"Rescan", "Genscan",
+"Reserved", "Reserveret",
+"Resolution (height)", "Opløsning (højde)",
+"Restart on error", "Genstart ved fejl",
+"Reuse EPG from", "Genbrug EPG fra",
+"Rewrite EIT", "Genskriv EIT",
+"Rewrite PAT", "Genskriv PAT",
+"Rewrite PMT", "Genskriv PMT",
+"Rewrite SDT", "Genskriv SDT",
+"Romance", "Romantik",
+"Rotor initialization time (seconds)", "Rotor opstartstid (seconds)",
+"Run as group", "Kør som gruppe",
+"Run as user", "Kør som user",
+"Running", "Kører",
+"SAT->IP frontend number.", "SAT->IP frontend nummer.",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP portnummer for server\n(default: -1=deaktiveret 0=webconfig, standard port er 554)",
+"SAT>IP client", "SAT>IP klient",
+"SAT>IP source number", "SAT>IP kildenummer",
+"SSL verify peer", "SSL godkend peer",
+"Sat", "Lør",
+"Satellite longitude", "Satellit længdegrad",
+"Satellite positions", "Satellitpositioner",
+"Scan after creation", "Skan efter oprettelse ",
+"Scan queue length", "Skannings-kø, længde",
+"Scan result", "Skannings-resultat",
+"Scan status", "Skanningsstatus",
+"Schedule a re-recording if more errors than (0=off)", "Planlæg genoptagelse hvis flere fejl end (0=fra)",
+"Schedule frequency (in Cron format).", "Planlægnings frekvens (i Cron format).",
+"Schedule status", "Planlægnings status",
+"Schedule status.", "Planlægnings status.",
+"Scheduled for recording", "Planlagt optagelse",
+"Scheduled start time", "Planlagt start",
+"Scheduled stop time", "Planlagt sluttid",
+"School programs", "Skoleprogrammer",
+"Science", "Videnskab",
+"Science fiction", "Science Fiction",
+"Season", "Sæson",
+"Season %d", "Sæson %d",
+"Select services to map.", "Vælg tjenester der skal tilføjes",
+"Send CAPMT query", "Send CAPMT-forespørgsel",
+"Send full PLAY cmd", "Send fuld PLAY cmd",
+"Serial number", "Serielnummer",
+"Series link", "Serie-link",
+"Serious", "Alvorlig",
+"Serious music", "Alvorlig musik",
+"Server connectivity", "Server-forbindelse",
+"Server details.", "Server detaljer.",
+"Service", "Tjeneste",
+"Service ID", "Tjeneste ID",
+"Service configuration", "Tjeneste konfiguration",
+"Service count %zi", "Tjeneste tæller %zi",
+"Service mapper", "Tjeneste kortlægger",
+"Service mapping", "Tjeneste kortlægning",
+"Service name", "Tjeneste navn",
+"Service name found in EPG data.", "Tjeneste navn fundet i EPG data.",
+"Service name picons", "Tjeneste navn picons",
+"Service raw", "tjeneste, rå",
+"Service type", "Tjeneste type",
+"Services", "Tjenester",
+"Services. Services associated with the channel.", "Tjenester. Tjenester i forbindelse med denne kanal.",
+"Set the display name.", "indtast vist navn.",
+"Settings", "Indstillinger",
+"Show this page", "Vis denne side",
+"Show version information", "Vis versions-information",
+"Signal quality too poor", "Signalkvalitet for lav",
+"Signal scale (240 or 100)", "Signalskala (240 eller 100)",
+"Site latitude", "Lokations-breddegrad",
+"Site longitude", "Lokations-længdegrad",
+"Skip TS packets (0-200)", "Skip TS-pakker (0-200)",
+"Skip commercials", "Skip reklamer",
+"Skip initial bytes", "Skip første bytes",
+"Skip initial scan", "Skip første skanning",
+"Slave entry", "Slave-entry",
+"Slot state", "Slot-status",
+"Soccer", "Fodbold",
+"Social advisory", "Socialrådgivning",
+"Sort index", "Sortér indeks",
+"Source", "Kilde",
+"Source deleted", "Kilde fjernet",
+"Source quality is bad", "Kilde-signal er dårligt",
+"Source reconfigured", "Kilde genkonfigureret",
+"Southern hemisphere (latitude direction)", "Sydlige halvkugle (breddegrads-retning)",
+"Special events (Olympic Games, World Cup, etc.)", "Specielle begivenheder (Olympiske Lege, WM, osv.)",
+"Specify User-Agent header for the http client", "Specificér UserAgent-header for http-klienten",
+"Specify alternative htsp port", "Specificér alternativ HTSP-port",
+"Specify alternative http port", "Specificér alternativ HTTP-port",
+"Specify alternative http webroot", "Specificér alternativ HTTP-webroot",
+"Specify bind address", "Specificér bind-adresse",
+"Specify extra htsp port", "Specificér ekstra HTSP-port",
+"Spiritual sciences", "Sprituel videnskab",
+"Sports", "Sport",
+"Sports magazines", "Sportsmagasiner",
+"Start after", "Start efter",
+"Start before", "Start før",
+"Start time", "Starttid",
+"Status period (ms)", "Statusperiode (ms)",
+"Stop time", "Sluttid",
+"Storage path", "Lagrings-sti",
+"Storage space", "Diskplads",
+"Stream index", "Stream-index",
+"Stream profile", "Stream-profile",
+"Stream type", "Stream-type",
+"Streaming priority", "Streamings-prioritet",
+"Streaming profiles", "Streaming-profiler",
+"Subdirectory options", "Undermappe-indstillinger",
+"Subscribe to a service permanently", "Abonner på en tjeneste permanent",
+"Subscription overridden", "Abonnement overskrevet",
+"Subscription weight", "Abonnement-prioritet",
+"Substitute formatters", "Substitutions-formatteringer",
+"Subtitle", "Undertekst",
+"Subtitle codec", "Undertekst-codec",
+"Subtitle stream filter", "Undertekst-stream-filter",
+"Sun", "Søn",
+"Switch before rotor", "Skift før rotor",
+"Switch type", "Switch-type",
+"Symbol rate (Sym/s)", "Symbolrate (Sym/s)",
+"Sync + Don't keep", "Sync + Behold ikke",
+"Tag files with metadata", "Tilføj metadata til filer",
+"Tags", "Grupper",
+"Tags. Tags linked/to link to the channel.", "Grupper. Grupper tilføjet/skal tilføjes til kanal.",
+"Talk show", "Talkshow",
+"Team sports (excluding football)", "Teamsport (eksklusiv fodbold)",
+"Technology", "Teknologi",
+"Teletext stream filter", "Teletext stream-filter",
+"Testing", "Test",
+"Testing options", "Test-indstillinger",
+"The current boot ID.", "Nuværende boot ID.",
+"The current configuration ID.", "Nuværende konfigurations ID.",
+"The current configuration version.", "Nuværende konfigurations version.",
+"The default language to use if the user  language isn't set in the Access Entries tab.", "Standard sprog, som bruges hvis brugerens sprog ikke er sat i Adgangsposteringer fanebladet",
+"The default subscription weight for each subscription.", "Standard abonnements prioritet for hver abonnement.",
+"The device ID.", "Enhedens ID.",
+"The device's serial number.", "Enhedens serienummer.",
+"The frequency of the mux (in Hertz).", "Mux'ens frekvens (i Hertz).",
+"The language the filter should apply to.", "Sprog som filteret skal bruge.",
+"The maximum number of recordings that can be scheduled.", "Maximale antal optagelser som kan planlægges.",
+"The mux the service is on.", "Tjenesten er placeret på mux.",
+"The mux's universally unique identifier.", "Mux'ens universelle entydige ID.",
+"The network the service is on.", "Netværket som kanalen er på.",
+"The networks using this configuration.", "Netværket bruger denne konfiguration.",
+"The number of ATSC-C (Cable/AnnexB) tuners to export.", "Antal af ATSC-C (Kabel/AnnexB) tunere til eksport.",
+"The number of ATSC-T (Terresterial) tuners to export.", "Antal af ASTC-T (Tag-antenne) tunere til eksport.",
+"The number of DVB-C (Cable) tuners to export.", "Antal af DVB-C (Kabel-TV) tunere til eksport.",
+"The number of DVB-C2 (Cable) tuners to export.", "Antal af DVB-C2 (Kabel-TV) tunere til eksport.",
+"The number of DVB-S (Satellite) tuners to export.", "Antal af DVB-S (Satellit) tunere til eksport.",
+"The number of DVB-S2 (Satellite) tuners to export.", "Antal af DVB-S2 (Satellit) tunere til eksport.",
+"The number of DVB-T (Terresterial) tuners to export.", "Antal af DVB-T (Tag-antenne) tunere til eksport.",
+"The number of DVB-T2 (Terresterial) tuners to export.", "Antal af DVB-T2 (Tag-antenne) tunere til eksport.",
+"The number of days cookies set by Tvheadend should expire.", "Antallet af dage, før \"cookies\" lavet af Tvheadend, udløber",
+"The provider's name.", "Udbyderens navn.",
+"The provider's network ID.", "Udbyderens netværks ID.",
+"The provider's network name.", "Udbyderens netværks navn.",
+"The service ID as set by the provider.", "Tjeneste ID, som er fastsat af udbyderen.",
+"The service name as set by the provider.", "Tjenestens navn, som er fastsat af udbyderen.",
+"The symbol rate.", "Symbol rate",
+"The total number of services found on this mux.", "Det samlede antal tjenester fundet på denne mux.",
+"The transport stream ID of the mux within the network.", "Transportstream ID fra mux'en i netværket.",
+"The video stream types the filter should apply to.", "Videostream typer som filteret skal bruges på.",
+"This tuner", "Denne tuner",
+"Thu", "Tor",
+"Time", "Tid",
+"Time missed", "Tid overskredet",
+"Time record caption", "Tids-optag undertekst",
+"Time recording%s%s", "Tids-optagelse%s%s",
+"Time update", "Opdater tid",
+"Timeout (sec) (0=infinite)", "Timeout (sek) (0=uendelig)",
+"Timeout (seconds)", "Timeout (sekunder)",
+"Timeshift", "Tidsforskydning",
+"Timout (secs)", "Timout (sek)",
+"Title", "Titel",
+"Title (regexp)", "Titel (regexp)",
+"Toggle details", "Slå detaljer til/fra",
+"Total number of services found on this network.", "Det samlede antal tjenester fundet på dette netværk.",
+"Total number of services found.", "Det samlede antal tjenester fundet.",
+"Tourism / Travel", "Turisme / Rejser",
+"Trace subsystems", "Trace undersystemer",
+"Traditional arts", "Traditionel kunst",
+"Traditional music", "Traditionel musik",
+"Transcoding", "Omkodning",
+"Transmission mode", "Transmissions-mode",
+"Transponder ID", "TransponderID",
+"Transport stream ID", "Transport-streamID",
+"Tue", "Tir",
+"Tune before DiseqC", "Indstil før DiseqC",
+"Tuner bind IP address", "Tuner bind IP-adresse",
+"Tuner configuration", "Tuner-konfiguration",
+"Tuning failed", "Indstilling fejlede",
+"Turn off LNB when idle", "Slå LNB fra ved idle",
+"Tvheadend server name", "Tvheadend servernavn",
+"UDP RTP port number (2 ports)", "UDP RTP portnumre (2 porte)",
+"URL with the SAT>IP server XML location", "URL med SAT>IP server XML-lokation",
+"USALS rotor", "USALS Skifter",
+"Uncommitted", "Ikke commited",
+"Uncommitted first", "Ikke commited først",
+"Unicable switch (universal LNB, experimental)", "Unicable switch (universal LNB, eksperimental)",
+"Unicable type", "Unicable-type",
+"Unimportant", "Ikke vigtigt",
+"Universal LNB only", "Kun universal LNB",
+"Universally unique identifier. Read only.", "Universal unik ID. Kun læsning.",
+"Unknown", "Ukendt",
+"Unknown reason (%i)", "Ukendt grund (%i)",
+"Unlimited size", "Uendelig størrelse",
+"Unlimited time", "Uendelig tid",
+"Update card (EMM)", "Opdatér kort (EMM)",
+"Update channel icon", "Opdatér kanalikon",
+"Update channel name", "Opdatér kanalnavn",
+"Update channel number", "Opdater kanalnummer",
+"Update disabled", "Opdatering deaktiveret",
+"Update time", "Opdatér tid",
+"Update tolerance (ms)", "Opdateringstolerence (ms)",
+"Updated", "Opdateret",
+"Use EPG running state", "Brug EPG kørende tilstand",
+"Use Windows-compatible filenames", "Brug Windows-kompatible filnavne",
+"Use XSPF playlist instead of M3U", "Brug XSPF playlist i stedet for M3U",
+"Use a pre-defined list of DVB-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Brug en foruddefineret liste over DVB-C mux'er. Bemærk: disse lister kan nogle gange være forældet og kan gøre at scanningen tager længere tid end normalt.",
+"Use original", "Brug original",
+"Use service IDs as channel numbers", "Brug tjeneste ID som kanalnumre",
+"Use tag internally (don't expose to clients).", "Brug gruppen internt (vis ikke til klienter).",
+"User access error", "Brugeradgangs-fejl",
+"User icon", "Bruger ikon",
+"User interface level", "Bruger niveau",
+"User interface quick tips", "Hurtige tips til brugergrænsefladen",
+"User language", "Bruger sprog",
+"User limit reached", "Brugergrænse nået",
+"User login", "Bruger login",
+"Username", "Brugernavn",
+"Variety show", "Varietyshow",
+"Video recorder", "Videooptager",
+"Video stream filter", "Videostream-filter",
+"Visually impaired commentary/audio description", "Kommentar for svatgseende / audio-beskrivelse",
+"WEBM/built-in", "WEBM/indbygget",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV H264/AAC/MPEG-TS-profil",
+"WEBTV profile H264/AAC/Matroska", "WEBTV H264/AAC/Matroska-profil",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV VP8/Vorbis/WEBM-profil",
+"Waiting for EPG running flag", "Venter på EPG \"running\"-flag",
+"Waiting for program start", "Venter på at program starter",
+"Waiting for stream", "Venter på stream",
+"War", "Krig",
+"Water sport", "Vandsport",
+"Weak stream", "Svag stream",
+"Weather report", "Vejrudsigt",
+"Web interface", "Webinterface",
+"Web interface language", "Webinterface, Sprog",
+"Web user interface", "Webbrugerinterface",
+"Wed", "Ons",
+"Welcome - Tvheadend - your TV streaming server and video recorder", "Velkommen - TVHeadend - Din TV streaming server og video optager",
+"Western", "Vestlig",
+"Western hemisphere (latitude direction)", "Vestlig Halvkugle",
+"Wizard", "Vejledning",
+"Yes", "Ja",
+"addpids/delpids supported", "addpids/delpids understøttet",
+"hrs", "timer",
+"invalid option specified [%s]", "ugyldig paramter angivet [%s]",
+"mins", "minutter",
+"option %s requires a value", "paramter %s kræver en værdi",
+"tsfile input (mux file)", "tsfile indgang (mux fil)",
+"tvhdhomerun client", "tvhdhomerun-klient",
+NULL, NULL
+};
+
+static const char *tvh_locale_4[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nFür mehr Informationen besuchen Sie bitte die Tvheadend Webseite:\nhttps://tvheadend.org\n",
+"# Channels", "# Kanäle",
+"# Mapped channels", "# Zugeordnete Kanäle",
+"# Services", "Services",
+"# Services seen", "# Gefundene Services",
+"# tune repeats", "# Tune Wiederholungen",
+"(Default profile)", "(Standard Profil)",
+"1 day", "Ein Tag",
+"1 month", "Ein Monat",
+"1 week", "Eine Woche",
+"1 year", "Ein Jahr",
+"2 months", "2 Monate",
+"2 weeks", "2 Wochen",
+"2 years", "2 Jahre",
+"2-Port switch (universal LNB)", "2-Port-Switch (Universal LNB)",
+"3 days", "3 Tage",
+"3 months", "3 Monate",
+"3 weeks", "3 Wochen",
+"3 years", "3 Jahre",
+"4-Port switch (universal LNB)", "4-Port-Switch (Universal LNB)",
+"5 days", "5 Tage",
+"6 months", "6 Monate",
+"A channel tag (e.g. a group of channels) to which this rule applies.", "Ein Channel-Tag (z.B. eine Gruppe von Kanälen) auf welche die Regel wirkt.",
+"AC-3 = descriptor 6", "AC-3 = Deskriptor 6",
+"AC-3 detection", "AC-3 Erkennung",
+"ACTIVE", "AKTIV",
+"AES constant code word client", "AES Constant Code Word Client",
+"ANY", "BELIEBIG",
+"ATSC source ID", "ATSC Quelle ID",
+"ATSC-C multiplex", "ATSC-C Multiplex",
+"ATSC-C network", "ATSC-C Netzwerk",
+"ATSC-T multiplex", "ATSC-T Multiplex",
+"ATSC-T network", "ATSC-T Netzwerk",
+"Aborted by user", "Durch Benutzer abgebrochen",
+"Accept remote subscription weight", "Remote Abonnementgewicht zulassen",
+"Accept the remote subscription weight (from the SAT>IP client).", "Remote Abonnementgewicht zulassen (von SAT>IP Client)",
+"Access", "Zugang",
+"Action", "Aktion",
+"Adapter in use by another subscription", "Adapter von anderem Abonnement in Verwendung",
+"Add file and line numbers to debug", "Füge Datei und Zeilennummern zu Debugmeldungen hinzu",
+"Add the thread ID to debug", "Füge Thread-ID zu Debugmeldungen hinzu",
+"Additional arguments to pass to the grabber.", "Zusätzliche Argumente zur Übergabe an den Grabber.",
+"Additional service names found in EPG data.", "Zusätzliche Service Namen in den EPG Daten.",
+"Additional time (in seconds) in which to get the tuner ready for recording. This is useful for those with tuners that take some time to tune and/or send garbage data at the beginning. ", "Zusätzliche Zeit (in Sekunden) für den Tuner um bereit für die Aufnahme zu sein. Das ist hilfreich für Tuner, die einige Zeit zum tunen benötigen und/oder am Anfang Mülldaten senden.",
+"Admin password", "Admin Passwort",
+"Admin username", "Admin Benutzername",
+"Administrator login", "Administratorzugang",
+"Adult movie", "Erwachsenenfilm",
+"Advanced", "Erweitert",
+"Advanced (non-universal LNBs, rotors, etc.)", "Erweitert (Nicht-universale LNBs, Rotoren, etc.)",
+"Advanced streaming", "Erweitertes Streaming",
+"Adventure", "Abenteuer",
+"Advertisement / Shopping", "Werbung / Shopping",
+"All (Streaming plus DVR)", "Alle (Streaming + DVR)",
+"All DVR (rw)", "DVR (alle, Schreibrecht)",
+"All characters that could possibly cause problems for filenaming will be replaced with an underscore. See Help for details.", "Alle Zeichen die Probleme in Dateinamen machen könnten, werden durch Unterstriche ersetzt. Siehe Hilfe für Details.",
+"All lower-case", "Alles kleingeschrieben",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Alle Erlöse werden dafür genutzt, die Serverinfrastruktur zu unterhalten und Testgeräte zu kaufen.",
+"All: Record if different description", "Alle: Aufnehmen, wenn abweichende Beschreibung",
+"All: Record if different episode number", "Alle: Aufnehmen, wenn abweichende Episiodennummer",
+"All: Record if different subtitle", "Alle: Aufnehmen, wenn abweichender Untertitel",
+"All: Record once per day", "Alle: Einmal pro Tag aufnehmen ",
+"All: Record once per week", "Alle: Einmal pro Woche aufnehmen",
+"Allow high bitrate mode (CI+ CAMs only).", "Erlaube hohe Bitrate Modus (Nur CI+ CAMs)",
+"Allow idle scan tuning on this device.", "Erlaube Idle Scan Tuning auf diesem Gerät.",
+"Allow the combined size of all timeshift buffers to potentially grow unbounded until your storage media runs out of space.", "Erlaube der kombinierten Größe aller Timeshift Puffer potentiell unbegrenzt zu wachsen bis das Speichermedium voll ist.",
+"Allow the initial scan tuning on this device (scan when Tvheadend starts). See 'Skip Initial Scan' in the network settings for further details.", "Erlaube das Initiale Scannen auf diesem Gerät (wenn Tvheadend gestartet wird). Siehe 'Überspringe initialen Scan' in den Netzwerkeinstellungen für weitere Details.",
+"Allow the timeshift buffer to grow unbounded until your storage media runs out of space. Warning, enabling this option may cause your system to slow down or crash completely!", "Erlaubt dem Timeshift Puffer unbegrenzt zu wachsen bis das Speichermedium voll ist. Achtung, das Aktivieren dieser Option kann das System verlangsamen oder komplett abstürzen lassen.",
+"Allow to show the quick tips for the form fields.", "Anzeige von Quick Tips für die Formularfelder zulassen",
+"Allow/disallow HTSP protocol streaming, e.g Kodi (via pvr.hts) or Movian.", "Erlaube/Verbiete HTSP Protokoll Straming, z.B. Kodi (via pvr.hts) oder Movian.",
+"Allow/disallow HTTP streaming.", "Erlaube/Verbiete HTTP Streaming.",
+"Allow/disallow access to DVR via the HTSP protocol.", "Erlaube/Verbiete Zugriff auf DVR über das HTSP Protokoll.",
+"Allow/disallow access to all failed DVR entries.", "Erlaube/Verbiete Zugriff auf alle fehlgeschlagenen DVR Einträge.",
+"Allow/disallow access to other users DVR entries (read only).", "Erlaube/Verbiete Zugriff auf DVR Einträge anderer Nutzer (nur Lesen).",
+"Allow/disallow access to the 'Configuration' tab.", "Erlaube/Verbiete Zugriff auf 'Konfiguration' Register.",
+"Allow/disallow access to video recorder functionality (including Autorecs).", "Erlaube/Verbiete Zugriff auf Video Rekorder Funktionalität (inkl. Auto-Aufnahmen).",
+"Allow/disallow advanced http streaming, e.g, direct service or mux links.", "Erlaube/Verbiete erweitertes HTTP Streaming, z.B. Direktservice oder Muxverknüpfungen.",
+"Allow/disallow read/write access to other users' DVR entries.", "Erlaube/Verbiete Lese-/Schreibzugriff auf DVR Einträge anderer Benutzer.",
+"Allow/disallow web interface access (this  includes access to the EPG).", "Erlaube/Verbiete Zugriff auf Webinterface (einschließlich Zugriff auf das EPG).",
+"Allowed DVR profiles. This limits the profiles the user has access to.", "Erlaubte DVR Profile. Das limitiert die Profile, auf die der Nutzer Zugriff hat.",
+"Allowed network", "Zugelassenes Netzwerk",
+"Allowed networks", "Erlaubte Netzwerke",
+"Alternate PID path", "Alternativer PID-Pfad",
+"Alternate configuration path", "Alternativer Konfigurationspfad",
+"Altitude (in meters).", "Höhe (in Meter)",
+"Altitude (meters)", "Höhe (Meter)",
+"Always send the whole DiseqC sequence including LNB setup (voltage, tone). If this is not checked, only changed settings are sent, which may cause issues with some drivers. If the tuning is not reliable, try activating this option.", "Sende immer die ganze DiseqC Sequenz inklusive LNB Setup (Spannung, Ton). Wenn dies nicht aktiviert ist, werden nur geänderte Einstellungen gesendet, was Probleme mit einigen Treibern verursachen kann. Wenn das Tuning nicht zuverlässig ist, sollte diese Option ausprobiert werden.",
+"Always use the old ioctls to read the linuxdvb status (signal strength, SNR, error counters). Some drivers are not mature enough to provide the correct values using the new v5 linuxdvb API.", "Benutze immer die alten ioctls zum Lesen des Linux DVB Status (Signalstärke, SNR, Fehlerzähler). Einige Treiber sind nicht ausgereift genug um die korrekten Werte über die neue V5 Linux DVB API zurückzugeben.",
+"An event which starts between this \"start after\" and \"start before\" will be matched (including boundary values).", "Ein Ereignis, das zwischen \"start nach\" und \" starten, bevor\" startet, stimmt (einschließlich der Grenzwerte ) überein.",
+"Animals", "Tiere",
+"Anonymize HTSP access", "HTSP Zugriff anonymisieren",
+"Any", "Beliebig",
+"Arts", "Kunst",
+"Assign predefined muxes to networks", "Den Netzwerken vordefinierte Muxe zuweisen",
+"Associate this device with one or more networks.", "Verbinde das Gerät mit einem oder mehreren Netzwerken.",
+"Athletics", "Athletik",
+"Audio birate to use for transcoding.", "Audio-Bitrate für Transcoding.",
+"Audio bitrate (kb/s) (0=auto)", "Audio-Bitrate (kb/s) (0=Auto)",
+"Audio channel layout.", "Audio-Kanal Layout.",
+"Audio codec", "Audio-CODEC",
+"Audio codec to use for the transcode. \"Do not use\" will disable audio output.", "Zu verwendender Audio-Codec für das Transkodieren. \"Nicht benutzen\" wird Audio-Ausgang deaktivieren.",
+"Audio language (Not currently used).", "Audio Sprache (zur Zeit nicht benutzt).",
+"Audio stream filter", "Audio Streamfilter",
+"Auto check disabled", "Automatische Überprüfung deaktiviert",
+"Auto check enabled", "Automatische Prüfung aktiviert",
+"Auto record", "Automatische Aufnahme",
+"Auto record caption", "Auto-Aufnahme Beschriftung",
+"Auto recording%s%s", "Auto-Aufnahme%s%s",
+"Auto time record", "Automatische Zeitaufnahme",
+"Auto-Map to channels", "Automatische Zuordnung zu Kanälen",
+"Automatic checking", "Automatische Überprüfung",
+"Automatic recording caption.", "Automatische Aufnahme Beschriftung",
+"Automatic schedule entry not found", "Automatischen Aufnahmeeintrag nicht gefunden",
+"Automatic time scheduler entry not found", "Automatische Zeitplaner-Eintrag nicht gefunden",
+"Automatically map EPG source", "EPG Quelle automatisch zuordnen",
+"Automatically map EPG source. Automatically link EPG data to the channel (using the channel name for matching). If you turn this option off, only the OTA EPG grabber will be used for this channel unless you've specifically set a different EPG Source.", "EPG Quelle automatisch zuweisen. Verknüpft EPG Daten automatisch mit einem Kanal (basierend auf Kanalname). Wenn diese Option deaktiviert wird, wird nur der OTA EPG Grabber genutzt bis eine andere EPG Quelle zugewiesen wird.",
+"Automatically map all available services to channels.", "Automatisch alle verfügbaren Services zu Kanälen zuordnen.",
+"Automatically name from network", "Automatisch vom Netzwerk benennen",
+"Automatically name from network. Always use the name defined by the network.", "Automatisch vom Netzwerk benennen. Immer den vom Netzwerk definierten Namen verwenden.",
+"Automatically record.", "Automatisch aufnehmen",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Automatische Aktualisierung der Sender Logos basierend auf den Informationen der aktivierten EPG-Grabber. Hinweis: Das kann zu ungewollten Veränderungen der aktuell definierten Senderlogos führen.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Automatische Aktualisierung der Sender Namen basierend auf den Informationen der aktivierten EPG-Grabber. Hinweis: Das kann zu ungewollten Veränderungen der aktuell definierten Sender Namen führen.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Automatische Aktualisierung der Sender Nummer basierend auf den Informationen der aktivierten EPG-Grabber. Hinweis: Das kann zu ungewollten Veränderungen der aktuell definierten Sender Nummer führen.",
+"Autorec maximum count (0=unlimited)", "Maximale Anzahl Auto-Aufnahmen (0=unlimitiert)",
+"Autorec maximum schedules limit (0=unlimited)", "Maximale Auto-Aufnahme-Pläne (0=unlimitiert)",
+"Bad", "Schlecht",
+"Bad request", "Fehlerhafte Anfrage",
+"Ballet", "Ballett",
+"Bandwidth", "Bandbreite",
+"Based on software from", "Basiert auf Software von",
+"Basic", "Einfach",
+"Bind to specific local IP address.", "An spezifische lokale IP Adresse binden",
+"Bitrate to use for the transcode. See Help for detailed information.", "Zu nutzende Bitrate für die Transkodierung. Siehe Hilfe für Details.",
+"Boot ID", "Boot-ID",
+"Bouquet (auto). The bouquet the channel is associated with.", "Bouquet (auto). Das Bouquet dem der Kanal zugeordnet ist.",
+"Brand", "Marke",
+"Branding information (if available).", "Markeninformationen (wenn vorhanden)",
+"Broadcast", "Ausstrahlung",
+"Broadcast type", "Broadcast Typ",
+"Broadcast.", "Ausstrahlung",
+"Broadcasting", "Rundfunk",
+"Buffering limit (ms)", "Limit für Pufferung (ms)",
+"By default, linuxdvb's status read period is 1000ms (one second). The accepted range is 250ms to 8000ms. Note that for some hardware or drivers (like USB), the status operations take too much time and CPU. In this case, increase the default value. For fast hardware, this value might be decreased to make the decision of the re-tune algorithm based on the signal status faster.", "Standardmäßig wird der Linuxdvb-Status alle 1000ms (jede Sekunde) gelesen. Mögliche Werte sind 250ms bis 8000ms. Einige Hardware oder Treiber (wie USB) benötigen zu viel Zeit oder CPU. In diesem Fall sollte der Wert erhöht werden. Für schnelle Hardware, kann der Wert verringert werden, um die Entscheidung des Retune-Algorithmus auf der Signalzustand zu beschleunigen.",
+"CA client %i", "CA Client %i",
+"CA identification", "CA Identifikation",
+"CA provider", "CA Anbieter",
+"CA stream filter", "CA Streamfilter",
+"CAPMT interval (in ms).", "CAPMT Intervall (in ms)",
+"CAPMT interval (ms)", "CAPMT Intervall (ms)",
+"CAPMT query interval (ms)", "CAPMT Abfrageintervall (ms)",
+"CAPMT query interval (ms).", "CAPMT Abfrageintervall (in ms)",
+"CRID authority", "CRID Authority",
+"Cache scheme", "Puffer-Schema",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket Dateiname / IP-Adresse (TCP-Modus)",
+"Cartoons", "Zeichentrickfilme",
+"Channel", "Kanal",
+"Channel does not exist", "Kanal existiert nicht",
+"Channel icon", "Kanallogo",
+"Channel icon as defined in EPG data.", "Kanallogo wie im EPG definiert",
+"Channel icon name scheme", "Kanallogo Namensschema",
+"Channel icon path (see Help)", "Kanallogo Pfad (siehe Hilfe)",
+"Channel name", "Kanalname",
+"Channel not found", "Kanal nicht gefunden",
+"Channel number", "Kanalnummer",
+"Channel number as defined in EPG data.", "Kanalnummer wie im EPG definiert.",
+"Channel number offset", "Kanalnummer Versatz",
+"Channel numbers from", "Kanalnummern von",
+"Channel tag", "Kanal-Tag",
+"Channel tag does not exist", "Kanal-Tag existiert nicht",
+"Channel tag reference", "Kanal-Tag Referenz",
+"Channel tags", "Kanal-Tags",
+"Channel tags the user is allowed access to/excluded from.", "Kanal-Tags auf die der Nutzer zugreifen darf bzw. von denen er ausgeschlossen ist.",
+"Channel to use/used for the recording.", "Kanal der für die Aufnahme genutzt wird/wurde.",
+"Channels", "Kanäle",
+"Channels EPG data is used by.", "Kanal EPG Daten werden genutzt von.",
+"Character set", "Zeichensatz",
+"Characters not supported in Windows filenames (e.g. for an SMB/CIFS share) will be stripped out or converted.", "Zeichen, welche von Windows Dateinamen nicht unterstützt werden (z.B. für eine SMB/CIFS Freigabe) werden entfernt oder konvertiert.",
+"Check availability", "Verfügbarkeit testen",
+"Check for the services' presence. If the service is no longer broadcast this field will change to \"Missing In PAT/SDT\".", "Prüfe die Serviceverfügbarkeit. Wenn der Dienst nicht mehr sendet wechselt das Feld in \"Fehlt in PAT/SDT\".",
+"Check service availability (add live services only).", "Prüfe Serviceverfügbarkeit  (Nur aktive Services hinzufügen)",
+"Children's / Youth programs", "Kinder- / Jugendprogramme",
+"Cinema", "Kino",
+"Class", "Klasse",
+"Classical", "Klassisch",
+"Classical music", "Klassische Musik",
+"Clean effects", "Nur Effekte",
+"Client name", "Client-Name",
+"Clone scheduled entry on error", "Kopiere geplanten Eintrag bei Fehlern",
+"Code word client (newcamd)", "Code Word Client (newcamd)",
+"Comedy", "Komödie",
+"Command delay time (ms) (10-200)", "Befehlsverzögerung (ms) (10-200)",
+"Command time (ms) (10-100)", "Befehlszeit (ms) (10-100)",
+"Comment", "Kommentar",
+"Commercial break", "Werbeunterbrechung",
+"Commercials will be dropped from the recordings. At the moment, commercial detection only works for the Swedish channel TV4.", "Werbung wird aus der Aufnahme geschnitten. Im Moment funktioniert die Werbeerkennung nur für den schwedischen Kanal TV4.",
+"Completed OK", "Erfolgreich abgeschlossen",
+"Compress EPG database", "Komprimiere EPG Datenbank",
+"Compress the EPG database to reduce disk I/O and space.", "Komprimiere die EPG Datenbank um Festplattenzugriffe und Speicherplatz zu sparen.",
+"Conditional access client", "Conditional Access Client",
+"Configuration", "Konfiguration",
+"Configuration ID", "Konfiguration ID",
+"Configuration name", "Konfigurationsname",
+"Configuration version", "Konfigurationsversion",
+"Connection limit type", "Art des Verbindungslimits",
+"Container to use for the transcoded stream.", "Zu nutzender Container für den transkodierten Stream.",
+"Content character set", "Inhalte Zeichensatz",
+"Content type", "Inhaltsart",
+"Content type.", "Inhaltsart.",
+"Contest", "Wettkampf",
+"Continue even if descrambling fails", "Auch wenn Entschlüsselung fehlschlägt fortfahren",
+"Continue recording for x minutes after scheduled stop time", "Aufnahme nach der geplanten Stop Zeit für x Minuten fortsetzen.",
+"Continue recording for x minutes after scheduled stop time.", "Aufnahme nach der geplanten Stop Zeit für x Minuten fortsetzen.",
+"Cookie expiration (days)", "Cookieablauf (Tage)",
+"Cooking", "Kochen",
+"Copy codec type", "Codectyp kopieren",
+"Copy layout", "Layout kopieren",
+"Create SDTV/HDTV/Radio tags.", "SDTV/HDTV/Radio Tags anlegen.",
+"Create a directory per channel when storing recordings. If both this and the 'directory per day' checkbox is enabled, the date-directory will be the parent of the per-channel directory.", "Erstelle ein Verzeichnis pro Kanal beim Speichern von Aufnahmen. Wenn diese und \"Verzeichnis pro Tag\" beide aktiviert sind, wird das Datumsverzeichnis oberhalb des Kanalverzeichnisses erstellt.",
+"Create a directory per title when storing recordings. If the day/channel directory checkboxes are also enabled, those directories will be parents of this directory.", "Erstelle ein Verzeichnis pro Titel beim Speichern von Aufnahmen. Wenn auch Datum-/Kanalverzeichnisse aktiviert sind, werden die Verzeichnisse oberhalb von diesem sein.",
+"Create a new directory per day in the recording system path. Folders will only be created when something is recorded. The format of the directory will be ISO standard YYYY-MM-DD.", "Erstelle ein neues Verzeichnis pro Tag im Aufnahmensystempfad. Ordner werden nur erstellt wenn etwas aufgenommen wird. Das Format des Verzeichnisses ist der ISO Standard JJJJ-MM-DD.",
+"Create a provider name tag.", "Anbietername-Tags anlegen.",
+"Create and associate a network tag to created channels.", "Ein Netzwerk-Tag anlegen und den erstellten Kanälen zuordnen.",
+"Create and associate a provider tag to created channels.", "Anbieter-Tag anlegen und den erstellten Kanälen zuordnen.",
+"Create bouquet", "Bouquet erstellen",
+"Create directories using these permissions.", "Erstelle Verzeichnisse mit diesen Berechtigungen.",
+"Create files using these permissions.", "Erstelle Dateien mit diesen Berechtigungen.",
+"Create network name tags", "Netzwerknamen-Tags anlegen",
+"Create network name tags (set by provider).", "Erstelle Netzwerknamen-Tags (vom Anbieter gesetzt).",
+"Create network tags", "Netzwerk-Tags anlegen",
+"Create provider name tags", "Anbietername-Tags anlegen",
+"Create provider tags", "Anbieter-Tags anlegen",
+"Create tags in recordings using media containers that support metadata (if possible).", "Erstelle Tags in Aufnahmen unter Nutzung von Mediencontainern die Metadaten unterstützen (wenn möglich).",
+"Create type based tags", "Typbasierte Tags anlegen",
+"Created", "Erstellt",
+"Creator", "Ersteller",
+"Cron multi-line", "Cron mehrzeilig",
+"Culture (without music)", "Kultur (ohne Musik)",
+"Current RTSP port.", "Aktueller RTSP Port.",
+"Current affairs", "Zeitgeschehen",
+"Current tuner configuration.", "Tuner Konfiguration",
+"Custom HTTP headers", "Benutzerdefinierte HTTP Header",
+"DAB multiplex", "DAB Multiplex",
+"DAB network", "DAB Netzwerk",
+"DBus - use the session message bus instead of the system one", "DBus - Benutzen des Session- anstatt des System-Bus",
+"DES constant code word client", "DES Constant Code Word Client",
+"DES key", "DES Schlüssel",
+"DSCP/TOS for streaming", "DSCP/TOS für Streaming",
+"DVB multiplex", "DVB Multiplex",
+"DVB scan files", "DVB Scandateien",
+"DVB scan files path", "DVB Scandateien Pfad",
+"DVB-C multiplex", "DVB-C Multiplex",
+"DVB-C network", "DVB-C Netzwerk",
+"DVB-S 4-port", "DVB-S 4-Port",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, experimentell)",
+"DVB-S advanced", "DVB-S erweitert",
+"DVB-S multiplex", "DVB-S Multiplex",
+"DVB-S network", "DVB-S Netzwerk",
+"DVB-S satellite configuration", "DVB-S Satellitenkonfiguration",
+"DVB-S simple", "DVB-S einfach",
+"DVB-S tone burst", "DVB-S Toneburst",
+"DVB-T multiplex", "DVB-T Multiplex",
+"DVB-T network", "DVB-T Netzwerk",
+"DVR Auto-record entry", "DVR Auto-Aufnahmeeintrag",
+"DVR behavior", "DVR Verhalten",
+"DVR configuration", "DVR Konfiguration",
+"DVR configuration profile", "DVR Konfigurationsprofil",
+"DVR configuration profiles", "DVR Konfigurationsprofile",
+"DVR entry not found", "DVR Eintrag nicht gefunden",
+"DVR file retention period", "DVR Datei Speicherzeit",
+"DVR log retention", "DVR Log Aufbewahrung",
+"DVR log retention period", "DVR Log Speicherzeit",
+"DVR override: high", "DVR Überschreibung Hoch",
+"DVR override: important", "DVR Überschreibung Wichtig",
+"DVR override: low", "DVR Überschreibung Niedrig",
+"DVR override: normal", "DVR Überschreibung Normal",
+"DVR override: unimportant", "DVR Überschreibung Unwichtig",
+"DVR profile to use/used for the recording.", "DVR Profil, das für die Aufnahme genutzt wird/wurde.",
+"DVR schedule does not exist", "DVR Planung existiert nicht.",
+"DVR schedule does not have a file yet", "DVR Planung hat noch keine Datei.",
+"DVR schedule not found", "DVR Planung nicht gefunden",
+"DVR time record entry", "DVR Zeitaufnahmeeintrag",
+"Dance", "Tanz",
+"Data errors", "Datenfehler",
+"Data path (if applicable).", "Datenpfad (wenn anwendbar).",
+"Date the EPG data was last updated (not set for OTA grabbers).", "Datum, wenn die EPG Daten das letzte mal aktualisiert wurden (wird nicht für OTA Grabber gesetzt).",
+"Days of Week", "Wochentage",
+"Days of the week to which the rule should apply.", "Wochentage an welchen die Regel wirken soll.",
+"Days of week", "Wochentage",
+"Debate", "Debatte",
+"Debug libav log", "Debug libav-Log",
+"Debug log path", "Debuglog Pfad",
+"Debug options", "Debug-Optionen",
+"Debug subsystems", "Debugsubsysteme",
+"Debug to syslog", "Debug nach Syslog",
+"Debug trace (low-level)", "Debug Trace (systemnah)",
+"Default", "Standard",
+"Default language(s)", "Standardsprache(n)",
+"Default language.", "Standardsprache.",
+"Default priority", "Standardpriorität",
+"Default user interface level.", "Standard Benutzeroberflächenebene.",
+"Delivery system", "Übertragungssystem",
+"Demux path", "Demux Pfad",
+"Descramble services (limit per mux)", "Entschlüssle Services (Limit pro Mux)",
+"Descrambler buffer (TS packets)", "Entschlüsselungspuffer (TS Pakete)",
+"Description", "Beschreibung",
+"Detective", "Krimi",
+"Device ID", "Geräte-ID",
+"Device model", "Gerätemodell",
+"Device path", "Gerätepfad",
+"Directory", "Verzeichnis",
+"Directory permissions (octal, e.g. 0775)", "Verzeichnisrechte (oktal, z.B. 0775)",
+"Disable", "Deaktivieren",
+"Disable DVB bouquets", "DVB-Bouquets deaktivieren",
+"Disable SAT>IP client", "Deaktiviere SAT>IP client",
+"Disable all access control checks", "All Zugangsprüfungen deaktivieren",
+"Disable debug on stderr", "Debug auf stderr deaktivieren",
+"Disable device/firmware-specific workarounds", "Geräte-/Firmware-spezifische Umgehungslösungen deaktivieren",
+"Disable syslog (all messages)", "Syslog deaktivieren (alle Meldungen)",
+"Disabled", "Deaktiviert",
+"Discover more muxes using the Network Information Table (if available).", "Suche weitere Muxe unter Nutzung der Network Information Table (wenn verfügbar).",
+"Discussion", "Diskussion",
+"DiseqC repeats", "DiseqC Wiederholungen",
+"DiseqC rotor", "DiseqC Rotor",
+"DiseqC switch", "DiseqC Switch",
+"Do not send any stream specific information to the HTSP client like signal strength, input source etc.", "Sende keine streamspezifischen Informationen zum HTSP Client, wie Signalstärke, Eingangsquelle etc.",
+"Do not use", "Nicht benutzen",
+"Documentary", "Dokumentation",
+"Don't backup configuration tree at upgrade", "Konfigurationsbaum beim Upgrade nicht sichern",
+"Don't include the title in the filename.", "Titel nicht in den Dateinamen einfügen.",
+"Don't include title in filename", "Titel nicht in den Dateinamen einfügen",
+"Don't keep", "Nicht behalten",
+"Don't re-record", "Nicht neu aufnehmen",
+"Don't re-record if recording fails.", "Nicht Neuaufnehmen, wenn die Aufnahme fehlschlägt.",
+"Don't re-schedule if recording fails.", "Nicht Neuplanen, wenn die Aufnahme fehlschlägt.",
+"Don't reschedule", "Nicht neu ansetzen",
+"Duplicate handling", "Dublettenbehandlung",
+"Duplicate recording handling.", "Dublettenaufnahmebehandlung.",
+"EIT - skip TSID check", "EIT - überspringe TSID Überprüfung",
+"EIT time offset", "EIT Zeitversatz",
+"EPG Language (priority order)", "EPG Sprache (nach Priorität)",
+"EPG data ID.", "EPG Daten ID",
+"EPG grabber", "EPG-Grabber",
+"EPG grabber channel", "EPG-Grabber-Kanal",
+"EPG grabber configuration", "EPG-Grabber Konfiguration",
+"EPG name", "EPG-Name",
+"EPG scan", "EPG-Abfrage",
+"EPG scan timeout in seconds (30-7200)", "EPG Abfragezeitüberschreitung in Sekunden (30-7200)",
+"EPG source", "EPG-Quelle",
+"EPG source. Name of the module, grabber or channel that should be used to update this channels EPG info.", "EPG Quelle. Benenne das Modul, den Grabber oder den Kanal der für das Aktualisieren der EPG Informationen des Kanals genutzt werden soll.",
+"EPG update window", "EPG Änderungszeitfenster",
+"Economics", "Wirtschaft",
+"Education", "Bildung",
+"Educational", "Lehrreich",
+"Elementary stream filter", "Streamkomponentenfilter",
+"Enable (auto)", "Aktivieren (auto)",
+"Enable DBus", "DBus aktivieren",
+"Enable NTP driver", "Aktiviere NTP-Treiber",
+"Enable coredumps for daemon", "Coredumps für Daemon aktivieren",
+"Enable debug on stderr", "Debug auf stderr aktivieren",
+"Enable debug subsystems", "Debug-Subsysteme aktivieren",
+"Enable debug to file", "Debug in Datei aktivieren",
+"Enable debug to syslog", "Debug nach Syslog aktivieren",
+"Enable or disable fast input switching.", "Aktiviere oder Deaktiviere schnellen Eingangswechsel.",
+"Enable or disable full mux mode.", "Full Mux Mode aktivieren oder deaktivieren.",
+"Enable or disable the mux.", "Aktiviere oder deaktiviere diesen Mux.",
+"Enable or disable this configuration.", "Diese Einstellungen aktivieren oder deaktivieren.",
+"Enable over-the-air program guide (EPG) scanning on this input device.", "Aktiviere over-the-air EPG Scan auf diesem Eingangsgerät.",
+"Enable syslog", "Syslog aktivieren",
+"Enable system time updates. This will only work if the user running Tvheadend has rights to update the system clock (normally only root).", "Aktiviere Aktualisierung der Systemzeit. Das funktioniert nur wenn der Nutzer unter dem Tvheadend läuft die Berechtigung zum aktualisieren der Systemzeit hat (normalerweise nur root)",
+"Enable this filter.", "Aktiviere den Filter.",
+"Enable trace subsystems", "Trace-Subsysteme aktivieren",
+"Enable web UI debug (non-minified JS)", "WebUI Debug aktivieren (nicht-minified JS)",
+"Enable/disable EPG data for the entry.", "Aktiviere/deaktiviere EPG Daten für diesen Eintrag.",
+"Enable/disable LNA.", "Aktiviere/deaktiviere LNA.",
+"Enable/disable auto-rec rule.", "Aktiviere/deaktiviere Auto-Aufnahme-Regel.",
+"Enable/disable debugging output to syslog.", "Aktiviere/deaktiviere Debugausgabe ins Syslog.",
+"Enable/disable libav log output.", "Aktiviere/deaktiviere libav Logausgabe.",
+"Enable/disable logging to syslog.", "Aktiviere/deaktiviere Protokollierung ins Syslog.",
+"Enable/disable pilot tone.", "Aktiviere/deaktiviere Pilotton.",
+"Enable/disable power save mode (if supported by the device).", "Aktiviere/deaktiviere Stromsparmodus (wenn vom Gerät unterstützt).",
+"Enable/disable profile.", "Aktiviere/deaktiviere Profil.",
+"Enable/disable the channel.", "Aktiviere/deaktiviere den Kanal.",
+"Enable/disable the device.", "Aktiviere/deaktiviere das Gerät.",
+"Enable/disable the entry.", "Aktiviere/deaktiviere den Eintrag.",
+"Enable/disable the grabber.", "Aktiviere/deaktiviere den Grabber.",
+"Enable/disable the profile.", "Aktiviere/deaktiviere das Profil.",
+"Enable/disable the tag.", "Aktiviere/deaktiviere den Tag.",
+"Enable/disable timeshift.", "Aktiviere/deaktiviere Timeshift.",
+"Enable/disable tuner/adapter.", "Aktiviere/deaktiviere den Tuner/Adapter.",
+"Enabled", "Aktiviert",
+"Encrypted", "Verschlüsselt",
+"Encrypted service", "Verschlüsselter Service",
+"Enter a non-admin user password.", "Gib ein Nicht-Admin Benutzerpasswort ein.",
+"Enter a non-admin user username.", "Gib einen Nicht-Admin Benutzernamen ein.",
+"Enter allowed network prefix(es). You can enter a comma-seperated list of prefixes here.", "Gib die erlaubten Netzwerkprefixe ein. Sie können hier eine kommagetrennte Liste von Prefixen eingeben. ",
+"Enter an administrator password.", "Gib ein Administratorpasswort ein.",
+"Enter an administrator username. Note: do not use the same username as the superuser backdoor account.", "Gib einen Administratorbenutzernamen ein. Hinweis: Benutze nicht den gleichen Benutzernamen wie beim Superbenutzer-Hintertür-Konto. ",
+"Enter external IP if behind Network address translation (NAT).", "Externe IP, wenn hinter Network Address Translation (NAT)",
+"Entertainment programs for 10 to 16", "Unterhaltungsprogramme für 10 bis 16",
+"Entertainment programs for 6 to 14", "Unterhaltungsprogramme für 6 bis 14",
+"Environment", "Umwelt",
+"Environment (pipe)", "Umgebungsvariablen (pipe)",
+"Episode number/ID.", "Episodennummer/ID.",
+"Error code", "Fehlercode",
+"Errors", "Fehler",
+"Even key", "Gerader Schlüssel",
+"Event does not exist", "Ereignis existiert nicht.",
+"Every day", "Jeden Tag",
+"Exclude channel tags", "Kanal-Tags ausschließen",
+"Expeditions", "Expeditionen",
+"Experimental film", "Experimenteller Film",
+"Expert", "Experte",
+"Exported tuners", "Exportierte Tuner",
+"External", "Extern",
+"External EPG grabber", "Externer EPG-Grabber",
+"External IP (NAT)", "Externe IP (NAT)",
+"External URL", "Externe URL",
+"External URL of the bouquet.", "Externe URL des Bouquets.",
+"Extra arguments", "Extra Parameter",
+"Extra start time", "Extra Startzeit",
+"Extra stop time", "Extra Endzeit",
+"Extra warming up time (seconds)", "Extra Aufwärmzeit (Sekunden)",
+"FAIL", "FEHLER",
+"FEC high", "FEC Hoch",
+"FEC low", "FEC Niedrig",
+"Factual topics", "Sachliche Themen",
+"Failed", "Fehlgeschlagen",
+"Failed DVR", "Fehlgeschlagene Aufnahmen",
+"Fast input switch", "Schneller Eingangswechsel",
+"File missing", "Datei fehlt",
+"File not created", "Datei nicht erstellt",
+"File permissions (octal, e.g. 0664)", "Dateirechte (oktal, z.B. 0664)",
+"File size", "Dateigröße",
+"Filename", "Dateiname",
+"Filename character set", "Dateiname Zeichensatz",
+"Filename options", "Dateiname Optionen",
+"Fine arts", "Bildende Kunst",
+"Finished", "Abgeschlossen",
+"Fitness and health", "Fitness und Gesundheit",
+"Folk", "Leute",
+"Folkloric", "Folkloristisch",
+"Force (auto)", "Erzwingen (auto)",
+"Force CA ID (e.g. 0x2600)", "Erzwungene CA ID (z.B. 0x2600)",
+"Force all network connections to this tuner to be made over the specified IP address, similar to the setting for the SAT>IP device itself. Setting this overrides the device-specific setting.", "Erzwinge, dass alle Netzwerkverbindungen zu diesem Tuner über eine bestimmte IP-Adresse aufgebaut werden, ähnlich der Einstellung für das SAT>IP Gerät selbst. Diese Einstellung überschreibt die gerätespezifische Einstellung.",
+"Force an initial EPG grab at start-up.", "Erzwinge eine initiale EPG-Suche beim Start.",
+"Force initial EPG grab at start-up", "Erzwinge initiale EPG-Suche beim Start",
+"Force old status", "Alten Status erzwingen",
+"Force pilot for DVB-S2", "Erzwinge Pilot für DVB-S2",
+"Force priority", "Priorität erzwingen",
+"Force teardown delay", "Erzwinge Abbauverzögerung",
+"Foreign countries", "Fremde Länder",
+"Forever", "Ewig",
+"Fork and run as daemon", "Als Hintergrundprozess ausführen",
+"Format string", "Formatzeichenkette",
+"Found muxes", "Muxe gefunden",
+"Found services", "Services gefunden",
+"Frequency", "Frequenz",
+"Frequency (Hz)", "Frequenz (Hz)",
+"Frequency (MHz)", "Frequenz (MHz)",
+"Frequency (in MHz).", "Frequenz (in MHz)",
+"Frequency (kHz)", "Frequenz (kHz)",
+"Fri", "Fr",
+"Friendly name", "Benutzer-lesbarer Name",
+"Frontend number", "Frontend-Nummer",
+"Frontend path", "Frontend-Pfad",
+"Full DiseqC", "Volles DiseqC",
+"Full mux RX mode supported", "Full Mux Rx mode unterstützt",
+"Full pathname specification", "Volle Pfadnamenspezifikation",
+"Full-text", "Volltext",
+"Further education", "Weiterbildung",
+"GOTOX", "GotoX",
+"GOTOX position", "GotoX Position",
+"GOTOX rotor", "GotoX Rotor",
+"Game show", "Spielshow",
+"Gardening", "Gartenarbeit",
+"General", "Allgemein",
+"General configuration", "Allgemeine Konfiguration",
+"Generic", "Allgemein",
+"Generic options", "Allgemeine Optionen",
+"Guard interval", "Guard Interval",
+"HD: high definition", "HD: Hohe Auflösung",
+"HDHomeRun ATSC-C frontend", "HDHomeRun ATSC-C Frontend",
+"HDHomeRun ATSC-T frontend", "HDHomeRun ATSC-T Frontend",
+"HDHomeRun DVB frontend", "HDHomeRun DVB Frontend",
+"HDHomeRun DVB-C frontend", "HDHomeRun DVB-C Frontend",
+"HDHomeRun DVB-T frontend", "HDHomeRun DVB-T Frontend",
+"HTSP Default Stream Settings", "HTSP Standard Streameinstellungen",
+"HTSP stream profile", "HTSP Streamprofil",
+"HTSP streaming", "HTSP Streaming",
+"HTTP CORS origin", "HTTP CORS Origin",
+"Handicraft", "Handwerk",
+"Hearing impaired", "Hörgeschädigt",
+"Hierarchy", "Hierarchie",
+"High", "Hoch",
+"High bitrate mode (CI+ CAMs only)", "Hohe Bitrate Modus (CI+ CAMs Only)",
+"Highest channel number the user can access.", "Höchst mögliche Kanalnummer auf welche ein Benutzer zugreifen kann",
+"Historical movie", "Historischer Film",
+"How frequently it will re-try fetching an image that has failed to be fetched.", "Anzahl der Versuche ein Bild zu laden welche sich geladen werden konnte",
+"How frequently the upstream provider is checked for changes.", "Wie oft der Upstream-Provider auf Änderungen überprüft wird.",
+"ID of the network.", "ID des Netzwerks",
+"IDLE", "INAKTIV",
+"IP address", "IP-Adresse",
+"IP blocking", "IP-Sperre",
+"IPTV Multiplex", "IPTV-Multiplex",
+"IPTV automatic network", "IPTV Automatisches Netzwerk",
+"IPTV input", "IPTV-Input",
+"IPTV network", "IPTV-Netzwerk",
+"ISDB-C multiplex", "ISDB-C Multiplex",
+"ISDB-C network", "ISDB-C Netzwerk",
+"ISDB-S multiplex", "ISDB-S Multiplex",
+"ISDB-S network", "ISDB-S Netzwerk",
+"ISDB-T multiplex", "ISDB-T Multiplex",
+"ISDB-T network", "ISDB-T Netzwerk",
+"Icon", "Logo",
+"Icon (full URL)", "Logo (komplette URL)",
+"Icon URL", "Logo-URL",
+"Icon base URL", "Logo-Basis-URL",
+"Icon has title", "Logo hat Titel",
+"Icons from", "Logos von",
+"Idle", "Leerlauf",
+"Idle scan", "Leerlaufsuche",
+"Idle scan muxes", "Mux Leerlaufsuche",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Erstellen eines Kontos ohne Benutzername\nund Passwort, wenn kein Benutzerkonto existiert.\nBeachten Sie, dass es weltweiten administrativen\nZugriff zu Ihrer Tvheadend Installation erlaubt, bis\nSie die Zugangskontrolle in der Tvheadend Weboberfläche \nanpassen.",
+"If you'd like to support the project, please consider a donation.", "Wenn Sie das Projekt unterstützen möchten, erwägen Sie bitte eine Spende.",
+"Ignore EPG (EIT)", "EPG (EIT) ignorieren",
+"Ignore descriptor 5", "Deskriptor 5 ignorieren",
+"Ignore invalid SSL certificate", "Ungültiges SSL-Zertifikat ignorieren",
+"Ignore provider's channel numbers", "Kanalnummern des Anbieters ignorieren",
+"Image cache", "Bild-Cache",
+"Immediately abort", "Direkt abbrechen",
+"Important", "Wichtig",
+"Include channel name in filename", "Kanalname in Dateiname einfügen",
+"Include date in filename", "Datum in Dateiname einfügen",
+"Include episode in filename", "Episode in Dateiname einfügen",
+"Include subtitle in filename", "Untertitel in Dateiname einfügen",
+"Include time in filename", "Zeit in Dateiname einfügen",
+"Information area", "Informationsbereich",
+"Informational", "Informativ",
+"Initial scan", "Initiale Suche",
+"Input base", "Input Basis",
+"Input buffer (bytes)", "Input-Puffer (Byte)",
+"Input instance", "Eingangsinstanz",
+"Input path", "Eingangspfad",
+"Interface", "Schnittstelle",
+"Internal", "Intern",
+"Internal EPG grabber", "Interner EPG-Grabber",
+"Internal error", "Interner Fehler",
+"Internal grabber", "Interner Grabber",
+"Invalid", "Ungültig",
+"Invalid adapter number '%s'\n", "Ungültige Adapternummer '%s'\n",
+"Invalid arguments", "Ungültige Argumente",
+"Invalid file", "Ungültige Datei",
+"Invalid parameters", "Ungültige Parameter",
+"Invalid target", "Ungültiges Ziel",
+"Keep", "Beibehalten",
+"Keep x amount of storage space free.", "Halte x Menge des Speicherplatzes frei.",
+"LNA (low noise amplifier)", "LNA (Low Noise Amplifier)",
+"LNB type", "LNB Typ",
+"Language", "Sprache",
+"Language 1", "Sprache 1",
+"Language 2", "Sprache 2",
+"Language 3", "Sprache 3",
+"Language settings", "Spracheinstellungen",
+"Languages", "Sprachen",
+"Last seen", "Zuletzt gefunden",
+"Last updated from", "Zuletzt aktualisiert durch",
+"Leisure hobbies", "Freizeitbeschäftigungen",
+"Limit connections", "Verbindungsbegrenzung",
+"Linked input", "Verknüpfter Input",
+"Linux ATSC-C frontend", "Linux ATSC-C Frontend",
+"Linux ATSC-T frontend", "Linux ATSC-T Frontend",
+"Linux DAB frontend", "Linux DAB Frontend",
+"Linux DVB frontend", "Linux DVB Frontend",
+"Linux DVB-C frontend", "Linux DVB-C Frontend",
+"Linux DVB-S frontend", "Linux DVB-S Frontend",
+"Linux DVB-S slave frontend", "Linux DVB-S Slave Frontend",
+"Linux DVB-T frontend", "Linux DVB-T Frontend",
+"Linux ISDB-C frontend", "Linux ISDB-C Frontend",
+"Linux ISDB-S frontend", "Linux ISDB-S Frontend",
+"Linux ISDB-T frontend", "Linux ISDB-T Frontend",
+"LinuxDVB adapter", "LinuxDVB Adapter",
+"LinuxDVB network", "LinuxDVB Netzwerk",
+"List of allowed IPv4 or IPv6 hosts or networks (comma-separated).", "Liste der erlaubten IPv4 oder IPv6 Hosts oder Netzwerke (kommagetrennt).",
+"Listen / Connect port", "Empfangs-/Verbindungsport",
+"Listen on IPv6", "Auf IPv6 hören",
+"Literature", "Literatur",
+"Local (server) time", "Lokale (Server-)Zeit",
+"Local bind IP address", "IP-Adresse für lokale Bindung",
+"Local channel minor", "Lokale untergeordnete Kanalnummer",
+"Local channel number", "Lokale Kanalnummer",
+"Local discovery IP address", "IP-Adresse für lokale Suche",
+"Local: Record if different description", "Lokal: Aufnehmen, wenn abweichende Beschreibung",
+"Local: Record if different episode number", "Lokal: Aufnehmen, wenn abweichende Episiodennummer",
+"Local: Record if different subtitle", "Lokal: Aufnehmen, wenn abweichender Untertitel",
+"Local: Record if different title", "Lokal: Aufnehmen, wenn abweichender Titel",
+"Local: Record once per day", "Lokal: Einmal pro Tag aufnehmen ",
+"Local: Record once per week", "Lokal: Einmal pro Woche aufnehmen",
+"Location", "Ort",
+"Location details of the SAT>IP Server.", "Standortdetails des SAT>IP Servers.",
+"Lock preferred CA PID", "Bevorzugte CA PID verriegeln",
+"Login/Logout", "An-/Abmelden",
+"Low", "Niedrig",
+"MPEG-TS Pass-thru", "MPEG-TS Durchreichen",
+"MPEG-TS Pass-thru/built-in", "MPEG-TS Durchreichen/eingebaut",
+"MPEG-TS input", "MPEG-TS-Input",
+"MPEG-TS multiplex", "MPEG-TS Multiplex",
+"MPEG-TS multiplex PHY", "MPEG-TS Multiplex PHY",
+"MPEG-TS network", "MPEG-TS Netzwerk",
+"MPEG-TS raw service", "MPEG-TS Unbearbeiteter Service",
+"MPEG-TS service", "MPEG-TS Service",
+"Magazines", "Magazine",
+"Maintain free storage space in MiB", "Verwalte freien Speicher in MiB",
+"Maintain used storage space in MiB (0=disabled)", "Verwalte genutzten Speicher in MiB (0=deaktiviert)",
+"Maintained space", "Verwalteter Speicher",
+"Make subdirectories per channel", "Erstelle Unterverzeichnisse je Kanal",
+"Make subdirectories per day", "Erstelle Unterverzeichnisse je Tag",
+"Make subdirectories per title", "Erstelle Unterverzeichnisse je Titel",
+"Manufacturer", "Hersteller",
+"Manufacturer URL", "Hersteller URL",
+"Manufacturer's model number.", "Hersteller Modellnummer",
+"Manufacturer's product description.", "Hersteller Produktbeschreibung",
+"Manufacturer's product information page for the device.", "Hersteller Produktinformationsseite für das Gerät",
+"Manufacturer's product name.", "Herstellter Produktname",
+"Map all services", "Alle Services zuordnen",
+"Map encrypted services", "Verschlüsselte Services einschließen",
+"Map radio channels", "Radiokanäle zuordnen",
+"Map unnamed channels", "Kanäle ohne Namen zuordnen",
+"Map zero-numbered channels", "Null-genummerte Kanäle zuordnen",
+"Master tuner", "Haupttuner",
+"Matroska (mkv)/built-in", "Matroska (mkv)/eingebaut",
+"Matroska specific", "Matroskaspezifisch",
+"Maximal channel number", "Maximale Kanalnummer",
+"Maximum # input streams", "Maximale # von Input-Streams",
+"Maximum PIDs", "Maximale PIDs",
+"Maximum RAM size (MB)", "Maximale RAM Größe (MB)",
+"Maximum bandwidth (Kbps)", "Maximale Bandbreite (Kb/s)",
+"Maximum count (0=default)", "Maximale Anzahl (0=Standard)",
+"Maximum duration", "Maximale Länge",
+"Maximum length of PIDs", "Maximale Länge von PIDs",
+"Maximum period (mins)", "Maximaler Zeitraum (Min.)",
+"Maximum schedules limit (0=default)", "Maximale Pläne (0=Standard)",
+"Maximum size (MB)", "Maximale Größe (MB)",
+"Maximum timeout (seconds)", "Maximale Zeitüberschreitung (Sekunden)",
+"Medicine", "Medizin",
+"Melodrama", "Melodram",
+"Merge same name", "Gleiche Namen zusammenführen",
+"Method not found", "Methode nicht gefunden",
+"Minimal channel number", "Minimale Kanalnummer",
+"Minimum duration", "Minimale Länge",
+"Minimum rotor time (seconds)", "Minimale Rotor Zeit (Sekunden)",
+"Missing In PAT/SDT", "Fehlt in PAT/SDT",
+"Mode", "Modus",
+"Model description", "Modellbeschreibung",
+"Model name", "Modellname",
+"Model number", "Modellnummer",
+"Module", "Modul",
+"Module ID", "Modul ID",
+"Mon", "Mo",
+"More verbose libav log", "Ausführlicheres libav-Log",
+"Motor rate (milliseconds/deg)", "Motor Rate (Millisekunden/Grad)",
+"Motor sport", "Motorsport",
+"Motoring", "Autofahren",
+"Movie", "Film",
+"Music", "Musik",
+"Mux handling", "Muxbehandlung",
+"Mux name", "Mux-Name",
+"Mux not enabled", "Mux nicht aktiviert",
+"Mux schedule entry", "Mux Plan Eintrag",
+"NONE", "Kein",
+"Name of the entry.", "Name des Eintrags.",
+"Name of the module used to grab EPG data.", "Name des Moduls welches für das holen der EPG Daten verwendet wird.",
+"Name of the network.", "Name des Netzwerks.",
+"Name of the profile.", "Name des Profils.",
+"Name of the tag.", "Name des Tags.",
+"Name of the tuner.", "Name des Tuners.",
+"Name of the tuner/adapter.", "Name des Tuners/Adapters.",
+"Names", "Namen",
+"Natural sciences", "Naturwissenschaften",
+"Nature", "Natur",
+"Network", "Netzwerk",
+"Network ", "Netzwerk",
+"Network A", "Netzwerk A",
+"Network B", "Netzwerk B",
+"Network ID (limit scanning)", "Netzwerk-ID (Suchbeschränkung)",
+"Network UUID", "Netzwerk UUID",
+"Network access", "Netzwerkzugang",
+"Network discovery", "Netzwerksuche",
+"Network for port A.", "Netzwerk auf Port A.",
+"Network for port AA.", "Netzwerk auf Port AA.",
+"Network for port AB.", "Netzwerk auf Port AB.",
+"Network for port B.", "Netzwerk auf Port B.",
+"Network for port BA.", "Netzwerk auf Port BA.",
+"Network for port BB.", "Netzwerk auf Port BB.",
+"Network name", "Netzwerkname",
+"Network prefix", "Netzwerkpräfix",
+"Network settings", "Netzwerkeinstellungen",
+"Network type", "Netzwerktyp",
+"Networks", "Netzwerke",
+"New / premiere / unknown", "Neu / Premiere / Unbekannt",
+"News", "Nachrichten",
+"News magazine", "Nachrichtenmagazin",
+"Next tune delay in ms (0-2000)", "Nächste Tuneverzögerung in ms (0-2000)",
+"No", "Nein",
+"No PIN", "Keine PIN",
+"No access", "Kein Zugriff",
+"No adapters specified!\n", "Keine Adapter spezifiziert!\n",
+"No assigned adapters", "Kein zugeordneter Adapter",
+"No days", "Kein Tag",
+"No descrambler", "Kein Descrambler",
+"No free adapter", "Kein freier Adapter",
+"No input detected", "Keine Daten erkannt",
+"No scheme", "Kein Schema",
+"No service assigned to channel", "Dem Kanal ist kein Service zugeordnet",
+"No service enabled", "Kein Service aktiviert",
+"No source available", "Keine Quelle verfügbar",
+"None", "Keine",
+"Not enough memory", "Nicht genug Speicher",
+"Not linked", "Nicht verbunden",
+"Not set", "Nicht gesetzt",
+"Not set (none or channel configuration)", "Nicht gesetzt (keine oder Kanalkonfiguration)",
+"Not set (use channel or DVR configuration)", "Nicht gesetzt (benutze Kanal- oder DVR-Konfiguration)",
+"Number", "Nummer",
+"Number of days to keep the file.", "Anzahl der Tage die Datei zu behalten.",
+"Number of days to keep the recorded file.", "Anzahl der Tage die aufgenommene Datei zu behalten.",
+"Number of days to keep the recorded files.", "Anzahl der Tage die aufgenommenen Dateien zu behalten.",
+"Number of days to retain entry information.", "Anzahl der Tage die Informationen zum Eintrag zu behalten.",
+"Number of days to retain infomation about recording.", "Anzahl der Tage die Informationen zur Aufnahme zu behalten.",
+"Number of days to retain infomation about recordings.", "Anzahl der Tage die Informationen zu Aufnahmen zu behalten.",
+"Number of errors that occurred during recording (Transport errors).", "Anzahl der Fehler, die bei der Aufnahme aufgetreten sind (Übertragungsfehler).",
+"Number of errors that occurred during recording.", "Anzahl der Fehler, die bei der Aufnahme aufgetreten sind.",
+"Number of muxes found.", "Anzahl der gefundenen Muxe.",
+"Number of seconds to wait before timing out.", "Sekunden",
+"Number of services.", "Anzahl der Services",
+"Number of tsfile tuners", "Anzahl von tsfile-Tuner",
+"OK (partial)", "OK (teilweise)",
+"Odd key", "Ungerader Schlüssel",
+"Off", "Aus",
+"Older OSCam", "Älteres OSCam",
+"On", "Ein",
+"On file removal", "Dateientfernung (Tage)",
+"On-demand (no first rewind)", "On-demand (kein sofortiges zurückspulen)",
+"Once per auto channel", "Einmal pro Auto-Kanal",
+"Only Bulsatcom 39E", "Nur Bulsatcom 39E",
+"Only EIT", "Nur EIT",
+"Only OpenTV Sky Ausat", "Nur OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Nur OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Nur OpenTV Sky UK",
+"Only PSIP (ATSC)", "Nur PSIP (ATSC)",
+"Only UK Freesat", "Nur UK Freesat",
+"Only UK Freeview", "Nur UK Freeview",
+"Only Viasat Baltic", "Nur Viasat Baltic",
+"Only preferred CA PID", "Nur bevorzugte CA PID",
+"Only use system RAM for timeshift buffers.", "Nutze nur System RAM für Timeshiftpuffer.",
+"OpenTV channel number", "OpenTV Kanalnummer",
+"Opera", "Oper",
+"Orbital position", "Orbitale Position",
+"Orbital positions", "Orbitale Positionen",
+"Orbital positions.", "Orbitale Positionen",
+"Original network ID", "Original Netzwerk ID",
+"Other stream filter", "Sonstiger Streamfilter",
+"Output directory for tsdebug", "Zielverzeichnis für tsdebug",
+"Over-the-air Cron multi-line", "Over-the-air Cron mehrzeilig",
+"Over-the-air EPG grabber", "Over-the-air EPG-Grabber",
+"Over-the-air grabbers", "Over-the-air Grabber",
+"Override disabled", "Überschreiben deaktiviert",
+"Owner", "Besitzer",
+"Owner of the entry.", "Eigentümer des Eintrags.",
+"Owner of the rule.", "Eigentümer der Regel.",
+"PEND", "AUSSTEHEND",
+"PIDs 21 in setup", "PIDs 21 im Setup",
+"PIDs in setup", "PIDs im Setup",
+"PIN inquiry match string", "PIN-Abfrage Suchstring",
+"PIN inquiry match string.", "PIN-Abfrage Suchstring.",
+"PLS code", "PLS Code",
+"PLS mode", "PLS Modus",
+"Parent entry", "Übergeordneter Eintrag",
+"Parent entry.", "Übergeordneter Eintrag.",
+"Pass subscription weight", "Abonnementgewicht durchreichen",
+"Password", "Passwort",
+"Password for the entry.", "Passwort für den Eintrag.",
+"Password2", "Passwort2",
+"Passwords", "Passwörter",
+"Path", "Pfad",
+"Performing arts", "Darstellende Künste",
+"Periodically save EPG to disk (hours)", "Speichere EPG periodisch auf Festplatte (Stunden)",
+"Persistent user interface level", "Ansichtmodus fixieren",
+"Physiology", "Physiologie",
+"Picon name scheme", "Picon Namensschema",
+"Picon path (see Help)", "Picon Pfad (siehe Hilfe)",
+"Polarization", "Polarisierung",
+"Political issues", "Politik",
+"Popular culture", "Popkultur",
+"Position of the input.", "Position der Eingabe.",
+"Post-processor command", "Kommando zur Nachbearbeitung",
+"Post-recording padding", "Nach-Aufname-Polster",
+"Post-remove command", "Kommando nach Entfernen",
+"Power save", "Energie sparen",
+"Power-up time (ms) (15-200)", "Hochfahrzeit (ms) (15-200)",
+"Pre-defined muxes", "Vordefinierte Muxe",
+"Pre-recording padding", "Vor-Aufname-Polster",
+"Pre-school children's programs", "Vorschulkinderprogramme",
+"Prefer picons over channel name", "Picons dem Kanalnamen vorziehen",
+"Preferred CA PID", "Bevorzugte CA PID",
+"Preferred service video type", "Bevorzugter Service-Videotyp",
+"Presentation", "Präsentation",
+"Presentation details.", "Präsentationsdetails.",
+"Press", "Presse",
+"Priority", "Priorität",
+"Priority (-10..10)", "Priorität (-10..10)",
+"Priority of the entry.", "Priorität des Eintrags.",
+"Priority of the recording.", "Priorität der Aufnahmen.",
+"Private", "Privat",
+"Profile name", "Profilname",
+"Provider", "Anbieter",
+"Provider ID", "Anbieter ID",
+"Provider network name", "Anbieter Netzwerkname",
+"Psychology", "Psychologie",
+"Puppets", "Marionetten",
+"RAM only", "Nur RAM",
+"RTSP port", "RTSP-Port",
+"RTSP port (554 or 9983, 0 = disable)", "RTSP Port (554 oder 9983, 0 = deaktiviert)",
+"Re-fetch period (hours)", "Abrufintervall (Stunden)",
+"Re-fetch period (mins)", "Abrufintervall (Minuten)",
+"Re-record%s%s", "Neu-Aufnahme%s%s",
+"Re-try period (hours)", "Wiederholungsintervall (Stunden)",
+"Read error", "Lesefehler",
+"Record all", "Alle aufnehmen",
+"Record on these days only.", "Nur an diesen Tagen aufnehmen.",
+"Recording file options", "Aufnahmedateioptionen",
+"Recording file size.", "Dateigröße der Aufnahme.",
+"Recording system path", "Aufnahmedateipfad",
+"Reject", "Ablehnen",
+"Relative path to the imagecache copy of the icon.", "Relativer Pfad zu der Kopie des Logos im Bildcache.",
+"Religious", "Religiös",
+"Remarkable people", "Bemerkenswerten Menschen",
+"Remove HTTP arguments", "Entferne HTTP-Argumente",
+"Remove all unsafe characters from filename", "Alle unsicheren Zeichen aus Dateiname entfernen",
+"Repeated", "Wiederholt",
+"Replace whitespace in title with '-'", "Leerzeichen im Titel durch '-' ersetzen",
+"Replaces all whitespace in the title with '-'.", "Ersetze alle Leerzeichen im Titel mit '-'.",
+"Reply to CAM PIN inquiries", "Auf CAM PIN-Abfragen antworten",
+"Reply to PIN inquiries.", "Auf PIN-Abfragen antworten.",
+"Reports", "Berichte",
+"Rerun of", "Wiederholung von",
+"Rescan", "Neue Suche",
+"Reserved", "Reserviert",
+"Resolution (height)", "Auflösung (Höhe)",
+"Respawn (pipe)", "Neustart (pipe)",
+"Restart on error", "Neustart nach Fehler",
+"Reuse EPG from", "Benutze EPG von",
+"Rewrite EIT", "EIT umschreiben",
+"Rewrite PAT", "PAT umschreiben",
+"Rewrite PMT", "PMT umschreiben",
+"Rewrite SDT", "SDT umschreiben",
+"Romance", "Romantik",
+"Rotor initialization time (seconds)", "Rotor Initialisierungszeit (Sekunden)",
+"Rotor type", "Rotor Typ",
+"Run as group", "Als Gruppe ausführen",
+"Run as user", "Als Benutzer ausführen",
+"Running", "Läuft",
+"SAT->IP frontend number.", "SAT>IP Frontend Nummer",
+"SAT>IP ATSC-C frontend", "SAT>IP ATSC-C Frontend",
+"SAT>IP ATSC-T frontend", "SAT>IP ATSC-T Frontend",
+"SAT>IP DVB frontend", "SAT>IP DVB Frontend",
+"SAT>IP DVB-C frontend", "SAT>IP DVB-C Frontend",
+"SAT>IP DVB-S frontend", "SAT>IP DVB-S Frontend",
+"SAT>IP DVB-S slave frontend", "SAT>IP DVB-S Slave Frontend",
+"SAT>IP DVB-T frequency (Hz)", "SAT>IP DVB-T Frequenz (Hz)",
+"SAT>IP DVB-T frontend", "SAT>IP DVB-T Frontend",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP Portnummer für den Server\n(Standard: -1 = deaktiviert, 0 = webconfig, Standardport ist 554)",
+"SAT>IP client", "SAT>IP Client",
+"SAT>IP server", "SAT>IP Server",
+"SAT>IP source number", "SAT>IP Quellennummer",
+"SD: standard definition", "SD: Standardauflösung",
+"SSL verify peer", "Überprüfe SSL-Peer",
+"Sat", "Sa",
+"Satellite config", "Satellitenkonfiguration",
+"Satellite longitude", "Satellit Longitude",
+"Satellite positions", "Satellitenpositionen",
+"Scan after creation", "Scan nach Erstellen",
+"Scan progress", "Fortschritt",
+"Scan queue length", "Suchwarteschlangenlänge",
+"Scan result", "Suchergebnis",
+"Scan status", "Suchstatus",
+"Schedule a re-recording if more errors than (0=off)", "Plane eine Neuaufnahme bei mehr Fehlern als (0=aus)",
+"Schedule status", "Programmierstatus",
+"Schedule status.", "Programmierstatus",
+"Scheduled for recording", "Für Aufnahme programmiert",
+"Scheduled start time", "Programmierte Startzeit",
+"Scheduled stop time", "Programmierte Stopzeit",
+"School programs", "Schulprogramme",
+"Science", "Wissenschaft",
+"Science fiction", "Science-Fiction",
+"Season", "Staffel",
+"Season %d", "Staffel %d",
+"Select services to map.", "Wähle Services zuordnen",
+"Send CAPMT query", "Sende CAPMT Anfrage",
+"Send full PLAY cmd", "Sende vollen PLAY Befehl",
+"Serial number", "Seriennummer",
+"Series link", "Serienverknüpfung",
+"Serious", "Seriös",
+"Serious music", "Ernste Musik",
+"Server connectivity", "Server Verbindung",
+"Server details.", "Serverdetails.",
+"Service ID", "Service-ID",
+"Service configuration", "Servicekonfiguration",
+"Service count %zi", "Anzahl Services %zi",
+"Service mapper", "Service Mapper",
+"Service name", "Servicename",
+"Service raw", "Unbearbeiteter Service",
+"Service type", "Servicetyp",
+"Set profile as default.", "Profil als Standard kennzeichnen",
+"Set the display name.", "Anzeigenamen festlegen",
+"Set the priority of this configuration.", "Setze die Priorität dieser Einstellungen.",
+"Settings", "Einstellungen",
+"Show this page", "Zeige diese Seite",
+"Show version information", "Versionsinformationen anzeigen",
+"Signal quality too poor", "Signalqualität zu schlecht",
+"Signal scale (240 or 100)", "Signalauflösung (240 oder 100)",
+"Site latitude", "Ort Latitude",
+"Site latitude.", "Ort Latitude.",
+"Site longitude", "Ort Longitude",
+"Site longitude.", "Ort Longitude.",
+"Skip TS packets (0-200)", "Überspringe TS Pakete (0-200)",
+"Skip commercials", "Überspringe Werbung",
+"Skip initial bytes", "Überspringe erste Daten",
+"Skip initial scan", "Überspringe initialen Scan",
+"Slave entry", "Slave Eintrag",
+"Slot state", "Slotstatus",
+"Soccer", "Fußball",
+"Social", "Sozial",
+"Social advisory", "Sozialberatung",
+"Sort index", "Sortier-Index",
+"Source", "Quelle",
+"Source deleted", "Quelle gelöscht",
+"Source quality is bad", "Quellenqualität ist schlecht",
+"Source reconfigured", "Quelle neu konfiguriert",
+"Southern hemisphere (latitude direction)", "Südliche Hemisphäre (Latitude Richtung)",
+"Southern hemisphere (latitude direction).", "Südliche Hemisphäre (Latitude Richtung)",
+"Special events (Olympic Games, World Cup, etc.)", "Spezielle Ereignisse (Olympische Spiele, Weltmeisterschaften, usw.)",
+"Specify User-Agent header for the http client", "Spezifiziere User-Agent Header für den HTTP Client",
+"Specify alternative htsp port", "Spezifiziere alternativen HTSP Port",
+"Specify alternative http port", "Spezifiziere alternativen HTTP Port",
+"Specify alternative http webroot", "Spezifiziere alternativen HTTP Webroot",
+"Specify bind address", "Spezifiziere Binde-Adresse",
+"Specify extra htsp port", "Spezifiziere extra HTSP Port",
+"Spiritual sciences", "Geisteswissenschaften",
+"Sports", "Sport",
+"Sports magazines", "Sportmagazine",
+"Start after", "Start nach",
+"Start before", "Start vor",
+"Start recording earlier than the defined start time by x minutes.", "Aufnahme x Minuten vor der festgelegten Startzeit beginnen",
+"Start time", "Start Zeit",
+"Status period (ms)", "Statuszeitraum (ms)",
+"Stop time", "Stop Zeit",
+"Storage path", "Speicherpfad",
+"Storage space", "Speicherplatz",
+"Stream index", "Streamindex",
+"Stream profile", "Streamprofil",
+"Stream type", "Streamyp",
+"Streaming priority", "Streamingpriorität",
+"Streaming profiles", "Streamingprofil",
+"Subdirectory options", "Unterverzeichnis Optionen",
+"Subscribe to a service permanently", "Abonniere einen Service permanent",
+"Subscription does not exist", "Abonnement existiert nicht",
+"Subscription overridden", "Abonnement überschrieben",
+"Subscription weight", "Abonnementgewicht",
+"Subtitle", "Untertitel",
+"Subtitle codec", "Untertitel-CODEC",
+"Subtitle stream filter", "Untertitel Streamfilter",
+"Sun", "So",
+"Surround (2 front, rear mono)", "Surround (2 vorne, hinten Mono)",
+"Switch before rotor", "Switch dann Rotor",
+"Switch type", "Switch Typ",
+"Symbol rate (Sym/s)", "Symbol Rate (Sym/s)",
+"Sync + Don't keep", "Sync + Nicht behalten",
+"Tag files with metadata", "Dateien mit Metadaten taggen",
+"Talk show", "Talk-Show",
+"Team sports (excluding football)", "Mannschaftssport  (außer Football)",
+"Technology", "Technologie",
+"Teletext stream filter", "Videotext Streamfilter",
+"Teletext stream type is only available for this filter.", "Teletext Stream Typ ist nur für diesen Filter verfügbar.",
+"Testing", "Testen",
+"Testing options", "Teste Optionen",
+"The EPG grabber name.", "EPG-Grabbername",
+"The EPG grabber type.", "EPG-Grabber Typ",
+"The PIN to use.", "Zu benutzender PIN",
+"The SAT>IP server's name.", "Der SAT>IP Servername.",
+"The SAT>IP source number.", "Die SAT>IP Quellennummer",
+"The SAT>IP's discovered IP address.", "SAT>IP entdeckte IP-Adresse.",
+"The device ID.", "Geräte-ID",
+"The device's serial number.", "Die Geräte Seriennummer.",
+"The number of ATSC-C (Cable/AnnexB) tuners to export.", "Die Anzahl zu exportierender ATSC-C (Kabel/AnnexB) Tuner.",
+"The number of ATSC-T (Terresterial) tuners to export.", "Die Anzahl zu exportierender ATSC-T (Terrestrisch) Tuner.",
+"The number of DVB-C (Cable) tuners to export.", "Die Anzahl zu exportierender DVB-C (Kabel) Tuner.",
+"The number of DVB-C2 (Cable) tuners to export.", "Die Anzahl zu exportierender DVB-C2 (Kabel) Tuner.",
+"The number of DVB-S (Satellite) tuners to export.", "Die Anzahl zu exportierender DVB-S (Satellit) Tuner.",
+"The number of DVB-S2 (Satellite) tuners to export.", "Die Anzahl zu exportierender DVB-S2 (Satellit) Tuner.",
+"The number of DVB-T (Terresterial) tuners to export.", "Die Anzahl zu exportierender DVB-T (Terrestrisch) Tuner.",
+"The number of DVB-T2 (Terresterial) tuners to export.", "Die Anzahl zu exportierender DVB-T2 (Terrestrisch) Tuner.",
+"The provider's name.", "Anbieter Name",
+"The provider's network ID.", "Anbieter Netzwerk ID",
+"The provider's network name.", "Anbieter Netzwerkname",
+"The stream ID used for the mux.", "Die für diesen Mux benutzte Stream-ID.",
+"The symbol rate used on the mux.", "Die für diesen Mux benutzte Symbolrate",
+"The symbol rate.", "Die Symbolrate",
+"The total number of services found on this mux.", "Die Anzahl der auf dem Mux gefundenen Services",
+"This tuner", "Dieser Tuner",
+"Thu", "Do",
+"Time", "Zeit",
+"Time missed", "Zeit verpasst",
+"Time record caption", "Zeitaufnahmebeschriftung",
+"Time recording%s%s", "Zeit Aufnahme%s%s",
+"Time update", "Zeitaktualisierung",
+"Timeout (sec) (0=infinite)", "Timeout (Sek) (0=unendlich)",
+"Timeout (seconds)", "Timeout (Sekunden)",
+"Timer-based automatic recording.", "Zeitbasierte automatische Aufnahme",
+"Timout (secs)", "Timeout (Sek)",
+"Title", "Titel",
+"Title (regexp)", "Titel (Regexp)",
+"Title of the recording.", "Titel der Aufnahme",
+"Toggle details", "Details umschalten",
+"Tone burst", "Tonburst",
+"Total number of muxes found on this network.", "Anzahl der gefundenen Services auf diesem Netzwerk",
+"Total number of services found on this network.", "Anzahl der gefundenen Services auf diesem Netzwerk",
+"Total number of services found.", "Anzahl der gefundenen Services",
+"Tourism / Travel", "Tourismus / Reisen",
+"Trace subsystems", "Tracesubsysteme",
+"Traditional arts", "Traditionelle Kunst",
+"Traditional music", "Traditionelle Musik",
+"Transcode/av-lib", "Transkodierung/av-lib",
+"Transcoding", "Transkodierung",
+"Transmission mode", "Transmission Modus",
+"Transport stream ID", "Transport Stream-ID",
+"Tue", "Di",
+"Tune before DiseqC", "Tune vor DiseqC",
+"Tuner bind IP address", "Tuner Bind IP-Adresse",
+"Tuner configuration", "Tuner Konfiguration",
+"Tuner configuration.", "Tuner Konfiguration.",
+"Tuning failed", "Tuning fehlgeschlagen",
+"Turn off LNB when idle", "LNB abschalten, wenn ungenutzt",
+"Tvheadend server name", "Tvheadend Servername",
+"Type", "Typ",
+"UDP RTP port number (2 ports)", "UDP RTP Port Nummer (2 ports)",
+"URL of the M3U playlist.", "URL der M3U Playlist.",
+"URL with the SAT>IP server XML location", "URL der SAT>IP Server XML",
+"USALS rotor", "USALS Rotor",
+"Unable to get system UTC time", "Die UTC Systemzeit konnte nicht ermittelt werden",
+"Unable to get system local time", "Die lokale Systemzeit konnte nicht ermittelt werden",
+"Unable to get system time", "Die Systemzeit konnte nicht ermittelt werden",
+"Unable to open file", "Datei konnte nicht geöffnet werden",
+"Uncommitted first", "Uncommited zuerst",
+"Unicable switch (universal LNB, experimental)", "Unicable Switch (Universal LNB, experimentell)",
+"Unicable type", "Unicable Typ",
+"Unimportant", "Unwichtig",
+"Universal LNB only", "Nur Universal LNB",
+"Unknown", "Unbekannt",
+"Unknown file", "Unbekannte Datei",
+"Unknown reason (%i)", "Unbekannter Grund (%i)",
+"Unlimited size", "Unbegrenzte Größe",
+"Unlimited time", "Unbegrenzte Zeit",
+"Unset (default)", "Zurücksetzen (Standard)",
+"Update card (EMM)", "Karte aktualisieren (EMM)",
+"Update channel icon", "Aktualisiere Kanallogo",
+"Update channel name", "Aktualisiere Kanalname",
+"Update channel number", "Aktualisiere Kanalnummer",
+"Update disabled", "Aktualisierung deaktiviert",
+"Update time", "Aktualisiere Zeit",
+"Update tolerance (ms)", "Updatetoleranz (ms)",
+"Updated", "Aktualisiert",
+"Usage: %s [OPTIONS]\n", "Benutzung: %s [OPTIONS]\n",
+"Use AC-3 detection on the mux.", "Benutze AC-3 Erkennung auf diesem Mux.",
+"Use EPG running state", "Benutze EPG Laufend Status",
+"Use Windows-compatible filenames", "Benutze Windows-kompatible Dateinamen",
+"Use XSPF playlist instead of M3U", "Benutze XSPF-Playliste statt M3U",
+"Use original", "Benutze Original",
+"Use service IDs as channel numbers", "Service-IDs als Kanalnummern",
+"User access error", "Benutzerzugriffsfehler",
+"User icon", "Benutzerlogo",
+"User interface level", "Ansichtmodus wählen",
+"User interface quick tips", "Benutzeroberfläche Quick Tips",
+"User language", "Benutzersprache",
+"User limit reached", "Benutzerlimit erreicht",
+"User login", "Benutzerlogin",
+"User request", "Benutzeranfrage",
+"Username", "Benutzername",
+"Variety show", "Varieteshow",
+"Video bitrate (kb/s) (0=auto)", "Video-Bitrate (kb/s) (0=Auto)",
+"Video codec", "Video-CODEC",
+"Video recorder", "Video Rekorder",
+"Video stream filter", "Video Streamfilter",
+"View all DVR entries", "Zeige alle DVR Einträge",
+"Visually impaired commentary/audio description", "Kommentar/Beschreibung für Sehbehinderte",
+"WEBM/built-in", "WEBM/eingebaut",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV Profil H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV Profil H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV Profil VP8/Vorbis/WEBM",
+"Waiting for EPG running flag", "Warte auf EPG Laufend Kennzeichen",
+"Waiting for program start", "Warte auf Sendungsstart",
+"Waiting for stream", "Warte auf Stream",
+"War", "Krieg",
+"Water sport", "Wassersport",
+"Weak stream", "Schwacher Stream",
+"Weather report", "Wetterbericht",
+"Web interface", "Weboberfläche",
+"Web interface language", "Sprache der Weboberfläche",
+"Web user interface", "Webbenutzeroberfläche",
+"Wed", "Mi",
+"Welcome - Tvheadend - your TV streaming server and video recorder", "Willkommen - Tvheadend - Dein TV Streaming Server und Videorekorder",
+"Western hemisphere (latitude direction)", "Westliche Hemisphäre (Latitude Richtung)",
+"When the service was first identified and recorded.", "Wann der Service das erste mal identifiziert und aufgezeichnet wurde.",
+"When the service was last seen during a mux scan.", "Wann der Service das letzte mal beim Mux Scan gefunden wurde.",
+"Wizard", "Assistent",
+"Yes", "Ja",
+"addpids/delpids supported", "addpids/delpids unterstützt",
+"default: nvenc(h264 / h265)", "Standard: nvenc(h264 / h265)",
+"en50494", "EN50494",
+"fast: h264 / h265 / qsv(h264 / h265)", "schnell: h264 / h265 / qsv(h264 / h265)",
+"faster: h264 / h265 / qsv(h264)", "schneller: h264 / h265 / qsv(h264)",
+"hrs", "Std.",
+"invalid option specified [%s]", "ungültige Option spezifiziert [%s]",
+"medium: h264 / h265 / qsv(h264 / h265)", "mittel: h264 / h265 / qsv(h264 / h265)",
+"min", "Min.",
+"mins", "Min.",
+"option %s requires a value", "Option %s benötigt einen Wert",
+"slow: h264 / h265 / qsv(h264 / h265)", "langsam: h264 / h265 / qsv(h264 / h265)",
+"slower: h264 / h265 / qsv(h264)", "langsamer: h264 / h265 / qsv(h264)",
+"superfast: h264 / h265", "superschnell: h264 / h265",
+"tsfile input (mux file)", "tsfile-Input (Mux-Datei)",
+"tvhdhomerun client", "TV HDHomeRun Client",
+"ultrafast: h264 / h265", "ultraschnell: h264 / h265",
+"veryfast: h264 / h265 / qsv(h264)", "sehr schnell: h264 / h265 / qsv(h264)",
+"veryslow: h264 / h265 / qsv(h264)", "sehr langsam: h264 / h265 / qsv(h264)",
+NULL, NULL
+};
+
+static const char *tvh_locale_5[] = {
+"Allow to show the quick tips for the form fields.", "Show quick tips for the form fields.",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to previously-defined channel icons.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to previously-defined channel names.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to previously-defined channel numbers.",
+"Autorec maximum schedules limit (0=unlimited)", "Autorec maximum schedule limit (0=unlimited)",
+"Concurrent limit per network position (src=) for satellite SAT>IP tuners. The first limit number is for src=1 (AA), second for src=2 (AB) etc.", "Concurrent limit per network position (src=) for satellite SAT>IP tuners. The first limit number is for src=1 (AA), second for src=2 (AB), etc.",
+"Create type based tags", "Create type-based tags",
+"Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected this tells your router the prority in which to give packets sent from Tvheadend, this option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ", "Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected, this tells your router what priority to assign to packets sent from Tvheadend. This option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ",
+"Do not send any stream specific information to the HTSP client like signal strength, input source etc.", "Do not send any stream-specific information to the HTSP client, like signal strength, input source, etc.",
+"EPG source. Name of the module, grabber or channel that should be used to update this channels EPG info.", "EPG source. Name of the module, grabber or channel that should be used to update this channel's EPG info.",
+"Enable or disable ignoring of Event Information Table (EIT) data on this mux.", "Enable or disable the use of Event Information Table (EIT) data on this mux.",
+"Enter allowed network prefix(es). You can enter a comma-seperated list of prefixes here.", "Enter allowed network prefix(es). You can enter a comma-separated list of prefixes here.",
+"Enter external IP if behind Network address translation (NAT).", "Enter external IP if behind a Network Address Translation (NAT) device.",
+"Force usage of entered CA ID on this service.", "Force usage of the entered CA ID on this service.",
+"HTTP Cross-origin resource sharing origin. This option is usually set when Tvheadend is behind a proxy. Enter a domain (or IP) to allow cross-domain requests.", "HTTP CORS (cross-origin resource sharing) origin. This option is usually set when Tvheadend is behind a proxy. Enter a domain (or IP) to allow cross-domain requests.",
+"How frequently it will re-try fetching an image that has failed to be fetched.", "How frequently a failed image fetch is retried.",
+"Maximum schedules limit (0=default)", "Maximum schedule limit (0=default)",
+"Multiple lines of the cron time specification. The default cron triggers the Over-the-air grabber daily at 02:04 and 14:04. See Help on how to define your own.", "Multiple lines of the cron time specification. The default cron triggers the over-the-air grabber daily at 02:04 and 14:04. See Help on how to define your own.",
+"Name. The name given to/of the channel (This is how it'll appear in your EPG.)", "Name. The name given to/of the channel (this is how it'll appear in your EPG).",
+"Only activate timeshift when the client makes the first rewind, fast-forward or pause request. Note, because there is no buffer on the first request rewinding is not possible at that point.", "Only activate timeshift when the client makes the first rewind, fast-forward or pause request. Note that, because there is no buffer on the first request, rewinding is not possible at that point.",
+"Only update the system clock (doesn't affect NTP driver) if the delta between the system clock and DVB time is greater than this. This can help stop excessive oscillations on the system clock.", "Only update the system clock (doesn't affect NTP driver) if the difference between the system clock and DVB time is greater than this. This can help stop excessive oscillations on the system clock.",
+"Pass subscription weight to the SAT>IP server (Tvheadend specific extension).", "Pass subscription weight to the SAT>IP server (Tvheadend-specific extension).",
+"Pre-recording padding. Start recording earlier than the EPG/timer defined start time by x minutes, for example if a program is to start at 13:00 and you set a padding of 5 minutes it will start recording at 12:54:30 (including a warming-up time of 30 seconds). If this isn't set the pre-recording padding if set in the DVR entry or DVR profile will be used.", "Pre-recording padding. Start recording earlier than the EPG/timer defined start time by x minutes. For example, if a program is to start at 13:00 and you set a padding of 5 minutes, it will start recording at 12:54:30 (including a warming-up time of 30 seconds). If this isn't set then the pre-recording padding as set in the DVR entry or DVR profile will be used.",
+"Prevents users from overriding the above user interface level setting and removes the view level drop-dowm from the interface.", "Prevents users from overriding the above user interface level setting and removes the view level drop-down from the interface.",
+"Program identification (PID) number to compare. Zero means any. This comparison is processed only when service comparison is active and for the Conditional Access filter.", "Program identification (PID) number to compare. Zero means any. This comparison is processed only when service comparison is active for the Conditional Access filter.",
+"Re-fetch the bouquet every x mins.", "Re-fetch the bouquet every x minutes.",
+"Real Time Streaming Protocol (RTSP) port the server should listen on (554 or 9983, 0 = disable).", "Real Time Streaming Protocol (RTSP) port on which the server should listen (554 or 9983, 0 = disable).",
+"Rewrite Program Association Table (PMT) packets to only include information about the currently streamed service.", "Rewrite Program Association Table (PMT) packets to only include information about the currently-streamed service.",
+"Schedule a re-recording if more errors than (0=off)", "Schedule a re-recording if more errors than... (0=off)",
+"Scheme to generate the the channel icon names (all lower-case, service name picons etc.).", "Scheme to generate the the channel icon names (all lower-case, service name picons, etc.).",
+"Select how Tvheadend should handle muxes. Auto = accept the mux if it doesn't already exist. Keep = Always keep the muxregardless of whether it exists or not. Reject = Always reject.", "Select how Tvheadend should handle muxes. Auto = accept the mux if it doesn't already exist; Keep = always keep the mux regardless of whether it exists or not; Reject = always reject.",
+"Select the list of languages (in order of priority) to be used for supplying EPG information to clients that don't provide their own configuration.", "Select the list of languages (in order of priority) to be used when supplying EPG information to clients that don't provide their own configuration.",
+"Select the master tuner.The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, the polarization and low-high band settings must be equal.if you set other tuner as master, then this tuner will act like a slave one and tvheadend will assure that this tuner will not use incompatible parameters (position, polarization, lo-hi).", "Select the master tuner. The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, polarization and low-high band settings must be equal. If you set another tuner as master, then this tuner will act as a slave and Tvheadend will insure that this tuner won't use incompatible parameters (position, polarization, lo-hi).",
+"Select whether or not to enable caching. Note: even with this disabled you can still specify local (file://) icons and these will be served by the built-in webserver.", "Select whether or not to enable caching. Note: even with this disabled you can still specify local (file://) icons and these will be served using the built-in webserver.",
+"Send the full RTSP PLAY command after full RTSP SETUP command. Some devices firmware require this to get an MPEG-TS stream.", "Send the full RTSP PLAY command after full RTSP SETUP command. Some devices' firmware require this to get an MPEG-TS stream.",
+"Set the maxiumum packet identifiers your SAT>IP server supports.", "Set the maximum number of packet identifiers your SAT>IP server supports.",
+"Sets the default interface view level (next to the help button).", "Sets the default interface view level (next to the Help button).",
+"Skip TSID checking. For when providers use invalid Transport Stream IDs.", "Skip TSID checking. Use when providers use invalid Transport Stream IDs.",
+"Skip x number of transport packets.", "Skip 'n' transport packets.",
+"Start recording earlier than the defined Start recording earlier than the defined start time by x minutes: for example, if a program is to start at 13:00 and you set a padding of 5 minutes it will start recording at 12:54:30 (including a warm-up time of 30 seconds). If this isn't specified, any pre-recording padding as set in the channel or DVR entry will be used.", "Start recording earlier than the defined start time by x minutes: for example, if a program is to start at 13:00 and you set a padding of 5 minutes it will start recording at 12:54:30 (including a warm-up time of 30 seconds). If this isn't specified, any pre-recording padding as set in the channel or DVR entry will be used.",
+"The audio stream types the filter should apply to.", "The audio stream types to which the filter should apply.",
+"The character set used on this mux. You should not have to change this unless channel names, etc  appear garbled.", "The character set used on this mux. You should not have to change this unless channel names, etc. appear garbled.",
+"The language the filter should apply to.", "The language to which the filter should apply.",
+"The locking mechanism selection for The Preferred Conditional Access Packet Identifier. See Help for more information.", "The locking mechanism selection for the preferred Conditional Access Packet Identifier. See Help for more information.",
+"The logical stream index to compare. Note that this index is computed using all filters.Example: If filter is set to AC3 audio type and the language to 'eng' and there are two AC3 'eng' streams in the service, the first stream could be identified using number 1 and the second using number 2.", "The logical stream index to compare. Note that this index is computed using all filters. For example, if you're filtering on AC3 audio with a language of 'eng', then two AC3 'eng' streams in the service can be simply identified as indices 1 and 2.",
+"The multiplex (mux) is tuned for this amount of time at most. If the EPG data is complete before this limit, the mux is released sooner.", "The multiplex (mux) is tuned for this amount of time at most. If the EPG data is complete before this limit is reached, then the mux is released sooner.",
+"The number of days cookies set by Tvheadend should expire.", "The number of days in which any cookies set by Tvheadend should expire.",
+"The service the filter should apply to. Leave blank to apply the filter to all services.", "The service to which the filter should apply. Leave blank to apply the filter to all services.",
+"The subtitle stream types the filter should apply to.", "The subtitle stream types to which the filter should apply.",
+"The video stream types the filter should apply to.", "The video stream types to which the filter should apply.",
+"This will create an NTP driver (using shmem interface) that you can feed into ntpd. This can be run without root privileges, but generally the performance is not that great.", "This will create an NTP driver (using a shmem interface) that you can feed into ntpd. This can be run without root privileges, but generally the performance is not that great.",
+"Use a pre-defined list of DVB-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Use a pre-defined list of DVB-T/T2 muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.",
+"Username of the entry (this should match a username from within the \"Access Entries\" tab.", "Username of the entry (this should match a username from within the \"Access Entries\" tab).",
+"When nothing else is happening Tvheadend will continuously rotate among all muxes and tune to them to verify that they are still working when the inputs are not used for streaming. If your adapters have problems with lots of (endless) tuning disable this. Note that this option should be OFF for the normal operation. This type of mux probing is not required and it may cause issues for SAT>IP (limited number of PID filters).", "When nothing else is happening Tvheadend will continuously rotate among all muxes and tune to them to verify that they are still working when the inputs are not used for streaming. If your adapters have problems with lots of (endless) tuning, disable this. Note that this option should be OFF for the normal operation. This type of mux probing is not required and it may cause issues for SAT>IP (limited number of PID filters).",
+"Writes the current in-memory EPG database to disk every x hours, so should a crash/unexpected shutdown occur EPG data is saved periodically to the database (re-read on next startup). Set to 0 to disable.", "Writes the current in-memory EPG database to disk every x hours, so it can be re-read on the next startup (e.g. in case an unexpected shutdown occurs). Set to 0 to disable.",
+NULL, NULL
+};
+
+static const char *tvh_locale_6[] = {
+"Allow to show the quick tips for the form fields.", "Show quick tips for the form fields.",
+"Altitude (meters)", "Altitude (metres)",
+"Auto-Map to channels", "Auto-map to channels",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to previously-defined channel icons.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to previously-defined channel names.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to previously-defined channel numbers.",
+"Autorec maximum schedules limit (0=unlimited)", "Autorec maximum schedule limit (0=unlimited)",
+"Children's / Youth programs", "Children's / Youth programmes",
+"Create type based tags", "Create type-based tags",
+"DVR Auto-record entry", "DVR auto-record entry",
+"DVR behavior", "DVR behaviour",
+"Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected this tells your router the prority in which to give packets sent from Tvheadend, this option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ", "Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected, this tells your router the prority to assign to packets sent from Tvheadend. This option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ",
+"Enable or disable ignoring of Event Information Table (EIT) data on this mux.", "Enable or disable the use of Event Information Table (EIT) data on this mux.",
+"Enable over-the-air program guide (EPG) scanning on this input device.", "Enable over-the-air programme guide (EPG) scanning on this input device.",
+"Enter allowed network prefix(es). You can enter a comma-seperated list of prefixes here.", "Enter allowed network prefix(es). You can enter a comma-separated list of prefixes here.",
+"Enter external IP if behind Network address translation (NAT).", "Enter external IP if behind a Network Address Translation (NAT) device.",
+"Entertainment programs for 10 to 16", "Entertainment programmes for 10 to 16",
+"Entertainment programs for 6 to 14", "Entertainment programmes for 6 to 14",
+"HTTP Cross-origin resource sharing origin. This option is usually set when Tvheadend is behind a proxy. Enter a domain (or IP) to allow cross-domain requests.", "HTTP CORS (cross-origin resource sharing) origin. This option is usually set when Tvheadend is behind a proxy. Enter a domain (or IP) to allow cross-domain requests.",
+"How frequently it will re-try fetching an image that has failed to be fetched.", "How frequently a failed image fetch is retried.",
+"MPEG-TS Pass-thru", "MPEG-TS Pass-through",
+"MPEG-TS Pass-thru/built-in", "MPEG-TS Pass-through/built-in",
+"Maximum schedules limit (0=default)", "Maximum schedule limit (0=default)",
+"Multiple lines of the cron time specification. The default cron triggers the Over-the-air grabber daily at 02:04 and 14:04. See Help on how to define your own.", "Multiple lines of the cron time specification. The default cron triggers the over-the-air grabber daily at 02:04 and 14:04. See Help on how to define your own.",
+"Name (or date) of program the entry is a rerun of.", "Name (or date) of programme the entry is a rerun of.",
+"Name. The name given to/of the channel (This is how it'll appear in your EPG.)", "Name. The name given to/of the channel (this is how it'll appear in your EPG).",
+"Only activate timeshift when the client makes the first rewind, fast-forward or pause request. Note, because there is no buffer on the first request rewinding is not possible at that point.", "Only activate timeshift when the client makes the first rewind, fast-forward or pause request. Note that, because there is no buffer on the first request, rewinding is not possible at that point.",
+"Only update the system clock (doesn't affect NTP driver) if the delta between the system clock and DVB time is greater than this. This can help stop excessive oscillations on the system clock.", "Only update the system clock (doesn't affect NTP driver) if the difference between the system clock and DVB time is greater than this. This can help stop excessive oscillations on the system clock.",
+"PIN inquiry match string", "PIN enquiry match string",
+"Pass subscription weight to the SAT>IP server (Tvheadend specific extension).", "Pass subscription weight to the SAT>IP server (Tvheadend-specific extension).",
+"Polarization", "Polarisation",
+"Pre-recording padding. Start recording earlier than the EPG/timer defined start time by x minutes, for example if a program is to start at 13:00 and you set a padding of 5 minutes it will start recording at 12:54:30 (including a warming-up time of 30 seconds). If this isn't set the pre-recording padding if set in the DVR entry or DVR profile will be used.", "Pre-recording padding. Start recording earlier than the EPG/timer defined start time by x minutes: for example, if a programme is to start at 13:00 and you set a padding of 5 minutes, it will start recording at 12:54:30 (including a warm-up time of 30 seconds). If this isn't set then the pre-recording padding as set in the DVR entry or DVR profile will be used.",
+"Pre-school children's programs", "Pre-school children's programmes",
+"Prevents users from overriding the above user interface level setting and removes the view level drop-dowm from the interface.", "Prevents users from overriding the above user interface level setting and removes the view level drop-down from the interface.",
+"Program identification (PID) number to compare. Zero means any. This comparison is processed only when service comparison is active and for the Conditional Access filter.", "Program identification (PID) number to compare. Zero means any. This comparison is processed only when service comparison is active for the Conditional Access filter.",
+"Program synopsis.", "Programme synopsis.",
+"Real Time Streaming Protocol (RTSP) port the server should listen on (554 or 9983, 0 = disable).", "Real Time Streaming Protocol (RTSP) port on which the server should listen (554 or 9983, 0 = disable).",
+"Rewrite Program Association Table (PMT) packets to only include information about the currently streamed service.", "Rewrite Program Association Table (PMT) packets to only include information about the currently-streamed service.",
+"Schedule a re-recording if more errors than (0=off)", "Schedule a re-recording if more errors than... (0=off)",
+"Scheme to generate the the channel icon names (all lower-case, service name picons etc.).", "Scheme to generate the the channel icon names (all lower-case, service name picons, etc.).",
+"School programs", "School programmes",
+"Select how Tvheadend should handle muxes. Auto = accept the mux if it doesn't already exist. Keep = Always keep the muxregardless of whether it exists or not. Reject = Always reject.", "Select how Tvheadend should handle muxes. Auto = accept the mux if it doesn't already exist; Keep = always keep the mux regardless of whether it exists or not; Reject = always reject.",
+"Select the list of languages (in order of priority) to be used for supplying EPG information to clients that don't provide their own configuration.", "Select the list of languages (in order of priority) to be used when supplying EPG information to clients that don't provide their own configuration.",
+"Select the master tuner.The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, the polarization and low-high band settings must be equal.if you set other tuner as master, then this tuner will act like a slave one and tvheadend will assure that this tuner will not use incompatible parameters (position, polarization, lo-hi).", "Select the master tuner. The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, polarization and low-high band settings must be equal. If you set another tuner as master, then this tuner will act as a slave and Tvheadend will ensure that this tuner won't use incompatible parameters (position, polarization, lo-hi).",
+"Select whether or not to enable caching. Note: even with this disabled you can still specify local (file://) icons and these will be served by the built-in webserver.", "Select whether or not to enable caching. Note: even with this disabled you can still specify local (file://) icons and these will be served using the built-in webserver.",
+"Send the full RTSP PLAY command after full RTSP SETUP command. Some devices firmware require this to get an MPEG-TS stream.", "Send the full RTSP PLAY command after full RTSP SETUP command. Some devices' firmware require this to get an MPEG-TS stream.",
+"Set the maxiumum packet identifiers your SAT>IP server supports.", "Set the maximum number of packet identifiers your SAT>IP server supports.",
+"Sets the default interface view level (next to the help button).", "Sets the default interface view level (next to the Help button).",
+"Skip TSID checking. For when providers use invalid Transport Stream IDs.", "Skip TSID checking. Use when providers use invalid Transport Stream IDs.",
+"Skip x number of transport packets.", "Skip 'n' transport packets.",
+"Start recording earlier than the defined Start recording earlier than the defined start time by x minutes: for example, if a program is to start at 13:00 and you set a padding of 5 minutes it will start recording at 12:54:30 (including a warm-up time of 30 seconds). If this isn't specified, any pre-recording padding as set in the channel or DVR entry will be used.", "Start recording earlier than the defined Start recording earlier than the defined start time by x minutes: for example, if a programme is to start at 13:00 and you set a padding of 5 minutes, it will start recording at 12:54:30 (including a warm-up time of 30 seconds). If this isn't specified, any pre-recording padding as set in the channel or DVR entry will be used.",
+"Subtitle of the program (if any).", "Subtitle of the programme (if any).",
+"The audio stream types the filter should apply to.", "The audio stream types to which the filter should apply.",
+"The character set used on this mux. You should not have to change this unless channel names, etc  appear garbled.", "The character set used on this mux. You should not have to change this unless channel names, etc. appear garbled.",
+"The content type (Movie/Drama, Sports, etc.) to be used to filter matching events/programs.", "The content type (Movie/Drama, Sports, etc.) to be used to filter matching events/programmes.",
+"The language the filter should apply to.", "The language to which the filter should apply.",
+"The locking mechanism selection for The Preferred Conditional Access Packet Identifier. See Help for more information.", "The locking mechanism selection for the preferred Conditional Access Packet Identifier. See Help for more information.",
+"The logical stream index to compare. Note that this index is computed using all filters.Example: If filter is set to AC3 audio type and the language to 'eng' and there are two AC3 'eng' streams in the service, the first stream could be identified using number 1 and the second using number 2.", "The logical stream index to compare. Note that this index is computed using all filters. For example, if you're filtering on AC3 audio with a language of 'eng', then two AC3 'eng' streams in the service can be simply identified as indices 1 and 2.",
+"The minimal duration of a matching event - in other words, only match programs that are no shorter than this duration.", "The minimal duration of a matching event - in other words, only match programmes that are no shorter than this duration.",
+"The multiplex (mux) is tuned for this amount of time at most. If the EPG data is complete before this limit, the mux is released sooner.", "The multiplex (mux) is tuned for this amount of time at most. If the EPG data is complete before this limit is reached, then the mux is released sooner.",
+"The number of days cookies set by Tvheadend should expire.", "The number of days in which any cookies set by Tvheadend should expire.",
+"The service the filter should apply to. Leave blank to apply the filter to all services.", "The service to which the filter should apply. Leave blank to apply the filter to all services.",
+"The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, the polarization and low-high band settings must be equal. If you set another tuner as master, then this tuner will act as a slave and Tvheadend will assure that this tuner will not use incompatible parameters (position, polarization, lo-hi).", "The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, the polarisation and low-high band settings must be equal. If you set another tuner as master, then this tuner will act as a slave and Tvheadend will assure that this tuner will not use incompatible parameters (position, polarisation, lo-hi).",
+"The subtitle stream types the filter should apply to.", "The subtitle stream types to which the filter should apply.",
+"The title of the program to look for. Note that this accepts case-insensitive regular expressions.", "The title of the programme to look for. Note that this accepts case-insensitive regular expressions.",
+"The video stream types the filter should apply to.", "The video stream types to which the filter should apply.",
+"This will create an NTP driver (using shmem interface) that you can feed into ntpd. This can be run without root privileges, but generally the performance is not that great.", "This will create an NTP driver (using a shmem interface) that you can feed into ntpd. This can be run without root privileges, but generally the performance is not that great.",
+"Title of the program.", "Title of the programme.",
+"Use a pre-defined list of DVB-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Use a pre-defined list of DVB-T/T2 muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.",
+"Username of the entry (this should match a username from within the \"Access Entries\" tab.", "Username of the entry (this should match a username from within the \"Access Entries\" tab).",
+"Waiting for program start", "Waiting for programme start",
+"Writes the current in-memory EPG database to disk every x hours, so should a crash/unexpected shutdown occur EPG data is saved periodically to the database (re-read on next startup). Set to 0 to disable.", "Writes the current in-memory EPG database to disk every x hours, so it can be re-read on the next startup (e.g. in case an unexpected shutdown occurs). Set to 0 to disable.",
+NULL, NULL
+};
+
+static const char *tvh_locale_7[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nPara más informacion, por favor visita el sitio web Tvheadend:\nhttps://tvheadend.org\n",
+"# Channels", "# Canales",
+"# Mapped channels", "# Canales mapeados",
+"# Muxes", "# Multiplexores",
+"# Services", "# Servicios",
+"# Services seen", "# Servicios vistos",
+"# tune repeats", "# Repite sintonización",
+"(Default profile)", "(Perfil por defecto)",
+"1 day", "1 día",
+"1 month", "1 mes",
+"1 week", "1 semana",
+"1 year", "1 año",
+"2 months", "2 meses",
+"2 weeks", "2 semanas",
+"2 years", "2 años",
+"2-Port switch (universal LNB)", "Switch de 2 puertos (LNB universal)",
+"3 days", "3 días",
+"3 months", "3 meses",
+"3 weeks", "3 semanas",
+"3 years", "3 años",
+"4-Port switch (universal LNB)", "Switch de 4 puertos (LNB universal)",
+"5 days", "5 días",
+"6 months", "6 meses",
+"AC-3 = descriptor 6", "AC-3 = Descriptor 6",
+"AC-3 detection", "Detección AC-3",
+"ACTIVE", "ACTIVO",
+"AES constant code word client", "AES constante en código de palabra del cliente",
+"ANY", "CUALQUIERA",
+"ATSC source ID", "Origen de ID ATSC",
+"ATSC-C network", "Red ATSC-C",
+"ATSC-T network", "Red ATSC-T",
+"Aborted by user", "Cancelado por el usuario",
+"Accept remote subscription weight", "Acepta el peso de suscripción remota",
+"Accept the remote subscription weight (from the SAT>IP client).", "Acepte la fuerza de suscripción a distancia (desde el cliente SAT>IP).",
+"Access", "Acceso",
+"Action", "Accion",
+"Adapter in use by another subscription", "Adaptador en uso por otra suscripcion",
+"Add file and line numbers to debug", "Añade fichero y numero de línea para depurar",
+"Add the thread ID to debug", "Añade el ID de la tarea para depurar",
+"Admin", "Administrador",
+"Admin password", "Contraseña de administrador",
+"Admin username", "Usuario de administrador",
+"Administrator login", "Login de administrador",
+"Adult movie", "Película para Adultos",
+"Advanced", "Avanzado",
+"Advanced (non-universal LNBs, rotors, etc.)", "Avanzado (LNBs no-universales, rotores, etc.)",
+"Advanced streaming", "Retransmisión Avanzada",
+"Adventure", "Aventuras",
+"Advertisement / Shopping", "Publicidad / Compras",
+"All (Streaming plus DVR)", "Todos (Streaming más DVR)",
+"All DVR (rw)", "Todos los DVR (lectura/escritura)",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Todos los fondos recaudados se usarán para apoyar la infraestructura de servidores y comprar equipos de prueba.",
+"Allow to show the quick tips for the form fields.", "Permitir para mostrar los consejos rápidos para los campos del formulario.",
+"Allowed network", "Red permitida",
+"Allowed networks", "Redes permitidas",
+"Alternate PID path", "Ruta alternativa del PID",
+"Alternate configuration path", "Ruta alternativa de la configuracion",
+"Altitude (in meters).", "Altitud (en metros)",
+"Altitude (meters)", "Altitud (metros)",
+"Animals", "Animales",
+"Any", "Cualquiera",
+"Arts", "Artes",
+"Athletics", "Atletismo",
+"Audio bitrate (kb/s) (0=auto)", "Tasa de audio (kb/s) (0=Auto)",
+"Audio codec", "Códec de audio",
+"Audio stream filter", "Filtro de retransmisión de audio",
+"Auto", "Automático",
+"Auto check disabled", "Autocomprobación deshabilitada",
+"Auto check enabled", "Autocomprobación habilitada",
+"Auto record", "Grabar automáticamente",
+"Auto record caption", "Captación de grabación automática",
+"Auto recording%s%s", "Grabación Automática%s%s",
+"Auto time record", "Tiempo de grabación automático",
+"Auto-Map to channels", "Auto-Mapear a los canales",
+"Automatic checking", "Comprobar automáticamente",
+"Automatically map EPG source", "Mapear automáticamente la fuente de la guía",
+"Automatically name from network", "Nombrar automáticamente desde la red",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Actualizar automáticamente los iconos de los canales utilizando la información proporcionada por los proveedores de EPG habilitados. Nota: esto puede causar cambios no deseados en iconos ya definidos en un canal.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Actualizar automáticamente los nombres de los canales utilizando la información proporcionada por los proveedores de EPG habilitados. Nota: esto puede causar cambios no deseados en el nombre de canales ya definidos.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Actualizar automáticamente los números de canal utilizando la información proporcionada por los proveedores de EPG habilitados. Nota: esto puede causar cambios no deseados en números de canal ya definidos.",
+"Autorec maximum count (0=unlimited)", "Recuento máximo de auto grabación (0=ilimitado)",
+"Autorec maximum schedules limit (0=unlimited)", "Límite de cola máximo de auto grabación (0=ilimitado)",
+"Bad", "Mal",
+"Ballet", "Balet",
+"Bandwidth", "Ancho de Banda",
+"Based on software from", "Basado en software desde",
+"Basic", "Básico",
+"Bind to specific local IP address.", "Enlazar a la dirección IP local específica.",
+"Boot ID", "ID de Arranque",
+"Bouquet", "Rama",
+"Bouquet (auto)", "Rama (auto)",
+"Brand", "Marca",
+"Broadcast", "Emisión",
+"Broadcasting", "Radiodifusión",
+"Build", "Construido",
+"CA ID", "ID CA",
+"CA client %i", "Cliente %i CA",
+"CA identification", "Identificación CA",
+"CA provider", "Proveedor CA",
+"CA stream filter", "Filtro de retransmisión CA",
+"CAPMT interval (ms)", "Intervalo CAPMT (ms)",
+"CAPMT query interval (ms)", "Intervalo de consulta (ms) CAPMT",
+"CRID authority", "Autoridad CRID",
+"Cache scheme", "Esquema de caché",
+"Camd.socket filename / IP Address (TCP mode)", "Nombre del archivo camd.socket / Dirección IP (modo TCP)",
+"Cartoons", "Dibujos Animados",
+"Channel", "Canal",
+"Channel icon", "Icono del canal",
+"Channel icon path (see Help)", "Ruta del icono del Canal (ver Ayuda)",
+"Channel name", "Nombre del canal",
+"Channel number", "Número de Canal",
+"Channel number offset", "Compensación de número de canal",
+"Channel numbers from", "Números de canales desde",
+"Channel tag", "Categoría del canal",
+"Channel tag reference", "Referencia de etiqueta del canal",
+"Channel tags", "Categorías del canal",
+"Channels", "Canales",
+"Character set", "Juego de carácteres",
+"Check availability", "Comprobar disponibilidad",
+"Children's / Youth programs", "Programas para Niños / Jovenes",
+"Cinema", "Cine",
+"Class", "Clase",
+"Classical", "Clásico",
+"Classical music", "Música Clásica",
+"Clean effects", "Efectos Limpios",
+"Client name", "Nombre del cliente",
+"Clone scheduled entry on error", "Clonar entrada programada en error",
+"Code word client (newcamd)", "Código de palabra del cliente (newcamd)",
+"Comedy", "Comedia",
+"Command delay time (ms) (10-200)", "Tiempo de retraso (ms) (10-200)",
+"Command time (ms) (10-100)", "Tiempo de comando (ms) (10-100)",
+"Comment", "Comentario",
+"Commercial break", "Anuncios",
+"Completed OK", "Completado OK",
+"Conditional access client", "Acceso condicional de cliente",
+"Configuration", "Configuración",
+"Configuration ID", "ID de Configuración",
+"Configuration name", "Nombre de configuración",
+"Configuration version", "Versión de Configuración",
+"Connection limit type", "Tipo de límite de conexión",
+"Constellation", "Constelación",
+"Container", "Contenedor",
+"Content character set", "Contenido de carácteres seleccionado",
+"Content reference identifier authority.", "Contenido autorizado para un identificador de referencia.",
+"Content type", "Tipo de contenido",
+"Contest", "Concurso",
+"Continue even if descrambling fails", "Continuar incluso si el cifrado falla",
+"Cookie expiration (days)", "Expiración de cookies (días)",
+"Cooking", "Cocina",
+"Copy codec type", "Copiar Tipo de Codec",
+"Copy layout", "Composicion de la Copia",
+"Create bouquet", "Crear Rama",
+"Create network name tags", "Crear categoría de nombres de red",
+"Create provider name tags", "Crear etiquetas de nombre proveedor",
+"Create type based tags", "Crear etiquetas de tipo base",
+"Created", "Creado",
+"Creator", "Creador",
+"Cron", "Tarea Programada",
+"Cron multi-line", "Cronología multi-línea",
+"Culture (without music)", "Cultura (sin musica)",
+"Current RTSP port.", "Puerto RTSP actual.",
+"Current affairs", "Actualidad",
+"Current tuner configuration.", "Configuración de sintonización actual.",
+"Custom HTTP headers", "Cabeceras HTTP personalizadas",
+"DBus - use the session message bus instead of the system one", "DBus - usar el mensaje de sesión de bus en vez de el del sistema",
+"DES constant code word client", "DES constante en código de palabra del cliente",
+"DES key", "Clave DES",
+"DSCP/TOS for streaming", "DSCP/TOS para streaming",
+"DVB EPG ID", "ID EPG DVB",
+"DVB scan files", "Escanear archivos DVB",
+"DVB scan files path", "Escanear rutas de archivo DVB",
+"DVB-C network", "Red DVB-C",
+"DVB-S 4-port", "4-Puertos DVB-S",
+"DVB-S EN50494 (UniCable, experimental)", "EN50494 DVB-S (UniCable, experimental)",
+"DVB-S advanced", "DVB-S avanzado",
+"DVB-S network", "Red DVB-S",
+"DVB-S satellite configuration", "Configuración de satélite DVB-S",
+"DVB-S tone burst", "Toneburst DVB-S",
+"DVB-T network", "Red DVB-T",
+"DVR Auto-record entry", "Auto-grabar entrada DVR",
+"DVR behavior", "Comportamiento de DVR",
+"DVR configuration", "Configuración DVR",
+"DVR configuration profile", "Perfil de configuración DVR",
+"DVR configuration profiles", "Perfiles de configuración DVR",
+"DVR file retention period", "Período de retención de archivos DVR",
+"DVR log retention", "Retención del registro de DVR",
+"DVR log retention period", "Período de retención de registro DVR",
+"DVR override: high", "Anular DVR: alto",
+"DVR override: important", "Anular DVR: importante",
+"DVR override: low", "Anular DVR: bajo",
+"DVR override: normal", "Anular DVR: normal",
+"DVR override: unimportant", "Anular DVR: importante",
+"DVR time record entry", "Entrada DVR de tiempo de grabación",
+"Dance", "Baile",
+"Data errors", "Errores de datos",
+"Days of Week", "Días de la Semana",
+"Days of week", "Días de la semana",
+"Debug libav log", "Depurar registro libdav",
+"Debug log path", "Depurar ruta de registro",
+"Debug options", "Opciones de desarrollo",
+"Debug subsystems", "Depurar subsistemas",
+"Debug to syslog", "Depurar registro del sistema",
+"Debug trace (low-level)", "Depurar trazado (bajo nivel)",
+"Debugging", "Depuración",
+"Default", "Por Defecto",
+"Default language(s)", "Idioma(s) por defecto",
+"Default priority", "Prioridad por defecto",
+"Delivery system", "Sistema de entrega",
+"Demux path", "Ruta de demux",
+"Descramble services (limit per mux)", "Decodificar servicio (límite por Mux)",
+"Descrambler buffer (TS packets)", "Decodificar buffer (Paquetes TS)",
+"Description", "Descripción",
+"Detective", "Detectable",
+"Device ID", "ID Dispositivo",
+"Device model", "Modelo de dispositivo",
+"Device path", "Ruta de dispositivo",
+"Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected this tells your router the prority in which to give packets sent from Tvheadend, this option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ", "Código de servicios diferenciados Punto / Tipo de Servicio: Establecer la clase de servicio Tvheadend  para envíar con cada paquete. Dependiendo de la opción seleccionada esto dice al router la prioridad en el cual dar los paquetes enviados desde Tvheadend, esta opción no suele necesitar ser cambiada. Ver https://es.wikipedia.org/wiki/Servicios_Diferenciados (o https://en.wikipedia.org/wiki/Differentiated_services en inglés) para más información.",
+"Directory", "Directorio",
+"Directory permissions (octal, e.g. 0775)", "Permisos de directorio (ej.: 0775)",
+"Disable", "Deshabilitar",
+"Disable DVB bouquets", "Deshabilitar DVB bouquets",
+"Disable SAT>IP client", "Deshabilitar SAT>IP",
+"Disable all access control checks", "Deshabilitar los Check de Control de Accesos",
+"Disable debug on stderr", "Deshabilitar depuración en stderr",
+"Disable device/firmware-specific workarounds", "Deshabilitar Dispositivo/Soluciones Especificas del Firmware",
+"Disable syslog (all messages)", "Deshabilitar syslog (Todos los Mensajes)",
+"Disabled", "Deshabilitado",
+"Discussion", "Discusion",
+"DiseqC repeats", "Repite DiseqC",
+"DiseqC rotor", "Rotor DiseqC",
+"DiseqC switch", "DiseqC Commutador",
+"Do not use", "No Usar",
+"Documentary", "Documental",
+"Don't backup configuration tree at upgrade", "No guardar arbol de configuración al actualizar",
+"Don't include title in filename", "No incluir el título en el nombre de archivo",
+"Don't keep", "No mantener",
+"Don't re-record", "No re-grabar",
+"Don't reschedule", "No re-planificar",
+"Duplicate handling", "Duplicar manipulación",
+"EIT - skip TSID check", "EIT- pasar chequeo de TSID",
+"EPG grabber", "Obtención de guía",
+"EPG grabber channel", "Nombre de Obtención de Guía",
+"EPG grabber configuration", "Configuración de extractor de guía",
+"EPG name", "Nombre de guía",
+"EPG scan", "Escanear guía",
+"EPG scan timeout in seconds (30-7200)", "Tiempo de agote del escaneo de guía en segundos (30-7200)",
+"EPG source", "Fuente de guía",
+"EPG update window", "Ventana de actualización de guía",
+"Economics", "Económicos",
+"Education", "Educación",
+"Educational", "Educativo",
+"Elementary stream filter", "Filtro de retransmisión elemental",
+"Enable (auto)", "Habilitar (automatico)",
+"Enable DBus", "Habilitar DBus",
+"Enable NTP driver", "Habilitar controlador NTP",
+"Enable coredumps for daemon", "Habilitar volcados (coredump) para el demonio",
+"Enable debug on stderr", "Habilitar depuración en stderr",
+"Enable debug subsystems", "Habilitar subsistemas de depuración",
+"Enable debug to file", "Habilitar depuración a fichero",
+"Enable debug to syslog", "Habilitar debug a syslog",
+"Enable if the SAT>IP box requests plts=on parameter in the SETUP RTSP command for DVB-S2 muxes.", "Activar si el cuadro SAT>IP solicita PLTS = el parámetro en el comando de instalación RTSP para muxes DVB-S2.",
+"Enable if the SAT>IP box requires pids=0 parameter in the SETUP RTSP command.", "Activar si el cuadro SAT>IP requiere PID = 0 parámetro en el comando CONFIGURACIÓN RTSP.",
+"Enable if the SAT>IP box requires pids=21 parameter in the SETUP RTSP command", "Activar si el SAT>IP requiere el parámetro PID = 21 en el comando CONFIGURACIÓN RTSP",
+"Enable if the SAT>IP box supports the addpids/delpids commands.", "Activar si el cuadro IP>SAT soporta los comandos addpids / delpids.",
+"Enable or disable RTSP/TCP (embedded data) support.", "Activar o desactivar la RTSP / TCP apoyo (datos incrustados).",
+"Enable or disable fast input switching.", "Activar o desactivar la conmutación de entrada rápida.",
+"Enable or disable full mux mode.", "Activar o desactivar el modo de mux completo.",
+"Enable or disable ignoring of Event Information Table (EIT) data on this mux.", "Activar o desactivar haciendo caso omiso de la tabla de eventos de Información (EIT) datada en este mux.",
+"Enable or disable this configuration.", "Activar o desactivar esta configuración.",
+"Enable syslog", "Habilitar registro del sistema",
+"Enable system time updates. This will only work if the user running Tvheadend has rights to update the system clock (normally only root).", "Habilitar actualizaciones en tiempo del sistema. Esto sólo funcionará si el usuario que ejecuta Tvheadend tiene derechos para actualizar el reloj del sistema (normalmente solo root).",
+"Enable trace subsystems", "Habilitar subsistemas de traceo",
+"Enable web UI debug (non-minified JS)", "Habilitar depuración webUI (JS non-minified)",
+"Enabled", "Habilitado",
+"Encrypted", "Encriptado",
+"Encrypted service", "Servicio encriptado",
+"Enter external IP if behind Network address translation (NAT).", "Ingrese IP externa detrás de la traducción de direcciones de red (NAT).",
+"Entertainment programs for 10 to 16", "Programas de entretenimiento de 10 a 16",
+"Entertainment programs for 6 to 14", "Programas de entretenimiento de 6 a 14",
+"Environment", "Entorno",
+"Environment (pipe)", "Entorno (pipe)",
+"Episode", "Episidio",
+"Episode %d", "Episodio %d",
+"Error code", "Código de error",
+"Errors", "Errores",
+"Even key", "Cada clave",
+"Every day", "Todos los días",
+"Exclude channel tags", "Excluir etiquetas de canal",
+"Expeditions", "Expediciones",
+"Experimental film", "Pelicula experimental",
+"Expert", "Experto",
+"Exported tuners", "Sintonizadores exportados",
+"External", "Externo",
+"External EPG grabber", "Obtención de guía externa",
+"External IP (NAT)", "IP externa (NAT)",
+"External URL", "Enlace Externo",
+"Extra arguments", "Información adicional",
+"Extra start time", "Tiempo de inicio adicional",
+"Extra stop time", "Tiempo de finalización adicional",
+"Extra warming up time (seconds)", "Tiempo adicional de calentamiento (segundo)",
+"FAIL", "FALLO",
+"FEC high", "FEC alto",
+"FEC low", "FEC bajo",
+"Factual topics", "Temas de hechos",
+"Failed", "Fallido",
+"Failed DVR", "DVR fallo",
+"Fantasy", "Fantasia",
+"Fast input switch", "Cambiador de entrada rápida",
+"File missing", "Fichero no encontrado",
+"File not created", "Fichero no creado",
+"File permissions (octal, e.g. 0664)", "Permisos de archivo (ej.: 0664)",
+"File size", "Tamaño de archivo",
+"Filename", "Nombre de fichero",
+"Filename character set", "Juego de carácteres de nombre de fichero",
+"Filename options", "Opciones de nombre de archivo",
+"Film", "Pelicula",
+"Fine arts", "Bellas artes",
+"Finished", "Acabada",
+"Fitness and health", "Fitness y salud",
+"Folk", "Folclore",
+"Folkloric", "Folclórico",
+"Football", "Futbol",
+"Force (auto)", "Forzar (auto)",
+"Force CA ID (e.g. 0x2600)", "Forzar CA ID (ej. 0x2600)",
+"Force all network connections to this tuner to be made over the specified IP address, similar to the setting for the SAT>IP device itself. Setting this overrides the device-specific setting.", "Forzar todas las conexiones de red para este sintonizador que actúa sobre la dirección IP especificada, similar a la configuración de SAT>IP propia. Establecer este anula la configuración específica del dispositivo.",
+"Force old status", "Forzar estado anterior",
+"Force pilot for DVB-S2", "Forzar piloto para DVB-S2",
+"Force priority", "Forzar prioridad",
+"Force teardown delay", "Forzar retraso de desmontaje",
+"Force the delay between RTSP TEARDOWN and RTSP SETUP command (value from 'Next tune delay in ms' is used). Some devices are not able to handle quick continuous tuning.", "Forzar el retardo entre comandos RTSP TEARDOWN y RTSP SETUP (se utiliza el valor de la \"demora en sintonizar en ms\"). Algunos dispositivos no son capaces de manejar sintonización continua rápida.",
+"Force the local UDP Port number here. The number should be even (RTP port). The next odd number (+1) will be used as the RTCP port.", "Forzar el número de puerto UDP local aquí. El número debe ser uniforme (puerto RTP). El siguiente número impar (+1) se utilizará como el puerto RTCP.",
+"Force usage of entered CA ID on this service.", "Forzar el uso del CA ID introducido en este servicio.",
+"Foreign countries", "Paises extranjeros",
+"Forever", "Para siempre",
+"Fork and run as daemon", "Bifurcar y ejecutar como demonio",
+"Format string", "Cadena de formato",
+"Found muxes", "Muxes encontrados",
+"Found services", "Encontrar servicios",
+"Free subscription weight", "Peso de la suscripción libre.",
+"Free-format text field. Enter whatever you like here.", "Campo de texto de formato libre. Introduzca lo que quiera aquí.",
+"Frequency", "Frecuencia",
+"Frequency (Hz)", "Frecuencia (Hz)",
+"Frequency (MHz)", "Frecuencia (Mhz)",
+"Frequency (kHz)", "Frecuencia (kHz)",
+"Fri", "Vie",
+"Friendly name", "Nombre amigable",
+"Frontend number", "Numero de interfaz",
+"Frontend path", "Ruta de interfaz",
+"Full DiseqC", "DisqC Completo",
+"Full mux RX mode supported", "Modo Mux RX lleno suportado",
+"Full pathname specification", "Especificación de ruta de archivo completa",
+"Full-text", "Texto completo",
+"Further education", "Futura educación",
+"GOTOX position", "Posición de GOTOX",
+"GOTOX rotor", "Rotor GOTOX",
+"Game show", "Show de juegos",
+"Gardening", "Jardinería",
+"General configuration", "Configuración general",
+"Generic", "Genérico",
+"Generic options", "Opciones genéricas",
+"Guard interval", "Intervalo de guardado",
+"HD: high definition", "HD: alta definición",
+"HDHomeRun ATSC-C frontend", "Índice HDHomeRun ATSC-C",
+"HDHomeRun ATSC-T frontend", "índice HDHomeRun ATSC-T",
+"HDHomeRun DVB frontend", "Índice HDHomeRun DVB",
+"HDHomeRun DVB-C frontend", "Índice HDHomeRun DVB-C",
+"HDHomeRun DVB-T frontend", "Índice HDHomeRun DVB-T",
+"HTSP Default Stream Settings", "Ajustes por defecto de Retransmisión HTSP",
+"HTSP stream profile", "Perfil de Retransmisión HTSP",
+"HTSP streaming", "Retransmisión HTSP",
+"HTTP CORS origin", "Origen de CORS HTTP",
+"HTTP Cross-origin resource sharing origin. This option is usually set when Tvheadend is behind a proxy. Enter a domain (or IP) to allow cross-domain requests.", "HTTP Cruz-origen compartido de recursos. Esta opción se establece generalmente cuando Tvheadend está detrás de un proxy. Introduzca un dominio (o IP) para permitir peticiones entre dominios.",
+"Handicraft", "Artesanía",
+"Hearing impaired", "Personas con discapacidad auditiva",
+"Hierarchy", "Jerarquía",
+"High", "Alto",
+"High bitrate mode (CI+ CAMs only)", "Modo de alta tasa de datos (CI+ solo cámaras)",
+"Historical movie", "Película histórica",
+"Horror", "Terror",
+"Hostname/IP", "Nombre del Host/IP",
+"How frequently it will re-try fetching an image that has failed to be fetched.", "¿Con qué frecuencia se volverá a tratar de buscar una imagen que no ha podido ser encontrada?",
+"How frequently the upstream provider is checked for changes.", "¿Con qué frecuencia se comprueba el proveedor para encontrar cambios?",
+"IDLE", "EN ESPERA",
+"IP address", "Dirección IP",
+"IP blocking", "Bloqueo de IP",
+"IPTV Multiplex", "Multiplexo IPTV",
+"IPTV automatic network", "Red automática IPTV",
+"IPTV input", "Entrada de IPTV",
+"IPTV network", "Red IPTV",
+"ISI (Stream ID)", "ISI (Identificador de Retransmisión)",
+"Icon", "Icono",
+"Icon (full URL)", "Icono (URL completo)",
+"Icon URL", "URL Icono",
+"Icon base URL", "Icono basado en URL",
+"Icon has title", "El icono tiene título",
+"Icons from", "Iconos desde",
+"Idle", "En Espera",
+"Idle scan", "Escaneo en Espera",
+"Idle scan muxes", "Buscar muxes en espera",
+"If both a picon and a channel-specific (e.g. channelname.jpg) icon are defined, use the picon.", "Si se definen ambas, un picon y un canal específico (por ejemplo channelname.jpg) el icono utilizará el picón.",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Si no existe ninguna cuenta de usuario a continuación, crear una con\nningún nombre de usuario ni contraseña. Utilizar con cuidado\nésto permitirá un acceso administrativo a todo el mundo\na toda su instalación de Tvheadend hasta que crees o edites\nel control de acceso desde la interfaz web de Tvheadend.",
+"If you'd like to support the project, please consider a donation.", "Si quiere dar soporte al proyecto, por favor considere realizar una donación",
+"Ignore EPG (EIT)", "Ignorar EPG (EIT)",
+"Ignore descriptor 5", "Ignorar descriptor 5",
+"Ignore invalid SSL certificate", "Ignorar certificado inválido SSL",
+"Ignore invalid/unverifiable (expired, self-certified, etc.) certificates", "Ignorar certificados no válidos / no verificables (expirados, autocertificados, etc...)",
+"Ignore provider's channel numbers", "Ignorar números de canales del proveedor",
+"Image cache", "Caché de imagen",
+"Immediately abort", "Abortar inmediatamente",
+"Important", "Importante",
+"Include channel name in filename", "Incluir nombre de canal en el nombre del fichero",
+"Include date in filename", "Incluir fecha en el nombre del archivo",
+"Include episode in filename", "Incluir episodio en el nombre del archivo",
+"Include subtitle in filename", "Incluir subtítulo en el nombre del archivo",
+"Include time in filename", "Incluir hora en el nombre del archivo",
+"Index", "Índice",
+"Information area", "Área de Información",
+"Informational", "Informativo",
+"Initial scan", "Escaneo inicial",
+"Input base", "Entrada base",
+"Input buffer (bytes)", "Entrada de buffer (bytes)",
+"Input instance", "Instancia de entrada",
+"Input path", "Ruta de entrada",
+"Interface", "Interfaz",
+"Internal", "Interno",
+"Internal EPG grabber", "Extractor de guía interno",
+"Internal grabber", "Extractor interno",
+"Interview", "Entrevista",
+"Invalid", "Inválido",
+"Invalid adapter number '%s'\n", "Número de adaptador inválido '%s'\n",
+"Invalid target", "Selección inválida",
+"Jazz", "Música Jazz",
+"Keep", "Conservar",
+"Kill signal (pipe)", "Matar señal (tubería)",
+"Kill timeout (pipe/secs)", "Matar tiempo agotado (tubería/segs)",
+"LNA (low noise amplifier)", "LNA (amplificador de bajo sonido)",
+"LNB type", "Tipo de LNB",
+"Language", "Idiomas",
+"Language settings", "Ajustes de idioma",
+"Languages", "Idiomas",
+"Last seen", "Última vez visto",
+"Last updated from", "Última actualización desde",
+"Leisure hobbies", "Aficiones de ocio",
+"Limit connections", "Limitar conexiones",
+"Linked input", "Entrada adjunta",
+"Linux ATSC-C frontend", "índice Linux ATSC-C",
+"Linux ATSC-T frontend", "índice Linux ATSC-T",
+"Linux DVB frontend", "Interfaz Linux DVB",
+"Linux DVB-C frontend", "Interfaz Linux DVB-C",
+"Linux DVB-S frontend", "Interfaz Linux DVB-S",
+"Linux DVB-S slave frontend", "Interfaz esclava Linux DVB-S",
+"Linux DVB-T frontend", "Interfaz Linux DVB-T",
+"LinuxDVB adapter", "Adaptador LinuxDVB",
+"LinuxDVB network", "Red LinuxDVB",
+"Listen / Connect port", "Escuchar / Conectar en puerto",
+"Listen on IPv6", "Escuchar en IPv6",
+"Literature", "Literatura",
+"Local bind IP address", "Dirección IP de enlace local",
+"Local channel minor", "Canal menor local",
+"Local channel number", "Número local de canal",
+"Local discovery IP address", "Descubrir IP local",
+"Location", "Localización",
+"Location details of the SAT>IP Server.", "Detalles de la ubicación del servidor SAT>IP.",
+"Lock preferred CA PID", "Bloquear PID CA preferido",
+"Log", "Registro",
+"Login/Logout", "Entrar/Salir",
+"Low", "Bajo",
+"MPEG-TS Pass-thru", "Pasar a través de MPEG-TS",
+"MPEG-TS Pass-thru/built-in", "Pasar a través de/construido en MPEG-TS",
+"MPEG-TS input", "Entrada MPEG-TS",
+"MPEG-TS multiplex", "Multiplexo MPEG-TS",
+"MPEG-TS multiplex PHY", "Multiplexo MPEG-TS PHY",
+"MPEG-TS network", "Red MPEG-TS",
+"MPEG-TS raw service", "Servicio plano MPEG-TS",
+"MPEG-TS service", "Servicio MPEG-TS",
+"Magazines", "Revistas",
+"Maintain free storage space in MiB", "Mantener el espacio de almacenamiento libre en MiB",
+"Maintain used storage space in MiB (0=disabled)", "Mantener el espacio de almacenamiento utilizado en MiB (0 = desactivado)",
+"Maintained space", "Espacio mantenido",
+"Make subdirectories per channel", "Crear subdirectorios por Canal",
+"Make subdirectories per day", "Crear subdirectorios por día",
+"Make subdirectories per title", "Crear subdirectorios por título",
+"Manufacturer", "Manufacturador",
+"Manufacturer URL", "URL de Manufacturador",
+"Manufacturer's model number.", "Número de modelo del fabricante.",
+"Manufacturer's product description.", "Descripción de producto del fabricante.",
+"Manufacturer's product information page for the device.", "La página de información de producto del fabricante para el dispositivo.",
+"Manufacturer's product name.", "Nombre de producto del fabricante.",
+"Map all services", "Mapear todos los servicios",
+"Map encrypted services", "Mapa de cifrado de servicios",
+"Map radio channels", "Mapear canales de radio",
+"Map unnamed channels", "Mapear canales sin nombre",
+"Map zero-numbered channels", "Mapear canales sin numerar",
+"Master tuner", "Sintonizador maestro",
+"Matroska specific", "Especificidad matroska",
+"Maximal channel number", "Número de canal máximo",
+"Maximum # input streams", "Máximas # entradas de retransmisiones",
+"Maximum PIDs", "Máximos PIDs",
+"Maximum RAM size (MB)", "Máximo tamaño de RAM (MB)",
+"Maximum bandwidth (Kbps)", "Máximo ancho de banda (Kbps)",
+"Maximum count (0=default)", "Recuento máximo (0=por defecto)",
+"Maximum duration", "Máxima duración",
+"Maximum length in characters for the command setting PIDs to the SAT>IP box.", "Longitud máxima de caracteres para el ajuste de comandos en los PID a la caja SAT>IP.",
+"Maximum length of PIDs", "Máxima longitud de PIDs",
+"Maximum period (mins)", "Periodo máximo (mins)",
+"Maximum schedules limit (0=default)", "Límite máximo en espera (0=por defecto)",
+"Maximum size (MB)", "Tamaño máximo (MB)",
+"Maximum timeout (seconds)", "Máxima tiempo agotado (segundos)",
+"Medicine", "Medicina",
+"Merge same name", "Combinar mismo nombre",
+"Minimal channel number", "Número de canal mínimo",
+"Minimum duration", "Duración mínima",
+"Minimum rotor time (seconds)", "Velocidad de rotor mínima (segundos)",
+"Missing In PAT/SDT", "Perdido en PAT/SDT",
+"Mode", "Modo",
+"Model description", "Descripción de modelo",
+"Model name", "Nombre de modelo",
+"Model number", "Número de modelo",
+"Modulation", "Modulación",
+"Module", "Modulo",
+"Module ID", "ID de Módulo",
+"Mon", "Lun",
+"More verbose libav log", "Registro libav más detallado",
+"Motor rate (milliseconds/deg)", "Velocidad de rotor (milisegundos/grados)",
+"Motor sport", "Deporte de moto",
+"Motoring", "Automovilismo",
+"Movie", "Película",
+"Multiple lines of the cron time specification. The default cron triggers the Over-the-air grabber daily at 02:04 and 14:04. See Help on how to define your own.", "Varias líneas de la especificación tiempo cron. El cron por defecto desencadena a diario la capturación de Over-the-air a las 02:04 y 14:04. Consulte la Ayuda sobre cómo definir el suyo propio.",
+"Multiple lines of the cron time specification. The default cron triggers the internal grabbers daily at 12:04 and 00:04. See Help on how to define your own.", "Varias líneas de la especificación de tiempo cron. El cron por defecto desencadena los capturadores internos diariamente a las 12:04 y 00:04. Consulte la Ayuda sobre cómo definir el suyo propio.",
+"Music", "Música",
+"Mux handling", "Manipulación de mux",
+"Mux name", "Nombre de mux",
+"Mux not enabled", "Mux no habilitado",
+"Mux schedule entry", "Mux de entrada aplazada",
+"NONE", "Ninguno",
+"Name", "Nombre",
+"Names", "Nombres",
+"Natural sciences", "Ciencias naturales",
+"Nature", "Naturaleza",
+"Network", "Red",
+"Network A", "Red A",
+"Network B", "Red B",
+"Network ID (limit scanning)", "ID de red (límite escaneando)",
+"Network UUID", "UUID de Red",
+"Network access", "Acceso a la red",
+"Network discovery", "Descubrimiento de red",
+"Network name", "Nombre de red",
+"Network prefix", "Prefijo de Red",
+"Network settings", "Ajustes de red",
+"Network type", "Tipo de red",
+"Networks", "Redes",
+"News", "Noticias",
+"News magazine", "Revista de noticias",
+"Next tune delay in ms (0-2000)", "Retraso al siguiente sintonizador en ms (0-2000)",
+"No PIN", "Sin PIN",
+"No access", "Sin acceso",
+"No adapters specified!\n", "No se han especificado adaptadores!\n",
+"No assigned adapters", "Sin adaptadores asignados",
+"No days", "No hay días",
+"No descrambler", "Sin descodificador",
+"No free adapter", "No hay ningún adaptador libre",
+"No input detected", "No hay ninguna entrada detectada",
+"No service assigned to channel", "No existe un servicio asignado al canal",
+"No service enabled", "No hay un servicio habilitado",
+"No source available", "Origen no disponible",
+"None", "Ninguno",
+"Not all SAT>IP servers use the same signal scaling. Change this setting if the signal level displayed within Tvheadend looks too low.", "No todos los servidores SAT>IP utilizan la misma escala de señal. Cambie este ajuste si el nivel de señal que se muestra dentro de Tvheadend parece demasiado bajo.",
+"Not enough memory", "No hay suficiente memoria",
+"Not linked", "Sin unir",
+"Not set", "Sin configurar",
+"Not set (none or channel configuration)", "No seleccionado (nada o configuración de canal)",
+"Not set (use channel or DVR configuration)", "No seleccionado (usar canal o configuración DVR)",
+"Number", "Número",
+"Number of seconds to wait before timing out.", "Número de segundos a esperar para llegar al tiempo agotado.",
+"Number of tsfile tuners", "Número de sintonizadores tsarchivos",
+"OK (partial)", "OK (parcial)",
+"OSCam new pc-nodmx (rev >= 10389)", "Nuevo pc-nodmx de Oscar (rey >= 10389)",
+"Odd key", "Clave odd",
+"Off", "Apagado",
+"Older OSCam", "Viejo OSCam",
+"On", "Encendido",
+"On file removal", "En eliminación del archivo",
+"Only Bulsatcom 39E", "Solo Bulsatcom 39E",
+"Only EIT", "Solo EIT",
+"Only OpenTV Sky Ausat", "Solo OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Solo OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Solo OpenTV Sky UK",
+"Only PSIP (ATSC)", "Solo PSIP (ATSC)",
+"Only UK Freesat", "Solo UK Freesat",
+"Only UK Freeview", "Solo UK Freeview",
+"Only Viasat Baltic", "Solo Viasat Baltic",
+"Only preferred CA PID", "Solo  CA PID preferido",
+"Only update the system clock (doesn't affect NTP driver) if the delta between the system clock and DVB time is greater than this. This can help stop excessive oscillations on the system clock.", "Sólo actualizar el reloj del sistema (no afecta al controlador NTP) si el delta entre la hora del reloj del sistema y DVB es mayor que este. Esto puede ayudar a detener las oscilaciones excesivas en el reloj del sistema.",
+"OpenTV channel number", "Número de canal OpenTV",
+"Opera", "Ópera",
+"Orbital position", "Posición orbital",
+"Orbital positions", "Posiciones orbitales",
+"Orbital positions.", "Posiciones orbitales.",
+"Original network ID", "ID de red original",
+"Other stream filter", "Otro filto de retransmisión",
+"Output directory for tsdebug", "Directorio de salida para tsdepuración",
+"Over-the-air", "A través del aire",
+"Over-the-air Cron multi-line", "Cronología multi-línea a través del aire",
+"Over-the-air EPG", "Guía a través del aire",
+"Over-the-air EPG grabber", "Extracción de guía a través del aire",
+"Over-the-air grabbers", "Extraccción de guía a través del aire",
+"Override the frontend type.", "Sobrescribir el tipo de índice.",
+"Owner", "Dueño",
+"Owner of the entry.", "Dueño de la entrada.",
+"Owner of the rule.", "Dueño de la regla.",
+"PEND", "PENDIENTE",
+"PIDs 21 in setup", "PIDs 21 en configuración",
+"PIDs in setup", "PIDs en configuración",
+"PIN inquiry match string", "Consulta de PIN de entrada",
+"PLP ID", "ID PLP",
+"PLS code", "Código PLS",
+"PLS mode", "Modo PLS",
+"Parent entry", "Entrada de causa",
+"Pass subscription weight", "Pasar peso de suscripción",
+"Pass subscription weight to the SAT>IP server (Tvheadend specific extension).", "Pase el peso de la suscripción a SAT>iP (extensión específica de Tvheadend).",
+"Password", "Contraseña",
+"Password2", "Contraseña2",
+"Passwords", "Contraseñas",
+"Path", "Ruta",
+"Path to a directory (folder) containing your picon collection. See Help for more detailed information.", "Camino al directorio (carpeta) que contiene su colección de picón. Consulte la Ayuda para obtener información más detallada.",
+"Path to an icon for this channel. This can be named however you wish, as either a local (file://) or remote (http://) image. See Help for more infomation.", "Camino a un icono de este canal. Esto puede ser nombrado como desee, ya sea como local (file://) o remotamente (http://). Consulte la Ayuda para obtener más información.",
+"Performing arts", "Artes escénicas",
+"Periodically save EPG to disk (hours)", "Guardado periódico de la guía en disco (horas)",
+"Persistent user interface level", "Nivel de interfaz de usuario persistente",
+"Physiology", "Fisiología",
+"Picon path (see Help)", "Ruta de Picon (ver Ayuda)",
+"Pilot", "Piloto",
+"Polarization", "Polarización",
+"Political issues", "Problemas Políticos",
+"Popular culture", "Cultura Popular",
+"Port", "Puerto",
+"Position", "Posición",
+"Position of the input.", "Posición de la entrada",
+"Post-processor command", "Comando de post-procesador",
+"Post-recording padding", "Postgrabaciones",
+"Post-remove command", "Comando de post-eliminación",
+"Power save", "Ahorro de energía",
+"Power-up time (ms) (15-200)", "Tiempo encendido (ms) (15-200)",
+"Pre-defined muxes", "Muxes pre-definidos",
+"Pre-recording padding", "Pregrabaciones",
+"Pre-school children's programs", "Programas para niños en edad preescolar",
+"Prefer picons over channel name", "Preferir picons sobre el nombre del canal",
+"Preferred CA PID", "CA PID Preferido",
+"Preferred service video type", "Tipo de servicio de vídeo preferido",
+"Presentation", "Presentación",
+"Presentation details.", "Detalles de presentación",
+"Press", "Prensa",
+"Prevents users from overriding the above user interface level setting and removes the view level drop-dowm from the interface.", "Evita que los usuarios anulen el ajuste del nivel de interfaz de usuario anterior y elimina el nivel de vista desplegable desde la interfaz.",
+"Priority", "Prioridad",
+"Priority (-10..10)", "Prioridad(-10..10)",
+"Private", "Privado",
+"Profile name", "Nombre del perfil",
+"Program identification (PID) number to compare. Zero means any. This comparison is processed only when service comparison is active and for the Conditional Access filter.", "Identificación de programa (PID), número de comparar. Cero significa ninguna. Esta comparación se procesa sólo cuando la comparación del servicio está activa y para el filtro de acceso condicional.",
+"Provider", "Proveedor",
+"Provider ID", "ID de Proveedor",
+"Provider network name", "Nombre de provedor de red",
+"Psychology", "Psicología",
+"Puppets", "Títeres",
+"Quad (4.0)", "Cuádruple (4.0)",
+"Quiz", "Pregunta",
+"RAM only", "Solo RAM",
+"RTSP port", "Puerto RTSP",
+"RTSP port (554 or 9983, 0 = disable)", "Puerto RTSP (554 o 9983, 0 = deshabilitado)",
+"RTSP/TCP (embedded data)", "RTSP/TCP (datos incrustados)",
+"Re-fetch period (hours)", "Periodo de recuperación (horas)",
+"Re-fetch period (mins)", "Periodo de Recuperación (mins)",
+"Re-record%s%s", "Re-grabar%s%s",
+"Re-try period (hours)", "Periodo de reintento (horas)",
+"Read error", "Error de lectura",
+"Real Time Streaming Protocol (RTSP) port the server should listen on (554 or 9983, 0 = disable).", "Protocolo de retransmisión en tiempo real Protocol (RTSP) el servidor debe escuchar en el puerto (554 o 9983, 0 = desactivar).",
+"Record all", "Grabar todo",
+"Record on these days only.", "Grabar en esos días unicamente.",
+"Recording file options", "Grabando opciones de archivo",
+"Recording file size.", "Tamaño del archivo de grabación.",
+"Recording system path", "Grabando ruta del sistema",
+"Reject", "Rechazar",
+"Religion", "Religión",
+"Religious", "Religioso",
+"Remarkable people", "Gente destacable",
+"Remove HTTP arguments", "Eliminar argumentos HTTP",
+"Remove all unsafe characters from filename", "Eliminar todos los carácteres inseguros del nombre del archivo",
+"Replace whitespace in title with '-'", "Reemplazar espacio en blanco con '-'",
+"Reply to CAM PIN inquiries", "Responder a consultas CAM PIN",
+"Reports", "Reportes",
+"Rerun of", "Volver a ejecutar",
+"Rescan", "Volver a escanear",
+"Reserved", "Reservado",
+"Resolution (height)", "Resolución (Altura)",
+"Respawn (pipe)", "Reaparecer (tubería)",
+"Restart on error", "Reiniciar en error",
+"Reuse EPG from", "Reusar guía desde",
+"Rewrite EIT", "Reescribir EIT",
+"Rewrite MPEG-TS SI tables", "Reescribir MPEG-TS SI tablas",
+"Rewrite PAT", "Reescribir PAT",
+"Rewrite PMT", "Reescribir PMT",
+"Rewrite Program Association Table (PMT) packets to only include information about the currently streamed service.", "Reescribir Programa en la Tabla Asociación (PMT), paquetes para incluir información sobre el servicio de streaming actual.",
+"Rewrite SDT", "Reescribir SDT",
+"Rotor initialization time (seconds)", "Tiempo de Iniciación del rotor (segundos)",
+"Rotor type", "Tipo de rotor",
+"Run as group", "Ejecutar como grupo",
+"Run as user", "Ejecutar como usuario",
+"Running", "Funcionando",
+"SAT->IP frontend number.", "Número de índice SAT->IP",
+"SAT>IP ATSC-C frontend", "índice SAT>IP ATSC-C",
+"SAT>IP ATSC-T frontend", "índice SAT>IP ATSC-T",
+"SAT>IP DVB frontend", "Interfaz DVB SAT>IP",
+"SAT>IP DVB-C frontend", "Interfaz DVB-C SAT>IP",
+"SAT>IP DVB-S frontend", "Interfaz DVB-S SAT>IP",
+"SAT>IP DVB-S slave frontend", "Interfaz esclava DVB-S SAT>IP",
+"SAT>IP DVB-T frequency (Hz)", "SAT>IP DVB-T frecuencia (Hz)",
+"SAT>IP DVB-T frontend", "Interfaz DVB-T SAT>IP",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "Número de puerto para el servidor SAT>IP RTSP\n(por defecto: -1 = deshabilitado, 0 = configuración web, el puerto estándar es 554)",
+"SAT>IP client", "Cliente SAT>IP",
+"SAT>IP server", "Servidor SAT>iP",
+"SAT>IP source number", "Número de fuente SAT>IP",
+"SD: standard definition", "SD: definición estándar",
+"SSL verify peer", "Verificar pares SSL",
+"Sat", "Sáb",
+"Satellite config", "Configuración de satelite",
+"Satellite longitude", "Longitud de satélite",
+"Satellite positions", "Posiciones de satélite",
+"Scan after creation", "Escanear después de crear",
+"Scan progress", "Progreso de escaneo",
+"Scan queue length", "Logitud de la lista de espera del escaneo",
+"Scan result", "Resultado del escaneo",
+"Scan status", "Estado del escaneo",
+"Schedule a re-recording if more errors than (0=off)", "Aplazar una re-grabación si so producen más errores que (0 = apagado)",
+"Schedule status", "Estado del escaneo",
+"Scheduled for recording", "Aplazado para grabación",
+"Scheduled start time", "Horario de comienzo programado",
+"Scheduled stop time", "Horario de fin programado",
+"School programs", "Programas de colegio",
+"Science", "Ciencia",
+"Science fiction", "Ciencia ficción",
+"Season", "Temporada",
+"Season %d", "Temporada %d",
+"Seek error", "Error de busqueda",
+"Select how Tvheadend should handle muxes. Auto = accept the mux if it doesn't already exist. Keep = Always keep the muxregardless of whether it exists or not. Reject = Always reject.", "Seleccione la forma con la cual Tvheadend debe manejar muxes. Auto = aceptar el mux si no existe ya. Mantener = Siempre mantenga el mux independientemente de si existe o no. Rechazar = Siempre se rechazan.",
+"Select the list of languages (in order of priority) to be used for supplying EPG information to clients that don't provide their own configuration.", "Seleccione la lista de idiomas (en orden de prioridad) que se utilizará para el suministro de la información EPG a los clientes que no proporcionan su propia configuración.",
+"Select the master tuner.The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, the polarization and low-high band settings must be equal.if you set other tuner as master, then this tuner will act like a slave one and tvheadend will assure that this tuner will not use incompatible parameters (position, polarization, lo-hi).", "Seleccione la señal tuner. La señal LNB universal estándar se puede dividir mediante un sencillo divisor coaxial (sin multiswitch) a varias salidas. En este caso, la posición, la configuración de polarización y bajo-alto de la banda debe ser igual. Si configura otro sintonizador como maestro, a continuación, este sintonizador actuará como un esclavo y un solo tvheadend asegurará que este sintonizador no utilizará los parámetros incompatibles (posición, polarización, lo-hi).",
+"Select the number of satellite positions supported by the SAT>IP hardware and your coaxial cable wiring.", "Seleccione el número de posiciones de los satélites con el apoyo del SAT>IP y el cableado de su cable coaxial.",
+"Select the path to use for DVB scan configuration files. Typically dvb-apps stores these in /usr/share/dvb/. Leave blank to use Tvheadend's internal file set.", "Seleccione la ruta a utilizar para los archivos de configuración de escaneo DVB. Típicamente dvb-apps los guarda en /usr/share/dvb/. Dejar en blanco para usar el conjunto de archivos internos de Tvheadend.",
+"Select whether or not to enable caching. Note: even with this disabled you can still specify local (file://) icons and these will be served by the built-in webserver.", "Seleccione si desea habilitar el almacenamiento en caché. Nota: incluso con esta deshabilitada aún puede especificar localmente (file://) iconos y demás serán servidos por el servidor web incorporado.",
+"Send CAPMT query", "Enviar consulta CAPMT",
+"Send full PLAY cmd", "Enviar reproducción completa cmd",
+"Send the full RTSP PLAY command after full RTSP SETUP command. Some devices firmware require this to get an MPEG-TS stream.", "Enviar el comando completo de RTSP PLAY y después el comando completo CONFIGURACIÓN RTSP. Algunos dispositivos de firmware requieren de esto para conseguir un flujo MPEG-TS.",
+"Serial number", "Número de serie",
+"Series link", "Enlace a series",
+"Serious", "Serio/a",
+"Serious music", "Música Seria",
+"Server", "Servidor",
+"Server UUID", "Servidor UUID",
+"Server connectivity", "Conectividad del servidor",
+"Server details.", "Detalles de servidor.",
+"Service", "Servicio",
+"Service ID", "ID del Servicio",
+"Service configuration", "Configuración del servicio",
+"Service count %zi", "Recuento de servicio %zi",
+"Service mapper", "Mapeador de servicio",
+"Service mapping", "Mapeado de servicio",
+"Service name", "Nombre del servicio",
+"Service raw", "Texto plano del servicio",
+"Service type", "Tipo de servicio",
+"Services", "Servicios",
+"Set the display name.", "Establezca el nombre para mostrar.",
+"Set the maxiumum packet identifiers your SAT>IP server supports.", "Establezca los identificadores de paquete máximos que su SAT> Servidor IP soporta.",
+"Set the name of the server so you can distinguish multiple instances apart on your LAN.", "Establezca el nombre del servidor para que pueda distinguir varias instancias, aparte de su LAN.",
+"Set the priority of this configuration.", "Establecer la prioridad en esta configuración.",
+"Sets the default interface view level (next to the help button).", "Establece el nivel de vista de la interfaz por defecto (al lado del botón de ayuda).",
+"Settings", "Ajustes",
+"Show", "Mostrar",
+"Show this page", "Mostrar esta página",
+"Show version information", "Mostrar información de versión",
+"Show, hide and sort the various details that appear on the interface next to the About tab.", "Mostrar, ocultar y ordenar los diversos detalles que aparecen en la interfaz de al lado de la pestaña Acerca de.",
+"Signal quality too poor", "Calidad de señal muy pobre",
+"Signal scale (240 or 100)", "Escala de señal (240 o 100)",
+"Site latitude", "Latitud del sitio",
+"Site longitude", "Longitud del sitio",
+"Skip TS packets (0-200)", "Saltar paquetes TS (0-200)",
+"Skip TSID checking. For when providers use invalid Transport Stream IDs.", "Saltar chequeos TSID. Para cuando los proveedores usan identificadores de transporte no válidos.",
+"Skip commercials", "Saltar comerciales",
+"Skip initial bytes", "Saltar bytes iniciales",
+"Skip initial scan", "Saltar escaneo inicial",
+"Skip x number of transport packets.", "Saltar x número de paquetes de transporte.",
+"Slave entry", "Entrada esclava",
+"Slot state", "Estado del espacio",
+"Soap", "Telenovela",
+"Soccer", "Fútbol",
+"Social advisory", "Asesoramiento social",
+"Sort index", "Ordenar índice",
+"Source", "Origen",
+"Source deleted", "Origen eliminado",
+"Source quality is bad", "La Fuente de calidad es mala",
+"Source reconfigured", "Fuente reconfigurada",
+"Southern hemisphere (latitude direction)", "Hemisferio sur (dirección latitud)",
+"Special events (Olympic Games, World Cup, etc.)", "Eventos especiales (Juegos Olímpicos, Copa del Mundo, etc.)",
+"Specify User-Agent header for the http client", "Especifique cabecera User-Agent para el cliente http",
+"Specify alternative htsp port", "Especifique alternativa al puerto htsp",
+"Specify alternative http port", "Especifique alternativa al puerto http",
+"Specify alternative http webroot", "Especifique alternativa al puerto http webroot",
+"Specify bind address", "Especificar dirección unida",
+"Specify extra htsp port", "Especificar puerto htsp extra",
+"Spiritual sciences", "Ciencias espirituales",
+"Sports", "Deportes",
+"Sports magazines", "Revistas de deportes",
+"Standard", "Por defecto",
+"Start", "Inicio",
+"Start after", "Iniciar después de",
+"Start before", "Iniciar antes de",
+"Start time", "Tiempo de inicio",
+"Status", "Estado",
+"Status period (ms)", "Periodo de estado (ms)",
+"Stop", "Parar",
+"Stop time", "Parar tiempo",
+"Storage path", "Ruta de almacenamiento",
+"Storage space", "Espacio de almacenamiento",
+"Stream ID", "ID de Retransmisión",
+"Stream index", "Índice de retransmisión",
+"Stream profile", "Perfil de retransmisión",
+"Stream type", "Tipo de retransmisión",
+"Streaming", "Retransmisión",
+"Streaming priority", "Prioridad de retransmisón",
+"Streaming profiles", "Perfil de retransmisión",
+"Subdirectory options", "Opciones de subdirectorio",
+"Subscribe to a service permanently", "Suscribir a un servicio permanentemente",
+"Subscription overridden", "Suscripción anulada",
+"Subscription weight", "Peso de suscripción",
+"Substitute formatters", "Formatos de subtítulos",
+"Subtitle", "Subtítulo",
+"Subtitle codec", "Códec de subtítulo",
+"Subtitle stream filter", "Filtro de subtítulos en retransmisión",
+"Sun", "Dom",
+"Surround (2 front, rear mono)", "Envolvente (2 frontales, posterior mono)",
+"Switch before rotor", "Cambiar después del rotor",
+"Switch type", "Cambiar tipo",
+"Switch: %s", "Cambiar: %s",
+"Symbol rate (Sym/s)", "Tasa de símbolos (Símb/s)",
+"Sync", "Sincronizar",
+"Sync + Don't keep", "Sincronizar + No recordar",
+"System", "Sistema",
+"Tag files with metadata", "Categoría de archivos con metadatos",
+"Tags", "Categorías",
+"Talk show", "Programa de entrevistas",
+"Team sports (excluding football)", "Deportes de quipo (excluyendo fútbol)",
+"Technology", "Tecnología",
+"Teletext stream filter", "Filtro de retransmisión de teletexto",
+"Teletext stream type is only available for this filter.", "Éste tipo de flujo de teletexto sólo está disponible para este filtro.",
+"Tennis", "Tenis",
+"Testing", "Pruebas",
+"Testing options", "Opciones de prueba",
+"The ATSC source ID as set by the provider.", "La identificación de la fuente ATSC según lo establecido por el proveedor.",
+"The CA provider to compare. Leave blank to apply to all providers.", "El proveedor de CA para comparar. Dejar en blanco para aplicar a todos los proveedores.",
+"The CA stream type is only available for this filter.", "El tipo de corriente CA sólo está disponible para este filtro.",
+"The CAID to compare. Leave blank to apply to all IDs.", "El CAID para comparar. Dejar en blanco para aplicar a todos los ID.",
+"The Content reference identifier (CRID) authority.", "Identificador de la autoridad de contenido de referencia (CRID).",
+"The MPEGTS stream type is only available for this filter.", "El tipo de flujo MPEGTS sólo está disponible para este filtro.",
+"The OpenTV channel number as set by the provider.", "El número de canales de TV abierta según lo establecido por el proveedor.",
+"The Preferred Conditional Access Packet Identifier. Used for decrypting scrambled streams.", "Recomendado: Acceso Condicional de Paquete Identificador. Se utiliza para descifrar corrientes revueltas.",
+"The SAT>IP server's name.", "El nombre del servidor de SAT> IP.",
+"The SAT>IP server's universally unique identifier.", "El servidor SAT>IP universalmente identificador único.",
+"The SAT>IP's discovered IP address.", "La dirección IP descubierta por SAT>IP",
+"The audio stream types the filter should apply to.", "Los tipos de streaming de audio del filtro deben aplicarse.",
+"The character encoding for this service (e.g. UTF-8).", "La codificación de caracteres para este servicio (por ejemplo, UTF-8).",
+"The character set used on this mux. You should not have to change this unless channel names, etc  appear garbled.", "El conjunto de caracteres utilizado en este mux. Usted no debería tener que cambiar esto a menos que los nombres de los canales, etc aparezcan distorsionados.",
+"The current boot ID.", "El ID de inicio actual.",
+"The current configuration ID.", "El ID de configuración actual.",
+"The current configuration version.", "La versión actual de configuración.",
+"The default language to use if the user  language isn't set in the Access Entries tab.", "El idioma por defecto a utilizar si el idioma del usuario no se encuentra en la pestaña de acceso.",
+"The default subscription weight for each subscription.", "La fuerza de suscripción predeterminada para cada suscripción.",
+"The device ID.", "La ID del dispositivo.",
+"The device's serial number.", "Número de serie del dispositivo.",
+"The frequency of the mux (in Hertz).", "La frecuencia del mux (en Hercios).",
+"The language the filter should apply to.", "El idioma del filtro debe aplicarse.",
+"The locking mechanism selection for The Preferred Conditional Access Packet Identifier. See Help for more information.", "La selección mecanismo de bloqueo para el Acceso Condicional  Preferido de Identificación de Paquetes. Consulte la Ayuda para obtener más información.",
+"The logical stream index to compare. Note that this index is computed using all filters.Example: If filter is set to AC3 audio type and the language to 'eng' and there are two AC3 'eng' streams in the service, the first stream could be identified using number 1 and the second using number 2.", "El índice de flujo lógico a comparar. Tenga en cuenta que este índice se calcula utilizando todos los filtros. Ejemplo: Si el filtro se establece en tipo de audio AC3 y el idioma a 'eng' y hay dos corrientes AC3 'eng' en el servicio, la primera corriente se pudo identificar mediante el número 1 y la segundo utilizando el número 2.",
+"The manufacturer of the SAT>IP server.", "El fabricante del servidor SAT>IP.",
+"The maximum number of services to decrypt per mux.", "El número máximo de servicios para descifrar por mux.",
+"The minimum delay before tuning in milliseconds after tuner stop. If the time between the previous and next start is greater than this value then the delay is not applied.", "El retardo mínimo antes de dar una vuelta en milisegundos después de la parada del sintonizador. Si el tiempo transcurrido entre el inicio anterior y siguiente es superior a este valor, entonces no se aplica la demora.",
+"The modulation used on the mux.", "La modulación usada por el mux.",
+"The multiplex (mux) is tuned for this amount of time at most. If the EPG data is complete before this limit, the mux is released sooner.", "El múltiplexo (MUX) está sintonizado para esta cantidad de tiempo como máximo. Si los datos de el EPG se completan antes de este límite, el mux se libera antes.",
+"The mux the service is on.", "El servicio de mux está encendido.",
+"The mux's universally unique identifier.", "Identificador único universal del mux.",
+"The network the service is on.", "La red de servicio está activada.",
+"The networks using this configuration.", "La red está usando esta configuración.",
+"The number of ATSC-C (Cable/AnnexB) tuners to export.", "El número de ATSC-C (Cable/AnnexB) sintonizadores para exportar.",
+"The number of ATSC-T (Terresterial) tuners to export.", "El número de ATSC-T (Terrestres) sintonizadores para exportar.",
+"The number of DVB-C (Cable) tuners to export.", "El número de DVB-C (Cable) sintonizadores para exportar.",
+"The number of DVB-C2 (Cable) tuners to export.", "El número de DVB-C2 (Cable) sintonizadores para exportar.",
+"The number of DVB-S (Satellite) tuners to export.", "El número de DVB-S (Satélite) sintonizadores para exportar.",
+"The number of DVB-S2 (Satellite) tuners to export.", "El número de DVB-S2 (Satélite) sintonizadores para exportar.",
+"The number of DVB-T (Terresterial) tuners to export.", "El número de DVB-T (Terrestres) sintonizadores para exportar.",
+"The number of DVB-T2 (Terresterial) tuners to export.", "El número de ATSC-T2 (Terrestres) sintonizadores para exportar.",
+"The number of days cookies set by Tvheadend should expire.", "El número de días de cookies creados por Tvheadend en los que debe expirar.",
+"The outcome of the last scan performed on this mux.", "El resultado del último análisis realizado en este mux.",
+"The provider's name.", "El nombre del proveedor.",
+"The provider's network ID.", "ID de provedor de red.",
+"The provider's network name.", "Nombre de provedor de red",
+"The rule action defines the operation when all comparisons succeed. See Help for more information on what the various rules do.", "La acción de la regla define la operación cuando todas las comparaciones tengan éxito. Consulte la Ayuda para obtener más información sobre lo que hacen las distintas reglas.",
+"The scan state. New muxes will automatically be changed to the PEND state. You can change this to ACTIVE to queue a scan of this mux.", "El estado de exploración. Nuevos muxes serán automáticamente cambiados al estado PENDIENTE. Usted puede cambiar esto a ACTIVO para hacer cola a una exploración de este mux.",
+"The service ID as set by the provider.", "La ID del servicio puesta por el proveedor.",
+"The service name as set by the provider.", "El nombre del servicio según lo establecido por el proveedor.",
+"The service the filter should apply to. Leave blank to apply the filter to all services.", "El servicio de filtro debe aplicarse. Dejar en blanco para aplicar el filtro a todos los servicios.",
+"The service type flag as defined by the DVB specifications (e.g. 0x02 = radio, 0x11 = MPEG2 HD TV, 0x19 = H.264 HD TV)", "La bandera de tipo de servicio según la definición de las especificaciones DVB (por ejemplo, 0x02 = radio, 0x11 = HDTV MPEG2, 0x19 = H.264 HD TV)",
+"The service's channel minor as set by the provider.", "Canal menor del servicio según lo establecido por el proveedor.",
+"The service's channel number as set by the provider.", "Número de canal del servicio según lo establecido por el proveedor.",
+"The subtitle stream types the filter should apply to.", "Los tipos de flujo de subtitulo de filtro que deben aplicarse.",
+"The symbol rate.", "Ratio de símbolos.",
+"The total number of services found on this mux.", "El número total de servicios encontrados en este mux.",
+"The transport stream ID of the mux within the network.", "El ID de flujo de transporte del mux dentro de la red.",
+"The video stream types the filter should apply to.", "Los tipos de flujo de vídeo del filtro deben aplicarse.",
+"This tuner", "Este sintonizador",
+"This will create an NTP driver (using shmem interface) that you can feed into ntpd. This can be run without root privileges, but generally the performance is not that great.", "Esto creará un controlador de NTP (utilizando la interfaz shmem) que se puede alimentar en ntpd. Esto se puede ejecutar sin privilegios de root, pero en general el rendimiento no es tan grande.",
+"Thriller", "Programa de suspense",
+"Thu", "Jue",
+"Time", "Tiempo",
+"Time missed", "Tiempo olvidado",
+"Time record caption", "Tiempo de captación para grabación",
+"Time recording%s%s", "Tiempo de grabación%s%s",
+"Time update", "Actualización de tiempo",
+"Timeout (sec) (0=infinite)", "Tiempo agotado (seg) (0=infinito)",
+"Timeout (seconds)", "Tiempo agotado (segundos)",
+"Timeshift", "Cambio de hora",
+"Timout (secs)", "Tiempo agotado (segs)",
+"Title", "Título",
+"Title (regexp)", "Título (regexp)",
+"Toggle details", "Ver detalles",
+"Tone burst", "Tono de ráfaga",
+"Tourism / Travel", "Turismo / Viajes",
+"Trace subsystems", "Trazar subsistemas",
+"Traditional arts", "Artes tradicionales",
+"Traditional music", "Música tradicional",
+"Transcoding", "Transcodificar",
+"Transmission mode", "Modo de transmisión",
+"Transponder ID", "ID de Transpondedor",
+"Transport stream ID", "ID de retransmisión de transporte",
+"Tue", "Mar",
+"Tune before DiseqC", "Sintonizar depués de DiseqC",
+"Tuner bind IP address", "Sintonización de IP local",
+"Tuner configuration", "Configuración de sintonización",
+"Tuning failed", "Sintonización fallida",
+"Turn off LNB when idle", "Apagar LNB en espera",
+"Tvheadend server name", "Nombre de servidor de Tvheadend",
+"Type", "Tipo",
+"UDP RTP port number (2 ports)", "Nombre de puerto UDP RTP (2 puertos)",
+"URL of the M3U playlist.", "URL para la lista de reproducción M3U.",
+"URL with the SAT>IP server XML location", "URL con la locación XML de SAT>IP",
+"USALS rotor", "Rotor USALS",
+"Uncommitted", "No confirmado",
+"Uncommitted first", "No confirmado primero",
+"Unicable", "Un solo cable",
+"Unicable switch (universal LNB, experimental)", "Switch de un solo cable (LNB universal, experimental)",
+"Unicable type", "Tipo de un sólo cable",
+"Unimportant", "Sin importancia",
+"Universal LNB only", "LNB Universal únicamente",
+"Universally unique identifier. Read only.", "Identificador único universal. Solo lectura.",
+"Unknown", "Desconocido",
+"Unknown file", "Archivo desconocido",
+"Unknown reason (%i)", "Razón desconocida (%i)",
+"Unlimited size", "Tamaño ilimitado",
+"Unlimited time", "Tiempo ilimitado",
+"Unset (default)", "Sin definir (por defecto)",
+"Update card (EMM)", "Actualizar tarjeta (EMM)",
+"Update channel icon", "Actualizar icono del canal",
+"Update channel name", "Actualizar nombre del canal",
+"Update channel number", "Actualizar número del canal",
+"Update disabled", "Actualizar deshabilitado",
+"Update time", "Actualizar hora",
+"Update tolerance (ms)", "Tolerancia de Actualización (ms)",
+"Updated", "Actualizado",
+"Usage: %s [OPTIONS]\n", "Uso: %s [OPTIONS]\n",
+"Use EPG running state", "Usar estado de la guía",
+"Use Windows-compatible filenames", "Usar nombres de archivo compatibles con Windows",
+"Use XSPF playlist instead of M3U", "Usar lista XSPF en vez de M3U",
+"Use a pre-defined list of ATSC-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Utilice una lista predefinida de muxes ATSC. Nota: estas listas pueden estar a veces obsoletas y pueden causar digitalización más tardía de lo habitual.",
+"Use a pre-defined list of ATSC-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Utilice una lista predefinida de muxes ATSC-T. Nota: estas listas pueden estar a veces obsoletas y pueden causar una digitalización tardía.",
+"Use a pre-defined list of DVB-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Utilice una lista predefinida de muxes DVB-C. Nota: estas listas pueden estar a veces obsoletas y pueden causar una digitalización tardía.",
+"Use a pre-defined list of DVB-S/S2 muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Utilizar una lista predefinida de DVB-S / S2 muxes. Nota: estas listas pueden ser a veces obsoletas y pueden causar una digitalización más tardía de lo habitual.",
+"Use a pre-defined list of DVB-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Utilice una lista predefinida de muxes DVB-T. Nota: estas listas pueden ser a veces obsoletas y puede causar digitalización más tardía de lo habitual.",
+"Use original", "Usar original",
+"Use service IDs as channel numbers", "Usar ID del servicio como números de canal",
+"User access error", "Error de usuario",
+"User icon", "Icono de usuario",
+"User interface level", "Nivel de interfaz de usuario",
+"User interface quick tips", "Consejos rápidos en la interfaz de usuario ",
+"User language", "Idioma de usuario",
+"User limit reached", "Límite de usuarios alcanzado",
+"User login", "Login de usuario",
+"Username", "Usuario",
+"Variety show", "Show variado",
+"Video bitrate (kb/s) (0=auto)", "Tasa de muestreo de vídeo (kb/s) (0=Auto)",
+"Video codec", "Códec de Video",
+"Video recorder", "Grabador de vídeo",
+"Video stream filter", "Filtro de retransmisión de vídeo",
+"Visually impaired commentary/audio description", "Discapacidad visual comentario/audiodescripción",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV perfil H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV perfil H264/AAC/Matroska ",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV perfil VP8/Vorbis/WEBM ",
+"Waiting for EPG running flag", "Esperando por Guía funcionando con la característica",
+"Waiting for program start", "Esperando el inicio del programa",
+"Waiting for stream", "Esperando para difundir",
+"War", "Guerra",
+"Water sport", "Deporte de agua",
+"Weak stream", "Retransmisión débil",
+"Weather report", "El Tiempo",
+"Web interface", "Interfaz Web",
+"Web interface language", "Lenguaje de la interfaz web",
+"Web user interface", "Interfaz web de usuario",
+"Wed", "Mié",
+"Welcome - Tvheadend - your TV streaming server and video recorder", "Bienvenido - Tvheadend - tu servidor de televisión y grabación de vídeos",
+"Western", "Oeste",
+"Western hemisphere (latitude direction)", "Hemisferio occidental (dirección latitud)",
+"When the service was first identified and recorded.", "Cuando el servicio se identificó y registró por primera vez",
+"When the service was last seen during a mux scan.", "Cuando el servicio fue visto por última vez durante una exploración mux.",
+"Wizard", "Asistente",
+"Wrapper (capmt_ca.so)", "Envoltura (capmt_ca.so)",
+"Write a short message to log identifying the matched parameters. It is useful for debugging your setup or structure of incoming streams.", "Escribe un mensaje corto para registrar la identificación de los parámetros emparejados. Es útil para depurar la configuración o la estructura de los flujos entrantes.",
+"Writes the current in-memory EPG database to disk every x hours, so should a crash/unexpected shutdown occur EPG data is saved periodically to the database (re-read on next startup). Set to 0 to disable.", "Escribe la base de datos EPG actual en la memoria en el disco cada x horas, así podría ocurrir un accidente / apagado inesperado y los datos EPG se guardarían periódicamente en la base de datos (re-leído en el siguiente inicio). Se establece en 0 para desactivar.",
+"Yes", "Sí",
+"addpids/delpids supported", "addpids/delpids soportado",
+"hrs", "horas",
+"invalid option specified [%s]", "opcion inválida especificada [%s]",
+"min", "min.",
+"mins", "mins.",
+"option %s requires a value", "la opción %s requiere un valor",
+"tsfile input (mux file)", "entrada tsfile (archivo mux)",
+"tvhdhomerun client", "Cliente tvhdhomerun",
+NULL, NULL
+};
+
+static const char *tvh_locale_8[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nLisainformatsiooniks külastage Tvheadend'i veebilehte:\nhttps://tvheadend.org\n",
+"# Channels", "# Kanalid",
+"# Mapped channels", "# Seostatud kanalid",
+"# Muxes", "# Muxid",
+"# Services", "# Teenused",
+"# Services seen", "# Teenuseid nähtud",
+"(Default profile)", "(Vaikimisi profiil)",
+"1 day", "1 päev",
+"1 month", "1 kuu",
+"1 week", "1 nädal",
+"1 year", "1 aasta",
+"2 months", "2 kuud",
+"2 weeks", "2 nädalat",
+"2 years", "2 aastat",
+"2-Port switch (universal LNB)", "2 pordine switch (universaalne LNB)",
+"3 days", "3 päeva",
+"3 months", "3 kuud",
+"3 weeks", "3 nädalat",
+"3 years", "3 aastat",
+"4-Port switch (universal LNB)", "4 pordine switch (universaalne LNB)",
+"5 days", "5 päeva",
+"6 months", "6 kuud",
+"ACTIVE", "AKTIIVNE",
+"AES constant code word client", "AES 'constant code word' klient",
+"ANY", "IGASUGUNE",
+"ATSC source ID", "ATSC lähteallika ID",
+"ATSC-C network", "ATSC-C võrk",
+"ATSC-T network", "ATSC-T võrk",
+"AUTO", "AUTOMAATNE",
+"Aborted by user", "Katkestatud kasutaja poolt",
+"Accept remote subscription weight", "Luba kauge liitumise kaalukus",
+"Access", "Ligipääs",
+"Action", "Põnevus",
+"Adapter in use by another subscription", "Adapter on hõivatud mõne muu liitumisega",
+"Add file and line numbers to debug", "Lisa fail ja rea number debugimiseks",
+"Add the thread ID to debug", "Lisa threedi ID debugimiseks",
+"Admin password", "Administraatori salasõna",
+"Admin username", "Administraatori kasutajanimi",
+"Administrator login", "Administraatori sisselogimine",
+"Adult movie", "Täiskasvanute film",
+"Advanced", "Täppis",
+"Adventure", "Seiklus",
+"Advertisement / Shopping", "Reklaam / Ostlemine",
+"All (Streaming plus DVR)", "Kõik (voogedastus + DVR)",
+"All DVR (rw)", "Kõik DVR (rw)",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Kõik tulud kasutatakse serverite taristu ülalpidamiseks ja testseadmete hankimiseks.",
+"Allow to show the quick tips for the form fields.", "Luba näidata täidetavate väljade kohta vihjeid",
+"Allowed network", "Lubatud võrk",
+"Alternate PID path", "Alternatiivne PID viide",
+"Alternate configuration path", "Alternatiivne seadistuste viide",
+"Altitude (meters)", "Kõrgus merepinnast (meetrites)",
+"Animals", "Loomad",
+"Any", "Mingisugune",
+"Arts", "Kunstid",
+"Athletics", "Kergejõustik",
+"Audio bitrate (kb/s) (0=auto)", "Audio bitikiirus (kb/s) (0=automaatne)",
+"Audio codec", "Audio koodek",
+"Audio stream filter", "Audio voogedastuse filter",
+"Auto", "Automaatne",
+"Auto check disabled", "Automaatne kontroll välja lülitatud",
+"Auto check enabled", "Automaatne kontroll sisse lülitatud",
+"Auto record", "Automaatselt salvesta",
+"Auto record caption", "Automaatse salvestuse tekst",
+"Auto recording%s%s", "Automaatne salvestamine%s%s",
+"Auto time record", "Automaatse kellaajaga salvestus",
+"Auto-Map to channels", "Automaatseosta kanaliteks",
+"Automatic checking", "Automaatne kontollimine",
+"Automatically map EPG source", "Automaatselt seosta EPG allikas",
+"Automatically name from network", "Nimeta automaatselt võrgust",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Automaatselt uuenda kanali ikoone kasutades EPG pakkujate poolset infot. Märkus: sellega võib kaasneda mittesoovitud muutusi juba paika sätitud ikoonidega.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Automaatselt uuenda kanali nimesid kasutades EPG pakkujate poolset infot. Märkus: sellega võib kaasneda mittesoovitud muutusi juba paika sätitud nimedega.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Automaatselt uuenda kanali numeratsiooni kasutades EPG pakkujate poolset infot. Märkus: sellega võib kaasneda mittesoovitud muutusi juba paika sätitud numeratsiooniga.",
+"Autorec maximum count (0=unlimited)", "Automaatsalvestuse maksimum arv (0=piiranguteta)",
+"Autorec maximum schedules limit (0=unlimited)", "Automaatsalvestuse ajastamiste maksimaalne arv (0=piiranguteta) ",
+"Bad", "Halb",
+"Ballet", "Ballett",
+"Bandwidth", "Võrguühendus",
+"Based on software from", "Põhineb järgneval tarkvaral:",
+"Basic", "Tavaline",
+"Bind to specific local IP address.", "Seostu konkreetse lokaalse IP aadressiga.",
+"Bouquet", "Kanalite kimp",
+"Bouquet (auto)", "kanalite kimp (automaatne)",
+"Brand", "Bränd",
+"Broadcast", "Levi",
+"Broadcasting", "Levitamine",
+"Build", "Versioon",
+"CA client %i", "CA klient %i",
+"CA identification", "CA tuvastamine",
+"CA provider", "CA pakkuja",
+"CA stream filter", "CA voogedastuse filter",
+"CAPMT interval (ms)", "CAPMT intervall (ms)",
+"CAPMT query interval (ms)", "CAPMT päringu intervall (ms)",
+"Cache scheme", "Puhvri mall",
+"Cartoons", "Multikad",
+"Channel", "Kanal",
+"Channel icon", "Kanali ikoon",
+"Channel icon path (see Help)", "Viide kanali ikoonile (vaata Abi) ",
+"Channel name", "Kanali nimi",
+"Channel number", "Kanali number",
+"Channel number offset", "Kanali numbrite tasakaalustus",
+"Channel numbers from", "Kanali numbrid alates",
+"Channel tag", "Kanali märge",
+"Channel tag reference", "Kanali märke viide",
+"Channel tags", "Kanali märked",
+"Channels", "Kanalid",
+"Character set", "Tähestik kooditabeli alusel",
+"Check availability", "Kontrolli saadavust",
+"Children's / Youth programs", "Laste- või noortesaated",
+"Cinema", "Kino",
+"Class", "Klass",
+"Classical", "Klassikaline",
+"Classical music", "Klassikaline muusika",
+"Clean effects", "Puhasta efektid",
+"Client name", "Kliendi nimi",
+"Clone scheduled entry on error", "Klooni ajastatud kirje vea juhtumisel ",
+"Comedy", "Komöödia",
+"Command delay time (ms) (10-200)", "Käskluse viite aeg (ms) (10-200)",
+"Command time (ms) (10-100)", "Käskluse aeg (ms) (10-100)",
+"Comment", "Kommentaar",
+"Commercial break", "Kommertsreklaam",
+"Committed", "Rakendatud",
+"Completed OK", "Lõpetanud OK",
+"Configuration", "Seaded",
+"Configuration ID", "Seadete ID",
+"Configuration name", "Konfiguratsiooni nimi",
+"Configuration version", "Seadete versioon",
+"Connection limit type", "Ühenduste piirangu tüüp",
+"Container", "Konteriner",
+"Content character set", "Sisu tähestik kooditabeli alusel",
+"Content type", "Sisu tüüp",
+"Contest", "Võistlus",
+"Continue even if descrambling fails", "Jätka isegi kui lahtikodeerimine ebaõnnestub",
+"Cookie expiration (days)", "Veebiküpsiste aegumine (päevades)",
+"Cooking", "Toiduvalmistamine",
+"Copy codec type", "Koopia koodeki tüüp",
+"Create bouquet", "Loo kanalite kimp",
+"Create network name tags", "Loo võrgu nime märkeid",
+"Create provider name tags", "Loo pakkujate nimede märkeid",
+"Create type based tags", "Loo tüübile põhinevaid märkeid",
+"Created", "Loodud",
+"Creator", "Autor",
+"Cron multi-line", "Ajastamine cron'iga",
+"Culture (without music)", "Kultuur (ilma muusikata)",
+"Current RTSP port.", "Praegune RTSP port.",
+"Current affairs", "Hetkel juhtumas laias maailmas",
+"Current tuner configuration.", "Praegused tüüneri seaded",
+"Custom HTTP headers", "Omaloodud HTTP päised",
+"DBus - use the session message bus instead of the system one", "DBus - kasuta sessioonipõhist teavitust eelistades seda süsteemsele teavitusele",
+"DES constant code word client", "DES 'constant code word' klient",
+"DES key", "DES võti",
+"DSCP/TOS for streaming", "DSCP/TOS striimimiseks",
+"DVB scan files", "DVB failide skännimine",
+"DVB scan files path", "DVB failide skännimise viide",
+"DVB-C network", "DVB-C võrk",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, eksperimentaalne)",
+"DVB-S network", "DVB-S võrk",
+"DVB-S satellite configuration", "DVB-S satelliidi seaded",
+"DVB-S simple", "DVB-S lihtne",
+"DVB-T network", "DVB-T võrk",
+"DVR Auto-record entry", "DVR automaatsalvestuse kirje",
+"DVR behavior", "DVR käitumine",
+"DVR configuration", "DVRi seaded",
+"DVR configuration profile", "DVR seadete profiil",
+"DVR configuration profiles", "DVRi seadete profiilid",
+"DVR file retention period", "DVRi faili alleshoidmise aeg",
+"DVR log retention", "DVRi logi alleshoidmise aeg",
+"DVR log retention period", "DVRi logi alleshoidmise aeg",
+"DVR override: high", "DVR override: kõrge",
+"DVR override: important", "DVR override: tähtis",
+"DVR override: low", "DVR override: madal",
+"DVR override: normal", "DVR override: tavaline",
+"DVR override: unimportant", "DVR override: pole tähtis",
+"DVR time record entry", "DVR salvestamise kellaaja kirje",
+"Dance", "Tants",
+"Data errors", "Data vead",
+"Days of Week", "Nädalapäevad",
+"Days of week", "Nädalapäevad",
+"Debate", "Debatt",
+"Debug libav log", "Debugimise log libav kohta",
+"Debug log path", "Debugimise logi viide",
+"Debug options", "Debugimise valikud",
+"Debug subsystems", "Debugi alamsüsteeme",
+"Debug to syslog", "Debugi syslog'i",
+"Debug trace (low-level)", "Debugi treiss (low-level)",
+"Debugging", "Debugimine",
+"Default", "Vaikimisi",
+"Default language(s)", "Vaikimisi keel(ed)",
+"Default priority", "Vaikimisi prioriteet",
+"Delivery system", "Kohaleviimise süsteem",
+"Demux path", "Viide demux'ile",
+"Descramble services (limit per mux)", "Lahtikodeerimisteenused (piirang per mux)",
+"Descrambler buffer (TS packets)", "Lahtikodeerija puhver (TS paketid)",
+"Description", "Kirjeldus",
+"Detective", "Detektiiv",
+"Device ID", "Seadme ID",
+"Device model", "Seadme mudel",
+"Device path", "Viide seadmele",
+"Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected this tells your router the prority in which to give packets sent from Tvheadend, this option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ", "Differentiated Services Code Point / Type of Service: märgi paketid vastavate protokollide märgistustega. Oma olemuselt on see viis QoSi tegemiseks, kus paketid vastavalt oma märgistustele saavad eelistatud sihtkohta jõudmisel. Kui Sa ei tea, millest on jutt, siis lase sel olla, Tvheadend töötab ilma selleta ka suurepäraselt, kui võrgukiirused on piisavad :-P Aga huvi korral võid uurida näiteks linki https://en.wikipedia.org/wiki/Differentiated_services",
+"Directory", "Kataloog",
+"Directory permissions (octal, e.g. 0775)", "Kataloogi loabitid (numbritena, nt 0775)",
+"Disable", "Lülita välja",
+"Disable DVB bouquets", "Lülita välja DVB kanalite kimbud",
+"Disable SAT>IP client", "Lülita välja SAT>IP klient",
+"Disable all access control checks", "Lülita välja kõik ligipääsu kontrollid",
+"Disable debug on stderr", "Lülita välja debugimine standard veavoogu",
+"Disable device/firmware-specific workarounds", "Lülita välja seadme/firmware spetsiifilised workaround'id",
+"Disable syslog (all messages)", "Lülita välja syslog (kõik teated)",
+"Disabled", "Väljalülitatud",
+"Discussion", "Vestlus",
+"DiseqC repeats", "DiseqC kordused",
+"DiseqC rotor", "DiseqC rootor",
+"DiseqC switch", "DiseqC lüliti",
+"Do not use", "Ära kasuta",
+"Documentary", "Dokumentaal",
+"Don't backup configuration tree at upgrade", "Ära tee tarkvara uuendamisel kõikidest seadetest tagavarakoopiat  ",
+"Don't include title in filename", "Ära kaasa pealkirja faili nimes",
+"Don't keep", "Ära jäta alles",
+"Don't re-record", "Ära taassalvesta",
+"Don't reschedule", "Ära taasajasta",
+"Drama", "Draama",
+"Duplicate handling", "Duplikaatide käsitlemine",
+"EIT - skip TSID check", "EIT - jäta vahele TSID kontroll ",
+"EPG grabber", "EPG hankija",
+"EPG grabber channel", "EPG hankija kanal",
+"EPG grabber configuration", "EPG hankija seaded",
+"EPG name", "EPG nimi",
+"EPG scan", "EPG skännimine",
+"EPG scan timeout in seconds (30-7200)", "EPG skännimise timeout sekundites (30-7200)",
+"EPG source", "EPG allikas",
+"EPG update window", "EPG uuendamise ajaraam",
+"Economics", "Majandus",
+"Education", "Haridus",
+"Educational", "Hariduslik",
+"Elementary stream filter", "Voogedastuse elementaarne filter",
+"Enable (auto)", "Lülita sisse (automaatne)",
+"Enable DBus", "Lülita sisse DBus",
+"Enable NTP driver", "Lülita sisse NTP draiver",
+"Enable coredumps for daemon", "Lülita sisse deemoni coredump funktsionaalsus",
+"Enable debug on stderr", "Lülita sisse debugimine stdrerr'i",
+"Enable debug subsystems", "Lülita sisse alamsüsteemide debugimine",
+"Enable debug to file", "Lülita sisse debugimine faili",
+"Enable debug to syslog", "Lülita sisse debugimine syslog'i",
+"Enable if the SAT>IP box requests plts=on parameter in the SETUP RTSP command for DVB-S2 muxes.", "Lülita sisse, kui SAT>IP karp vajab SETUP RTSP käsus DVB-S2 muxide jaoks parameetrit plts=on.",
+"Enable if the SAT>IP box requires pids=0 parameter in the SETUP RTSP command.", "Lülita sisse, kui SAT>IP karp vajab SETUP RTSP käsus parameetrit pids=0.",
+"Enable if the SAT>IP box requires pids=21 parameter in the SETUP RTSP command", "Lülita sisse, kui SAT>IP karp vajab SETUP RTSP käsus parameetrit pids=21.",
+"Enable if the SAT>IP box supports the addpids/delpids commands.", "Lülita sisse, kui SAT>IP karp toetab addpids/delpids käske.",
+"Enable or disable RTSP/TCP (embedded data) support.", "Lülita sisse või välja RTSP/TCP (embedded data) tugi.",
+"Enable or disable fast input switching.", "Lülita sisse või välja 'fast input switching'.",
+"Enable or disable full mux mode.", "Lülita sisse või välja full mux režiim.",
+"Enable or disable ignoring of Event Information Table (EIT) data on this mux.", "Lülita sisse või välja EIT (Event Information Table) infoga arvestamine selles muxis.",
+"Enable or disable this configuration.", "Lülita sisse või välja need seaded.",
+"Enable syslog", "Lülita sisse syslog",
+"Enable system time updates. This will only work if the user running Tvheadend has rights to update the system clock (normally only root).", "Lülita sisse süsteemi kellaaja uuendamine. See töötab ainult juhul, kui Tvheadendi teenuse süsteemsel kasutajanimel on õigused süsteemi kellaaja uuendamiseks (tavaliselt ainult root kasutajanimi)",
+"Enable trace subsystems", "Lülita sisse alamsüsteemide trace",
+"Enable web UI debug (non-minified JS)", "Lülita sisse veebiliidese debugimine (mitteminimeeritud javascript)",
+"Enabled", "Sisse lülitatud",
+"Encrypted", "Krüpteeritud",
+"Encrypted service", "Krüpteeritud teenus",
+"Enter external IP if behind Network address translation (NAT).", "Sisesta väline IP aadress, kui muidu oled peidetud NATi taha (NAT on see, kui kodus olev ruuter peidab sisevõrgu aadressid teenusepakkuja välise avaliku IP taha peitu).",
+"Entertainment programs for 10 to 16", "Meelelahutussaated vanusele 10 kuni 16",
+"Entertainment programs for 6 to 14", "Meelelahutussaated vanusele 6 kuni 14",
+"Environment", "Keskkond",
+"Environment (pipe)", "Keskkonnamuutujad (pipe)",
+"Episode", "Osa",
+"Episode %d", "Osa %d",
+"Error code", "Veakood",
+"Errors", "Veateateid",
+"Even key", "Paaris võti",
+"Every day", "Iga päev",
+"Exclude channel tags", "Välista kanali märked",
+"Expeditions", "Ekspeditsioonid",
+"Experimental film", "Eksperimentaalfilm",
+"Expert", "Ekspert",
+"Exported tuners", "Eksporditud tuunerid",
+"External", "Väline",
+"External EPG grabber", "Väline EPG hankija",
+"External IP (NAT)", "Väline IP aadress (NAT)",
+"External URL", "Väline URL",
+"Extra arguments", "Lisaargumendid",
+"Extra start time", "Alustamise ajale lisaks",
+"Extra stop time", "Lõpetamise ajale lisaks",
+"Extra warming up time (seconds)", "Lisaaeg ülessoojenemiseks (sekundites)",
+"FAIL", "EBAÕNNESTUMINE",
+"FEC high", "FEC kõrge",
+"FEC low", "FEC madal",
+"Factual topics", "Faktidel põhinevad teemad",
+"Failed", "Ebaõnnestunud",
+"Failed DVR", "Ebaõnnestunud DVR",
+"Fantasy", "Fantaasia",
+"Fast input switch", "Sisestamise kiirlülitus",
+"File missing", "Fail puudub",
+"File not created", "Faili ei loodud",
+"File permissions (octal, e.g. 0664)", "Faili loabitid (numbrites, nt 0664)",
+"File size", "Faili suurus",
+"Filename", "Faili nimi",
+"Filename character set", "Faili nime tähestik kooditabeli alusel",
+"Filename options", "Faili nime valikud",
+"Fine arts", "Ilusad kunstid",
+"Finished", "Lõppenud",
+"Fitness and health", "Tervis",
+"Folkloric", "Folk",
+"Football", "Jalgpall",
+"Force (auto)", "Sunni peale (automaatne)",
+"Force CA ID (e.g. 0x2600)", "Sunni peale CA ID (nt 0x2600)",
+"Force old status", "Sunni peale vana olek",
+"Force pilot for DVB-S2", "Sunni peale pilootsignaal DVB-S2 jaoks",
+"Force priority", "Sunni peale prioriteedi väärtuseks",
+"Force teardown delay", "Sunni peale mahavõtmise viide",
+"Force usage of entered CA ID on this service.", "Sunni peale sellele teenusele ise sisestatud CA ID.",
+"Foreign countries", "Välismaad",
+"Forever", "Igavesti",
+"Fork and run as daemon", "Jagune ja tööta deemonina",
+"Format string", "Format String",
+"Found muxes", "Leitud muxe",
+"Found services", "Leitud teenuseid",
+"Free subscription weight", "Vaba liitumise kaalukus",
+"Free-format text field. Enter whatever you like here.", "Formaadivaba tekstiväli. Sisesta mida aga ise soovid.",
+"Frequency", "Sagedus",
+"Frequency (Hz)", "Sagedus (Hz)",
+"Frequency (MHz)", "Sagedus (MHz)",
+"Frequency (kHz)", "Sagedus (kHz)",
+"Fri", "Ree",
+"Friendly name", "Sõbralik nimi",
+"Frontend number", "Eesteenuse number",
+"Frontend path", "Eesteenuse viide",
+"Full DiseqC", "Täielik DiseqC",
+"Full mux RX mode supported", "Täielik muxi RX režiim on toetatud",
+"Full pathname specification", "Täispika asukohaviite määramine",
+"Full-text", "Täistekst",
+"Further education", "Rakendusharidus",
+"GOTOX position", "GOTOX positioon",
+"GOTOX rotor", "GOTOX rootor",
+"Game show", "Mängushow",
+"Gardening", "Aiandus",
+"General", "Üldine",
+"General configuration", "Üldseaded",
+"Generic", "Üldine",
+"Generic options", "Üldised seaded",
+"HD: high definition", "HD",
+"HDHomeRun ATSC-C frontend", "HDHomeRun ATSC-C eesteenus",
+"HDHomeRun ATSC-T frontend", "HDHomeRun ATSC-T eesteenus",
+"HDHomeRun DVB frontend", "HDHomeRun DVB eesteenus",
+"HDHomeRun DVB-C frontend", "HDHomeRun DVB-C eesteenus",
+"HDHomeRun DVB-T frontend", "HDHomeRun DVB-T eesteenus",
+"HTSP Default Stream Settings", "HTSP voogedastuse vaikimisi seaded",
+"HTSP stream profile", "HTSP voogedastuse profiil",
+"HTSP streaming", "HTSP voogedastus",
+"HTTP CORS origin", "HTTP CORS päritolu",
+"Handicraft", "Käsitöö",
+"Hearing impaired", "Vähenenud kuulmine",
+"Hierarchy", "Hierarhia",
+"High", "Kõrge",
+"High bitrate mode (CI+ CAMs only)", "Kõrge bitikiiruse režiim (ainult CI+ CAM'id)",
+"Historical movie", "Ajalooline film",
+"Horror", "Õudus",
+"Hostname/IP", "Hosti nimi / IP",
+"How frequently it will re-try fetching an image that has failed to be fetched.", "Kui tihti proovitakse uuesti tõmmata seda pilti, mida ei õnnestunud kätte saada.",
+"How frequently the upstream provider is checked for changes.", "Kui tihti teenusepakkujalt uuritakse uuendusi.",
+"IDLE", "PASSIB NIISAMA",
+"IP address", "IP aadress",
+"IP blocking", "IP blokeering",
+"IPTV automatic network", "IPTV Automatic Network",
+"IPTV input", "IPTV sisend",
+"IPTV network", "IPTV võrk",
+"Icon", "Ikoon",
+"Icon (full URL)", "Ikoon (täispikk URL)",
+"Icon URL", "Ikooni URL",
+"Icon base URL", "Ikooni baasURL",
+"Icon has title", "Ikoonil on pealkiri",
+"Icons from", "Ikoonide võtmine",
+"Idle", "Passib niisama",
+"Idle scan", "Skänn niisama passimise olekus ",
+"Idle scan muxes", "Skänni muxe niisama passimise olekus",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Kui ühtegi kasutajat pole siis loo üks ilma kasutajanime ja ilma paroolita.\nAga kasuta seda ettevaatlikult, sest see lubab Sinu Tvheadend\ninstallatsioonile maailmale täiesti valla oleva administraatori õigustes\nkasutamise. Kuniks Sa lood või korrigeerid kasutajate ligipääsu\nTvheadendi veebiliidese kaudu.",
+"If you'd like to support the project, please consider a donation.", "Kui Sa soovid projekti toetada, kaalu selleks annetuse tegemist",
+"Ignore EPG (EIT)", "Igoreeri EPG'd (EIT)",
+"Ignore descriptor 5", "Ignoreeri diskriptorit nr 5",
+"Ignore invalid SSL certificate", "Ignoreeri kehtetut SSL sertifikaati",
+"Ignore provider's channel numbers", "Ignoreeri pakkujapoolseid kanalite numbreid",
+"Image cache", "Pildi vahemälu",
+"Immediately abort", "Katkesta koheselt",
+"Important", "Tähtis",
+"Include channel name in filename", "Kaasa faili nimes kanali nimi",
+"Include date in filename", "Kaasa faili nimes kuupäev ",
+"Include episode in filename", "Kaasa faili nimes osa",
+"Include subtitle in filename", "Kaasa faili nimes osa nimi",
+"Include time in filename", "Kaasa fail inimes kellaaeg",
+"Index", "Indeks",
+"Information area", "Informatsiooni ala",
+"Informational", "Informatsionaalne",
+"Initial scan", "Esialgne skänn",
+"Input base", "Baassisend",
+"Input buffer (bytes)", "Sisendpuhver (baitides)",
+"Input instance", "Sisendinstants",
+"Input path", "Sisendi viide",
+"Interface", "Liides",
+"Internal", "Sisemine",
+"Internal EPG grabber", "Sisemine EPG hankija",
+"Internal grabber", "Sisemine hankija",
+"Interview", "Intervjuu",
+"Invalid", "Kehtetu",
+"Invalid adapter number '%s'\n", "Kehtetu adapteri number '%s'\n",
+"Invalid target", "Kehtetu sihtpunkt",
+"Keep", "Hoia alles",
+"Kill signal (pipe)", "Killi signaal (pipe)",
+"Kill timeout (pipe/secs)", "Killimise timeout (pipe/sekundis)",
+"LNB type", "LNB tüüp",
+"Language", "Keel",
+"Language settings", "Keele seaded",
+"Languages", "Keeled",
+"Last seen", "Viimati nähtud",
+"Last updated from", "Viimane uuendus",
+"Leisure hobbies", "Vabaaja hobid",
+"Limit connections", "Ühenduste limiit",
+"Linked input", "Lingitud sisend",
+"Linux ATSC-C frontend", "Linux ATSC-C eesteenus",
+"Linux ATSC-T frontend", "Linux ATSC-T eesteenus",
+"Linux DVB frontend", "Linux DVB eesteenus",
+"Linux DVB-C frontend", "Linux DVB-C eesteenus",
+"Linux DVB-S frontend", "Linux DVB-S eesteenus",
+"Linux DVB-S slave frontend", "Linux DVB-S slave'i eesteenus",
+"Linux DVB-T frontend", "Linux DVB-T eesteenus",
+"LinuxDVB network", "LinuxDVB võrk",
+"Listen / Connect port", "Kuula / ühenda porti",
+"Listen on IPv6", "Kuula IPv6 võrguliidesel",
+"Literature", "Kirjandus",
+"Local bind IP address", "Kohalik IP aadress, millega seostada",
+"Local channel minor", "Kohalik kanali minor",
+"Local channel number", "Kohalik kanali number",
+"Local discovery IP address", "Kohaliku tuvastamise IP aadress",
+"Location", "Asukoht",
+"Location details of the SAT>IP Server.", "SAT>IP serveri lokaliseerimise detailid.",
+"Lock preferred CA PID", "Lukusta eelistatud CA PID",
+"Log", "Logi",
+"Login/Logout", "Sisse-/väljalogimine",
+"Low", "Madal",
+"MPEG-TS Pass-thru/built-in", "MPEG-TS Pass-thru/sisseehitatud",
+"MPEG-TS input", "MPEG-TS sisend",
+"MPEG-TS network", "MPEG-TS võrk",
+"MPEG-TS raw service", "MPEG-TS raw teenus",
+"MPEG-TS service", "MPEG-TS teenus",
+"Magazines", "Ülevaated",
+"Maintain free storage space in MiB", "Hoia vabana salvestusmahtu, megabaitides",
+"Maintain used storage space in MiB (0=disabled)", "Piira kasutuses olevat haldusmahtu, megabaitides (0=väljalülitatud)",
+"Maintained space", "Hallatud salvestusmaht",
+"Make subdirectories per channel", "Tee alamkataloogid per kanal",
+"Make subdirectories per day", "Tee alamkataloogid per päev",
+"Make subdirectories per title", "Tee alamkataloogid per pealkiri",
+"Manufacturer", "Tootja",
+"Manufacturer URL", "Tootja URL",
+"Manufacturer's model number.", "Valmistajapoolne mudeli number.",
+"Manufacturer's product description.", "Valmistajapoolne toote kirjeldus.",
+"Manufacturer's product information page for the device.", "Valmistajapoolne toote kirjelduse lehekülg.",
+"Manufacturer's product name.", "Valmistajapoolne toote nimi.",
+"Map encrypted services", "Seosta krüpteeritud teenused",
+"Map radio channels", "Seosta raadiokanalid",
+"Map unnamed channels", "Seosta nimetud kanalid",
+"Map zero-numbered channels", "Seosta nulliga nummerdatud kanalid",
+"Master tuner", "Peamine tuuner",
+"Matroska (mkv)/built-in", "Matroska (mkv)/sisseehitatud",
+"Matroska specific", "Matroska formaati keskne",
+"Maximal channel number", "Maksimaalne kanali number",
+"Maximum # input streams", "Maksimaalselt # sisendvoogedastust",
+"Maximum PIDs", "Maksimaalselt PID'e",
+"Maximum RAM size (MB)", "Maksimaalne RAM suurus (MB)",
+"Maximum bandwidth (Kbps)", "Maksimum võrgukiirus (Kbps)",
+"Maximum count (0=default)", "Maksimum arv (0=vaikimisi)",
+"Maximum duration", "Maksimum kestvus",
+"Maximum length of PIDs", "Maksimum PID'ide pikkus",
+"Maximum period (mins)", "Maksimum periood (minutit)",
+"Maximum schedules limit (0=default)", "Ajastamiste maksimaalne arv (0=vaikimisi) ",
+"Maximum size (MB)", "Maksimaalne suurus (MB)",
+"Maximum timeout (seconds)", "Maksimaalne timeout (sekundites)",
+"Medicine", "Meditsiin",
+"Melodrama", "Melodraama",
+"Merge same name", "Liida samanimelised üheks kokku",
+"Minimal channel number", "Minimaalne kanali number",
+"Minimum duration", "Minimaalne kestvus",
+"Minimum rotor time (seconds)", "Minimaalne rootori aeg (sekundites)",
+"Missing In PAT/SDT", "Puudub PAT/SDT's",
+"Mode", "Režiim",
+"Model description", "Mudeli kirjeldus",
+"Model name", "Mudeli nimi",
+"Model number", "Mudeli number",
+"Modulation", "Modulatsioon",
+"Module", "Moodul",
+"Module ID", "Mooduli ID",
+"Mon", "Esm",
+"More verbose libav log", "Rohkem kirjeldav libav logi",
+"Motor sport", "Mootorisport",
+"Movie", "Film",
+"Music", "Muusika",
+"Musical", "Muusikal",
+"Mux handling", "Mux käsitlemine",
+"Mux name", "Muxi nimi",
+"Mux not enabled", "Muks pole sisse lülitatud",
+"Mux schedule entry", "Muxi ajastamise kirje",
+"NONE", "EI MIDAGI",
+"Name", "Nimi",
+"Names", "Nimed",
+"Natural sciences", "Loodusteadused",
+"Nature", "Loodus",
+"Network", "Võrk",
+"Network A", "Võrk A",
+"Network B", "Võrk B",
+"Network ID (limit scanning)", "Võrgu ID (piira skannimist)",
+"Network UUID", "Võrgu UUID",
+"Network access", "Võrgu ligipääs",
+"Network discovery", "Võrgu tuvastamine",
+"Network name", "Võrgu nimi",
+"Network prefix", "Võrgu prefiks",
+"Network settings", "Võrgu seaded",
+"Network type", "Võrgu tüüp",
+"Networks", "Võrgud",
+"News", "Uudised",
+"News magazine", "Uudiste ülevaade",
+"Next tune delay in ms (0-2000)", "Järgmise tuunimise viide millisekundites (0-2000)",
+"No", "Ei",
+"No PIN", "Pole PIN'i",
+"No access", "Pole ligipääsu",
+"No adapters specified!\n", "Ühtegi adapterit pole määratud!\n",
+"No assigned adapters", "Pole määratletud adapterit",
+"No days", "Pole päevi",
+"No descrambler", "Pole lahtikrüpteerijat",
+"No free adapter", "Pole vaba adapterit",
+"No input detected", "Mingit sisendit pole tuvastatud",
+"No service assigned to channel", "Kanaliga pole seotud ühtegi teenust",
+"No service enabled", "Ühtegi teenust pole sisse lülitatud ",
+"No source available", "Ühtegi allikat pole saadaval",
+"None", "Ei midagi",
+"Normal", "Tavaline",
+"Not all SAT>IP servers use the same signal scaling. Change this setting if the signal level displayed within Tvheadend looks too low.", "Kõik SAT>IP serverid ei kasuta samasugust signaali skaleerimist. Muuda seda seadet kui signaali tase Tvheadendi poolt paistab liiga madal.",
+"Not linked", "Pole lingitud",
+"Not set", "Pole seadistatud",
+"Not set (none or channel configuration)", "Pole seadistatud (kas pole midagi või kanali seadistus)",
+"Not set (use channel or DVR configuration)", "Pole seadistatud (kasuta kanali või DVR seadeid)",
+"Number of seconds to wait before timing out.", "Mitu sekundit oodata enne loobumist.",
+"Number of tsfile tuners", "Tsfile tuunerite arv",
+"OK (partial)", "OK (osaline)",
+"OSCam new pc-nodmx (rev >= 10389)", "OSCam'i uus pc-nodmx (rev >= 10389)",
+"Odd key", "Paaritu võti",
+"Off", "Väljas",
+"Older OSCam", "Vanem OSCAM",
+"On", "Sees",
+"On file removal", "Faili eemaldamisel",
+"Only Bulsatcom 39E", "Ainult Bulsatcom 39E",
+"Only EIT", "Ainult EIT",
+"Only OpenTV Sky Ausat", "Ainult OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Ainult OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Ainult OpenTV Sky UK",
+"Only PSIP (ATSC)", "Ainult PSIP (ATSC)",
+"Only UK Freesat", "Ainult UK Freesat",
+"Only UK Freeview", "Ainult UK Freeview",
+"Only Viasat Baltic", "Ainult Viasat Baltic",
+"Only preferred CA PID", "Ainult eelistatud CA PID",
+"OpenTV channel number", "OpenTV kanali number",
+"Opera", "Ooper",
+"Orbital position", "Orbitaalpositsioon",
+"Orbital positions", "Orbitaalpositsioonid",
+"Original network ID", "Originaalvõrgu ID",
+"Other stream filter", "Muu voogedastuse filter",
+"Output directory for tsdebug", "Väljundkataloog tsdebug'i jaoks",
+"Over-the-air", "Üle-õhu",
+"Over-the-air Cron multi-line", "Üle-õhu crontab",
+"Over-the-air EPG", "Üle-õhu EPG",
+"Over-the-air EPG grabber", "Üle-õhu EPG hankija",
+"Over-the-air grabbers", "Üle-õhu hankijad",
+"Owner", "Omanik",
+"PIDs in setup", "PIDid seadistuses",
+"PLS code", "PLS kood",
+"PLS mode", "PLS režiim",
+"Parent entry", "Ülemkirje",
+"Pass subscription weight", "Anna edasi liitumise kaalukus",
+"Password", "Salasõna",
+"Password2", "Salasõna2",
+"Passwords", "Salasõnad",
+"Path", "Viide",
+"Path to a directory (folder) containing your picon collection. See Help for more detailed information.", "Viide kataloogile, mis sisaldab Su picon kollektsiooni. Vaata lisainformatsiooniks abilehekülgi.",
+"Path to an icon for this channel. This can be named however you wish, as either a local (file://) or remote (http://) image. See Help for more infomation.", "Viide selle kanali ikoonile. See võib olla nimetatud vabal moel, kas kohalik (file://) või kauge (http://) pilt. vaata lisainformatsiooniks abilehekülgi.",
+"Performing arts", "Soorituskunstid",
+"Periodically save EPG to disk (hours)", "Perioodiliselt salvesta EPG andmekandjale (tundides)",
+"Persistent user interface level", "Kasutajaliidese läbivalt püsiv tase",
+"Physiology", "Füsioloogia",
+"Picon path (see Help)", "Picon viide (vaata Abi)",
+"Polarization", "Polarisatsioon",
+"Political issues", "Poliitilised hädad",
+"Popular culture", "Popkultuur",
+"Position", "Positsioon",
+"Position of the input.", "Sisendi positsioon.",
+"Post-processor command", "Pärast käitlust antav käsklus",
+"Post-recording padding", "Lisamine pärast salvestust",
+"Post-remove command", "Pärast eemaldamist antav käsklus",
+"Power save", "Energiasääst",
+"Power-up time (ms) (15-200)", "Sisselülitumise aeg (ms) (15-200)",
+"Pre-defined muxes", "Eeldefineeritud muxid",
+"Pre-recording padding", "Lisamine enne salvestust",
+"Pre-school children's programs", "Eelkooliealiste saated",
+"Prefer picons over channel name", "Eelista picon'it kanali nimetusele",
+"Preferred CA PID", "Eelistatud CA PID",
+"Preferred service video type", "Eelistatud teenuse video tüüp",
+"Presentation", "Esitlus",
+"Presentation details.", "Esitluse detailid.",
+"Priority", "Prioriteet",
+"Priority (-10..10)", "Prioriteet (-10..10)",
+"Private", "Privaatne",
+"Profile name", "Profiili nimi",
+"Program identification (PID) number to compare. Zero means any. This comparison is processed only when service comparison is active and for the Conditional Access filter.", "Programmi identifikaatori (PID) number võrdlemiseks. Null tähendab kõiki. See võrdlus tehakse ainult siis, kui teenuse võrdlemine on sisselülitatud ja ainult Conditional Access filtrile.",
+"Provider", "Pakkuja",
+"Provider ID", "Pakkuja ID",
+"Provider network name", "Teenusepakkuja võrgu nimi",
+"Psychology", "Psühholoogia",
+"Puppets", "Marionetid",
+"Quad (4.0)", "Nelik (4.0)",
+"Quiz", "Mälumäng",
+"RAM only", "AInult RAM",
+"RTSP port (554 or 9983, 0 = disable)", "RTSP port (554 või 9983), 0 = lülita välja",
+"Re-fetch period (hours)", "Taastõmbamise periood (tundides)",
+"Re-fetch period (mins)", "Taastõmbamise periood (minutites)",
+"Re-record%s%s", "Taassalvesta%s%s",
+"Re-try period (hours)", "Taasüritamise periood (tundides)",
+"Record all", "Salvesta kõik",
+"Recording file options", "Salvestamise faili valikud",
+"Recording system path", "Salvestamise süsteemi viide",
+"Reject", "Keeldu",
+"Religion", "Religioon",
+"Religious", "Religioosne",
+"Remarkable people", "Erilised inimesed",
+"Remove HTTP arguments", "Eelmalda HTTP argumendid",
+"Remove all unsafe characters from filename", "Eemalda failinimest kõik tõlgendamatud tähemärgid",
+"Replace whitespace in title with '-'", "Asenda tühikud pealkirjas sidekriipsudega",
+"Reply to CAM PIN inquiries", "Vasta CAMi PIN küsimistele",
+"Reports", "Raportid",
+"Rerun of", "Taasesitus:",
+"Rescan", "Korduvskännimine",
+"Reserved", "Reserveeritud",
+"Resolution (height)", "Resolutsioon (kõrgus)",
+"Restart on error", "Taaskäivita veasündmuse korral",
+"Reuse EPG from", "Taaskasuta EPG'd",
+"Rewrite MPEG-TS SI tables", "Ülekirjuta MPEG-TS SI tabelid",
+"Rock", "Rokkmuusika",
+"Romance", "Romantika",
+"Rotor initialization time (seconds)", "Rootori käimatõmbamise aeg (sekundites)",
+"Rotor type", "Rootori tüüp",
+"Run as group", "Käivita grupiga",
+"Run as user", "Käivita kasutajana",
+"Running", "Töötab",
+"SAT->IP frontend number.", "SAT->IP eesteenuse number.",
+"SAT>IP ATSC-C frontend", "SAT>IP ATSC-C eesteenus",
+"SAT>IP ATSC-T frontend", "SAT>IP ATSC-T eesteenus",
+"SAT>IP DVB frontend", "SAT>IP DVB eesteenus",
+"SAT>IP DVB-C frontend", "SAT>IP DVB-C eesteenus",
+"SAT>IP DVB-S frontend", "SAT>IP DVB-S eesteenus",
+"SAT>IP DVB-S slave frontend", "SAT>IP DVB-S slave eesteenus",
+"SAT>IP DVB-T frequency (Hz)", "SAT>IP DVB-T sagedus (Hz)",
+"SAT>IP DVB-T frontend", "SAT>IP DVB-T eesteenus",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP pordi number serveri jaoks\n(vaikimisi: -1 = välja lülitatud, 0 = veebiseadistus, standardport on 554)",
+"SAT>IP client", "SAT>IP klient",
+"SAT>IP source number", "SAT>IP lähteallika number",
+"SD: standard definition", "SD",
+"SSL verify peer", "Kontrolli naabrussuhte SSL",
+"Sat", "Lau",
+"Satellite longitude", "Satelliidi geograafiline pikkus",
+"Satellite positions", "Satelliidi positsioonid",
+"Scan after creation", "Skaneeri peale loomist",
+"Scan queue length", "Skaneerimise järjekorra pikkus",
+"Scan result", "Skännimise tulemus",
+"Scan status", "Skännimise olek",
+"Schedule a re-recording if more errors than (0=off)", "Ajasta taassalvestamine kui veateateid on rohkem kui (0=välja lülitatud)",
+"Schedule status", "Ajastamise olek",
+"Scheduled for recording", "Ajastatud salvestamiseks",
+"Scheduled start time", "Ajastatud alguseg",
+"Scheduled stop time", "Ajastatud lõpuaeg",
+"School programs", "Koolisaated",
+"Science", "Teadus",
+"Science fiction", "Teaduslik ulme",
+"Season", "Hooaeg",
+"Season %d", "Hooaeg %d",
+"Select the list of languages (in order of priority) to be used for supplying EPG information to clients that don't provide their own configuration.", "Vali kasutatavate keelte nimekiri (tähtsuse järjekorras), mille alusel jagatakse EPG infot klientidele, kes ei teavita oma kasutusel olevaid seadeid.",
+"Send CAPMT query", "Saada CAPMT päring",
+"Send full PLAY cmd", "Saada täielik PLAY cmd",
+"Serial number", "Serialnumber",
+"Series link", "Seriaali link",
+"Serious", "Tõsine",
+"Serious music", "Tõsine muusika",
+"Server UUID", "Serveri UUID",
+"Server connectivity", "Serveri ühenduvus",
+"Server details.", "Serveri detailid.",
+"Service", "Teenus",
+"Service ID", "Teenuse ID",
+"Service configuration", "Teenuse seaded",
+"Service count %zi", "Teenuse loend %zi",
+"Service mapper", "Teenuse seostaja",
+"Service mapping", "Teenuse seostamine",
+"Service name", "Teenuse nimi",
+"Service raw", "Teenus raw kujul",
+"Service type", "Teenuse tüüp",
+"Services", "Teenused",
+"Set the priority of this configuration.", "Määra nende seadete prioriteet.",
+"Settings", "Seaded",
+"Show", "Šhow",
+"Show this page", "Näita sellel leheküljel",
+"Show version information", "Näita versiooni informatsiooni",
+"Signal quality too poor", "Signaali kvaliteet liiga halb",
+"Signal scale (240 or 100)", "Signaali skaala (240 või 100)",
+"Site latitude", "Saidi geograafiline laius",
+"Site longitude", "Saidi geograafiline pikkus",
+"Skip TS packets (0-200)", "Jäta vahele TS paketid (0-200)",
+"Skip commercials", "Väldi kommertsreklaame",
+"Skip initial bytes", "Jäta vahele algbaidid",
+"Skip initial scan", "Jäta vahele algskaneerimine",
+"Skip x number of transport packets.", "Jäta vahele x numbrit transpordi pakette.",
+"Slave entry", "Slave kirje",
+"Slot state", "Ühenduspesa staatus",
+"Soap", "Seep",
+"Soccer", "Jalgpall",
+"Social", "Sotsiaal",
+"Social advisory", "Sotsiaalne nõustamine",
+"Sort index", "Sortimise indeks",
+"Source", "Allikas",
+"Source deleted", "Lähteallikas eemaldatud",
+"Source quality is bad", "Lähteallika kvaliteet on halb",
+"Source reconfigured", "Lähteallikas taasseadistatud",
+"Southern hemisphere (latitude direction)", "Lõunapoolkera (geograafiline laius)",
+"Special events (Olympic Games, World Cup, etc.)", "Erisündmused (olümpiamängud, maailmameistrivõistlused jne)",
+"Specify User-Agent header for the http client", "Määra User-Agent päis HTTP kliendi jaoks",
+"Specify alternative htsp port", "Määra altenatiivne HTSP port",
+"Specify alternative http port", "Määra altenatiivne HTTP port",
+"Specify alternative http webroot", "Määra alternatiivne HTTP juurkataloog",
+"Specify bind address", "Määra seostuv IP aadress",
+"Specify extra htsp port", "Määra HTSP lisaport",
+"Spiritual sciences", "Esoteerika",
+"Sports", "Sport",
+"Sports magazines", "Spordiülevaated",
+"Start", "Algus",
+"Start after", "Alusta pärast",
+"Start before", "Alusta ennem",
+"Start time", "Algusaeg",
+"Status", "Olek",
+"Status period (ms)", "Oleku periood (ms)",
+"Stop", "Seiska",
+"Stop time", "Seiskamise aeg",
+"Storage path", "Andmekandja viide",
+"Storage space", "Andmekandja ruum",
+"Stream index", "Voogedastuse indeks",
+"Stream profile", "Voogedastuse profiil",
+"Stream type", "Voogedastuse tüüp",
+"Streaming", "Voogedastus",
+"Streaming priority", "Voogedastuse prioriteet",
+"Streaming profiles", "Voogedastuse profiilid",
+"Subdirectory options", "Alamkataloogi valikud",
+"Subscribe to a service permanently", "Liitu teenusega alatiseks",
+"Subscription weight", "Liitumise kaalukus",
+"Substitute formatters", "Vaheta formaatijad",
+"Subtitle", "Subtiiter",
+"Subtitle codec", "Subtiitrite koodek",
+"Subtitle stream filter", "Subtiitrite voogedastuse filter",
+"Sun", "Püh",
+"Surround (2 front, rear mono)", "Surround (2 ees, taga mono)",
+"Switch before rotor", "Lülita enne rootorit",
+"Switch type", "Lülituse tüüp",
+"Switch: %s", "Lülita: %s",
+"Symbol rate (Sym/s)", "Sümbolite määr (Sym/s)",
+"Sync", "Sünkimine",
+"Sync + Don't keep", "Sünkimine + ära hoia alles",
+"System", "Süsteem",
+"Tag files with metadata", "Märgi failid metadataga",
+"Tags", "Märked",
+"Talk show", "Jutusaade",
+"Team sports (excluding football)", "Võistkondlik sport (ei sisalda jalgpalli)",
+"Technology", "Tehnoloogia",
+"Teletext stream filter", "Teleteksti voogedastuse filter",
+"Testing", "Testimine",
+"Testing options", "Testimise valikud",
+"The SAT>IP server's name.", "SAT>IP serveri nimi.",
+"The SAT>IP server's universally unique identifier.", "SAT>IP serveri unikaalne identifikaator.",
+"The SAT>IP's discovered IP address.", "SAT>IP tuvastatud IP aadress.",
+"The current boot ID.", "Pragune buutimise ID.",
+"The current configuration ID.", "Praegune seadete ID.",
+"The current configuration version.", "Praegune seadete versioon.",
+"The default language to use if the user  language isn't set in the Access Entries tab.", "Vaikimisi kasutatav keel kui kasutaja keel pole määratud",
+"The device ID.", "Seadme ID",
+"The device's serial number.", "Seadme serialnumber.",
+"The frequency of the mux (in Hertz).", "Muxi sagedus hertsides (Hz).",
+"The modulation used on the mux.", "Muxi modulatsioon",
+"The mux the service is on.", "Mux millel see teenus asub.",
+"The mux's universally unique identifier.", "Muxi unikaalne identifikaator.",
+"The network the service is on.", "Võrk millel teenus asub.",
+"The networks using this configuration.", "Võrgud, mis kasutavad neid seadeid.",
+"The number of ATSC-C (Cable/AnnexB) tuners to export.", "Mitu ATSC-C (Cable/AnnexB) tüünerit eksportida.",
+"The number of ATSC-T (Terresterial) tuners to export.", "Mitu ATSC-T (Terresterial) tüünerit eksportida.",
+"The number of DVB-C (Cable) tuners to export.", "Mitu DVB-C (Cable) tüünerit eksportida.",
+"The number of DVB-C2 (Cable) tuners to export.", "Mitu DVB-C2 (Cable) tüünerit eksportida.",
+"The number of DVB-S (Satellite) tuners to export.", "Mitu DVB-S (Satellite) tüünerit eksportida.",
+"The number of DVB-S2 (Satellite) tuners to export.", "Mitu DVB-S2 (Satellite) tüünerit eksportida.",
+"The number of DVB-T (Terresterial) tuners to export.", "Mitu DVB-T (Terresterial) tüünerit eksportida.",
+"The number of DVB-T2 (Terresterial) tuners to export.", "Mitu DVB-T2 (Terresterial) tüünerit eksportida.",
+"The number of days cookies set by Tvheadend should expire.", "Mitu päeva on Tvheadendi poolt seatud veebiküpsiste eluiga / aegumine.",
+"The outcome of the last scan performed on this mux.", "Selle muxi viimatise skäneerimise tulemus.",
+"The provider's name.", "Teenusepakkuja nimi.",
+"The provider's network ID.", "Teenusepakkuja võrgu ID.",
+"The provider's network name.", "Teenusepakkuja võrgu nimi",
+"The service ID as set by the provider.", "Teenusepakkuja poolt määratud teenuse ID.",
+"The service name as set by the provider.", "Teenusepakkuja poolt määratud teenuse nimi.",
+"The service the filter should apply to. Leave blank to apply the filter to all services.", "Teenus, millele filter rakendada. Jäta tühjaks, kui soovid määrata kõigile teenustele.",
+"The service's channel minor as set by the provider.", "Teenuse kanali minor, mis määratud teenusepakkuja poolt.",
+"The service's channel number as set by the provider.", "Teenusepakkuja poolt määratud kanali number.",
+"The subtitle stream types the filter should apply to.", "Subtiitrite voo tüübid, millele filtrit rakendada.",
+"The symbol rate.", "Sümbolite määr.",
+"The total number of services found on this mux.", "Teenuseid leitud sellel muxil.",
+"The transport stream ID of the mux within the network.", "Muxi transpordi voo ID võrgu sees.",
+"The video stream types the filter should apply to.", "Video voo tüübid, millele filtrit rakendada.",
+"This tuner", "See tuuner",
+"This will create an NTP driver (using shmem interface) that you can feed into ntpd. This can be run without root privileges, but generally the performance is not that great.", "See loob NTP draiveri (kasutades shmem liidest) mille saab ette sööta ntpd'le. See saab toimida ka ilma root õigusteta, aga selle variandi jõudlus pole just kõige parem.",
+"Thu", "Nel",
+"Time", "Aeg",
+"Time missed", "Aeg mööda läinud",
+"Time record caption", "Kellaaja alusel salvestamise tekst",
+"Time recording%s%s", "Kellaja alusel salvestamine %s%s",
+"Time update", "Kellaaja uuendus",
+"Timeout (sec) (0=infinite)", "Timeout (sekundites) (0=lõputu)",
+"Timeout (seconds)", "Timeout (sekundites)",
+"Timeshift", "Ajanihe",
+"Timout (secs)", "Timeout (sekundites)",
+"Title", "Saate nimi",
+"Title (regexp)", "Pealkiri (Regexp)",
+"Toggle details", "Lülitamise detailid",
+"Tourism / Travel", "Turism / reisimine",
+"Trace subsystems", "Treissi alamsüsteeme",
+"Traditional arts", "Traditsioonilised kunstid",
+"Traditional music", "Traditsiooniline muusika",
+"Transcoding", "Skaleerimine",
+"Transponder ID", "Transponderi ID",
+"Tue", "Tei",
+"Tune before DiseqC", "Tuuni ennem DiseqC'd",
+"Tuner bind IP address", "Tuuneriga seostatud IP aadress",
+"Tuner configuration", "Tuuneri seaded",
+"Tuning failed", "Tuunimine ebaõnnestus",
+"Turn off LNB when idle", "Lülita LNB välja kui passib niisama",
+"Tvheadend server name", "Tvheadend serveri nimi",
+"Type", "Tüüp",
+"UDP RTP port number (2 ports)", "UDP RTP pordi number (2 porti)",
+"URL with the SAT>IP server XML location", "URL koos SAT>IP serveri XML asukohaga",
+"USALS rotor", "USALS Rotor",
+"Uncommitted", "Rakendamata",
+"Uncommitted first", "Esimesena rakendamata",
+"Unicable switch (universal LNB, experimental)", "Unicable switch (universaalne LNB, eksperimentaalne)",
+"Unicable type", "Unicable tüüp",
+"Unimportant", "Tähtsusetu",
+"Universal LNB only", "Ainult universaalne LNB",
+"Universally unique identifier. Read only.", "Unikaalne identifikaator. Ainult loetav.",
+"Unknown", "Tundmatu",
+"Unknown reason (%i)", "Tundmatu põhjus (%i)",
+"Unlimited size", "Piiramata suurus",
+"Unlimited time", "Piiramata aeg",
+"Unset (default)", "Seadistamata (vaikimisi)",
+"Update card (EMM)", "Uuenda kaarti (EMM)",
+"Update channel icon", "Uuenda kanali ikooni",
+"Update channel name", "Uuenda kanali nime",
+"Update channel number", "Uuenda kanali numbrit",
+"Update disabled", "Uuendamine välja lülitatud",
+"Update time", "Uuenda kellaaega",
+"Update tolerance (ms)", "Uuendamise tolerants (ms)",
+"Updated", "Uuendatud",
+"Usage: %s [OPTIONS]\n", "Kasutamine: %s [valikud]\n",
+"Use EPG running state", "Kasuta EPG tööstaatust",
+"Use Windows-compatible filenames", "Kasuta Windows'iga ühilduvaid failinimesid",
+"Use XSPF playlist instead of M3U", "Kasuta M3U asemel XSPF pleilisti",
+"Use a pre-defined list of ATSC-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Kasuta eeldefineeritud ATSC-C muxide nimekirja. Märkus: need nimekirjad võivad olla aegunud ja selle tulemusel võib skännimine võtta tavalisest rohkem aega.",
+"Use a pre-defined list of ATSC-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Kasuta eeldefineeritud ATSC-T muxide nimekirja. Märkus: need nimekirjad võivad olla aegunud ja selle tulemusel võib skännimine võtta tavalisest rohkem aega.",
+"Use a pre-defined list of DVB-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Kasuta eeldefineeritud DVB-C muxide nimekirja. Märkus: need nimekirjad võivad olla aegunud ja selle tulemusel võib skännimine võtta tavalisest rohkem aega.",
+"Use a pre-defined list of DVB-S/S2 muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Kasuta eeldefineeritud DVB-S/S2 muxide nimekirja. Märkus: need nimekirjad võivad olla aegunud ja selle tulemusel võib skännimine võtta tavalisest rohkem aega.",
+"Use a pre-defined list of DVB-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Kasuta eeldefineeritud DVB-T muxide nimekirja. Märkus: need nimekirjad võivad olla aegunud ja selle tulemusel võib skännimine võtta tavalisest rohkem aega.",
+"Use original", "Kasuta algupärast",
+"Use service IDs as channel numbers", "Kasuta teenuse ID'sid kanalite numbritena",
+"User access error", "Kasutaja ligipääsu viga",
+"User icon", "Kasutaja ikoon",
+"User interface level", "Kasutajaliidese tase",
+"User interface quick tips", "Kasutajaliidese vihjed",
+"User language", "Kasutaja keel",
+"User limit reached", "Kasutaja limiit on täis",
+"User login", "Kasutaja sisselogimine",
+"Username", "Kasutajanimi",
+"Variety show", "Varietee",
+"Video bitrate (kb/s) (0=auto)", "Video bitrate (kb/s) (0=automaatne)",
+"Video codec", "Video koodek",
+"Video recorder", "Video salvestaja",
+"Video stream filter", "Video voogedastuse filter",
+"Visually impaired commentary/audio description", "Vaegnägijatele kommentaarid / audio kirjeldus",
+"WEBM/built-in", "WEBM/sisseehitatud",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV profiil H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV profiil H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV profiil VP8/Vorbis/WEBM",
+"Waiting for EPG running flag", "Oodates EPG töötamise lipukest",
+"Waiting for program start", "Oodates saate algamist",
+"Waiting for stream", "Oodates voogedastust",
+"War", "Sõda",
+"Water sport", "Veesport",
+"Weak stream", "Nõrk voogedastus",
+"Weather report", "Ilmateade",
+"Web interface", "Veebiliides",
+"Web interface language", "Veebiliidese keel",
+"Web user interface", "Veebiliides",
+"Wed", "Kol",
+"Welcome - Tvheadend - your TV streaming server and video recorder", "Tervist - Tvheadend - Sinu TV voogedastuse server ja video salvestaja",
+"Western", "Vestern",
+"Western hemisphere (latitude direction)", "Läänepoolkera (geograafiline laius)",
+"When the service was first identified and recorded.", "Millal teenus oli esimest korda ära tuntud ja salvestatud.",
+"When the service was last seen during a mux scan.", "Millal viimati teenust nähti muxi skäneerimisel.",
+"Wizard", "Juhendav abiprogramm",
+"Write a short message to log identifying the matched parameters. It is useful for debugging your setup or structure of incoming streams.", "Kirjuta lühike teade, millega leitud tulemusi logis visuaalselt eraldada. Kasulik seadete, voogude jms veatuvastuseks.",
+"Yes", "Jah",
+"addpids/delpids supported", "addpids/delpids toetatud",
+"hrs", "tund(i)",
+"invalid option specified [%s]", "vale valik määratletud [%s]",
+"mins", "minutit",
+"option %s requires a value", "valik %s vajab väärtust",
+"tsfile input (mux file)", "tsfile sisend (mux fail)",
+"tvhdhomerun client", "tvhdhomerun klient",
+NULL, NULL
+};
+
+static const char *tvh_locale_9[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nبرای اطلاعات بیشتر به وبسایت Tvheadend مراجعه فرمایید: https://tvheadend.org\n",
+"# Channels", "# کانال",
+"# Muxes", "# تجمیع کننده سیگنال",
+"# Services", "# سرویس",
+"AC-3 = descriptor 6", "AC-3 = توصیفگر 6",
+"ACTIVE", "فعال",
+"AUTO", "خودکار",
+"Aborted by user", "خاتمه یافته توسط کاربر",
+"Access", "دسترسی",
+"Action", "فعال",
+"Channel", "کانال",
+"Created", "ایجاد شده",
+"Creator", "ایجاد کننده",
+"Default", "پیشفرض",
+"No access", "عدم دسترسی",
+"None", "هیچکدام",
+"Normal", "عادی",
+"Number", "شماره",
+"OK", "تایید",
+"Off", "خاموش",
+"On", "روشن",
+"Password", "رمز",
+"Password2", "رمز 2",
+"Passwords", "رمزها",
+"Port", "پورت",
+"Position", "موقعیت",
+"Private", "خصوصی",
+"Sat", "ماهواره",
+"Services", "خدمات",
+"Show this page", "این صفحه را نشان بده",
+"Show version information", "نمایش اطلاعات ورژن",
+"Signal quality too poor", "کیفیت سیگنال بسیار ضعیف است",
+"Source", "منبع",
+"Source deleted", "منبع پاک شده",
+"Source quality is bad", "کیفیت منبع بد است",
+"Source reconfigured", "منبع دوباره تنظیم شد",
+"Standard", "استاندارد",
+"Start", "شروع",
+"Status", "وضعیت",
+"Stereo", "استریو",
+"Stop", "توقف",
+"Subtitle", "زیرنویس",
+"Sun", "یکشنبه",
+"System", "سیستم",
+"Thu", "پنج شنبه",
+"Tue", "سه شنبه",
+"Unimportant", "غیر مهم",
+"Universal LNB only", "فقط ال ان بی بین المللی",
+"Unknown", "ناشناخته",
+"User access error", "خطای دسترسی کاربر",
+"User limit reached", "پایان حد دسترسی کاربر",
+"Username", "نام کاربری",
+"Wed", "چهارشنبه",
+"hrs", "ساعت",
+"min", "دقیقه",
+"mins", "دقایق",
+NULL, NULL
+};
+
+static const char *tvh_locale_10[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nSaadaksesi enemmän lisätietoja vieraile Tvheadendin sivustolla\nhttps://tvheadend.org\n",
+"# Channels", "# kanavaa",
+"# Mapped channels", "# Merkatut kanavat",
+"# Muxes", "# Niput",
+"# Services", "# Palvelut",
+"# Services seen", "# Löydetyt palvelut",
+"1 day", "1 päivä",
+"1 month", "1 kuukausi",
+"1 week", "1 viikko",
+"1 year", "1 vousi",
+"2 months", "2 kuukautta",
+"2 weeks", "2 viikkoa",
+"2 years", "2 vuotta",
+"3 days", "3 päivää",
+"3 months", "3 kuukautta",
+"3 weeks", "3 viikkoa",
+"3 years", "3 vuotta",
+"Aborted by user", "Keskeytys käyttäjältä",
+"Admin", "Ylläpitäjä",
+"Admin password", "Ylläpidon salasana",
+"Admin username", "Ylläpidon käyttäjänimi",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Kaikki tuotot käytetään kehitysympäristön ylläpitoon ja testilaitteiston hankintaan.",
+"All: Record if different description", "Kaikki: Tallennus, jos poikkeava kuvaus",
+"All: Record if different episode number", "Kaikki: Tallennus, jos poikkeava jakson numero",
+"All: Record if different subtitle", "Kaikki: Tallennus, jos poikkeava alaotsikko",
+"All: Record once per day", "Kaikki: Tallennus kerran päivässä",
+"All: Record once per week", "Kaikki: Tallennus kerran viikossa",
+"Allow high bitrate mode (CI+ CAMs only).", "Salli korkea bitrate moodi (ainoastaan CI+ CAM)",
+"Allow/disallow HTSP protocol streaming, e.g Kodi (via pvr.hts) or Movian.", "Salli/kiellä HTSP protokollan striimaus, esim. Kodi (pvr.hts) tai Movian",
+"Allow/disallow HTTP streaming.", "Salli/kiellä HTTP striimaus",
+"Allow/disallow access to DVR via the HTSP protocol.", "Salli/kiellä pääsy DVR:n HTSP protokollan kautta",
+"Alternate configuration path", "Vaihtoinen asetuspolku",
+"Animals", "Eläimiä",
+"Any", "Mikä tahansa",
+"Arts", "Taide",
+"Athletics", "Yleisurheilu",
+"Ballet", "Baletti",
+"Bandwidth", "Kaistanleveys",
+"Bouquet", "Kimppu",
+"Cartoons", "Piirretyt",
+"Channel", "Kanava",
+"Channels", "Kanavat",
+"Cinema", "Elokuva",
+"Class", "Luokka",
+"Classical", "Klassinen",
+"Classical music", "Klassinen musiikki",
+"Comedy", "Komedia",
+"Comment", "Kommentti",
+"Commercial break", "Mainoskatko",
+"Configuration", "Asetukset",
+"Cooking", "Ruoanlaitto",
+"Created", "Luotu",
+"Creator", "Tekijä",
+"Culture (without music)", "Kulttuuri (ei musiikkia)",
+"Current affairs", "Ajankohtaisohjelmat",
+"Dance", "Tanssi",
+"Days of Week", "Viikonpäivät",
+"Debate", "Väittely",
+"Default", "Oletus",
+"Description", "Kuvaus",
+"Detective", "Etsivä",
+"Directory", "Hakemisto",
+"Discussion", "Keskustelu",
+"Do not use", "Älä käytä",
+"Documentary", "Dokumentti",
+"Drama", "Draama",
+"Economics", "Talous",
+"Education", "Koulutus",
+"Educational", "Opetusohjelmat",
+"Environment", "Ympäristö",
+"Episode", "Jakso",
+"Episode %d", "Jakso %d",
+"Errors", "Virheitä",
+"Every day", "Joka päivä",
+"Fantasy", "Fantasia",
+"Filename", "Tiedoston nimi",
+"Film", "Filmi",
+"Fine arts", "Korkeakulttuuri",
+"Fitness and health", "Terveys",
+"Folk", "Kansan",
+"Folkloric", "Kansanperinne",
+"Football", "Jalkapallo",
+"Foreign countries", "Vieraat maat",
+"Frequency", "Taajuus",
+"Frequency (Hz)", "Taajuus (Hz)",
+"Frequency (MHz)", "Taajuus (MHz)",
+"Frequency (kHz)", "Taajuus (kHz)",
+"Fri", "Pe",
+"Further education", "Jatkokoulutus",
+"Game show", "Visailu",
+"Gardening", "Puutarhanhoito",
+"General", "Yleinen",
+"Generic", "Yleinen",
+"Handicraft", "Käsityöt",
+"High", "Korkea",
+"Historical movie", "Historiallinen elokuva",
+"Horror", "Kauhu",
+"Icon (full URL)", "Ikoni (koko URL)",
+"Icon URL", "Ikonin URL",
+"If you'd like to support the project, please consider a donation.", "Jos haluat tukea kehitystyötä, ehkä voisit tehdä lahjoituksen.",
+"Important", "Tärkeä",
+"Internal", "Sisäinen",
+"Interview", "Haastattelu",
+"Language", "Kieli",
+"Languages", "Kielet",
+"Leisure hobbies", "Harrastukset",
+"Literature", "Kirjallisuus",
+"Location", "Sijainti",
+"Log", "Lok",
+"Low", "Alhainen",
+"Manufacturer", "Valmistaja",
+"Medicine", "Lääketiede",
+"Melodrama", "Melodraama",
+"Mon", "Ma",
+"Motor sport", "Moottoriurheilu",
+"Motoring", "Autoilu",
+"Movie", "Elokuva",
+"Music", "Musiikk",
+"Musical", "Musikaali",
+"Name", "Nimi",
+"Natural sciences", "Luonnontieteet",
+"Nature", "Luonto",
+"Network", "Verkko",
+"Networks", "Verkot",
+"News", "Uutiset",
+"News magazine", "Uutismakasiini",
+"No days", "Ei päiviä",
+"None", "Ei mitään",
+"Not set", "Ei asetettu",
+"Number", "Numero",
+"Opera", "Ooppera",
+"Owner", "Omistaja",
+"Password", "Salasana",
+"Password2", "Salasana2",
+"Passwords", "Salasanat",
+"Performing arts", "Esiintyvä taide",
+"Physiology", "Fysiologia",
+"Pilot", "Pilotti",
+"Political issues", "Politiikka",
+"Popular culture", "Populaarikulttuuri",
+"Port", "Portti",
+"Position", "Sijainti",
+"Presentation", "Esitys",
+"Priority", "Prioriteetti",
+"Priority (-10..10)", "Prioriteetti (-10..10)",
+"Private", "Yksityinen",
+"Psychology", "Psykologia",
+"Puppets", "Nukketeatteri",
+"Quiz", "Visailu",
+"Religion", "Uskonto",
+"Religious", "Uskonnollinen",
+"Remarkable people", "Merkkihenkilöt",
+"Reports", "Raportit",
+"Romance", "Romantiikka",
+"Sat", "La",
+"Science", "Tiede",
+"Science fiction", "Sci-Fi",
+"Season", "Tuotantokausi",
+"Season %d", "Tuotantokausi %d",
+"Serious", "Vakava",
+"Server", "Palvelin",
+"Service", "Palvelu",
+"Services", "Palvelut",
+"Settings", "Asetukset",
+"Soap", "Saippua",
+"Soccer", "Jalkapallo",
+"Sports", "Urheilu",
+"Sports magazines", "Urheilumakasiinit",
+"Subtitle", "Tekstitys",
+"Sun", "Su",
+"System", "Järjestelmä",
+"Team sports (excluding football)", "Joukkueurheilu (ei jalkapallo)",
+"Technology", "Teknologia",
+"Thriller", "Jännitys",
+"Thu", "To",
+"Tourism / Travel", "Matkailu",
+"Traditional arts", "Perinteiset taiteet",
+"Traditional music", "Perinteinen musiikki",
+"Tue", "Ti",
+"Unknown", "Tuntematon",
+"Unknown reason (%i)", "Tuntematon syy (%i)",
+"Username", "Käyttäjänimi",
+"War", "Sota",
+"Water sport", "Vesiurheilu",
+"Weather report", "Säätiedotus",
+"Wed", "Ke",
+"Western", "Lännen elokuva",
+NULL, NULL
+};
+
+static const char *tvh_locale_11[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nPour plus d'informations, visitez le site :\nhttps://tvheadend.org\n",
+"# Channels", "# Chaînes",
+"# Mapped channels", "Chaînes associées",
+"# Muxes", "# Transpondeurs",
+"# Services seen", "# Services vus",
+"# tune repeats", "Répétition du tuner",
+"(Default profile)", "(Profil par Défaut)",
+"1 day", "1 jour",
+"1 month", "1 mois",
+"1 week", "1 semaine",
+"1 year", "1 an",
+"2 months", "2 mois",
+"2 weeks", "2 semaines",
+"2 years", "2 ans",
+"2-Port switch (universal LNB)", "Switch 2 Ports (universal LNB)",
+"3 days", "3 jours",
+"3 months", "3 mois",
+"3 weeks", "3 semaines",
+"3 years", "3 ans",
+"4-Port switch (universal LNB)", "Switch 4 Ports (universal LNB)",
+"5 days", "5 jours",
+"6 months", "6 mois",
+"AC-3 = descriptor 6", "AC-3 = descripteur 6",
+"AC-3 detection", "Détection AC-3",
+"ANY", "TOUS",
+"Aborted by user", "Annulé par l'utilisateur",
+"Access", "Accès",
+"Adapter in use by another subscription", "Adaptateur déjà utilisé par un autre service",
+"Add file and line numbers to debug", "Ajouter le fichier et le numéro de ligne au debug",
+"Add the thread ID to debug", "Ajouter l'ID du processus au debug",
+"Admin password", "Mot de passe administrateur",
+"Adult movie", "Films pour adulte",
+"Advanced", "Avancé",
+"Advanced (non-universal LNBs, rotors, etc.)", "Avancé (LNBs spécifiques, rotors, etc.)",
+"Advanced streaming", "Diffusion avancée",
+"Adventure", "Aventure",
+"Advertisement / Shopping", "Publicité / Shopping",
+"All (Streaming plus DVR)", "Tout (flux + enregistrements)",
+"All DVR (rw)", "Tout les enregistrements (rw)",
+"All lower-case", "Tout en minuscule",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Toutes les sommes collectées sont utilisées pour supporter l'infrastructure technique et acheter du matériel de test.",
+"Allowed network", "Réseau autorisé",
+"Alternate PID path", "Répertoire de PID alternatif",
+"Alternate configuration path", "Répertoire alternatif pour la config",
+"Altitude (in meters).", "Altitude (en mètre)",
+"Altitude (meters)", "Altitude (mètres)",
+"Animals", "Animalier",
+"Any", "Tous",
+"Athletics", "Athletisme",
+"Audio bitrate (kb/s) (0=auto)", "Débit Audio (kb/s) (0=Auto)",
+"Audio codec", "Codec audio",
+"Audio stream filter", "Filtre de flux audio",
+"Auto check disabled", "Validation automatique désactivée",
+"Auto check enabled", "Vérification automatique activée",
+"Auto record", "Enregistrement automatique",
+"Auto record caption", "Enregistrement automatique des sous-titres",
+"Auto recording%s%s", "Auto enregistrement%s%s",
+"Auto time record", "Enregistrement horaire automatique",
+"Auto-Map to channels", "Association automatique des chaînes",
+"Automatic checking", "Vérification automatique",
+"Automatically map EPG source", "Associer automatiquement la source EPG",
+"Automatically name from network", "Réseau automatique pour IPTV",
+"Autorec maximum count (0=unlimited)", "Nombre maximum d'enregistrements auto (0=sans limite)",
+"Autorec maximum schedules limit (0=unlimited)", "Nombre maximum d'enregistrements programmés (0=sans limite)",
+"Bad", "Mauvais",
+"Bandwidth", "Bande passante",
+"Based on software from", "Basé sur le logiciel de",
+"Boot ID", "ID de démarrage",
+"Brand", "Marque",
+"Broadcast", "Diffusion",
+"Broadcasting", "Diffusion",
+"Build", "Version",
+"CA ID", "ID du CA ",
+"CA client %i", "Client CA %i",
+"CA identification", "Identification du CA",
+"CA provider", "Fournisseur du CA",
+"CA stream filter", "Filtre du flux du CA",
+"CAPMT interval (ms)", "Intervalle CAPMT (ms)",
+"CAPMT query interval (ms)", "Intervalle de recherche CAPMT (ms)",
+"CRID authority", "Autorité CRID",
+"Cache scheme", "Système de cache",
+"Camd.socket filename / IP Address (TCP mode)", "Nom de fichier camd.socket / Adresse IP (mode TCP)",
+"Cartoons", "Dessins animés",
+"Channel", "Chaine",
+"Channel icon", "Icône de la chaine",
+"Channel icon path (see Help)", "Chemin des icônes des chaines (voir l'aide)",
+"Channel name", "Nom de la chaine",
+"Channel number", "Numéro de la chaîne",
+"Channel number offset", "Décalage des numéros de chaînes",
+"Channel numbers from", "Numéro de chaîne à partir de",
+"Channel tag", "Etiquette de la chaine",
+"Channel tag reference", "Référence de l’étiquette de la chaine",
+"Channel tags", "Etiquettes de chaine",
+"Channels", "Chaines",
+"Character set", "Codage de caractères",
+"Check availability", "Vérifier la disponibilité",
+"Children's / Youth programs", "Programmes pour enfants",
+"Class", "Classe",
+"Classical", "Classique",
+"Classical music", "Musique classique",
+"Client name", "Nom du client",
+"Clone scheduled entry on error", "Dupliquer l'entrée programmée en cas d'erreur",
+"Comedy", "Comédie",
+"Command delay time (ms) (10-200)", "Temps d'attente de commande (ms) (10-200)",
+"Command time (ms) (10-100)", "Temps d'attente commande (ms) (10-100)",
+"Comment", "Commentaire",
+"Commercial break", "Coupure publicitaire",
+"Committed", "Validé",
+"Completed OK", "Complété avec succès",
+"Conditional access client", "Conditions d’accès du client",
+"Configuration ID", "ID de Configuration ",
+"Configuration name", "Nom de la config",
+"Configuration version", "Version de la configuration ",
+"Connection limit type", "Type de limite de connexion",
+"Container", "Conteneur",
+"Content character set", "Codage de caractères du contenu",
+"Content type", "Type de contenu",
+"Contest", "Concours",
+"Continue even if descrambling fails", "Continuer en cas d'erreur de décryptage",
+"Cookie expiration (days)", "Expiration des cookies (jours)",
+"Cooking", "Cuisine",
+"Copy codec type", "Copier le type de codec",
+"Copy layout", "Copier la disposition",
+"Create bouquet", "Créer un bouquet",
+"Created", "Créé",
+"Creator", "Auteur",
+"Cron multi-line", "programmation multi ligne",
+"Culture (without music)", "Culture (sans musique)",
+"Current affairs", "Affaire en cours",
+"Custom HTTP headers", "En-têtes HTTP personnalisés",
+"DBus - use the session message bus instead of the system one", "DBus - utiliser le message de session bus au lieu de celui du système",
+"DSCP/TOS for streaming", "DSCP/TOS pour les flux",
+"DVB EPG ID", "ID de l'EPG DVB",
+"DVB scan files", "Fichiers des scans DVB",
+"DVB scan files path", "Répertoire des fichiers des scan DVB",
+"DVB-C network", "Réseau DVB-C",
+"DVB-S 4-port", "DVB-S 4 ports",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, expérimental)",
+"DVB-S advanced", "DVB-S avancé",
+"DVB-S network", "Réseau DVB-S",
+"DVB-S satellite configuration", "Positions des satellites",
+"DVB-T network", "Réseau DVB-T",
+"DVR", "Enregistrements",
+"DVR Auto-record entry", "Entrée d'enregistrement automatique du magnétoscope",
+"DVR behavior", "Comportement du magnétoscope",
+"DVR configuration", "Configuration du magnétoscope",
+"DVR configuration profile", "Profil de configuration de l'enregistrement",
+"DVR configuration profiles", "Profils de configuration de l'enregistrement",
+"DVR file retention period", "Période de conservation de l'enregistrement ",
+"DVR log retention", "Durée de conservation des logs de l'enregistrement",
+"DVR log retention period", "Période de conservation de l'enregistrement ",
+"DVR override: high", "Enregistrement passer outre: Haut",
+"DVR override: important", "DVR passer outre: Important",
+"DVR override: low", "DVR passer outre: Bas",
+"DVR override: normal", "DVR passer outre: Normal",
+"DVR override: unimportant", "DVR passer outre: sans importance",
+"DVR time record entry", "Entrée du temps d'enregistrement du DVR",
+"Dance", "Danse",
+"Data errors", "Erreurs de données",
+"Days of Week", "Jour de la semaine",
+"Days of week", "Jour de la semaine",
+"Debate", "Débat",
+"Debug libav log", "Traces de debug libav",
+"Debug log path", "Répertoire des traces de debug",
+"Debug options", "Options de debug",
+"Debug subsystems", "Debug des sous-système",
+"Debug to syslog", "Debug vers un syslog",
+"Debug trace (low-level)", "Trace de debug (bas niveau)",
+"Debugging", "Débogage",
+"Default", "Défaut",
+"Default language(s)", "Langue par défaut",
+"Default priority", "Priorité par défaut",
+"Delivery system", "Système de livraison",
+"Demux path", "Chemin pour le demux",
+"Descramble services (limit per mux)", "Service de décryptage (max par multiplex)",
+"Descrambler buffer (TS packets)", "Taille du Tampon du Débrouilleur (Paquets venant d'un flux de transport MPEG)",
+"Detective", "Policier",
+"Device ID", "ID d'appareil",
+"Device model", "Modèle d'appareil",
+"Device path", "Chemin du périphérique",
+"Directory", "Répertoire",
+"Directory permissions (octal, e.g. 0775)", "Permissions du répertoire (octal, par ex. 0775)",
+"Disable", "Désactivé",
+"Disable DVB bouquets", "Désactiver les bouquets DVB",
+"Disable SAT>IP client", "Désactiver le client SAT>IP",
+"Disable all access control checks", "Désactive tous les contrôles d’accès",
+"Disable debug on stderr", "Désactiver le debug vers le stderr",
+"Disable device/firmware-specific workarounds", "Désactive les palliatifs spécifiques au périphérique/firmware",
+"Disable syslog (all messages)", "Désactive le syslog (Tous les messages)",
+"Disabled", "Désactivé",
+"DiseqC repeats", "Répétition du DiseqC",
+"DiseqC rotor", "Rotor du DiseqC",
+"DiseqC switch", "Switch du DiseqC",
+"Do not use", "Ne pas utiliser",
+"Documentary", "Documentaire",
+"Don't backup configuration tree at upgrade", "Ne pas sauvegarder la configuration durant la mise à jour",
+"Don't include title in filename", "Ne pas inclure le titre dans le nom de fichier",
+"Don't keep", "Ne pas garder",
+"Don't re-record", "Ne pas ré-enregistrer",
+"Don't reschedule", "Ne pas reprogrammer",
+"Drama", "Drame",
+"Duplicate handling", "Gestion des doublons",
+"EIT - skip TSID check", "EIT - Ne pas vérifier le TSID",
+"EPG grabber", "Récupérateur d'EPG",
+"EPG grabber channel", "Récupérateur d'EPG des chaines",
+"EPG grabber configuration", "Config de la récupération d'EPG",
+"EPG name", "Nom du Guide des programmes électronique",
+"EPG scan", "Recherche de l'EPG",
+"EPG scan timeout in seconds (30-7200)", "Délais max d'attente du scan de l'EPG en secondes (30-7200)",
+"EPG source", "Source de l'EPG",
+"EPG update window", "Fenêtre de mise a jour de l'EPG",
+"Economics", "Economie",
+"Educational", "Education",
+"Elementary stream filter", "Filtre élémentaires des flux ",
+"Enable (auto)", "Activer (auto)",
+"Enable DBus", "Activer DBus",
+"Enable NTP driver", "Activer les drivers NTP",
+"Enable coredumps for daemon", "Activer les coredumps pour le démon",
+"Enable debug on stderr", "Activer le debug vers le stderr",
+"Enable debug subsystems", "Activer le debug du sous-système",
+"Enable debug to file", "Activer le debug vers un fichier",
+"Enable debug to syslog", "Activer le debug vers syslog",
+"Enable or disable this configuration.", "Activer ou désactiver cette configuration",
+"Enable syslog", "Activer le syslog",
+"Enable trace subsystems", "Activer les traces du sous-système",
+"Enable web UI debug (non-minified JS)", "Activer le debug webUI (JS non minifié)",
+"Enabled", "Activé",
+"Encrypted", "Encrypté",
+"Encrypted service", "Service encrypté",
+"Entertainment programs for 10 to 16", "Programmes éducatifs de 10 a 16 ans",
+"Entertainment programs for 6 to 14", "Programmes éducatifs de 6 a 14 ans",
+"Environment", "Environnement",
+"Environment (pipe)", "Environnement (pipe)",
+"Error code", "Code d'erreur",
+"Errors", "Erreurs",
+"Every day", "Chaque jours",
+"Expeditions", "Expéditions",
+"Experimental film", "Films expérimental",
+"Exported tuners", "Tuners exportés",
+"External", "Externe",
+"External EPG grabber", "Récupérateur externe d'EPG",
+"External IP (NAT)", "Adresse IP externe (NAT)",
+"External URL", "URL externe",
+"Extra arguments", "Arguments supplémentaires",
+"Extra start time", "Temps supplémentaire avant le début",
+"Extra stop time", "Temps supplémentaire après la fin",
+"FAIL", "En erreur",
+"FEC high", "FEC superieur",
+"FEC low", "FEC bas",
+"Factual topics", "Sujets d'actualité",
+"Failed", "Echoué",
+"Failed DVR", "Enregistrement en erreur",
+"Fantasy", "Fantastique",
+"File missing", "Fichier manquant",
+"File not created", "Fichier non créé",
+"File permissions (octal, e.g. 0664)", "Permissions du fichier (octal, par ex. 0664)",
+"File size", "Taille du fichier",
+"Filename", "Nom du fichier",
+"Filename character set", "Type de caractères pour les noms de fichiers",
+"Filename options", "Options du nom de fichier",
+"Fine arts", "Beaux-arts",
+"Finished", "Terminé",
+"Fitness and health", "Fitness et santé",
+"Folkloric", "Folklorique",
+"Force CA ID (e.g. 0x2600)", "Forcer l'ID du CA (par ex. 0x2600)",
+"Force old status", "Forcer l'état précédent",
+"Force pilot for DVB-S2", "Forcer le pilote pour le DVB-S2",
+"Force priority", "Forcer la priorité",
+"Force teardown delay", "Délais pour forcer la fin de communication",
+"Foreign countries", "Pays étrangers",
+"Forever", "Pour toujours",
+"Fork and run as daemon", "Dupliquer le processus en tant que service",
+"Format string", "Format de chaîne de caractères",
+"Frequency", "Fréquence",
+"Frequency (Hz)", "Fréquence (Hz)",
+"Frequency (MHz)", "Fréquence (MHz)",
+"Frequency (kHz)", "Fréquence (kHz)",
+"Fri", "Ven",
+"Friendly name", "Nom commun",
+"Frontend number", "Numéro du frontal",
+"Frontend path", "Répertoire du frontal",
+"Full pathname specification", "Spécification du chemin de fichier complet",
+"Full-text", "Mode texte",
+"Further education", "Formation continue",
+"Game show", "Exposition de jeux",
+"Gardening", "Jardinage",
+"General", "Général",
+"General configuration", "Configuration Générale",
+"Generic", "Générique",
+"Generic options", "Options générique",
+"Guard interval", "Intervalle de protection",
+"HD: high definition", "HD: Haute Définition",
+"HTSP Default Stream Settings", "Paramètre par défaut du flux  HTSP",
+"HTSP stream profile", "Profile du flux HTSP",
+"HTSP streaming", "Flux HTSP",
+"Handicraft", "Artisanat",
+"Hearing impaired", "Malentendant",
+"Hierarchy", "Hiérarchie",
+"High", "Haut",
+"Historical movie", "Film d’époque",
+"Horror", "Horreur",
+"Hostname/IP", "Nom d’hôte/adresse IP",
+"IDLE", "En veille",
+"IP address", "Adresse IP",
+"IP blocking", "Blocage des IP",
+"IPTV Multiplex", "Multiplex de l'IPTV",
+"ISI (Stream ID)", "ISI (ID du flux)",
+"Icon", "Icône",
+"Icon (full URL)", "Icône (URL complète)",
+"Icon URL", "URL de l’icône",
+"Icon base URL", "URL de base de l’icône",
+"Icon has title", "L'icône possède un titre",
+"Icons from", "Icône venant de",
+"Idle", "En attente",
+"Idle scan", "Scan en veille",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Si aucun compte d'utilisateur n'existe, alors en créer un sans\nnom d'utilisateur ni mot de passe. A utiliser avec précaution\npuisque qu'il donne tous les accès en admin à votre\ninstallation TVHeadEnd tant que vous n'avez pas créé/édité ses\ndroits via la console web.",
+"If you'd like to support the project, please consider a donation.", "Si vous voulez aider ce projet, pensez a faire un don.",
+"Ignore EPG (EIT)", "Ignorer EPG (EIT)",
+"Ignore descriptor 5", "Ignorer le descripteur 5",
+"Ignore invalid SSL certificate", "Ignorer le certificat SSL invalide",
+"Immediately abort", "Annuler immédiatement",
+"Include channel name in filename", "Inclure le nom de la chaine dans le nom du fichier",
+"Include date in filename", "Inclure la date dans le nom du fichier",
+"Include subtitle in filename", "Inclure les sous-titres dans le nom du fichier",
+"Include time in filename", "Inclure l'heure dans le nom du fichier",
+"Information area", "Zone d'information",
+"Informational", "Information",
+"Initial scan", "Scan initial",
+"Internal", "Interne",
+"Invalid", "Invalide",
+"Invalid adapter number '%s'\n", "Numéro d'adaptateur invalide '%s'\n",
+"Invalid target", "Destination invalide",
+"Keep", "Garder",
+"Kill signal (pipe)", "Signal de Fermeture (pipe)",
+"Kill timeout (pipe/secs)", "Durée avant Fermeture (pipe/secs)",
+"Language", "Langage",
+"Language settings", "Réglage de la langue",
+"Languages", "Langages",
+"Last updated from", "Dernière mise à jour par",
+"Leisure hobbies", "Loisir et passe-temps",
+"Listen / Connect port", "Port d'écoute/connexion",
+"Listen on IPv6", "Utiliser IPv6",
+"Literature", "Littérature",
+"Local bind IP address", "Liaison locale d'adresse IP",
+"Location", "Lieu",
+"Low", "Bas",
+"MPEG-TS Pass-thru", "MPEG-TS Pass-through",
+"MPEG-TS Pass-thru/built-in", "MPEG-TS Pass-through/Interne",
+"Magazines", "Magasines",
+"Make subdirectories per channel", "Créer un sous-répertoire par chaine",
+"Make subdirectories per day", "Créer un sous-répertoire par jour",
+"Make subdirectories per title", "Créer un sous-répertoire par titre",
+"Manufacturer", "Fabriquant",
+"Manufacturer URL", "URL du fabriquant",
+"Map all services", "Mapper tous les services",
+"Matroska (mkv)/built-in", "Matroska (mkv)/par défaut",
+"Maximal channel number", "Nombre maximal de chaînes",
+"Maximum PIDs", "PID Maximum",
+"Maximum RAM size (MB)", "Taille max de la RAM (MB)",
+"Maximum bandwidth (Kbps)", "Bande passante max (Kbps)",
+"Maximum count (0=default)", "Nombre maximum (0=sans limite)",
+"Maximum duration", "Durée maximum",
+"Maximum length of PIDs", "Longueur maximum des PIDs",
+"Maximum period (mins)", "Période maxi (min)",
+"Maximum size (MB)", "Taille max (MB)",
+"Maximum timeout (seconds)", "Délais max (secondes)",
+"Medicine", "Médecine",
+"Melodrama", "Mélodrame",
+"Merge same name", "Fusionner les noms identiques",
+"Minimal channel number", "Nombre minimal de chaînes",
+"Minimum duration", "Durée minimum",
+"Missing In PAT/SDT", "Manquant dans PAT/SDT",
+"Model description", "Description du modèle",
+"Model name", "Nom du modèle",
+"Model number", "Numéro du modèle",
+"Mon", "Lun",
+"More verbose libav log", "Plus de log pour libav",
+"Motor sport", "Sports motorisés",
+"Motoring", "Automobiles",
+"Movie", "Film",
+"Music", "Musique",
+"Mux UUID", "UUID du Mux",
+"Mux not enabled", "Mux non activé",
+"NONE", "Aucun",
+"Name", "Nom",
+"Names", "Noms",
+"Natural sciences", "Sciences naturelles ",
+"Network", "Réseau",
+"Network A", "Réseau A",
+"Network B", "Réseau B",
+"Network ID (limit scanning)", "ID du réseau (limitation du scan)",
+"Network UUID", "UUID du réseau",
+"Network access", "Accès réseau",
+"Network discovery", "Découverte du réseau",
+"Network name", "Nom du réseau",
+"Network prefix", "Préfixe du réseau",
+"Network settings", "Paramètres du réseau",
+"Network type", "Type du réseau",
+"Networks", "Réseaux",
+"News", "Journal",
+"News magazine", "Journal",
+"Next tune delay in ms (0-2000)", "Délai de changement de fréquence, en ms (0-2000)",
+"No", "Non",
+"No PIN", "Pas de PIN",
+"No access", "Aucun accès",
+"No adapters specified!\n", "Aucun adaptateur spécifié\n",
+"No assigned adapters", "Pas d'adaptateurs attribués",
+"No days", "Aucun jour",
+"No descrambler", "Pas de décrypteur",
+"No free adapter", "Pas d'adaptateur disponible",
+"No input detected", "Pas d'entrée détectée",
+"No service assigned to channel", "Aucun service assigné a cette chaine",
+"No service enabled", "Pas de service activé",
+"No source available", "Pas de source disponible",
+"None", "Aucun",
+"Not set", "Non défini",
+"Not set (none or channel configuration)", "non défini (rien ou config de chaine)",
+"Not set (use channel or DVR configuration)", "Non défini (utiliser la configuration de la chaine ou de l'enregistreur)",
+"Number", "Numéro",
+"Number of tsfile tuners", "Nombre de tuners tsfile",
+"OK (partial)", "OK (partiel)",
+"Older OSCam", "Ancien OSCam",
+"Only Bulsatcom 39E", "Bulstatcom 39E uniquement",
+"Only EIT", "Seulement EIT",
+"Only OpenTV Sky Ausat", "OpenTV Sky Ausat uniquement",
+"Only OpenTV Sky Italia", "OpenTV Sky Italia uniquement",
+"Only OpenTV Sky UK", "OpenTV Sky UK uniquement",
+"Only PSIP (ATSC)", "Seulement PSIP (ATSC)",
+"Only UK Freesat", "UK Freesat uniquement",
+"Only UK Freeview", "UK Freeview uniquement",
+"Only Viasat Baltic", "Viasat Baltic uniquement",
+"Opera", "Opéra",
+"Output directory for tsdebug", "Dossier de sortie pour tsdebug",
+"Over-the-air", "hertzien",
+"Over-the-air Cron multi-line", "Programmation multi ligne hertzien",
+"Over-the-air EPG", "EPG de la diffusion",
+"Owner", "Propriétaire",
+"PEND", "En attente",
+"PIDs 21 in setup", "PIDs 21 dans la configuration",
+"PIDs in setup", "PIDs dans la configuration",
+"PLP ID", "ID du PLP",
+"Password", "Mot de passe",
+"Password2", "Mot de passe 2",
+"Passwords", "Mots de passe",
+"Path", "Répertoire",
+"Path to an icon for this channel. This can be named however you wish, as either a local (file://) or remote (http://) image. See Help for more infomation.", "Chemin vers l’icône pour cette chaine. Peut être nommé comme vous le souhaitez, être une image locale (file://) ou distante (http://). Consulter l'aide pour plus d'information",
+"Performing arts", "Arts du spectacle",
+"Physiology", "Physiologie",
+"Picon path (see Help)", "Répertoire pour Picon (voir l'aide)",
+"Pilot", "Pilote",
+"Polarization", "Polarisation",
+"Political issues", "Questions politiques",
+"Popular culture", "Culture populaire ",
+"Power save", "Economie d’énergie",
+"Prefer picons over channel name", "Choisir les picons au lieu des noms de chaine",
+"Preferred CA PID", "CA favoris du PID",
+"Presentation", "Présentation",
+"Press", "Presses",
+"Priority", "Priorité",
+"Priority (-10..10)", "Priorité (-10..10)",
+"Private", "Privé",
+"Profile name", "Nom du profil",
+"Provider ID", "ID du provider",
+"Psychology", "Psychologie",
+"Puppets", "Marionnette",
+"RTSP port", "Port RTSP",
+"Re-fetch period (hours)", "Période avant d'aller re-chercher (heures)",
+"Re-fetch period (mins)", "Période avant d'aller re-chercher (minutes)",
+"Re-record%s%s", "Ré-enregistrer%s%s",
+"Re-try period (hours)", "Période pour réessayer (heures)",
+"Record all", "Enregistrer tout",
+"Reject", "Rejeter",
+"Religious", "Religieux",
+"Remarkable people", "Célébrités",
+"Remove HTTP arguments", "Supprimer les paramètres HTTP",
+"Replace whitespace in title with '-'", "Remplacer les espace dans le titre avec '-'",
+"Reports", "Rapports",
+"Rerun of", "Rediffusion",
+"Rescan", "Scanner à nouveau",
+"Reserved", "Réservé",
+"Resolution (height)", "Résolution (hauteur)",
+"Respawn (pipe)", "Recommencer (pipe)",
+"Rewrite EIT", "Réécriture EIT",
+"Rewrite PAT", "Réécriture PAT",
+"Rewrite PMT", "Réécriture PMT",
+"Rewrite SDT", "Réécriture SDT",
+"Rolloff", "Transfert",
+"Run as group", "En tant que groupe",
+"Run as user", "En tant qu'utilisateur",
+"Running", "En cours",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "Numéro du port RTSP pour le serveur SAT>IP\n(Par défaut: -1 = désactive, 0 = webconfig, le port standard est 554)",
+"SSL verify peer", "Vérifications des paires du tunnel SSL ",
+"Sat", "Satellite",
+"Satconf", "Config du satellite",
+"Schedule a re-recording if more errors than (0=off)", "Programme un ré-enregistrement si plus de (0=aucun)",
+"Scheduled for recording", "Programmé pour l'enregistrement",
+"Season", "Saison",
+"Season %d", "Saison %d",
+"Send full PLAY cmd", "Envois commande complète PLAY",
+"Serial number", "Numéro de série",
+"Serious", "Grave",
+"Serious music", "Musique",
+"Server", "Serveur",
+"Server UUID", "Serveur UUID",
+"Service ID", "ID du service",
+"Settings", "Paramètres",
+"Show", "Spectacles",
+"Show this page", "Montre cette page",
+"Show version information", "Information de version",
+"Signal quality too poor", "Signal de trop faible qualité",
+"Signal scale (240 or 100)", "Echelle du signal (240 ou 100)",
+"Soap", "Feuilleton",
+"Soccer", "Football",
+"Social advisory", "Conseil social",
+"Source deleted", "Source effacée",
+"Source quality is bad", "La qualité de la source est mauvaise",
+"Source reconfigured", "Source reconfigurée",
+"Special events (Olympic Games, World Cup, etc.)", "Évènements spéciaux (Jeux Olympiques, Coupe du Monde, etc.)",
+"Specify User-Agent header for the http client", "Spécifier un User-Agent pour le client http",
+"Specify alternative htsp port", "Spécifier un port htsp alternatif",
+"Specify alternative http port", "Spécifier un port http alternatif",
+"Specify alternative http webroot", "Spécifier un répertoire web racine alternatif",
+"Specify bind address", "Spécifier une adresse de liaison",
+"Specify extra htsp port", "Spécifier un port supplémentaire pour le HTSP",
+"Spiritual sciences", "Sciences Spirituelle",
+"Sports magazines", "Magazines sportifs",
+"Start", "Démarrer",
+"Start after", "Démarrer après",
+"Start before", "Démarrer avant",
+"Start time", "Heure de démarrage",
+"Status", "Etat",
+"Stereo", "Stéréo",
+"Stop time", "Heure de fin",
+"Storage space", "Espace de stockage",
+"Streaming", "Envoi du flux",
+"Subscribe to a service permanently", "S'inscrire en permanence à un service",
+"Subscription overridden", "Inscription ignorée",
+"Subtitle", "Sous-titre",
+"Sun", "Dim",
+"Sync + Don't keep", "Sync + Ne pas garder",
+"System", "Système",
+"Tags", "Etiquette",
+"Talk show", "Débats",
+"Team sports (excluding football)", "Sports collectifs (sauf football)",
+"Technology", "Technologique",
+"Testing", "En test",
+"Testing options", "Options de test",
+"Thu", "Jeu",
+"Time", "Horaire",
+"Time missed", "Horaire manqué",
+"Time recording%s%s", "Temps d'enregistrement%s%s",
+"Timeout (sec) (0=infinite)", "Délais (sec) (0=infini)",
+"Timeout (seconds)", "Délais (secondes)",
+"Timout (secs)", "Délais (secs)",
+"Title", "Titre",
+"Toggle details", "inverser les détails",
+"Tourism / Travel", "Tourisme / Voyage",
+"Trace subsystems", "Traces des sous-systèmes",
+"Traditional arts", "Arts traditionnel ",
+"Traditional music", "Musique classique",
+"Transponder ID", "ID du transpondeur",
+"Tue", "Mar",
+"Tuner bind IP address", "Liaison tuner d'adresse IP",
+"Tuning failed", "Erreur du tuner",
+"Turn off LNB when idle", "Arrêter le LNB quand il est au repos",
+"Tvheadend server name", "Nom du serveur Tvheadend",
+"URL with the SAT>IP server XML location", "URL avec l'emplacement XML du serveur SAT>IP",
+"Uncommitted", "Dévalidé",
+"Unimportant", "Sans importance",
+"Universal LNB only", "Seulement le NLB universel",
+"Unknown", "Inconnu",
+"Unknown file", "Fichier inconnu",
+"Unknown reason (%i)", "Raison inconnue (%i)",
+"Unlimited size", "Taille illimitée",
+"Unlimited time", "Temps illimité",
+"Unset (default)", "Non défini (défaut)",
+"Update channel icon", "Mise à jour de l'icônes des chaines",
+"Update channel name", "Mise à jour du nom des chaines",
+"Update channel number", "Mise à jour du numéro des chaines",
+"Update time", "Mise à jour de l'heure",
+"Update tolerance (ms)", "Mise à jour de la tolérance (ms)",
+"Usage: %s [OPTIONS]\n", "Utilisation : %s [OPTIONS]\n",
+"Use Windows-compatible filenames", "Utiliser des nom de fichiers compatible avec Windows",
+"Use XSPF playlist instead of M3U", "Utiliser des listes XSPF au lieu de M3U",
+"Use original", "Utiliser l'original",
+"User access error", "Erreur d’accès pour l'utilisateur",
+"User language", "Langue de l'utilisateur",
+"User limit reached", "Limite de l'utilisateur atteinte",
+"Username", "Nom de l'utilisateur",
+"Variety show", "Spectacle de variété",
+"Video", "Vidéo",
+"Visually impaired commentary/audio description", "Sous-titrage sourds et malentendants",
+"WEBM/built-in", "WEBM/Interne",
+"Waiting for program start", "En attente du démarrage du programme",
+"Waiting for stream", "En attente du flux",
+"War", "Guerre",
+"Water sport", "Sports aquatique",
+"Weather report", "Météo",
+"Wed", "Mer",
+"Yes", "Oui",
+"addpids/delpids supported", "addpids/delpids supportés",
+"invalid option specified [%s]", "Option spécifiée invalide [%s]",
+"option %s requires a value", "Une valeur est obligatoire pour l'option %s",
+"tsfile input (mux file)", "Entrée tsfile (fichier mux)",
+NULL, NULL
+};
+
+static const char *tvh_locale_12[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nלמידע נוסף בקר באתר Tvheadend:\nhttps://tvheadend.org\n",
+"# Channels", "# ערוצים",
+"# Muxes", "# מוקסים",
+"# Services", "# שירותים",
+"1 day", "יום 1",
+"ACTIVE", "פעיל",
+"AUTO", "אוטומטי",
+"Aborted by user", "נסגר ע\"י המשתמש",
+"Access", "גישה",
+"Action", "פעולה",
+"Adapter in use by another subscription", "המתאם בשימוש ע\"י תהליך אחר",
+"Add file and line numbers to debug", "הוסף קובץ ומספרי שורות לניפוי שגיאות",
+"Add the thread ID to debug", "הוסף מזהה של הליך משנה לניפוי שגיאות",
+"Admin", "מנהל",
+"Admin password", "סיסמת מנהל",
+"Admin username", "שם משתמש מנהל",
+"Adventure", "הרפתקאות",
+"Advertisement / Shopping", "פרסומת/ קניות",
+"Animals", "בעלי חיים",
+"Any", "הכל",
+"Arts", "אמנויות",
+"Athletics", "אתלטיקה",
+"Audio codec", "מקודד אודיו",
+"Auto", "אוטומטי",
+"Auto record", "הקלטה אוטומטית",
+"Ballet", "בלט",
+"Bandwidth", "רוחב פס",
+"Based on software from", "מבוסס על תוכנה מ",
+"Bouquet", "סל ערוצים",
+"Bouquet (auto)", "סל ערוצים (אוטומטי)",
+"Cartoons", "מצויר",
+"Channel", "ערוץ",
+"Channel does not exist", "ערוץ לא קיים",
+"Channel icon", "סמל ערוץ",
+"Channel name", "שם ערוץ",
+"Channel not found", "ערוץ לא נמצא",
+"Channel number", "מספר ערוץ",
+"Channels", "ערוצים",
+"Cinema", "קולנוע",
+"Comedy", "קומדיה",
+"Comment", "הערה",
+"Commercial break", "הפסקת פרסומות",
+"Completed OK", "הסתיים בהצלחה",
+"Configuration", "הגדרות",
+"Configuration version", "גירסת הגדרה",
+"Cooking", "בישול",
+"Copy codec type", "העתק סוג מקודד",
+"Created", "נוצר",
+"Creator", "יוצר",
+"Culture (without music)", "תרבות (ללא מוסיקה)",
+"DVR", "הקלטה",
+"Days of Week", "ימים בשבוע",
+"Debug log path", "נתיב יומן ניפוי שגיאות",
+"Debug to syslog", "ניפוי שגיאות ליומן מערכת",
+"Debugging", "ניפוי שגיאות",
+"Default", "ברירת מחדל",
+"Default language.", "שפת ברירת מחדל",
+"Description", "תיאור",
+"Detective", "בלשי",
+"Device ID", "מזהה מכשיר",
+"Directory", "תיקיה",
+"Disable", "נטרול",
+"Disable SAT>IP client", "בטל קליינט SAT>IP",
+"Discussion", "דיון",
+"Do not use", "אל תשתמש",
+"Documentary", "דוקומנטרי",
+"Don't backup configuration tree at upgrade", "אל תגבה הגדרות בשדרוג",
+"Don't keep", "אל תשמור",
+"Drama", "דרמה",
+"Economics", "כלכלה",
+"Education", "חינוך",
+"Educational", "חינוכי",
+"Enable (auto)", "פעיל (אוטומטי)",
+"Enable debug to file", "הפעל ניפוי שגיאות לקובץ",
+"Enabled", "פעיל",
+"Encrypted", "מוצפן",
+"Encrypted service", "שירות מוצפן",
+"Environment", "סביבה",
+"Environment (pipe)", "סביבה (צינור)",
+"Episode", "פרק",
+"Episode %d", "פרק %d",
+"Errors", "שגיאות",
+"Every day", "כל יום",
+"FAIL", "נכשל",
+"Failed DVR", "הקלטות כושלות",
+"Fantasy", "פנטזיה",
+"Filename", "שם קובץ",
+"Film", "סרט",
+"Fitness and health", "כושר ובריאות",
+"Folk", "עממי",
+"Football", "כדורגל",
+"Fork and run as daemon", "הרץ כתהליך רקע",
+"Frequency", "תדירות",
+"Frequency (Hz)", "תדירות (Hz)",
+"Frequency (MHz)", "תדירות (MHz)",
+"Frequency (kHz)", "תדירות (kHz)",
+"Fri", "שישי",
+"Full DiseqC", "DiseqC מלא",
+"Full-text", "טקסט מלא",
+"Game show", "שעשועון",
+"Gardening", "גינון",
+"General", "כללי",
+"Generic", "כללי",
+"Hierarchy", "היררכיה",
+"High", "גבוה",
+"Horror", "אימה",
+"Hostname/IP", "שם מארח/IP",
+"ID", "מזהה",
+"IDLE", "סרק",
+"Icon", "סמל",
+"Icon (full URL)", "סמל (כתובת מלאה)",
+"Icon URL", "כתובת סמל",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "אם לא קיים חשבון משתמש צור אחד\nללא שם משתמש וללא סיסמה. השתמש בתבונה\nכיוון שכל אחד בעולם יקבל גישה \nלהתקנה של Tvheadend  עד שתיצור או תערוך\nאת הגדרות הגישה בממשק הניהול בדפדפן.",
+"If you'd like to support the project, please consider a donation.", "אם ברצונך לתמוך בפרויקט זה, אנא שקול לתרום",
+"Ignore invalid SSL certificate", "התעלם מתעודת SSL לא תקינה",
+"Immediately abort", "סגירה מיידית",
+"Important", "חשוב",
+"Index", "אינדקס",
+"Interface", "ממשק",
+"Internal", "פנימי",
+"Interview", "ראיון",
+"Invalid", "לא תקין",
+"Jazz", "ג'אז",
+"Language", "שפה",
+"Languages", "שפות",
+"Last updated from", "עדכון אחרון מ:",
+"Literature", "ספרות",
+"Location", "מיקום",
+"Log", "יומן",
+"Login/Logout", "התחבר/התנתק",
+"Low", "נמוך",
+"Magazines", "מגזינים",
+"Manufacturer", "יצרן",
+"Manufacturer URL", "כתובת יצרן",
+"Matroska (mkv)/built-in", "Matroska (mkv)/מובנה",
+"Medicine", "רפואה",
+"Mode", "מצב",
+"Modulation", "מודולציה",
+"Mon", "שני",
+"Mono", "מונו",
+"Motor sport", "ספורט מוטורי",
+"Motoring", "מוטורי",
+"Movie", "סרט",
+"Music", "מוזיקה",
+"Musical", "מוזיקלי",
+"Mux", "מוקס",
+"Mux not enabled", "מוקס מנוטרל",
+"NONE", "ללא",
+"Name", "שם",
+"Nature", "טבע",
+"Network", "רשת",
+"Networks", "רשתות",
+"News", "חדשות",
+"No days", "אין ימים",
+"No free adapter", "אין מתאם פנוי",
+"No input detected", "לא זוהה מתאם",
+"No source available", "אין מקור זמין",
+"None", "ללא",
+"Normal", "רגיל",
+"Not set", "לא מוגדר",
+"Number", "מספר",
+"OK", "אישור",
+"Off", "כבוי",
+"Older OSCam", "OSCam ישן",
+"On", "פעיל",
+"Only EIT", "EIT בלבד",
+"Only UK Freesat", "UK Freesat בלבד",
+"Only UK Freeview", "UK Freeview בלבד",
+"Opera", "אופרה",
+"Owner", "בעלים",
+"Password", "סיסמה",
+"Password2", "סיסמה 2",
+"Passwords", "סיסמאות",
+"Path", "נתיב",
+"Pilot", "פיילוט",
+"Pop", "פםפ",
+"Port", "פורט",
+"Position", "מיקום",
+"Priority", "קדימות",
+"Priority (-10..10)", "עדיפות (10...10-)",
+"Private", "פרטי",
+"Provider", "ספק",
+"Puppets", "בובות",
+"Quiz", "חידון",
+"Record all", "הקלט הכל",
+"Religion", "דת",
+"Religious", "דתי",
+"Reports", "דוחות",
+"Rescan", "סרוק מחדש",
+"Resolution (height)", "רזולוציה (גובה)",
+"Rock", "רוק",
+"Romance", "רומנטי",
+"Running", "רץ",
+"Sat", "שבת",
+"Scheduled for recording", "תזמון הקלטה",
+"Science", "מדע",
+"Science fiction", "מדע בדיוני",
+"Season", "עונה",
+"Season %d", "עונה %d",
+"Server", "שרת",
+"Service", "שירות",
+"Services", "שירותים",
+"Settings", "הגדרות",
+"Signal quality too poor", "איכות אות גרועה",
+"Soap", "אופרת סבון",
+"Soccer", "כדורגל",
+"Social", "חברתי",
+"Source", "מקור",
+"Source deleted", "מקור נמחק",
+"Specify alternative htsp port", "הגדר פורט htsp חלופי",
+"Specify alternative http port", "הגדר פורט http חלופי",
+"Specify extra htsp port", "הגדר פורט htsp נוסף",
+"Sports", "ספורט",
+"Sports magazines", "מגזין ספורט",
+"Standard", "רגיל",
+"Start", "התחלה",
+"Status", "מצב",
+"Stereo", "סטיראו",
+"Stop", "עצירה",
+"Storage space", "שטח אחסון",
+"Streaming", "מזרים",
+"Subtitle", "כתובית",
+"Sun", "ראשון",
+"Sync", "סנכרון",
+"System", "מערכת",
+"Tags", "תגיות",
+"Technology", "טכנולוגיה",
+"Tennis", "טניס",
+"Testing options", "בודק אפשרויות",
+"The name of the profile.", "שם הפרופיל",
+"This tuner", "מקלט זה",
+"Thriller", "מתח",
+"Thu", "חמישי",
+"Title", "כותרת",
+"Tue", "שלישי",
+"Tuner", "מקלט",
+"Tuner configuration", "הגדרות מקלט",
+"Tuner configuration.", "הגדרות מקלט.",
+"Tuning failed", "כוונון נכשל",
+"Tvheadend server name", "שם שרת Tvheadend",
+"Type", "סוג",
+"URL", "כתובת",
+"Unable to open file", "לא יכול לפתוח קובץ",
+"Unknown", "לא ידוע",
+"Unknown file", "קובץ לא ידוע",
+"Unlimited size", "גודל לא מוגבל",
+"Unlimited time", "זמן לא מוגבל",
+"Update channel icon", "עדכן סמל ערוץ",
+"Update channel name", "עדכן שם ערוץ",
+"Update channel number", "עדכן מספר ערוץ",
+"Update time", "עדכן זמן",
+"User does not have access", "למשתמש אין גישה",
+"User does not have access to channel", "למשתמש אין גישה לערוץ",
+"User language", "שפת משתמש",
+"Username", "שם משתמש",
+"Verify the SSL certificate.", "ודא תעודת SSL",
+"Video", "וידאו",
+"Video codec", "מקודד וידאו",
+"Waiting for program start", "ממתין לתחילת התוכנית",
+"War", "מלחמה",
+"Water sport", "ספורט מים",
+"Weather report", "תחזית מזג אוויר",
+"Wed", "רביעי",
+"Western", "מערבון",
+"hrs", "שע'",
+"min", "דקה",
+"mins", "דק'",
+NULL, NULL
+};
+
+static const char *tvh_locale_13[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nZa više informacija posjetite Tvheadend web stranicu:\nhttps://tvheadend.org\n",
+"# Channels", "# Programi",
+"# Muxes", "# Multipleksi",
+"# Services", "# Usluge",
+"AC-3 = descriptor 6", "AC-3 = opisivač 6",
+"ACTIVE", "AKTIVNO",
+"ANY", "SVEJEDNO",
+"AUTO", "AUTOMATSKI",
+"Aborted by user", "Prekinuo korisnik",
+"Access", "Pristup",
+"Action", "Radnja",
+"Adapter in use by another subscription", "Adapter koristi druga pretplata",
+"Add file and line numbers to debug", "Dodaj datoteku i broj redka za otklanjanje grešaka",
+"Add the thread ID to debug", "Dodaj ID stavku za otklanjanje grešaka",
+"Admin", "Administrator",
+"Adult movie", "Film za odrasle",
+"Adventure", "Pustolovina",
+"Advertisement / Shopping", "Oglašavanje / Kupovina",
+"All (Streaming plus DVR)", "Sve (Strujanje plus DVR)",
+"All DVR (rw)", "Svi DVR (rw)",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Svi postupci su korišteni za podršku infrastrukture poslužitelja i kupovinu opreme za testiranje.",
+"Alternate PID path", "Zamjenska PID putanja",
+"Alternate configuration path", "Zamjenska putanja podešavanja",
+"Altitude (meters)", "Nadmorska visina (m)",
+"Animals", "Životinje",
+"Any", "Svejedno",
+"Arts", "Umjetnost",
+"Athletics", "Atletika",
+"Auto", "Automatski",
+"Ballet", "Balet",
+"Bandwidth", "Frekvencijska širina",
+"Based on software from", "Temeljeneo na softveru s",
+"Bouquet", "Buket",
+"Bouquet (auto)", "Buket (automatski)",
+"Broadcast", "Emitiranje",
+"Broadcasting", "Emitiranje",
+"Build", "Izgrađeno",
+"Cartoons", "Crtići",
+"Channel", "Program",
+"Channel icon path (see Help)", "Putanja ikone programa (pogledajte Pomoć)",
+"Channel number", "Broj programa",
+"Channel numbers from", "Broj programa iz",
+"Channels", "Programi",
+"Cinema", "Kino",
+"Class", "Klasika",
+"Classical", "Klasično",
+"Classical music", "Klasična glazba",
+"Clean effects", "Jasni efekti",
+"Comedy", "Komedija",
+"Comment", "Komentar",
+"Commercial break", "Reklame",
+"Completed OK", "Završeno U REDU",
+"Configuration", "Podešavanje",
+"Configuration ID", "ID podešavanja",
+"Configuration version", "Inačica podešavanja",
+"Constellation", "Konstelacija",
+"Container", "Spremnik",
+"Content character set", "Vrsta znakova",
+"Contest", "Natjecanje",
+"Cookie expiration (days)", "Istek kolačića (u danima)",
+"Cooking", "Kuhanje",
+"Copy codec type", "Kopiraj vrstu kôdeka",
+"Copy layout", "Izlaz kopiranja",
+"Create bouquet", "Stvori buket",
+"Created", "Stvoreno",
+"Creator", "Stvorio",
+"Cron multi-line", "Cron višestruki redak",
+"Culture (without music)", "Kultura (bez glazbe)",
+"Current affairs", "Aktualni događaji",
+"DBus - use the session message bus instead of the system one", "DBus - koristi sabirnicu poruka sesije umjesto sustava",
+"DVB scan files path", "DVB putanje datoteka pretraživanja",
+"DVB-S 4-port", "DVB-S 4-ulaz",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, eksperimentalno)",
+"Dance", "Ples",
+"Days of Week", "Dani u tjednu",
+"Debate", "Rasprava",
+"Debug libav log", "libav zapis otklanjanja grešaka",
+"Debug log path", "Putanja zapisa otklanjanja grešaka",
+"Debug subsystems", "Otklanjanje grešaka podsustava",
+"Debug to syslog", "Otklanjaj greške u podsustav",
+"Debug trace (low-level)", "Praćenje otklanjanja grešaka (niža-razina)",
+"Debugging", "Otklanjanje greške",
+"Default", "Zadani",
+"Default language(s)", "Zadani jezici",
+"Descrambler buffer (TS packets)", "Međuspremnik dekôdiranja (TS paketi)",
+"Description", "Opis",
+"Detective", "Dektetivski",
+"Device ID", "ID uređaja",
+"Directory", "Direktorij",
+"Disable", "Onemogući",
+"Disable DVB bouquets", "Onemogući DVB bukete",
+"Disable SAT>IP client", "Onemogući SAT>IP klijenta",
+"Disable all access control checks", "Onemogućei sve provjere upravljanja pristupom",
+"Disable device/firmware-specific workarounds", "Onemogući određeno obilaženje uređaja/frimvera",
+"Disable syslog (all messages)", "Onemogući zapis sustava (sve poruke)",
+"Discussion", "Rasprava",
+"DiseqC repeats", "DiseqC ponavljanja",
+"DiseqC switch", "DiseqC preklopnik",
+"Do not use", "Ne koristi",
+"Documentary", "Dokumentarac",
+"Don't backup configuration tree at upgrade", "Sigurnosno ne kopiraj stablo podešavanja pri nadogradnji",
+"Don't keep", "Ne čuvaj",
+"EIT - skip TSID check", "EIT - preskoči TSID provjeru",
+"EPG grabber channel", "EPG sakupljač programa",
+"EPG scan timeout in seconds (30-7200)", "Trajanje EPG pretraživanja u sekundama (30-7200)",
+"Economics", "Ekonomija",
+"Education", "Obrazovanje",
+"Educational", "Obrazovno",
+"Enable (auto)", "Omogući (automatski)",
+"Enable DBus", "Omogući DBus",
+"Enable NTP driver", "Omogući NTP upravljački program",
+"Enable debug on stderr", "Omogući otklanjanje greške na stderr",
+"Enable debug subsystems", "Omogući otklanjanje greške podsustava",
+"Enable debug to file", "Omogući otklanjanje greške u datoteku",
+"Enable debug to syslog", "Omogući otklanjanje greške u zapis sustava",
+"Enable trace subsystems", "Omogući praćenje podsustava",
+"Enabled", "Omogućeno",
+"Encrypted", "Šifrirano",
+"Encrypted service", "Šifrirane usluge",
+"Environment", "Okoliš",
+"Environment (pipe)", "Okoliš (slivnik)",
+"Episode", "Epizoda",
+"Episode %d", "Epizoda %d",
+"Errors", "Greške",
+"Every day", "Svaki dan",
+"Expeditions", "Ekspedicije",
+"Experimental film", "Eksperimentalan film",
+"External URL", "Vanjski URL",
+"FAIL", "NEUSPJELO",
+"Factual topics", "Stvarne teme",
+"Failed DVR", "Neuspjeli DVR",
+"Fantasy", "Fantazija",
+"Fast input switch", "Brzo prebacivanje ulaza",
+"Filename", "Naziv datoteke",
+"Fine arts", "Likovne umjetnosti",
+"Fitness and health", "Fitnes i zdravlje",
+"Folkloric", "Folklor",
+"Football", "Nogomet",
+"Force (auto)", "Prisili (automatski)",
+"Force CA ID (e.g. 0x2600)", "Prisili CA ID (npr. 0x2600)",
+"Force pilot for DVB-S2", "Prisili pilota za DVB-S2",
+"Force teardown delay", "Prisli odgodu rastavljanja",
+"Foreign countries", "Strane zemlje",
+"Fork and run as daemon", "Račvaj i pokreni kao pozadinski program (daemon)",
+"Frequency", "Frekvencija",
+"Frequency (Hz)", "Frekvencija (Hz)",
+"Frequency (MHz)", "Frekvencija (MHz)",
+"Frequency (kHz)", "Frekvencija (kHz)",
+"Fri", "Pet",
+"Full DiseqC", "Puni DiseqC",
+"Full-text", "Cijeli tekst",
+"Further education", "Stručno usavršavanje",
+"Game show", "Kviz",
+"Gardening", "Vrtlarstvo",
+"General", "Općenito",
+"Generic", "Osnovno",
+"HTSP Default Stream Settings", "HTSP zadane postavke strujanja",
+"Handicraft", "Radinosti",
+"Hearing impaired", "Osobe oštećenog sluha",
+"Hierarchy", "Hijerarhija",
+"High", "Visok",
+"Historical movie", "Povijesni film",
+"Horror", "Horor",
+"Hostname/IP", "Naziv računala/IP",
+"IDLE", "MIROVANJE",
+"IPTV Multiplex", "IPTV multipleks",
+"ISI (Stream ID)", "ISI (ID strujanja)",
+"Icon", "Ikona",
+"Icon (full URL)", "Ikona (puni URL)",
+"Icon URL", "URL ikone",
+"Icon base URL", "Ikona onovni URL",
+"Icon has title", "Ikona ima naziv",
+"Icons from", "Ikone s",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Ako nema korisničkih računa, tada stvorite jedan\nbez korisničkog imena i lozinke. Ovo koristite oprezno\njer će omogućiti administrativan pristup vašoj \nTvheadend instalaciji sve dok ne stvorite ili uredite\npravila pristupa iz Tvheadend web sučelja.",
+"If you'd like to support the project, please consider a donation.", "Ako želite podržati projekt, razmislite o donaciji.",
+"Ignore EPG (EIT)", "Zanemari EPG (EIT)",
+"Ignore descriptor 5", "Zanemari opisivač 5",
+"Ignore invalid SSL certificate", "Zanemari neispravne SSL vjerodajnice",
+"Immediately abort", "Odmah zaustavi",
+"Important", "Značajno",
+"Index", "Raspored",
+"Information area", "Informativno područje",
+"Informational", "Informativni",
+"Interface", "Sučelje",
+"Internal", "Unutrašnji",
+"Interview", "Intervju",
+"Invalid", "Neispravno",
+"Invalid adapter number '%s'\n", "Neispravan broj adaptera '%s'\n",
+"Invalid target", "Neispravna meta",
+"Keep", "Zadrži",
+"Kill signal (pipe)", "Ubij signal (cjevovod)",
+"Kill timeout (pipe/secs)", "Trajanje ubijanja (cjevovod/sek)",
+"Language", "Jezik",
+"Languages", "Jezici",
+"Last updated from", "Posljednje ažuriranje iz",
+"Leisure hobbies", "Hobiji",
+"Listen on IPv6", "Osluškuj na IPv6",
+"Literature", "Književnost",
+"Local bind IP address", "Lokalno povezivanje IP adresa",
+"Location", "Lokacija",
+"Log", "Zapis",
+"Login/Logout", "Prijava/Odjava",
+"Magazines", "Magazini",
+"Manufacturer", "Proizvođač",
+"Manufacturer URL", "URL proizvođača",
+"Matroska (mkv)/built-in", "Matroska (mkv)/ugrađeno",
+"Maximum PIDs", "Najviše PID-ova",
+"Maximum length of PIDs", "Najveće trajanje PID-ova",
+"Maximum timeout (seconds)", "Najveće razdoblje čekanja (sekunde)",
+"Medicine", "Medicina",
+"Missing In PAT/SDT", "Nedostaje u PAT/SDT",
+"Mode", "Način",
+"Modulation", "Modulacija",
+"Module", "Modul",
+"Mon", "Pon",
+"More verbose libav log", "Opširniji libav zapis",
+"Motor sport", "Motorni sport",
+"Motoring", "Nadgledanje",
+"Movie", "Film",
+"Music", "Glazba",
+"Musical", "Mjuzikl",
+"Mux", "Multipleks",
+"Mux UUID", "Multipleks UUID",
+"Mux not enabled", "Multipleks nije omogućen",
+"NONE", "NIJEDAN",
+"Name", "Naziv",
+"Natural sciences", "Prirodne znanosti",
+"Nature", "Priroda",
+"Network", "Mreža",
+"Network A", "Mreža A",
+"Network B", "Mreža B",
+"Network ID (limit scanning)", "ID mreže (ograniči pretraživanje)",
+"Network UUID", "UUID mreže",
+"Network prefix", "Predbroj mreže",
+"Networks", "Mreže",
+"News", "Vijesti",
+"News magazine", "Dnevnik",
+"Next tune delay in ms (0-2000)", "Odgoda do sljedećeg podešavanja u ms (0-2000)",
+"No PIN", "Bez PINA",
+"No access", "Bez pristupa",
+"No adapters specified!\n", "Nema određenog adapters!\n",
+"No days", "Nema dana",
+"No descrambler", "Nema dekôdiranja",
+"No free adapter", "Nema slobodnog adaptera",
+"No input detected", "Nema otkrivenih ulaza",
+"No service assigned to channel", "Nema pridruženih usluga programu",
+"No service enabled", "Nema omogućenih usluga",
+"No source available", "Nema dostupnog izvora",
+"None", "Nijedan",
+"Normal", "Normalan",
+"Not set", "Nije postavljeno",
+"Not set (none or channel configuration)", "Nije postavljeno (nepoznato podešavanje programa)",
+"Not set (use channel or DVR configuration)", "Nije postavljeno (koristi DVR podešavanje ili podešavanje programa)",
+"Number", "Broj",
+"Number of tsfile tuners", "Broj ts-datoteka prijemnika",
+"OK", "U REDU",
+"OK (partial)", "U redu (djelomično)",
+"OSCam (rev >= 9095)", "OSCam (izdanje >= 9095)",
+"OSCam TCP (rev >= 9574)", "OSCam TCP (izdanje >= 9574)",
+"OSCam net protocol (rev >= 10389)", "OSCam mrežni protokol (izdanje >= 10389)",
+"OSCam pc-nodmx (rev >= 9756)", "OSCam pc-nodmx (izdanje >= 9756)",
+"Off", "Isključeno",
+"Older OSCam", "Stariji OSCam",
+"On", "Uključeno",
+"Only Bulsatcom 39E", "Samo Bulsatcom 39E",
+"Only EIT", "Samo EIT",
+"Only OpenTV Sky Ausat", "Samo OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Samo OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Samo OpenTV Sky UK",
+"Only PSIP (ATSC)", "Samo PSIP (ATSC)",
+"Only UK Freesat", "Samo UK Freesat",
+"Only UK Freeview", "Samo UK Freeview",
+"Only Viasat Baltic", "Samo Viasat Baltic",
+"Output directory for tsdebug", "Izlazni direktorij za ts otklanjnje greške",
+"Over-the-air", "Iz signala",
+"Over-the-air Cron multi-line", "Iz signala Cron višestruki redak",
+"Over-the-air EPG", "EPG iz signala",
+"Owner", "Vlasnik",
+"PEND", "ČEKANJE",
+"PIDs 21 in setup", "PID 21 u postavkama",
+"PIDs in setup", "PID-ovi u postavkama",
+"Password", "Lozinka",
+"Password2", "Lozinka2",
+"Passwords", "Lozinke",
+"Path", "Putanja",
+"Performing arts", "Primjenjenja umjetnost",
+"Physiology", "Filozofija",
+"Polarization", "Polarizacija",
+"Political issues", "Politička pitanja",
+"Popular culture", "Popularna kultura",
+"Port", "Ulaz",
+"Position", "Položaj",
+"Preferred CA PID", "Preferirani CA PID",
+"Presentation", "Prezentacija",
+"Press", "Tisak",
+"Priority", "Prioritet",
+"Priority (-10..10)", "Prioritet (-10..10)",
+"Private", "Privatno",
+"Provider", "Pružatelj",
+"Provider ID", "ID pružatelja",
+"Psychology", "Psihologija",
+"Puppets", "Lutke",
+"Quiz", "Kviz",
+"RTSP/TCP (embedded data)", "RTSP/TCP (umetnuti podaci)",
+"Record all", "Snimi sve",
+"Reject", "Odbij",
+"Religion", "Religija",
+"Religious", "Religijski",
+"Remarkable people", "Neuobičajeni ljudi",
+"Remove HTTP arguments", "Ukloni HTTP argumente",
+"Rescan", "Ponovno pretraži",
+"Resolution (height)", "Razlučivost (visina)",
+"Romance", "Romantika",
+"Run as group", "Pokreni kao grupu",
+"Run as user", "Pokreni kao korisnika",
+"Running", "Pokrenuto",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP broj ulaza poslužitelja\n(zadano: -1 = onemogućeno, 0 = web podešavanje, standard ulaz je 554)",
+"Sat", "Sub",
+"Satconf", "Sat-podešavanje",
+"Scheduled for recording", "Zakazano za snimanje",
+"Science", "Znanost",
+"Science fiction", "Znanstvena fantastika",
+"Season", "Sezona",
+"Season %d", "Sezona %d",
+"Send full PLAY cmd", "Pošalji punu naredbu REPRODUKCIJE",
+"Serious", "Bitno",
+"Serious music", "Ozbiljna glazba",
+"Server", "Poslužitelj",
+"Server UUID", "UUID poslužitelja",
+"Service", "Usluga",
+"Service ID", "ID usluge",
+"Services", "Usluge",
+"Settings", "Postavke",
+"Show", "Emisija",
+"Show this page", "Prikaži ovu informaciju",
+"Show version information", "Prikaži informaciju inačice",
+"Signal quality too poor", "Kvaliteta usluge loša",
+"Skip TS packets (0-200)", "Preskoči TS pakete (0-200)",
+"Soap", "Sapunica",
+"Soccer", "Nogomet",
+"Social", "Socijalno",
+"Social advisory", "Socijalni savjeti",
+"Source", "Izvor",
+"Source deleted", "Izvor obrisan",
+"Source quality is bad", "Kvaliteta izvora je loša",
+"Source reconfigured", "Izvor je ponovno podešen",
+"Special events (Olympic Games, World Cup, etc.)", "Posebni događaji (Olimpijske igre, Svjetsko prvenstvo, itd.)",
+"Spiritual sciences", "Duhovne znanosti",
+"Sports", "Sportovi",
+"Sports magazines", "Sportske emisije",
+"Squash", "Skvoš",
+"Standard", "Standarno",
+"Start", "Pokreni",
+"Status", "Stanje",
+"Stop", "Zaustavi",
+"Storage space", "Prostor pohrane",
+"Streaming", "Strujanje",
+"Subscribe to a service permanently", "Pretplati se na uslugu trajno",
+"Subtitle", "Podnaslov",
+"Sun", "Ned",
+"Switch: %s", "Prebaci: %s",
+"Sync", "Uskladi",
+"Sync + Don't keep", "Uskladi + Ne zadrži",
+"System", "Sustav",
+"Tags", "Oznake",
+"Talk show", "Emisija uživo",
+"Team sports (excluding football)", "Ekipni sportovi (osim nogometa)",
+"Technology", "Tehnologija",
+"Tennis", "Tenis",
+"Testing options", "Mogućnost testiranja",
+"Thriller", "Triler",
+"Thu", "Čet",
+"Time", "Vrijeme",
+"Time missed", "Vrijeme propušteno",
+"Time recording%s%s", "Vrijeme snimanja%s%s",
+"Timeshift", "Premotavanje",
+"Title", "Naslov",
+"Toggle details", "Uključi pojedinosti",
+"Tourism / Travel", "Turizam / Putovanja",
+"Trace subsystems", "Prati podsustave",
+"Traditional arts", "Tradicionalana umjetnost",
+"Traditional music", "Tradicionalana glazba",
+"Tue", "Uto",
+"Type", "Vrsta",
+"Unknown", "Nepoznato",
+"Username", "Korisničko ime",
+"Variety show", "Posebna emisija",
+"Waiting for stream", "Čekanje strujanja",
+"War", "Rat",
+"Water sport", "Vodeni sport",
+"Weather report", "Vremenska prognoza",
+"Wed", "Sri",
+"Western", "Vesten",
+"hrs", "sata",
+"invalid option specified [%s]", "određena neispravna mogućnost [%s]",
+"mins", "minuta",
+NULL, NULL
+};
+
+static const char *tvh_locale_14[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nTovábbi információért kérjük látogasson el a Tvheadend honlapjára:\nhttps://tvheadend.org\n",
+"# Channels", "# Csatornák",
+"# Mapped channels", " #Hozzárendelt csatornák",
+"# Muxes", "# Multiplexek",
+"# Services", "# Szolgáltatások",
+"# Services seen", "#Talált szolgáltatások",
+"# tune repeats", "#DiseqC ismétlések száma",
+"(Default profile)", "(Alapértelmezett profil)",
+"1 day", "1 nap",
+"1 month", "1 hónap",
+"1 week", "1 hét",
+"1 year", "1 év",
+"2 months", "2 hónap",
+"2 weeks", "2 hét",
+"2 years", "2 év",
+"2-Port switch (universal LNB)", "2 portos Disecq kapcsoló (Univerzális LNB)",
+"3 days", "3 nap",
+"3 months", "3 hónap",
+"3 weeks", "3 hónap",
+"3 years", "3 év",
+"4-Port switch (universal LNB)", "4 portos Disecq kapcsoló (Univerzális LNB)",
+"5 days", "5 nap",
+"6 months", "6 hónap",
+"AC-3 detection", "AC-3 felismerés",
+"ACTIVE", "AKTÍV",
+"AES constant code word client", "AES - magasszintű titkosítási szabvány konstans kódszó kliens",
+"ATSC source ID", "ATSC forrás ID",
+"ATSC-C network", "ATSC-C hálózat",
+"ATSC-T network", "ATSC-T hálózat",
+"Aborted by user", "Felhasználó által megszakítva",
+"Accept remote subscription weight", "Távoli feliratkozás súlyának elfogadása",
+"Accept the remote subscription weight (from the SAT>IP client).", "Távoli feliratkozás súlyának elfogadása ( a SAT>IP klienstől)",
+"Access", "Hozzáférés",
+"Action", "Művelet",
+"Adapter in use by another subscription", "A kártya használatban van egy másik előfizetésnél",
+"Add file and line numbers to debug", "File- és sorszám hozzáadása nyomkövetéshez",
+"Add the thread ID to debug", "Folyamat ID hozzáadása a hibakereséshez",
+"Admin password", "Admin jelszó",
+"Admin username", "Admin felhasználónév",
+"Administrator login", "Adminisztrátori belépés",
+"Adult movie", "Felnőtt film",
+"Advanced", "Haladó",
+"Advanced (non-universal LNBs, rotors, etc.)", "Haladó (nem univerzális LNB-k, forgatók, stb.)",
+"Advanced streaming", "Haladó stream-elés",
+"Adventure", "Kaland",
+"Advertisement / Shopping", "Reklám / Vásárlás",
+"All (Streaming plus DVR)", "Minden (streaming és DVR)",
+"All DVR (rw)", "Minden DVR (rw)",
+"All lower-case", "Minden kisbetűs",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Minden adományt a szerver infrastruktúra támogatására és tesztberendezések vásárlására fordítunk.",
+"All: Record if different description", "Minden: Felvétel ha eltérő a leírás",
+"All: Record if different episode number", "Minden: Felvétel ha különbözik az epizód száma",
+"All: Record if different subtitle", "Minden: Felvétel, ha különbözik a feliratnyelv",
+"All: Record once per day", "Minden: Felvétel naponta egyszer",
+"Allow to show the quick tips for the form fields.", "Gyorstippek megjelenítése a szövegmezőknél.",
+"Allow/disallow HTSP protocol streaming, e.g Kodi (via pvr.hts) or Movian.", "HTSP protokoll stream-elés engedélyezése/tiltása - pl. Kodi (a pvr.hts pluginnel) vagy Movian számára",
+"Allow/disallow HTTP streaming.", "HTTP stream-elés engedélyezése/tiltása",
+"Allow/disallow access to the 'Configuration' tab.", "A 'Beállítások' fül elérhetőségének engedélyezése/tiltása.",
+"Allowed network", "Lehetséges hálózat",
+"Alternate PID path", "Egyéb PID útvonal",
+"Alternate configuration path", "Egyéb beállítási útvonal",
+"Altitude (meters)", "Tengerszinttől mért magasság (m)",
+"Animals", "Állat",
+"Any", "Bármi",
+"Arts", "Művészetek",
+"Athletics", "Atlétika",
+"Audio bitrate (kb/s) (0=auto)", "Audió bitráta (kb/s) (0=Auto)",
+"Audio codec", "Audio kódec",
+"Audio stream filter", "Audió stream szűrő",
+"Auto check disabled", "Automatikus ellenőrzés kikapcsolva",
+"Auto check enabled", "Automatikus ellenőrzés bekapcsolva",
+"Auto record", "Automatikus felvétel",
+"Auto record caption", "Automatikus felvétel felirat",
+"Auto recording%s%s", "Automatikus felvétel%s%s",
+"Auto time record", "Automatikus időzített felvétel",
+"Auto-Map to channels", "Automatikus csatorna-hozzárendelés",
+"Automatic checking", "Automatikus ellenőrzés",
+"Automatically map EPG source", "Automatikusan  EPG forrás hozzárendelése",
+"Automatically name from network", "Automatikus névadás a hálozatból",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Automatikusan frissítse a csatornák ikonjait az engedélyezett EPG szolgáltatók által küldött információk alapján. Megjegyzés: ez nem várt változásokat okozhat a már definiált ikonok esetében.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Automatikusan frissítse a csatornák nevét az engedélyezett EPG szolgáltatók által küldött információk alapján. Megjegyzés: ez nem várt változásokat okozhat a már definiált csatornanevek esetében.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Automatikusan frissítse a csatornák sorszámát az engedélyezett EPG szolgáltatók által küldött információk alapján. Megjegyzés: ez nem várt változásokat okozhat a már definiált sorszámok esetében.",
+"Autorec maximum count (0=unlimited)", "Automata rögzítés maximális száma (0 - korlátlan)",
+"Autorec maximum schedules limit (0=unlimited)", "Automata rögzítés ütemezésének maximális száma (0 - korlátlan)",
+"Bad", "Rossz",
+"Ballet", "Balett",
+"Bandwidth", "Sávszélesség",
+"Based on software from", "Az innen származó szoftver alapján",
+"Basic", "Alap",
+"Bind to specific local IP address.", "Helyi IP-címhez rendelés.",
+"Bouquet", "Csokor",
+"Bouquet (auto)", "Csokor (auto)",
+"Brand", "Márka",
+"Broadcast", "Sugárzás",
+"Broadcasting", "Sugárzás",
+"CA client %i", "CA-kliens %i",
+"CA identification", "CA-azonosítás",
+"CA provider", "CA-szolgáltató",
+"CA stream filter", "CA stream szűrő",
+"CAPMT interval (ms)", "CAPMT intervallum (ms)",
+"CAPMT query interval (ms)", "CAPMT lekérdezési intervallum (ms)",
+"CRID authority", "CRID engedély",
+"Cache scheme", "Gyorsítótár vázlat",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket file-név / IP-cím (TCP mód)",
+"Cartoons", "Rajzfilmek",
+"Channel", "Csatorna",
+"Channel icon", "Csatorna ikon",
+"Channel icon path (see Help)", "Csatorna ikonok útvonala (ld. Súgó)",
+"Channel name", "Csatorna-név",
+"Channel number", "Csatorna szám",
+"Channel number offset", "Csatorna szám offszet",
+"Channel numbers from", "Csatorna számozás kezdőérték",
+"Channel tag", "Csatorna-cimke",
+"Channel tag reference", "Csatorna-cimke referencia ",
+"Channel tags", "Csatorna-cimkék",
+"Channels", "Csatornák",
+"Character set", "Karakterkészlet",
+"Check availability", "Elérhetőség ellenőrzése",
+"Children's / Youth programs", "Gyermek / Ifjúsági műsorok",
+"Cinema", "Mozi",
+"Class", "Osztály",
+"Classical", "Klasszikus",
+"Classical music", "Klasszikus zene",
+"Clean effects", "Tiszta effektusok",
+"Client name", "Kliens név",
+"Clone scheduled entry on error", "Hiba esetén klónozza a bejegyzést",
+"Code word client (newcamd)", "Kódszó kliens (newcamd)",
+"Comedy", "Vígjáték",
+"Command delay time (ms) (10-200)", "Parancs késleltetési idő (ms) (10-200)",
+"Command time (ms) (10-100)", "Parancs idő (ms) (10-100)",
+"Comment", "Megjegyzés",
+"Commercial break", "Reklámszünet",
+"Committed", "Jóváhagyott",
+"Completed OK", "Befejezve OK",
+"Conditional access client", "Feltételes hozzáférésű kliens",
+"Configuration", "Beállítás",
+"Configuration ID", "Beállítás ID",
+"Configuration name", "Konfiguráció neve",
+"Configuration version", "Konfiguráció verziója",
+"Connection limit type", "Csatlakozás korlátozás típusa",
+"Constellation", "Csillagkép",
+"Container", "Tároló",
+"Content character set", "Tartalom betűtípusa",
+"Content reference identifier authority.", "Tartalom referencia azonosító hatóság.",
+"Content type", "Tartalom típusa",
+"Contest", "Verseny",
+"Continue even if descrambling fails", "Folytassa még akkor is, ha a dekódólás sikertelen",
+"Cookie expiration (days)", "Sütik lejárata (nap)",
+"Cooking", "Főző-műsor",
+"Copy codec type", "Kodektípus másolása",
+"Copy layout", "Másolat kinézete",
+"Create bouquet", "Csoport létrehozása",
+"Create network name tags", "Hálózati név tag-ek létrehozása",
+"Create provider name tags", "Szolgáltatói név tag-ek létrehozása",
+"Create type based tags", "Típus alapú tag-ek létrehozása",
+"Created", "Létrehozott",
+"Creator", "Szerző",
+"Cron multi-line", "Cron több-soros",
+"Culture (without music)", "Kultúra (kivéve zene)",
+"Current RTSP port.", "Jelenlegi RTSP port.",
+"Current affairs", "Jelenlegi afférok",
+"Current tuner configuration.", "Jelenlegi tuner beállítások.",
+"Custom HTTP headers", "Egyedi HTTP fejléc",
+"DBus - use the session message bus instead of the system one", "DBus - a jelenlegi üzenet használata a rendszer helyett",
+"DES constant code word client", "DES - adat titkosítási szabvány konstans kódszó kliens",
+"DES key", "DES kulcs",
+"DSCP/TOS for streaming", "DSCP/TOS a streaming-hez",
+"DVB scan files", "DVB scan file-ok",
+"DVB scan files path", "DVB scan file-ok elérési útvonala",
+"DVB-C network", "DVB-C hálózat",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, kísérleti)",
+"DVB-S advanced", "Haladó DVB-S",
+"DVB-S network", "DVB-S hálózat",
+"DVB-S satellite configuration", "DVB-S műhold konfiguráció",
+"DVB-S simple", "Egyszerű DVB-S",
+"DVB-S tone burst", "DVB-S Toneburst",
+"DVB-T network", "DVB-T hálózat",
+"DVR Auto-record entry", "Automatikus DVR felvétel bejegyzés",
+"DVR behavior", "DVR működés",
+"DVR configuration", "DVR beállítások",
+"DVR configuration profile", "DVR beállítási profil",
+"DVR configuration profiles", "DVR beállítási profilok",
+"DVR file retention period", "DVR file tárolás",
+"DVR log retention", "DVR log tárolása",
+"DVR log retention period", "DVR log tárolási periódus",
+"DVR override: high", "DVR felülbírálása: magas",
+"DVR override: important", "DVR felülbírálása: fontos",
+"DVR override: low", "DVR felülbírálása: alacsony",
+"DVR override: normal", "DVR felülbírálása: normális",
+"DVR override: unimportant", "DVR felülbírálása: nem fontos",
+"DVR time record entry", "DVR időzített felvétel bejegyzés",
+"Dance", "Tánc",
+"Data errors", "Adathibák",
+"Days of Week", "Hét napjai",
+"Days of week", "Hét napjai",
+"Debate", "Vitaműsor",
+"Debug libav log", "Részletesebb libav naplózás",
+"Debug log path", "Debug napló elérési útvonal",
+"Debug options", "Debug opciók",
+"Debug subsystems", "Debug alrendszerek",
+"Debug to syslog", "Debug naplózás a syslog-ba",
+"Debug trace (low-level)", "Debug trace (alacsony-szintű)",
+"Debugging", "Nyomkövetés",
+"Default", "Alapértelmezett",
+"Default language(s)", "Alapértelmezett nyelv(ek)",
+"Default language.", "Alapértelmezett nyelv",
+"Default priority", "Alapértelmezett prioritás",
+"Default user interface level.", "Alapértelmezett felhasználói szint",
+"Delivery system", "Szállítási rendszer",
+"Demux path", "Demux elérési útvonal",
+"Descramble services (limit per mux)", "Szolgáltatások dekodolása (mux szerinti korlátozás)",
+"Descrambler buffer (TS packets)", "Dekódolő puffer (TS csomagok)",
+"Description", "Leírás",
+"Detective", "Detektív",
+"Device ID", "Eszköz ID",
+"Device model", "Eszköz típus",
+"Device path", "Eszköz elérési útvonal",
+"Differentiated Services Code Point / Type of Service: Set the service class Tvheadend sends with each packet. Depending on the option selected this tells your router the prority in which to give packets sent from Tvheadend, this option does not usually need changing. See https://en.wikipedia.org/wiki/Differentiated_services for more information. ", "Differentiated Services Code Point / Type of Service: a service class beállítása, amit a Tvheadend küld minden csomaggal. A választástól függően ez közli a routerrel, hogy milyen prioritással küldje tovább a Tvhheadend által továbbított csomagokat, ez a beállítás általában nem igényel változtatást. Lásd: https://en.wikipedia.org/wiki/Differentiated_services további információkért. ",
+"Directory", "Könyvtár",
+"Directory permissions (octal, e.g. 0775)", "Könyvtárengedélyek (oktális, pl. 0775)",
+"Disable", "Kikapcsol",
+"Disable DVB bouquets", "DVB csokrok kikapcsolása",
+"Disable SAT>IP client", "SAT>IP kliens letiltása",
+"Disable all access control checks", "Minden hozzáférési-elérés vizsgálatának kikapcsolása",
+"Disable debug on stderr", "Debug stderr interfészen kikapcsolása",
+"Disable device/firmware-specific workarounds", "Eszköz / firmware-specifikus megoldások kikapcsolása",
+"Disable syslog (all messages)", "Rendszernapló letiltása (minden üzenet)",
+"Disabled", "Kikapcsolt",
+"Discussion", "Beszélgetés",
+"DiseqC repeats", "DiseqC ismétlés",
+"DiseqC rotor", "DiseqC forgató",
+"DiseqC switch", "DiseqC kapcsoló",
+"Do not use", "Ne használd",
+"Documentary", "Dokumentum",
+"Don't backup configuration tree at upgrade", "Konfigurációs fa frissítésének mellőzése mentés esetén.",
+"Don't include the title in the filename.", "Ne szerepeljen a cím a fájlnévben",
+"Don't include title in filename", "Cím használatának mellőzése a fájlnévben",
+"Don't keep", "Ne tartsa meg",
+"Don't re-record", "Ne rögzítsen újra",
+"Don't re-record if recording fails.", "Ne ismételje meg a felvételt, ha első alkalommal sikertelen",
+"Don't re-schedule if recording fails.", "Ne időzítse újra, ha a felvétel nem sikerül",
+"Don't reschedule", "Ne ütemezze újra",
+"Drama", "Dráma",
+"Duplicate handling", "dupla bejegyzések kezelése",
+"EIT - skip TSID check", "EIT - TSID ellenőrzésének kihagyása",
+"EPG Language (priority order)", "EPG nyelv (prioritás sorrend)",
+"EPG grabber", "EPG letöltő",
+"EPG grabber channel", "EPG letöltő csatorna",
+"EPG grabber configuration", "EPG letöltő beállítása",
+"EPG name", "EPG név",
+"EPG scan", "EPG szkennelés",
+"EPG scan timeout in seconds (30-7200)", "EPG szkennelés időtúllépés másodpercekben (30-7200)",
+"EPG source", "EPG forrása",
+"EPG update window", "EPG frissítési ablak",
+"Economics", "Gazdaság",
+"Education", "Oktatás",
+"Educational", "Oktatási",
+"Elementary stream filter", "Alapvető stream szűrő",
+"Enable (auto)", "Engedélyez (automatikus)",
+"Enable DBus", "DBUS engedélyezése",
+"Enable NTP driver", "NTP meghajtó engedélyezése",
+"Enable coredumps for daemon", "Coredump-ok engedélyezése a daemon-hoz",
+"Enable debug on stderr", "Debug stderr interfészen  engedelyezése",
+"Enable debug subsystems", "Debug alrendszerek engedelyezése",
+"Enable debug to file", "Debug file-ba  engedelyezése",
+"Enable debug to syslog", "Debug syslog-ba  engedelyezése",
+"Enable if the SAT>IP box requests plts=on parameter in the SETUP RTSP command for DVB-S2 muxes.", "Engedélyezze, ha a SAT>IP box a plts=on paramétert kér a SETUP RTSP parancsban DVB-S2 mux esetén.",
+"Enable if the SAT>IP box requires pids=0 parameter in the SETUP RTSP command.", "Engedélyezze, ha a SAT>IP box a pids=0 paramétert kér a SETUP RTSP parancsban.",
+"Enable if the SAT>IP box requires pids=21 parameter in the SETUP RTSP command", "Engedélyezze, ha a SAT>IP box a pids=21 paramétert kér a SETUP RTSP parancsban.",
+"Enable if the SAT>IP box supports the addpids/delpids commands.", "Engedélyezze, ha a SAT>IP box támogatja az addpids/delpids parancsokat.",
+"Enable or disable RTSP/TCP (embedded data) support.", "Az RTSP/TCP (embedded data) támogatás engedélyezése vagy tiltása.",
+"Enable or disable fast input switching.", "A gyors bemeneti kapcsolás engedélyezése vagy tiltása.",
+"Enable or disable full mux mode.", "A teljes mux üzemmód engedélyezése vagy tiltása.",
+"Enable or disable ignoring of Event Information Table (EIT) data on this mux.", "Az esemény információs tábla (Event Information Table (EIT)) adatainak figyelmen kívül hagyásának engedélyezése vagy tiltása ezen a mux-on.",
+"Enable or disable this configuration.", "Jelenlegi konfiguráció engedélyezése vagy tiltása.",
+"Enable syslog", "Syslog engedélyezése",
+"Enable system time updates. This will only work if the user running Tvheadend has rights to update the system clock (normally only root).", "Rendszeridő frissítésének engedélyezése. Ez csak akkor működik, ha a Tvheadend-et futtató felhasználónak van jogosultsága a rendszeróra állításához. (Általában ez csak root jogokkal működik).",
+"Enable this filter.", "Szűrő engedélyezése",
+"Enable trace subsystems", "Trace alrendszerek engedelyezése",
+"Enable web UI debug (non-minified JS)", "Webes felületének debug-olásának engedélyezése (nem-minimalizált JS)",
+"Enable/disable LNA.", "LNA engedélyezése/tiltása.",
+"Enabled", "Engedélyezett",
+"Encrypted", "Kódolt",
+"Encrypted service", "Kódolt csatorna",
+"Enter external IP if behind Network address translation (NAT).", "Amennyiben hálózati címfordítást (NAT) használ, írja be a külső IP-címet.",
+"Entertainment programs for 10 to 16", "Szórakoztató programok 10-től 16-ig",
+"Entertainment programs for 6 to 14", "Szórakoztató programok 6-tól 14-ig",
+"Environment", "Környezet",
+"Environment (pipe)", "Környezet (pipe)",
+"Episode", "Epizód",
+"Episode %d", "Epizód %d",
+"Episode number/ID.", "Rész száma/ID.",
+"Error code", "Hibakód",
+"Errors", "Hibák",
+"Even key", "Páros kulcs",
+"Every day", "Minden nap",
+"Exclude channel tags", "Csatorna címkék mellőzése",
+"Expeditions", "Expedíciók",
+"Experimental film", "Kísérleti film",
+"Expert", "Haladó",
+"Exported tuners", "Exportált tunerek",
+"External", "Külső",
+"External EPG grabber", "Külső EPG letöltő",
+"External IP (NAT)", "Külső IP cím (NAT)",
+"External URL", "Külső URL",
+"Extra arguments", "Plussz paraméterek",
+"Extra start time", "Plussz kezdési idő",
+"Extra stop time", "Plussz leállítási időpont",
+"Extra warming up time (seconds)", "Plussz bemelegítési idő (másodperc)",
+"FAIL", "SIKERTELEN",
+"FEC high", "FEC magas",
+"FEC low", "FEC alacsony",
+"Factual topics", "Tényszerű témák",
+"Failed", "Sikertelen",
+"Failed DVR", "Sikertelen DVR",
+"Fast input switch", "Gyors bemenet váltás",
+"File missing", "Hiányzó fájl",
+"File not created", "A fájl nem lett létrehozva",
+"File permissions (octal, e.g. 0664)", "Fájl jogosultságok (oktális, pl. 0664)",
+"File size", "Fájlméret",
+"Filename", "Fájlnév",
+"Filename character set", "Fájlnév karakterkészlete",
+"Filename options", "Fájlnév tulajdonságai",
+"Fine arts", "Szépművészet",
+"Finished", "Befejezett",
+"Fitness and health", "Fitness és egészség",
+"Folk", "Népzene",
+"Folkloric", "Népi",
+"Football", "Labdarúgás",
+"Force (auto)", "Kényszerít (automatikus)",
+"Force CA ID (e.g. 0x2600)", " CA ID Kényszerítés (pl.. 0x2600)",
+"Force all network connections to this tuner to be made over the specified IP address, similar to the setting for the SAT>IP device itself. Setting this overrides the device-specific setting.", "Kényszerítse az összes hálózati kapcsolatot, amely ehhez a tunerhez csatlakozik, hogy ezen a IP-n keresztül jöjjön létre,  hasonlóan a  SAT> IP eszköz beállításához.Ez  a beállítás  felülírja az eszköz-specifikus beállításokat.",
+"Force old status", "Régi stilusú státusz lekérés kényszerítése",
+"Force pilot for DVB-S2", "Pilot mód kényszerítése  DVB-S2 -re",
+"Force priority", "Prioritás kényszerítése",
+"Force teardown delay", "Szétszerelés - teardown késleltetés",
+"Force the delay between RTSP TEARDOWN and RTSP SETUP command (value from 'Next tune delay in ms' is used). Some devices are not able to handle quick continuous tuning.", "Kényszerítse  a késést  az RTSP TEARDOWN és RTSP SETUP parancsoknál (értékét a next tune delay in ms beallításból kapja). Egyes készülékek nem képesek kezelni a gyors folytonos hangolást.",
+"Force the local UDP Port number here. The number should be even (RTP port). The next odd number (+1) will be used as the RTCP port.", "Kényszerítse az itt megadott lokális UDP-port számának használatát. A érték páros kell, hogy legyen (RTP port). A következő páratlan szám (+1) lesz használva mint  RTCP port.",
+"Force usage of entered CA ID on this service.", "A beírt CA ID kényszerített használata ennél a szolgáltatásnál.",
+"Foreign countries", "Külföldi országok",
+"Forever", "végtelen",
+"Fork and run as daemon", "Fork-ol és futtat mind daemon",
+"Format string", "Karakter formátum",
+"Found muxes", "Talált mux-ok",
+"Found services", "Talált szolgáltatások",
+"Free subscription weight", "Szabad feliratozások súlya",
+"Free-format text field. Enter whatever you like here.", "Szabad formátumú szöveges mező. Írjon be bármit ide.",
+"Frequency", "Frekvencia",
+"Frequency (Hz)", "Frekvencia (Hz)",
+"Frequency (MHz)", "Frekvencia (MHz)",
+"Frequency (in MHz).", "Frekvencia (MHz-ben).",
+"Frequency (kHz)", "Frekvencia (kHz)",
+"Fri", "Pé",
+"Friendly name", "Barátságos név",
+"Frontend number", "Fejegység száma",
+"Frontend path", "Fejegység  elérési útvonal",
+"Full DiseqC", "Teljes DiseqC",
+"Full mux RX mode supported", "Teljes MUX RX mód támogatás",
+"Full pathname specification", "Teljes elérési útvonal meghatározása",
+"Full-text", "Teljes szöveg",
+"Further education", "További oktatás",
+"GOTOX position", "GOTOX pozicíó",
+"GOTOX rotor", "GOTOX forgató",
+"Game show", "Vetélkedő",
+"Gardening", "Kertészkedés",
+"General", "Általános",
+"General configuration", "Általános beállítás",
+"Generic", "Általános",
+"Generic options", "Általános opciók",
+"Guard interval", "Figelési intervallum",
+"HD: high definition", "HD: Magas felbontású",
+"HDHomeRun DVB frontend", "HDHomeRun DVB fejegység",
+"HDHomeRun DVB-C frontend", "HDHomeRun DVB-C fejegység",
+"HDHomeRun DVB-T frontend", "HDHomeRun DVB-T fejegység",
+"HTSP Default Stream Settings", "HTSP Alapértelmezett Stream Beállítások",
+"HTSP stream profile", "HTSP stream profil",
+"HTSP streaming", "HTSP stream-elés",
+"HTTP CORS origin", "HTTP CORS kezdeti érték",
+"HTTP Cross-origin resource sharing origin. This option is usually set when Tvheadend is behind a proxy. Enter a domain (or IP) to allow cross-domain requests.", "HTTP Cross-origin resource sharing origin.  Ez az opció általában akkor használatos, amikor a Tvheadend  proxy mögött van. Adjon meg egy domainnevet (vagy IP címet), hogy a cross-domain kéréseket engedélyezze.",
+"Handicraft", "Kézművesség",
+"Hearing impaired", "Hallássérült",
+"Hierarchy", "Hierarchia",
+"High", "Magas",
+"High bitrate mode (CI+ CAMs only)", "Magas bitráta mód (CI+ CAM )",
+"Historical movie", "Történelmi film",
+"How frequently it will re-try fetching an image that has failed to be fetched.", "Milyen gyakran próbálja újra letölteni a képet, amelyet nem sikerült letöltenie.",
+"How frequently the upstream provider is checked for changes.", "Milyen gyakran ellenőrizze a feltöltő szolgáltatót változások miatt.",
+"IDLE", "üresjárat",
+"IP address", "IP-cím",
+"IP blocking", "IP blokkolás",
+"IPTV Multiplex", "IPTV-multiplex",
+"IPTV automatic network", "IPTV Automatikus hálózat",
+"IPTV input", "IPTV-bemenet",
+"IPTV network", "IPTV-hálózat",
+"Icon", "Ikon",
+"Icon (full URL)", "Ikon (teljes URL)",
+"Icon URL", "Ikon URL",
+"Icon base URL", "Ikon elérési URL ",
+"Icon has title", "Ikon címmel rendelkezik",
+"Icons from", "Ikonok forrása",
+"Idle", "üresjárat",
+"Idle scan", "Üresjáratú szkennelés-engedélyezése",
+"Idle scan muxes", "Üresjáratú MUX szkennelés-engedélyezése",
+"If both a picon and a channel-specific (e.g. channelname.jpg) icon are defined, use the picon.", "Ha mind a Picon, mind a csatorna-specifikus (pl. csatornanev.jpg) ikonok  definiáltak, a Picon-t használja.",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Abban az esetben ha nem létezik felhasználói fiók\nHozzon létre egy bejegyzést felhasználónév és jelszó nélkül\nhasználja elővigyázattal, ugyanis korlátlan hozzáférést biztosít egészen addig, míg nem hoz létre/modoítja a létező felhasználót a webes felületen",
+"If you'd like to support the project, please consider a donation.", "Ha támogatni szeretnéd a programot, fontold meg a támogatását.",
+"Ignore EPG (EIT)", "EPG figyelmen kívül hagyása (EIT)",
+"Ignore descriptor 5", "Hagyja figyelmen kívül az 5-ös leírót",
+"Ignore invalid SSL certificate", "Érvénytelen SSL tanusitvány figyelmen kívül hagyása",
+"Ignore invalid/unverifiable (expired, self-certified, etc.) certificates", "Hagyja figyelmen kívül  az érvénytelen / ellenőrizhetetlenek (lejárt, öntanúsított, stb) tanúsítványokat.",
+"Ignore provider's channel numbers", "Szolgáltatói csatorna számozás figyelmen kívül hagyása",
+"Image cache", "Képek gyorsítőtárazása",
+"Immediately abort", "Azonnali megszakítás",
+"Important", "Fontos",
+"Include channel name in filename", "Csatorna nevének használata a fájlnévben",
+"Include date in filename", "Dátum használata a fájlnévben",
+"Include episode in filename", "Epizód nevének használata a fájlnévben",
+"Include subtitle in filename", "Felirat használata a fájlnévben",
+"Include time in filename", "Idő használata a fájlnévben",
+"Information area", "Információs terület",
+"Informational", "Tájékoztató jellegű",
+"Initial scan", "Üresjáratú szkennelés-engedélyezése",
+"Input base", "Bemenet alapcíme",
+"Input buffer (bytes)", "Bemeneti puffer (bájtban)",
+"Input instance", "Bemeneti példány",
+"Input path", "Bemenet elérési útja",
+"Interface", "Felület",
+"Internal", "Belső",
+"Internal EPG grabber", "Belső EPG letöltő",
+"Internal grabber", "Belső letöltő",
+"Interview", "Interjú",
+"Invalid", "Érvénytelen",
+"Invalid adapter number '%s'\n", "Érvénytelen eszköz szám '%s'\n",
+"Invalid target", "Érvénytelen cél",
+"Keep", "Megtart",
+"Kill signal (pipe)", "Kill szignál (pipe)",
+"Kill timeout (pipe/secs)", "Kill szignál maximális időkorlát (pipe/másodperc)",
+"LNA (low noise amplifier)", "LNA (alacsony zajszintű erőstő)",
+"LNB type", "LNB-típus",
+"Language", "Nyelv",
+"Language 1", "1. nyelv",
+"Language 2", "2. nyelv",
+"Language 3", "3. nyelv",
+"Language settings", "Nyelvi beállítások",
+"Languages", "Nyelvek",
+"Last seen", "Utoljára látott",
+"Last updated from", "Legutoljára frissítve",
+"Leisure hobbies", "Szabadidő, hobbi",
+"Limit connections", "Kapcsolatok korlátozása",
+"Linked input", "Csatolt bemenet",
+"Linux DVB frontend", "Linux DVB felület",
+"Linux DVB-C frontend", "Linux DVB-C felület",
+"Linux DVB-S frontend", "Linux DVB-S felület",
+"Linux DVB-S slave frontend", "Linux DVB-S Slave felület",
+"Linux DVB-T frontend", "Linux DVB-T felület",
+"LinuxDVB adapter", "LinuxDVB eszköz",
+"LinuxDVB network", "LinuxDVB hálózat",
+"Listen / Connect port", "Kapcsolatvárási/csatlakozási port",
+"Listen on IPv6", "Szerver kapcsolatot vár IPv6 -on",
+"Literature", "Irodalom",
+"Local bind IP address", "Helyileg bekütődő IP-cím",
+"Local channel minor", "Helyi csatorna - alsó",
+"Local channel number", "Helyi csatornaszám",
+"Local discovery IP address", "IP-cím lokális felderítése ",
+"Location", "Helyszín",
+"Location details of the SAT>IP Server.", "A SAT>IP szerver helyzetének részletei.",
+"Lock preferred CA PID", "Preferált CA PID lock-olása",
+"Login/Logout", "Be/kijelentkezés",
+"Low", "Alacsony",
+"MPEG-TS Pass-thru", "MPEG-TS áteresztés",
+"MPEG-TS Pass-thru/built-in", "MPEG-TS áteresztés/beépített",
+"MPEG-TS input", "MPEG-TS bemenet",
+"MPEG-TS multiplex", "MPEG-TS Multiplex",
+"MPEG-TS network", "MPEG-TS hálózat",
+"MPEG-TS raw service", "MPEG-TS raw szolgáltatás",
+"MPEG-TS service", "MPEG-TS  szolgáltatás",
+"Magazines", "Magazinok",
+"Maintain free storage space in MiB", "Elérhető tárhely MIB-ben",
+"Maintain used storage space in MiB (0=disabled)", "Használt tárhely fenntartása  MB-ban (0=kikapcsolva)",
+"Maintained space", "Tárhely fenntartása",
+"Make subdirectories per channel", "Alkönyvtárak csatornánkénti létrehozása",
+"Make subdirectories per day", "Alkönyvtárak naponkénti létrehozása",
+"Make subdirectories per title", "Alkönyvtárak cím szerinti létrehozása",
+"Manufacturer", "Gyártó",
+"Manufacturer URL", "Gyártói URL",
+"Manufacturer's model number.", "Gyártói modell száma.",
+"Manufacturer's product description.", "Gyártói termékleírás.",
+"Manufacturer's product information page for the device.", "A gyártó termékinformációs oldala.",
+"Manufacturer's product name.", "Gyártói terméknév.",
+"Map all services", "Minden szolgáltatás hozzárendelése",
+"Map encrypted services", "Titkosított szolgáltatások összerendelése.",
+"Map radio channels", "Rádio-csatorna szolgáltatások hozzárendelése",
+"Map unnamed channels", "Névvel nem rendelkező csatornák hozzárendelése",
+"Map zero-numbered channels", "0-s sorszámmal rendelkező csatornák hozzárendelése",
+"Master tuner", "Fő tuner",
+"Matroska (mkv)/built-in", "Matroska (mkv)/beépített",
+"Matroska specific", "Matroska specifikus",
+"Maximal channel number", "Maximális csatorna szám",
+"Maximum # input streams", "Maximális számú bemeneti streamek",
+"Maximum PIDs", "Maximum PID",
+"Maximum RAM size (MB)", "Maximális RAM méret (MB)",
+"Maximum bandwidth (Kbps)", "Maximális sávszélesség (Kbps)",
+"Maximum count (0=default)", "Maximális szám (0=alapértelmezett)",
+"Maximum duration", "Maximális időtartam",
+"Maximum length in characters for the command setting PIDs to the SAT>IP box.", "Maximális karakterhossz a PID parancs beállításoknak a SAT> IP mezőben.",
+"Maximum length of PIDs", "PID-ek maximális hoszza",
+"Maximum period (mins)", "Maximális periódus (percben)",
+"Maximum schedules limit (0=default)", "Maximális betervezésének száma (0=alapértelmezett)",
+"Maximum size (MB)", "Maximális méret (MB)",
+"Maximum timeout (seconds)", "Maximális időkorlát (másodperben)",
+"Medicine", "Gyógyászat",
+"Melodrama", "Melodráma",
+"Merge same name", "Ugyanazon nevek összevonása",
+"Minimal channel number", "Minimális csatorna szám",
+"Minimum duration", "Minimális időtartam",
+"Minimum rotor time (seconds)", "Minimális forgató időtartam (másodperben)",
+"Missing In PAT/SDT", "Hiányzik a PAT/SDT -ben",
+"Mode", "Üzemmód",
+"Model description", "Üzemmód leírás",
+"Model name", "Modell név",
+"Model number", "Modell szám",
+"Modulation", "Moduláció",
+"Module", "Modul",
+"Module ID", "Modul ID",
+"Mon", "Hét",
+"More verbose libav log", "Részletesebb libav naplózás",
+"Motor rate (milliseconds/deg)", "Forgatási sebesség (milli/fok)",
+"Motor sport", "Motorsport",
+"Motoring", "Motor",
+"Movie", "Film",
+"Multiple lines of the cron time specification. The default cron triggers the Over-the-air grabber daily at 02:04 and 14:04. See Help on how to define your own.", "Többsoros cron az idő-meghatározáshoz. Az alapértelmezett cron kiváltja a Over-the-air  EPG gyüjtőt,  naponta 02:04 és 14:04 időpontokban . A súgóban több információt megtalál,  hogyan határozzon meg  sajátot.",
+"Multiple lines of the cron time specification. The default cron triggers the internal grabbers daily at 12:04 and 00:04. See Help on how to define your own.", "Többsoros cron idő meghatározásának. Az alapértelmezett cron kiváltja a Over-the-air EPG gyüjtőt, naponta 02:04 és 14:04 időpontokban . A súgóban több információt megtalál, hogyan határozzon meg a sajátot.",
+"Music", "Zene",
+"Mux handling", "Mux kezelés",
+"Mux name", "Mux neve",
+"Mux not enabled", "A MUX nem engedélyezett",
+"Mux schedule entry", "Mux ütem. bejegyzés",
+"NONE", "EGYIK SEM",
+"Name", "Név",
+"Names", "Nevek",
+"Natural sciences", "Természettudományok",
+"Nature", "Természet",
+"Network", "Hálózat",
+"Network ", "Hálózat",
+"Network A", "A hálózat",
+"Network B", "B hálózat",
+"Network ID (limit scanning)", "Hálózat ID (szkennelés korlátozás)",
+"Network UUID", "Hálózati UUID",
+"Network access", "Hálózati hozzáférés",
+"Network discovery", "Hálózati felderítés",
+"Network name", "Hálózat neve",
+"Network prefix", "Hálózati előtag",
+"Network settings", "Hálózati beállítások",
+"Network type", "Hálózat típusa",
+"Networks", "Hálózatok",
+"News", "Hírek",
+"News magazine", "Hírmagazin",
+"Next tune delay in ms (0-2000)", "Hangolási parancs késleltetési idő millisec.-ben (0-2000)",
+"No", "Nem",
+"No PIN", "Nincs PIN",
+"No access", "Nincs hozzáférés",
+"No adapters specified!\n", "Nincs meghatározott eszköz\n",
+"No assigned adapters", "Nincs hozzárendelt adapter",
+"No days", "Nincsenek napok",
+"No descrambler", "Nincs kititkosító",
+"No free adapter", "Nincs szabad adapter",
+"No input detected", "Nincs érzékelt bemenet",
+"No service assigned to channel", "Nincs szolgáltatás hozzárendelve a csatornához",
+"No service enabled", "Nincs engedélyezett szolgáltatás",
+"No source available", "Nincs forrás",
+"None", "Egyik sem",
+"Normal", "Normál",
+"Not all SAT>IP servers use the same signal scaling. Change this setting if the signal level displayed within Tvheadend looks too low.", "Nem minden SAT> IP szerver használja ugyanazt a jel-léptéket. Változtassa meg ezt, ha a Tvheadend-ben megjelenített jelszint túl alacsonynak tűnik.",
+"Not enough memory", "Nincs elég memória",
+"Not linked", "Nem linkelt",
+"Not set", "Nincs beállítva",
+"Not set (none or channel configuration)", "Nem beállított (egy sem vagy csatorna beállítás hiányzik)",
+"Not set (use channel or DVR configuration)", "Nem beállított (csatorna használata vagy DVR beállítás)",
+"Number", "Szám",
+"Number of seconds to wait before timing out.", "Lejárat előtti várakozási idő másodpercekben.",
+"Number of tsfile tuners", "Tsfile tőnerek száma",
+"OK (partial)", "OK (részleges)",
+"OSCam net protocol (rev >= 10389)", "OSCam net protokol (rev >= 10389)",
+"OSCam new pc-nodmx (rev >= 10389)", "OSCam új pc-nodmx (rev >= 10389)",
+"Odd key", "Páratlan kulcs",
+"Off", "Ki",
+"Older OSCam", "Régebbi OSCam",
+"On", "Be",
+"On file removal", "File eltávolításánál",
+"Only Bulsatcom 39E", "Csak Bulsatcom 39E",
+"Only EIT", "Csak EIT",
+"Only OpenTV Sky Ausat", "Csak OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Csak OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Csak OpenTV Sky UK",
+"Only PSIP (ATSC)", "CSak PSIP (ATSC)",
+"Only UK Freesat", "Csak UK Freesat",
+"Only UK Freeview", "Csak UK Freeview",
+"Only Viasat Baltic", "Csak Viasat Baltic",
+"Only preferred CA PID", "Csak preferált CA PID",
+"Only update the system clock (doesn't affect NTP driver) if the delta between the system clock and DVB time is greater than this. This can help stop excessive oscillations on the system clock.", "Csak akkor frissítse a rendszer órát (nem befolyásolja az NTP drivert) ha a külömbség a rendszer óra és DVB idő között nagyobb, mint az izz beállított érték. Ez segít a túlzott  rendszer óra oszcillációk ellen.",
+"OpenTV channel number", "OpenTV csatorna szám",
+"Orbital position", "Műhold-pozíció",
+"Orbital positions", "Műhold-pozíciók",
+"Original network ID", "Eredeti hálózat ID",
+"Other stream filter", "Egyéb stream szűrő",
+"Output directory for tsdebug", "Kimenő mappa tsdebug-nak",
+"Over-the-air", "OTA",
+"Over-the-air Cron multi-line", "OTA Cron job több-soros",
+"Over-the-air EPG grabber", "Over-the-air EPG letöltő",
+"Over-the-air grabbers", "Over-the-air letöltők",
+"Override the frontend type.", "Frontend típusának felülbírálata.",
+"Owner", "Tulajdonos",
+"PEND", "FÜGGŐ",
+"PIDs 21 in setup", "PID 21 beállítás alatt",
+"PIDs in setup", "PID-ek  beállítás alatt",
+"PIN inquiry match string", "PIN víszgálatot ellenőrző szó",
+"PLS code", "PLS kód",
+"PLS mode", "PLS mód",
+"Parent entry", "Szülő bejegyzés",
+"Pass subscription weight", "Előfizetői súly továbbadása",
+"Pass subscription weight to the SAT>IP server (Tvheadend specific extension).", "Előfizetői súly továbbadása a SAT>IP szervereknek (Tvheadend specifikus kiterjesztés).",
+"Password", "Jelszó",
+"Password2", "Jelszó2",
+"Passwords", "Jelszavak",
+"Path", "Elérési útvonal",
+"Path to a directory (folder) containing your picon collection. See Help for more detailed information.", "A picon gyűjtemény könyvtárára mutató útvonal. (Ld. a súgót további információkért).",
+"Path to an icon for this channel. This can be named however you wish, as either a local (file://) or remote (http://) image. See Help for more infomation.", "A csatorna ikonjára mutató útvonal.Ennek elnevezése lehet barmilyen formátumban, helyi fájl (file://) vagy távoli (http://) elérési  útvonalként.  Ld. a súgót további információkért.",
+"Performing arts", "Előadóművészet",
+"Periodically save EPG to disk (hours)", "EPG lemezre mentése periodikusan(órákban)",
+"Persistent user interface level", "Perszisztens felhasználói-felület szint",
+"Physiology", "Élettan",
+"Picon", "Csatorna ikon",
+"Picon path (see Help)", "Csatorna ikonok útvonala (ld. Súgó)",
+"Pilot", "Próba",
+"Polarization", "Polarizáció",
+"Political issues", "Politikai problémák",
+"Popular culture", "Népszerű kultúra",
+"Position", "Pozicíó",
+"Position of the input.", "Bemenet pozíciója.",
+"Post-processor command", "Posztprocesszor parancs",
+"Post-recording padding", "Rögzítés utáni ráhagyás",
+"Post-remove command", "Utólagos törlés parancs",
+"Power save", "Energia takarékos",
+"Power-up time (ms) (15-200)", "Bekapcsolás idő (ms) (15-200)",
+"Pre-defined muxes", "Előre meghatározott muxok",
+"Pre-recording padding", "Rögzítés előtti ráhagyás",
+"Pre-school children's programs", "Óvodás programok",
+"Prefer picons over channel name", "Csatorna ikonok előnyben részesítése a csatorna nevekkel szemben",
+"Preferred CA PID", "Preferált CA PID",
+"Preferred service video type", "Preferált szervíz video típus",
+"Presentation", "Bemutató",
+"Presentation details.", "Megjelenítési részletek.",
+"Press", "Sajtó",
+"Prevents users from overriding the above user interface level setting and removes the view level drop-dowm from the interface.", "Megakadályozza a felhasználókat hogy felülírják a fenti felhasználói felület szintjének beállítását, és eltávolítja a nézetszint lenyílólistát a  felhasználói felületről",
+"Priority", "Prioritás",
+"Priority (-10..10)", "Prioritás (-10..10)",
+"Private", "Privát",
+"Profile name", "Profilnév",
+"Program identification (PID) number to compare. Zero means any. This comparison is processed only when service comparison is active and for the Conditional Access filter.", "(PID) szám összehasonlítására. Nulla jelenése bármennyi. \nEz az összehasonlítás akkor van feldolgozva, amikor a szolgáltatás feldolgozása aktiválva van CAS - korlátozott hozzáférésü rendszer -  filter részére.",
+"Provider", "Szolgáltató",
+"Provider ID", "Szolgáltató ID",
+"Provider network name", "Hálózat neve",
+"Psychology", "Pszichológia",
+"Puppets", "Bábok",
+"Quiz", "Kvíz",
+"RAM only", "Csak RAM-ban",
+"RTSP port", "RTSP Port",
+"RTSP port (554 or 9983, 0 = disable)", "RTSP Port (554 vagy 9983), 0 = letiltás",
+"RTSP/TCP (embedded data)", "RTSP/TCP (beágyazott adat)",
+"Radio", "Rádió",
+"Re-fetch period (hours)", "Újrapróbálkozási idő (órákban)",
+"Re-fetch period (mins)", "Újrapróbálkozási idő (percben)",
+"Re-record%s%s", "Újrarögzítés %s%s",
+"Re-try period (hours)", "Újrapróbálkozási idő (órákban)",
+"Real Time Streaming Protocol (RTSP) port the server should listen on (554 or 9983, 0 = disable).", "A szerver által használt Real Time Streaming Protokol (RTSP) port. (554 vagy 9983, 0=kikapcsolt). ",
+"Record all", "Összes rögzítése",
+"Recording file options", "Felvett fájl tulajdonságai",
+"Recording system path", "Felvétel elérési útvonala",
+"Reject", "Tiltás",
+"Religion", "Vallás",
+"Religious", "Vallási",
+"Remarkable people", "Ismert emberek",
+"Remove HTTP arguments", "HTTP argumentumok törlése",
+"Remove all unsafe characters from filename", "Nem biztonságos karakterek eltávolítása a fájlnévből",
+"Replace whitespace in title with '-'", "Szóköz '-' re cserélése",
+"Reply to CAM PIN inquiries", "Válaszoljon CAM PIN kérésekre",
+"Reports", "Jelentések",
+"Rerun of", "Újrafuttatása",
+"Rescan", "Újrakeresés",
+"Reserved", "Foglalt",
+"Resolution (height)", "Felbontás (magasság)",
+"Respawn (pipe)", "Újrakezdése (pipe)",
+"Restart on error", "Újraindítás hiba esetén",
+"Reuse EPG from", "EPG újrafelhasználása",
+"Rewrite EIT", "EIT újraírása",
+"Rewrite MPEG-TS SI tables", "MPEG-TS SI táblák újraírása",
+"Rewrite PAT", "PAT újraírása",
+"Rewrite PMT", "PMT újraírása",
+"Rewrite Program Association Table (PMT) packets to only include information about the currently streamed service.", "A  PMT   (Csatorna asszociációs tábla) csomagok újraírása, hogy csak a folyamatben levő szolgáltatásról tartalmazzon információt",
+"Rewrite SDT", "SDT újraírása",
+"Romance", "Romantika",
+"Rotor initialization time (seconds)", "Forgató inicializálásának időtartama indítás után (másodperben)",
+"Rotor type", "Forgató típusa",
+"Run as group", "Futtatás az alábbi felhasználócsportként",
+"Run as user", "Futtatás felhasználóként",
+"Running", "Futó",
+"SAT->IP frontend number.", "SAT->IP frontend szám.",
+"SAT>IP DVB frontend", "SAT>IP DVB felület",
+"SAT>IP DVB-C frontend", "SAT>IP DVB-C  felület",
+"SAT>IP DVB-S frontend", "SAT>IP DVB-S felület",
+"SAT>IP DVB-S slave frontend", "SAT>IP DVB-S másodlagos felület",
+"SAT>IP DVB-T frequency (Hz)", "SAT>IP DVB-T frekvencia (Hz)",
+"SAT>IP DVB-T frontend", "SAT>IP DVB-T felület",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP port szám a szerverhez\n(alapértelmezett: -1 = kikapcsolt, 0 = webconfig, standard port érték 554)",
+"SAT>IP client", "SAT>IP kliens",
+"SAT>IP server", "SAT>IP szerver",
+"SAT>IP source number", "SAT>IP Forrás Száma",
+"SD: standard definition", "SD: Normál felbontású",
+"SSL verify peer", "SSL pár ellenőrzés",
+"Satellite longitude", "Műhold hosszúsági fok",
+"Satellite positions", "Műhold-pozíciók",
+"Scan after creation", "Szkennelés létrehozás után",
+"Scan queue length", "Szkennelési sor hossza",
+"Scan result", "Szkennelés eredmény",
+"Scan status", "Szkennelés státusz",
+"Schedule a re-recording if more errors than (0=off)", "Újrafelvétel ütemezése több mint x észlelt hiba után (0=Ki)",
+"Schedule status", "Időzítés státusza",
+"Scheduled for recording", "Újravételezésre időzítve",
+"Scheduled start time", "Időzítés kezdési időpont",
+"Scheduled stop time", "Időzítés leállítási időpont",
+"School programs", "Iskolai műsorok",
+"Science", "Tudomány",
+"Science fiction", "Sci-Fi",
+"Season", "Évad",
+"Season %d", "%d. Évad",
+"Seek error", "Keresési hiba",
+"Select how Tvheadend should handle muxes. Auto = accept the mux if it doesn't already exist. Keep = Always keep the muxregardless of whether it exists or not. Reject = Always reject.", "Válassza ki, hogyan kezelje a Tvheadend a multiplexeket. Auto = elfogadja ha még nem létezik. Megtart = Mindig tartsa a muitipiexet függetlenül attól, hogy létezik-e vagy sem. Elutasítás = Mindig elutasítja.",
+"Select the list of languages (in order of priority) to be used for supplying EPG information to clients that don't provide their own configuration.", "Válassza ki az EPG információ szolgáltatásnál használt nyelvet (fontossági sorrendben) ami abban az esetben használt, ahol a kliens nem szolgáltatja a saját konfigurációját",
+"Select the master tuner.The signal from the standard universal LNB can be split using a simple coaxial splitter (no multiswitch) to several outputs. In this case, the position, the polarization and low-high band settings must be equal.if you set other tuner as master, then this tuner will act like a slave one and tvheadend will assure that this tuner will not use incompatible parameters (position, polarization, lo-hi).", "Válassza ki a fő tunert. A jelet az univerzális LNB-től el lehet osztani egy egszerű koaxiális kábellel (nem multiswitch-el) több kimenetre. Ebben az esetben a helyzet, polarizáció valamint alacsony-magas frekvenciatartományok azonosak kell, hogy legyenek. Ha egy másik tunert allítunk be master tunernek, akkor ez a tuner másodlagos tunerként fog viselkedni és a tvheadend biztosíttani fogja, hogy ez a tuner ne hasznájon nem-kompatibilis paramétereket (helyet, polarizáció, frekvenciatartomány)",
+"Select the number of satellite positions supported by the SAT>IP hardware and your coaxial cable wiring.", "Válassza ki a SAT>IP hardver által támogatott müholdpoziciők számát és a koaxiális kábelezés tipusát.",
+"Select the path to use for DVB scan configuration files. Typically dvb-apps stores these in /usr/share/dvb/. Leave blank to use Tvheadend's internal file set.", "Válassza ki az elérési útvonalat a DVB-scan konfigurációs fájlokhoz. Általában a  dvb-apps   ezeket az /usr /share/dvb/ -ben tárolja . Hagyja üresen  ha óhaktja, hogy a Tvheadend a belső fájl készlet használja.",
+"Select whether or not to enable caching. Note: even with this disabled you can still specify local (file://) icons and these will be served by the built-in webserver.", "Válassza ki, hogy engedélyezi-e a cache-t.  Figyelem:  még ha ez ki is van kapcsolva, akkor is megadhat lokális (file: //) ikonokat,  és  a beépített webszerver ezeket fogja használni",
+"Send CAPMT query", "Küldjön CAPMT lekérdezést",
+"Send full PLAY cmd", "Küldjön tejes LEJÁTSZÁS parancsot",
+"Send the full RTSP PLAY command after full RTSP SETUP command. Some devices firmware require this to get an MPEG-TS stream.", "Küldje el a teljes RTSP PLAY parancsot minden teljes RTSP setup parancs után. Egyes eszközök megkövetelik ezt ahhoz, hogy MPEG-TS streamelést biztosítsanak.",
+"Serial number", "Gyári szám",
+"Series link", "Sorozat hozzáférés",
+"Serious", "Komoly",
+"Serious music", "Komoly zene",
+"Server", "Szerver",
+"Server UUID", "Szerver UUID",
+"Server connectivity", "Szerverkapcsolat",
+"Server details.", "Szerver részletei.",
+"Service", "Szolgáltatás",
+"Service ID", "Szolgáltatás ID",
+"Service configuration", "Szolgáltatás konfiguráció",
+"Service count %zi", "Szolgátatások száma %zi",
+"Service mapper", "Szolgáltatás összerendelő",
+"Service mapping", "Szolgáltatás összerendelés",
+"Service name", "Szolgáltatás neve",
+"Service raw", "Szolgáltatás raw",
+"Service type", "Szolgáltatás típus",
+"Services", "Szolgáltatások",
+"Set the display name.", "Név beállítása.",
+"Set the maxiumum packet identifiers your SAT>IP server supports.", "A maximális csomagazonosító, amit a SAT>IP szerver támogat.",
+"Set the name of the server so you can distinguish multiple instances apart on your LAN.", "A szerver nevének beállítása, annak érdekében, hogy megkülönböztethesse a különböző futó példányokat a LAN-on.",
+"Set the priority of this configuration.", "Ezen beállítás prioritása.",
+"Sets the default interface view level (next to the help button).", "Beállítja az alapértelmezett interfész nézet szintjét ( a Súgó-gomb mellett).",
+"Settings", "Beállítások",
+"Show this page", "Oldal megjelenítése",
+"Show version information", "Verzió információ megjelenítése",
+"Show, hide and sort the various details that appear on the interface next to the About tab.", "Mutat, elrejt és rendez különböző részletet, amelyek az interfészen jelennek meg, a Tvheadend-ről fül mellett.",
+"Signal quality too poor", "Jelminőség túk gyenge",
+"Signal scale (240 or 100)", "Jel slála  (240 vagy 100)",
+"Site latitude", "Fekvés szélességi fok",
+"Site latitude.", "Helyszín szélességi fok.",
+"Site longitude", "Fekvés hosszúsági fok",
+"Site longitude.", "Helyszín hosszúsági fok.",
+"Size", "Méret",
+"Skip TS packets (0-200)", "TS csomagok kihagyása (0-200)",
+"Skip TSID checking. For when providers use invalid Transport Stream IDs.", "A TSID ellenőrzés kihagyása. Olyan esetekre, amikor a szolgáltatók érvénytelen Transport Stream ID-t használnak.",
+"Skip commercials", "Reklámok kihagyása",
+"Skip initial bytes", "Kezdeti x bájt kihagyása",
+"Skip initial scan", "Kezdeti szkennelás kihagyása",
+"Skip x number of transport packets.", "x számú transport csomag elvetése.",
+"Slave entry", "Szolga bejegyzés",
+"Slot state", "Slot státusz",
+"Soap", "Szappanopera",
+"Soccer", "Foci",
+"Social", "Közösségi",
+"Social advisory", "Társadalmi célú hirdetés",
+"Sort index", "Indexek rendszerezése",
+"Source", "Forrás",
+"Source deleted", "Forrás törölve",
+"Source quality is bad", "Forrás rossz minőségű",
+"Source reconfigured", "Forrás újrabeállítva",
+"Southern hemisphere (latitude direction)", "Déli félteke (szélesség irányában)",
+"Special events (Olympic Games, World Cup, etc.)", "Különleges események (Olimpia, Világkupák, stb.)",
+"Specify User-Agent header for the http client", "Adja meg az User-Agent - felhasználókliens fejlécet a HTTP kliensnek",
+"Specify alternative htsp port", "Alternatív htsp port megadása",
+"Specify alternative http port", "Alternatív http port megadása",
+"Specify alternative http webroot", "Alternatív http webroot megadása",
+"Specify bind address", "Bind IP címének megadása",
+"Specify extra htsp port", "Alternatív htsp port megadása",
+"Spiritual sciences", "Lelki tudományok",
+"Sports", "Sportok",
+"Sports magazines", "Sportműsorok",
+"Squash", "Fallabda",
+"Start", "Kezdés",
+"Start after", "Kezdés időpont után",
+"Start before", "Kezdés időpont előtt",
+"Start time", "Kezdés Időpontja",
+"Status", "Állapot",
+"Status period (ms)", "Állapot periódus (ms-ban)",
+"Stereo", "Sztereó",
+"Stop", "Leállítás",
+"Stop time", "Leállítási idő",
+"Storage path", "Tárhely elérési útvonal",
+"Storage space", "Tárhely",
+"Stream profile", "Stream-profil",
+"Stream type", "Stream típus",
+"Streaming", "Stream-elés",
+"Streaming priority", "Stream-profil",
+"Streaming profiles", "Stream-profilok",
+"Subdirectory options", "Alkönyvtár opciók",
+"Subscribe to a service permanently", "Előfizetés adott szolgáltatásra véglegesen",
+"Subscription overridden", "Előfizetés felülbírálva",
+"Subscription weight", "Előfizetés súlyzó",
+"Substitute formatters", "Helyettesítő formázók",
+"Subtitle", "Felirat",
+"Subtitle codec", "Felirat kódec",
+"Subtitle stream filter", "Stream-felirat szűrő",
+"Sun", "Vas",
+"Surround (2 front, rear mono)", "Térhatás(2 első, monó hát)",
+"Switch before rotor", "Switch motor előtt",
+"Switch type", "Switch típus",
+"Symbol rate (Sym/s)", "Szimbólum sebesség(Sym/s)",
+"Sync + Don't keep", "Sync+ne tartsa meg",
+"System", "Rendszer",
+"Tag files with metadata", "Fájlok címkézése metaadatokkal",
+"Tags", "Címkek",
+"Team sports (excluding football)", "Csapat sportok (focit kivéve)",
+"Technology", "Technika",
+"Teletext stream filter", "Teletext stream-szűrő",
+"Teletext stream type is only available for this filter.", "A Teletext stream típus csak ennél a szűrőnél alkalmazható. ",
+"Tennis", "Tenisz",
+"Testing", "Tesztelés",
+"Testing options", "Tesztelési tulajdonságok",
+"The ATSC source ID as set by the provider.", "A szolgáltató által beállított ATSC forrás ID.",
+"The CA provider to compare. Leave blank to apply to all providers.", "A CA szolgáltató, összehasonlításhoz. Hagyja üresen az összes szolgáltatóra történő alkalmazáshoz.",
+"The CA stream type is only available for this filter.", "A CA stream típus csak ennél a szűrőnél alkalmazható. ",
+"The CAID to compare. Leave blank to apply to all IDs.", "CAID az összehasonlításhoz. Hagyja üresen az összes ID-ra történő alkalmazáshoz.",
+"The Content reference identifier (CRID) authority.", "A Content reference identifier (CRID) hatóság.",
+"The MPEGTS stream type is only available for this filter.", "Az MPEGTS stream típus csak ennél a szűrőnél alkalmazható. ",
+"The OpenTV channel number as set by the provider.", "Az OpenTV csatorna sorszáma, ahogyan a szolgáltató beállította.",
+"The Preferred Conditional Access Packet Identifier. Used for decrypting scrambled streams.", "A Preferred Conditional Access Packet Identifier. Titkosított stream-ek visszafejtéséhez használandó.",
+"The SAT>IP server's name.", "A SAT>IP szerver neve.",
+"The SAT>IP server's universally unique identifier.", "A SAT>IP szerver általánosan egyedi azonosítója.",
+"The SAT>IP's discovered IP address.", "A SAT>IP által megtalált IP-cím.",
+"The audio stream types the filter should apply to.", "A szűrő által használt audio stream típusok.",
+"The character encoding for this service (e.g. UTF-8).", "Szolgáltatás karakterkódolása (pl. UTF-8).",
+"The character set used on this mux. You should not have to change this unless channel names, etc  appear garbled.", "A  multiplex átltal használt karakter szett. Ezt csak akkor kell megváltoztatni, ha a csatorna nevek, stb. helytelenül jelennek meg.",
+"The current boot ID.", "Jelenlegi boot ID.",
+"The current configuration ID.", "Jelenlegi beállítási azonosító ID.",
+"The current configuration version.", "Jelenlegi beállítás verziója.",
+"The default language to use if the user  language isn't set in the Access Entries tab.", "A használandó, alapértelmezett nyelv, amennyiben a felhasználói nyelv nincs beállítva a hozzáférések fülön.",
+"The default subscription weight for each subscription.", "Az alapértelmezett előfizetői súlyozás minden egyes előfizetéshez.",
+"The device ID.", "Az eszköz ID-je.",
+"The device's serial number.", "Az eszköz sorozatszáma.",
+"The frequency of the mux (in Hertz).", "A mux frekvenciája (Hertz-ben).",
+"The language the filter should apply to.", "A szűrő által alkalmazandó nyelv.",
+"The locking mechanism selection for The Preferred Conditional Access Packet Identifier. See Help for more information.", "A használt blokkolási mechanizmus az előnyben részesített CAS csomag azonosítónál. Lásd a Súgót további informácókért.",
+"The logical stream index to compare. Note that this index is computed using all filters.Example: If filter is set to AC3 audio type and the language to 'eng' and there are two AC3 'eng' streams in the service, the first stream could be identified using number 1 and the second using number 2.", "Az összehasonlítandó logikai adatfolyam indexe. Ne feledje, hogy ez az index  minden szürő használatával van kiszámítva.\nPélda:  Ha szűrő AC3 audio típusra, a nyelv \"hun\" -ra van beállítva , és  két AC3 \"hun\"  típusú hang adatfolyam van a  szolgáltatásban, akkor az első adatfolyamot 1-es számmal, a másodikat 2-es számmal lehet azonosítani.",
+"The manufacturer of the SAT>IP server.", "A SAT>IP szerver gyártója.",
+"The maximum number of services to decrypt per mux.", "A mux-onkénti szolgáltatások visszafejtésének száma.",
+"The minimum delay before tuning in milliseconds after tuner stop. If the time between the previous and next start is greater than this value then the delay is not applied.", "A minimális késleltetás újrahangolás esetén az előző keresés után.  Ha az idő  az előző és a következő kezdet között meghaladja ezt az értéket, akkor a késleltetés nincs alkalmazva.",
+"The modulation used on the mux.", "A mux-on hasznát moduláció.",
+"The multiplex (mux) is tuned for this amount of time at most. If the EPG data is complete before this limit, the mux is released sooner.", "A multiplex (mux) legfeljebb ennyi ideig hangolt. Amennyiben az EPG adatok korábban letöltődnek, a mux hamarabb felszabadul.",
+"The mux the service is on.", "A szolgáltatás mux-a.",
+"The mux's universally unique identifier.", "A mux általánosan egyedi azonosítója.",
+"The network the service is on.", "A szolgáltatás hálózata.",
+"The networks using this configuration.", "A hálózatok, amelyek ezt a beállítást használják.",
+"The number of ATSC-C (Cable/AnnexB) tuners to export.", "Az exportálandó ATSC-C (kábel/AnnexB) tuner-ek száma.",
+"The number of ATSC-T (Terresterial) tuners to export.", "Az exportálandó ATSC-T (földfelszíni) tuner-ek száma.",
+"The number of DVB-C (Cable) tuners to export.", "Az exportálandó DVB-C (kábel) tuner-ek száma.",
+"The number of DVB-C2 (Cable) tuners to export.", "Az exportálandó DVB-C2 (kábel) tuner-ek száma.",
+"The number of DVB-S (Satellite) tuners to export.", "Az exportálandó DVB-S (műholdas) tuner-ek száma.",
+"The number of DVB-S2 (Satellite) tuners to export.", "Az exportálandó DVB-S2 (műholdas) tuner-ek száma.",
+"The number of DVB-T (Terresterial) tuners to export.", "Az exportálandó DVB-T (földfelszíni) tuner-ek száma.",
+"The number of DVB-T2 (Terresterial) tuners to export.", "Az exportálandó DVB-T2 (földfelszíni) tuner-ek száma.",
+"The number of days cookies set by Tvheadend should expire.", "A Tvheadend által használt sütik lejárati ideje napokban.",
+"The outcome of the last scan performed on this mux.", "A legutóbbi keresés eredménye ezen a mux-on.",
+"The provider's name.", "A szolgáltató neve.",
+"The provider's network ID.", "A szolgáltató hálózati azonosítója.",
+"The provider's network name.", "A szolgáltatói hálózat neve.",
+"The rule action defines the operation when all comparisons succeed. See Help for more information on what the various rules do.", "A szabály definiálja a műveletet amennyiben az összehasonlítások sikeresek. További információkért, hogy a különböző szabályok mire használhatóak, nézze meg a súgót.",
+"The scan state. New muxes will automatically be changed to the PEND state. You can change this to ACTIVE to queue a scan of this mux.", "A keresés állapota. Az új mux-ok automatikusan PEND állapotba váltanak. Átkapcsolhatja ACTIVE-ba, hogy egy új keresést időzítsen a mux-hoz.",
+"The service ID as set by the provider.", "A szolgáltató által beállított service ID.",
+"The service name as set by the provider.", "A szolgáltató által beállított szolgáltatás neve.",
+"The service the filter should apply to. Leave blank to apply the filter to all services.", "A szolgáltatás amihez a szűrő tartozik.Hagyja üresen az összes szolgáltatásra történő alkalmazáshoz.",
+"The service type flag as defined by the DVB specifications (e.g. 0x02 = radio, 0x11 = MPEG2 HD TV, 0x19 = H.264 HD TV)", "A service type flag ahogyan a DVB specifikáció definiálja (pl. 0x02 = rádió, 0x11 = MPEG2 HD TV, 0x19 = H.264 HD TV)",
+"The service's channel minor as set by the provider.", "A szolgáltatás csatornájának minor-ja, a szolgáltató beállításai szerint. ",
+"The service's channel number as set by the provider.", "A szolgáltatás csatornájának sorszáma, a szolgáltató beállítása alapján.",
+"The subtitle stream types the filter should apply to.", "A szűrő által használt felirat stream típusai.",
+"The symbol rate.", "Jelsebesség.",
+"The total number of services found on this mux.", "A mux-on található szolgáltatások teljes száma.",
+"The transport stream ID of the mux within the network.", "A mux hálózaton belüli transport stream ID-ja.",
+"The video stream types the filter should apply to.", "A szűrő által használt videó stream típusai.",
+"This tuner", "Ez a tuner",
+"This will create an NTP driver (using shmem interface) that you can feed into ntpd. This can be run without root privileges, but generally the performance is not that great.", "Ez egy NTP meghajtót hoz létre (az shmem interfész használatával) amit az ntpd-be küldhet. Ez root jogosultságok nélkül futtatható, de a teljesítménye nem túl kiemelkedő.",
+"Thu", "Csüt",
+"Time", "Idő",
+"Time missed", "Kihagyott alkamak",
+"Time record caption", "Időrekord vétele",
+"Time recording%s%s", "Vételek idelye%s%s",
+"Time update", "Idő frissítése",
+"Timeout (sec) (0=infinite)", "Időtúllépés (másodperc) (0 = végtelen)",
+"Timeout (seconds)", "Időtúllépést (másodperc)",
+"Timeshift", "Időeltolás",
+"Timout (secs)", "Időtúllépés (másodperc)",
+"Title", "Cím",
+"Title (regexp)", "Cím (regexp)",
+"Toggle details", "Részletek közötti váltás",
+"Tourism / Travel", "Túrizmus / Utazás",
+"Trace subsystems", "Trace alrendszerek ",
+"Traditional arts", "Hagyományos művészetek",
+"Traditional music", "Hagyományos zene",
+"Transcode/av-lib", "Átkódolás/av-lib",
+"Transcoding", "Átkódolás",
+"Transmission mode", "Átviteli mód",
+"Transponder ID", "Transzponder ID",
+"Transport stream ID", "Transzport stream ID",
+"Tue", "Ke",
+"Tune before DiseqC", "Hangolás  DiseqC előtt",
+"Tuner bind IP address", "Tuner bind IP-címe",
+"Tuner configuration", "Tuner beállítás",
+"Tuning failed", "Sikertelen hangolás ",
+"Turn off LNB when idle", "LNB lekapcsolása üresjáraton",
+"Tvheadend server name", "Tvheadend szerver neve",
+"Type", "Típus",
+"UDP RTP port number (2 ports)", "UDP RTP port száma (2 port)",
+"URL with the SAT>IP server XML location", "SAT> IP szerver  XML eléresének URL-je",
+"USALS rotor", "USALS forgató",
+"Uncommitted first", "Uncommitted előbb",
+"Unicable switch (universal LNB, experimental)", "Unicable switch (Univerzális LNB, kísérleti)",
+"Unicable type", "Unicable típus",
+"Unimportant", "Jelentékelen",
+"Universal LNB only", "Csak univerzális LNB ",
+"Universally unique identifier. Read only.", "Általánosan egyedi azonosító. Csak olvasható.",
+"Unknown", "Ismeretlen",
+"Unknown reason (%i)", "Ismeretlen ok (%i)",
+"Unlimited size", "Végtelen méret",
+"Unlimited time", "Korlátlan idő",
+"Unset (default)", "Nem beállított(alapértelmezett)",
+"Update card (EMM)", "Kártya (EMM) frissítése",
+"Update channel icon", "Csatornaikon frissítése",
+"Update channel name", "Csatornanév frissítése",
+"Update channel number", "Csatornaszám frissítése",
+"Update disabled", "Frissítés kikapcsolva",
+"Update time", "Idő frissítése",
+"Update tolerance (ms)", "Frissítési tolerancia (ms)",
+"Updated", "Frissített",
+"Usage: %s [OPTIONS]\n", "Használat:%s [opciók]\n\n",
+"Use EPG running state", "Következtessen az EPG állapotából",
+"Use Windows-compatible filenames", "Használjon Windows-kompatibilis fájlneveket",
+"Use XSPF playlist instead of M3U", "Használjon XSPF lejátszás listát  M3U helyett",
+"Use a pre-defined list of ATSC-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Egy előre definiált ATSC-C mux-lista használata. Megjegyzés: Ezek a listák néha régiek lehetnek és azt eredményezhetik, hogy a keresés hosszabb időt vesz igénybe, mint általában.",
+"Use a pre-defined list of ATSC-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Egy előre definiált ATSC-T mux-lista használata. Megjegyzés: Ezek a listák néha régiek lehetnek és azt eredményezhetik, hogy a keresés hosszabb időt vesz igénybe, mint általában.",
+"Use a pre-defined list of DVB-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Egy előre definiált DVB-C mux-lista használata. Megjegyzés: Ezek a listák néha régiek lehetnek és azt eredményezhetik, hogy a keresés hosszabb időt vesz igénybe, mint általában.",
+"Use a pre-defined list of DVB-S/S2 muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Egy előre definiált DVB-S/S2 mux-lista használata. Megjegyzés: Ezek a listák néha régiek lehetnek és azt eredményezhetik, hogy a keresés hosszabb időt vesz igénybe, mint általában.",
+"Use a pre-defined list of DVB-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Egy előre definiált DVB-T mux-lista használata. Megjegyzés: Ezek a listák néha régiek lehetnek és azt eredményezhetik, hogy a keresés hosszabb időt vesz igénybe, mint általában.",
+"Use original", "Eredeti használata",
+"Use service IDs as channel numbers", "Használja a szolgáltatás azonosítókat csatornaszámként",
+"User access error", "Felhasználó hozzáférési hiba",
+"User icon", "Felhasználoi ikon",
+"User interface level", "Felhasználófelület szint",
+"User interface quick tips", "Felhasználói felület gyorstippek",
+"User language", "Felhasználó nyelve",
+"User limit reached", "Felhasználói korlát elérve",
+"User login", "Felhasználói belépés",
+"Username", "Felhasználónév",
+"Variety show", "Varieté show",
+"Video bitrate (kb/s) (0=auto)", "Video bitráta (kb/s) (0=Auto)",
+"Video codec", "Video kódec",
+"Video recorder", "Videó-felvevő",
+"Video stream filter", "Videó stream szűrő",
+"Visually impaired commentary/audio description", "Kommentár látássérülteknek",
+"WEBM/built-in", "WEBM/beépített",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV profil H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV profil H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV profil VP8/Vorbis/WEBM",
+"Waiting for EPG running flag", "Várjon az EPG státusz flag-re",
+"Waiting for program start", "Várakozás a műsorkezdésre",
+"Waiting for stream", "Stream-re várakozás",
+"War", "Háború",
+"Water sport", "Vizisport",
+"Weak stream", "Gyenge stream",
+"Weather report", "Időjárás-jelentés",
+"Web interface", "Webes felület",
+"Web interface language", "Webes felület nyelve",
+"Web user interface", "WEB-es felület",
+"Wed", "Sze",
+"Welcome - Tvheadend - your TV streaming server and video recorder", "Üdvözöljük - Tvheadend - az Ön streaming szervere és videórögzítője",
+"Western hemisphere (latitude direction)", "Nyugati félteke (szélesség irányában)",
+"When the service was first identified and recorded.", "Amikor a szolgáltatás először került azonosításra és bejegyzésre.",
+"When the service was last seen during a mux scan.", "Amikor a szolgáltatás utoljára volt látható egy mux keresésnél.",
+"Wizard", "Varázsló",
+"Wrapper (capmt_ca.so)", "Illesztő (capmt_ca.so)",
+"Write a short message to log identifying the matched parameters. It is useful for debugging your setup or structure of incoming streams.", "Írjon egy rövid üzenetet a loghoz, a megtalált paramétereket azonosítandó. Hasznos a beállítások hibakeresésénél és a bejövő stream-ek szerkezeténél.",
+"Writes the current in-memory EPG database to disk every x hours, so should a crash/unexpected shutdown occur EPG data is saved periodically to the database (re-read on next startup). Set to 0 to disable.", "Írja ki  a jelenleg memóriában tárolt EPG adatbázist lemezre  x óránként, így  egy  váratlan leállás esetében az EPG adatok időszakosan ki lesznek menteve a tárolóba (a következő induláskor újra be lesz töltve). Ha az érték 0, akkor le van tiltva.",
+"Yes", "Igen",
+"addpids/delpids supported", "addpids/delpids támogatva",
+"hrs", "óra",
+"invalid option specified [%s]", "Érvénytelen beállítás lett megadva [%s]",
+"min", "perc",
+"mins", "percek",
+"option %s requires a value", "%s opció értéket igényel",
+"tsfile input (mux file)", "tsfile bement (mux fájl)",
+"tvhdhomerun client", "tvhdhomerun ügyfél",
+NULL, NULL
+};
+
+static const char *tvh_locale_15[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nPer maggiori informazioni consulta il sito web di Tvheadend:\nhttps://tvheadend.org\n",
+"# Channels", "# Canali",
+"# Mapped channels", "# Canali mappati",
+"# Muxes", "# Mux",
+"# Services", "# Servizi",
+"# Services seen", "# Servizi visti",
+"# tune repeats", "# ripetizioni sintonia",
+"(Default profile)", "(Profilo predefinito)",
+"1 day", "1 giorno",
+"1 month", "1 mese",
+"1 week", "1 settimana",
+"1 year", "1 anno",
+"2 months", "2 mesi",
+"2 weeks", "2 settimane",
+"2 years", "2 anni",
+"2-Port switch (universal LNB)", "Commutatore a 2 porte (LNB universale)",
+"3 days", "3 giorni",
+"3 months", "3 mesi",
+"3 weeks", "3 settimane",
+"3 years", "3 anni",
+"4-Port switch (universal LNB)", "Commutatore a 4 porte (LNB universale)",
+"5 days", "5 giorni",
+"6 months", "6 mesi",
+"AC-3 = descriptor 6", "AC-3 = descrittore 6",
+"AC-3 detection", "Rilevamento AC-3",
+"ACTIVE", "ATTIVO",
+"AES constant code word client", "Cliente constant code word AES",
+"ANY", "QUALUNQUE",
+"ATSC source ID", "ID sorgente ATSC",
+"Aborted by user", "Abortito dall'utente",
+"Access", "Accesso",
+"Action", "Azione",
+"Adapter in use by another subscription", "Adattatore in uso da un'altra sottoscrizione",
+"Add file and line numbers to debug", "Aggiungi file e numeri di linea per il debug",
+"Add the thread ID to debug", "Aggiungi l'ID del thread per il debug",
+"Admin", "Amministrazione",
+"Admin password", "Password amministratore",
+"Admin username", "Nome utente amministratore",
+"Administrator login", "Accesso amministratore",
+"Adult movie", "Film per adulti",
+"Advanced", "Avanzato",
+"Advanced (non-universal LNBs, rotors, etc.)", "Avanzato (LNB non-universali, rotori, ecc.)",
+"Advanced streaming", "Streaming avanzato",
+"Adventure", "Avventura",
+"Advertisement / Shopping", "Pubblicità / Acquisti",
+"All (Streaming plus DVR)", "Tutto (Streaming e DVR)",
+"All DVR (rw)", "Tutto DVR (rw)",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Tutti i ricavati sono usati per il supporto all'infrastruttura server e per l'acquisto di equipaggiamenti da supportare",
+"Alternate PID path", "Percorso PID alternativo",
+"Alternate configuration path", "Percorso di configurazione alternativo",
+"Altitude (meters)", "Altitudine (metri)",
+"Animals", "Animali",
+"Anonymize HTSP access", "Anonimizza accesso HTSP",
+"Any", "Qualunque",
+"Arts", "Arti",
+"Athletics", "Atletica",
+"Audio bitrate (kb/s) (0=auto)", "Bitrate audio (kb/s) (0=automatico)",
+"Audio channel layout.", "Layout canale audio.",
+"Audio codec", "Codec audio",
+"Audio stream filter", "Filtro dello stream audio",
+"Auto", "Automatico",
+"Auto check disabled", "Controllo automatico disabilitato",
+"Auto check enabled", "Controllo automatico abilitato",
+"Auto record", "Registrazione automatica",
+"Auto record caption", "Didascalia della registrazione automatica",
+"Auto recording%s%s", "Auto registrazione%s%s",
+"Auto time record", "Registrazione a tempo automatica",
+"Auto-Map to channels", "Auto-Mappatura sui canali",
+"Automatic checking", "Controllo automatico",
+"Automatically map EPG source", "Mappa automaticamente la sorgente EPG",
+"Automatically name from network", "Nomina automaticamente dalla rete",
+"Automatically record.", "Registra automaticamente.",
+"Autorec maximum count (0=unlimited)", "Conteggio massimo per auto-registrazione (0=illimitato)",
+"Autorec maximum schedules limit (0=unlimited)", "Limite massimo pianificazioni per auto-registrazione (0=illimitato)",
+"Bad", "Cattivo",
+"Ballet", "Balletto",
+"Bandwidth", "Ampiezza di banda",
+"Based on software from", "Basato su software da",
+"Basic", "Semplice",
+"Boot ID", "ID di avvio",
+"Bouquet", "Pacchetto",
+"Bouquet (auto)", "Pacchetto (automatico)",
+"Brand", "Marchio",
+"Broadcast", "Trasmissione",
+"Broadcasting", "Telecomunicazioni",
+"Build", "Versione",
+"CA ID", "ID CA",
+"CA client %i", "Cliente CA %i",
+"CA identification", "Identificazione CA",
+"CA provider", "Fornitore CA",
+"CA stream filter", "Filtro dello stream CA",
+"CAPMT interval (ms)", "Intervallo CAPMT (ms)",
+"CAPMT query interval (ms)", "Intervallo richiesta CAPMT (ms)",
+"CRID authority", "Autorità CRID",
+"Cache scheme", "Schema della cache",
+"Camd.socket filename / IP Address (TCP mode)", "Nome del file camd.socket / indirizzo IP (modalità TCP)",
+"Cartoons", "Cartoni",
+"Channel", "Canale",
+"Channel does not exist", "Canale non esistente",
+"Channel icon", "Icona del canale",
+"Channel icon path (see Help)", "Percorso dell'icona del canale (vedi Aiuto)",
+"Channel name", "Nome del canale",
+"Channel not found", "Canale non trovato",
+"Channel number", "Numero del canale",
+"Channel number offset", "Scostamento del numero del canale",
+"Channel numbers from", "Numeri dei canali da",
+"Channel tag", "Etichetta del canale",
+"Channel tag reference", "Riferimento dell'etichetta di canale",
+"Channel tags", "Etichette del canale",
+"Channels", "Canali",
+"Character set", "Insieme dei caratteri",
+"Check availability", "Verifica disponibilità",
+"Children's / Youth programs", "Trasmissione per bambini e per giovani",
+"Class", "Classe",
+"Classical", "Classico",
+"Classical music", "Musica classica",
+"Clean effects", "Privo di effetti",
+"Client name", "Nome del cliente",
+"Clone scheduled entry on error", "Clona la voce programmata su errore",
+"Code word client (newcamd)", "Cliente code word (newcamd)",
+"Comedy", "Commedia",
+"Command delay time (ms) (10-200)", "Tempo di ritardo del comando (ms) (10-200)",
+"Command time (ms) (10-100)", "Tempo del comando (ms) (10-100)",
+"Comment", "Commento",
+"Commercial break", "Interruzione pubblicitaria",
+"Committed", "Vincolato",
+"Completed OK", "Completato OK",
+"Conditional access client", "Cliente di accesso condizionato",
+"Configuration", "Configurazione",
+"Configuration ID", "ID di configurazione",
+"Configuration name", "Nome della configurazione",
+"Configuration version", "Versione della configurazione",
+"Connection limit type", "Tipo di limite della connessione",
+"Constellation", "Costellazione",
+"Container", "Contenitore",
+"Content character set", "Insieme dei caratteri del contenuto",
+"Content type", "Tipo di contenuto",
+"Contest", "Competizione",
+"Continue even if descrambling fails", "Continua anche se la decodifica fallisce",
+"Cookie expiration (days)", "Scadenza cookie (giorni)",
+"Cooking", "Cucina",
+"Copy codec type", "Copia il tipo di codec",
+"Copy layout", "Copia la disposizione",
+"Create bouquet", "Crea pacchetto",
+"Created", "Creato",
+"Creator", "Creatore",
+"Cron", "Cronologia",
+"Cron multi-line", "Cronologia multi-linea",
+"Culture (without music)", "Cultura (senza musica)",
+"Current RTSP port.", "Porta RTSP attuale.",
+"Current affairs", "Vicende di attualità",
+"Custom HTTP headers", "Intestazioni HTTP personalizzate",
+"DBus - use the session message bus instead of the system one", "DBus - utilizza il bus dei messaggi di sessione al posto di quello di sistema",
+"DES constant code word client", "Cliente constant code word DES",
+"DES key", "Chiave DES",
+"DSCP/TOS for streaming", "DSCP/TOS per lo streaming",
+"DVB EPG ID", "ID dell'EPG DVB",
+"DVB scan files", "File di scansione DVB",
+"DVB scan files path", "Percorso dei file di scansione DVB",
+"DVB-C network", "Rete DVB-C",
+"DVB-S 4-port", "4-porte DVB-S",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, sperimentale)",
+"DVB-S advanced", "DVB-S avanzato",
+"DVB-S network", "Rete DVB-S",
+"DVB-S satellite configuration", "Configurazione satellite DVB-S",
+"DVB-S simple", "DVB-S semplice",
+"DVB-S tone burst", "Impulso del tono DVB-S",
+"DVB-T network", "Rete DVB-T",
+"DVR Auto-record entry", "Voce di auto-registrazione DVR",
+"DVR behavior", "Comportamento DVR",
+"DVR configuration", "Configurazione DVR",
+"DVR configuration profile", "Profilo di configurazione DVR",
+"DVR configuration profiles", "Profili di configurazione DVR",
+"DVR file retention period", "Tempo di conservazione del file DVR",
+"DVR log retention", "Conservazione nel registro DVR",
+"DVR log retention period", "Tempo di conservazione nel registro DVR",
+"DVR override: high", "Alta con prevalenza DVR",
+"DVR override: important", "Prevalenza DVR: importante",
+"DVR override: low", "Prevalenza DVR: bassa",
+"DVR override: normal", "Prevalenza DVR: normale",
+"DVR override: unimportant", "Prevalenza DVR: non importante",
+"DVR time record entry", "Voce di registrazione a tempo DVR",
+"Dance", "Danza",
+"Data errors", "Errori nei dati",
+"Days of Week", "Giorni della settimana",
+"Days of week", "Giorni della settimana",
+"Debate", "Dibattito",
+"Debug libav log", "Registro debug libav",
+"Debug log path", "Percorso registro di debug",
+"Debug options", "Opzioni di debug",
+"Debug subsystems", "Sottosistemi di debug",
+"Debug to syslog", "Debug su syslog",
+"Debug trace (low-level)", "Tracciatura di debug (basso livello)",
+"Default", "Predefinito",
+"Default language(s)", "Lingua/e predefinita/e",
+"Default priority", "Priorità predefinita",
+"Delivery system", "Sistema di consegna",
+"Demux path", "Percorso demux",
+"Descramble services (limit per mux)", "Servizi di decodifica (limite per mux)",
+"Descrambler buffer (TS packets)", "Buffer di decodifica (pacchetti TS)",
+"Description", "Descrizione",
+"Detective", "Poliziesco",
+"Device ID", "ID del dispositivo",
+"Device model", "Modello del dispositivo",
+"Device path", "Percorso del dispositivo",
+"Directory", "Cartella",
+"Directory permissions (octal, e.g. 0775)", "Permessi della cartella (ottale, per es. 0775)",
+"Disable", "Disabilita",
+"Disable DVB bouquets", "Disabilita pacchetti DVB",
+"Disable SAT>IP client", "Disabilita cliente SAT>IP",
+"Disable all access control checks", "Disabilita tutte le verifiche sui controlli d'accesso",
+"Disable debug on stderr", "Disabilita debug su stderr",
+"Disable device/firmware-specific workarounds", "Disabilita tutti gli espedienti specifici a dispositivo/firmware",
+"Disable syslog (all messages)", "Disabilita syslog (tutti i messaggi)",
+"Disabled", "Disabilitato",
+"Discussion", "Dibattito",
+"DiseqC repeats", "Ripetizioni DiseqC",
+"DiseqC rotor", "Rotore DiseqC",
+"DiseqC switch", "Commutatore DiseqC",
+"Do not use", "Non utilizzare",
+"Documentary", "Documentario",
+"Don't backup configuration tree at upgrade", "Non effettuare copia di riserva dell'albero di configurazione nei passaggi di versione",
+"Don't include title in filename", "Non includere il titolo nel nome del file",
+"Don't keep", "Non mantenere",
+"Don't re-record", "Non ri-registrare",
+"Don't reschedule", "Non ripetere",
+"Drama", "Drammatico",
+"Duplicate handling", "Gestione dei duplicati",
+"EIT - skip TSID check", "EIT - salta controllo TSID",
+"EPG grabber", "Estrattore EPG",
+"EPG grabber channel", "Canale dell'estrattore EPG",
+"EPG grabber configuration", "Configurazione dell'estrazione EPG",
+"EPG name", "Nome EPG",
+"EPG scan", "Scansione EPG",
+"EPG scan timeout in seconds (30-7200)", "Pausa della scansione EPG in secondi (30-7200)",
+"EPG source", "Sorgente EPG",
+"EPG update window", "Finestra di aggiornamento EPG",
+"Economics", "Economia",
+"Education", "Educazione",
+"Educational", "Educativo",
+"Elementary stream filter", "Filtro dello stream elementare",
+"Enable (auto)", "Abilita (automatico)",
+"Enable DBus", "Abilita DBus",
+"Enable NTP driver", "Abilita driver NTP",
+"Enable coredumps for daemon", "Abilita coredump per demone",
+"Enable debug on stderr", "Abilita debug su stderr",
+"Enable debug subsystems", "Abilita sottosistemi di debug",
+"Enable debug to file", "Abilita debug su file",
+"Enable debug to syslog", "Abilita debug su syslog",
+"Enable syslog", "Abilita syslog",
+"Enable trace subsystems", "Abilita sottosistemi di tracciatura",
+"Enable web UI debug (non-minified JS)", "Abilita debug della web UI (JS non minimizzato)",
+"Enabled", "Abilitato",
+"Encrypted", "Cifrato",
+"Encrypted service", "Servizio cifrato",
+"Entertainment programs for 10 to 16", "Trasmissione di intrattenimento da 10 a 16 anni",
+"Entertainment programs for 6 to 14", "Trasmissione di intrattenimento da 6 a 14 anni",
+"Environment", "Ambiente",
+"Environment (pipe)", "Ambiente (pipe)",
+"Episode", "Episodio",
+"Episode %d", "Episodio %d",
+"Error code", "Codice di errore",
+"Errors", "Errori",
+"Even key", "Chiave pari",
+"Every day", "Ogni giorno",
+"Exclude channel tags", "Escludi le etichette dei canali",
+"Expeditions", "Spedizioni",
+"Experimental film", "Film sperimentali",
+"Expert", "Esperto",
+"Exported tuners", "Sintonizzatori esportati",
+"External", "Esterno",
+"External EPG grabber", "Estrattore EPG esterno",
+"External IP (NAT)", "IP esterno (NAT)",
+"External URL", "URL esterno",
+"Extra arguments", "Argomenti supplementari",
+"Extra start time", "Tempo di inizio supplementare",
+"Extra stop time", "Tempo di termine supplementare",
+"Extra warming up time (seconds)", "Tempo supplementare di riscaldamento (secondi)",
+"FAIL", "FALLIMENTO",
+"FEC high", "FEC alto",
+"FEC low", "FEC basso",
+"Factual topics", "Tematiche fattuali",
+"Failed DVR", "DVR Fallito",
+"Fantasy", "Fantasia",
+"Fast input switch", "Commutazione veloce dell'ingresso",
+"File missing", "File mancante",
+"File not created", "File non creato",
+"File permissions (octal, e.g. 0664)", "Permessi del file (ottale, per es. 0664)",
+"File size", "Dimensione del file",
+"Filename", "Nome del file",
+"Filename character set", "Insieme dei caratteri per il nome del file",
+"Filename options", "Opzioni per il nome del file",
+"Fine arts", "Belle arti",
+"Finished", "Terminato",
+"Fitness and health", "Forma fisica e salute",
+"Folk", "Folclore",
+"Folkloric", "Folcloristico",
+"Football", "Calcio",
+"Force (auto)", "Forza (automatico)",
+"Force CA ID (e.g. 0x2600)", "Forza ID CA (per es. 0x2600)",
+"Force old status", "Forza vecchio stato",
+"Force pilot for DVB-S2", "Forza pilot per DVB-S2",
+"Force priority", "Forza priorità",
+"Force teardown delay", "Ritardo dell'abbattimento forzato",
+"Foreign countries", "Paesi stranieri",
+"Forever", "Per sempre",
+"Fork and run as daemon", "Separa ed esegui come demone",
+"Format string", "Stringa di formato",
+"Frequency", "Frequenza",
+"Frequency (Hz)", "Frequenza (Hz)",
+"Frequency (MHz)", "Frequenza (MHz)",
+"Frequency (kHz)", "Frequenza (kHz)",
+"Fri", "Ven",
+"Friendly name", "Nome descrittivo",
+"Frontend number", "Numero del frontend",
+"Frontend path", "Percorso del frontend",
+"Full DiseqC", "DiseqC pieno",
+"Full mux RX mode supported", "Modalità RX piena del mux supportata",
+"Full pathname specification", "Specifica del percorso completo",
+"Full-text", "Testo completo",
+"Further education", "Altri tipi educativi",
+"GOTOX position", "Posizione GOTOX",
+"GOTOX rotor", "Rotore GOTOX",
+"Game show", "Quiz televisivo",
+"Gardening", "Giardinaggio",
+"General", "Generale",
+"General configuration", "Configurazione generale",
+"Generic", "Generico",
+"Generic options", "Opzioni generiche",
+"Guard interval", "Intervallo di guardia",
+"HD: high definition", "HD: alta definizione",
+"HDHomeRun DVB frontend", "Frontend HDHomeRun DVB",
+"HDHomeRun DVB-C frontend", "Frontend HDHomeRun DVB-C",
+"HDHomeRun DVB-T frontend", "Frontend HDHomeRun DVB-T",
+"HTSP DVR", "DVR HTSP",
+"HTSP Default Stream Settings", "Impostazioni dello stream predefinito HTSP",
+"HTSP stream profile", "Profilo stream HTSP",
+"HTSP streaming", "Streaming HTSP",
+"HTTP CORS origin", "Origine HTTP CORS",
+"Handicraft", "Artigianato",
+"Hearing impaired", "Non udenti",
+"Hierarchy", "Gerarchia",
+"High", "Alto",
+"High bitrate mode (CI+ CAMs only)", "Modalità ad alto bitrate (solo CAM CI+)",
+"Historical movie", "Film storici",
+"Horror", "Orrore",
+"Hostname/IP", "Nome della macchina/IP",
+"IDLE", "INATTIVO",
+"IP address", "Indirizzo IP",
+"IP blocking", "Blocco IP",
+"IPTV Multiplex", "Multiplex IPTV",
+"IPTV automatic network", "Rete IPTV automatica",
+"IPTV input", "Ingresso IPTV",
+"IPTV network", "Rete IPTV",
+"ISI (Stream ID)", "ISI (ID Stream)",
+"Icon", "Icona",
+"Icon (full URL)", "Icona (URL completo)",
+"Icon URL", "URL dell'Icona",
+"Icon base URL", "URL di base icone",
+"Icon has title", "Icona ha un titolo",
+"Icons from", "Icone da",
+"Idle", "Inattivo",
+"Idle scan", "Scansione su inattività",
+"Idle scan muxes", "Scansione su inattività dei mux",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Se non esiste ancora un account per utente allora\ncreane uno senza nome utente e senza password.\nUtilizzalo con cautela poiché esso permetterà a\nchiunque di avere un accesso di tipo amministrativo \ndella tua installazione Tvheadend finché non creerai o\nmodificherai il controllo d'accesso dall'interno\ndell'interfaccia web di Tvheadend.",
+"If you'd like to support the project, please consider a donation.", "Se volessi supportare il progetto, per piacere considera l'idea di una donazione.",
+"Ignore EPG (EIT)", "Ignora EPG (EIT)",
+"Ignore descriptor 5", "Ignora descrittore 5",
+"Ignore invalid SSL certificate", "Ignora certificati SSL non validi",
+"Ignore provider's channel numbers", "Ignora i numeri di canale del fornitore",
+"Image cache", "Cache delle immagini",
+"Immediately abort", "Abortisci immediatamente",
+"Important", "Importante",
+"Include channel name in filename", "Includi il nome del canale del nome del file",
+"Include date in filename", "Includi la data nel nome del file",
+"Include episode in filename", "Includi l'episodio nel nome del file",
+"Include subtitle in filename", "Includi il sottotitolo nel nome del file",
+"Include time in filename", "Includi l'orario nel nome del file",
+"Index", "Indice",
+"Information area", "Area informativa",
+"Informational", "Informativo",
+"Initial scan", "Scansione iniziale",
+"Input base", "Base dell'ingresso",
+"Input buffer (bytes)", "Buffer d'ingresso (byte)",
+"Input instance", "Istanza d'ingresso",
+"Input path", "Percorso d'ingresso",
+"Interface", "Interfaccia",
+"Internal", "Interno",
+"Internal EPG grabber", "Estrattore EPG interno",
+"Internal grabber", "Estrattore interno",
+"Interview", "Intervista",
+"Invalid", "Non valido",
+"Invalid adapter number '%s'\n", "Adattatore numero '%s' non valido\n",
+"Invalid target", "Obiettivo non valido",
+"Keep", "Mantieni",
+"Kill signal (pipe)", "Segnale kill (pipe)",
+"Kill timeout (pipe/secs)", "Pausa kill (pipe/sec)",
+"LNA (low noise amplifier)", "LNA (amplificatore a basso rumore)",
+"LNB type", "Tipo LNB",
+"Language", "Lingua",
+"Language 1", "Lingua 1",
+"Language 2", "Lingua 2",
+"Language 3", "Lingua 3",
+"Language settings", "Impostazioni per la lingua",
+"Languages", "Lingue",
+"Last seen", "Visto ultima volta",
+"Last updated from", "Ultimo aggiornamento da",
+"Leisure hobbies", "Passatempi per il tempo libero",
+"Limit connections", "Limite delle connessioni",
+"Linked input", "Ingresso collegato",
+"Linux DVB CA", "CA DVB Linux",
+"Linux DVB frontend", "Frontend DVB Linux",
+"Linux DVB-C frontend", "Frontend DVB-C Linux",
+"Linux DVB-S frontend", "Frontend DVB-S Linux",
+"Linux DVB-S slave frontend", "Frontend DVB-S Linux secondario",
+"Linux DVB-T frontend", "Frontend DVB-T Linux",
+"LinuxDVB adapter", "Adattatore LinuxDVB",
+"LinuxDVB network", "Rete LinuxDVB",
+"Listen / Connect port", "Porta di ascolto/connessione",
+"Listen on IPv6", "Ascolta su IPv6",
+"Literature", "Letteratura",
+"Local bind IP address", "Indirizzo IP di collegamento locale",
+"Local channel minor", "Minore locale del canale",
+"Local channel number", "Numero locale del canale",
+"Local discovery IP address", "Scoperta locale dell'indirizzo IP",
+"Location", "Locazione",
+"Lock preferred CA PID", "Blocca PID CA preferito",
+"Log", "Registra",
+"Login/Logout", "Entrata/Uscita",
+"Low", "Basso",
+"MPEG-TS Pass-thru", "Pass-thru MPEG-TS",
+"MPEG-TS Pass-thru/built-in", "Pass-thru/built-in MPEG-TS",
+"MPEG-TS input", "Ingresso MPEG-TS",
+"MPEG-TS multiplex", "Multiplex MPEG-TS",
+"MPEG-TS multiplex PHY", "Multiplex PHY MPEG-TS",
+"MPEG-TS network", "Rete MPEG-TS",
+"MPEG-TS raw service", "Servizio grezzo MPEG-TS",
+"MPEG-TS service", "Servizio MPEG-TS",
+"Magazines", "Riviste",
+"Maintained space", "Spazio mantenuto",
+"Make subdirectories per channel", "Crea sottocartelle per canale",
+"Make subdirectories per day", "Crea sottocartelle per giorno",
+"Make subdirectories per title", "Crea sottocartelle per titolo",
+"Manufacturer", "Produttore",
+"Manufacturer URL", "URL del produttore",
+"Map radio channels", "Mappa i canali radio",
+"Map unnamed channels", "Mappa canali senza nome",
+"Map zero-numbered channels", "Mappa canali con numerazione nulla",
+"Master tuner", "Sintonizzatore principale",
+"Matroska specific", "Specifiche Matroska",
+"Maximal channel number", "Numero massimo del canale",
+"Maximum # input streams", "Numero massimo di stream in ingresso",
+"Maximum PIDs", "Numero massimo di PID",
+"Maximum RAM size (MB)", "Dimensione massima RAM (MB)",
+"Maximum bandwidth (Kbps)", "Ampiezza di banda massima (Kbps)",
+"Maximum count (0=default)", "Conteggio massimo (0=predefinito)",
+"Maximum duration", "Durata massima",
+"Maximum length of PIDs", "Massima lunghezza dei PID",
+"Maximum period (mins)", "Periodo massimo (minuti)",
+"Maximum schedules limit (0=default)", "Limite massimo pianificazioni (0=predefinito)",
+"Maximum size (MB)", "Dimensione massima (MB)",
+"Maximum timeout (seconds)", "Pausa massima (secondi)",
+"Medicine", "Medicina",
+"Melodrama", "Melodramma",
+"Minimal channel number", "Numero minimo del canale",
+"Minimum duration", "Durata minima",
+"Minimum rotor time (seconds)", "Tempo minimo del rotore (secondi)",
+"Missing In PAT/SDT", "Mancante in PAT/SDT",
+"Mode", "Modalità",
+"Model description", "Descrizione del modello",
+"Model name", "Nome del modello",
+"Model number", "Numero del modello",
+"Modulation", "Modulazione",
+"Module", "Modulo",
+"Module ID", "ID del modello",
+"Mon", "Lun",
+"More verbose libav log", "Registro più dettagliato di libav",
+"Motor rate (milliseconds/deg)", "Rapporto del motore (ms/grado)",
+"Motor sport", "Sport di motori",
+"Motoring", "Motoristico",
+"Movie", "Film",
+"Music", "Musica",
+"Mux UUID", "UUID del mux",
+"Mux handling", "Gestione dei mux",
+"Mux name", "Nome del mux",
+"Mux not enabled", "Mux non abilitato",
+"Mux schedule entry", "Voce del pianificatore dei mux",
+"NONE", "NESSUNO",
+"Name", "Nome",
+"Names", "Nomi",
+"Natural sciences", "Scienze naturali",
+"Nature", "Natura",
+"Network", "Rete",
+"Network A", "Rete A",
+"Network B", "Rete B",
+"Network ID (limit scanning)", "ID di rete (limitare scansione)",
+"Network UUID", "UUID della Rete",
+"Network discovery", "Scoperta rete",
+"Network name", "Nome della rete",
+"Network prefix", "Prefisso della rete",
+"Network type", "Tipo della rete",
+"Networks", "Reti",
+"News", "Notizie",
+"News magazine", "Rivista di attualità",
+"Next tune delay in ms (0-2000)", "Ritardo prossima sintonia in ms (0-2000)",
+"No PIN", "Nessun PIN",
+"No access", "Nessun accesso",
+"No adapters specified!\n", "Nessun adattatore specificato!\n",
+"No assigned adapters", "Adattatori non assegnati",
+"No days", "Nessun giorno",
+"No descrambler", "Nessun decodificatore",
+"No free adapter", "Nessun adattatore disponibile",
+"No input detected", "Nessun ingresso rilevato",
+"No service assigned to channel", "Nessun servizio assegnato al canale",
+"No service enabled", "Nessun servizio abilitato",
+"No source available", "Nessuna sorgente disponibile",
+"None", "Nessuno",
+"Normal", "Normale",
+"Not linked", "Non collegato",
+"Not set", "Non impostato",
+"Not set (none or channel configuration)", "Non impostato (nessuno o configurazione di canale)",
+"Not set (use channel or DVR configuration)", "Non impostato (usa configurazione di canale o DVR)",
+"Number", "Numero",
+"Number of tsfile tuners", "Numero di sintonizzatori tsfile",
+"OK (partial)", "OK (parziale)",
+"OSCam new pc-nodmx (rev >= 10389)", "OSCam nuovo pc-nodmx (rev >= 10389)",
+"Odd key", "Chiave dispari",
+"Off", "Spento",
+"Older OSCam", "OSCam più vecchie",
+"On", "Acceso",
+"On file removal", "Su rimozione del file",
+"Only Bulsatcom 39E", "Solo Bulsatcom 39E",
+"Only EIT", "Solo EIT",
+"Only OpenTV Sky Ausat", "Solo OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Solo OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Solo OpenTV Sky UK",
+"Only PSIP (ATSC)", "Solo PSIP (ATSC)",
+"Only UK Freesat", "Solo UK Freesat",
+"Only UK Freeview", "Solo UK Freeview",
+"Only Viasat Baltic", "Solo Viasat Baltic",
+"Only preferred CA PID", "Solo il PID CA preferito",
+"OpenTV channel number", "Numero OpenTV del canale",
+"Orbital position", "Posizione orbitale",
+"Orbital positions", "Posizioni orbitali",
+"Original network ID", "ID originale della rete",
+"Other stream filter", "Altro filtro stream",
+"Output directory for tsdebug", "Cartella di uscita per tsdebug",
+"Over-the-air Cron multi-line", "Cronologia multi-linea over-the-air",
+"Over-the-air EPG", "EPG over-the-air",
+"Over-the-air EPG grabber", "Estrattore EPG over-the-air",
+"Over-the-air grabbers", "Estrattori over-the-air",
+"Owner", "Proprietario",
+"PEND", "IN ATTESA",
+"PIDs 21 in setup", "PID 21 nell'impostazione",
+"PIDs in setup", "PID nell'impostazione",
+"PIN inquiry match string", "Stringa corrispondente alla richiesta PIN",
+"PLP ID", "ID PLP",
+"PLS code", "Codice PLS",
+"PLS mode", "Modalità PLS",
+"Parent entry", "Voce genitore",
+"Passwords", "Password",
+"Path", "Percorso",
+"Performing arts", "Arti dello spettacolo",
+"Periodically save EPG to disk (hours)", "Salvataggio periodico dell'EPG su disco (ore)",
+"Persistent user interface level", "Livello dell'interfaccia utente persistente",
+"Physiology", "Fisiologia",
+"Picon path (see Help)", "Percorso picon (vedi Aiuto)",
+"Polarization", "Polarizzazione",
+"Political issues", "Questioni politiche",
+"Popular culture", "Cultura popolare",
+"Port", "Porta",
+"Position", "Posizione",
+"Post-processor command", "Comando di post-processamento",
+"Post-recording padding", "Riempimento post-registrazione",
+"Post-remove command", "Comando di post-rimozione",
+"Power save", "Risparmio energetico",
+"Power-up time (ms) (15-200)", "Tempo di accensione (ms) (15-200)",
+"Pre-defined muxes", "Mux predefiniti",
+"Pre-recording padding", "Riempimento pre-registrazione",
+"Pre-school children's programs", "Trasmissione per bambini pre-scolari",
+"Prefer picons over channel name", "Preferisci picon al nome del canale",
+"Preferred CA PID", "PID CA preferito",
+"Preferred service video type", "Tipo predefinito del servizio video",
+"Presentation", "Presentazione",
+"Press", "Stampa",
+"Priority", "Priorità",
+"Priority (-10..10)", "Priorità (-10..10)",
+"Private", "Privato",
+"Profile name", "Nome del profilo",
+"Provider", "Fornitore",
+"Provider ID", "ID del fornitore",
+"Provider network name", "Nome della rete del fornitore",
+"Psychology", "Psicologia",
+"Puppets", "Pupazzi",
+"Quad (4.0)", "Quadrifonia (4.0)",
+"RAM only", "Solo su RAM",
+"RTSP port", "Porta RTSP",
+"RTSP port (554 or 9983, 0 = disable)", "Porta RTSP (554 o 9983, 0 = disabilita)",
+"RTSP/TCP (embedded data)", "RTSP/TCP (dati incorporati)",
+"Re-fetch period (hours)", "Periodo di ri-estrazione (ore)",
+"Re-fetch period (mins)", "Periodo di ri-estrazione (minuti)",
+"Re-record%s%s", "Ri-registrazione%s%s",
+"Re-try period (hours)", "Periodo di riprova (ore)",
+"Record all", "Registra tutto",
+"Recording file options", "Opzioni per file di registrazione",
+"Recording system path", "Percorso di sistema per la registrazione",
+"Reject", "Rigetta",
+"Religion", "Religione",
+"Religious", "Religioso",
+"Remarkable people", "Celebrità",
+"Remove HTTP arguments", "Rimuovi argomenti HTTP",
+"Remove all unsafe characters from filename", "Rimuovi tutti i caratteri non sicuri dal nome del file",
+"Replace whitespace in title with '-'", "Rimpiazza gli spazi nel titolo con '-'",
+"Reply to CAM PIN inquiries", "Risposta alle richieste PIN CAM",
+"Reports", "Inchieste",
+"Rerun of", "Riesecuzione di",
+"Rescan", "Riscansione",
+"Reserved", "Riservato",
+"Resolution (height)", "Risoluzione (altezza)",
+"Respawn (pipe)", "Rigenerazione (pipe)",
+"Restart on error", "Riavvia su errore",
+"Reuse EPG from", "Riutilizza EPG da",
+"Rewrite EIT", "Riscrivi EIT",
+"Rewrite MPEG-TS SI tables", "Riscrivi tabelle MPEG-TS SI",
+"Rewrite PAT", "Riscrivi PAT",
+"Rewrite PMT", "Riscrivi PMT",
+"Rewrite SDT", "Riscrivi SDT",
+"Romance", "Romanzo",
+"Rotor initialization time (seconds)", "Tempo di inizializzazione del rotore (secondi)",
+"Rotor type", "Tipo di rotore",
+"Run as group", "Esegui come gruppo",
+"Run as user", "Esegui come utente",
+"Running", "In esecuzione",
+"SAT>IP DVB frontend", "Frontend SAT>IP DVB",
+"SAT>IP DVB-C frontend", "Frontend SAT>IP DVB-C",
+"SAT>IP DVB-S frontend", "Frontend SAT>IP DVB-S",
+"SAT>IP DVB-S slave frontend", "Frontend secondario SAT>IP DVB-S",
+"SAT>IP DVB-T frequency (Hz)", "Frequenza SAT>IP DVB-T (Hz)",
+"SAT>IP DVB-T frontend", "Frontend SAT>IP DVB-T",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "Numero di porta SAT>IP RTSP per il server\n(predefinito: -1 = disabilitato, 0 = webconfig, porta standard è 554)",
+"SAT>IP client", "Cliente SAT>IP",
+"SAT>IP server", "Server SAT>IP",
+"SAT>IP source number", "Numero sorgente SAT>IP",
+"SD: standard definition", "SD: definizione standard",
+"SSL verify peer", "Verifica SSL del pari",
+"Sat", "Sab",
+"Satellite config", "Configurazione satellite",
+"Satellite longitude", "Longitudine del satellite",
+"Satellite positions", "Posizioni dei satelliti",
+"Scan after creation", "Scansiona dopo la creazione",
+"Scan queue length", "Lunghezza della coda di scansione",
+"Scan result", "Risultato della scansione",
+"Scan status", "Stato della scansione",
+"Schedule a re-recording if more errors than (0=off)", "Pianifica una ri-registrazione se più errori di (0=spento)",
+"Schedule status", "Stato della programmazione",
+"Scheduled for recording", "Programmazione per registrazione",
+"Scheduled start time", "Orario di inizio della programmazione",
+"Scheduled stop time", "Orario di termine della trasmissione",
+"School programs", "Trasmissione per la scuola",
+"Science", "Scienza",
+"Science fiction", "Fantascienza",
+"Season", "Stagione",
+"Season %d", "Stagione %d",
+"Send CAPMT query", "Invia richiesta CAPMT",
+"Send full PLAY cmd", "Invia comando PLAY completo",
+"Serial number", "Numero seriale",
+"Series link", "Collegamento della serie",
+"Serious", "Serio",
+"Serious music", "Musica tradizionale",
+"Server UUID", "UUID del server",
+"Server connectivity", "Connettività del server",
+"Server details.", "Dettagli server.",
+"Service", "Servizio",
+"Service ID", "ID del servizio",
+"Service configuration", "Configurazione del servizio",
+"Service count %zi", "Conteggio dei servizi %zi",
+"Service name", "Nome del servizio",
+"Service raw", "Servizio grezzo",
+"Service type", "Tipo di servizio",
+"Services", "Servizi",
+"Settings", "Impostazioni",
+"Show", "Spettacolo",
+"Show this page", "Mostra questa pagina",
+"Show version information", "Mostra informazione di versione",
+"Signal quality too poor", "Qualità del segnale troppo bassa",
+"Signal scale (240 or 100)", "Scala di segnale (240 o 100)",
+"Site latitude", "Latitudine del sito",
+"Site longitude", "Longitudine del sito",
+"Skip TS packets (0-200)", "Salta pacchetti TS (0-200)",
+"Skip commercials", "Salta la pubblicità",
+"Skip initial bytes", "Salta byte iniziali",
+"Skip initial scan", "Salta la scansione iniziale",
+"Slave entry", "Voce secondaria",
+"Slot state", "Stato della posizione",
+"Soap", "Telenovela",
+"Soccer", "Calcio",
+"Social", "Sociale",
+"Social advisory", "Avvertenza sociale",
+"Sort index", "Indice di ordinamento",
+"Source", "Sorgente",
+"Source deleted", "Sorgente cancellata",
+"Source quality is bad", "La qualità della sorgente è pessima",
+"Source reconfigured", "Sorgente riconfigurata",
+"Southern hemisphere (latitude direction)", "Emisfero meridionale (direzione della latitudine)",
+"Special events (Olympic Games, World Cup, etc.)", "Eventi speciali (Giochi Olimpici, Coppa del Mondo, ecc.)",
+"Specify User-Agent header for the http client", "Specifica l'intestazione User-Agent per il cliente http",
+"Specify alternative htsp port", "Specifica porta htsp alternativa",
+"Specify alternative http port", "Specifica porta http alternativa",
+"Specify alternative http webroot", "Specifica radice web http alternativa",
+"Specify bind address", "Specifica l'indirizzo di collegamento",
+"Specify extra htsp port", "Specifica la porta supplementare htsp",
+"Spiritual sciences", "Scienza spirituale",
+"Sports", "Sport",
+"Sports magazines", "Rivista sportiva",
+"Standard", "Predefinito",
+"Start", "Inizio",
+"Start after", "Inizia dopo",
+"Start before", "Inizia prima",
+"Start time", "Orario di inizio",
+"Status", "Stato",
+"Status period (ms)", "Periodo di stato (ms)",
+"Stop", "Termine",
+"Stop time", "Orario di termine",
+"Storage path", "Percorso di memorizzazione",
+"Storage space", "Spazio di memorizzazione",
+"Stream index", "Indice dello stream",
+"Stream profile", "Profilo dello stream",
+"Stream type", "Tipo dello stream",
+"Streaming priority", "Priorità di streaming",
+"Streaming profiles", "Profili di streaming",
+"Subdirectory options", "Opzione delle sottocartelle",
+"Subscribe to a service permanently", "Sottoscrivi un servizio in modo permanente",
+"Subscription overridden", "Sottoscrizione esclusa",
+"Subscription weight", "Peso della sottoscrizione",
+"Substitute formatters", "Sostituisci i formattatori",
+"Subtitle", "Sottotitolo",
+"Subtitle codec", "Codec sottotitolo",
+"Subtitle stream filter", "Filtro dello stream sottotitolo",
+"Sun", "Dom",
+"Surround (2 front, rear mono)", "Surround (2 frontali, mono posteriore)",
+"Switch before rotor", "Commuta prima di ruotare",
+"Switch type", "Tipo del commutatore",
+"Switch: %s", "Commutatore: %s",
+"Sync", "Sincronizza",
+"Sync + Don't keep", "Sincronizza + Non Mantenere",
+"System", "Sistema",
+"Tag files with metadata", "Etichetta i file con i metadati",
+"Tags", "Etichette",
+"Team sports (excluding football)", "Sport a squadre (escluso il calcio)",
+"Technology", "Tecnologia",
+"Teletext stream filter", "Filtro dello stream televideo",
+"Testing", "Controllo",
+"Testing options", "Opzioni di prova",
+"The PIN to use.", "Il PIN da utilizzare.",
+"This tuner", "Questo sintonizzatore",
+"Thu", "Gio",
+"Time", "Orario",
+"Time missed", "Orario mancato",
+"Time record caption", "Didascalia della registrazione a tempo",
+"Time recording%s%s", "Orario di registrazione%s%s",
+"Time update", "Aggiornamento dell'orario",
+"Timeout (sec) (0=infinite)", "Pausa (sec) (0=infinito)",
+"Timeout (seconds)", "Pausa (secondi)",
+"Timout (secs)", "Sospensione (secondi)",
+"Title", "Titolo",
+"Title (regexp)", "Titolo (regexp)",
+"Toggle details", "Attiva dettagli",
+"Tone burst", "Impulso del tono",
+"Tourism / Travel", "Turismo / Viaggi",
+"Trace subsystems", "Sottosistemi di tracciatura",
+"Traditional arts", "Arti tradizionali",
+"Traditional music", "Musica tradizionale",
+"Transcoding", "Transcodifica",
+"Transmission mode", "Modalità di trasmissione",
+"Transponder ID", "ID del transponder",
+"Transport stream ID", "ID dello stream di trasporto",
+"Tue", "Mar",
+"Tune before DiseqC", "Sintonizza prima di DiseqC",
+"Tuner bind IP address", "Indirizzo IP di collegamento del sintonizzatore",
+"Tuner configuration", "Configurazione del sintonizzatore",
+"Tuning failed", "Sintonia fallita",
+"Turn off LNB when idle", "Spegni LNB quando inattivo",
+"Tvheadend server name", "Nome del server Tvheadend",
+"Type", "Tipo",
+"UDP RTP port number (2 ports)", "Numero di porta UDP RTP (2 porte)",
+"URL with the SAT>IP server XML location", "URL con locazione XML del server SAT>IP",
+"USALS rotor", "Rotore USUALS",
+"UTC+ 1", "UTC+1",
+"UTC+ 2", "UTC+2",
+"UTC+ 3", "UTC+3",
+"UTC+ 4", "UTC+4",
+"UTC+ 4:30", "UTC+4:30",
+"UTC+ 5", "UTC+5",
+"UTC+ 5:30", "UTC+5:30",
+"UTC+ 5:45", "UTC+5:45",
+"UTC+ 6", "UTC+6",
+"UTC+ 6:30", "UTC+6:30",
+"UTC+ 7", "UTC+7",
+"UTC+ 8", "UTC+8",
+"UTC+ 8:45", "UTC+8:45",
+"UTC+ 9", "UTC+9",
+"UTC+ 9:30", "UTC+9:30",
+"UTC- 1", "UTC-1",
+"UTC- 2", "UTC-2",
+"UTC- 2:30", "UTC-2:30",
+"UTC- 3", "UTC-3",
+"UTC- 3:30", "UTC-3:30",
+"UTC- 4", "UTC-4",
+"UTC- 4:30", "UTC-4:30",
+"UTC- 5", "UTC-5",
+"UTC- 6", "UTC-6",
+"UTC- 7", "UTC-7",
+"UTC- 8", "UTC-8",
+"UTC- 9", "UTC-9",
+"UTC- 9:30", "UTC-9:30",
+"Uncommitted", "Non vincolato",
+"Uncommitted first", "Prima non vincolato",
+"Unicable switch (universal LNB, experimental)", "Commutatore unicable (LNB universale, sperimentale)",
+"Unicable type", "Tipo unicable",
+"Unimportant", "Non importante",
+"Universal LNB only", "Solo LNB universale",
+"Unknown", "Sconosciuto",
+"Unknown file", "File sconosciuto",
+"Unknown reason (%i)", "Ragione sconosciuta (%i)",
+"Unlimited size", "Dimensione illimitata",
+"Unlimited time", "Durata illimitata",
+"Unset (default)", "Non impostato (predefinito)",
+"Update card (EMM)", "Aggiorna carta (EMM)",
+"Update channel icon", "Aggiorna icona del canale",
+"Update channel name", "Aggiorna nome del canale",
+"Update channel number", "Aggiorna numero del canale",
+"Update disabled", "Aggiornamento disabilitato",
+"Update time", "Aggiorna orario",
+"Update tolerance (ms)", "Tolleranza di aggiornamento (ms)",
+"Updated", "Aggiornato",
+"Usage: %s [OPTIONS]\n", "Utilizzo: %s [OPZIONI]\n",
+"Use EPG running state", "Utilizza lo stato di esecuzione EPG",
+"Use Windows-compatible filenames", "Utilizza nomi di file compatibili con Windows",
+"Use XSPF playlist instead of M3U", "Utilizza liste XSPF invece di quelle M3U",
+"Use original", "Usa l'originale",
+"Use service IDs as channel numbers", "Utilizza gli identificativi del servizio come numeri di canale",
+"User access error", "Errore di accesso dell'utente",
+"User icon", "Icona dell'utente",
+"User interface level", "Livello dell'interfaccia utente",
+"User language", "Lingua dell'utente",
+"User limit reached", "Limite dell'utente raggiunto",
+"Username", "Nome dell'utente",
+"Variety show", "Varietà",
+"Video bitrate (kb/s) (0=auto)", "Bitrate video (kb/s) (0=automatico)",
+"Video codec", "Codec video",
+"Video recorder", "Registratore video",
+"Video stream filter", "Filtro dello stream video",
+"Visually impaired commentary/audio description", "Commento per persone non vedenti",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV profilo H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV profilo H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV profilo VP8/Vorbis/WEBM",
+"Waiting for EPG running flag", "Sto aspettando il segnale di esecuzione EPG",
+"Waiting for program start", "Sto aspettando l'inizio della trasmissione",
+"Waiting for stream", "Sto aspettando lo stream",
+"War", "Guerra",
+"Water sport", "Sport d'acqua",
+"Weak stream", "Flusso debole",
+"Weather report", "Situazione meteo",
+"Web interface", "Interfaccia web",
+"Web interface language", "Lingua dell'interfaccia web",
+"Web user interface", "Interfaccia web utente",
+"Wed", "Mer",
+"Western hemisphere (latitude direction)", "Emisfero settentrionale (direzione della latitudine)",
+"Wrapper (capmt_ca.so)", "Adattatore (capmt_ca.so)",
+"Yes", "Si",
+"addpids/delpids supported", "addpids/delpids supportati",
+"hrs", "ore",
+"invalid option specified [%s]", "opzione non valida specificata [%s]",
+"min", "minuto",
+"mins", "minuti",
+"option %s requires a value", "l'opzione %s richiede un valore",
+"tsfile input (mux file)", "ingresso tsfile (file mux)",
+"tvhdhomerun client", "Cliente tvhdhomerun",
+NULL, NULL
+};
+
+static const char *tvh_locale_16[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nLai iegūtu vairāk informācijas, lūdzu, apmeklējiet tīmekļa vietni Tvheadend:\nhttps://tvheadend.org\n",
+"# Channels", "# Kanāli",
+"ACTIVE", "AKTĪVS",
+"ANY", "JEBKURŠ",
+"Aborted by user", "Lietotāja pārtraukts",
+"Access", "Piekļuve",
+"Action", "Darbība",
+"Any", "Jebkurš",
+"Build", "Būvējums",
+"Channel", "Kanāls",
+"Channels", "Kanāli",
+"Created", "Izveidots",
+"Creator", "Radītājs",
+"Default", "Noklusējums",
+"Disable", "Atspējot",
+"Enable (auto)", "Iespējot (auto)",
+"Enabled", "Iespējots",
+"Encrypted", "Šifrēts",
+"Errors", "Kļūdas",
+"FAIL", "NEIZDEVIES",
+"Filename", "Datnes nosaukums",
+"Fri", "Pk",
+"Immediately abort", "Nekavējoties pārtraukt",
+"Important", "Svarīgs",
+"Language", "Valoda",
+"Languages", "Valodas",
+"Mon", "Pirm",
+"Movie", "Filma",
+"Music", "Mūzika",
+"Musical", "Mūzikls",
+"NONE", "NAV",
+"Name", "Nosaukums",
+"Nature", "Daba",
+"Network", "Tīkls",
+"Network A", "Tīkls A",
+"Network B", "Tīkls B",
+"Networks", "Tīkli",
+"News", "Ziņas",
+"None", "Neviens",
+"Not set", "Nav iestatīts",
+"Number", "Numurs",
+"OK", "Labi",
+"Off", "Izslēgts",
+"On", "Ieslēgts",
+"Owner", "Īpašnieks",
+"Password", "Parole",
+"Password2", "Parole2",
+"Passwords", "Paroles",
+"Run as group", "Palaist kā grupa",
+"Run as user", "Palaist kā lietotājs",
+"Running", "Darbojas",
+"Sat", "Se",
+"Season", "Sezona",
+"Season %d", "Sezona %d",
+"Server", "Serveris",
+"Settings", "Iestatījumi",
+"Show", "Parādīt",
+"Show this page", "Parādīt šo lapu",
+"Source", "Avots",
+"Start", "Sākt",
+"Status", "Statuss",
+"Stop", "Apturēt",
+"Subtitle", "Subtitri",
+"Sun", "Sv",
+"Sync", "Sinhronizēt",
+"System", "Sistēma",
+"Tags", "Birkas",
+"Thu", "Cet",
+"Title", "Virsraksts",
+"Tue", "Otr",
+"Type", "Tips",
+"Unknown", "Nezināms",
+"Unknown reason (%i)", "Nezināms iemesls (%i)",
+"Username", "Lietotājvārds",
+"War", "Karš",
+"Wed", "Tr",
+"hrs", "st",
+"mins", "min",
+NULL, NULL
+};
+
+static const char *tvh_locale_17[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nVoor meer informatie kunt u de website van Tvheadend bezoeken:\nhttps://tvheadend.org\n",
+"# Channels", "# Kanalen",
+"# Mapped channels", "# Ingedeelde kanalen",
+"# Muxes", "# Muxen",
+"# Services", "# Diensten",
+"# Services seen", "# Diensten gezien",
+"# tune repeats", "Tune herhalingen",
+"(Default profile)", "(Standaard Profiel)",
+"1 day", "1 dag",
+"1 month", "1 maand",
+"1 year", "1 jaar",
+"2 months", "2 maanden",
+"2 weeks", "2 weken",
+"2 years", "2 jaar",
+"2-Port switch (universal LNB)", "2 poort switch (universele LNB)",
+"3 days", "3 dagen",
+"3 months", "3 maanden",
+"3 weeks", "3 weken",
+"3 years", "3 jaar",
+"4-Port switch (universal LNB)", "4 poort switch (universele LNB)",
+"5 days", "5 dagen",
+"6 months", "6 maanden",
+"A channel tag (e.g. a group of channels) to which this rule applies.", "Een kanaalkenmerk (bijv. een groep van kanalen) waarop de regel van toepassing is.",
+"AC-3 = descriptor 6", "AC-3 = indicator 6",
+"AC-3 detection", "AC-3 detectie",
+"ACTIVE", "ACTIEF",
+"ANY", "ELKE",
+"ATSC source ID", "ATSC bron ID",
+"ATSC-C network", "ATSC-C netwerk",
+"ATSC-T network", "ATSC-T netwerk",
+"AUTO", "Auto",
+"Aborted by user", "Afgebroken door gebruiker",
+"Accept remote subscription weight", "Accepteer abonnementsprioriteit",
+"Accept the remote subscription weight (from the SAT>IP client).", "Accepteer de abonnementsprioriteit (van SAT>IP client)",
+"Access", "Toegang",
+"Action", "Actie",
+"Adapter in use by another subscription", "Adapter is in gebruik door andere aanmelding",
+"Add file and line numbers to debug", "Voeg bestandsnaam en regelnummer toe aan debug",
+"Add the thread ID to debug", "Voeg thread ID toe aan debug",
+"Additional arguments to pass to the grabber.", "Extra attributen om door te geven aan de EPG-grabber",
+"Additional service names found in EPG data.", "Extra namen gevonden in EPG data voor dienst.",
+"Additional time (in seconds) in which to get the tuner ready for recording. This is useful for those with tuners that take some time to tune and/or send garbage data at the beginning. ", "Extra tijd (in seconden) om de tuner klaar te zetten voor opnemen. Dit is nuttig voor diegenen met tuners die tijd nodig hebben om te tunen of die verkeerde gegevens sturen in het begin.",
+"Admin", "Beheerder",
+"Admin password", "Wachtwoord beheerder",
+"Admin username", "Gebruikersnaam beheerder",
+"Administrator login", "Beheerder login",
+"Adult movie", "Volwassen film",
+"Advanced", "Geavanceerd",
+"Advanced (non-universal LNBs, rotors, etc.)", "Geavanceerd (niet universele schotels, rotors, etc)",
+"Advanced streaming", "Geavanceerde streaming",
+"Adventure", "Avontuur",
+"Advertisement / Shopping", "Reclame / Winkelen",
+"All (Streaming plus DVR)", "Allen (streaming en DVR)",
+"All DVR (rw)", "Alle DVR (rw)",
+"All characters that could possibly cause problems for filenaming will be replaced with an underscore. See Help for details.", "Alle karakters die een problemen in de bestandsnaam kunnen vormen zullen worden vervangen door een underscore. Zie help for meer details.",
+"All lower-case", "Alles kleine letters",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Alle vooruitgang wordt gebruikt om de server infrastructuur uit te breiden en om test apparatuur te kopen.",
+"All: Record if different description", "Alles: Opnemen als omschrijving anders is",
+"All: Record if different episode number", "Alles: Opnemen als het afleveringsnummer anders is",
+"All: Record if different subtitle", "Alles: Opnemen als ondertiteling anders is",
+"All: Record once per day", "Alles: Eenmalig per dag opnemen",
+"All: Record once per week", "Alles: Eenmalig per week opnemen",
+"Allow high bitrate mode (CI+ CAMs only).", "Sta hoge bitrade modus (alleen CI+ CAMSs) toe",
+"Allow idle scan tuning on this device.", "Sta rust scan tuning op dit apparaat toe.",
+"Allow the combined size of all timeshift buffers to potentially grow unbounded until your storage media runs out of space.", "Laat mogelijkerwijs toe dat de gecombineerde grootte van alle timeshift buffers onbegrensd groeit totdat de opslag media geen ruimte meer heeft.",
+"Allow the initial scan tuning on this device (scan when Tvheadend starts). See 'Skip Initial Scan' in the network settings for further details.", "Toestaan van begin scan tuning op dit apparaat (scan tijdens het starten van Tvheadend). Kijk bij \"overslaan van begin scan\" in de netwerk instellingen voor meer details.",
+"Allow the timeshift buffer to grow unbounded until your storage media runs out of space. Warning, enabling this option may cause your system to slow down or crash completely!", "Laat toe dat de timeshift buffer onbegrensd groeit totdat de opslag media geen ruimte meer heeft. Let op, het inschakelen van deze optie kan het systeem langzaam maken of compleet laten crashen.",
+"Allow to show the quick tips for the form fields.", "Toestaan van de snelle tips voor de formulier velden.",
+"Allow/disallow HTSP protocol streaming, e.g Kodi (via pvr.hts) or Movian.", "Toestaan/weigeren van HTSP protocol streaming, e.g. Kodi (via pvr.hts) of Movian.",
+"Allow/disallow HTTP streaming.", "Toestaan/weigeren van HTTP streaming.",
+"Allow/disallow access to DVR via the HTSP protocol.", "Toestaan/weigeren van toegang tot DVR via het HTSP protocol.",
+"Allow/disallow access to all failed DVR entries.", "Toestaan/weigeren van toegang tot alle gefaalde DVR items.",
+"Allow/disallow access to other users DVR entries (read only).", "Toestaan/weigeren van toegang tot DVR items van andere gebruikers (alleen lezen).",
+"Allow/disallow access to the 'Configuration' tab.", "Toestaan/weigeren van toegang tot de 'configuratie' tab.",
+"Allow/disallow access to video recorder functionality (including Autorecs).", "Toestaan/weigeren van toegang tot de video recorder functionaliteit (inclusief automatische opnames).",
+"Allow/disallow advanced http streaming, e.g, direct service or mux links.", "Toestaan/weigeren geavanceerde http streaming, e.g.g directe service of mux verwijzingen.",
+"Allow/disallow read/write access to other users' DVR entries.", "Toestaan/weigeren van lees/schrijf toegang tot de DVR items van andere gebruikers.",
+"Allow/disallow web interface access (this  includes access to the EPG).", "Toestaan/weigeren van toegang tot de web interface (dit is inclusief toegang tot de EPG).",
+"Allowed DVR profiles. This limits the profiles the user has access to.", "Toegestane DVR profielen. Dit beperkt de profielen waar de gebruiker toegang toe heeft.",
+"Allowed network", "Toegestaan netwerk",
+"Allowed networks", "Toegestane netwerken",
+"Alternate PID path", "Alternatief PID pad",
+"Alternate configuration path", "Alternatief configuratie pad",
+"Altitude (in meters).", "Hoogte (meters)",
+"Altitude (meters)", "Hoogte (meters)",
+"Always send the whole DiseqC sequence including LNB setup (voltage, tone). If this is not checked, only changed settings are sent, which may cause issues with some drivers. If the tuning is not reliable, try activating this option.", "Stuur altijd de volledige DiseqC reeks, inclusief instellen van LNB (voltage en tone). Als dit niet is aangezet worden alleen de veranderde instellingen doorgestuurd. Dit kan problemen veroorzaken met sommige drivers. Probeer deze optie te activeren als het tunen niet betrouwbaar is.",
+"Always use the old ioctls to read the linuxdvb status (signal strength, SNR, error counters). Some drivers are not mature enough to provide the correct values using the new v5 linuxdvb API.", "Gebruik altijd de oude ioctls manier om de status van linuxdvb uit te lezen (signaal sterkte, SNR, fout tellers). Sommige drivers zijn niet ver genoeg ontwikkeld om de juiste waardes aan te leveren volgens de nieuwe v5 linuxdvb API.",
+"An event which starts between this \"start after\" and \"start before\" will be matched (including boundary values).", "Een gebeurtenis die start tussen deze \"start na\" en \"start voor\" wordt vergeleken (inclusief de grenswaarden).",
+"Animals", "Dieren",
+"Anonymize HTSP access", "Anonimiseer HTSP toegang",
+"Any", "Elke",
+"Arts", "Kunst",
+"Assign predefined muxes to networks", "Wijs voorgedefinieerde muxen toe aan netwerken",
+"Associate this device with one or more networks.", "Verbind dit apparaat met een of meerdere netwerken.",
+"Athletics", "Atletiek",
+"Audio birate to use for transcoding.", "Te gebruiken audio bitrate voor transcoderen.",
+"Audio bitrate (kb/s) (0=auto)", "Audio Bitrate (kb/s) (0=Auto)",
+"Audio channel layout.", "Audio kanaal opmaak.",
+"Audio codec to use for the transcode. \"Do not use\" will disable audio output.", "Te gebruiken audio codec voor transcoderen. \"Niet gebruiken\" zal audio uitvoer uitschakelen.",
+"Audio language (Not currently used).", "Audio taal (Momenteel niet in gebruik).",
+"Auto check disabled", "Automatische check uitgeschakeld",
+"Auto check enabled", "Automatische check ingeschakeld",
+"Auto record", "Automatisch opnemen",
+"Auto record caption", "Onderschrift automatisch opnemen",
+"Auto recording%s%s", "Automatisch opnemen%s%s",
+"Auto time record", "Automatische tijd opname",
+"Auto-Map to channels", "Automatisch mappen naar kanalen",
+"Automatic checking", "Automatische controle",
+"Automatic recording caption.", "Onderschrift automatisch opnemen",
+"Automatic schedule entry not found", "Automatisch gepland item niet gevonden",
+"Automatic time scheduler entry not found", "Item van automatische tijd planner niet gevonden",
+"Automatically map EPG source", "EPG bronnen automatisch indelen",
+"Automatically map EPG source. Automatically link EPG data to the channel (using the channel name for matching). If you turn this option off, only the OTA EPG grabber will be used for this channel unless you've specifically set a different EPG Source.", "EPG bron automatisch indelen. Automatisch de EPG data verbinden met het kanaal (gebruik de kanaal naam voor het rangschikken). Als deze optie uitgezet wordt, dan wordt alleen de OTA EPG grabber gebruikt tenzij er specifiek een andere EPG bron wordt ingesteld.",
+"Automatically map all available services to channels.", "Deel alle diensten in kanalen in",
+"Automatically map channels defined within the bouquet.", "Deel de kanalen automatisch in zoals in het bouquet gedefinieerd.",
+"Automatically name from network", "Naam automatisch vanaf het netwerk",
+"Automatically name from network. Always use the name defined by the network.", "Naam automatisch vanaf het netwerk. Gebruik altijd de naam zoals gedefinieerd door het netwerk.",
+"Automatically record.", "Automatisch opnemen",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Werk de kanaal iconen automatisch bij op basis van de informatie zoals in de ingeschakelde EPG aanbieders. Let op: dit kan onverwachte veranderingen veroorzaken bij al gedefinieerde kanaal iconen.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Werk de kanaal namen automatisch bij op basis van de informatie zoals in de ingeschakelde EPG aanbieders. Let op: dit kan onverwachte veranderingen veroorzaken bij al gedefinieerde kanaal namen.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Werk de kanaal nummers automatisch bij op basis van de informatie zoals in de ingeschakelde EPG aanbieders. Let op: dit kan onverwachte veranderingen veroorzaken bij al gedefinieerde kanaal nummers.",
+"Autorec maximum count (0=unlimited)", "Maximaal aantal automatische opnames (0=ongelimiteerd)",
+"Autorec maximum schedules limit (0=unlimited)", "Maximaal aantal automatische opnames (0=ongelimiteerd)",
+"Bad", "Slecht",
+"Bad request", "Verkeerd verzoek",
+"Bandwidth", "Bandbreedte",
+"Based on software from", "Gebaseerd op software van",
+"Basic", "Basis",
+"Bind to specific local IP address.", "Koppel aan specifiek lokaal ip adres.",
+"Bitrate to use for the transcode. See Help for detailed information.", "Te gebruiken bitrate voor transcoderen. Kijk in help voor gedetailleerde informatie.",
+"Bouquet", "Groep",
+"Bouquet (auto)", "Groep (automatisch)",
+"Bouquet (auto). The bouquet the channel is associated with.", "Groep (automatisch). De groep waar het kanaal mee gekoppeld is.",
+"Bouquet source.", "Bouquet bron.",
+"Brand", "Merk",
+"Branding information (if available).", "Merk informatie (indien beschikbaar).",
+"Broadcast", "Uitzending",
+"Broadcast type", "Uitzendingtype",
+"Broadcast.", "Uitzenden",
+"Broadcasting", "Uitzenden",
+"Buffering limit (ms)", "Buffer limit (ms)",
+"By default, linuxdvb's status read period is 1000ms (one second). The accepted range is 250ms to 8000ms. Note that for some hardware or drivers (like USB), the status operations take too much time and CPU. In this case, increase the default value. For fast hardware, this value might be decreased to make the decision of the re-tune algorithm based on the signal status faster.", "De status van linuxdvb wordt standaard elke 1000ms (een seconde) ingelezen. Het geaccepteerde instel bereik is van 250ms tot 8000ms. Let op dat voor sommige hardware of drivers (zoals bijvoorbeeld USB), de status operaties teveel tijd en CPU verbruiken. In dit geval moet de standaard waarde verhoogd worden. Voor snelle hardware kan deze waarde verlaagd worden zodat het re-tune algoritme, wat met de signaal status werkt, sneller reageert.",
+"CA client %i", "CA Client %i",
+"CA identification", "CA Identificatie",
+"CA provider", "CA Aanbieder",
+"CAPMT interval (in ms).", "CAPMT Interval (ms)",
+"CAPMT interval (ms)", "CAPMT Interval (ms)",
+"CAPMT query interval (ms).", "CAPMT query Interval (ms)",
+"Cache scheme", "Cache schema",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket bestandsnaam / IP adres (TCP modus)",
+"Channel", "Kanaal",
+"Channel does not exist", "Kanaal bestaat niet",
+"Channel icon", "Kanaallogo",
+"Channel icon as defined in EPG data.", "Kanaallogo zoals gedefinieerd in EPG data.",
+"Channel icon name scheme", "Kanaallogo naam schema",
+"Channel icon path (see Help)", "Kanaal icoon pad (zie help)",
+"Channel mapping options", "Kanaal indeel opties",
+"Channel name", "Kanaalnaam",
+"Channel not found", "Kanaal niet gevonden",
+"Channel number", "Kanaal nummer",
+"Channel number as defined in EPG data.", "Kanaalnummer zoals gedefinieerd in EPG data.",
+"Channel number offset", "Kanaalnummer offset",
+"Channel numbers from", "Kanaal nummer vanaf",
+"Channel tag", "Kanaallabel",
+"Channel tag does not exist", "Kanaallabel bestaat niet",
+"Channel tag reference", "Kanaallabel referentie",
+"Channel tags", "Kanaallabels",
+"Channel tags the user is allowed access to/excluded from.", "Kanaallabels waar de gebruiker (geen) toegang toe heeft.",
+"Channel to use/used for the recording.", "Kanaal welke gebruikt/is wordt voor opname.",
+"Channels", "Kanalen",
+"Channels EPG data is used by.", "Kanalen waar EPG data door gebruikt wordt.",
+"Character set", "Karakterset",
+"Characters not supported in Windows filenames (e.g. for an SMB/CIFS share) will be stripped out or converted.", "Karakters die niet ondersteunt worden in Windows bestandsnamen (bijvoorbeeld bij een SMB/CIFS share) worden eruit gehaald of aangepast.",
+"Check availability", "Controleer beschikbaarheid",
+"Check for the services' presence. If the service is no longer broadcast this field will change to \"Missing In PAT/SDT\".", "Controleer de aanwezigheid van de services. Als deze niet langer een signaal uitzend veranderd dit veld in \"Missing In PAT/SDT\".",
+"Check service availability (add live services only).", "Controleer beschikbaarheid van dienst (voeg alleen live diensten toe).",
+"Children's / Youth programs", "Kinderen / Jeugd programma's",
+"Cinema", "Bioscoop",
+"Class", "Klasse",
+"Classical", "Klassiek",
+"Classical music", "Klassieke muziek",
+"Clean effects", "Geen effecten",
+"Client name", "Client naam",
+"Clone scheduled entry on error", "Gepland item klonen als het fout gaat",
+"Comedy", "Komedie",
+"Command delay time (ms) (10-200)", "Commando vertraging tijd (ms) (10-200)",
+"Command time (ms) (10-100)", "Commando tijd (ms) (10-100)",
+"Comment", "Commentaar",
+"Commercial break", "Reclame",
+"Commercials will be dropped from the recordings. At the moment, commercial detection only works for the Swedish channel TV4.", "Reclame wordt uit de opnames gelatebn. Op dit moment werkt reclame detectie alleen bij het Zweedse kanaal TV4.",
+"Completed OK", "Succesvol",
+"Compress EPG database", "Comprimeer EPG database",
+"Compress the EPG database to reduce disk I/O and space.", "Comprimeer de EPG database om disk ruimte te besparen en snelheid te verbeteren.",
+"Concurrent limit per network position (src=) for satellite SAT>IP tuners. The first limit number is for src=1 (AA), second for src=2 (AB) etc.", "Gelijktijdige limiet per netwerk positie (src=) voor satelliet SAT>IP tuners. Het eerste limiet nummer is voor src=1 (AA), de tweede voor src=2 (AB), enzovoorts.",
+"Configuration", "Configuratie",
+"Configuration ID", "Configuratie ID",
+"Configuration name", "Configuratie naam",
+"Configuration version", "Configuratie versie",
+"Connection limit type", "Connectie limiet type",
+"Constellation", "Stelsel",
+"Container to use for the transcoded stream.", "Container die gebruikt moet worden voor de getranscodeerde stream.",
+"Content character set", "Tekenset inhoud",
+"Content type", "Soort inhoud",
+"Content type.", "Soort inhoud.",
+"Contest", "Wedstrijd",
+"Continue even if descrambling fails", "Doorgaan, ook als descrambling fout gaat",
+"Continue recording for x minutes after scheduled stop time", "Opname door laten lopen x minuten na geplande stop tijd",
+"Continue recording for x minutes after scheduled stop time.", "Opname door laten lopen x minuten na geplande stop tijd.",
+"Cookie expiration (days)", "Cookie verlooptijd (dagen)",
+"Cooking", "Koken",
+"Copy codec type", "Kopieer codec type",
+"Copy layout", "Layout kopieren",
+"Create SDTV/HDTV/Radio tags.", "Maak SDTV/HDTV/Radio labels aan.",
+"Create a provider name tag.", "Maak een provider naam label aan.",
+"Create and associate a network tag to created channels.", "Maak een netwerk label aan en wijs deze toe aan de aangemaakte kanelen.",
+"Create and associate a provider tag to created channels.", "Maak een provider label aan en wijs deze toe aan de aangemaakte kanalen.",
+"Create bouquet", "Bouquet aanmaken",
+"Create bouquet tag", "Bouquet label aanmaken",
+"Create directories using these permissions.", "Maak directories aan met deze rechten.",
+"Create files using these permissions.", "Maak bestanden aan met deze rechten.",
+"Create network name tags", "Maak netwerk naam labels aan",
+"Create network name tags (set by provider).", "Maak netwerk naam labels aan (ingesteld door provider).",
+"Create network tags", "Maak netwerk labels aan",
+"Create provider name tags", "Maak provider naam labels aan",
+"Create provider tags", "Maak provider labels aan",
+"Create tags", "Maak labels aan",
+"Create tags in recordings using media containers that support metadata (if possible).", "Maak labels aan in opnames wanneer de media containers dit ondersteunen.",
+"Create type based tags", "Maak type gebaseerde labels aan",
+"Created", "Gemaakt",
+"Creator", "Gemaakt door",
+"Cron", "cron",
+"Cron multi-line", "Cron meerdere regels",
+"Culture (without music)", "Cultuur (zonder muziek)",
+"Current RTSP port.", "Huidige RTSP poort.",
+"Current affairs", "Lopende zaken",
+"Current tuner configuration.", "Huidige tuner configuratie.",
+"Custom HTTP headers", "Aangepaste HTTP headers",
+"DAB network", "DAB netwerk",
+"DBus - use the session message bus instead of the system one", "DBus - gebruik de sessie beheerders bus in plaats van de systeem bus",
+"DES key", "DES sleutel",
+"DSCP/TOS for streaming", "DSCP/TOS voor streaming",
+"DVB EPG ID", "DVB Electronische Programma Gids nummer",
+"DVB scan files", "DVB scan bestanden",
+"DVB scan files path", "DVB scan bestanden pad",
+"DVB-C network", "DVB-C netwerk",
+"DVB-S 4-port", "DVB-S 4-poort",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, experimenteel)",
+"DVB-S advanced", "DVB-S geavanceerd",
+"DVB-S network", "DVB-S netwerk",
+"DVB-S satellite configuration", "DVB-S satelliet configuratie",
+"DVB-T network", "DVB-T netwerk",
+"DVR Auto-record entry", "DVR Auto-opname item",
+"DVR behavior", "DVR gedrag",
+"DVR configuration", "DVR configuratie",
+"DVR configuration profile", "DVR configuratie profiel",
+"DVR configuration profiles", "DVR configuratie profielen",
+"DVR entry not found", "DVR item niet gevonden",
+"DVR file retention period", "DVR bestand bewaartermijn",
+"DVR log retention", "DVR log behoud",
+"DVR log retention period", "DVR log bewaartermijn",
+"DVR override: high", "DVR voorrang: hoog",
+"DVR override: important", "DVR voorrang: belangrijk",
+"DVR override: low", "DVR voorrang: laag",
+"DVR override: normal", "DVR voorrang: normaal",
+"DVR override: unimportant", "DVR voorrang: onbelangrijk",
+"DVR profile to use/used for the recording.", "DVR profiel gebruikt of te gebruiken voor opname.",
+"DVR schedule does not exist", "DVR planning bestaat niet",
+"DVR schedule does not have a file yet", "DVR planning heeft nog geen bestand",
+"DVR schedule not found", "DVR planning niet gevonden",
+"DVR time record entry", "DVR tijd opname item",
+"Dance", "Dans",
+"Data errors", "Data fouten",
+"Data path (if applicable).", "Data pad (indien van toepassing)",
+"Date the EPG data was last updated (not set for OTA grabbers).", "Datum wanneer de EPG data voor het laatst is bijgewerkt (niet ingesteld voor OTA grabbers).",
+"Days of Week", "Dagen van de week",
+"Days of the week to which the rule should apply.", "Dagen van de week waarop deze regel van toepassing moet zijn",
+"Days of week", "Dagen van de week",
+"Debate", "Debat",
+"Debug libav log", "Debug libav logboek",
+"Debug log path", "Debug logboek pad",
+"Debug options", "Debug opties",
+"Debug subsystems", "Debug subsystemen",
+"Debug to syslog", "Debug naar syslog",
+"Debug trace (low-level)", "Debug spoor (laag niveau)",
+"Default", "Standaard",
+"Default language(s)", "Standaard taal/talen",
+"Default language.", "Standaard taal",
+"Default priority", "Standaard prioriteit",
+"Default user interface level.", "Standaard gebruikers interface niveau",
+"Define network group to limit network usage.", "Definieer netwerk groep om gebruik te limiteren",
+"Delivery system", "Ontvangstsysteem",
+"Demux path", "Demux pad",
+"Descramble services (limit per mux)", "Descramble services (limiet per mux)",
+"Descrambler buffer (TS packets)", "Descramble buffer (TS pakketen)",
+"Description", "Omschrijving",
+"Device ID", "Apparaat ID",
+"Device model", "Apparaat model",
+"Device path", "Apparaat pad",
+"Directory permissions (octal, e.g. 0775)", "Directorie rechten (octaal, bijvoorbeeld 0775)",
+"Disable", "Uitschakelen",
+"Disable DVB bouquets", "Schakel DVB bouquets uit",
+"Disable SAT>IP client", "SAT>IP client uitzetten",
+"Disable all access control checks", "Schakel elke vorm van toegangscontrole uit",
+"Disable debug on stderr", "Schakel debug uit op stderr (standaard error)",
+"Disable device/firmware-specific workarounds", "Schakel apparaat/firmware specifieke oplossingen uit",
+"Disable syslog (all messages)", "Schakel syslog uit (alle berichten)",
+"Disabled", "Uitgeschakeld",
+"Discussion", "Discussie",
+"Do not use", "Niet gebruiken",
+"Documentary", "Documentaire",
+"Don't backup configuration tree at upgrade", "Maak geen backup van configuratie bij upgrade",
+"Don't include the title in the filename.", "Neem titel niet op in bestandsnaam",
+"Don't include title in filename", "Neem titel niet op in bestandsnaam",
+"Don't keep", "Niet houden",
+"Don't re-record", "Nieuw opnieuw opnemen",
+"Don't re-record if recording fails.", "Niet opnieuw opnemen als opname faalt",
+"Don't re-schedule if recording fails.", "Niet opnieuw inplannen als opname faalt.",
+"Don't reschedule", "Niet opnieuw inplannen",
+"Don't use the provider's channel numbers.", "Provider kanaal nummers niet gebruiken",
+"Duplicate handling", "Duplicaat afhandeling",
+"Duplicate recording handling.", "Opname duplicaat afhandeling",
+"EIT - skip TSID check", "EIT - TSID controle overslaan",
+"EIT time offset", "EIT tijd uitloop",
+"EPG Language (priority order)", "EPG taal (prioriteit volgorde)",
+"EPG grabber channel", "EPG grabber kanaal",
+"EPG grabber configuration", "EPG grabber configuratie",
+"EPG name", "EPG naam",
+"EPG scan timeout in seconds (30-7200)", "EPG scan timeout in secondes (30-7200)",
+"EPG source", "EPG bron",
+"EPG source. Name of the module, grabber or channel that should be used to update this channels EPG info.", "EPG bron. Naam van de module, grabber of het kanaal dat gebruit moet worden om de EPG informatie van dit kanaal bij te werken.",
+"EPG update window", "Venster om EPG bij te werken",
+"Economics", "Economie",
+"Education", "Scholing",
+"Educational", " Leerzaam",
+"Elementary stream filter", "Elementair stream filter",
+"Enable (auto)", "Aan (auto)",
+"Enable DBus", "Gebruik DBus",
+"Enable NTP driver", "NTP driver inschakelen",
+"Enable coredumps for daemon", "Gebruik coredumps voor de daemon",
+"Enable debug on stderr", "Debug op stderr",
+"Enable debug subsystems", "Debug van subsystemen",
+"Enable debug to file", "Debug naar bestand",
+"Enable debug to syslog", "Debug naar syslog",
+"Enable exclusion of user-config defined channel tags. This will prevent the user from accessing channels associated with the tags selected (below).", "Inschakelen van het uitzonderen van gedefinieerde kanaal labels in de gebruikers configuratie. Dit voorkomt dat de gebruiker toegang heeft tot kanalen die verbonden zijn met het geselecteerde label (hieronder). ",
+"Enable if the SAT>IP box requests plts=on parameter in the SETUP RTSP command for DVB-S2 muxes.", "Inschakelen als de SAT>IP box de plts=on parameter in het SETUP RTSP commando voor DVB-S2 muxen nodig heeft.",
+"Enable if the SAT>IP box requires pids=0 parameter in the SETUP RTSP command.", "Inschakelen als de SAT>IP box de pids=0 parameter in het SETUP RTSP commando nodig heeft.",
+"Enable if the SAT>IP box requires pids=21 parameter in the SETUP RTSP command", "Inschakelen als de SAT>IP box de pids=21 parameter in het SETUP RTSP commando nodig heeft.",
+"Enable if the SAT>IP box supports the addpids/delpids commands.", "Inschakelen als de SAT>IP box de addpids/delpids commando's ondersteunt.",
+"Enable or disable RTSP/TCP (embedded data) support.", "In- of uitschakelen van RTSP/TCP (embedded data) ondersteuning.",
+"Enable or disable fast input switching.", "In- of uitschakelen van snel omschakelen van input.",
+"Enable or disable full mux mode.", "In- of uitschakelen van full mux mode.",
+"Enable or disable ignoring of Event Information Table (EIT) data on this mux.", "In- of uitschakelen van het negeren van Event Information Table (EIT) data op deze mux.",
+"Enable or disable the mux.", "Deze mux in- of uitschakelen.",
+"Enable or disable this configuration.", "Deze configuratie in- of uitschakelen.",
+"Enable over-the-air program guide (EPG) scanning on this input device.", "Inschakelen van over-the-air programma gids (EPG) scannen op dit input apparaat.",
+"Enable syslog", "Syslog inschakelen.",
+"Enable this filter.", "Dit filter inschakelen.",
+"Enable trace subsystems", "Trace subsytemen",
+"Enable web UI debug (non-minified JS)", "Web UI debug inschakelen (niet verkleinde JS)",
+"Enable/disable EPG data for the entry.", "In- of uitschakelen van EPG data voor deze aanmelding.",
+"Enable/disable LNA.", "LNA in- of uitschakelen.",
+"Enable/disable auto-rec rule.", "Inschakelen/uitschakelen auto opname regel",
+"Enable/disable debugging output to syslog.", "Inschakelen/uitschakelen debugging output naar syslog",
+"Enable/disable libav log output.", "Inschakelen/uitschakelen libav log output",
+"Enable/disable logging to syslog.", "Inschakelen/uitschakelen logging naar syslog",
+"Enable/disable pilot tone.", "Inschakelen/uitschakelen pilot tone",
+"Enable/disable power save mode (if supported by the device).", "Inschakelen/uitschakelen stroom besparing modus (indien het apparaat dit ondersteunt).",
+"Enable/disable profile.", "Inschakelen/uitschakelen profiel.",
+"Enable/disable the bouquet.", "Inschakelen/uitschakelen dit bouquet.",
+"Enable/disable the channel.", "Inschakelen/uitschakelen dit kanaal.",
+"Enable/disable the device.", "Inschakelen/uitschakelen dit apparaat.",
+"Enable/disable the entry.", "Inschakelen/uitschakelen dit item.",
+"Enable/disable the grabber.", "Inschakelen/uitschakelen deze grabber.",
+"Enable/disable the profile.", "Inschakelen/uitschakelen dit profiel.",
+"Enable/disable the tag.", "Inschakelen/uitschakelen dit label.",
+"Enable/disable timeshift.", "Inschakelen/uitschakelen timeshift.",
+"Enable/disable tuner/adapter.", "Inschakelen/uitschakelen tuner/adapter.",
+"Enabled", "Aan",
+"Encrypted", "Versleuteld",
+"Encrypted service", "Versleutelde dienst",
+"Enter a filename you want to save the debug log to.", "Voer een bestandsnaam in waar de debug log in opgeslagen moet worden.",
+"Enter a non-admin user password.", "Voer een niet-beheerder gebruikers wachtwoord in.",
+"Enter a non-admin user username.", "Voer een niet-beheerder gebruikersnaam in.",
+"Enter allowed network prefix(es). You can enter a comma-seperated list of prefixes here.", "Voer toegestande netwerk prefix(en) in. U kan een kommagescheiden lijst van prefixen hier invoeren.",
+"Enter an administrator password.", "Voer een beheerders wachtwoord in.",
+"Enter an administrator username. Note: do not use the same username as the superuser backdoor account.", "Voer een beheerders gebruikersnaam in. Let op: gebruik niet dezelfde gebruikersnaam als de achterdeur hoofd gebruiker.",
+"Enter comma-separated list of subsystems you want debugging output for (e.g +linuxdvb,+subscriptions,+mpegts).", "Voer een kommagescheiden lijst van subsystemen in waar je debugging output voor wilt (bijv. +linuxdvb,+subscriptions,+mpegts).",
+"Enter comma-separated list of subsystems you want to get traces for (e.g +linuxdvb,+subscriptions,+mpegts).", "Voer een kommagescheiden lijst van subsystemen in waar je nadere informatie van wilt (bijv. +linuxdvb,+subscriptions,+mpegts).",
+"Enter external IP if behind Network address translation (NAT).", "Voer een extern IP in als je achter Netwerk Adres translatie bent (NAT).",
+"Entertainment programs for 10 to 16", "Amusements programma's voor 10 tot 16",
+"Entertainment programs for 6 to 14", "Amusements programma's voor 6 tot 14",
+"Environment", "Omgeving",
+"Environment (pipe)", "Omgeving (pipe)",
+"Episode", "Aflevering",
+"Episode %d", "Aflevering %d",
+"Episode number/ID.", "Aflevering nummer/ID.",
+"Error code", "Fout code",
+"Errors", "Fouten",
+"Even key", "Even sleutel",
+"Event does not exist", "Gebeurtenis bestaat niet",
+"Every day", "Elke dag",
+"Exclude channel tags", "Sluit kanaal labels uit",
+"Expeditions", "Expedities",
+"Experimental film", "Experimentele film",
+"Exported tuners", "Geëxporteerde tuners",
+"External", "Extern",
+"External EPG grabber", "Externe EPG grabber",
+"External IP (NAT)", "Extern IP (NAT)",
+"External URL", "Externe URL",
+"External URL of the bouquet.", "Externe URL van het bouquet",
+"Extra arguments", "Extra argumenten",
+"Extra start time", "Extra start tijd",
+"Extra stop time", "Extra stop tijd",
+"Extra warming up time (seconds)", "Extra opwarm tijd (seconden)",
+"FAIL", "FOUT",
+"FEC high", "FEC hoog",
+"FEC low", "FEC laag",
+"Factual topics", "Thema's",
+"Failed", "Mislukt",
+"Failed DVR", "Mislukte DVR",
+"Failed to open image", "Plaatje openen mislukt",
+"Fantasy", "Fantasie",
+"Fast input switch", "Snelle input switch",
+"File missing", "Bestand mist",
+"File not created", "Bestand niet aangemaakt",
+"File permissions (octal, e.g. 0664)", "Bestands rechten (octaal, bijv. 0664)",
+"File size", "Bestands groote",
+"Filename", "Bestandsnaam",
+"Filename character set", "Bestandsnaam karakter set",
+"Filename options", "Bestandsnaam opties",
+"Fine arts", "Beeldende kunst",
+"Finished", "Afgelopen",
+"Fit to RAM (cut rewind)", "Passend in RAM (terugspoelen afsnijden)",
+"Fitness and health", "Sport en gezondheid",
+"Folkloric", "Folkloristisch",
+"Football", "Voetbal",
+"Force (auto)", "Forceer (automatisch)",
+"Force CA ID (e.g. 0x2600)", "Forceer CA ID (bijvoorbeeld 0x2600)",
+"Force all network connections to this tuner to be made over the specified IP address, similar to the setting for the SAT>IP device itself. Setting this overrides the device-specific setting.", "Forceer alle netwerk verbindingen naar deze tuner gebruik te maken van het gespecificeerde IP adres,  vergelijkbaar met de instelling van het SAT>IP apparaat zelf. Door dit in te stellen wordt de apparaat specifieke instelling overschreven.",
+"Force an initial EPG grab at start-up.", "Forceer een initiele EPG grab tijdens het opstarten.",
+"Force initial EPG grab at start-up", "Forceer initiele EPG grab tijdens het opstarten.",
+"Force old status", "Forceer de oude status",
+"Force pilot for DVB-S2", "Forceer pilot voor DVB-S2",
+"Force priority", "Forceer prioriteit",
+"Force service type to 1", "Forceer service type naar 1",
+"Force teardown delay", "Forceer afsluit vertraging",
+"Force the stream profile to use this priority.", "Forceer het stream profiel om deze proriteit te gebruiken.",
+"Force usage of entered CA ID on this service.", "Forceer het gebruik van het ingevoerde CA ID op deze service.",
+"Foreign countries", "Buitenland",
+"Forever", "Voor altijd",
+"Fork and run as daemon", "Fork en start als daemon",
+"Format string", "Formateer string",
+"Found muxes", "Muxen gevonden",
+"Found services", "Services gevonden",
+"Free-form field, enter whatever you like here.", "Vrije vorm veld, voer hier wat dan ook in.",
+"Free-form text field, enter whatever you like here.", "Vrije vorm tekst veld, voer hier wat dan ook in.",
+"Free-form text field, enter whatever you like.", "Vrije vorm tekst veld, voer wat dan ook in.",
+"Free-form text field. You can enter whatever you like here.", "Vrije vorm tekst veld. Je kan hier wat dan ook invoeren.",
+"Free-format text field. Enter whatever you like here.", "Vrije vorm veld. Voer hier wat dan ook in.",
+"Frequency", "Frequentie",
+"Frequency (Hz)", "Frequentie (Hz)",
+"Frequency (MHz)", "Frequentie (MHz)",
+"Frequency (in MHz).", "Frequentie (in MHz).",
+"Frequency (kHz)", "Frequentie (kHz)",
+"Fri", "Vrijdag",
+"Friendly name", "Vriendelijke naam",
+"Frontend number", "Frontend nummer",
+"Frontend path", "Frontend pad",
+"Full DiseqC", "Volledige DiseqC",
+"Full pathname specification", "Volledige pad naam specificatie",
+"Full-text", "Volledige tekst",
+"Further education", "Vervolgopleiding",
+"GOTOX position", "GOTOX positie",
+"Game show", "Spelshow",
+"Gardening", "Tuinieren",
+"General", "Algemeen",
+"General configuration", "Generieke configuratie",
+"Generic", "Algemeen",
+"Generic options", "Algemene opties",
+"HTSP Default Stream Settings", "HTSP standaard stream instellingen",
+"HTSP stream profile", "HTSP stream profiel",
+"Handicraft", "Handwerk",
+"Hearing impaired", "Doven",
+"Hierarchy", "Hierarchie",
+"High", "Hoog",
+"Highest channel number the user can access.", "Hoogste kanaal nummer waar de gebruiker toegang toe heeft.",
+"Historical movie", "Historische film",
+"IDLE", "RUST",
+"IP address", "IP adres",
+"IP blocking", "IP blokkeren",
+"IPTV automatic network", "IPTV automatisch netwerk",
+"IPTV network", "IPTV netwerk",
+"ISDB-C network", "ISDB-C netwerk",
+"ISDB-T network", "ISDB-T netwerk",
+"Icon", "Icoon",
+"Icon (full URL)", "Logo (volledige URL)",
+"Icon URL", "Logo URL",
+"Icon base URL", "Icoon basis URL",
+"Icon has title", "Logo heeft titel",
+"Icons from", "Logos van",
+"Idle", "Rust",
+"Idle scan", "Rust scan",
+"Idle scan muxes", "Rust scan muxes",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Als er geen gebruiker bestaat, maak er dan een\naan zonder gebruikersnaam en wachtwoord.\nGebruik voorzichtig, omdat het volledige toegang\nbied voor iedereen tot deze Tvheadend installatie\ntotdat de toegangscontrole is bijgewerkt vanuit de\nTvheadend web interface.",
+"If you'd like to support the project, please consider a donation.", "Het project steunen kan door middel van donaties.",
+"Ignore EPG (EIT)", "Negeer EPG (EIT)",
+"Ignore descriptor 5", "Negeer descriptor 5",
+"Ignore invalid SSL certificate", "Negeer niet geldige SSL certificaten",
+"Image cache", "Afbeelding cache",
+"Immediately abort", "Direct stoppen",
+"Important", "Belangrijk",
+"Include channel name in filename", "Kanaal naam in de bestandsnaam",
+"Include date in filename", "Datum in de bestandsnaam",
+"Include episode in filename", "Aflevering in de bestandsnaam",
+"Include subtitle in filename", "Ondertiteling in de bestandsnaam",
+"Include the episode subtitle in the title (if available).", "Aflevering ondertiteling in de titel (indien beschikbaar).",
+"Include the season and episode in the title (if available).", "Seizoen en aflevering in de titel (indien beschikbaar).",
+"Include time in filename", "Tijd in de bestandsnaam",
+"Information area", "Informatie gebied",
+"Informational", "Informatief",
+"Initial scan", "Initiële scan",
+"Input base", "Invoer basis",
+"Input buffer (bytes)", "Invoer buffer (bytes)",
+"Input instance", "Invoer instantie",
+"Input path", "Invoer pad",
+"Internal", "Intern",
+"Internal EPG grabber", "Interne EPG grabber",
+"Internal error", "Interne fout",
+"Internal grabber", "Interne grabber",
+"Invalid", "Ongeldig",
+"Invalid EPG object request", "Ongeldig EPG object verzoek",
+"Invalid adapter number '%s'\n", "Foutief adapter number '%s'\n",
+"Invalid arguments", "Ongeldige argumenten",
+"Invalid file", "Ongeldig bestand",
+"Invalid parameters", "Ongeldige parameters",
+"Invalid target", "Ongeldig doel",
+"Keep", "Behouden",
+"Keep x amount of storage space free.", "Houd x hoeveelheid opslag ruimte vrij.",
+"Kill signal (pipe)", "Stop signaal (pipe)",
+"Kill timeout (pipe/secs)", "Stop timeout (pipe/secs)",
+"Language", "Taal",
+"Language 1", "Taal 1",
+"Language 2", "Taal 2",
+"Language 3", "Taal 3",
+"Language settings", "Taal instellingen",
+"Languages", "Talen",
+"Last seen", "Laatst gezien",
+"Last updated from", "Laatst bijgewerkt vanaf",
+"Leisure hobbies", "Vrije tijd",
+"Limit connections", "Beperk verbindingen",
+"Limited/limit scanning to this network ID only.", "Beperkt/Beperk scannen tot dit netwerk ID alleen.",
+"Linked input", "Gekoppelde input",
+"LinuxDVB network", "LinuxDVB netwerk",
+"List of allowed IPv4 or IPv6 hosts or networks (comma-separated).", "Lijst van toegestane IPv4 of IPv6 systemen of netwerken (komma gescheiden).",
+"Listen / Connect port", "Listen / Connect poort",
+"Listen on IPv6", "Gebruik IPv6",
+"Literature", "Literatuur",
+"Local (server) time", "Lokale (server) tijd",
+"Local bind IP address", "Lokaal bind IP adres",
+"Local channel minor", "Lokaal kanaal minor ",
+"Local channel number", "Lokaal kanaal nummer",
+"Local: Record if different description", "Lokaal: Opnemen als beschrijving anders is",
+"Local: Record if different episode number", "Lokaal: Opnemen als afleveringsnummer anders is",
+"Local: Record if different subtitle", "Lokaal: Opnamen als ondertiteling anders is",
+"Local: Record if different title", "Lokaal: Opnemen als de titel anders is",
+"Local: Record once per day", "Lokaal: Neem een keer per dag op",
+"Local: Record once per week", "Lokaal: Neem één keer er week op",
+"Location", "Locatie",
+"Location details of the SAT>IP Server.", "Locatie details van de SAT>IP Server.",
+"Log", "Logboek",
+"Login/Logout", "Inloggen/uitloggen",
+"Low", "Laag",
+"Lowest channel number the user can access.", "Laagste kanaal nummer wat de gebruiker kan benaderen.",
+"MPEG-TS network", "MPEG-TS netwerk",
+"Magazines", "Tijdschriften",
+"Maintain free storage space in MiB", "Beheer vrije opslag ruimte in MiB",
+"Maintain used storage space in MiB (0=disabled)", "Beheer gebruikte opslag ruimte in MiB (0=uitgeschakeld)",
+"Maintained space", "Beheerde ruimte",
+"Make subdirectories per channel", "Maak subdirectories per kanaal",
+"Make subdirectories per day", "Maak subdirectories per dag",
+"Make subdirectories per title", "Maak subdirectories per titel",
+"Manufacturer", "Fabrikant",
+"Manufacturer URL", "Fabrikant URL",
+"Manufacturer's model number.", "Modelnummer van fabrikant",
+"Manufacturer's product description.", "Productbeschrijving van fabrikant.",
+"Manufacturer's product information page for the device.", "Product informatie pagina voor het apparaat van fabrikant.",
+"Manufacturer's product name.", "Product naam van fabrikant.",
+"Map all services", "Deel alle diensten in",
+"Map encrypted services", "Deel versleutelde services in",
+"Map radio channels", "Deel radio kanalen in",
+"Map unnamed channels", "Deel naamloze kanalen in",
+"Map zero-numbered channels", "Deel nul genummerde kanalen in",
+"Master tuner", "Hoofd tuner",
+"Matroska specific", "Matroska specifiek",
+"Maximal channel number", "Maximaal kanaal nummer",
+"Maximum # input streams", "Maximaal # input streams",
+"Maximum PIDs", "Maximaal aantal PID's",
+"Maximum RAM size (MB)", "Maximale RAM grootte (MB)",
+"Maximum allowed difference between event start time when the EPG event is changed.", "Maximaal toegestaan verschil tussen de start tijd van de gebeurtenis zodra de EPG gebeurtenis is veranderd.",
+"Maximum bandwidth (Kbps)", "Maximale bandbreedte (Kbps)",
+"Maximum count (0=default)", "Maximum aantal (0=standaard)",
+"Maximum duration", "Maximumduur",
+"Maximum length in characters for the command setting PIDs to the SAT>IP box.", "Maximale tekenlengte voor het commando om PIDs in te stellen op de SAT>IP box.",
+"Maximum length of PIDs", "Maximale lengte van PID's",
+"Maximum period (mins)", "Maximumperiode (min)",
+"Maximum schedules limit (0=default)", "Maximum schemalimiet (0=standaard)",
+"Maximum size (MB)", "Maximale grootte (MB)",
+"Maximum timeout (seconds)", "Maximale timeout (seconden)",
+"Medicine", "Geneeskunde",
+"Merge same name", "Voeg dezelfde naam samen",
+"Merge services with the same name to one channel.", "Voeg services met dezelfde naam samen in één kanaal.",
+"Method not found", "Methode niet gevonden",
+"Minimal channel number", "Minimaal kanaal nummer",
+"Minimum duration", "Minimumduur",
+"Minimum rotor time (seconds)", "Minimale rotor tijd (seconden)",
+"Missing In PAT/SDT", "Ontbreekt in PAT/SDT",
+"Mode", "Modus",
+"Model description", "Modelbeschrijving",
+"Model name", "Modelnaam",
+"Model number", "Modelnummer",
+"Modulation", "Modulatie",
+"Module ID used to grab EPG data.", " ",
+"Mon", "Maandag",
+"More verbose libav log", "Meer gedetailleerde libav log ",
+"Motor rate (in milliseconds/deg).", "Motor verhouding (in milliseconden/graden).",
+"Motor rate (milliseconds/deg)", "Motor verhouding (milliseconden/graden)",
+"Motor sport", "Motorsport",
+"Motoring", "Autorijden",
+"Movie", "Film",
+"Music", "Muziek",
+"Mux handling", "Mux behandeling",
+"Mux name", "Muxnaam",
+"Mux not enabled", "Mux uitgeschakeld",
+"Mux schedule entry", "Mux schema ",
+"NONE", "GEEN",
+"Name", "Naam",
+"Name of the bouquet.", "Bouguetnaam",
+"Name of the network.", "Netwerknaam",
+"Name of the profile.", "Profielnaam",
+"Name of the tag.", "Labelnaam",
+"Name of the tuner.", "Naam van de tuner.",
+"Name of the tuner/adapter.", "Naam van de tuner/adapter.",
+"Name. The name given to/of the channel (This is how it'll appear in your EPG.)", "Naam. De naam van het kanaal (dit is hoe het getoond wordt in de EPG).",
+"Names", "Namen",
+"Natural sciences", "Natuurwetenschappen",
+"Nature", "Natuur",
+"Network", "Netwerk",
+"Network ", "Netwerk",
+"Network A", "Netwerk A",
+"Network B", "Netwerk B",
+"Network ID (limit scanning)", "Netwerk ID (beperk scannen)",
+"Network UUID", "Netwerk UUID",
+"Network access", "Netwerk toegang",
+"Network discovery", "Netwerk ontdekking",
+"Network for port A.", "Netwerk voor poort A.",
+"Network for port AA.", "Netwerk voor poort AA.",
+"Network for port AB.", "Netwerk voor poort AB.",
+"Network for port B.", "Netwerk voor poort B.",
+"Network for port BA.", "Netwerk voor poort BA.",
+"Network for port BB.", "Netwerk voor poort BB.",
+"Network group", "Netwerk groep",
+"Network limit per position", "Netwerk beperking per positie",
+"Network name", "Netwerk naam",
+"Network prefix", "Netwerk prefix",
+"Network settings", "Netwerk instellingen",
+"Network type", "Netwerk type",
+"Networks", "Netwerken",
+"New / premiere / unknown", "Nieuw / premiere / onbekend",
+"News", "Actualiteit",
+"News magazine", "Actualiteitenrubriek",
+"Next tune delay in ms (0-2000)", "Vertraging tussen tunen in ms (0-2000)",
+"No", "Nee",
+"No PIN", "Geen PIN",
+"No access", "Geen toegang",
+"No adapters specified!\n", "Geen adapter gespecificeerd!\n",
+"No assigned adapters", "Geen toegewezen adapters",
+"No days", "Geen dagen",
+"No descrambler", "Geen descrambler",
+"No free adapter", "Geen vrije adapter",
+"No input detected", "Geen input gedetecteerd",
+"No scheme", "Geen schema",
+"No service assigned to channel", "Geen service toegekend aan kanaal",
+"No service enabled", "Geen service geactiveerd",
+"No source available", "Geen bron beschikbaar",
+"None", "Geen",
+"Normal", "Normaal",
+"Not all SAT>IP servers use the same signal scaling. Change this setting if the signal level displayed within Tvheadend looks too low.", "Niet alle SAT>IP servers gebruiken de zelfde signaal schaal. Verander deze instelling als het signaal niveau zoals getoond in Tvheadend te laag lijkt.",
+"Not enough memory", "Niet genoeg geheugen",
+"Not linked", "Niet gekoppeld",
+"Not set", "Niet geconfigureerd",
+"Not set (none or channel configuration)", "Niet geconfigureerd (geen of zie kanaal configuratie)",
+"Not set (use channel or DVR configuration)", "Niet geconfigureerd (gebruik kanaal of DVR configuratie)",
+"Number", "Aantal",
+"Number of days to keep the file.", "Aantal dagen om het bestand te behouden.",
+"Number of days to keep the recorded file.", "Aantal dagen om het opgenomen bestand te behouden.",
+"Number of days to keep the recorded files.", "Aantal dagen om de opgenomen bestanden te behouden.",
+"Number of days to retain entry information.", "Aantal dagen om de entry informatie te behouden.",
+"Number of days to retain infomation about recording.", "Aantal dagen om de informatie over de opname te behouden.",
+"Number of days to retain infomation about recordings.", "Aantal dagen om de informatie over de opnames te behouden.",
+"Number of errors that occurred during recording (Transport errors).", "Aantal fouten dat is opgetreden tijdens de opname (Transport fouten).",
+"Number of errors that occurred during recording.", "Aantal fouten dat is opgetreden tijdens opname.",
+"Number of muxes found.", "Aantal gevonden muxen.",
+"Number of seconds to wait before timing out.", "Aantal seconden om te wachten voordat er wordt onderbroken.",
+"Number of services.", "Aantal services.",
+"Number of tsfile tuners", "Aantal tsfile tuners",
+"OK (partial)", "OK (gedeeltelijk)",
+"Odd key", "Oneven sleutel",
+"Off", "Uit",
+"Older OSCam", "Oudere OSCam",
+"On", "Aan",
+"On file removal", "Tijdens verwijderen bestand",
+"On-demand (no first rewind)", "Op aanvraag (geen eerste rewind)",
+"Once per auto channel", "Eenmaal per auto kanaal",
+"Only Bulsatcom 39E", "Alleen Bulsatcom 39E",
+"Only EIT", "Alleen EIT",
+"Only OpenTV Sky Ausat", "Alleen OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Alleen ",
+"Only OpenTV Sky UK", "Alleen ",
+"Only PSIP (ATSC)", "Alleen PSIP (ATSC)",
+"Only UK Freesat", "Alleen UK Freesat",
+"Only UK Freeview", "Alleen UK Freeview",
+"Only Viasat Baltic", "Alleeen Viasat Baltic",
+"Only preferred CA PID", "Alleen voorkeurs CA PID",
+"Only use specified DVB adapters (comma-separated, -1 = none)", "Gebruik alleen gespecificeerde DVB adapters (komma gescheiden, -1 = geen)",
+"Only use system RAM for timeshift buffers.", "Gebruik alleen systeem geheugen voor timeshift buffers",
+"Only use this EPG data once when automatically determining what EPG data to set for a channel.", "Gebruik deze EPG gegevens alleen maar wanneer automatisch wordt vastgesteld welke EPG gegevens in te stellen voor een kanaal",
+"OpenTV channel number", "OpenTV kanaal nummer",
+"Orbital position", "Orbital positie",
+"Orbital positions", "Orbital posities",
+"Orbital positions.", "Orbital posities.",
+"Original network ID", "Origineel netwerk ID",
+"Output directory for tsdebug", "Output directory voor tsdebug",
+"Over-the-air", "Via de ether",
+"Over-the-air Cron multi-line", "Via de ether Cron multi-line",
+"Owner", "Eigenaar",
+"PEND", "WACHT",
+"Password", "Wachtwoord",
+"Password2", "Wachtwoord2",
+"Passwords", "Wachtwoorden",
+"Path", "Pad",
+"Performing arts", "Uitvoerende kunst",
+"Physiology", "Fysiologie",
+"Picon path (see Help)", "Picon pad (zie Help)",
+"Polarization", "Polarisatie",
+"Political issues", "Politieke zaken",
+"Popular culture", "Populaire cultuur",
+"Port", "Poort",
+"Position", "Positie",
+"Prefer picons over channel name", "Geef picons voorkeur boven kanaal naam",
+"Preferred CA PID", "Voorkeurs CA PID",
+"Presentation", "Presentatie",
+"Press", "Pers",
+"Priority", "Prioriteit",
+"Priority (-10..10)", "Prioriteit (-10..10)",
+"Private", "Prive",
+"Psychology", "Psychologie",
+"Puppets", "Marionetten",
+"RTSP/TCP (embedded data)", "RTSP/TCP (ingebedde gegevens)",
+"Re-fetch period (hours)", "Opnieuw halen periode (uren)",
+"Re-fetch period (mins)", "Opnieuw halen periode (mins)",
+"Re-record%s%s", "Her-opnemen%s%s",
+"Re-try period (hours)", "Opnieuw proberen periode (uren)",
+"Record all", "Alles opnemen",
+"Reject", "Afwijzen",
+"Religion", "Religie",
+"Religious", "Religieus",
+"Remarkable people", "Opmerkelijke mensen",
+"Remove HTTP arguments", "HTTP argumenten verwijderen",
+"Reports", "Rapporten",
+"Rerun of", "Herhaling van",
+"Rescan", "Opnieuw scannen",
+"Reserved", "Gereserveerd",
+"Resolution (height)", "Resolutie (hoogte)",
+"Respawn (pipe)", "Herstarten (pipe)",
+"Rewrite EIT", "Herschrijf EIT",
+"Rewrite PAT", "Herschrijf PAT",
+"Rewrite PMT", "Herschrijf PMT",
+"Rewrite SDT", "Herschrijf SDT",
+"Romance", "Romantiek",
+"Run as group", "Start als groep",
+"Run as user", "Start als gebruiker",
+"Running", "Gestart",
+"SAT->IP frontend number.", "SAT->IP frontend nummer.",
+"SAT>IP source number", "SAT>IP source nummer",
+"SSL verify peer", "SSL controleer andere zijde",
+"Sat", "Zat",
+"Schedule a re-recording if more errors than (0=off)", "Plan her-opname als er meer dan ... fouten zijn (0=uit)",
+"Scheduled for recording", "Gepland voor opname",
+"Science", "Wetenschap",
+"Season", "Seizoen",
+"Season %d", "Seizoen %d",
+"Send full PLAY cmd", "Verstuur volledig PLAY commando",
+"Serious", "Serieus",
+"Serious music", "Serieuze muziek",
+"Service", "Dienst",
+"Service ID", "Dienst ID",
+"Services", "Diensten",
+"Settings", "Instellingen",
+"Show this page", "Laat deze pagina zien",
+"Show version information", "Laat versie informatie zien",
+"Signal quality too poor", "Signaal kwaliteit te slecht",
+"Signal scale (240 or 100)", "Signaal schaal (240 or 100)",
+"Skip TS packets (0-200)", "Sla TS packets over (0-200)",
+"Soccer", "Voetbal",
+"Social", "Sociaal",
+"Social advisory", "Sociaal adviseren",
+"Source", "Bron",
+"Source deleted", "Bron verwijderd",
+"Source quality is bad", "Bron kwaliteit is slecht",
+"Source reconfigured", "Bron hergeconfigureerd",
+"Special events (Olympic Games, World Cup, etc.)", "Speciale gebeurtenisses (Olympische spelen, WK, etc.)",
+"Specify User-Agent header for the http client", "Specificeer User-Agent header voor HTTP client",
+"Specify alternative htsp port", "Specificeer alternative htsp poort",
+"Specify alternative http port", "Specificeer alternative http poort",
+"Specify alternative http webroot", "Specificeer alternatieve HTTP webroot",
+"Specify bind address", "Specificeer bind adres",
+"Specify extra htsp port", "Specificeer extra htsp poort",
+"Spiritual sciences", "Spirituele wetenschappen",
+"Sports", "Sporten",
+"Sports magazines", "Sport tijdschriften",
+"Standard", "Standaard",
+"Storage space", "Opslag ruimte",
+"Subscribe to a service permanently", "Permanent aanmelden bij een dienst",
+"Subscription overridden", "Aanmelding overschreven",
+"Substitute formatters", "Vervang formatters",
+"Subtitle", "Ondertiteling",
+"Sun", "Zon",
+"Switch off the power to the LNB when idle. Note: this may cause interference with other devices when the LNB is powered back up.", "Zet de stroom naar de LNB uit wanneer in rust. Ket op: dit kan storing veroorzaken op andere apparaten zodra de stroom naar de LNB weer aangezet wordt.",
+"Sync + Don't keep", "Sync + niet houden",
+"System", "Systeem",
+"Tags", "Labels",
+"Talk show", "Praat programma",
+"Team sports (excluding football)", "Team sporten (excl. voetbal)",
+"Technology", "Technologie",
+"Testing", "Testen",
+"Testing options", "Test opties",
+"This tuner", "Deze tuner",
+"Thu", "Do",
+"Time", "Tijd",
+"Time missed", "Tijd gemist",
+"Time recording%s%s", "Tijd opname%s%s",
+"Timeout (sec) (0=infinite)", "Timout (sec) (0=oneindig)",
+"Timeout (seconds)", "Timeout (seconden)",
+"Timout (secs)", "Timeout (secs)",
+"Title", "Titel",
+"Tourism / Travel", "Reizen",
+"Traditional arts", "Traditionele kunsten",
+"Traditional music", "Traditionele muziek",
+"Tue", "Di",
+"Tune before DiseqC", "Tune voor DiseqC",
+"Tuner configuration", "Tuner configuratie",
+"Tuner configuration.", "Tuner configuratie.",
+"Tuning failed", "Tuning faalde",
+"Turn off LNB when idle", "Zet LNB uit wanneer in rust",
+"Tvheadend server name", "Tvheadend server naam",
+"URL with the SAT>IP server XML location", "URL met de SAT>IP server XML locatie",
+"Uncommitted", "Niet gecommit",
+"Unimportant", "Niet belangrijk",
+"Universal LNB only", "Alleen universele LNB",
+"Unknown", "Onbekend",
+"Unknown reason (%i)", "Onbekende oorzaak (%i)",
+"Unset (default)", "Niet geconfigureerd (standaard)",
+"Update channel icon", "Kanaal icoon bijwerken",
+"Update channel name", "Kanaal naam bijwerken",
+"Update channel number", "Kanaal nummer bijwerken",
+"Update time", "Tijd bijwerken",
+"Update tolerance (ms)", "Bijwerk tolerantie (ms)",
+"Usage: %s [OPTIONS]\n", "Gebruik: %s [OPTIONS]\n",
+"Use Windows-compatible filenames", "Gebruik Windows-compatible bestandsnamen",
+"Use XSPF playlist instead of M3U", "Gebruik een XSPD playlist in plaats van M3U",
+"Use original", "Gebruik origineel",
+"User access error", "Gebruikers toegangsfout",
+"User language", "Gebruikers taal",
+"User limit reached", "Gebruikerslimiet bereikt",
+"Username", "Gebruikersnaam",
+"Video codec preset", "Video codec voorinstelling",
+"Video codec preset to use for transcoding.", "Video codec voorinstelling om te gebruiken tijdens transcoderen.",
+"Visually impaired commentary/audio description", "Slechtzienden commentaar/geluid beschrijving",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV profiel H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV profiel H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV profiel VP8/Vorbis/WEBM",
+"Waiting for program start", "Wacht op programma start",
+"Waiting for stream", "Wacht op stream",
+"War", "Oorlog",
+"Water sport", "Watersport",
+"Weak stream", "Zwakke stream",
+"Weather report", "Weer",
+"Web interface language", "Web interface taal",
+"Web user interface", "Web gebruikers interface",
+"Wed", "Woe",
+"Welcome - Tvheadend - your TV streaming server and video recorder", "Welkom - Tvheadend - jouw TV streaming server en video recorder",
+"Western hemisphere (latitude direction)", "Westelijk halfrond (breedtegraad richting)",
+"Western hemisphere (latitude direction).", "Westelijk halfrond (breedtegraad richting).",
+"Wizard", "Hulpje",
+"Yes", "Ja",
+"addpids/delpids supported", "addpids/delpids ondersteund",
+"default: nvenc(h264 / h265)", "standaard: nvenc(h264 / h265)",
+"fast: h264 / h265 / qsv(h264 / h265)", "snel: h264 / h265 / qsv(h264 / h265)",
+"faster: h264 / h265 / qsv(h264)", "sneller: h264 / h265 / qsv(h264)",
+"hrs", "uren",
+"invalid option specified [%s]", "verkeerde optie opgegeven [%s]",
+"min", "minuut",
+"mins", "minuten",
+"option %s requires a value", "optie %s vereist een waarde",
+"slow: h264 / h265 / qsv(h264 / h265)", "langzaam: h264 / h265 / qsv(h264 / h265)",
+"slower: h264 / h265 / qsv(h264)", "langzamer: h264 / h265 / qsv(h264)",
+"superfast: h264 / h265", "super snel: h264 / h265",
+"tsfile input (mux file)", "tsfile input (mux bestand)",
+"ultrafast: h264 / h265", "ultra snel: h264 / h265",
+"veryfast: h264 / h265 / qsv(h264)", "zeer snel: h264 / h265 / qsv(h264)",
+"veryslow: h264 / h265 / qsv(h264)", "zeer langzaam: h264 / h265 / qsv(h264)",
+NULL, NULL
+};
+
+static const char *tvh_locale_18[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nPo więcej informacji odwiedź stronę www:\nhttps://tvheadend.org\n",
+"# Channels", "# Kanały",
+"# Mapped channels", "# Zamapowane kanały",
+"# Muxes", "# Muxy",
+"# Services", "# Usługi",
+"# Services seen", "# Widziane usługi",
+"# tune repeats", "Powtarzanie strojenia",
+"(Default profile)", "(Domyślny profil)",
+"1 day", "1 dzień",
+"1 month", "1 miesiąc",
+"1 week", "1 tydzień",
+"1 year", "1 rok",
+"2 months", "2 miesiące",
+"2 weeks", "2 tygodnie",
+"2 years", "2 lata",
+"2-Port switch (universal LNB)", "Przełącznik 2-portowy (universal LNB)",
+"3 days", "3 dni",
+"3 months", "3 miesiące",
+"3 weeks", "3 tygodnie",
+"3 years", "3 lata",
+"4-Port switch (universal LNB)", "Przełącznik 4-portowy (universal LNB)",
+"5 days", "5 dni",
+"6 months", "6 miesięcy",
+"AC-3 detection", "Wykrywanie AC-3",
+"ACTIVE", "AKTYWNY",
+"ANY", "DOWOLNY",
+"ATSC-C network", "Sieć ATSC-C",
+"ATSC-T network", "Sieć ATSC-T",
+"Aborted by user", "Przerwane przez użytkownika",
+"Access", "Dostęp",
+"Action", "Akcja",
+"Adapter in use by another subscription", "Adapter w użyciu przez inną subskrypcję",
+"Add file and line numbers to debug", "Dodaj plik i numer linii do debugowania",
+"Add the thread ID to debug", "Dodaj ID wątku do debugowania",
+"Admin password", "Hasło Admin",
+"Admin username", "Nazwa użytkownika Admin",
+"Administrator login", "Logowanie Administratora",
+"Adult movie", "Film dla dorosłych",
+"Advanced", "Zaawansowane",
+"Advanced (non-universal LNBs, rotors, etc.)", "Zaawansowane (non-universal LNBs, rotors, itp.)",
+"Advanced streaming", "Zaawansowane strumieniowanie",
+"Adventure", "Przygodowy",
+"Advertisement / Shopping", "Reklamy / Zakupy",
+"All (Streaming plus DVR)", "Wszystko (Strumieniowanie + DVR)",
+"All DVR (rw)", "Wszystko DVR (rw)",
+"All characters that could possibly cause problems for filenaming will be replaced with an underscore. See Help for details.", "Wszystkie znaki, które mogłyby powodować problemy dla nazewnictwa plików zostaną zastąpione znakiem podkreślenia. Zobacz Pomoc dla szczegółów.",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Wszystkie wpływy są wykorzystywane do wspierania infrastruktury serwerowej i zakupu sprzętu do badań.",
+"Allow to show the quick tips for the form fields.", "Zezwól na pokazywanie krótkich wskazówek dotyczących pól formularzy.",
+"Allow/disallow HTSP protocol streaming, e.g Kodi (via pvr.hts) or Movian.", "Zezwól/zabroń na protokół przesyłania strumieniowego HTSP, np Kodi (przez pvr.hts) lub Movian.",
+"Allow/disallow HTTP streaming.", "Zezwól/zabroń na przesyłanie strumieniowe HTTP.",
+"Allow/disallow access to DVR via the HTSP protocol.", "Zezwól/zabroń na  dostępu do rejestratora za pośrednictwem protokołu HTSP.",
+"Allow/disallow access to all failed DVR entries.", "Zezwól/zabroń na dostęp do wszystkich błędnych zapisów rejestratora.",
+"Allow/disallow access to other users DVR entries (read only).", "Zezwól/zabroń na dostępu do innych wpisów użytkowników DVR (tylko do odczytu).",
+"Allow/disallow access to the 'Configuration' tab.", "Zezwól/zabroń na dostęp do zakładki 'Konfiguracja'.",
+"Allow/disallow access to video recorder functionality (including Autorecs).", "Zezwól/zabroń na dostęp do funkcji rejestratora wideo (w tym Autorecs).",
+"Allow/disallow advanced http streaming, e.g, direct service or mux links.", "Zezwól/zabroń na zaawansowane przesyłanie strumieniowe HTTP, na przykład, usługa lub MUX bezpośrednie linki.",
+"Allow/disallow read/write access to other users' DVR entries.", "Zezwól/zabroń na odczyt/zapis z zapisów rejestratora innych użytkowników.",
+"Allow/disallow web interface access (this  includes access to the EPG).", "Zezwól/zabroń na dostęp do interfejsu WWW (w tym dostęp do EPG).",
+"Allowed DVR profiles. This limits the profiles the user has access to.", "Dozwolone profile DVR. Do tych ograniczonych profili użytkownik ma dostęp.",
+"Allowed network", "Dozwolona sieć",
+"Allowed networks", "Dozwolone sieci",
+"Alternate PID path", "Alternatywna ścieżka pid",
+"Alternate configuration path", "Alternatywna ścieżka konfiguracji",
+"Altitude (in meters).", "Wysokość (w metrach).",
+"Altitude (meters)", "Wysokość (metry)",
+"Animals", "Zwierzęta",
+"Anonymize HTSP access", "Dostęp anonimowy HTSP",
+"Any", "Dowolny",
+"Arts", "Sztuka",
+"Assign predefined muxes to networks", "Przypisywanie predefiniowanych muxów do sieci",
+"Athletics", "Gimnastyka",
+"Audio birate to use for transcoding.", "Audio birate używany do transkodowania.",
+"Audio channel layout.", "Układ kanałów audio.",
+"Audio codec", "Audio kodek",
+"Audio language (Not currently used).", "Język audio (Nie jest obecnie użyty).",
+"Audio stream filter", "Filtr strumienia audio",
+"Auto check disabled", "Auto sprawdzanie wyłączone",
+"Auto check enabled", "Auto sprawdzanie włączone",
+"Auto record", "Automatyczne nagrywanie",
+"Auto record caption", "Auto nagrywanie podpisu",
+"Auto recording%s%s", "Auto nagrywanie%s%s",
+"Auto time record", "Czas automatycznego nagrywania",
+"Auto-Map to channels", "Automatycznie mapuj do kanałów",
+"Automatic checking", "Automatyczne sprawdzanie",
+"Automatically map EPG source", "Automatycznie mapowane źródło EPG",
+"Automatically map all available services to channels.", "Automatycznie mapuj wszystkie dostępne serwisy do kanałów.",
+"Automatically name from network", "Automatyczna nazwa z sieci",
+"Autorec maximum count (0=unlimited)", "Auto-nagrywanie maksymalny licznik (0=bez limitu)",
+"Autorec maximum schedules limit (0=unlimited)", "Auto-nagrywanie maksymalny limit harmonogramu (0=bez limitu)",
+"Bad", "Zły",
+"Ballet", "Balet",
+"Bandwidth", "Przepustowość",
+"Based on software from", "Bazuje na oprogramowaniu z",
+"Basic", "Podstawowy",
+"Bind to specific local IP address.", "Powiąż ze specjalnym lokalnym adresem IP.",
+"Bouquet (auto)", "Bouquet (Automatyczny)",
+"Brand", "Marka",
+"Broadcast", "Emisja",
+"Broadcast type", "Typ emisji",
+"Broadcast.", "Emisja.",
+"Broadcasting", "Transmitowanie",
+"Buffering limit (ms)", "Limit buforowania (ms)",
+"Build", "Wersja",
+"CA client %i", "CA klient %i",
+"CA identification", "CA identyfikacja",
+"CA provider", "CA dostawca",
+"CA stream filter", "Filtr strumienia CA",
+"CAPMT interval (in ms).", "CAPMT interwał (w ms).",
+"CAPMT interval (ms)", "CAPMT interwał (ms)",
+"CAPMT query interval (ms)", "CAPMT interwał zapytań (ms)",
+"CAPMT query interval (ms).", "CAPMT interwał zapytań (ms).",
+"CRID authority", "CRID organ",
+"Cache scheme", "Schemat buforowania",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket nazwa pliku / adres IP (tryb TCP)",
+"Cartoons", "Kreskówki",
+"Channel", "Kanał",
+"Channel does not exist", "Kanał nie istnieje",
+"Channel icon", "Ikona kanału",
+"Channel icon as defined in EPG data.", "Ikona kanału, jak określono w danych EPG.",
+"Channel icon name scheme", "Schemat nazwy ikony kanału",
+"Channel icon path (see Help)", "Ścieżka ikon kanałów (patrz Pomoc)",
+"Channel name", "Nazwa kanału",
+"Channel not found", "Kanał nie znaleziony",
+"Channel number", "Numer kanału",
+"Channel number as defined in EPG data.", "Numer kanału, jak określono w danych EPG.",
+"Channel number offset", "Numer kanału offset",
+"Channel numbers from", "Numer kanału od",
+"Channel tag", "Tag kanału",
+"Channel tag does not exist", "Tag kanału nie istnieje",
+"Channel tag reference", "Referencyjny tag kanału",
+"Channel tags", "Tagi kanałów",
+"Channel tags the user is allowed access to/excluded from.", "Tagi kanału do których użytkownik ma prawo dostępu/wykluczenia.",
+"Channel to use/used for the recording.", "Kanał do użycia/używany do nagrywania.",
+"Channels", "Kanały",
+"Channels EPG data is used by.", "Dane kanałów EPG są używane przez.",
+"Character set", "Ustawienie znaków",
+"Check availability", "Sprawdź dostępność",
+"Children's / Youth programs", "Programy dla dzieci / młodzieży",
+"Cinema", "Kino",
+"Class", "Klasa",
+"Classical", "Klasyczny",
+"Classical music", "Muzyka klasyczna",
+"Clean effects", "Czyść efekty",
+"Client name", "Nazwa klienta",
+"Clone scheduled entry on error", "Klonuj zaplanowane wpisy przy błedzie",
+"Comedy", "Komedia",
+"Command delay time (ms) (10-200)", "Cmd czas opóźnienia (ms) (10-200)",
+"Command time (ms) (10-100)", "Command Time (ms) (10-100)",
+"Comment", "Komentarz",
+"Commercial break", "Przerwa reklamowa",
+"Completed OK", "Zakończone OK",
+"Compress EPG database", "Kompresuj bazę danych EPG",
+"Compress the EPG database to reduce disk I/O and space.", "Kompresuj bazę danych EPG, aby zmniejszyć przestrzeń dysku I/O.",
+"Conditional access client", "Klient dostępu warunkowego",
+"Configuration", "Konfiguracja",
+"Configuration ID", "ID konfiguracji",
+"Configuration name", "Konfiguracja nazwy",
+"Configuration version", "Wersja konfiguracji",
+"Connection limit type", "Limit typu połączenia",
+"Constellation", "Konstelacja",
+"Container", "Kontener",
+"Content character set", "Ustawienie znaków zawartości",
+"Content type", "Typ zawartości",
+"Content type.", "Typ zawartości.",
+"Contest", "Zawody",
+"Continue even if descrambling fails", "Kontynuuj nawet jeśli dekodowanie zawiedzie",
+"Continue recording for x minutes after scheduled stop time", "Kontynuuj nagrywanie przez x minut po planowanym czasie zatrzymania",
+"Continue recording for x minutes after scheduled stop time.", "Kontynuuj nagrywanie przez x minut po planowanym czasie zatrzymania.",
+"Cookie expiration (days)", "Ważności cookies (dni)",
+"Cooking", "Gotowanie",
+"Copy codec type", "Kopiuj typ kodeka",
+"Copy layout", "Kopiuj układ",
+"Create SDTV/HDTV/Radio tags.", "Utwórz tagi SDTV/HDTV/Radio.",
+"Create a provider name tag.", "Utwórz tag dostawcy.",
+"Create bouquet", "Utwórz bouquet",
+"Create directories using these permissions.", "Utwórz katalogi używając tych uprawnień.",
+"Create files using these permissions.", "Utwórz pliki używając tych uprawnień.",
+"Create network name tags", "Utwórz nazwy tagów sieci",
+"Create network name tags (set by provider).", "Utwórz nazwy tagów sieci (ustaw po dostawcy).",
+"Create network tags", "Utwórz tagi sieci",
+"Create provider name tags", "Utwórz nazwy tagów dostawców",
+"Create provider tags", "Utwórz tagi dostawców",
+"Created", "Utworzony",
+"Creator", "Autor",
+"Cron multi-line", "Wielo-liniowy Cron",
+"Culture (without music)", "Kultura (bez muzyki)",
+"Current RTSP port.", "Obecny port RTSP.",
+"Current affairs", "Sprawy bieżące",
+"Current tuner configuration.", "Obecna konfiguracja tunera.",
+"Custom HTTP headers", "Własny nagłówek HTTP",
+"DES key", "Klucz DES",
+"DSCP/TOS for streaming", "DSCP/TOS dla streamingu",
+"DVB scan files", "DVB skan plików",
+"DVB scan files path", "DVB ścieżka skanowania plików",
+"DVB-C network", "Sieć DVB-C",
+"DVB-S 4-port", "DVB-S 4-porty",
+"DVB-S advanced", "DVB-S zaawansowane ",
+"DVB-S network", "Sieć DVB-S",
+"DVB-S satellite configuration", "DVB-S konfiguracja satelity",
+"DVB-S simple", "DVB-S przykład",
+"DVB-T network", "Sieć DVB-T",
+"DVR Auto-record entry", "Wpis DVR auto-zapis",
+"DVR behavior", "DVR zachowanie",
+"DVR configuration", "DVR konfiguracja ",
+"DVR configuration profile", "DVR profil konfiguracji",
+"DVR configuration profiles", "DVR profile konfiguracji",
+"DVR file retention period", "Okres przechowywania plików DVR",
+"DVR log retention", "DVR pamięć logów",
+"DVR log retention period", "Okres przechowywania logów DVR",
+"DVR override: high", "DVR nadpisywanie: wysoki",
+"DVR override: important", "DVR nadpisywanie: nieważny",
+"DVR override: low", "DVR nadpisywanie: niski",
+"DVR override: normal", "DVR nadpisywanie: normalny",
+"DVR override: unimportant", "DVR nadpisywanie: nieważny",
+"DVR time record entry", "DVR wpis czasowe nagrania",
+"Dance", "Taniec",
+"Data errors", "Dane błędów",
+"Days of Week", "Dni tygodnia",
+"Days of week", "Dni tygodnia",
+"Debate", "Debata",
+"Debug libav log", "Debuguj log libav",
+"Debug log path", "Ścieżka logu debugowania",
+"Debug options", "Opcje debugowania",
+"Debug subsystems", "Debuguj podsystemy",
+"Debug to syslog", "Debuguj do syslog",
+"Debug trace (low-level)", "Wyszukiwanie błędów (niski poziom)",
+"Debugging", "Debugowanie",
+"Default", "Domyślny",
+"Default language(s)", "Domyślny(e) język(i)",
+"Default language.", "Domyślny język.",
+"Default priority", "Domyślny priorytet",
+"Default user interface level.", "Domyślny poziom interfejsu użytkownika.",
+"Delivery system", "System przeznaczenia",
+"Demux path", "Ścieżka Demux",
+"Descramble services (limit per mux)", "Usługi dekodujące (limit na muxa)",
+"Descrambler buffer (TS packets)", "Bufor deszyfratora (pakiety TS)",
+"Description", "Opis",
+"Detective", "Detektyw",
+"Device ID", "ID Urządzenia",
+"Device model", "Model urządzenia",
+"Device path", "Ścieżka urządzenia",
+"Directory", "Katalog",
+"Directory permissions (octal, e.g. 0775)", "Uprawnienia katalogu (ósemkowe, np. 0775)",
+"Disable", "Wyłącz",
+"Disable DVB bouquets", "Wyłącz DVB bouquets",
+"Disable SAT>IP client", "Wyłącz SAT>IP klient",
+"Disable all access control checks", "Wyłącz wszystkie sprawdzania kontroli dostępu",
+"Disable debug on stderr", "Wyłącz debugowanie na stderr",
+"Disable syslog (all messages)", "Wyłącz syslog (wszystkie wiadomości)",
+"Disabled", "Wyłączony",
+"Discussion", "Dyskusja",
+"Do not use", "Nie używaj",
+"Documentary", "Dokumentalny",
+"Don't backup configuration tree at upgrade", "Nie wykonuj backupu drzewa konfiguracji przy aktualizacji",
+"Don't include title in filename", "Nie dołączaj tytułu do nazwy pliku",
+"Don't keep", "Nie trzymaj",
+"Don't re-record", "Nie nagrywaj ponownie",
+"Don't reschedule", "Nie planuj ponownie",
+"Drama", "Dramat",
+"Duplicate handling", "Duplicate Handling",
+"EPG Language (priority order)", "Język EPG (priorytet zamówienia)",
+"EPG data ID.", "ID danych EPG.",
+"EPG grabber channel", "EPG grabber kanału",
+"EPG grabber configuration", "Konfiguracja EPG grabber",
+"EPG name", "Nazwa EPG",
+"EPG scan", "EPG skan",
+"EPG scan timeout in seconds (30-7200)", "Limit czasu skanowania EPG w sekundach (30-7200)",
+"EPG source", "Źródło EPG",
+"EPG update window", "Okno aktualizacji EPG",
+"Economics", "Ekonomika",
+"Education", "Edukacja",
+"Educational", "Edukacyjny",
+"Elementary stream filter", "Filtr strumienia podstawowego",
+"Enable (auto)", "Włączony (automatyczny)",
+"Enable DBus", "Włącz DBus",
+"Enable NTP driver", "Włącz sterownik NTP",
+"Enable coredumps for daemon", "Włącz coredumps dla demona",
+"Enable debug on stderr", "Włącz debugowanie na stderr",
+"Enable debug subsystems", "Włącz debugowanie podsystemów",
+"Enable debug to file", "Włącz debugowanie do pliku",
+"Enable debug to syslog", "Włącz debugowanie do sysloga",
+"Enable or disable fast input switching.", "Włącz lub wyłącz szybkie przełączanie wejścia.",
+"Enable or disable full mux mode.", "Włącz lub wyłącz tryb full mux.",
+"Enable or disable the mux.", "Włącz lub wyłącz mux.",
+"Enable or disable this configuration.", "Włącz lub wyłącz tą konfigurację.",
+"Enable syslog", "Włącz syslog",
+"Enable this filter.", "Włącz ten filtr.",
+"Enable trace subsystems", "Włącz śledzenie podsystemów",
+"Enable web UI debug (non-minified JS)", "Włącz debugowanie web UI (non-minified JS)",
+"Enable/disable LNA.", "Włącz/wyłącz LNA.",
+"Enable/disable profile.", "Włącz/wyłącz profil.",
+"Enable/disable the channel.", "Włącz/wyłącz kanał.",
+"Enable/disable the device.", "Włącz/wyłącz urządzenie.",
+"Enable/disable the entry.", "Włącz/wyłącz wpis.",
+"Enable/disable the grabber.", "Włącz/wyłącz grabber.",
+"Enable/disable the profile.", "Włącz/wyłącz profil.",
+"Enable/disable timeshift.", "Włącz/wyłącz timeshift.",
+"Enable/disable tuner/adapter.", "Włącz/wyłącz tuner/adapter.",
+"Enabled", "Włączony",
+"Encrypted", "Zaszyfrowany",
+"Encrypted service", "Usługa kodowana",
+"Entertainment programs for 10 to 16", "Programy rozrywkowe od 10 do 16",
+"Entertainment programs for 6 to 14", "Programy rozrywkowe od 6 do 14",
+"Environment", "Środowisko",
+"Environment (pipe)", "Środowisko (pipe)",
+"Episode", "Odcinek",
+"Episode %d", "Odcinek %d",
+"Error code", "Kod błędu",
+"Errors", "Błędy",
+"Even key", "Parzysty klucz",
+"Every day", "Codziennie",
+"Exclude channel tags", "Wyklucz tagi kanałów",
+"Expeditions", "Wyprawy",
+"Experimental film", "Eksperymentalny film",
+"Expert", "Ekspert",
+"Exported tuners", "Eksportowane tunery",
+"External", "Zewnętrzny",
+"External EPG grabber", "Zewnętrzny Grabber EPG",
+"External IP (NAT)", "Zewnętrzne IP (NAT)",
+"External URL", "Zewnętrzny URL",
+"Extra arguments", "Ekstra czas rozpoczęcia",
+"Extra start time", "Ekstra czas rozpoczęcia",
+"Extra stop time", "Ekstra czas zakończenia",
+"Extra warming up time (seconds)", "Ekstra czas rozgrzania (sekundy)",
+"FAIL", "Błąd",
+"FEC high", "FEC High",
+"FEC low", "FEC Low",
+"Factual topics", "Faktyczne tematy",
+"Failed", "Błędne",
+"Failed DVR", "Błędne DVR",
+"Fast input switch", "Przełącz szybkie wprowadzanie",
+"File missing", "Plik utracony",
+"File not created", "Plik nie utworzony",
+"File permissions (octal, e.g. 0664)", "Uprawnienia pliku (ósemkowe, np. 0664)",
+"File size", "Rozmiar pliku",
+"Filename", "Nazwa pliku",
+"Filename character set", "Ustawienie znaków nazwy plików",
+"Filename options", "Opcje nazwy plików",
+"Fine arts", "Piękne sztuki",
+"Finished", "Zakończone",
+"Fit to RAM (cut rewind)", "Dopasuj do RAM (cut rewind)",
+"Fitness and health", "Fitness i zdrowie",
+"Folkloric", "Folklorystyczny",
+"Football", "Piłka nożna",
+"Force (auto)", "Wymuś (automatycznie)",
+"Force CA ID (e.g. 0x2600)", "Wymuś CA ID (np. 0x2600)",
+"Force old status", "Wymuś stary status",
+"Force pilot for DVB-S2", "Wymuś pilota dla DVB-S2",
+"Force priority", "Wymuś priorytet",
+"Force teardown delay", "Wymuś czas zwłoki porzucenia",
+"Foreign countries", "Obce kraje",
+"Fork and run as daemon", "Fork i uruchom jako demon",
+"Format string", "Format składni",
+"Frequency", "Częstotliwość",
+"Frequency (Hz)", "Częstotliwość (Hz)",
+"Frequency (MHz)", "Częstotliwość (MHz)",
+"Frequency (kHz)", "Częstotliwość (kHz)",
+"Fri", "Pt.",
+"Friendly name", "Przyjazna nazwa",
+"Frontend number", "Numer nakładki",
+"Frontend path", "Ścieżka nakładki",
+"Full mux RX mode supported", "Tryb obsługi pełnego mux Rx",
+"Full pathname specification", "Pełna specyfikacja nazwy ścieżki",
+"Full-text", "Pełny tekst",
+"Further education", "Dalsza edukacja",
+"GOTOX position", "Pozycja GOTOX",
+"GOTOX rotor", "Rotor GOTOX",
+"Game show", "Teleturniej",
+"Gardening", "Ogrodnictwo",
+"General", "Ogólne",
+"General configuration", "Ogólna konfiguracja",
+"Generic", "Ogólne",
+"Generic options", "Opcje ogólne",
+"Guard interval", "Straż interwału",
+"HDHomeRun DVB frontend", "Nakładka HDHomeRun DVB",
+"HDHomeRun DVB-C frontend", "Nakładka HDHomeRun DVB-C",
+"HDHomeRun DVB-T frontend", "Nakładka HDHomeRun DVB-T",
+"HTSP Default Stream Settings", "HTSP domyślne ustawienia strumienia",
+"HTSP stream profile", "HTSP profil strumienia",
+"HTSP streaming", "HTSP strumieniowanie",
+"Handicraft", "Rękodzieła",
+"Hearing impaired", "Niedosłyszący",
+"Hierarchy", "Hierarchia",
+"High", "Wysoki",
+"Historical movie", "Film historyczny",
+"Hostname/IP", "Nazwa hosta/IP",
+"IDLE", "BEZCZYNNY",
+"IP address", "Adres IP",
+"IP blocking", "Blokowanie IP",
+"IPTV Multiplex", "IPTV multiplex",
+"IPTV automatic network", "IPTV automatyczna sieć",
+"IPTV input", "IPTV wejście",
+"IPTV network", "Sieć IPTV",
+"ISI (Stream ID)", "ISI (Strumieniuj ID)",
+"Icon", "Ikona",
+"Icon (full URL)", "Ikona (pełny URL)",
+"Icon URL", "URL ikony",
+"Icon base URL", "Podstawowy URL ikony",
+"Icon has title", "Ikona ma tytuł",
+"Icons from", "Ikony z",
+"Idle", "Bezczynny",
+"Idle scan", "Bezczynne skanowanie",
+"Idle scan muxes", "Bezczynne skanowanie muxów",
+"If you'd like to support the project, please consider a donation.", "Jeśli chcesz wesprzeć projekt, proszę rozważ darowiznę.",
+"Ignore EPG (EIT)", "Ignoruj EPG (EIT)",
+"Ignore invalid SSL certificate", "Ignoruj nieprawidłowy certyfikat SSL",
+"Ignore provider's channel numbers", "Ignoruj numery kanałów dostwców",
+"Image cache", "Buforowanie obrazów",
+"Immediately abort", "Natychmiast przerwać",
+"Important", "Ważny",
+"Include channel name in filename", "Zawieraj nazwę kanału w nazwie pliku",
+"Include date in filename", "Zawieraj datę w nazwie pliku",
+"Include episode in filename", "Zawieraj epizod w nazwie pliku",
+"Include subtitle in filename", "Zawieraj podtytuł w nazwie pliku",
+"Include time in filename", "Zawieraj godzinę w nazwie pliku",
+"Index", "Indeks",
+"Information area", "Informacje o przestrzeni",
+"Informational", "Informacyjny",
+"Initial scan", "Wstępne skanowanie",
+"Input base", "Podstawowe wejście",
+"Input buffer (bytes)", "Bufor wejścia (bajty)",
+"Input instance", "Wejście instancji",
+"Input path", "Ścieżka wejścia",
+"Interface", "Interfejs",
+"Internal", "Wewnętrzny",
+"Internal EPG grabber", "Wbudowany grabber EPG",
+"Internal grabber", "Wbudowany grabber",
+"Interview", "Wywiad",
+"Invalid", "Nieprawidłowy",
+"Invalid adapter number '%s'\n", "Błędny numer adaptera '%s'\n",
+"Invalid target", "Nieprawidłowy cel",
+"Keep", "Zachowaj",
+"Kill signal (pipe)", "Zabij sygnał (pipe)",
+"Kill timeout (pipe/secs)", "Zabij timeout (pipe/secs)",
+"LNA (low noise amplifier)", "LNA (Low noise amplifier)",
+"LNB type", "LNB typ",
+"Language", "Język",
+"Language settings", "Ustawienia języka",
+"Languages", "Języki",
+"Last seen", "Ostatnio widziany",
+"Last updated from", "Ostatnia aktualizacja",
+"Leisure hobbies", "Hobby czas wolny",
+"Limit connections", "Limit połączeń",
+"Linked input", "Powiązane wejścia",
+"LinuxDVB network", "LinuxDVB sieć",
+"Listen / Connect port", "Słuchaj/Połącz port",
+"Listen on IPv6", "Nasłuchuj na IPv6",
+"Literature", "Literatura",
+"Local bind IP address", "Powiąż lokalny adres IP",
+"Local channel number", "Lokalny numer kanału",
+"Local discovery IP address", "Odkryj lokalny adres IP",
+"Location", "Lokalizacja",
+"Lock preferred CA PID", "Blokada preferowanych CA PID",
+"Login/Logout", "Zaloguj/Wyloguj",
+"Low", "Niski",
+"Magazines", "Magazyny",
+"Maintained space", "Utrzymywanie miejsca",
+"Make subdirectories per channel", "Utwórz podkatalog dla kanału",
+"Make subdirectories per day", "Utwórz podkatalog dla dnia",
+"Make subdirectories per title", "Utwórz podkatalog dla tytułu",
+"Manufacturer", "Producent",
+"Manufacturer URL", "URL producenta",
+"Map all services", "Mapuj wszystkie serwisy",
+"Map radio channels", "Mapuj kanały radiowe",
+"Map unnamed channels", "Mapuj nie nazwane kanały",
+"Master tuner", "Główny tuner",
+"Matroska specific", "Matroska specyfikacja",
+"Maximal channel number", "Maksymalny numer kanału",
+"Maximum # input streams", "Maksymalnie # wejścia strumieni",
+"Maximum PIDs", "Maksymalny PIDs",
+"Maximum RAM size (MB)", "Max. rozmiar pamięci RAM (MB)",
+"Maximum bandwidth (Kbps)", "Maksymalna przepustowość (Kbps)",
+"Maximum count (0=default)", "Maksymalny licznik (0=bez limitu)",
+"Maximum duration", "Maksymalny czas trwania",
+"Maximum length of PIDs", "Maksymalna długość PIDs",
+"Maximum period (mins)", "Max. okres (minuty)",
+"Maximum schedules limit (0=default)", "Maksymalny limit harmonogramu (0=bez limitu)",
+"Maximum size (MB)", "Max. rozmiar (MB)",
+"Maximum timeout (seconds)", "Maksymalny timout (sekundy)",
+"Medicine", "Medycyna",
+"Melodrama", "Melodramat",
+"Minimal channel number", "Minimalny numer kanału",
+"Minimum duration", "Minimalny czas trwania",
+"Minimum rotor time (seconds)", "Minimum rotor time (sekundy)",
+"Mode", "Tryb",
+"Model description", "Opis modelu",
+"Model name", "Nazwa modelu",
+"Model number", "Numer modelu",
+"Modulation", "Modulacja",
+"Module", "Moduł",
+"Module ID", "ID Modułu",
+"Mon", "Pon.",
+"More verbose libav log", "Więcej komunikatów logu libav",
+"Motor sport", "Sporty motorowe",
+"Motoring", "Jazda samochodem",
+"Movie", "Film",
+"Music", "Muzyka",
+"Musical", "Muzyczny",
+"Mux handling", "Obsługa muxa",
+"Mux name", "Nazwa muxa",
+"Mux not enabled", "Mux nie włączony",
+"Mux schedule entry", "Wpis harmonogramu muxa",
+"NONE", "ŻADEN",
+"Name", "Nazwa",
+"Names", "Nazwy",
+"Natural sciences", "Nauki przyrodnicze",
+"Nature", "Natura",
+"Network", "Sieć",
+"Network A", "Sieć A",
+"Network B", "Sieć B",
+"Network ID (limit scanning)", "ID sieci (limit skanowania)",
+"Network UUID", "UUID sieci",
+"Network discovery", "Odkryj sieć",
+"Network name", "Nazwa sieci",
+"Network prefix", "Prefix sieci",
+"Network type", "Typ sieci",
+"Networks", "Sieci",
+"New / premiere / unknown", "Nowość / premiera / nieznany",
+"News", "Informacje",
+"News magazine", "Magazyn informacyjny",
+"Next tune delay in ms (0-2000)", "Opóźnienie następnego strojenia w ms (0-2000)",
+"No", "Nie",
+"No PIN", "Brak PINu",
+"No access", "Brak dostępu",
+"No adapters specified!\n", "Brak sprecyzowanych adapterów!\n",
+"No assigned adapters", "Brak przypisanych adapterów",
+"No days", "Brak dni",
+"No descrambler", "Brak deszyfratora",
+"No free adapter", "Brak wolnego adaptera",
+"No input detected", "Brak wykrytego wejścia",
+"No service assigned to channel", "Brak usług przypisanych do kanału",
+"No service enabled", "Brak włączonych usług",
+"No source available", "Brak dostępnego źródła",
+"None", "Żaden",
+"Normal", "Normalny",
+"Not linked", "Nie powiązane",
+"Not set", "Nie ustawiony",
+"Not set (none or channel configuration)", "Nie ustawiony (brak lub konfiguracja kanału)",
+"Not set (use channel or DVR configuration)", "Nie ustawiony (użyj kanału lub konfiguracji DVR)",
+"Number", "Numer",
+"Number of tsfile tuners", "Numer tunera tsfile",
+"OK (partial)", "OK (częściowe)",
+"Odd key", "Nieparzysty klucz",
+"Off", "Wył.",
+"Older OSCam", "Starszy OSCam",
+"On", "Wł.",
+"On-demand (no first rewind)", "Na żądanie (no first rewind)",
+"Only Bulsatcom 39E", "Tylko Bulsatcom 39E",
+"Only EIT", "Tylko EIT",
+"Only OpenTV Sky Ausat", "Tylko OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Tylko OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Tylko OpenTV Sky UK",
+"Only PSIP (ATSC)", "Tylko PSIP (ATSC)",
+"Only UK Freesat", "Tylko UK Freesat",
+"Only UK Freeview", "Tylko UK Freeview",
+"Only Viasat Baltic", "Tylko Viasat Baltic",
+"OpenTV channel number", "Numer Kanału OpenTV",
+"Orbital position", "Pozycja orbitalne",
+"Orbital positions", "Pozycje orbitalne",
+"Original network ID", "Oryginalne ID sieci",
+"Other stream filter", "Inny Filtr Strumienia",
+"Output directory for tsdebug", "Katalog wyjściowy dla tsdebug",
+"Over-the-air Cron multi-line", "Wielo-liniowy Cron Over-the-air",
+"Owner", "Właściciel",
+"PEND", "WSTRZYMANY",
+"PIDs 21 in setup", "PIDs 21 w ustawieniach",
+"PIDs in setup", "PIDs w ustawieniach",
+"PLS code", "Kod PLS",
+"PLS mode", "Tryb PLS",
+"Parent entry", "Wpis rodzica",
+"Password", "Hasło",
+"Password2", "Hasło 2",
+"Passwords", "Hasła",
+"Path", "Ścieżka",
+"Performing arts", "Koncerty i spektakle",
+"Periodically save EPG to disk (hours)", "Okresowy zapis EPG na dysku (godziny)",
+"Persistent user interface level", "Stały poziom intefejsu użytkownika",
+"Physiology", "Fizjologia",
+"Picon name scheme", "Nazwa schematu Picon",
+"Picon path (see Help)", "Ścieżka Picon (patrz Pomoc)",
+"Polarization", "Polaryzacja",
+"Political issues", "Kwestie polityczne",
+"Popular culture", "Popularna kultura",
+"Position", "Pozycja",
+"Post-processor command", "Komenda po procesie",
+"Post-recording padding", "Nagrywanie po",
+"Post-remove command", "Komenda po usunięciu",
+"Power save", "Oszczędzanie energii",
+"Power-up time (ms) (15-200)", "Czas pierwszego uruchomienia (ms) (15-200)",
+"Pre-defined muxes", "Predefiniowane muxy",
+"Pre-recording padding", "Nagrywanie przed",
+"Prefer picons over channel name", "Preferuj Picony zamiast nazw kanałów",
+"Preferred CA PID", "Preferowany CA PID",
+"Preferred service video type", "Preferowany rodzaj usługi wideo",
+"Presentation", "Prezentacja",
+"Press", "Prasa",
+"Priority", "Priorytet",
+"Priority (-10..10)", "Priorytet (-10..10)",
+"Private", "Prywatny",
+"Profile name", "Nazwa profilu",
+"Provider", "Dostawca",
+"Provider ID", "ID Dostawcy",
+"Provider network name", "Nazwa dostawcy sieci",
+"Psychology", "Psychologia",
+"Puppets", "Kukiełki",
+"RAM only", "Tylko RAM",
+"RTSP port", "Port RTSP",
+"RTSP port (554 or 9983, 0 = disable)", "RTSP port (554 lub 9983), 0 = wyłaczony",
+"RTSP/TCP (embedded data)", "RTSP/TCP (wbudowane dane)",
+"Re-fetch period (hours)", "Ponowne pobieranie (godziny)",
+"Re-fetch period (mins)", "Okres ponownego pobierania (minuty)",
+"Re-record%s%s", "Nagraj ponownie%s%s",
+"Re-try period (hours)", "Ponowny okres prób (godziny)",
+"Record all", "Nagraj wszystko",
+"Recording file options", "Opcje nagrywania plików",
+"Recording system path", "Systemowa ścieżka nagrywania",
+"Reject", "Odrzuć",
+"Religion", "Religia",
+"Religious", "Religijny",
+"Remarkable people", "Niezwykli ludzie",
+"Remove HTTP arguments", "Usuń argument HTTP",
+"Remove all unsafe characters from filename", "Usuń wszystkie niedozwolone znaki z nazwy pliku",
+"Replace whitespace in title with '-'", "Zastąp odstępy w tytułach znakiem '-'",
+"Reports", "Raporty",
+"Rerun of", "Powtórka",
+"Rescan", "Ponowne skanowanie",
+"Reserved", "Zarezerwowany",
+"Resolution (height)", "Rozdzielczość (wysokość)",
+"Restart on error", "Restartuj przy błędzie",
+"Reuse EPG from", "Ponownie użyj EPG od",
+"Rewrite EIT", "Przepisz EIT",
+"Rewrite PAT", "Przepisz PAT",
+"Rewrite PMT", "Przepisz PMT",
+"Rewrite SDT", "Przepisz SDT",
+"Romance", "Romans",
+"Rotor initialization time (seconds)", "Czas inicjalizacji rotora (sekundy)",
+"Rotor type", "Typ rotora",
+"Run as group", "Uruchom jako grupa",
+"Run as user", "Uruchom jako użytkownik",
+"Running", "Uruchomiony",
+"SAT>IP DVB-T frequency (Hz)", "SAT>IP DVB-T częstotliwość (Hz)",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP numer portu dla serwera\n(default: -1 = wyłączony, 0 = webconfig, standardowy port 554)",
+"SAT>IP source number", "SAT>IP źródłowy numer",
+"SSL verify peer", "Weryfikacja SLL",
+"Sat", "Sob.",
+"Satellite longitude", "Długość satelity",
+"Satellite positions", "Pozycje satelity",
+"Scan after creation", "Skanuj po utworzeniu",
+"Scan queue length", "Długość skanowania kolejki",
+"Scan result", "Wynik skanowania",
+"Scan status", "Status skanowania",
+"Schedule a re-recording if more errors than (0=off)", "Harmonogram ponownego nagrywania jeśli błędów więcej niż (0=wył.)",
+"Schedule status", "Status harmonogramu",
+"Scheduled for recording", "Zaplanowane do nagrywania",
+"Scheduled start time", "Zaplanowany czas rozpoczęcia",
+"Scheduled stop time", "Zaplanowany czas zakończenia",
+"School programs", "Programy szkolne",
+"Science", "Nauka",
+"Script/program to be run when a recording completes.", "Skrypt/program do uruchomienia kiedy nagrywanie zostanie zakończone.",
+"Script/program to be run when a recording gets removed.", "Skrypt/program do uruchomienia kiedy nagranie zostanie usunięte.",
+"Season", "Sezon",
+"Season %d", "Sezon %d",
+"Send CAPMT query", "Wyślij zapytanie CAPMT",
+"Send full PLAY cmd", "Wyślij pełny cmd PLAY",
+"Serial number", "Numer seryjny",
+"Serious", "Poważna",
+"Serious music", "Muzyka poważna",
+"Server", "Serwer",
+"Server UUID", "Serwer UUID",
+"Server connectivity", "Łączność serwera",
+"Service", "Usługa",
+"Service ID", "ID Usługi",
+"Service configuration", "Konfiguracja usługi",
+"Service count %zi", "Licznik usług %zi",
+"Service name", "Nazwa usługi",
+"Service name picons", "Nazwa serwisu picons",
+"Service raw", "Usługa raw",
+"Service type", "Typ usługi",
+"Services", "Usługi",
+"Settings", "Ustawienia",
+"Show this page", "Pokaż tą stronę",
+"Show version information", "Pokaż informacje wersji",
+"Signal quality too poor", "Zbyt słaba jakość sygnału",
+"Signal scale (240 or 100)", "Skala Sygnału (240 lub 100)",
+"Site latitude", "Strona szerokości",
+"Site longitude", "Strona długości",
+"Skip TS packets (0-200)", "Pomiń pakiety TS (0-200)",
+"Skip commercials", "Pomiń reklamy",
+"Skip initial bytes", "Pomiń wstępne bajty",
+"Skip initial scan", "Pomiń wstępne skanowanie",
+"Slave entry", "Slave wpis",
+"Slot state", "Stan gniazda",
+"Soap", "Mydło",
+"Soccer", "Piłka nożna",
+"Social", "Społeczny",
+"Social advisory", "Doradztwo społeczne",
+"Sort index", "Sortuj index",
+"Source", "Źródło",
+"Source deleted", "Źródło usunięte",
+"Source quality is bad", "Źródło jest złej jakości",
+"Source reconfigured", "Źródło przekonfigurowane",
+"Special events (Olympic Games, World Cup, etc.)", "Wydarzenia specjalne (Igrzyska Olimpijskie, Mistrzostwa Świata, itp)",
+"Specify User-Agent header for the http client", "Określ nagłówek User-Agent dla klienta http",
+"Specify alternative htsp port", "Określ alternatywny port htsp",
+"Specify alternative http port", "Określ alternatywny port http",
+"Specify alternative http webroot", "Określ alternatywny http webroot",
+"Specify bind address", "Określ powiązania adresu",
+"Specify extra htsp port", "Podaj dodatkowy port htsp",
+"Spiritual sciences", "Nauki duchowe",
+"Sports", "Sporty",
+"Sports magazines", "Magazyn sportowy",
+"Start", "Początek",
+"Start after", "Rozpocznij po",
+"Start before", "Rozpocznij przed",
+"Start time", "Czas rozpoczęcia",
+"Status period (ms)", "Status okresu (ms)",
+"Stop", "Zatrzymaj",
+"Stop time", "Czas zakończenia",
+"Storage path", "Ścieżka przechowywania",
+"Storage space", "Przestrzeń przechowywania",
+"Stream index", "Indeks strumienia",
+"Stream profile", "Profil strumienia",
+"Stream type", "Typ strumienia",
+"Streaming", "Strumieniowanie",
+"Streaming priority", "Priorytet strumieniowania",
+"Streaming profiles", "Profile strumieniowania",
+"Subdirectory options", "Opcje podkatalogów",
+"Subscribe to a service permanently", "Zapisz się do usługi na stałe",
+"Subscription overridden", "Subskrypcja nadpisana",
+"Subscription weight", "Waga subskrypcji",
+"Substitute formatters", "Zastępowanie formatek",
+"Subtitle", "Podtytuł",
+"Subtitle codec", "Kodek napisów",
+"Subtitle stream filter", "Filtr strumienia napisów",
+"Sun", "Nd.",
+"Surround (2 front, rear mono)", "Surround (2 front, tył mono)",
+"Switch before rotor", "Przełącz przed rotorem",
+"Switch type", "Typ przełącznika",
+"Switch: %s", "Przełącznik: %s",
+"Tag files with metadata", "Tagi pików z metadanymi",
+"Tags", "Tagi",
+"Team sports (excluding football)", "Drużyny sportowe (z wyłączeniem piłki nożnej)",
+"Technology", "Technologia",
+"Teletext stream filter", "Filtr strumienia teletextu",
+"Tennis", "Tenis",
+"Testing", "Testowanie",
+"Testing options", "Opcje testowania",
+"This tuner", "Ten tuner",
+"Thu", "Czw.",
+"Time", "Czas",
+"Time missed", "Czas minął",
+"Time record caption", "Czas nagrywania podpisu",
+"Time recording%s%s", "Czas nagrywania%s%s",
+"Time update", "Aktualizacja czasu",
+"Timeout (sec) (0=infinite)", "Timeout (sek) (0=nieskończony)",
+"Timeout (seconds)", "Timeout (sekundy)",
+"Timout (secs)", "Timout (sek)",
+"Title", "Tytuł",
+"Title (regexp)", "Tytuł (regexp)",
+"Toggle details", "Pokaż szczegóły",
+"Tourism / Travel", "Turystyka / Podróże",
+"Trace subsystems", "Śledź podsystemy",
+"Traditional arts", "Sztuka tradycyjna",
+"Traditional music", "Muzyka tradycyjna",
+"Transcoding", "Transkodowanie",
+"Transmission mode", "Tryb transmisji",
+"Transponder ID", "ID transpordera",
+"Transport stream ID", "ID transportu strumienia",
+"Tue", "Wt.",
+"Tuner bind IP address", "Powiąż tuner z adresem IP",
+"Tuner configuration", "Konfiguracja tunera",
+"Tuning failed", "Nie udane strojenie",
+"Turn off LNB when idle", "Wyłącz LNB kiedy bezczynny",
+"Tvheadend server name", "Nazwa serwera Tvheadend",
+"Type", "Typ",
+"UDP RTP port number (2 ports)", "UDP RTP numer portu (2 porty)",
+"URL with the SAT>IP server XML location", "URL z SAT> IP serwera lokalizacji XML",
+"Unicable switch (universal LNB, experimental)", "Przełącznik unicabel (universal LNB, experimental)",
+"Unicable type", "Typ unicable",
+"Unimportant", "Nieważny",
+"Universal LNB only", "Tylko uniwersalny LNB",
+"Unknown", "Nieznany",
+"Unknown reason (%i)", "Nieznany powód (%i)",
+"Unlimited size", "Nieograniczony rozmiar",
+"Unlimited time", "Nieograniczony czas",
+"Unset (default)", "Nie ustawiono (domyślne)",
+"Update card (EMM)", "Aktualizuj kartę (EMM)",
+"Update channel icon", "Aktualizuj ikonę kanału",
+"Update channel name", "Aktualizuj nazwę kanału",
+"Update channel number", "Aktualizuj numer kanału",
+"Update disabled", "Aktualizacja wyłączona",
+"Update time", "Aktualizuj czas",
+"Update tolerance (ms)", "Tolerancja aktualizacji (ms)",
+"Updated", "Zaktualizowane",
+"Usage: %s [OPTIONS]\n", "Użycie: %s [OPCJONALNIE]\n",
+"Use EPG running state", "Użyj stanu uruchomienia EPG",
+"Use Windows-compatible filenames", "Użyj kompatybilności nazw plików Windows",
+"Use XSPF playlist instead of M3U", "Użyj zamiast XSPF listy odtwarzania M3U",
+"Use original", "Użyj oryginalnego",
+"Use service IDs as channel numbers", "Użyj ID usług jako numery kanałów",
+"User access error", "Błąd dostępu użytkownika",
+"User icon", "Ikona użytkownika",
+"User interface level", "Poziom interfejsu użytkownika",
+"User interface quick tips", "Szybkie porady interfejsu użytkownika",
+"User language", "Język użytkownika",
+"User limit reached", "Osiągnięto limit użytkowników",
+"Username", "Nazwa użytkownika",
+"Variety show", "Różnorodne pokazy",
+"Video", "Wideo",
+"Video codec", "Kodek video",
+"Video recorder", "Nagrywarka wideo",
+"Video stream filter", "Filtr strumienia wideo",
+"Visually impaired commentary/audio description", "Niedowidzący komentarz / opis dźwięku",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV profil H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV profil H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV profil VP8/Vorbis/WEBM",
+"Waiting for EPG running flag", "Oczekiwanie na flagę działania EPG",
+"Waiting for program start", "Czekam na start programu",
+"Waiting for stream", "Czekam na Strumień",
+"War", "Wojenny",
+"Water sport", "Wodny sport",
+"Weak stream", "Słaby strumień",
+"Weather report", "Pogoda",
+"Web interface", "Web interfejs",
+"Web interface language", "Język interfejsu Web",
+"Web user interface", "Interfejs Web użytkownika",
+"Wed", "Śr.",
+"When nothing else is happening Tvheadend will continuously rotate among all muxes and tune to them to verify that they are still working when the inputs are not used for streaming. If your adapters have problems with lots of (endless) tuning disable this. Note that this option should be OFF for the normal operation. This type of mux probing is not required and it may cause issues for SAT>IP (limited number of PID filters).", "Gdy nic innego nie dzieje się Tvheadend będzie stale obracać wśród wszystkich muxes i dostrajać się do nich, aby sprawdzić, czy są one nadal działające, gdy dane wejściowe nie są wykorzystywane do transmisji strumieniowej. Jeśli adaptery mają problemy z dużą ilością (Kompletne) strojenie to należy wyłączyć. Należy pamiętać, że opcja ta powinna być wyłączona do normalnego funkcjonowania. Tego typu MUX próbkowania nie jest wymagane i może powodować problemy dla SAT> IP (ograniczona liczba filtrów PID).",
+"Writes the current in-memory EPG database to disk every x hours, so should a crash/unexpected shutdown occur EPG data is saved periodically to the database (re-read on next startup). Set to 0 to disable.", "Zapisuje aktualną bazę danych EPG w pamięci na dysku co x godzin, więc w przypadku wystąpienia awarii/nieoczekiwanego zamknięcia dane EPG są okresowo zapisane w bazie danych (ponowne odczytanie następuje przy następnym uruchomieniu). Ustaw na 0, aby wyłączyć.",
+"Yes", "Tak",
+"hrs", "godz",
+"invalid option specified [%s]", "Podano nieprawidłową opcję [%s]",
+"mins", "minut",
+"option %s requires a value", "opcja %s wymaga wartości",
+"tvhdhomerun client", "klient tvhdhomerun",
+NULL, NULL
+};
+
+static const char *tvh_locale_19[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nPara mais informações visite o site do Tvheadend:\nhttps://tvheadend.org\n",
+"# Channels", "# Canais",
+"# Services", "# Serviços ",
+"1 day", "1 dia",
+"1 year", "1 ano",
+"2 weeks", "2 semanas",
+"2 years", "2 anos",
+"3 days", "3 dias",
+"3 weeks", "3 semanas",
+"3 years", "3 anos",
+"5 days", "5 dias",
+"AC-3 = descriptor 6", "AC-3 = descritor 6",
+"ACTIVE", "ACTIVO",
+"ANY", "QUALQUER UM",
+"Aborted by user", "Abortado pelo utilizador",
+"Access", "Acesso",
+"Action", "Acção",
+"Adapter in use by another subscription", "Adaptador ocupado por outra subscrição",
+"Add file and line numbers to debug", "Adicionar ficheiro e número de linhas para depuração",
+"Add the thread ID to debug", "Adicionar o ID do processo para depuração",
+"Admin", "Administrador",
+"Adult movie", "Filme Pornográfico",
+"Advanced", "Avançado",
+"Adventure", "Aventura",
+"Advertisement / Shopping", "Publicidade",
+"All (Streaming plus DVR)", "Todos (Transmissão mais DVR)",
+"All DVR (rw)", "Todo DVR (rw)",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Todos os lucros são utilizados para apoiar a infra-estrutura do servidor e comprar equipamento de teste",
+"Alternate PID path", "Caminho do pid alternativo",
+"Alternate configuration path", "Caminho da configuração alternativa",
+"Altitude (meters)", "Altitude (metros)",
+"Animals", "Animais",
+"Any", "Qualquer um",
+"Arts", "Artes",
+"Athletics", "Desporto",
+"Auto recording%s%s", "Gravação automática%s%s",
+"Bad", "Mau",
+"Bandwidth", "Largura de Banda",
+"Based on software from", "Baseado no software ",
+"Basic", "Básico",
+"Boot ID", "ID de inicialização",
+"Brand", "Marca",
+"Broadcast", "Transmissão",
+"Broadcasting", "Transmissão",
+"Build", "Distribuição",
+"Cartoons", "Desenhos Animados",
+"Channel", "Canal",
+"Channel icon path (see Help)", "Caminho do ícone do canal (ver ajuda)",
+"Channel number", "Nome do Canal",
+"Channel numbers from", "Canais de",
+"Channels", "Canais",
+"Class", "Classe",
+"Classical", "Clássico",
+"Classical music", "Música Clássica",
+"Clean effects", "Limpar efeitos",
+"Comedy", "Comédia",
+"Comment", "Comentário",
+"Commercial break", "Anúncios publicitários",
+"Committed", "Confirmado",
+"Completed OK", "Concluído OK",
+"Configuration", "Configuração",
+"Configuration ID", "ID da Configuração",
+"Configuration version", "Versão da configuração",
+"Constellation", "Constelação",
+"Container", "Recipiente",
+"Content character set", "Conjunto de caracteres do conteúdo",
+"Contest", "Concurso",
+"Cookie expiration (days)", "Os Cookies expiram em (dias)",
+"Cooking", "Cozinha",
+"Copy codec type", "Codec Igual ao Original ",
+"Copy layout", "Copiar layout",
+"Create bouquet", "Criar bouquet",
+"Created", "Criado",
+"Creator", "Criar",
+"Cron multi-line", "Linhas do Cron",
+"Culture (without music)", "Cultura (sem música)",
+"Current affairs", "Assuntos actuais",
+"DBus - use the session message bus instead of the system one", "DBus -Utilizar mensagem da sessão do bus em alternativa ao bus do sistema",
+"DSCP/TOS for streaming", "DSCP/TOS na transmissão",
+"DVB scan files path", "Verificação dos caminhos de ficheiros DVB ",
+"DVB-S 4-port", "DVB-S 4-portas",
+"Dance", "Dança",
+"Days of Week", "Dias da Semana",
+"Debate", "Debates",
+"Debug libav log", "Log de depuração do libav",
+"Debug log path", "Caminho do log de depuração",
+"Debug subsystems", "Depuração dos subsistemas",
+"Debug to syslog", "Depuração para syslog",
+"Debug trace (low-level)", "Rastreamento da depuração (baixo nível)",
+"Debugging", "Depuração",
+"Default", "Por omissão",
+"Default language(s)", "Linguagem(ns) padrão",
+"Descrambler buffer (TS packets)", "Descodificar buffer (pacotes TS)",
+"Description", "Descrição",
+"Detective", "Policial ",
+"Device ID", "ID do Dispositivo",
+"Directory", "Directório",
+"Disable", "Desactivar",
+"Disable DVB bouquets", "Desactivar bouquets DVB",
+"Disable SAT>IP client", "Desactivar cliente SAT>IP",
+"Disable all access control checks", "Desactivar todos os controlos de acesso",
+"Disable device/firmware-specific workarounds", "Desactivar dispositivo/soluções alternativas específicas do firmware",
+"Disable syslog (all messages)", "Desactivar syslog (todas msgs)",
+"Discussion", "Discussão",
+"DiseqC repeats", "Repetição DiseqC",
+"DiseqC switch", "Interruptor DiseqC",
+"Do not use", "Não Utilizar",
+"Documentary", "Documentário",
+"Don't backup configuration tree at upgrade", "Não realizar o backup da árvore de configuração na actualização",
+"Don't keep", "Não manter",
+"EIT - skip TSID check", "EIT - saltar verificação TSID",
+"EPG grabber channel", "canal EPG capturado",
+"EPG scan timeout in seconds (30-7200)", "Tempo limite da verificação EPG (30-7200)",
+"Economics", "Economia",
+"Education", "Educação",
+"Educational", "Educacional ",
+"Enable (auto)", "Activar (auto)",
+"Enable DBus", "Activar DBus",
+"Enable NTP driver", "Activar o driver NTP",
+"Enable coredumps for daemon", "Activar coredumps do serviço",
+"Enable debug on stderr", "Activar depuração no stderr",
+"Enable debug subsystems", "Activar depuração dos subsistemas",
+"Enable debug to file", "Activar depuração para ficheiro",
+"Enable debug to syslog", "Activar depuração para syslog",
+"Enable trace subsystems", "Activar rastreamento dos subsistemas",
+"Enabled", "Activo",
+"Encrypted", "Encriptado",
+"Encrypted service", "Serviço encriptado",
+"Environment", "Ambiente",
+"Environment (pipe)", "Ambiente (pipe)",
+"Episode", "Episódio",
+"Episode %d", "Episódio %d",
+"Errors", "Erros",
+"Every day", "Todos os dias",
+"Expeditions", "Expedições",
+"Experimental film", "Filme alternativo",
+"External", "Externo",
+"External URL", "URL externa",
+"FAIL", "FALHOU",
+"Factual topics", "Temas factuais",
+"Failed DVR", "Falhou DVR",
+"Fantasy", "Fantasia",
+"Fast input switch", "Alteração rápida de entrada",
+"Filename", "Nome do Ficheiro",
+"Film", "Filme",
+"Fine arts", "Belas-Artes",
+"Fitness and health", "Saúde e Fitness",
+"Folkloric", "Folclore",
+"Football", "Futebol",
+"Force (auto)", "Forçar (auto)",
+"Force CA ID (e.g. 0x2600)", "Forçar CA ID (e.g. 0x2600)",
+"Force pilot for DVB-S2", "Forçar DVB-S2",
+"Force teardown delay", "Forçar atraso no teardown",
+"Foreign countries", "Estrangeiro",
+"Fork and run as daemon", "Bifurcar e executar como serviço",
+"Frequency", "Frequência",
+"Frequency (Hz)", "Frequência (Hz)",
+"Frequency (MHz)", "Frequência (MHz)",
+"Frequency (kHz)", "Frequência (kHz)",
+"Fri", "Sexta-Feira",
+"Full DiseqC", "DiseqC Total",
+"Full-text", "Texto Completo",
+"Further education", "Educação avançada",
+"Gardening", "Jardinagem",
+"General", "Geral",
+"Generic", "Genérico",
+"HTSP Default Stream Settings", "Configurações de transmissão HTSP",
+"Handicraft", "Artesanato",
+"Hearing impaired", "Deficiência auditiva",
+"Hierarchy", "Hierarquia ",
+"High", "Elevado",
+"Historical movie", "História",
+"Horror", "Terror",
+"Hostname/IP", "Nome do Servidor / IP",
+"ISI (Stream ID)", "ISI (ID Fluxo)",
+"Icon", "Ícone",
+"Icon (full URL)", "ícone (URL completo)",
+"Icon URL", "URL do ícone",
+"Icon base URL", "URL base do ícone",
+"Icon has title", "Título do ícone",
+"Icons from", "Ícones de",
+"Idle", "Inactivo",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "Se não existir uma conta de utilizador, criar então\numa sem username e password. Utilizar com cuidado\npois pode permitir acessos indevidos de administrador \nà sua conta do Tvheadend, até editar ou criar um controlo de acesso\natravés da interface Web do TVheadend",
+"If you'd like to support the project, please consider a donation.", "Se quiser ajudar a suportar o nosso projecto, dê-nos o seu donativo, obrigado. ",
+"Ignore EPG (EIT)", "Ignorar EPG (EIT)",
+"Ignore descriptor 5", "Ignorar o descritor 5 ",
+"Ignore invalid SSL certificate", "Ignorar certificados SSL inválidos",
+"Immediately abort", "Abortar imediatamente",
+"Important", "Importante",
+"Index", "Índice",
+"Information area", "Área de informação",
+"Informational", "Informação",
+"Internal", "Interno",
+"Interview", "Entrevista",
+"Invalid", "Inválido",
+"Invalid adapter number '%s'\n", "Número do adaptador inválido '%s'\n",
+"Invalid target", "Destino inválido",
+"Keep", "Manter",
+"Kill signal (pipe)", "Terminar processo (pipe)",
+"Kill timeout (pipe/secs)", "Tempo limite para terminar (pipe/s) ",
+"Language", "Idioma",
+"Languages", "Idiomas",
+"Last updated from", "Última actualização",
+"Leisure hobbies", "Lazer",
+"Listen on IPv6", "Escutar ligação IPv6",
+"Literature", "Literatura",
+"Local bind IP address", "Endereço IP de ligação local",
+"Location", "Localização",
+"Low", "Baixo",
+"MPEG-TS Pass-thru", "MPEG-TS Pass-through",
+"MPEG-TS Pass-thru/built-in", "MPEG-TS Pass-through/built-in",
+"Magazines", "Revistas",
+"Manufacturer", "Fabricante",
+"Manufacturer URL", "URL do Fabricante",
+"Maximum PIDs", "PIDs Máximo",
+"Maximum length of PIDs", "Tamanho Máx. dos PIDs",
+"Maximum timeout (seconds)", "Tempo limite Máx. (segundos)",
+"Medicine", "Medicina",
+"Missing In PAT/SDT", "Falta o PAT/SDT",
+"Mode", "Modo",
+"Modulation", "Modulação",
+"Module", "Modulo",
+"Mon", "Segunda-Feira",
+"More verbose libav log", "Log libav mais detalhado",
+"Motor sport", "Desporto Motorizado",
+"Motoring", "Automobilismo",
+"Movie", "Filme",
+"Music", "Música",
+"Musical", "Musical ",
+"Mux", "Mistura",
+"Mux UUID", "UUID da Mistura",
+"Mux not enabled", "Mistura inactiva",
+"NONE", "NENHUM",
+"Name", "Nome",
+"Natural sciences", "Ciências Naturais",
+"Nature", "Natureza",
+"Network", "Rede",
+"Network A", "Rede A",
+"Network B", "Rede B",
+"Network ID (limit scanning)", "ID da Rede (Limitar procura)",
+"Network UUID", "UUID da Rede",
+"Network prefix", "Prefixo da Rede",
+"Networks", "Redes",
+"News", "Notícias ",
+"News magazine", "Revistas de Notícias",
+"Next tune delay in ms (0-2000)", "Atraso na próxima sintonização em ms (0-2000)",
+"No PIN", "Sem PIN",
+"No access", "Sem acesso",
+"No adapters specified!\n", "Sem adaptadores especificados\n",
+"No days", "Sem Dias",
+"No descrambler", "Sem descodificador",
+"No free adapter", "Nenhum adaptador livre",
+"No input detected", "Não foi detectado nenhuma entrada",
+"No service assigned to channel", "Não existem serviços atribuídos ao canal",
+"No service enabled", "Serviço inactivo",
+"No source available", "Nenhuma fonte disponível",
+"None", "Nenhum",
+"Not set", "Não definido",
+"Not set (none or channel configuration)", "Não definido (nenhum ou configuração do canal )",
+"Not set (use channel or DVR configuration)", "Não definido (utilizar configuração do canal ou DVR)",
+"Number", "Número",
+"Number of tsfile tuners", "Número de Sintonizadores tsfile",
+"OK (partial)", "OK (parcial)",
+"OSCam net protocol (rev >= 10389)", "protocolo de rede OSCam (rev >= 10389)",
+"Off", "Desligado",
+"Older OSCam", "Versão antiga OSCam ",
+"On", "Ligado",
+"Only Bulsatcom 39E", "Apenas Bulsatcom 39E",
+"Only EIT", "Apenas EIT",
+"Only OpenTV Sky Ausat", "Apenas OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Apenas OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Apenas OpenTV Sky UK",
+"Only PSIP (ATSC)", "Apenas PSIP (ATSC)",
+"Only UK Freesat", "Apenas UK Freesat",
+"Only UK Freeview", "Apenas UK Freeview",
+"Only Viasat Baltic", "Apenas Viasat Baltic",
+"Opera", "Ópera",
+"Output directory for tsdebug", "Directório de saída do tsdebug",
+"Over-the-air Cron multi-line", "Linhas do Cron para Over-the-air",
+"Owner", "Proprietário",
+"PEND", "PENDENTE",
+"PIDs 21 in setup", "PIDs 21 na configuração",
+"PIDs in setup", "PIDs na configuração",
+"Password", "Palavra passe",
+"Password2", "Palavra passe 2",
+"Passwords", "Palavras Passe",
+"Path", "Caminho",
+"Performing arts", "Artes cénicas",
+"Physiology", "Fisiologia",
+"Picon path (see Help)", "Caminho do Picon (ver ajuda)",
+"Pilot", "Piloto",
+"Polarization", "Polarização",
+"Political issues", "Politica",
+"Popular culture", "Cultura",
+"Port", "Porta",
+"Position", "Posição",
+"Prefer picons over channel name", "Preferir picons em alternativa ao nome do canal",
+"Preferred CA PID", "CA PID preferido",
+"Presentation", "Apresentação",
+"Press", "Notícias",
+"Priority", "Prioridade",
+"Priority (-10..10)", "Prioridade (-10..10)",
+"Private", "Privado",
+"Provider", "Provedor",
+"Provider ID", "ID do Provedor",
+"Psychology", "Psicologia",
+"Puppets", "Animação",
+"RTSP/TCP (embedded data)", "RTSP/TCP (dados contidos)",
+"Re-fetch period (hours)", "Período até nova busca (horas)",
+"Re-fetch period (mins)", "Período até nova busca (mins)",
+"Re-record%s%s", "Gravações%s%s",
+"Re-try period (hours)", "Período até nova tentativa (horas)",
+"Record all", "Gravar Tudo",
+"Reject", "Rejeitar",
+"Religion", "Religião",
+"Religious", "Religioso ",
+"Remarkable people", "Pessoas Importantes",
+"Remove HTTP arguments", "Remover argumentos HTTP",
+"Reports", "Reportagens",
+"Rerun of", "reexecução do ",
+"Rescan", "Reanalisar",
+"Reserved", "Reservado",
+"Resolution (height)", "Resolução (altura)",
+"Rewrite EIT", "Reescrever EIT",
+"Rewrite PAT", "Reescrever PAT",
+"Rewrite PMT", "Reescrever PMT",
+"Rewrite SDT", "Reescrever SDT",
+"Run as group", "Executar como Grupo",
+"Run as user", "Executar como Utilizador",
+"Running", "Em Execução",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP número da porta RTSP do servidor\n(padrão: -1 = inactivo, 0 = webconfig, porta padrão é a 554)",
+"SSL verify peer", "SSL para verificação do utilizador",
+"Sat", "Sábado",
+"Schedule a re-recording if more errors than (0=off)", "Agendar nova gravação se houver erros superior a (0=desligado)",
+"Scheduled for recording", "Gravação Programada",
+"Science", "Ciência ",
+"Science fiction", "Ficção científica ",
+"Season", "Temporada",
+"Season %d", "Temporada %d",
+"Send full PLAY cmd", "Enviar comando PLAY",
+"Serious", "Real",
+"Serious music", "Música ao vivo ",
+"Server", "Servidor",
+"Server UUID", "UUID do Servidor",
+"Service", "Serviço",
+"Service ID", "ID do Serviço",
+"Services", "Serviços",
+"Settings", "Configurações",
+"Show", "Espectáculo",
+"Show this page", "Mostrar esta página",
+"Show version information", "Mostrar informação acerca da versão",
+"Signal quality too poor", "Qualidade do Sinal Muito Fraca",
+"Signal scale (240 or 100)", "Escala do Sinal (240 ou 100)",
+"Skip TS packets (0-200)", "Ignorar pacotes TS (0-200)",
+"Soccer", "Futebol",
+"Social advisory", "Aconselhamento social",
+"Source", "Origem",
+"Source deleted", "Origem Apagada",
+"Source quality is bad", "Qualidade da Origem é má",
+"Source reconfigured", "Origem reconfigurada",
+"Special events (Olympic Games, World Cup, etc.)", "Eventos especiais (Jogos Olímpicos, Campeonato do Mundo, etc.) ",
+"Specify User-Agent header for the http client", "Especifique o cabeçalho User-Agent  para o cliente http",
+"Specify alternative htsp port", "Especifique uma porta alternativa para htsp",
+"Specify alternative http port", "Especifique uma porta alternativa para http",
+"Specify alternative http webroot", "Especifique uma porta alternativa para http webroot",
+"Specify bind address", "Especifique o endereço de ligação",
+"Specify extra htsp port", "Especifique uma porta extra para htsp",
+"Spiritual sciences", "Ciências Espirituais",
+"Sports", "Desportos",
+"Sports magazines", "Notícias de Desporto",
+"Standard", "Padrão",
+"Start", "Iniciar",
+"Status", "Estado",
+"Stop", "Parar",
+"Storage space", "Espaço de Armazenamento",
+"Streaming", "Transmissão",
+"Subscribe to a service permanently", "Subscrever o serviço permanentemente",
+"Subscription overridden", "Sobrescrever Subscrição",
+"Substitute formatters", "Substituir formatadores",
+"Subtitle", "Legenda",
+"Sun", "Domingo",
+"Switch: %s", "Mudança: %s",
+"Sync", "Sincronizar",
+"Sync + Don't keep", "Sincronizar + Não manter",
+"System", "Sistema",
+"Tags", "Etiquetas",
+"Team sports (excluding football)", "Desporto de equipas (excluindo o Futebol)",
+"Technology", "Tecnologia ",
+"Tennis", "Ténis",
+"Testing", "Teste",
+"Testing options", "Opções de Teste",
+"Thu", "Quinta-Feira",
+"Time", "Tempo",
+"Time missed", "Tempo perdido",
+"Time recording%s%s", "Tempo de Gravação%s%s",
+"Timeout (sec) (0=infinite)", "Tempo limite (sec) (0=infinito)",
+"Timeout (seconds)", "Tempo limite (segundos)",
+"Timeshift", "Gravação em tempo real",
+"Timout (secs)", "Tempo limite (secs)",
+"Title", "Título",
+"Toggle details", "Mostrar detalhes",
+"Tourism / Travel", "Viagens / Turismo",
+"Trace subsystems", "Rastreamento dos subsistemas",
+"Traditional arts", "Artes Tradicionais",
+"Traditional music", "Música Tradicional ",
+"Transcode/av-lib", "Transcodificar/av-lib",
+"Transponder ID", "ID do Transponder",
+"Tue", "Terça-Feira",
+"Tuner bind IP address", "Sintonizador vinculado ao endereço de IP",
+"Tuning failed", "Falha na Sintonização",
+"Turn off LNB when idle", "Desligar LNB quando em espera",
+"Tvheadend server name", "Nome do servidor Tvheadend",
+"Type", "Tipo",
+"URL with the SAT>IP server XML location", "URL com a Localização XML do Servidor SAT>IP",
+"Uncommitted", "Não autorizado",
+"Unicable", "Unicabo",
+"Unimportant", "Não Importante",
+"Universal LNB only", "Apenas LNB Universal",
+"Unknown", "Desconhecido",
+"Unknown reason (%i)", "Razão desconhecida (%i)",
+"Unset (default)", "Desactivado (padrão)",
+"Update channel icon", "Actualizar ícone do canal",
+"Update channel name", "Actualizar o nome do canal",
+"Update channel number", "Actualizar o número do canal",
+"Update time", "Actualizar tempo",
+"Update tolerance (ms)", "Actualizar tolerância (ms)",
+"Usage: %s [OPTIONS]\n", "Utilização: %s [OPCÕES]\n",
+"Use Windows-compatible filenames", "Utilizar Nomes nos Ficheiros Compatíveis com Windows",
+"Use XSPF playlist instead of M3U", "Utilizar lista XSPF em vez de M3U",
+"Use original", "Utilizar o Original",
+"User access error", "Erro de acesso do Utilizador",
+"User language", "Linguagem do utilizador",
+"User limit reached", "Tempo Limite do Utilizador Atingido",
+"Username", "Nome de Utilizador",
+"Variety show", "Espectáculo de Variedades",
+"Video", "Filme",
+"Visually impaired commentary/audio description", "Comentário de deficiência visual/ descrição do som",
+"WEBTV profile H264/AAC/MPEG-TS", "Perfil WEBTV H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "Perfil WEBTV H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "Perfil WEBTV VP8/Vorbis/WEBM",
+"Waiting for program start", "Aguardando o início do programa",
+"Waiting for stream", "À espera da Transmissão",
+"War", "Guerra",
+"Water sport", "Desportos aquáticos ",
+"Weak stream", "Transmissão fraca",
+"Weather report", "Meteorologia ",
+"Wed", "Quarta-Feira",
+"addpids/delpids supported", "Suporte addpids/delpids",
+"invalid option specified [%s]", "Opção especificada inválida [%s]",
+"option %s requires a value", "Opção %s requer um valor",
+"tsfile input (mux file)", "entrada tsfile (misturar ficheiro)",
+NULL, NULL
+};
+
+static const char *tvh_locale_20[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nДля получения более подробной информации, пожалуйста, посетите веб-сайт Tvheadend по адресу:\nhttps://tvheadend.org\n",
+"# Channels", "# Каналы",
+"# Mapped channels", "# Отображенные каналы",
+"# Muxes", "# Мультиплексы",
+"# Services", "# Сервисы",
+"# Services seen", "# Просмотренные сервисы",
+"# tune repeats", "Настроить повторы",
+"(Default profile)", "(Профиль по Умолчанию)",
+"1 day", "1 день",
+"1 month", "1 месяц",
+"1 week", "1 неделя",
+"1 year", "1 год",
+"2 months", "2 месяца",
+"2 weeks", "2 недели",
+"2 years", "2 года",
+"3 days", "3 дня",
+"3 months", "3 месяца",
+"3 weeks", "3 недели",
+"3 years", "3 года",
+"5 days", "5 дней",
+"6 months", "6 месяцев",
+"A", "А",
+"AA", "АА",
+"ACTIVE", "АКТИВНЫЙ",
+"ANY", "ЛЮБОЙ",
+"AUTO", "АВТО",
+"Aborted by user", "Отменено пользователем",
+"Accept remote subscription weight", "Принять вес удаленной подписки",
+"Accept the remote subscription weight (from the SAT>IP client).", "Принять вес удаленной подписки (от SAT>IP клиента).",
+"Access", "Доступ",
+"Action", "Экшн",
+"Adapter in use by another subscription", "Адаптер занят другой подпиской",
+"Add file and line numbers to debug", "Добавить файл и число строк к дебагу",
+"Add the thread ID to debug", "Добавить тред ID в дебаг",
+"Admin", "Админ",
+"Admin password", "Пароль администратора",
+"Admin username", "Имя администратора",
+"Administrator login", "Логин администратора",
+"Adult movie", "Кино для взрослых 18+",
+"Advanced", "Дополнительно",
+"Advanced (non-universal LNBs, rotors, etc.)", " Расширенный (Non-Universal LNBs, Rotors, etc.)",
+"Advanced streaming", "Advanced Streaming",
+"Adventure", "Приключения",
+"Advertisement / Shopping", "Реклама / Магазины",
+"All (Streaming plus DVR)", "Всё (Потоковое плюс DVR)",
+"All DVR (rw)", "Все DVR (rw)",
+"Allow to show the quick tips for the form fields.", "Разрешить показывать быстрые подсказки для полей формы.",
+"Allowed network", "Разрешенные сети",
+"Alternate PID path", "Альтернативный путь ID",
+"Alternate configuration path", "Альтернативный путь к конфигурации",
+"Altitude (meters)", "Altitude (метры)",
+"Animals", "Животные",
+"Any", "Любой",
+"Arts", "Искусства",
+"Athletics", "Атлетика",
+"Audio bitrate (kb/s) (0=auto)", "Аудио битрейт (кбит/с) (0=Авто)",
+"Audio codec", "Аудио кодек",
+"Audio stream filter", "Фильтр аудио потока",
+"Auto", "Авто",
+"Auto check disabled", "Авто проверка заблокирована",
+"Auto check enabled", "Авто проверка включена",
+"Auto record", "Авто Запись",
+"Auto record caption", "Автоматическая метка записи",
+"Auto recording%s%s", "Время Записи%s%s",
+"Auto time record", "Время Автомат. Записи",
+"Auto-Map to channels", "Автоматическое отображение в каналы",
+"Automatic checking", "Автоматическая проверка",
+"Automatically map EPG source", "Автоматическое отображение источника EPG",
+"Automatically name from network", "Автоматическое имя из сети",
+"Automatically update channel icons using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel icons.", "Автоматическое обновление значков каналов, используя информацию, полученную от провайдера EPG. Внимание: это может привести к нежелательным изменениям в уже определенных значках каналов.",
+"Automatically update channel names using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel names.", "Автоматическое обновление названия каналов, используя информацию, полученную от провайдера EPG. Внимание: это может вызвать нежелательные изменения в уже определенные имена каналов.",
+"Automatically update channel numbers using information provided by the enabled EPG providers. Note: this may cause unwanted changes to already defined channel numbers.", "Автоматическое обновление каналов, используя число информацию, представленную EPG провайдером. Внимание: это может привести к нежелательным изменениям в уже определенных номерах каналов.",
+"Autorec maximum count (0=unlimited)", "Максимальное количество автозаписей (0=не ограничено)",
+"Autorec maximum schedules limit (0=unlimited)", "Автозапись максимальный предел расписаний  (0=неограничено)",
+"Bad", "Плохой",
+"Ballet", "Балет",
+"Bandwidth", "Пропускная способность",
+"Based on software from", "Основано на софте от",
+"Basic", "Основной",
+"Bind to specific local IP address.", "Привязать к определенному IP адресу",
+"Boot ID", "Загрузочный ID",
+"Bouquet", "Букет",
+"Bouquet (auto)", "Букет (Авто)",
+"Brand", "Марка",
+"Broadcast", "Трансляция",
+"Broadcasting", "Транслирование",
+"Build", "Билд",
+"CA client %i", "CA Клиент %i",
+"CA identification", "CA Идентификация",
+"CA provider", "CA Провайдер",
+"CA stream filter", "Фильтр CA потока",
+"CAPMT interval (ms)", "CAPMT интервал (мсек.)",
+"CAPMT query interval (ms)", "CAPMT Интервал запроса (мсек.)",
+"CRID authority", "CRID Полномочия",
+"Cache scheme", "Схема Кэша",
+"Camd.socket filename / IP Address (TCP mode)", "Camd.socket Имя файла / IP Адрес (TCP режим)",
+"Cartoons", "Мультфильмы",
+"Channel", "Канал",
+"Channel icon", "Иконка Канала",
+"Channel icon path (see Help)", "Путь иконки канала (см. Помощь)",
+"Channel name", "Имя канала",
+"Channel number", "Номер канала",
+"Channel number offset", "Смещение Номера Канала",
+"Channel numbers from", "Номера каналов от",
+"Channel tag", "Метка канала",
+"Channel tag reference", "Упоминаемые метки канала",
+"Channel tags", "Метки канала",
+"Channels", "Каналы",
+"Character set", "Набор Символов",
+"Check availability", "Провирить доступность",
+"Children's / Youth programs", "Детские / Молодежные программы",
+"Cinema", "Кинематография",
+"Class", "Класс",
+"Classical", "Классика",
+"Classical music", "Классическая музыка",
+"Clean effects", "Вычистить эффекты",
+"Client name", "Имя Клиента",
+"Clone scheduled entry on error", "Клонирование Запланированной записи при Ошибке",
+"Code word client (newcamd)", "Code Word Client (newcamd)",
+"Comedy", "Комедия",
+"Command delay time (ms) (10-200)", "Команда задержки времени (милисек) (10-200)",
+"Command time (ms) (10-100)", "Время комманды (милисек) (10-100)",
+"Comment", "Коментарий",
+"Commercial break", "Рекламная пауза",
+"Completed OK", "Завершено ОК",
+"Conditional access client", "Клиент условного доступа",
+"Configuration", "Конфигурация",
+"Configuration ID", "ID Конфигурации",
+"Configuration name", "Название конфигурации",
+"Configuration version", "Версия конфигурации",
+"Connection limit type", "Тип ограничения соединения",
+"Constellation", "Созвездие",
+"Container", "Контейнер",
+"Content character set", "Кодировка Контента",
+"Content type", "Тип контента",
+"Contest", "Конкурс",
+"Cookie expiration (days)", "Время жизни Cookie (Дней)",
+"Cooking", "Кухня",
+"Copy codec type", "Копировать тип кодека",
+"Copy layout", "Копировать разметку",
+"Create bouquet", "Создать букет",
+"Create network name tags", "Создать метку имени сети",
+"Create provider name tags", "Создать метку имени провайдера",
+"Create type based tags", "Создать метки на основе типа",
+"Created", "Создан",
+"Creator", "Создатель",
+"Cron", "Крон",
+"Culture (without music)", "Культура (исключая музыку)",
+"Current RTSP port.", "Текущий RTSP порт",
+"Current affairs", "Текущие события",
+"Current tuner configuration.", "текущая конфигурация тюнера",
+"DBus - use the session message bus instead of the system one", "DBus - использовать сообщения шины вместо системных",
+"DES constant code word client", "DES Constant Code Word Client",
+"DES key", "Ключ DES",
+"DVB EPG ID", "DVB ЕПГ ID",
+"DVB scan files", "DVB Scan Files",
+"DVB-C network", "DVB-C Сеть",
+"DVB-S 4-port", "DVB-S 4-порта",
+"DVB-S advanced", "DVB-S Расширенный",
+"DVB-S network", "DVB-S Сеть",
+"DVB-S simple", "DVB-S Простой",
+"DVB-S tone burst", "DVB-S Toneburst",
+"DVB-T network", "DVB-T Сеть",
+"DVR behavior", "DVR режим",
+"DVR configuration", "DVR Конфигурация",
+"DVR configuration profile", "Профиль конфигурации DVR",
+"DVR configuration profiles", "Профили Конфигурации DVR",
+"Dance", "Танцы",
+"Data errors", "Ошибки Данных",
+"Days of Week", "Дни недели",
+"Days of week", "Дни недели",
+"Debate", "Дебаты",
+"Debug options", "Настройки отладки",
+"Debugging", "Отладка",
+"Default", "По умолчанию",
+"Default language(s)", "Язык(и) по умолчанию",
+"Default priority", "Приоритет по умолчанию",
+"Delivery system", "Система доставки",
+"Demux path", "Путь к Демультиплексу",
+"Descramble services (limit per mux)", "Descramble Services (Limit Per Mux)",
+"Description", "Описание",
+"Detective", "Детектив",
+"Device ID", "ID Устройства",
+"Device model", "Модель устройства",
+"Device path", "Путь к устройству",
+"Directory", "Каталог",
+"Directory permissions (octal, e.g. 0775)", "Права Директории (восьм., пример - 0775)",
+"Disable", "Отключить",
+"Disable DVB bouquets", "Отключить DVB Букеты",
+"Disable SAT>IP client", "Заблоктровать SAT>IP клиента",
+"Disable all access control checks", "Отключить проверку контроля доступа",
+"Disable debug on stderr", "Заблокировать дебаг на stderr",
+"Disable device/firmware-specific workarounds", "Отключить устройство/firmware-specific обходной путь",
+"Disable syslog (all messages)", "Отключить системный лог (все сообщения)",
+"Disabled", "Отключено",
+"Discussion", "Обсуждения",
+"DiseqC repeats", "DiseqC повторы",
+"DiseqC rotor", "DiseqC ротор",
+"DiseqC switch", "DiseqC переключатель",
+"Do not use", "Не использовать",
+"Documentary", "Документальные",
+"Don't backup configuration tree at upgrade", "Не резервируется дерево конфигурации при обновлении",
+"Don't include title in filename", "Не включая Титл в имени Файла",
+"Don't keep", "Не держать",
+"Don't re-record", "Не перезаписывать",
+"Don't reschedule", "Не перепланировать",
+"Drama", "Драма",
+"EPG grabber", "ЕПГ Граббер",
+"EPG grabber configuration", "Конфигурация EPG граббера",
+"EPG name", "Название EPG",
+"EPG scan", "Сканирование ЕПГ",
+"EPG source", "ЕПГ источник",
+"EPG update window", "Окно обновления ЕПГ",
+"Economics", "Экономика",
+"Education", "Образование",
+"Educational", "Образовательные",
+"Elementary stream filter", "Простой фильтр потока",
+"Enable (auto)", "Включение (авто)",
+"Enable DBus", "Включение DBus",
+"Enable NTP driver", "Включить драйвер NTP",
+"Enable coredumps for daemon", "Включить дамп ядра для демона",
+"Enable debug on stderr", "Включение дебага на stderr",
+"Enable debug subsystems", "Включение подсистемы дебага",
+"Enable debug to file", "Включение дебага в файл",
+"Enable debug to syslog", "Включить дебаг в syslog",
+"Enable or disable fast input switching.", "Включить или отключить быстрое переключение ввода. ",
+"Enable or disable full mux mode.", "Включить или отключить полный мукс режим. ",
+"Enable or disable this configuration.", "Включить или отключить эту конфигурацию. ",
+"Enable syslog", "Включить syslog",
+"Enable trace subsystems", "Включение подсистемы трассировки",
+"Enable web UI debug (non-minified JS)", "Enable webUI debug (non-minified JS)",
+"Enabled", "Включено",
+"Encrypted", "Зашифрованные",
+"Encrypted service", "Зашифрованный сервис",
+"Enter external IP if behind Network address translation (NAT).", "Введите внешний IP если используется (NAT).",
+"Entertainment programs for 10 to 16", "Развлекательные программы от 10 до 16",
+"Entertainment programs for 6 to 14", "Развлекательные программы от 6 до 14",
+"Environment", "Окружение",
+"Environment (pipe)", "Окружение (pipe)",
+"Episode", "Эпизод",
+"Episode %d", "Эпизод %d",
+"Error code", "Код Ошибки",
+"Errors", "Ошибки",
+"Every day", "Каждый день",
+"Exclude channel tags", "Исключая метки канала",
+"Expeditions", "Экспедиции",
+"Experimental film", "Эксперементальное кино",
+"Expert", "Экспертный",
+"Exported tuners", "Экспортированные Тюнеры",
+"External", "Внешний",
+"External EPG grabber", "Внешний EPG граббер",
+"External IP (NAT)", "Внешний IP (NAT)",
+"External URL", "Внешний URL",
+"Extra arguments", "Эктра аргументы",
+"Extra start time", "Дополнительное Время старта",
+"Extra stop time", "Дополнительное Время остановки",
+"FAIL", "ПРОВАЛ",
+"FEC high", "FEC High",
+"FEC low", "FEC Low",
+"Factual topics", "Фактические темы",
+"Failed", "Неудачно",
+"Fantasy", "Фентези",
+"Fast input switch", "Быстрый переключатель ввода",
+"File missing", "Файл Отсутствует",
+"File not created", "Файл не создан",
+"File permissions (octal, e.g. 0664)", "Права на Файл (восьм. например 0664)",
+"File size", "Размер файла",
+"Filename", "Имя файла",
+"Filename character set", "Набор символов в имени файла",
+"Filename options", "Параметры имени файла",
+"Film", "Кино",
+"Fine arts", "Изящные искусства",
+"Finished", "Окончено",
+"Fitness and health", "Фитнес и здоровье",
+"Folk", "Народное",
+"Folkloric", "Фольклёр",
+"Football", "Футбол",
+"Force (auto)", "Форсировать (авто)",
+"Force priority", "Форсировать Приоритетное",
+"Foreign countries", "Зарубежные страны",
+"Forever", "Навсегда",
+"Fork and run as daemon", "Перезапустить как Демон",
+"Format string", "Формат строки",
+"Found muxes", "Найдено мультиплексов",
+"Found services", "Найдено сервисов",
+"Free subscription weight", "Свободный вес подписки",
+"Frequency", "Частота",
+"Frequency (Hz)", "Частота (Hz)",
+"Frequency (MHz)", "Частота (MHz)",
+"Frequency (kHz)", "Частота (kHz)",
+"Fri", "Пятн.",
+"Friendly name", "Дружественное Имя",
+"Frontend number", "Номер Внешнего Интерфейса",
+"Frontend path", "Путь к фронтенду",
+"Full DiseqC", "Полный DiseqC",
+"Full pathname specification", "Спецификация полного пути",
+"Further education", "Дальнейшее образование",
+"GOTOX", "Переход на Х",
+"GOTOX position", "Переход на Х Позицию",
+"GOTOX rotor", "Переход Ротора на Х",
+"Game show", "Игровое Шоу",
+"Gardening", "Сад и огород",
+"General", "Главная",
+"General configuration", "Главная Конфигурация",
+"Generic", "Общие",
+"Generic options", "Общие Настройки",
+"Guard interval", "Защитный интервал",
+"HD: high definition", "HD: Высокое Разрешение",
+"HDHomeRun DVB frontend", "HDHomeRun DVB Frontend",
+"HDHomeRun DVB-C frontend", "HDHomeRun DVB-C Frontend",
+"HDHomeRun DVB-T frontend", "HDHomeRun DVB-T Frontend",
+"HTSP Default Stream Settings", "Настройки потока HTSP по умолчанию",
+"HTSP stream profile", "Профиль Потока HTSP",
+"HTSP streaming", "HTSP поток",
+"Handicraft", "Ремёсла",
+"Hearing impaired", "Для глухих",
+"Hierarchy", "Иерархия",
+"High", "Высокий",
+"High bitrate mode (CI+ CAMs only)", "Режим с Высоким Битрейтом (CI+ CAMы только)",
+"Historical movie", "Исторические фильмы",
+"Horror", "Ужасы",
+"Hostname/IP", "Имя Хоста/IP",
+"IDLE", "ПРОСТОЙ",
+"IP address", "IP адрес",
+"IP blocking", "Блокировка IP",
+"IPTV automatic network", "IPTV сеть автоматически ",
+"IPTV input", "IPTV Ввод",
+"IPTV network", "IPTV Сеть",
+"Icon", "иконка",
+"Icon (full URL)", "Иконка (полный URL)",
+"Icon URL", "URL иконки",
+"Icon base URL", "URL иконки",
+"Icon has title", "Иконка имеет название",
+"Icons from", "иконки от",
+"Idle", "простой",
+"Idle scan", "Сканирование при простое",
+"Idle scan muxes", "Сканирование Мультиплексов в простое",
+"If no user account exists then create one with\nno username and no password. Use with care as\nit will allow world-wide administrative access\nto your Tvheadend installation until you create or edit\nthe access control from within the Tvheadend web interface.", "если аккаунт пользователя не существует, создайте профиль\nбез имени и пароля. Используйте с осторожностью\nэто открывает полный административный доступ\nк вашей Tvheadend системе с полным доступом\nи контролю через Tvheadend web интерфейс.",
+"If you'd like to support the project, please consider a donation.", "Если вы хотите помочь проекту, пожалуйста рассмотрите возможность пожертвования.",
+"Ignore EPG (EIT)", "Игнорировать ЕПГ (EIT)",
+"Ignore descriptor 5", "игнорировать дескриптор 5",
+"Ignore invalid SSL certificate", "игнорировать неправильные SSL сертификаты",
+"Ignore provider's channel numbers", "Игнорировать Провайдерские Номера Каналов",
+"Image cache", "Кэш изображений",
+"Immediately abort", "Сразу прервать",
+"Important", "Важный",
+"Include channel name in filename", "Включая Имя Канала в имени Файла",
+"Include date in filename", "Вставить дату в имя файла",
+"Include episode in filename", "Включить эпизод в имени файла",
+"Include subtitle in filename", "Включить субтитры в имени файла",
+"Include time in filename", "Вставить время в имя файла",
+"Index", "Индекс",
+"Information area", "Информационный раздел",
+"Informational", "Информационный",
+"Initial scan", "Первоначальное сканирование",
+"Input base", "Базовый ввод",
+"Input buffer (bytes)", "Входной Буфер (Байты)",
+"Input instance", "Ввод экземпляра",
+"Input path", "Входной путь",
+"Interface", "Интерфейс",
+"Internal", "Внутренний",
+"Internal EPG grabber", "Внутренний EPG граббер",
+"Internal grabber", "Внутренний граббер",
+"Interview", "интервью",
+"Invalid", "Неправильный",
+"Invalid adapter number '%s'\n", "Неправильный номер адаптера '%s'\n",
+"Invalid target", "Неправильная цель",
+"Jazz", "Джаз",
+"Keep", "Оставить",
+"LNB type", "Тип LNB",
+"Language", "Язык",
+"Language settings", "Настройки Языковые",
+"Languages", "Языки",
+"Last seen", "Последнее просмотренное",
+"Last updated from", "Последнее обновление из",
+"Leisure hobbies", "Досуг и отдых",
+"Limit connections", "Лимит Соединений",
+"Linked input", "Соединенный вход",
+"LinuxDVB adapter", "LinuxDVB Адаптер",
+"LinuxDVB network", "LinuxDVB Сеть",
+"Listen / Connect port", "Прослушивать/Порт соединения",
+"Listen on IPv6", "Прослушивать в IPv6",
+"Literature", "Литература",
+"Local bind IP address", "Локальная привязка IP адреса",
+"Local channel minor", "Локальный минор Канала",
+"Local channel number", "Локальный Номер Канала",
+"Local discovery IP address", "Локальное определение IP адреса",
+"Location", "Расположение",
+"Lock preferred CA PID", "Виксированный Предпочтительный CA PID",
+"Log", "Лог",
+"Login/Logout", "Вход/Выход",
+"Low", "Низкий",
+"MPEG-TS input", "MPEG-TS Вход",
+"MPEG-TS multiplex", "MPEG-TS Multiplex",
+"MPEG-TS network", "MPEG-TS Сеть",
+"MPEG-TS service", "MPEG-TS Сервис",
+"Magazines", "Журналы",
+"Maintain free storage space in MiB", "Удерживать свободное место на носителе в MiB",
+"Maintain used storage space in MiB (0=disabled)", "Удерживать занятое место на носителе в MiB (0=отключено)",
+"Maintained space", "Поддерживаемое пространство",
+"Make subdirectories per channel", "Сделать Поддиректории по Каналу",
+"Make subdirectories per day", "Сделать Поддиректории по Дням",
+"Make subdirectories per title", "Сделать Поддиректории по Титл",
+"Manufacturer", "Производитель",
+"Manufacturer URL", "URL Производителя",
+"Manufacturer's model number.", "Номер модели производителя.",
+"Manufacturer's product description.", "Описание продукта производителя.",
+"Manufacturer's product information page for the device.", "Информация производителя об устройстве.",
+"Manufacturer's product name.", "Название продукта производителя.",
+"Map radio channels", "Отображение радио каналов",
+"Map unnamed channels", "Отобразить не именованные каналы",
+"Map zero-numbered channels", "Отобразить нулевые каналы",
+"Master tuner", "Мастер Тюнер",
+"Matroska", "Матрёшка",
+"Matroska (mkv)/av-lib", "Матрёшка (mkv)/av-lib",
+"Matroska (mkv)/built-in", "Матрёшка (mkv)/built-in",
+"Matroska/av-lib", "Матрёшка/av-lib",
+"Maximal channel number", "Максимальный номер канала",
+"Maximum # input streams", "Максимум # входных Потоков",
+"Maximum PIDs", "Максимум PIDs",
+"Maximum RAM size (MB)", "Максимальный размер RAM (MB)",
+"Maximum bandwidth (Kbps)", "Максимальная Пропускная (Кб в сек.) ",
+"Maximum duration", "Максимальная Продолжительность",
+"Maximum length of PIDs", "Максимальная длинна PIDов",
+"Maximum period (mins)", "Макисмальный Период (мин.)",
+"Maximum size (MB)", "Максимальный Размер (MB)",
+"Maximum timeout (seconds)", "Максимум таймаут (сек.)",
+"Medicine", "Медицина",
+"Melodrama", "Мелодрама",
+"Minimal channel number", "Минимальный номер канала",
+"Minimum duration", "Минимальная Продолжительность",
+"Minimum rotor time (seconds)", "Мин Ротор Время (сек.)",
+"Missing In PAT/SDT", "Отсутствует в PAT/SDT",
+"Mode", "Режим",
+"Model description", "Описание Модели",
+"Model name", "Название модели",
+"Model number", "Номер модели",
+"Modulation", "Модуляция",
+"Module", "Модуль",
+"Module ID", "ID Модуля",
+"Mon", "Пнд.",
+"Mono", "Моно",
+"More verbose libav log", "Более читабельный libav лог",
+"Motor sport", "Мото спорт",
+"Movie", "Кино",
+"Music", "Музыка",
+"Musical", "Музыкальный",
+"Mux", "Мультиплекс",
+"Mux UUID", "UUID Мультиплекса",
+"Mux name", "Название Мультиплекса",
+"Mux not enabled", "Мультиплекс не включен",
+"NONE", "НЕТ",
+"Name", "Имя",
+"Names", "Имена",
+"Natural sciences", "Естественные Нуки",
+"Nature", "Природа",
+"Network", "Сеть",
+"Network A", "Сеть A",
+"Network B", "Сеть B",
+"Network ID (limit scanning)", "Сетевой ID (ограничение сканирования)",
+"Network UUID", "UUID Сети",
+"Network access", "Сетевой доступ",
+"Network discovery", "Обнаружение Сети",
+"Network name", "Название Сети",
+"Network prefix", "префикс Сети",
+"Network settings", "Настройки сети",
+"Network type", "Тип Сети",
+"Networks", "Сети",
+"News", "Новости",
+"News magazine", "Журналы новостей",
+"Next tune delay in ms (0-2000)", "Задержка следующей настройки в мсек. (0-2000)",
+"No", "Нет",
+"No PIN", "Нет PIN",
+"No access", "Нет доступа",
+"No adapters specified!\n", "Адаптеры не указаны!\n",
+"No assigned adapters", "Нет назначенного адаптера.",
+"No days", "Нет дней",
+"No descrambler", "Нет дешифратора",
+"No free adapter", "Нет свободного адаптера",
+"No input detected", "Вход  не обнаружен",
+"No service assigned to channel", "Не назначен сервис каналу",
+"No service enabled", "Сервис не включен",
+"No source available", "Источник не доступен",
+"None", "Нет",
+"Normal", "Нормальный",
+"Not set", "Не задано",
+"Not set (none or channel configuration)", "Не задан (нет или канал  не сконфигурирован)",
+"Not set (use channel or DVR configuration)", "Не задан (используйте канал или конфигурацию DVR)",
+"Number", "Число",
+"Number of seconds to wait before timing out.", "Сколько секунд ждать перед таймаут.",
+"Number of tsfile tuners", "Число tsfile тюнеров ",
+"OK", "ОК",
+"OK (partial)", "Ок (частично)",
+"OSCam net protocol (rev >= 10389)", "OSCam сетевой протокол (rev >= 10389)",
+"Off", "Выкл.",
+"Older OSCam", "Старый OSCam",
+"On", "Вкл.",
+"On file removal", "При удалении файла",
+"Only Bulsatcom 39E", "Только Bulsatcom 39E",
+"Only EIT", "Только EIT",
+"Only OpenTV Sky Ausat", "Только OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Только OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Только OpenTV Sky UK",
+"Only PSIP (ATSC)", "Только PSIP (ATSC)",
+"Only UK Freesat", "Только UK Freesat",
+"Only UK Freeview", "Только UK Freeview",
+"Only Viasat Baltic", "Только Viasat Baltic",
+"Only preferred CA PID", "Только Предпочтительный CA PID",
+"OpenTV channel number", "Номер Канала OpenTV",
+"Opera", "Опера",
+"Orbital position", "Орбитальная позиция",
+"Orbital positions", "Орбитальные Позиции",
+"Original network ID", "Настоящий ID Сети",
+"Other stream filter", "Другой Фильтр Потока",
+"Output directory for tsdebug", "Директория вывода tsdebug",
+"Over-the-air", "По воздуху",
+"Over-the-air EPG", "ЕПГ по воздуху",
+"Over-the-air EPG grabber", "Граббер ЕПГ по воздуху",
+"Over-the-air grabbers", "Грабберы по воздуху",
+"Override the frontend type.", "Заместит тип фронтэнда.",
+"Owner", "Владелец",
+"PEND", "ОЖИДАНИЕ",
+"PIDs in setup", "PIDы в установках",
+"PLS code", "PLS Код",
+"PLS mode", "PLS режим",
+"Parent entry", "Родительская запись",
+"Password", "Пароль",
+"Password2", "Пароль2",
+"Passwords", "Пароли",
+"Path", "Путь",
+"Path to a directory (folder) containing your picon collection. See Help for more detailed information.", "Путь к директории с коллекцией пиконов. Смотри помощь для детальной информации.",
+"Path to an icon for this channel. This can be named however you wish, as either a local (file://) or remote (http://) image. See Help for more infomation.", "Путь к иконке этого канала. This can be named however you wish, as either a local (file://) or remote (http://) image. Смотри помощь для более детальной информации.",
+"Performing arts", "Исполнительские виды искусства",
+"Periodically save EPG to disk (hours)", "Периодичность сохранения EPG на диск (часы)",
+"Physiology", "Физиология",
+"Picon", "Пикон",
+"Picon path (see Help)", "Путь на пикон (см. Помощь)",
+"Pilot", "Пилот",
+"Polarization", "Поляризация",
+"Political issues", "Политические вопросы",
+"Pop", "Поп",
+"Popular culture", "Популярная культура",
+"Port", "Порт",
+"Position", "Позиция",
+"Position of the input.", "Позиция ввода.",
+"Post-processor command", "Команда Пост-Процессора",
+"Post-remove command", "Команда после удаления",
+"Power save", "Энергосбережение",
+"Power-up time (ms) (15-200)", "Время включения (милисек.) (15-200)",
+"Pre-defined muxes", "Предопределённые Мультиплексы",
+"Pre-school children's programs", "Дошкольные детские программы",
+"Prefer picons over channel name", "Предпочтительные пиконы  на имя канала",
+"Preferred CA PID", "Предпочтительные CA PID",
+"Preferred service video type", "Предпочтительные типы Видео Сервисов",
+"Presentation", "Презентация",
+"Presentation details.", "Детали презентации.",
+"Press", "Пресса",
+"Priority", "Приоритет",
+"Priority (-10..10)", "Приоритет (-10..10)",
+"Private", "Частный",
+"Profile name", "Имя Профиля",
+"Provider", "Провайдер",
+"Provider ID", "ID Провайдера",
+"Provider network name", "Имя сети провайдера",
+"Psychology", "Психология",
+"Puppets", "Куклы",
+"Quiz", "Викторины",
+"RAM only", "RAM Только",
+"RTSP port", "RTSP Порт",
+"RTSP port (554 or 9983, 0 = disable)", "порт RTSP (554 или 9983, 0 = откл)",
+"Re-fetch period (hours)", "Период перезапроса (час.)",
+"Re-fetch period (mins)", "Период перезапроса (мин.)",
+"Re-record%s%s", "Время Записи%s%s",
+"Re-try period (hours)", "Период повтора (час.)",
+"Record all", "Записать всё",
+"Recording file options", "Свойства записываемого файла",
+"Recording system path", "Системный Путь Записи",
+"Reject", "Извлечь",
+"Religion", "Религия",
+"Religious", "Религиозный",
+"Remarkable people", "Замечательные люди",
+"Remove HTTP arguments", "Удалить HTTP аргументы",
+"Remove all unsafe characters from filename", "Удалить все не сохраняемые символы из имени файла",
+"Replace whitespace in title with '-'", "Заменить Пробелы в Титлах '-'",
+"Reports", "Репортажи",
+"Rerun of", "Перезапуск из",
+"Rescan", "Пересканировать",
+"Reserved", "Зарезервировано",
+"Resolution (height)", "Разрешение (высота)",
+"Respawn (pipe)", "Респаун (pipe)",
+"Restart on error", "Рестарт при ошибке",
+"Rewrite EIT", "Перезаписать EIT",
+"Rewrite PAT", "Перезаписать PAT",
+"Rewrite PMT", "Перезаписать PMT",
+"Rewrite SDT", "Перезаписать SDT",
+"Rock", "Рок",
+"Rolloff", "Откатить",
+"Romance", "Романтика",
+"Rotor initialization time (seconds)", "Время Инициализации Ротора (сек.)",
+"Rotor type", "Тип Ротора",
+"Run as group", "Запустить от группы",
+"Run as user", "Запустить от пользователя",
+"Running", "Запуск",
+"SAT>IP DVB-T frequency (Hz)", "Частота SAT>IP DVB-T (Гц)",
+"SAT>IP RTSP port number for server\n(default: -1 = disable, 0 = webconfig, standard port is 554)", "SAT>IP RTSP номер порта сервера\n(по умолчанию: -1=откл., 0=webconfig, стандартный порт 554)",
+"SD: standard definition", "SD: Стандартное Разрешение",
+"SSL verify peer", "SSL проверка пира",
+"Sat", "Спутник",
+"Satellite longitude", "Долгота спутника",
+"Satellite positions", "Позиция Спутника",
+"Scan after creation", "Сканировать после создания",
+"Scan queue length", "Сканирование длины очереди",
+"Scan result", "Результат Сканирования",
+"Scan status", "Статус Сканирования",
+"Schedule a re-recording if more errors than (0=off)", "Журнал презаписи если ошибок больше чем (0=откл.)",
+"Schedule status", "Статус расписания",
+"Scheduled for recording", "Запланированные записи",
+"Scheduled start time", "Запланированное время старта",
+"Scheduled stop time", "Запланированное время остановки",
+"School programs", "Школьные программы",
+"Science", "Наука",
+"Science fiction", "Научная фантастика",
+"Season", "Сезон",
+"Season %d", "Сезон %d",
+"Serial number", "Серийный Номер",
+"Series link", "Ссылка на серии",
+"Serious", "Серьёзное",
+"Serious music", "Серьёзная музыка",
+"Server", "Сервер",
+"Server UUID", "Сервер UUID",
+"Server details.", "О сервере.",
+"Service", "Сервис",
+"Service ID", "ID Сервиса",
+"Service configuration", "Конфигурация Сервиса",
+"Service count %zi", "Кол-во Сервисов %zi",
+"Service name", "Имя сервиса",
+"Service type", "Тип Сервиса",
+"Services", "Сервисы",
+"Set the display name.", "Задать имя дисплея.",
+"Set the priority of this configuration.", "Установить приоритет этой конфигурации.",
+"Settings", "Настройки",
+"Show", "Шоу",
+"Show this page", "Показать страницу",
+"Show version information", "Показать информацию о версии",
+"Signal quality too poor", "Качество сигнала очень плохое",
+"Signal scale (240 or 100)", "Шкала Сигнала (240 или 100)",
+"Site latitude", "Широта сайта",
+"Site longitude", "Долгота сайта",
+"Skip commercials", "Пропуская Комерческие",
+"Skip initial bytes", "Пропустить начальные Байты",
+"Skip initial scan", "Пропустить начальное сканирование",
+"Skip x number of transport packets.", "Пропускать х транспортных пакетов.",
+"Slave entry", "Вспомогательная запись",
+"Slot state", "Состояние Слота",
+"Soap", "Мыло",
+"Soccer", "Бильярд",
+"Social", "Социальное",
+"Social advisory", "социальный консультативный",
+"Sort index", "Сортировка по индексу",
+"Source", "Источник",
+"Source deleted", "Источник удален",
+"Source quality is bad", "Качество источника плохое",
+"Source reconfigured", "Источник переконфигурирован",
+"Specify User-Agent header for the http client", "Указать User-Agent заголовок для http клиента",
+"Specify alternative htsp port", "Задайте альтернативный htsp порт",
+"Specify alternative http port", "Задайте альтернативный http порт",
+"Specify alternative http webroot", "Задайте альтернативный http webroot",
+"Specify bind address", "Определить адрес привязки",
+"Spiritual sciences", "Спиритические науки",
+"Sports", "Спортивные",
+"Sports magazines", "Спортивные журналы",
+"Squash", "Сквош",
+"Standard", "Стандарт",
+"Start", "Старт",
+"Start after", "Старт после",
+"Start before", "Старт перед",
+"Start time", "Время старта",
+"Status", "Статус",
+"Status period (ms)", "Периодичность статуса (мсек.)",
+"Stereo", "Стерео",
+"Stop", "Стоп",
+"Stop time", "Время Остановки",
+"Storage path", "Путь к носителю",
+"Storage space", "Ёмкость накопителя",
+"Stream index", "Индекс Потока",
+"Stream profile", "Профиль Потока",
+"Stream type", "Тип Потока",
+"Subdirectory options", "Опции поддиректории",
+"Subscribe to a service permanently", "Подписаться на сервис постоянно",
+"Subscription overridden", "Подписка Переопределена",
+"Subscription weight", "Вес Подписки",
+"Subtitle", "Субтитры",
+"Subtitle codec", "Codec Субтитров",
+"Subtitle stream filter", "Фильтр Потока Субтитров",
+"Sun", "Воскр.",
+"Switch before rotor", "Переключатель перед Ротором",
+"Switch type", "Тип переключателя",
+"Switch: %s", "Переключиться: %s",
+"Symbol rate (Sym/s)", "Символьная Скорость (симв./сек.)",
+"Sync", "Синхронизировать",
+"System", "Система",
+"Tags", "Метки",
+"Talk show", "Разговорное Шоу",
+"Team sports (excluding football)", "Командный спорт (исключая футбол)",
+"Technology", "Технологии",
+"Teletext stream filter", "Фильтр Потока Телетекста",
+"Tennis", "Теннис",
+"Testing", "Тестирование",
+"Testing options", "Опции тестирования",
+"The character encoding for this service (e.g. UTF-8).", "Кодировка сервиса. Например (UTF-8).",
+"The current boot ID.", "Текущий boot ID.",
+"The current configuration ID.", "ID текущей конфигурации",
+"The current configuration version.", "Версия текущей конфигурации.",
+"The default subscription weight for each subscription.", "Вес для каждой подписки по умолчанию.",
+"The device ID.", "ID устройства.",
+"The device's serial number.", "Серийный номер устройства.",
+"The frequency of the mux (in Hertz).", "Частота мультиплксора в (Hertz).",
+"The manufacturer of the SAT>IP server.", "Производитель SAT>IP сервера.",
+"The networks using this configuration.", "Сети использующие эту конфигурацию.",
+"The number of ATSC-C (Cable/AnnexB) tuners to export.", "Номера ATSC-C (Cable/AnnexB) тюнеров для экспорта.",
+"The number of ATSC-T (Terresterial) tuners to export.", "Номера ATSC-T (Terresterial) тюнеров для экспорта.",
+"The number of DVB-C (Cable) tuners to export.", "Номера DVB-C (Cable) тюнеров для экспорта.",
+"The number of DVB-C2 (Cable) tuners to export.", "Номера DVB-C2 (Cable) тюнеров для экспорта.",
+"The number of DVB-S (Satellite) tuners to export.", "Номера DVB-S (Satellite) тюнеров для экспорта.",
+"The number of DVB-S2 (Satellite) tuners to export.", "Номера DVB-S2 (Satellite) тюнеров для экспорта.",
+"The number of DVB-T (Terresterial) tuners to export.", "Номера DVB-T (Terresterial) тюнеров для экспорта.",
+"The number of DVB-T2 (Terresterial) tuners to export.", "Номера DVB-T2 (Terresterial) тюнеров для экспорта.",
+"The provider's name.", "Имя провайдера.",
+"The provider's network ID.", "ID сети провайдера.",
+"The provider's network name.", "Имя сети провайдера.",
+"The service ID as set by the provider.", "ID сервиса установлен провайдером.",
+"The service name as set by the provider.", "Имена сервисов установленные провайдером.",
+"The service's channel number as set by the provider.", "Номера каналов установленные провайдером.",
+"The symbol rate.", "Символьная скорость.",
+"The total number of services found on this mux.", "Общее число найденных сервисов на этом мультиплексе.",
+"This tuner", "Этот Тюнер",
+"Thriller", "Триллер",
+"Thu", "Четв.",
+"Time", "Время",
+"Time missed", "Время не указано",
+"Time record caption", "Метка времени записи",
+"Time recording%s%s", "Время Записи%s%s",
+"Time update", "Время Обновления",
+"Timeout (sec) (0=infinite)", "ТаймАут (сек.) (0=бесконечн.)",
+"Timeout (seconds)", "Таймаут (сек.)",
+"Timeshift", "Тайм шифт",
+"Timout (secs)", "ТаймАут (сек.) ",
+"Title", "Название",
+"Title (regexp)", "Титлы (regexp)",
+"Tourism / Travel", "Туризм / Путешествия",
+"Traditional arts", "Традиционные искуства",
+"Traditional music", "Традиционная музыка",
+"Transmission mode", "Режим Передачи",
+"Transponder ID", "ID Траспондера",
+"Transport stream ID", "Транспортный поток ID",
+"Tue", "Вт.",
+"Tune before DiseqC", "Настроить перед DiseqC",
+"Tuner bind IP address", "Привязать тюнер к IP адресу",
+"Tuner configuration", "Конфигурация тюнера",
+"Tuning failed", "Настройка провалилась",
+"Turn off LNB when idle", "Выкл. LNB в простое",
+"Tvheadend server name", "Название Tvheadend сервера",
+"Type", "Тип",
+"UDP RTP port number (2 ports)", "UDP RTP Номер порта (2 порта)",
+"Unimportant", "Неважный",
+"Universal LNB only", "Только Универсальные LNB",
+"Unknown", "Неизвестно",
+"Unknown reason (%i)", "Причина неизвестна (%i)",
+"Unlimited size", "Не ограниченный Размер",
+"Unlimited time", "Не ограниченное Время",
+"Unset (default)", "Отменить (по умолчанию)",
+"Update channel icon", "Обновить иконки канала",
+"Update channel name", "Обновить имя канала",
+"Update channel number", "Обновить номер канала",
+"Update disabled", "Обновление отключено",
+"Update time", "Обновить время",
+"Updated", "Обновлённый",
+"Use Windows-compatible filenames", "Использовать Windows-совместимые имена файлов",
+"Use XSPF playlist instead of M3U", "Использовать XSPF плейлист вместо M3U",
+"Use a pre-defined list of ATSC-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Использовать предопределенный список ATSC-C мультиплексоров. Внимание: эти списки иногда могут быть устаревшими и могут вызвать сканирование которое занимает больше времени, чем обычно.",
+"Use a pre-defined list of ATSC-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Использовать предопределенный список ATSC-T мультиплексоров. Внимание: эти списки иногда могут быть устаревшими и могут вызвать сканирование которое занимает больше времени, чем обычно.",
+"Use a pre-defined list of DVB-C muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Использовать предопределенный список DVB-C мультиплексоров. Внимание: эти списки иногда могут быть устаревшими и могут вызвать сканирование которое занимает больше времени, чем обычно.",
+"Use a pre-defined list of DVB-S/S2 muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Использовать предопределенный список DVB-S/S2 мультиплексоров. Внимание: эти списки иногда могут быть устаревшими и могут вызвать сканирование которое занимает больше времени, чем обычно.",
+"Use a pre-defined list of DVB-T muxes. Note: these lists can sometimes be outdated and may cause scanning to take longer than usual.", "Использовать предопределенный список DVB-T мультиплексоров. Внимание: эти списки иногда могут быть устаревшими и могут вызвать сканирование которое занимает больше времени, чем обычно.",
+"Use original", "Используйте оригинал",
+"Use service IDs as channel numbers", "Использовать ID сервиса как номера каналов",
+"User access error", "Ошибка доступа пользователя",
+"User icon", "Пользовательские иконки",
+"User interface level", "Уровень пользовательского интерфейса",
+"User interface quick tips", "Пользовательский интерфейс быстрые подсказки",
+"User language", "Пользовательский язык",
+"User login", "Логин пользователя",
+"Username", "Имя пользователя",
+"Variety show", "Варьете",
+"Video", "Видео",
+"Video bitrate (kb/s) (0=auto)", "Видео Битрейт (кб/сек.) (0=Авто)",
+"Video codec", "Видео кодек",
+"Video recorder", "Видео рекордер",
+"Video stream filter", "Фильтр Видео Потока",
+"Visually impaired commentary/audio description", "Комментарий/описание аудио",
+"WEBTV profile H264/AAC/MPEG-TS", "WEBTV профиль H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "WEBTV профиль H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "WEBTV профиль VP8/Vorbis/WEBM",
+"Waiting for program start", "В ожидании запуска программы",
+"Waiting for stream", "В ожидании потока",
+"War", "Война",
+"Water sport", "Водный спорт",
+"Weak stream", "Слабый поток",
+"Weather report", "Прогноз погоды",
+"Web interface", "Web Интерфейс",
+"Web interface language", "Язык WEB интерфейса",
+"Web user interface", "Web Пользовательский интерфейс",
+"Wed", "Ср.",
+"Western", "Вестерн",
+"Wizard", "Мастер",
+"Wrapper (capmt_ca.so)", "Враппер (capmt_ca.so)",
+"Yes", "Да",
+"addpids/delpids supported", "addpids/delpids поддерживается",
+"hrs", "час.",
+"invalid option specified [%s]", "Указанный параметр недействителен [%s]",
+"min", "мин.",
+"mins", "минут",
+"option %s requires a value", "%s необходимо значение",
+"tvhdhomerun client", "tvhdhomerun Клиент",
+NULL, NULL
+};
+
+static const char *tvh_locale_21[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nFör mer information var vänlig och besök Tvheadends webbplats:\nhttps://tvheadend.org\n",
+"# Channels", "# Kanaler",
+"# Muxes", "# Muxar",
+"# Services", "# Servicar",
+"ACTIVE", "AKTIV",
+"ANY", "NÅGON",
+"Aborted by user", "Avbruten av användaren",
+"Adapter in use by another subscription", "Adapter används av en annan subskription",
+"Add file and line numbers to debug", "Lägg till fil och radnummer till fellog",
+"Add the thread ID to debug", "Lägg till tråd-id till fellogg",
+"Admin", "Administratör",
+"Adult movie", "Vuxenfilm",
+"Adventure", "Äventyr",
+"Advertisement / Shopping", "Reklam / Shopping",
+"All (Streaming plus DVR)", "Alla (strömning samt DVR)",
+"All DVR (rw)", "Alla DVR (rw)",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Alla bidrag används till drift av servrar och köp av testutrustning.",
+"Alternate PID path", "Alternativ PID-sökväg",
+"Alternate configuration path", "Alternativ konfigurationssökväg",
+"Animals", "Djur",
+"Any", "Någon",
+"Arts", "Konst",
+"Athletics", "Idrott",
+"Ballet", "Balett",
+"Bandwidth", "Bandbredd",
+"Based on software from", "Baserad på mjukvara från",
+"Brand", "Varumärke",
+"Broadcast", "Utsändning",
+"Broadcasting", "Utsändning",
+"Build", "Bygge",
+"Cartoons", "Tecknat",
+"Channel", "Kanal",
+"Channel icon path (see Help)", "Kanalikon sökväg (see Hjälp)",
+"Channels", "Kanaler",
+"Cinema", "Film",
+"Class", "Klass",
+"Classical", "Klassiskt",
+"Classical music", "Klassisk musik",
+"Clean effects", "Rensa effekter",
+"Comedy", "Komedi",
+"Comment", "Kommentar",
+"Commercial break", "Reklampaus",
+"Completed OK", "Klar OK",
+"Configuration", "Konfiguration",
+"Configuration ID", "Konfigurations-id",
+"Configuration version", "Konfigurationsversion",
+"Constellation", "Konstellation",
+"Contest", "Tävling",
+"Cooking", "Matlagning",
+"Copy codec type", "Kopiera kodek-typ",
+"Copy layout", "Kopiera layout",
+"Created", "Skapad",
+"Creator", "Skapare",
+"Culture (without music)", "Kultur (utan musik)",
+"Current affairs", "Aktuella frågor",
+"DBus - use the session message bus instead of the system one", "D-Bus - använd sessionens meddelandebuss istället för systemets",
+"DVB scan files path", "DVB sökväg skanna filer ",
+"DVB-S 4-port", "DVB-S 4-portar",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, experimentell)",
+"Dance", "Dans",
+"Days of Week", "Veckodagar",
+"Debate", "Debatt",
+"Debug libav log", "Debugga libav log",
+"Debug log path", "Debug log sökväg",
+"Debug subsystems", "Debug undersystem",
+"Debug to syslog", "Debug till syslog",
+"Debug trace (low-level)", "Debug trace (lågnivå)",
+"Default", "Standardläge",
+"Default language(s)", "Standard språk",
+"Description", "Beskrivning",
+"Detective", "Detektiv",
+"Device ID", "Enhets-id",
+"Directory", "Katalog",
+"Disable", "Inaktivera",
+"Disable DVB bouquets", "Inaktivera DVB bouquets",
+"Disable all access control checks", "Inaktivera alla accesskontrollkontroller",
+"Disable device/firmware-specific workarounds", "Inaktivera enhet/firmware-specifika fixar",
+"Disable syslog (all messages)", "Inaktivera syslog (alla meddelanden)",
+"Discussion", "Diskussion",
+"DiseqC repeats", "DiseqC upprepningar",
+"DiseqC switch", "DiseqC brytare",
+"Do not use", "Använd inte",
+"Documentary", "Dokumentär",
+"Don't backup configuration tree at upgrade", "Ta inte säkerhetskopia av konfigurationen vid uppgradering",
+"Don't keep", "Spara inte",
+"Economics", "Ekonomi",
+"Education", "Utbildning",
+"Educational", "Pedagogisk",
+"Enable (auto)", "Aktivera (automatisk)",
+"Enable DBus", "Aktivera D-Bus",
+"Enable coredumps for daemon", "Aktivera minnesdumpar för daemon",
+"Enable debug on stderr", "Aktivera felsökning till stderr",
+"Enable debug subsystems", "Aktivera felsökningsundersystem",
+"Enable debug to file", "Aktivera felsökning till fil",
+"Enable debug to syslog", "Aktivera felsökning till syslog",
+"Enable trace subsystems", "Aktivera spår-undersystem",
+"Enabled", "Aktiverad",
+"Encrypted", "Krypterad",
+"Environment", "Miljö",
+"Environment (pipe)", "Miljö (pipa)",
+"Episode", "Avsnitt",
+"Episode %d", "Avsnitt %d",
+"Errors", "Fel",
+"Every day", "Varje dag",
+"Reserved", "Reserverad",
+"Rewrite EIT", "Skriv om EIT",
+"Rewrite PAT", "Skriv om PAT",
+"Rewrite PMT", "Skriv om PMT",
+"Rewrite SDT", "Skriv om SDT",
+"Scheduled for recording", "Schemalagd för inspelning",
+"Season", "Säsong",
+"Season %d", "Säsong %d",
+"Send full PLAY cmd", "Skicka fullt PLAY-kommando",
+"Show version information", "Visa versions-information",
+"Signal quality too poor", "För dålig signal-kvalité",
+"Soap", "Såpa",
+"Soccer", "Fotboll",
+"Source", "Källa",
+"Source deleted", "Källa raderad",
+"Source quality is bad", "Källkvalité är dålig",
+"Source reconfigured", "Källa omkonfigurerad",
+"Specify User-Agent header for the http client", "Specificera User-Agent header för http-klienten",
+"Specify alternative htsp port", "Specificera alternativ htsp-port",
+"Specify alternative http port", "Specificera alternativ http-port",
+"Specify alternative http webroot", "Specificera alternativ http webroot",
+"Specify bind address", "Specificera adress att binda",
+"Specify extra htsp port", "Specificera extra htsp-port",
+"Stop", "Stoppa",
+"Streaming", "Strömning",
+"Subtitle", "Undertext",
+"Sun", "Sön",
+"Sync", "Synk",
+"Sync + Don't keep", "Synk + spara inte",
+"Tags", "Taggar",
+"Testing options", "Testval",
+"Thu", "Tors",
+"Title", "Titel",
+"Tue", "Tis",
+"Unknown", "Okänd",
+"Unknown reason (%i)", "Anledning okänd (%i)",
+"Use Windows-compatible filenames", "Använd Windows-kompatibla filnamn",
+"Username", "Användarnamn",
+"Waiting for stream", "Väntar på ström",
+"Wed", "Ons",
+"invalid option specified [%s]", "ogiltigt val specificerat [%s]",
+"mins", "minuter",
+"option %s requires a value", "alternativ %s kräver ett värde",
+NULL, NULL
+};
+
+static const char *tvh_locale_22[] = {
+"\nFor more information please visit the Tvheadend website:\nhttps://tvheadend.org\n", "\nДля більшої інформації зазирніть на веб-сторінку Tvheadend:\nhttps://tvheadend.org\n",
+"# Channels", "# Канали",
+"# Mapped channels", "# Відображені Канали",
+"# Muxes", "# Мультиплекси",
+"# Services", "# Сервіси",
+"# Services seen", "# Видимі сервіси",
+"# tune repeats", "# повтори тюнера",
+"(Default profile)", "(Типовий Профіль)",
+"1 day", "1 день",
+"1 month", "1 місяць",
+"1 week", "1 тиждень",
+"1 year", "1 рік",
+"2 months", "2 місяці",
+"2 weeks", "2 тижні",
+"2 years", "2 роки",
+"2-Port switch (universal LNB)", "2-портовий перемикач (Універсальний LNB)",
+"3 days", "3 дні",
+"3 months", "3 місяці",
+"3 weeks", "3 тижні",
+"3 years", "3 роки",
+"4-Port switch (universal LNB)", "4-портовий перемикач (універсальний LNB)",
+"5 days", "5 днів",
+"6 months", "6 місяців",
+"A", "А",
+"AA", "АА",
+"AB", "АБ",
+"AC-3 = descriptor 6", "AC-3 = дескриптор 6",
+"AC-3 detection", "Виявлення AC-3",
+"ACTIVE", "АКТИВНИЙ",
+"ANY", "БУДЬ-ЯКИЙ",
+"ATSC source ID", "ID джерела ATSC",
+"AUTO", "АВТО",
+"Aborted by user", "Перервано користувачем",
+"Access", "Доступ",
+"Action", "Дія",
+"Adapter in use by another subscription", "Адаптер вже у використанні",
+"Add file and line numbers to debug", "Додати файл і номери стрічок до відладки",
+"Admin", "Адміністратор",
+"Adult movie", "Фільм для дорослих",
+"Advanced", "Просунутий",
+"Advanced (non-universal LNBs, rotors, etc.)", "Просунутий (не універсальні LNB, ротори, етс.)",
+"Advanced streaming", "Розширене передавання потоку",
+"Adventure", "Пригоди",
+"Advertisement / Shopping", "Реклама / Купівля",
+"All (Streaming plus DVR)", "Все (передача потоку плюс DVR)",
+"All DVR (rw)", "Всі DVR (rw)",
+"All proceeds are used to support server infrastructure and buy test equipment.", "Всі кошти використовуються для підтримки інфраструктури серверу і покупки тестового обладнання.",
+"Alternate PID path", "Альтернативний шлях PID",
+"Alternate configuration path", "Альтернативний шлях до конфігурації",
+"Altitude (meters)", "Висота (метри)",
+"Animals", "Тварини",
+"Any", "Будь-що",
+"Arts", "Мистецтво",
+"Athletics", "Атлетика",
+"Audio bitrate (kb/s) (0=auto)", "Шв. потоку аудіо (кб/с) (0=Авто)",
+"Audio codec", "Кодек аудіо",
+"Audio stream filter", "Фільтр аудіо-потоку",
+"Auto", "Авто",
+"Auto check disabled", "Авто-перевірка вимкнена",
+"Auto check enabled", "Авто-перевірка ввімкнута",
+"Auto record", "Автозапис",
+"Auto recording%s%s", "Авто запис%s%s",
+"Auto time record", "Авто запис по часу ",
+"Auto-Map to channels", "Авто-відображення до каналів",
+"Automatic checking", "Автоматична перевірка",
+"Automatically map EPG source", "Автоматично відображати джерело телепрограми",
+"Automatically name from network", "Автоматична назва з мережі",
+"Autorec maximum count (0=unlimited)", "Максимальна кількість автозаписів (0=необмежено)",
+"B", "Б",
+"BB", "ББ",
+"Ballet", "Балет",
+"Bandwidth", "Ширина каналу",
+"Based on software from", "Основане на програмному забезпеченні від",
+"Basic", "Базовий",
+"Boot ID", "ID завантаження",
+"Bouquet", "Букет каналів",
+"Bouquet (auto)", "Букет каналів (авто)",
+"Brand", "Марка",
+"Broadcast", "Трансляція",
+"Broadcasting", "Трансляція",
+"Build", "Збірка",
+"CA client %i", "CA Клієнт %i",
+"CA identification", "CA Ідентифікація",
+"CA provider", "CA Постачальник",
+"CA stream filter", "Фільтр потоку CA",
+"CAPMT interval (ms)", "CAPMT Інтервал (мс)",
+"CAPMT query interval (ms)", "CAPMT Інтервал запиту (мс)",
+"Cache scheme", "Схема кешу",
+"Camd.socket filename / IP Address (TCP mode)", "Назва файлу Camd.socket  / IP Адреса (режим TCP)",
+"Cartoons", "Мультфільми",
+"Channel", "Канал",
+"Channel icon", "Іконка каналу",
+"Channel icon path (see Help)", "Шлях до іконки каналу (дивіться Допомогу)",
+"Channel name", "Назва каналу",
+"Channel number", "Номер каналу",
+"Channel number offset", "Зсув номеру каналу",
+"Channel numbers from", "Номер каналу з",
+"Channel tag", "Мітка каналу",
+"Channel tag reference", "Довідка про мітку каналу",
+"Channel tags", "Мітки каналу",
+"Channels", "Канали",
+"Character set", "Налаштування символів",
+"Children's / Youth programs", "Дитячі / Молодіжні програми",
+"Cinema", "Кіно",
+"Class", "Клас",
+"Classical", "Класика",
+"Classical music", "Класична музика",
+"Clean effects", "Ефекти очищення",
+"Client name", "Назва клієнта",
+"Code word client (newcamd)", "Клієнт кодування (newcamd)",
+"Comedy", "Комедія",
+"Command delay time (ms) (10-200)", "Час затримки команди (мс) (10-200)",
+"Command time (ms) (10-100)", "Час команди (мс) (10-100)",
+"Comment", "Коментар",
+"Commercial break", "Реклама",
+"Committed", "Зроблено",
+"Completed OK", "Завершено добре",
+"Conditional access client", "Клієнт умовного доступу",
+"Configuration", "Конфігурація",
+"Configuration ID", "ID Конфігурації",
+"Configuration name", "Назва конфігурації",
+"Configuration version", "Версія конфігурації",
+"Connection limit type", "Тип обмеження з’єднання",
+"Constellation", "Сузір’я",
+"Container", "Контейнер",
+"Content character set", "Налаштування символів вмісту",
+"Content type", "Тип вмісту",
+"Contest", "Зміст",
+"Continue even if descrambling fails", "Продовжити, навіть коли розкодувати не вдалося",
+"Cookie expiration (days)", "Тривалість життя тістечок (дні)",
+"Cooking", "Куховарство",
+"Copy codec type", "Тип кодека копіювання",
+"Copy layout", "Скопіювати розкладку",
+"Create bouquet", "Створити букет",
+"Created", "Створено",
+"Creator", "Творець",
+"Cron multi-line", "Стрічки для cron ",
+"Culture (without music)", "Культура (без музики)",
+"Current affairs", "Поточні справи",
+"DBus - use the session message bus instead of the system one", "DBus - використання буферу повідомлень сесії замість системного",
+"DES key", "Ключ DES",
+"DSCP/TOS for streaming", "DSCP/TOS для потоку",
+"DVB scan files", "Файли сканування DVB",
+"DVB scan files path", "Шлях до файлів сканування DVB",
+"DVB-C network", "Мережа DVB-C",
+"DVB-S 4-port", "DVB-S 4-порти",
+"DVB-S EN50494 (UniCable, experimental)", "DVB-S EN50494 (UniCable, експериментальне)",
+"DVB-S advanced", "Розширений DVB-S",
+"DVB-S network", "Мережа DVB-S",
+"DVB-S satellite configuration", "Конфігурація DVB-S супутника",
+"DVB-S simple", "DVB-S Просте",
+"DVB-T network", "Мережа DVB-T",
+"DVR behavior", "Поведінка DVR",
+"DVR configuration", "Конфігурація DVR",
+"DVR configuration profile", "Профіль конфігурації DVR",
+"DVR configuration profiles", "Профілі конфігурації DVR",
+"Dance", "Танці",
+"Data errors", "Помилка даних",
+"Days of Week", "День тижня",
+"Days of week", "День тижня",
+"Debate", "Дебати",
+"Debug options", "Опції відладки",
+"Debug subsystems", "Відладка підсистем",
+"Debug to syslog", "Передача журналу відладки до системного журналу",
+"Debugging", "Відладка",
+"Default", "Типово",
+"Default language(s)", "Типова мова(и)",
+"Default priority", "Типовий пріоритет",
+"Delivery system", "Система доставки",
+"Demux path", "Шлях до мультиплекса",
+"Description", "Опис",
+"Detective", "Детектив",
+"Device ID", "ID пристрою",
+"Device model", "Модель пристрою",
+"Device path", "Шлях до пристрою",
+"Directory", "Тека",
+"Directory permissions (octal, e.g. 0775)", "Права доступу до теки (вісімкові, напр. 0775)",
+"Disable", "Виключити",
+"Disable DVB bouquets", "Виключити групи каналів DVB",
+"Disable SAT>IP client", "Виключити клієнт SAT>IP",
+"Disable syslog (all messages)", "Вимкнути syslog (всі повідомлення)",
+"Disabled", "Вимкнено",
+"Discussion", "Дискусія",
+"DiseqC repeats", "DiseqC повтори",
+"DiseqC rotor", "DiseqC Ротор",
+"DiseqC switch", "DiseqC перемикач",
+"Do not use", "Не використовувати",
+"Documentary", "Документальне",
+"Don't backup configuration tree at upgrade", "Не створювати резервну копію дерева конфігурації при оновленні",
+"Don't include title in filename", "Не додавати назву до назви файлу",
+"Don't keep", "Не зберігати",
+"Don't re-record", "Не перезаписувати",
+"Don't reschedule", "Не переплановувати",
+"Drama", "Драма",
+"Duplicate handling", "Поводження з дублікатами",
+"EIT - skip TSID check", "EIT - пропустити перевірку TSID",
+"EPG grabber", "Захоплювач ТБ-програми",
+"EPG grabber channel", "Канал захоплювача ТБ-програми",
+"EPG grabber configuration", "Конфігурація захоплювача ТБ-програми",
+"EPG name", "Назва ТБ-програми",
+"EPG scan", "Сканування телепрограми",
+"EPG scan timeout in seconds (30-7200)", "Затримка сканування телепрограми в секундах (30-7200)",
+"EPG source", "Джерело телепрограми",
+"EPG update window", "Вікно оновлення телепрограми",
+"Economics", "Економіка",
+"Education", "Освіта",
+"Educational", "Освітнє",
+"Elementary stream filter", "Фільтр елементарного потоку",
+"Enable (auto)", "Ввімкнути (авто)",
+"Enable DBus", "Ввімкнути DBus",
+"Enable NTP driver", "Ввімкнути драйвер NTP",
+"Enable coredumps for daemon", "Включити створення дампів для демону",
+"Enable debug subsystems", "Ввімкнути підсистеми відладки",
+"Enable debug to file", "Ввімкнути відладку до файлу",
+"Enable debug to syslog", "Ввімкнути відладку до системного журналу",
+"Enable syslog", "Включити системний журнал",
+"Enable trace subsystems", "Ввімкнути підсистеми відслідковування",
+"Enabled", "Ввімкнено",
+"Encrypted", "Зашифровано",
+"Encrypted service", "Закритий сервіс",
+"Entertainment programs for 10 to 16", "Розважальні програми для 10 до 16",
+"Entertainment programs for 6 to 14", "Розважальні програми для 6 до 14",
+"Environment", "Середовище",
+"Environment (pipe)", "Середовище (pipe)",
+"Episode", "Епізод",
+"Episode %d", "Епізод %d",
+"Error code", "Код помилки",
+"Errors", "Помилки",
+"Even key", "Парний ключ",
+"Every day", "Кожен день",
+"Exclude channel tags", "Виключити мітки каналу",
+"Expeditions", "Експедиції",
+"Experimental film", "Експериментальний філм",
+"Expert", "Експертний",
+"Exported tuners", "Експортовані тюнери",
+"External", "Зовнішні",
+"External EPG grabber", "Зовнішній захоплювач телепрограми",
+"External IP (NAT)", "Зовнішній IP (NAT)",
+"External URL", "Зовнішній URL",
+"Extra arguments", "Додаткові аргументи",
+"Extra start time", "Додатковий час початку",
+"Extra stop time", "Додатковий час зупинки",
+"Extra warming up time (seconds)", "Додатковий час ініціалізації (секунди)",
+"FAIL", "НЕВДАЧА",
+"FEC high", "Найвищий FEC",
+"FEC low", "Найнижчий FEC",
+"Fantasy", "Фантастика",
+"File missing", "Пропущено файл",
+"File not created", "Файл не створено",
+"File permissions (octal, e.g. 0664)", "Права доступу до файлу (вісімкові, напр. 0664)",
+"File size", "Розмір файлу",
+"Filename", "Назва файлу",
+"Filename character set", "Налаштування символів назви файлу",
+"Filename options", "Опції назви файлу",
+"Film", "Фільм",
+"Fine arts", "Образотворче мистецтво",
+"Finished", "Закінчено",
+"Fitness and health", "Фітнес і здоров’я",
+"Folk", "Народне",
+"Folkloric", "Фольклор",
+"Football", "Футбол",
+"Force (auto)", "Вимусити (авто)",
+"Force CA ID (e.g. 0x2600)", "Вимусити CA ID (e.g. 0x2600)",
+"Force old status", "Вимусити старий статус",
+"Force priority", "Вимусити пріоритет",
+"Foreign countries", "Іноземні країни",
+"Forever", "Завжди",
+"Format string", "Формат стрічки",
+"Frequency", "Частота",
+"Frequency (Hz)", "Частота (Гц)",
+"Frequency (MHz)", "Частота (МГц)",
+"Frequency (kHz)", "Частота (кГц)",
+"Fri", "П’ят",
+"Friendly name", "Скорочена назва",
+"Full DiseqC", "Повний DiseqC",
+"Full-text", "Повний текст",
+"Further education", "Додаткова освіта",
+"GOTOX position", "GOTOX Позиція",
+"GOTOX rotor", "GOTOX Ротор",
+"Game show", "Ігрове шоу",
+"Gardening", "Садівництво",
+"General", "Загальне",
+"General configuration", "Загальна конфігурація",
+"Generic", "Загальне",
+"Generic options", "Загальні опції",
+"HD: high definition", "HD: Висока роздільна здатність",
+"HTSP Default Stream Settings", "Типові налаштування потоку HTSP",
+"HTSP stream profile", "Профіль потоку HTPS",
+"HTSP streaming", "Передавання потоку HTPS",
+"Hierarchy", "Ієрархія",
+"High", "Високий",
+"Historical movie", "Історичне кіно",
+"Horror", "Жахи",
+"Hostname/IP", "Назва серверу/IP",
+"IP address", "Адреса IP",
+"IP blocking", "Блокування IP",
+"IPTV Multiplex", "Мультиплекс IPTV",
+"IPTV automatic network", "Автоматична мережа IPTV",
+"IPTV input", "Ввід IPTV",
+"IPTV network", "Мережа IPTV",
+"ISI (Stream ID)", "ISI (ID потоку)",
+"Icon", "Іконка",
+"Icon (full URL)", "Іконка (повна адреса URL)",
+"Icon URL", "URL іконки",
+"Icon base URL", "Головний URL іконки",
+"Icon has title", "Іконка має назву",
+"Icons from", "Іконка з",
+"Idle", "\"Ліниве\" сканування",
+"Idle scan", "\"Ліниве\" сканування",
+"Idle scan muxes", "\"Ліниве\" сканування мультиплексів",
+"If you'd like to support the project, please consider a donation.", "Якщо Ви бажаєте підтримати проект, то зробіть, будь ласка, пожертву.",
+"Ignore EPG (EIT)", "Ігнорувати Телепрограму (EIT)",
+"Ignore descriptor 5", "Ігнорувати дескриптор 5",
+"Ignore invalid SSL certificate", "Ігнорувати неправильні сертифікати SSL",
+"Ignore provider's channel numbers", "Ігнорувати номери каналів, наданих постачальником",
+"Image cache", "Кеш зображень",
+"Immediately abort", "Негайно перервати",
+"Important", "Важливо",
+"Include channel name in filename", "Додавати назву каналу в назву файлу",
+"Include date in filename", "Додавати дату до назви файлу",
+"Include episode in filename", "Додавати епізод до назви файлу",
+"Include subtitle in filename", "Додавати субтитри в назву файлу",
+"Include time in filename", "Додавати час до назви файлу",
+"Index", "Індекс",
+"Information area", "Інформаційне поле",
+"Informational", "Інформаційно",
+"Initial scan", "Початкове сканування",
+"Input buffer (bytes)", "Вхідний буфер (байти)",
+"Input path", "Шлях вводу",
+"Interface", "Інтерфейс",
+"Internal", "Внутрішнє",
+"Internal EPG grabber", "Внутрішній захоплювач телепрограми",
+"Internal grabber", "Внутрішній захоплювач",
+"Interview", "Інтерв’ю",
+"Invalid", "Неправильно",
+"Invalid adapter number '%s'\n", "Неправильний номер адаптера '%s'\n",
+"Invalid target", "Неправильна ціль",
+"Jazz", "Джаз",
+"Keep", "Зберегти",
+"Kill signal (pipe)", "Вбити сигнал (трубка, pipe)",
+"Kill timeout (pipe/secs)", "Затримка  вбивання сигналу (pipe/сек)",
+"LNA (low noise amplifier)", "LNA (низько-шумний підсилювач)",
+"LNB type", "Тип LNB",
+"Language", "Мова",
+"Language settings", "Налаштування мови",
+"Languages", "Мови",
+"Last seen", "Востаннє помічено",
+"Last updated from", "Востаннє оновлювалося з",
+"Limit connections", "Обмеження з'єднань",
+"LinuxDVB network", "мережа LinuxDVB",
+"Listen / Connect port", "Слухати / Порт з'єднання",
+"Listen on IPv6", "Слухати на IPv6",
+"Literature", "Література",
+"Local bind IP address", "Локальна прив'язка адреси IP",
+"Local channel number", "Локальний номер каналу",
+"Local discovery IP address", "Локальний пошук адреси IP",
+"Location", "Місцезнаходження",
+"Log", "Журнал",
+"Login/Logout", "Вхід/Вихід",
+"Low", "Низький",
+"MPEG-TS input", "Ввід MPEG-TS",
+"MPEG-TS multiplex", "Мультиплекс MPEG-TS",
+"MPEG-TS service", "Сервіс MPEG-TS",
+"Magazines", "Журнали",
+"Maintained space", "Зайняте місце",
+"Make subdirectories per channel", "Робити підтеки для кожного каналу",
+"Make subdirectories per day", "Робити підтеки для днів",
+"Make subdirectories per title", "Робити підтеки для кожної назви",
+"Manufacturer", "Виробник",
+"Manufacturer URL", "URL виробника",
+"Map encrypted services", "Відображати закриті сервіси",
+"Map radio channels", "Відображення радіо-каналів",
+"Map unnamed channels", "Відображення неназваних каналів",
+"Map zero-numbered channels", "Відображення 0-нумерованих каналів",
+"Master tuner", "Головний тюнер",
+"Matroska (mkv)/built-in", "Matroska (mkv)/вбудований",
+"Matroska specific", "Специфічне для Matroska",
+"Maximal channel number", "Максимальний номер каналу",
+"Maximum duration", "Максимальна тривалість",
+"Maximum length of PIDs", "Максимальна довжина PID'ів",
+"Maximum period (mins)", "Максимальний період (хв)",
+"Medicine", "Медицина",
+"Melodrama", "Мелодрама",
+"Minimal channel number", "Мінімальний номер каналу",
+"Minimum duration", "Мінімальна тривалість",
+"Minimum rotor time (seconds)", "Мінімальний час ротору (секунди)",
+"Mode", "Режим",
+"Model description", "Опис моделі",
+"Model name", "Назва моделі",
+"Model number", "Номер моделі",
+"Modulation", "Модуляція",
+"Module", "Модуль",
+"Module ID", "ID модулю",
+"Mon", "Пон",
+"Mono", "Моно",
+"More verbose libav log", "Більш розширений журнал libav",
+"Movie", "Фільми",
+"Music", "Музика",
+"Musical", "Музичні",
+"Mux", "Мультиплекс",
+"NONE", "НІЧОГО",
+"Name", "Назва",
+"Names", "Назви",
+"Natural sciences", "Природничі науки",
+"Nature", "Природа",
+"Network", "Мережа",
+"Network A", "Мережа A",
+"Network B", "Мережа B",
+"Network ID (limit scanning)", "ID мережі (обмеження сканування)",
+"Network UUID", "UUID мережі",
+"Network discovery", "Пошук мережі",
+"Network name", "Назва мережі",
+"Network prefix", "Префікс мережі",
+"Network type", "Тип мережі",
+"Networks", "Мережі",
+"News", "Новини",
+"News magazine", "Журнали новин",
+"Next tune delay in ms (0-2000)", "Наступна затримка настройки в мс (0-2000)",
+"No", "Ні",
+"No PIN", "Немає PIN",
+"No access", "Немає доступу",
+"No adapters specified!\n", "Не вказано адаптера!\n",
+"No assigned adapters", "Немає асоційованого адаптера",
+"No days", "Немає днів",
+"No descrambler", "Немає розкодовувача",
+"No free adapter", "Немає вільного адаптера",
+"No input detected", "Не знайдено вхідного сигналу",
+"No service assigned to channel", "Немає сервісу, асоційованого з каналом",
+"No service enabled", "Немає ввімкнутих сервісів",
+"No source available", "Немає доступних джерел",
+"None", "Нічого",
+"Normal", "Нормальне",
+"Not set", "Не встановлено",
+"Not set (none or channel configuration)", "Не встановлено (немає або конфігурація каналу)",
+"Not set (use channel or DVR configuration)", "Не встановлено (використати конфігурацію каналу або DVR)",
+"Number", "Номер",
+"OK", "Добре",
+"OK (partial)", "Добре (частково)",
+"OSCam (rev >= 9095)", "OSCam (рев. >= 9095)",
+"OSCam TCP (rev >= 9574)", "OSCam TCP (рев >= 9574)",
+"OSCam net protocol (rev >= 10389)", "Протокол мережі OSCam (рев >= 10389)",
+"OSCam new pc-nodmx (rev >= 10389)", "OSCam новий pc-nodmx (rev >= 10389)",
+"OSCam pc-nodmx (rev >= 9756)", "OSCam pc-nodmx (рев >= 9756)",
+"Odd key", "Непарний ключ",
+"Off", "Викл.",
+"Older OSCam", "Старіший OSCam",
+"On", "Вкл.",
+"On file removal", "При вилученні файлу",
+"Only Bulsatcom 39E", "Тільки Bulsatcom 39E",
+"Only EIT", "Тільки EIT",
+"Only OpenTV Sky Ausat", "Тільки OpenTV Sky Ausat",
+"Only OpenTV Sky Italia", "Тільки OpenTV Sky Italia",
+"Only OpenTV Sky UK", "Тільки OpenTV Sky UK",
+"Only UK Freesat", "Тільки UK Freesat",
+"Only UK Freeview", "Тільки UK Freeview",
+"Only Viasat Baltic", "Тільки Viasat Baltic",
+"Only preferred CA PID", "Тільки улюблені CA PID",
+"OpenTV channel number", "Номер каналу OpenTV",
+"Opera", "Опера",
+"Orbital position", "Орбітальна позиція",
+"Orbital positions", "Орбітальні позиції",
+"Original network ID", "Оригінальний ID мережі",
+"Other stream filter", "Інший фільтр потоку",
+"Owner", "Власник",
+"PLS code", "Код PLS",
+"PLS mode", "Режим PLS",
+"Password", "Пароль",
+"Password2", "Пароль2",
+"Passwords", "Паролі",
+"Path", "Шлях",
+"Periodically save EPG to disk (hours)", "Періодично записувати телепрограму на диск (години)",
+"Persistent user interface level", "Постійний рівень інтерфейсу користувача",
+"Physiology", "Психологія",
+"Polarization", "Поляризація",
+"Political issues", "Політичні події",
+"Pop", "Поп",
+"Popular culture", "Популярна культура",
+"Port", "Порт",
+"Position", "Позиція",
+"Post-processor command", "Команда після процесу",
+"Post-remove command", "Команда після вилучення",
+"Power save", "Збереження енергії",
+"Preferred CA PID", "Улюблені PIDи CA",
+"Preferred service video type", "Улюблений тип відео сервісу",
+"Presentation", "Презентація",
+"Press", "Преса",
+"Priority", "Пріоритет",
+"Priority (-10..10)", "Пріорітет (-10..10)",
+"Private", "Приватне",
+"Profile name", "Назва профілю",
+"Provider", "Постачальник",
+"Provider ID", "ID постачальника",
+"Provider network name", "Назва мережі постачальника",
+"Psychology", "Психологія",
+"Puppets", "Ляльки",
+"Quiz", "Вікторина",
+"RAM only", "Тільки RAM",
+"RTSP port", "Порт RTSP",
+"RTSP port (554 or 9983, 0 = disable)", "Порт RTSP (554 або 9983, 0 = відключити)",
+"RTSP/TCP (embedded data)", "RTSP/TCP (включені дані)",
+"Re-fetch period (hours)", "Період отримання даних (години)",
+"Re-fetch period (mins)", "Період отримання даних (хв)",
+"Re-record%s%s", "Перезапис%s%s",
+"Re-try period (hours)", "Період поновної спроби (години)",
+"Record all", "Записати все",
+"Recording file options", "Опції файлу запису",
+"Recording system path", "Системний шлях запису ",
+"Reject", "Вийняти",
+"Religion", "Релігія",
+"Religious", "Рілігійні",
+"Remarkable people", "Відомі люди",
+"Remove HTTP arguments", "Вилучити аргументи HTTP",
+"Reports", "Звіти",
+"Rerun of", "Перезапустити",
+"Rescan", "Пересканувати",
+"Reserved", "Зарезервовано",
+"Resolution (height)", "Роздільна здатність (висота)",
+"Restart on error", "Перезапустити при помилці",
+"Reuse EPG from", "Використати телепрограму з",
+"Rewrite EIT", "Перезаписати EIT",
+"Rock", "Рок",
+"Rolloff", "Крен",
+"Romance", "Романс",
+"Rotor initialization time (seconds)", "Час ініціалізації ротора (секунди)",
+"Rotor type", "Тип ротору",
+"Run as group", "Запустити як група",
+"Run as user", "Запустити як користувач",
+"Running", "Запущено",
+"SAT>IP client", "Клієнт SAT>IP",
+"SAT>IP server", "Сервер SAT>IP",
+"SD: standard definition", "HD: стандартна роздільна здатність",
+"Sat", "Суб",
+"Satellite longitude", "Довгота супутника",
+"Satellite positions", "Позиція супутника",
+"Scan after creation", "Сканування після створення",
+"Scan result", "Результат сканування",
+"Scan status", "Статус сканування",
+"Schedule status", "Статус розкладу",
+"Scheduled for recording", "Заплановано для запису",
+"Scheduled start time", "Запланований час початку",
+"Scheduled stop time", "Запланований час закінчення",
+"School programs", "Шкільні програми",
+"Science", "Наука",
+"Science fiction", "Фантастика",
+"Season", "Сезон",
+"Season %d", "Сезон %d",
+"Send CAPMT query", "Вислати запит CAPMT",
+"Serial number", "Серійний номер",
+"Serious", "Серйозне",
+"Serious music", "Серйозна музика",
+"Server", "Сервер",
+"Server UUID", "Сервер UUID",
+"Service", "Сервіс",
+"Service ID", "ID сервісу",
+"Service configuration", "Конфігурація сервісу",
+"Service mapper", "Відображення сервісу",
+"Service mapping", "Відображення сервісу",
+"Service name", "Назва сервісу",
+"Service type", "Тип сервісу",
+"Services", "Сервіси",
+"Settings", "Налаштування",
+"Show", "Показати",
+"Show this page", "Показати цю сторінку",
+"Show version information", "Показати інформацію про версію",
+"Signal quality too poor", "Якість сигналу дуже погана",
+"Signal scale (240 or 100)", "Шкала сигналу (240 або 100)",
+"Skip TS packets (0-200)", "Пропустити пакети TS (0-200)",
+"Skip commercials", "Пропустити реклами",
+"Skip initial bytes", "Пропустити початкові байти",
+"Skip initial scan", "Пропустити початкове сканування",
+"Soap", "Мильні опери",
+"Soccer", "Футбол",
+"Social", "Соціальні",
+"Social advisory", "Соціальні поради",
+"Sort index", "Індекс сортування",
+"Source", "Джерело",
+"Source deleted", "Джерело вилучено",
+"Source quality is bad", "Якість джерела погана",
+"Source reconfigured", "Джерело переконфігуроване",
+"Special events (Olympic Games, World Cup, etc.)", "Спеціальні події (Олімпійські ігри, Кубок світу, етс.)",
+"Specify alternative htsp port", "Вказати альтернативний порт htsp",
+"Specify alternative http port", "Вказати альтернативний порт http",
+"Sports", "Спорт",
+"Sports magazines", "Спортивні журнали",
+"Squash", "Сквош",
+"Standard", "Стандартний",
+"Start", "Почати",
+"Start after", "Почати після",
+"Start before", "Почати перед",
+"Start time", "Час початку",
+"Status", "Статус",
+"Status period (ms)", "Період перевірки статусу (мс)",
+"Stereo", "Стерео",
+"Stop", "Зупинити",
+"Stop time", "Час зупинки",
+"Storage path", "Шлях до місця зберігання",
+"Storage space", "Розмір місця зберігання",
+"Stream index", "Індекс потоку",
+"Stream profile", "Профіль потоку",
+"Stream type", "Тип потоку",
+"Streaming", "Висилання потоку",
+"Streaming priority", "Пріоритет потоку",
+"Streaming profiles", "Профілі потоку",
+"Subdirectory options", "Опції підтеки",
+"Subscribe to a service permanently", "Підписатися до сервісу на постійно",
+"Subscription overridden", "Підписка перезаписана",
+"Subscription weight", "Вага підписки",
+"Subtitle", "Субтитри",
+"Subtitle codec", "Кодек субтитрів",
+"Subtitle stream filter", "Фільтр потоку субтитрів",
+"Sun", "Нед",
+"Switch before rotor", "Перемкнути перед ротору",
+"Switch type", "Тип переключення",
+"Switch: %s", "Переключення: %s",
+"Symbol rate (Sym/s)", "Швидкість передачі (Символів/сек)",
+"Sync", "Синхронізація",
+"Sync + Don't keep", "Синхронізувати + Не зберігати",
+"System", "Система",
+"Tag files with metadata", "Файли міток з метаданими",
+"Tags", "Мітки",
+"Talk show", "Ток-шоу",
+"Team sports (excluding football)", "Командний спорт (за виключенням футболу)",
+"Technology", "Технологія",
+"Teletext stream filter", "Фільтр потоку телетексту",
+"Tennis", "Теніс",
+"Testing", "Тестування",
+"Testing options", "Опції тестування",
+"This tuner", "Цей тюнер",
+"Thriller", "Трилер",
+"Thu", "Чет",
+"Time", "Час",
+"Time missed", "Час пропущено",
+"Time recording%s%s", "Час запису%s%s",
+"Time update", "Оновлення часу",
+"Timeout (sec) (0=infinite)", "Затримка (сек) (0=нескінченість)",
+"Timeout (seconds)", "Затримка (секунди)",
+"Timeshift", "Зсув часу",
+"Timout (secs)", "Тайм-аут (сек) ",
+"Title", "Назва",
+"Title (regexp)", "Назва (регулярний вираз)",
+"Tourism / Travel", "Туризм / Подорожі",
+"Traditional arts", "Традиційне мистецтво",
+"Traditional music", "Традиційна музика",
+"Transcode/av-lib", "Транскодування/av-lib",
+"Transcoding", "Транскодування",
+"Transmission mode", "Режим передачі",
+"Transponder ID", "ID транспондера",
+"Transport stream ID", "ID транспортного потоку",
+"Tue", "Вів",
+"Tuner configuration", "Налаштування тюнера",
+"Turn off LNB when idle", "Виключити LNB, якщо не використовується",
+"Tvheadend server name", "Назва серверу Tvheadend",
+"Type", "Тип",
+"UDP RTP port number (2 ports)", "Номер порту UDP RTP (2 порти)",
+"Universal LNB only", "Тільки універсальний LNB",
+"Unknown", "Невідомо",
+"Unknown reason (%i)", "Невідома причина (%i)",
+"Unlimited size", "Необмежений розмір",
+"Unlimited time", "Необмежений час",
+"Unset (default)", "Не встановлено (типово)",
+"Update card (EMM)", "Оновити карту (EMM)",
+"Update channel icon", "Оновити іконки каналу",
+"Update channel name", "Оновити назву каналу",
+"Update channel number", "Оновити номер каналу",
+"Update disabled", "Оновлення вимкнено",
+"Update time", "Оновити час",
+"Updated", "Оновлено",
+"Usage: %s [OPTIONS]\n", "Використання: %s [ОПЦІЇ]\n",
+"Use original", "Використовувати оригінал",
+"Use service IDs as channel numbers", "Використовувати ID сервісу як номер каналу",
+"User access error", "Помилка доступу користувача",
+"User interface level", "Рівень інтерфейсу користувача",
+"User language", "Мова користувача",
+"User limit reached", "Досягнуто межу кількості користувачів",
+"Username", "Назва користувача",
+"Variety show", "Шоу варьєте",
+"Video", "Відео",
+"Video bitrate (kb/s) (0=auto)", "Шв. потоку відео (кб/с) (0=авто)",
+"Video codec", "Кодек відео",
+"Video recorder", "Записувач відео",
+"Video stream filter", "Фільтр відео-потоку",
+"WEBM/built-in", "WEBM/вбудоване",
+"WEBTV profile H264/AAC/MPEG-TS", "Профіль WEBTV для H264/AAC/MPEG-TS",
+"WEBTV profile H264/AAC/Matroska", "Профіль WEBTV для H264/AAC/Matroska",
+"WEBTV profile VP8/Vorbis/WEBM", "Профіль WEBTV для VP8/Vorbis/WEBM",
+"Waiting for program start", "Очікування на початок програми",
+"Waiting for stream", "Очікування на потік",
+"War", "Війна",
+"Water sport", "Водні види спорту",
+"Weak stream", "Слабий потік",
+"Weather report", "Прогноз погоди",
+"Web interface", "Веб-інтерфейс",
+"Web interface language", "Мова веб-інтерфейсу",
+"Web user interface", "Веб-інтерфейс користувача",
+"Wed", "Сер",
+"Western", "Вестерн",
+"Yes", "Так",
+"addpids/delpids supported", "addpids/delpids підтримується",
+"hrs", "год",
+"invalid option specified [%s]", "вказано неправильну опцію [%s]",
+"min", "хв",
+"mins", "хвилини",
+"option %s requires a value", "опція %s вимагає значення",
+"tvhdhomerun client", "клієнт tvhdhomerun",
+NULL, NULL
+};
+
+static struct tvh_locale tvh_locales[] = {
+{ "bg", tvh_locale_1 },
+{ "cs", tvh_locale_2 },
+{ "da", tvh_locale_3 },
+{ "de", tvh_locale_4 },
+{ "en_US", tvh_locale_5 },
+{ "en_GB", tvh_locale_6 },
+{ "es", tvh_locale_7 },
+{ "et", tvh_locale_8 },
+{ "fa", tvh_locale_9 },
+{ "fi", tvh_locale_10 },
+{ "fr", tvh_locale_11 },
+{ "he", tvh_locale_12 },
+{ "hr", tvh_locale_13 },
+{ "hu", tvh_locale_14 },
+{ "it", tvh_locale_15 },
+{ "lv", tvh_locale_16 },
+{ "nl", tvh_locale_17 },
+{ "pl", tvh_locale_18 },
+{ "pt", tvh_locale_19 },
+{ "ru", tvh_locale_20 },
+{ "sv", tvh_locale_21 },
+{ "uk", tvh_locale_22 }
+};
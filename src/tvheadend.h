@@ -169,7 +169,7 @@ typedef enum {
 typedef void (mti_callback_t)(void *opaque);
 
 typedef struct mtimer {
-  LIST_ENTRY(mtimer) mti_link;
+  uint32_t mti_heapidx;   /* position in the timer heap (when armed) */
   mti_callback_t *mti_callback;
   void *mti_opaque;
   int64_t mti_expire;
@@ -200,7 +200,7 @@ void mtimer_disarm(mtimer_t *mti);
 typedef void (gti_callback_t)(void *opaque);
 
 typedef struct gtimer {
-  LIST_ENTRY(gtimer) gti_link;
+  uint32_t gti_heapidx;   /* position in the timer heap (when armed) */
   gti_callback_t *gti_callback;
   void *gti_opaque;
   time_t gti_expire;
@@ -222,6 +222,12 @@ void GTIMER_FCN(gtimer_arm_absn)
 
 void gtimer_disarm(gtimer_t *gti);
 
+/*
+ * timer statistics (armed timers, callback durations)
+ */
+
+htsmsg_t *tvh_timer_stats(int reset);
+
 
 /*
  * tasklet
@@ -229,16 +235,31 @@ void gtimer_disarm(gtimer_t *gti);
 
 typedef void (tsk_callback_t)(void *opaque, int disarmed);
 
+#define TASKLET_BULK    (1<<0) /* I/O heavy, never occupies all workers */
+#define TASKLET_SERIAL  (1<<1) /* in order, one at a time (same class) */
+
 typedef struct tasklet {
   TAILQ_ENTRY(tasklet) tsk_link;
   tsk_callback_t *tsk_callback;
   void *tsk_opaque;
   int tsk_allocated;
+  int tsk_flags;
+  int64_t tsk_queued;
 } tasklet_t;
 
-tasklet_t *tasklet_arm_alloc(tsk_callback_t *callback, void *opaque);
-void tasklet_arm(tasklet_t *tsk, tsk_callback_t *callback, void *opaque);
+tasklet_t *tasklet_arm_alloc_flags
+  (tsk_callback_t *callback, void *opaque, int flags);
+void tasklet_arm_flags
+  (tasklet_t *tsk, tsk_callback_t *callback, void *opaque, int flags);
 void tasklet_disarm(tasklet_t *gti);
+htsmsg_t *tasklet_stats(int reset);
+
+static inline tasklet_t *
+tasklet_arm_alloc(tsk_callback_t *callback, void *opaque)
+  { return tasklet_arm_alloc_flags(callback, opaque, 0); }
+static inline void
+tasklet_arm(tasklet_t *tsk, tsk_callback_t *callback, void *opaque)
+  { tasklet_arm_flags(tsk, callback, opaque, 0); }
 
 
 /*
@@ -817,6 +838,12 @@ uint8_t *tvh_gzip_inflate ( const uint8_t *data, size_t size, size_t orig );
 uint8_t *tvh_gzip_deflate ( const uint8_t *data, size_t orig, size_t *size );
 int      tvh_gzip_deflate_fd ( int fd, const uint8_t *data, size_t orig, size_t *size, int speed );
 int      tvh_gzip_deflate_fd_header ( int fd, const uint8_t *data, size_t orig, int speed );
+struct z_stream_s;
+struct htsbuf_queue;
+struct z_stream_s *tvh_gzip_deflate_stream_init ( int speed );
+int      tvh_gzip_deflate_stream ( struct z_stream_s *zstr, struct htsbuf_queue *in,
+                                   struct htsbuf_queue *out, int finish );
+void     tvh_gzip_deflate_stream_end ( struct z_stream_s *zstr );
 #endif
 
 /* URL decoding */
@@ -864,4 +891,6 @@ void tvh_qsort_r(void *base, size_t nmemb, size_t size, int (*compar)(const void
 #define PRItime_t       "ld"
 #endif
 
+#include "lockprof.h"
+
 #endif /* TVHEADEND_H */
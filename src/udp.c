@@ -29,6 +29,7 @@
 #include <assert.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>
 #include <netdb.h>
 #include <net/if.h>
 #ifndef IPV6_ADD_MEMBERSHIP
@@ -341,10 +342,12 @@ fail:
 
 udp_connection_t *
 udp_sendinit ( const char *subsystem, const char *name,
-               const char *ifname, int txsize )
+               const char *ifname, const char *host, int port,
+               int txsize )
 {
   int fd, ifindex;
   udp_connection_t *uc;
+  char buf[50];
 
   uc = calloc(1, sizeof(udp_connection_t));
   uc->fd                   = -1;
@@ -352,6 +355,16 @@ udp_sendinit ( const char *subsystem, const char *name,
   uc->subsystem            = subsystem ? strdup(subsystem) : NULL;
   uc->name                 = name ? strdup(name) : NULL;
   uc->rxtxsize             = txsize;
+  uc->peer_host            = host ? strdup(host) : NULL;
+  uc->peer_port            = port;
+
+  /* The socket family and the multicast setup follow the destination */
+  if (udp_resolve(uc, &uc->peer, host, port, &uc->peer_multicast, 0)) {
+    udp_close(uc);
+    return UDP_FATAL_ERROR;
+  }
+  uc->ip.ss_family = uc->peer.ss_family;
+  uc->multicast    = uc->peer_multicast;
 
   /* Open socket */
   if ((fd = tvh_socket(uc->ip.ss_family, SOCK_DGRAM, 0)) == -1) {
@@ -409,6 +422,15 @@ udp_sendinit ( const char *subsystem, const char *name,
     tvhwarn(subsystem, "%s - cannot increase UDP tx buffer size [%s]",
             name, strerror(errno));
 
+  if (connect(fd, (struct sockaddr *)&uc->peer,
+              uc->peer.ss_family == AF_INET6 ?
+                sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in))) {
+    inet_ntop(uc->peer.ss_family, IP_IN_ADDR(uc->peer), buf, sizeof(buf));
+    tvherror(subsystem, "%s - cannot connect to %s:%hu [e=%s]",
+             name, buf, ntohs(IP_PORT(uc->peer)), strerror(errno));
+    goto error;
+  }
+
   return uc;
 
 error:
@@ -731,9 +753,26 @@ udp_multisend_clean( udp_multisend_t *um )
 }
 
 int
-udp_multisend_send( udp_multisend_t *um, int fd, int packets )
+udp_sendmmsg( int fd, struct mmsghdr *msg, int packets )
 {
   static char use_emul = 0;
+  int n;
+  if (!use_emul) {
+    n = sendmmsg(fd, msg, packets, MSG_DONTWAIT);
+  } else {
+    n = -1;
+    errno = ENOSYS;
+  }
+  if (n < 0 && errno == ENOSYS) {
+    use_emul = 1;
+    n = sendmmsg_i(fd, msg, packets, MSG_DONTWAIT);
+  }
+  return n;
+}
+
+int
+udp_multisend_send( udp_multisend_t *um, int fd, int packets )
+{
   int n, i;
   if (um == NULL) {
     errno = EINVAL;
@@ -743,19 +782,39 @@ udp_multisend_send( udp_multisend_t *um, int fd, int packets )
     packets = um->um_packets;
   for (i = 0; i < packets; i++)
     ((struct mmsghdr *)um->um_msg)[i].msg_len = um->um_iovec[i].iov_len;
-  if (!use_emul) {
-    n = sendmmsg(fd, (struct mmsghdr *)um->um_msg, packets, MSG_DONTWAIT);
-  } else {
-    n = -1;
-    errno = ENOSYS;
-  }
-  if (n < 0 && errno == ENOSYS) {
-    use_emul = 1;
-    n = sendmmsg_i(fd, (struct mmsghdr *)um->um_msg, packets, MSG_DONTWAIT);
-  }
+  n = udp_sendmmsg(fd, (struct mmsghdr *)um->um_msg, packets);
   if (n > 0) {
     for (i = 0; i < n; i++)
       um->um_iovec[i].iov_len = ((struct mmsghdr *)um->um_msg)[i].msg_len;
   }
   return n;
 }
+
+/*
+ * UDP generic segmentation offload - the kernel splits one large
+ * datagram to segsize chunks (linux 4.18+)
+ */
+
+#if defined(__linux__) && !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif
+
+int
+udp_gso_set( struct msghdr *msg, void *cbuf, int segsize )
+{
+#ifdef UDP_SEGMENT
+  struct cmsghdr *cm;
+  uint16_t val = segsize;
+
+  msg->msg_control = cbuf;
+  msg->msg_controllen = CMSG_SPACE(sizeof(val));
+  cm = CMSG_FIRSTHDR(msg);
+  cm->cmsg_level = IPPROTO_UDP;
+  cm->cmsg_type = UDP_SEGMENT;
+  cm->cmsg_len = CMSG_LEN(sizeof(val));
+  memcpy(CMSG_DATA(cm), &val, sizeof(val));
+  return 0;
+#else
+  return -1;
+#endif
+}
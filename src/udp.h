@@ -53,7 +53,8 @@ udp_bind_double ( udp_connection_t **_u1, udp_connection_t **_u2,
                   int txsize1, int txsize2 );
 udp_connection_t *
 udp_sendinit ( const char *subsystem, const char *name,
-               const char *ifname, int txsize );
+               const char *ifname, const char *host, int port,
+               int txsize );
 int
 udp_connect ( udp_connection_t *uc, const char *name,
               const char *host, int port );
@@ -101,4 +102,12 @@ udp_multisend_free( udp_multisend_t *um );
 int
 udp_multisend_send( udp_multisend_t *um, int fd, int packets );
 
+int
+udp_sendmmsg( int fd, struct mmsghdr *msg, int packets );
+
+#define UDP_GSO_CMSG_SPACE CMSG_SPACE(sizeof(uint16_t))
+
+int
+udp_gso_set( struct msghdr *msg, void *cbuf, int segsize );
+
 #endif /* UDP_H_ */
@@ -740,7 +740,8 @@ deferred_unlink(const char *filename, const char *rootdir)
     return r;
   }
   if (rootdir == NULL)
-    tasklet_arm_alloc(deferred_unlink_cb, s);
+    tasklet_arm_alloc_flags(deferred_unlink_cb, s,
+                            TASKLET_BULK | TASKLET_SERIAL);
   else {
     du = calloc(1, sizeof(*du));
     if (du == NULL) {
@@ -749,7 +750,8 @@ deferred_unlink(const char *filename, const char *rootdir)
     }
     du->filename = s;
     du->rootdir = strdup(rootdir);
-    tasklet_arm_alloc(deferred_unlink_dir_cb, du);
+    tasklet_arm_alloc_flags(deferred_unlink_dir_cb, du,
+                            TASKLET_BULK | TASKLET_SERIAL);
   }
   return 0;
 }
@@ -0,0 +1 @@
+const char *tvheadend_version = "0.0.0-unknown";
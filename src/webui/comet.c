@@ -22,6 +22,7 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <string.h>
+#include <poll.h>
 #include <arpa/inet.h>
 #include <sys/socket.h>
 #include <openssl/sha.h>
@@ -44,6 +45,17 @@ static int comet_waiting;
 
 #define MAILBOX_UNUSED_TIMEOUT      20
 #define MAILBOX_EMPTY_REPLY_TIMEOUT 10
+#define MAILBOX_WS_PING_INTERVAL    30
+
+#define WS_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WS_OP_TEXT  0x1
+#define WS_OP_CLOSE 0x8
+#define WS_OP_PING  0x9
+#define WS_OP_PONG  0xa
+
+#define WS_MAX_PAYLOAD     65536
+#define WS_CLOSE_PROTOCOL  1002
+#define WS_CLOSE_TOO_BIG   1009
 
 //#define mbdebug(fmt...) printf(fmt);
 #define mbdebug(fmt...)
@@ -54,26 +66,130 @@ static LIST_HEAD(, comet_mailbox) mailboxes;
 int mailbox_tally;
 int comet_running;
 
+/*
+ * Notifications are immutable and shared by all mailboxes. The JSON
+ * text is rendered once per UI language on the first delivery. All
+ * fields are protected by comet_mutex.
+ */
+typedef struct comet_message_text {
+  struct comet_message_text *cmt_next;
+  char *cmt_lang;
+  char *cmt_json;
+  size_t cmt_len;
+} comet_message_text_t;
+
+typedef struct comet_message {
+  int cm_refcount;
+  int cm_rewrite;
+  uint32_t cm_hash;   /* coalescing key hash (0 = never coalesce) */
+  char *cm_key;
+  htsmsg_t *cm_msg;
+  comet_message_text_t *cm_texts;
+} comet_message_t;
+
 typedef struct comet_mailbox {
   char *cmb_boxid; /* SHA-1 hash */
   char *cmb_lang;  /* UI language */
-  htsmsg_t *cmb_messages; /* A vector */
+  comet_message_t **cmb_queue;
+  int cmb_count;
+  int cmb_alloc;
   int64_t cmb_last_used;
   LIST_ENTRY(comet_mailbox) cmb_link;
   int cmb_debug;
 } comet_mailbox_t;
 
 
+/**
+ *
+ */
+static comet_message_t *
+comet_message_create(htsmsg_t *m, int rewrite, const char *key)
+{
+  comet_message_t *cm = calloc(1, sizeof(*cm));
+
+  cm->cm_refcount = 1;
+  cm->cm_rewrite = rewrite;
+  cm->cm_msg = m;
+  if (key) {
+    cm->cm_key = strdup(key);
+    cm->cm_hash = tvh_crc32((uint8_t *)key, strlen(key), 0) | 1;
+  }
+  return cm;
+}
+
+static void
+comet_message_release(comet_message_t *cm)
+{
+  comet_message_text_t *cmt;
+
+  if (--cm->cm_refcount > 0)
+    return;
+  while ((cmt = cm->cm_texts) != NULL) {
+    cm->cm_texts = cmt->cmt_next;
+    free(cmt->cmt_lang);
+    free(cmt->cmt_json);
+    free(cmt);
+  }
+  htsmsg_destroy(cm->cm_msg);
+  free(cm->cm_key);
+  free(cm);
+}
+
+/**
+ *
+ */
+static void
+cmb_queue_add(comet_mailbox_t *cmb, comet_message_t *cm)
+{
+  comet_message_t *cm2;
+  int i;
+
+  /* coalesce - only the last state of an object is sent */
+  if (cm->cm_hash) {
+    for (i = cmb->cmb_count - 1; i >= 0; i--) {
+      cm2 = cmb->cmb_queue[i];
+      if (cm2->cm_hash == cm->cm_hash && !strcmp(cm2->cm_key, cm->cm_key)) {
+        comet_message_release(cm2);
+        memmove(cmb->cmb_queue + i, cmb->cmb_queue + i + 1,
+                (cmb->cmb_count - i - 1) * sizeof(comet_message_t *));
+        cmb->cmb_count--;
+        break;
+      }
+    }
+  }
+  if (cmb->cmb_count >= cmb->cmb_alloc) {
+    cmb->cmb_alloc = MAX(16, cmb->cmb_alloc * 2);
+    cmb->cmb_queue = realloc(cmb->cmb_queue,
+                             cmb->cmb_alloc * sizeof(comet_message_t *));
+  }
+  cm->cm_refcount++;
+  cmb->cmb_queue[cmb->cmb_count++] = cm;
+}
+
+/**
+ * Add a mailbox private message (takes the ownership)
+ */
+static void
+cmb_add_msg(comet_mailbox_t *cmb, htsmsg_t *m)
+{
+  comet_message_t *cm = comet_message_create(m, 0, NULL);
+  cmb_queue_add(cmb, cm);
+  comet_message_release(cm);
+}
+
 /**
  *
  */
 static void
 cmb_destroy(comet_mailbox_t *cmb)
 {
+  int i;
+
   mbdebug("mailbox[%s]: destroyed\n", cmb->cmb_boxid);
 
-  if(cmb->cmb_messages != NULL)
-    htsmsg_destroy(cmb->cmb_messages);
+  for (i = 0; i < cmb->cmb_count; i++)
+    comet_message_release(cmb->cmb_queue[i]);
+  free(cmb->cmb_queue);
 
   LIST_REMOVE(cmb, cmb_link);
 
@@ -195,9 +311,7 @@ comet_access_update(http_connection_t *hc, comet_mailbox_t *cmb)
   if (admin && config.wizard)
     htsmsg_add_str(m, "wizard", config.wizard);
 
-  if(cmb->cmb_messages == NULL)
-    cmb->cmb_messages = htsmsg_create_list();
-  htsmsg_add_msg(cmb->cmb_messages, NULL, m);
+  cmb_add_msg(cmb, m);
 }
 
 /**
@@ -225,11 +339,108 @@ comet_serverIpPort(http_connection_t *hc, comet_mailbox_t *cmb)
   htsmsg_add_str(m, "ip", buf);
   htsmsg_add_u32(m, "port", ntohs(port));
 
-  if(cmb->cmb_messages == NULL)
-    cmb->cmb_messages = htsmsg_create_list();
-  htsmsg_add_msg(cmb->cmb_messages, NULL, m);
+  cmb_add_msg(cmb, m);
 }
 
+/**
+ * Find the mailbox or create a new one (comet_mutex must be held)
+ */
+static comet_mailbox_t *
+comet_mailbox_get(http_connection_t *hc, const char *cometid)
+{
+  comet_mailbox_t *cmb = NULL;
+
+  if(cometid != NULL)
+    LIST_FOREACH(cmb, &mailboxes, cmb_link)
+      if(!strcmp(cmb->cmb_boxid, cometid))
+        break;
+
+  if(cmb == NULL) {
+    cmb = comet_mailbox_create(hc->hc_access->aa_lang_ui);
+    comet_access_update(hc, cmb);
+    comet_serverIpPort(hc, cmb);
+  }
+  return cmb;
+}
+
+/**
+ *
+ */
+static void
+comet_mailbox_rewrite_str(htsmsg_t *m, const char *key, const char *lang)
+{
+  const char *s = htsmsg_get_str(m, key), *p;
+  if (s) {
+    p = tvh_gettext_lang(lang, s);
+    if (p != s)
+      htsmsg_set_str(m, key, p);
+  }
+}
+
+static void
+comet_mailbox_rewrite_msg(int rewrite, htsmsg_t *m, const char *lang)
+{
+  switch (rewrite) {
+  case NOTIFY_REWRITE_SUBSCRIPTIONS:
+    comet_mailbox_rewrite_str(m, "state", lang);
+    break;
+  }
+}
+
+/**
+ * Return the JSON text for the given UI language (rendered once)
+ */
+static comet_message_text_t *
+comet_message_text(comet_message_t *cm, const char *lang)
+{
+  comet_message_text_t *cmt;
+  htsmsg_t *m;
+
+  if (!cm->cm_rewrite)
+    lang = NULL;
+  for (cmt = cm->cm_texts; cmt; cmt = cmt->cmt_next)
+    if (lang ? (cmt->cmt_lang && !strcmp(cmt->cmt_lang, lang))
+             : cmt->cmt_lang == NULL)
+      return cmt;
+
+  cmt = calloc(1, sizeof(*cmt));
+  if (lang) {
+    m = htsmsg_copy(cm->cm_msg);
+    comet_mailbox_rewrite_msg(cm->cm_rewrite, m, lang);
+    cmt->cmt_json = htsmsg_json_serialize_to_str(m, 0);
+    htsmsg_destroy(m);
+    cmt->cmt_lang = strdup(lang);
+  } else {
+    cmt->cmt_json = htsmsg_json_serialize_to_str(cm->cm_msg, 0);
+  }
+  cmt->cmt_len = strlen(cmt->cmt_json);
+  cmt->cmt_next = cm->cm_texts;
+  cm->cm_texts = cmt;
+  return cmt;
+}
+
+/**
+ * Serialize and drain the pending messages (comet_mutex must be held)
+ */
+static void
+comet_mailbox_output(comet_mailbox_t *cmb, htsbuf_queue_t *hq)
+{
+  comet_message_text_t *cmt;
+  int i;
+
+  htsbuf_append_str(hq, "{\"boxid\":");
+  htsbuf_append_and_escape_jsonstr(hq, cmb->cmb_boxid);
+  htsbuf_append_str(hq, ",\"messages\":[");
+  for (i = 0; i < cmb->cmb_count; i++) {
+    cmt = comet_message_text(cmb->cmb_queue[i], cmb->cmb_lang);
+    if (i)
+      htsbuf_append(hq, ",", 1);
+    htsbuf_append(hq, cmt->cmt_json, cmt->cmt_len);
+    comet_message_release(cmb->cmb_queue[i]);
+  }
+  htsbuf_append_str(hq, "]}");
+  cmb->cmb_count = 0;
+}
 
 /**
  * Poll callback
@@ -242,7 +453,6 @@ comet_mailbox_poll(http_connection_t *hc, const char *remain, void *opaque)
   const char *immediate = http_arg_get(&hc->hc_req_args, "immediate");
   int im = immediate ? atoi(immediate) : 0, e;
   int64_t mono;
-  htsmsg_t *m;
 
   if(!im)
     tvh_safe_usleep(100000); /* Always sleep 0.1 sec to avoid comet storms */
@@ -253,19 +463,10 @@ comet_mailbox_poll(http_connection_t *hc, const char *remain, void *opaque)
     return HTTP_STATUS_BAD_REQUEST;
   }
 
-  if(cometid != NULL)
-    LIST_FOREACH(cmb, &mailboxes, cmb_link)
-      if(!strcmp(cmb->cmb_boxid, cometid))
-	break;
-    
-  if(cmb == NULL) {
-    cmb = comet_mailbox_create(hc->hc_access->aa_lang_ui);
-    comet_access_update(hc, cmb);
-    comet_serverIpPort(hc, cmb);
-  }
+  cmb = comet_mailbox_get(hc, cometid);
   cmb->cmb_last_used = 0; /* Make sure we're not flushed out */
 
-  if(!im && cmb->cmb_messages == NULL) {
+  if(!im && cmb->cmb_count == 0) {
     mono = mclk() + sec2mono(10);
     comet_waiting++;
     do {
@@ -280,17 +481,12 @@ comet_mailbox_poll(http_connection_t *hc, const char *remain, void *opaque)
     }
   }
 
-  m = htsmsg_create_map();
-  htsmsg_add_str(m, "boxid", cmb->cmb_boxid);
-  htsmsg_add_msg(m, "messages", cmb->cmb_messages ?: htsmsg_create_list());
-  cmb->cmb_messages = NULL;
-  
+  comet_mailbox_output(cmb, &hc->hc_reply);
+
   cmb->cmb_last_used = mclk();
 
   pthread_mutex_unlock(&comet_mutex);
 
-  htsmsg_json_serialize(m, &hc->hc_reply, 0);
-  htsmsg_destroy(m);
   http_output_content(hc, "text/x-json; charset=UTF-8");
   return 0;
 }
@@ -314,16 +510,13 @@ comet_mailbox_dbg(http_connection_t *hc, const char *remain, void *opaque)
     if(!strcmp(cmb->cmb_boxid, cometid)) {
       char buf[64];
       cmb->cmb_debug = !cmb->cmb_debug;
- 
-      if(cmb->cmb_messages == NULL)
-	cmb->cmb_messages = htsmsg_create_list();
- 
+
       htsmsg_t *m = htsmsg_create_map();
       htsmsg_add_str(m, "notificationClass", "logmessage");
       snprintf(buf, sizeof(buf), "Loglevel debug: %sabled", 
 	       cmb->cmb_debug ? "en" : "dis");
       htsmsg_add_str(m, "logtxt", buf);
-      htsmsg_add_msg(cmb->cmb_messages, NULL, m);
+      cmb_add_msg(cmb, m);
 
       tvh_cond_signal(&comet_cond, 1);
     }
@@ -334,6 +527,239 @@ comet_mailbox_dbg(http_connection_t *hc, const char *remain, void *opaque)
   return 0;
 }
 
+/**
+ * Send one WebSocket frame (the payload queue is consumed)
+ */
+static int
+comet_ws_send(http_connection_t *hc, int opcode, htsbuf_queue_t *payload)
+{
+  htsbuf_queue_t q;
+  uint8_t hdr[10];
+  size_t len = payload->hq_size;
+  int i, hlen, r;
+
+  hdr[0] = 0x80 | opcode; /* FIN */
+  if (len < 126) {
+    hdr[1] = len;
+    hlen = 2;
+  } else if (len < 65536) {
+    hdr[1] = 126;
+    hdr[2] = len >> 8;
+    hdr[3] = len;
+    hlen = 4;
+  } else {
+    hdr[1] = 127;
+    for (i = 0; i < 8; i++)
+      hdr[2 + i] = (uint64_t)len >> (56 - 8 * i);
+    hlen = 10;
+  }
+  htsbuf_queue_init(&q, 0);
+  htsbuf_append(&q, hdr, hlen);
+  htsbuf_appendq(&q, payload);
+  pthread_mutex_lock(&hc->hc_fd_lock);
+  r = tcp_write_queue(hc->hc_fd, &q);
+  pthread_mutex_unlock(&hc->hc_fd_lock);
+  return r;
+}
+
+/**
+ * Send the close frame with a status code
+ */
+static void
+comet_ws_close(http_connection_t *hc, int code)
+{
+  htsbuf_queue_t q;
+  uint8_t buf[2] = { code >> 8, code & 0xff };
+
+  htsbuf_queue_init(&q, 0);
+  htsbuf_append(&q, buf, sizeof(buf));
+  comet_ws_send(hc, WS_OP_CLOSE, &q);
+}
+
+/**
+ * Handle one frame from the client, returns non-zero to close
+ */
+static int
+comet_ws_input(http_connection_t *hc)
+{
+  htsbuf_queue_t q;
+  uint8_t hdr[8], mask[4], buf[125];
+  uint64_t plen, pos = 0;
+  size_t l, i;
+  int opcode, masked;
+
+  if (tcp_read_timeout(hc->hc_fd, hdr, 2, 5000))
+    return -1;
+  opcode = hdr[0] & 0x0f;
+  masked = (hdr[1] & 0x80) != 0;
+  plen = hdr[1] & 0x7f;
+  if (plen == 126) {
+    if (tcp_read_timeout(hc->hc_fd, hdr, 2, 5000))
+      return -1;
+    plen = (hdr[0] << 8) | hdr[1];
+  } else if (plen == 127) {
+    if (tcp_read_timeout(hc->hc_fd, hdr, 8, 5000))
+      return -1;
+    for (i = 0, plen = 0; i < 8; i++)
+      plen = (plen << 8) | hdr[i];
+  }
+  /* the client frames must be masked (RFC 6455 5.1) */
+  if (!masked) {
+    comet_ws_close(hc, WS_CLOSE_PROTOCOL);
+    return 1;
+  }
+  if (tcp_read_timeout(hc->hc_fd, mask, 4, 5000))
+    return -1;
+  /* control frames cannot be fragmented and carry max 125 bytes */
+  if ((opcode & 0x08) && plen > sizeof(buf)) {
+    comet_ws_close(hc, WS_CLOSE_PROTOCOL);
+    return 1;
+  }
+  if (plen > WS_MAX_PAYLOAD) {
+    comet_ws_close(hc, WS_CLOSE_TOO_BIG);
+    return 1;
+  }
+  /* the data frames are not used by the client, skip them */
+  while (pos < plen) {
+    l = MIN(plen - pos, sizeof(buf));
+    if (tcp_read_timeout(hc->hc_fd, buf, l, 5000))
+      return -1;
+    for (i = 0; i < l; i++)
+      buf[i] ^= mask[(pos + i) & 3];
+    pos += l;
+  }
+
+  switch (opcode) {
+  case WS_OP_CLOSE:
+    htsbuf_queue_init(&q, 0);
+    htsbuf_append(&q, buf, MIN(plen, 2));
+    comet_ws_send(hc, WS_OP_CLOSE, &q);
+    return 1;
+  case WS_OP_PING:
+    htsbuf_queue_init(&q, 0);
+    htsbuf_append(&q, buf, plen);
+    return comet_ws_send(hc, WS_OP_PONG, &q);
+  }
+  return 0;
+}
+
+/**
+ * The browsers send the Origin header with the WebSocket handshake,
+ * allow only the own pages (Host) and the configured CORS origin
+ */
+static int
+comet_ws_origin_verify(http_connection_t *hc)
+{
+  const char *origin = http_arg_get(&hc->hc_args, "Origin");
+  const char *host, *s;
+
+  if (origin == NULL)
+    return 0; /* not a browser */
+  if (config.cors_origin && config.cors_origin[0] &&
+      (!strcmp(config.cors_origin, "*") ||
+       !strcasecmp(config.cors_origin, origin)))
+    return 0;
+  host = http_arg_get(&hc->hc_args, "Host");
+  if (host == NULL || (s = strstr(origin, "://")) == NULL)
+    return -1;
+  return strcasecmp(s + 3, host) ? -1 : 0;
+}
+
+/**
+ * WebSocket callback - the notifications are pushed to the client
+ * as soon as they are queued, one text frame per batch using the same
+ * JSON layout as the poll reply
+ */
+static int
+comet_mailbox_ws(http_connection_t *hc, const char *remain, void *opaque)
+{
+  comet_mailbox_t *cmb;
+  htsbuf_queue_t q;
+  struct pollfd pfd;
+  const char *s, *key;
+  char accept[64];
+  uint8_t sum[20];
+  SHA_CTX sha1;
+  int64_t ping;
+  int r = 0;
+
+  s = http_arg_get(&hc->hc_args, "Upgrade");
+  key = http_arg_get(&hc->hc_args, "Sec-WebSocket-Key");
+  if (hc->hc_version != HTTP_VERSION_1_1 || key == NULL ||
+      s == NULL || strcasecmp(s, "websocket"))
+    return HTTP_STATUS_BAD_REQUEST;
+  s = http_arg_get(&hc->hc_args, "Sec-WebSocket-Version");
+  if (s == NULL || atoi(s) != 13)
+    return HTTP_STATUS_BAD_REQUEST;
+  if (comet_ws_origin_verify(hc)) {
+    tvhwarn("webui", "WebSocket from a foreign origin '%s' rejected",
+            http_arg_get(&hc->hc_args, "Origin"));
+    return HTTP_STATUS_FORBIDDEN;
+  }
+
+  SHA1_Init(&sha1);
+  SHA1_Update(&sha1, key, strlen(key));
+  SHA1_Update(&sha1, WS_GUID, strlen(WS_GUID));
+  SHA1_Final(sum, &sha1);
+  base64_encode(accept, sizeof(accept), sum, sizeof(sum));
+
+  htsbuf_queue_init(&q, 0);
+  htsbuf_qprintf(&q, "HTTP/1.1 101 Switching Protocols\r\n"
+                     "Upgrade: websocket\r\n"
+                     "Connection: Upgrade\r\n"
+                     "Sec-WebSocket-Accept: %s\r\n\r\n", accept);
+  pthread_mutex_lock(&hc->hc_fd_lock);
+  r = tcp_write_queue(hc->hc_fd, &q);
+  pthread_mutex_unlock(&hc->hc_fd_lock);
+  if (r)
+    return -1;
+
+  pthread_mutex_lock(&comet_mutex);
+  if (!atomic_get(&comet_running)) {
+    pthread_mutex_unlock(&comet_mutex);
+    return -1;
+  }
+
+  cmb = comet_mailbox_get(hc, http_arg_get(&hc->hc_req_args, "boxid"));
+  mbdebug("mailbox[%s]: websocket\n", cmb->cmb_boxid);
+  ping = mclk() + sec2mono(MAILBOX_WS_PING_INTERVAL);
+  comet_waiting++;
+  while (atomic_get(&comet_running) && !hc->hc_shutdown) {
+    cmb->cmb_last_used = 0; /* Make sure we're not flushed out */
+    if (cmb->cmb_count) {
+      htsbuf_queue_init(&q, 0);
+      comet_mailbox_output(cmb, &q);
+      pthread_mutex_unlock(&comet_mutex);
+      r = comet_ws_send(hc, WS_OP_TEXT, &q);
+    } else {
+      pfd.fd = hc->hc_fd;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+      if (poll(&pfd, 1, 0) > 0) {
+        pthread_mutex_unlock(&comet_mutex);
+        r = comet_ws_input(hc);
+      } else if (ping <= mclk()) {
+        ping = mclk() + sec2mono(MAILBOX_WS_PING_INTERVAL);
+        pthread_mutex_unlock(&comet_mutex);
+        htsbuf_queue_init(&q, 0);
+        r = comet_ws_send(hc, WS_OP_PING, &q);
+      } else {
+        /* the client frames are checked once per second */
+        tvh_cond_timedwait(&comet_cond, &comet_mutex, mclk() + sec2mono(1));
+        continue;
+      }
+    }
+    pthread_mutex_lock(&comet_mutex);
+    if (r)
+      break;
+  }
+  if (atomic_get(&comet_running))
+    cmb->cmb_last_used = mclk();
+  comet_waiting--;
+  pthread_mutex_unlock(&comet_mutex);
+  return -1;
+}
+
 /**
  *
  */
@@ -347,6 +773,7 @@ comet_init(void)
   pthread_mutex_unlock(&comet_mutex);
   http_path_add("/comet/poll",  NULL, comet_mailbox_poll, ACCESS_WEB_INTERFACE);
   http_path_add("/comet/debug", NULL, comet_mailbox_dbg,  ACCESS_WEB_INTERFACE);
+  http_path_add("/comet/ws",    NULL, comet_mailbox_ws,   ACCESS_WEB_INTERFACE);
 }
 
 void
@@ -374,27 +801,27 @@ comet_done(void)
 }
 
 /**
- *
+ * Coalescing key for the state snapshot notifications - the pending
+ * older snapshot of the same object is replaced with the new one
  */
-static void
-comet_mailbox_rewrite_str(htsmsg_t *m, const char *key, const char *lang)
-{
-  const char *s = htsmsg_get_str(m, key), *p;
-  if (s) {
-    p = tvh_gettext_lang(lang, s);
-    if (p != s)
-      htsmsg_set_str(m, key, p);
-  }
-}
-
-static void
-comet_mailbox_rewrite_msg(int rewrite, htsmsg_t *m, const char *lang)
+static const char *
+comet_message_key(htsmsg_t *m, char *buf, size_t buflen)
 {
-  switch (rewrite) {
-  case NOTIFY_REWRITE_SUBSCRIPTIONS:
-    comet_mailbox_rewrite_str(m, "state", lang);
-    break;
-  }
+  const char *cls, *id;
+  uint32_t u32;
+
+  if (!htsmsg_get_u32_or_default(m, "update", 0) &&
+      !htsmsg_get_u32_or_default(m, "updateEntry", 0))
+    return NULL;
+  if ((cls = htsmsg_get_str(m, "notificationClass")) == NULL)
+    return NULL;
+  if ((id = htsmsg_get_str(m, "uuid")) != NULL)
+    snprintf(buf, buflen, "%s/%s", cls, id);
+  else if (!htsmsg_get_u32(m, "id", &u32))
+    snprintf(buf, buflen, "%s/#%u", cls, u32);
+  else
+    return NULL;
+  return buf;
 }
 
 /**
@@ -404,7 +831,9 @@ void
 comet_mailbox_add_message(htsmsg_t *m, int isdebug, int rewrite)
 {
   comet_mailbox_t *cmb;
-  htsmsg_t *e;
+  comet_message_t *cm = NULL;
+  const char *key;
+  char buf[128];
 
   if (!atomic_get(&comet_running))
     return;
@@ -417,14 +846,16 @@ comet_mailbox_add_message(htsmsg_t *m, int isdebug, int rewrite)
       if(isdebug && !cmb->cmb_debug)
         continue;
 
-      if(cmb->cmb_messages == NULL)
-        cmb->cmb_messages = htsmsg_create_list();
-      e = htsmsg_copy(m);
-      if (cmb->cmb_lang && rewrite)
-        comet_mailbox_rewrite_msg(rewrite, e, cmb->cmb_lang);
-      htsmsg_add_msg(cmb->cmb_messages, NULL, e);
+      if (cm == NULL) {
+        key = isdebug ? NULL : comet_message_key(m, buf, sizeof(buf));
+        cm = comet_message_create(htsmsg_copy(m), rewrite, key);
+      }
+      cmb_queue_add(cmb, cm);
+    }
+    if (cm) {
+      comet_message_release(cm);
+      tvh_cond_signal(&comet_cond, 1);
     }
-    tvh_cond_signal(&comet_cond, 1);
   }
 
   pthread_mutex_unlock(&comet_mutex);
@@ -0,0 +1,780 @@
+/*
+ *  tvheadend, shared HLS live output
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tvheadend.h"
+#include "webui.h"
+#include "channels.h"
+#include "profile.h"
+#include "subscriptions.h"
+#include "streaming.h"
+#include "packet.h"
+#include "muxer.h"
+#include "config.h"
+#include "input/mpegts/dvb.h"
+
+/*
+ * One subscription, profile chain and muxer is run for each
+ * (channel, profile) pair. The muxer output is cut to segments
+ * at the first video keyframe (random access indicator) after the
+ * target duration, the last PAT and PMT are repeated at the start of
+ * each segment. Streams without video are cut at the PAT, streams
+ * without the random access indicator at the first PAT after twice
+ * the target duration (the first segment starts at the first PAT
+ * after the target duration). The completed
+ * segments are kept in a ring (in memory or in unlinked files in
+ * the spill directory) and served to any number of clients:
+ *
+ *   /hls/channel/<uuid>/index.m3u8
+ *   /hls/channel/<uuid>/<sequence>.ts
+ *
+ * The stream is stopped when no client asked for it for a while.
+ */
+
+#define HLS_START_TIMEOUT  15   /* seconds to wait for the first segments */
+#define HLS_IDLE_TIMEOUT   30   /* minimal idle time before the stream stops */
+#define HLS_REAPER_PERIOD  5
+
+typedef struct hls_segment {
+  uint32_t   hsg_seq;
+  int64_t    hsg_duration;
+  size_t     hsg_size;
+  pktbuf_t  *hsg_data;          /* in-memory segment */
+  int        hsg_fd;            /* spilled segment */
+} hls_segment_t;
+
+typedef struct hls_stream {
+  LIST_ENTRY(hls_stream) hs_link;
+  char                  *hs_key;
+  char                  *hs_name;
+  int                    hs_refcnt;
+  int64_t                hs_used;
+
+  profile_chain_t        hs_prch;
+  th_subscription_t     *hs_sub;
+  pthread_t              hs_tid;
+  int                    hs_run;
+
+  /* muxer output, accessed only from the stream thread */
+  sbuf_t                 hs_sbuf;
+  int                    hs_synced;
+  int                    hs_tsoff;
+  int                    hs_pmt_pid;    /* 0 = unknown */
+  int                    hs_video_pid;  /* -1 = unknown, 0 = no video */
+  uint8_t                hs_pat[188];
+  uint8_t                hs_pmt[188];
+  int64_t                hs_seg_start;
+  int64_t                hs_target;
+  char                  *hs_spill;
+
+  /* completed segments */
+  pthread_mutex_t        hs_lock;
+  tvh_cond_t             hs_cond;
+  hls_segment_t         *hs_segs;
+  int                    hs_segs_max;
+  int                    hs_segs_first;
+  int                    hs_segs_count;
+  uint32_t               hs_seq;
+  int                    hs_error;
+} hls_stream_t;
+
+static LIST_HEAD(, hls_stream) hls_streams;
+static mtimer_t hls_reaper_timer;
+
+/*
+ *
+ */
+static void
+hls_segment_free(hls_segment_t *seg)
+{
+  if (seg->hsg_data)
+    pktbuf_ref_dec(seg->hsg_data);
+  if (seg->hsg_fd >= 0)
+    close(seg->hsg_fd);
+  seg->hsg_data = NULL;
+  seg->hsg_fd = -1;
+}
+
+static int
+hls_segment_spill(hls_stream_t *hs, const void *data, size_t size)
+{
+  char path[PATH_MAX];
+  int fd;
+
+  snprintf(path, sizeof(path), "%s/tvh-hls-XXXXXX", hs->hs_spill);
+  fd = mkstemp(path);
+  if (fd < 0) {
+    tvherror("hls", "%s: unable to create spill file in '%s' -- %s",
+             hs->hs_name, hs->hs_spill, strerror(errno));
+    return -1;
+  }
+  unlink(path);
+  if (tvh_write(fd, data, size)) {
+    tvherror("hls", "%s: unable to write spill file -- %s",
+             hs->hs_name, strerror(errno));
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/*
+ * Move the collected muxer output to the segment ring
+ */
+static void
+hls_segment_finish(hls_stream_t *hs)
+{
+  hls_segment_t seg;
+  sbuf_t *sb = &hs->hs_sbuf;
+  int i;
+
+  if (sb->sb_ptr == 0)
+    return;
+  seg.hsg_duration = mclk() - hs->hs_seg_start;
+  seg.hsg_size = sb->sb_ptr;
+  seg.hsg_data = NULL;
+  seg.hsg_fd = -1;
+  if (hs->hs_spill)
+    seg.hsg_fd = hls_segment_spill(hs, sb->sb_data, sb->sb_ptr);
+  if (seg.hsg_fd >= 0) {
+    sbuf_reset(sb, seg.hsg_size * 2);
+  } else {
+    seg.hsg_data = pktbuf_make(sb->sb_data, sb->sb_ptr);
+    if (seg.hsg_data == NULL) {
+      sbuf_reset(sb, seg.hsg_size * 2);
+      return;
+    }
+    sbuf_steal_data(sb);
+  }
+
+  pthread_mutex_lock(&hs->hs_lock);
+  if (hs->hs_segs_count == hs->hs_segs_max) {
+    hls_segment_free(&hs->hs_segs[hs->hs_segs_first]);
+    hs->hs_segs_first = (hs->hs_segs_first + 1) % hs->hs_segs_max;
+    hs->hs_segs_count--;
+  }
+  i = (hs->hs_segs_first + hs->hs_segs_count) % hs->hs_segs_max;
+  seg.hsg_seq = hs->hs_seq++;
+  hs->hs_segs[i] = seg;
+  hs->hs_segs_count++;
+  tvh_cond_signal(&hs->hs_cond, 1);
+  pthread_mutex_unlock(&hs->hs_lock);
+}
+
+/*
+ *
+ */
+static int
+hls_video_stream_type(int type)
+{
+  switch (type) {
+  case 0x01: /* MPEG-1 video */
+  case 0x02: /* MPEG-2 video */
+  case 0x10: /* MPEG-4 part 2 */
+  case 0x1b: /* H.264 */
+  case 0x24: /* HEVC */
+  case 0x42: /* AVS */
+  case 0xea: /* VC-1 */
+    return 1;
+  }
+  return 0;
+}
+
+/*
+ * Remember the last PAT and PMT packets and the video PID (one packet
+ * sections only, as produced by the muxers)
+ */
+static void
+hls_sink_psi(hls_stream_t *hs, const uint8_t *p, int pid)
+{
+  const uint8_t *d = p + 4, *end = p + 188;
+  int len, plen, vpid;
+
+  if (p[3] & 0x20)
+    d += 1 + d[0];
+  if (d >= end || !(p[3] & 0x10))
+    return;
+  d += 1 + d[0];
+  if (d + 3 > end)
+    return;
+  len = ((d[1] & 0x0f) << 8) | d[2];
+  if (len < 9 || d + 3 + len > end)
+    return;
+  end = d + 3 + len - 4; /* CRC */
+
+  if (pid == DVB_PAT_PID) {
+    if (d[0] != DVB_PAT_BASE)
+      return;
+    for (d += 8; d + 4 <= end; d += 4) {
+      if ((d[0] | d[1]) == 0) /* NIT */
+        continue;
+      pid = ((d[2] & 0x1f) << 8) | d[3];
+      if (pid != hs->hs_pmt_pid) {
+        hs->hs_pmt_pid = pid;
+        hs->hs_video_pid = -1;
+      }
+      memcpy(hs->hs_pat, p, 188);
+      break;
+    }
+  } else {
+    if (d[0] != DVB_PMT_BASE || len < 13)
+      return;
+    plen = ((d[10] & 0x0f) << 8) | d[11];
+    vpid = 0;
+    for (d += 12 + plen; d + 5 <= end; d += 5 + (((d[3] & 0x0f) << 8) | d[4]))
+      if (hls_video_stream_type(d[0])) {
+        vpid = ((d[1] & 0x1f) << 8) | d[2];
+        break;
+      }
+    hs->hs_video_pid = vpid;
+    memcpy(hs->hs_pmt, p, 188);
+  }
+}
+
+/*
+ * Muxer output callback, the data are MPEG-TS packets but the chunks
+ * may not be aligned to the packet boundaries (libav muxer)
+ */
+static void
+hls_sink(void *opaque, const void *data, size_t size)
+{
+  hls_stream_t *hs = opaque;
+  const uint8_t *p, *s = data, *end = s + size;
+  int pid, cut;
+
+  for (p = s + (188 - hs->hs_tsoff) % 188; p + 6 <= end; p += 188) {
+    /* payload unit start indicator */
+    if (p[0] != 0x47 || (p[1] & 0x40) == 0)
+      continue;
+    pid = ((p[1] & 0x1f) << 8) | p[2];
+    if ((pid == DVB_PAT_PID || pid == hs->hs_pmt_pid) && p + 188 <= end)
+      hls_sink_psi(hs, p, pid);
+    if (hs->hs_video_pid > 0) {
+      /* video packet with the random access indicator */
+      cut = pid == hs->hs_video_pid && (p[3] & 0x20) &&
+            p[4] > 0 && (p[5] & 0x40);
+      /* many streams never set the indicator, fall back to the PAT */
+      if (!cut && pid == DVB_PAT_PID &&
+          mclk() - hs->hs_seg_start >= (hs->hs_synced ? 2 : 1) * hs->hs_target)
+        cut = 1;
+    } else {
+      cut = hs->hs_video_pid == 0 && pid == DVB_PAT_PID;
+    }
+    if (!cut || (hs->hs_synced && mclk() - hs->hs_seg_start < hs->hs_target))
+      continue;
+    if (hs->hs_synced) {
+      sbuf_append(&hs->hs_sbuf, s, p - s);
+      hls_segment_finish(hs);
+    }
+    hs->hs_synced = 1;
+    hs->hs_seg_start = mclk();
+    if (pid != DVB_PAT_PID) {
+      /* each segment must be decodable alone */
+      sbuf_append(&hs->hs_sbuf, hs->hs_pat, 188);
+      sbuf_append(&hs->hs_sbuf, hs->hs_pmt, 188);
+    }
+    s = p;
+  }
+  if (hs->hs_synced)
+    sbuf_append(&hs->hs_sbuf, s, end - s);
+  hs->hs_tsoff = (hs->hs_tsoff + size) % 188;
+}
+
+/*
+ * Stream loop
+ */
+static void *
+hls_stream_thread(void *aux)
+{
+  hls_stream_t *hs = aux;
+  streaming_queue_t *sq = &hs->hs_prch.prch_sq;
+  muxer_t *mux = hs->hs_prch.prch_muxer;
+  streaming_message_t *sm;
+  streaming_start_t *ss_copy;
+  int run = 1, started = 0;
+
+  while (run) {
+    pthread_mutex_lock(&sq->sq_mutex);
+    if (!hs->hs_run) {
+      pthread_mutex_unlock(&sq->sq_mutex);
+      break;
+    }
+    sm = TAILQ_FIRST(&sq->sq_queue);
+    if (sm == NULL) {
+      tvh_cond_timedwait(&sq->sq_cond, &sq->sq_mutex, mclk() + sec2mono(1));
+      pthread_mutex_unlock(&sq->sq_mutex);
+      continue;
+    }
+    streaming_queue_remove(sq, sm);
+    pthread_mutex_unlock(&sq->sq_mutex);
+
+    switch (sm->sm_type) {
+    case SMT_MPEGTS:
+    case SMT_PACKET:
+      if (started) {
+        muxer_write_pkt(mux, sm->sm_type, sm->sm_data);
+        sm->sm_data = NULL;
+      }
+      break;
+
+    case SMT_START:
+      if (!started) {
+        tvhdebug("hls", "%s: start", hs->hs_name);
+        ss_copy = streaming_start_copy((streaming_start_t *)sm->sm_data);
+        if (muxer_init(mux, ss_copy, hs->hs_name) < 0)
+          run = 0;
+        streaming_start_unref(ss_copy);
+        hs->hs_seg_start = mclk(); /* for the PAT fallback */
+        started = 1;
+      } else if (muxer_reconfigure(mux, sm->sm_data) < 0) {
+        tvhwarn("hls", "%s: unable to reconfigure stream", hs->hs_name);
+      }
+      break;
+
+    case SMT_STOP:
+      if (sm->sm_code != SM_CODE_SOURCE_RECONFIGURED) {
+        tvhwarn("hls", "%s: stop, %s", hs->hs_name,
+                streaming_code2txt(sm->sm_code));
+        run = 0;
+      }
+      break;
+
+    case SMT_NOSTART:
+      tvhwarn("hls", "%s: couldn't start, %s", hs->hs_name,
+              streaming_code2txt(sm->sm_code));
+      run = 0;
+      break;
+
+    case SMT_EXIT:
+      run = 0;
+      break;
+
+    default:
+      break;
+    }
+
+    streaming_msg_free(sm);
+
+    if (mux->m_errors) {
+      tvhwarn("hls", "%s: muxer reported errors", hs->hs_name);
+      run = 0;
+    }
+  }
+
+  if (started)
+    muxer_close(mux);
+
+  pthread_mutex_lock(&hs->hs_lock);
+  hs->hs_error = 1;
+  tvh_cond_signal(&hs->hs_cond, 1);
+  pthread_mutex_unlock(&hs->hs_lock);
+  return NULL;
+}
+
+/*
+ * Stream lifetime, called with global_lock held
+ */
+static void
+hls_stream_destroy(hls_stream_t *hs)
+{
+  streaming_queue_t *sq = &hs->hs_prch.prch_sq;
+  int i;
+
+  tvhdebug("hls", "%s: destroy", hs->hs_name);
+  LIST_REMOVE(hs, hs_link);
+  if (hs->hs_tid) {
+    pthread_mutex_lock(&sq->sq_mutex);
+    hs->hs_run = 0;
+    tvh_cond_signal(&sq->sq_cond, 0);
+    pthread_mutex_unlock(&sq->sq_mutex);
+    pthread_join(hs->hs_tid, NULL);
+  }
+  if (hs->hs_sub)
+    subscription_unsubscribe(hs->hs_sub, UNSUBSCRIBE_FINAL);
+  profile_chain_close(&hs->hs_prch);
+  for (i = 0; i < hs->hs_segs_count; i++)
+    hls_segment_free(&hs->hs_segs[(hs->hs_segs_first + i) % hs->hs_segs_max]);
+  free(hs->hs_segs);
+  sbuf_free(&hs->hs_sbuf);
+  tvh_cond_destroy(&hs->hs_cond);
+  pthread_mutex_destroy(&hs->hs_lock);
+  free(hs->hs_spill);
+  free(hs->hs_name);
+  free(hs->hs_key);
+  free(hs);
+}
+
+static void
+hls_reaper(void *aux)
+{
+  hls_stream_t *hs, *hs_next;
+  int64_t idle;
+
+  for (hs = LIST_FIRST(&hls_streams); hs; hs = hs_next) {
+    hs_next = LIST_NEXT(hs, hs_link);
+    if (atomic_get(&hs->hs_refcnt))
+      continue;
+    idle = MAX(sec2mono(HLS_IDLE_TIMEOUT), 3 * hs->hs_target);
+    if (hs->hs_error || mclk() - hs->hs_used > idle)
+      hls_stream_destroy(hs);
+  }
+  if (LIST_FIRST(&hls_streams))
+    mtimer_arm_rel(&hls_reaper_timer, hls_reaper, NULL,
+                   sec2mono(HLS_REAPER_PERIOD));
+}
+
+static hls_stream_t *
+hls_stream_create(http_connection_t *hc, channel_t *ch, profile_t *pro,
+                  const char *key)
+{
+  hls_stream_t *hs = calloc(1, sizeof(*hs));
+  muxer_t *mux;
+
+  hs->hs_key = strdup(key);
+  hs->hs_name = strdup(channel_get_name(ch));
+  hs->hs_used = mclk();
+  hs->hs_video_pid = -1;
+  hs->hs_target = sec2mono(MINMAX(config.hls_segment_duration, 1, 30));
+  hs->hs_segs_max = MINMAX(config.hls_segments, 3, 30);
+  hs->hs_segs = calloc(hs->hs_segs_max, sizeof(hls_segment_t));
+  if (config.hls_spill_path && config.hls_spill_path[0])
+    hs->hs_spill = strdup(config.hls_spill_path);
+  sbuf_init(&hs->hs_sbuf);
+  pthread_mutex_init(&hs->hs_lock, NULL);
+  tvh_cond_init(&hs->hs_cond);
+  LIST_INSERT_HEAD(&hls_streams, hs, hs_link);
+
+  profile_chain_init(&hs->hs_prch, pro, ch);
+  if (profile_chain_open(&hs->hs_prch, NULL, 0, 1500000))
+    goto fail;
+
+  mux = hs->hs_prch.prch_muxer;
+  if (mux == NULL ||
+      (mux->m_config.m_type != MC_PASS && mux->m_config.m_type != MC_MPEGTS) ||
+      muxer_open_sink(mux, hls_sink, hs)) {
+    tvhwarn("hls", "%s: profile '%s' does not produce MPEG-TS output",
+            hs->hs_name, profile_get_name(pro));
+    goto fail;
+  }
+
+  hs->hs_sub = subscription_create_from_channel(&hs->hs_prch,
+                 NULL, 0, "HLS",
+                 hs->hs_prch.prch_flags | SUBSCRIPTION_STREAMING,
+                 hc->hc_peer_ipstr, hc->hc_username,
+                 http_arg_get(&hc->hc_args, "User-Agent"),
+                 NULL);
+  if (hs->hs_sub == NULL)
+    goto fail;
+
+  hs->hs_run = 1;
+  tvhthread_create(&hs->hs_tid, NULL, hls_stream_thread, hs, "hls");
+
+  tvhdebug("hls", "%s: create (profile %s)", hs->hs_name, profile_get_name(pro));
+  mtimer_arm_rel(&hls_reaper_timer, hls_reaper, NULL,
+                 sec2mono(HLS_REAPER_PERIOD));
+  return hs;
+
+fail:
+  hls_stream_destroy(hs);
+  return NULL;
+}
+
+static hls_stream_t *
+hls_stream_find(const char *key)
+{
+  hls_stream_t *hs;
+
+  LIST_FOREACH(hs, &hls_streams, hs_link)
+    if (!strcmp(hs->hs_key, key))
+      return hs;
+  return NULL;
+}
+
+/*
+ * Replies, called without global_lock
+ */
+static int
+hls_wait(hls_stream_t *hs, int (*cond)(hls_stream_t *, uint32_t),
+         uint32_t seq, int64_t timeout)
+{
+  int64_t mono = mclk() + timeout;
+
+  while (!hs->hs_error && !cond(hs, seq) && mclk() < mono &&
+         tvheadend_is_running())
+    tvh_cond_timedwait(&hs->hs_cond, &hs->hs_lock, MIN(mono, mclk() + sec2mono(1)));
+  return cond(hs, seq);
+}
+
+static int
+hls_playlist_ready(hls_stream_t *hs, uint32_t seq)
+{
+  return hs->hs_segs_count >= 2;
+}
+
+static int
+hls_segment_ready(hls_stream_t *hs, uint32_t seq)
+{
+  return (int32_t)(hs->hs_seq - seq) > 0;
+}
+
+static int
+hls_send_playlist(http_connection_t *hc, hls_stream_t *hs)
+{
+  htsbuf_queue_t hq;
+  hls_segment_t *seg;
+  const char *profile, *url;
+  char *data, path[512], *name;
+  uint32_t *seqs;
+  int64_t *durs, maxdur = 0;
+  size_t len;
+  int i, count;
+
+  profile = http_arg_get(&hc->hc_req_args, "profile");
+
+  pthread_mutex_lock(&hs->hs_lock);
+  if (!hls_wait(hs, hls_playlist_ready, 0,
+                sec2mono(HLS_START_TIMEOUT) + 2 * hs->hs_target)) {
+    pthread_mutex_unlock(&hs->hs_lock);
+    return HTTP_STATUS_SERVICE;
+  }
+  count = hs->hs_segs_count;
+  seqs = alloca(count * sizeof(*seqs));
+  durs = alloca(count * sizeof(*durs));
+  for (i = 0; i < count; i++) {
+    seg = &hs->hs_segs[(hs->hs_segs_first + i) % hs->hs_segs_max];
+    seqs[i] = seg->hsg_seq;
+    durs[i] = seg->hsg_duration;
+    maxdur = MAX(maxdur, seg->hsg_duration);
+  }
+  pthread_mutex_unlock(&hs->hs_lock);
+
+  /* the segment tickets are bound to the path without the webroot */
+  url = hc->hc_url_orig;
+  if (tvheadend_webroot &&
+      !strncmp(url, tvheadend_webroot, strlen(tvheadend_webroot)))
+    url += strlen(tvheadend_webroot);
+  snprintf(path, sizeof(path), "%s", url);
+  if ((name = strchr(path, '?')) != NULL)
+    *name = '\0';
+  if ((name = strrchr(path, '/')) == NULL)
+    return HTTP_STATUS_BAD_REQUEST;
+  name++;
+
+  htsbuf_queue_init(&hq, 0);
+  htsbuf_qprintf(&hq, "#EXTM3U\n"
+                      "#EXT-X-VERSION:3\n"
+                      "#EXT-X-TARGETDURATION:%d\n"
+                      "#EXT-X-MEDIA-SEQUENCE:%u\n",
+                 (int)((maxdur + MONOCLOCK_RESOLUTION - 1) / MONOCLOCK_RESOLUTION),
+                 seqs[0]);
+  pthread_mutex_lock(&global_lock);
+  for (i = 0; i < count; i++) {
+    snprintf(name, sizeof(path) - (name - path), "%u.ts", seqs[i]);
+    htsbuf_qprintf(&hq, "#EXTINF:%.3f,\n%s",
+                   (double)durs[i] / MONOCLOCK_RESOLUTION, name);
+    if (profile) {
+      htsbuf_append_str(&hq, "?profile=");
+      htsbuf_append_and_escape_url(&hq, profile);
+    }
+    /* like page_play, the clients may not pass the credentials */
+    htsbuf_qprintf(&hq, "%sticket=%s\n", profile ? "&" : "?",
+                   access_ticket_create(path, hc->hc_access));
+  }
+  pthread_mutex_unlock(&global_lock);
+
+  data = htsbuf_to_string(&hq);
+  htsbuf_queue_flush(&hq);
+  len = strlen(data);
+
+  pthread_mutex_lock(&hc->hc_fd_lock);
+  http_send_header(hc, HTTP_STATUS_OK, "application/vnd.apple.mpegurl",
+                   len, NULL, NULL, 0, NULL, NULL, NULL);
+  if (!hc->hc_no_output)
+    tvh_write(hc->hc_fd, data, len);
+  pthread_mutex_unlock(&hc->hc_fd_lock);
+  free(data);
+  return 0;
+}
+
+static int
+hls_send_segment(http_connection_t *hc, hls_stream_t *hs, uint32_t seq)
+{
+  hls_segment_t *seg = NULL;
+  pktbuf_t *pb = NULL;
+  int i, fd = -1, r = 0;
+  size_t size = 0;
+
+  pthread_mutex_lock(&hs->hs_lock);
+  /* the next segment is requested by the clients ahead of the playlist */
+  if (seq == hs->hs_seq)
+    hls_wait(hs, hls_segment_ready, seq, 2 * hs->hs_target);
+  for (i = 0; i < hs->hs_segs_count; i++) {
+    seg = &hs->hs_segs[(hs->hs_segs_first + i) % hs->hs_segs_max];
+    if (seg->hsg_seq == seq)
+      break;
+  }
+  if (i < hs->hs_segs_count) {
+    size = seg->hsg_size;
+    if (seg->hsg_data)
+      pb = pktbuf_ref_inc(seg->hsg_data);
+    else
+      fd = dup(seg->hsg_fd);
+  }
+  pthread_mutex_unlock(&hs->hs_lock);
+
+  if (pb == NULL && fd < 0)
+    return HTTP_STATUS_NOT_FOUND;
+
+  pthread_mutex_lock(&hc->hc_fd_lock);
+  http_send_header(hc, HTTP_STATUS_OK, "video/mp2t", size, NULL, NULL,
+                   hs->hs_segs_max * (hs->hs_target / MONOCLOCK_RESOLUTION),
+                   NULL, NULL, NULL);
+  if (!hc->hc_no_output) {
+    if (pb)
+      r = tvh_write(hc->hc_fd, pktbuf_ptr(pb), size) ? -1 : 0;
+    else
+      r = page_cache_sendfile(hc, fd, size);
+    if (r == 0)
+      subscription_add_bytes_out(hs->hs_sub, size);
+  }
+  pthread_mutex_unlock(&hc->hc_fd_lock);
+
+  if (pb)
+    pktbuf_ref_dec(pb);
+  if (fd >= 0)
+    close(fd);
+  return r;
+}
+
+/**
+ * Handle the http request. http://tvheadend/hls/channel/<uuid>/index.m3u8
+ *                          http://tvheadend/hls/channelid/<chid>/index.m3u8
+ *                          http://tvheadend/hls/channelnumber/<channelnumber>/index.m3u8
+ *                          http://tvheadend/hls/channelname/<channelname>/index.m3u8
+ */
+static int
+page_hls(http_connection_t *hc, const char *remain, void *opaque)
+{
+  char *components[3], key[UUID_HEX_SIZE * 2 + 1], *end;
+  char ubuf1[UUID_HEX_SIZE], ubuf2[UUID_HEX_SIZE];
+  channel_t *ch = NULL;
+  profile_t *pro;
+  hls_stream_t *hs;
+  uint32_t seq = 0;
+  int playlist, r;
+
+  if (remain == NULL)
+    return HTTP_STATUS_BAD_REQUEST;
+
+  if (http_tokenize((char *)remain, components, 3, '/') != 3)
+    return HTTP_STATUS_BAD_REQUEST;
+
+  http_deescape(components[1]);
+
+  playlist = !strcmp(components[2], "index.m3u8");
+  if (!playlist) {
+    seq = strtoul(components[2], &end, 10);
+    if (end == components[2] || strcmp(end, ".ts"))
+      return HTTP_STATUS_BAD_REQUEST;
+  }
+
+  pthread_mutex_lock(&global_lock);
+
+  if (!strcmp(components[0], "channelid")) {
+    ch = channel_find_by_id(atoi(components[1]));
+  } else if (!strcmp(components[0], "channelnumber")) {
+    ch = channel_find_by_number(components[1]);
+  } else if (!strcmp(components[0], "channelname")) {
+    ch = channel_find_by_name(components[1]);
+  } else if (!strcmp(components[0], "channel")) {
+    ch = channel_find(components[1]);
+  }
+
+  if (ch == NULL) {
+    r = HTTP_STATUS_NOT_FOUND;
+    goto unlock;
+  }
+
+  if (http_access_verify_channel(hc, ACCESS_STREAMING, ch)) {
+    r = HTTP_STATUS_UNAUTHORIZED;
+    goto unlock;
+  }
+
+  if (!(pro = profile_find_by_list(hc->hc_access->aa_profiles,
+                                   http_arg_get(&hc->hc_req_args, "profile"),
+                                   "channel",
+                                   SUBSCRIPTION_PACKET | SUBSCRIPTION_MPEGTS))) {
+    r = HTTP_STATUS_NOT_ALLOWED;
+    goto unlock;
+  }
+
+  snprintf(key, sizeof(key), "%s/%s", idnode_uuid_as_str(&ch->ch_id, ubuf1),
+           idnode_uuid_as_str(&pro->pro_id, ubuf2));
+
+  hs = hls_stream_find(key);
+  if (hs && hs->hs_error && !atomic_get(&hs->hs_refcnt)) {
+    hls_stream_destroy(hs);
+    hs = NULL;
+  }
+  if (hs == NULL) {
+    if (!playlist) {
+      r = HTTP_STATUS_NOT_FOUND;
+      goto unlock;
+    }
+    hs = hls_stream_create(hc, ch, pro, key);
+    if (hs == NULL) {
+      r = HTTP_STATUS_SERVICE;
+      goto unlock;
+    }
+  }
+  hs->hs_used = mclk();
+  atomic_add(&hs->hs_refcnt, 1);
+  pthread_mutex_unlock(&global_lock);
+
+  if (playlist)
+    r = hls_send_playlist(hc, hs);
+  else
+    r = hls_send_segment(hc, hs, seq);
+
+  pthread_mutex_lock(&global_lock);
+  hs->hs_used = mclk();
+  atomic_dec(&hs->hs_refcnt, 1);
+unlock:
+  pthread_mutex_unlock(&global_lock);
+  return r;
+}
+
+/*
+ *
+ */
+void
+hls_init(void)
+{
+  http_path_add("/hls", NULL, page_hls, ACCESS_ANONYMOUS);
+}
+
+void
+hls_done(void)
+{
+  hls_stream_t *hs;
+
+  pthread_mutex_lock(&global_lock);
+  mtimer_disarm(&hls_reaper_timer);
+  while ((hs = LIST_FIRST(&hls_streams)) != NULL)
+    hls_stream_destroy(hs);
+  pthread_mutex_unlock(&global_lock);
+}
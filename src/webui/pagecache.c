@@ -0,0 +1,435 @@
+/*
+ *  tvheadend, cache for the rendered XMLTV / playlist exports
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sys/mman.h>
+
+#include "tvheadend.h"
+#include "webui.h"
+#include "access.h"
+
+#if defined(PLATFORM_LINUX)
+#include <sys/sendfile.h>
+#elif defined(PLATFORM_FREEBSD)
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
+/*
+ * The exports are rendered into unlinked temporary files and sent using
+ * sendfile(), a gzipped copy is created on the first request accepting it.
+ * All entries are dropped when a channel, tag or configuration change
+ * is notified, EPG changes drop only the entries which contain the EPG
+ * data (XMLTV).
+ */
+
+#define PAGE_CACHE_MAX 32
+
+typedef struct page_cache_entry {
+  LIST_ENTRY(page_cache_entry) pce_link;
+  char    *pce_key;
+  int      pce_refcnt;
+  int      pce_linked;
+  int      pce_gen;
+  int      pce_epg_gen;
+  int      pce_epg;
+  int64_t  pce_expire;
+  int64_t  pce_used;
+  char     pce_etag[32];
+  int      pce_fd;
+  size_t   pce_size;
+  pthread_mutex_t pce_gzlock;
+  int      pce_gzfd;
+  size_t   pce_gzsize;
+} page_cache_entry_t;
+
+static pthread_mutex_t page_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static LIST_HEAD(, page_cache_entry) page_cache_entries;
+static int page_cache_count;
+static int page_cache_gen;
+static int page_cache_epg_gen;
+
+/*
+ *
+ */
+static int
+page_cache_tmpfile(void)
+{
+  char path[PATH_MAX];
+  const char *tmpdir = getenv("TMPDIR");
+  int fd;
+
+  snprintf(path, sizeof(path), "%s/tvh-pagecache-XXXXXX", tmpdir ?: "/tmp");
+  fd = mkstemp(path);
+  if (fd >= 0)
+    unlink(path);
+  return fd;
+}
+
+static void
+page_cache_unref(page_cache_entry_t *pce)
+{
+  if (--pce->pce_refcnt > 0)
+    return;
+  assert(!pce->pce_linked);
+  if (pce->pce_fd >= 0)
+    close(pce->pce_fd);
+  if (pce->pce_gzfd >= 0)
+    close(pce->pce_gzfd);
+  pthread_mutex_destroy(&pce->pce_gzlock);
+  free(pce->pce_key);
+  free(pce);
+}
+
+static void
+page_cache_unlink(page_cache_entry_t *pce)
+{
+  if (!pce->pce_linked)
+    return;
+  LIST_REMOVE(pce, pce_link);
+  pce->pce_linked = 0;
+  page_cache_count--;
+  page_cache_unref(pce);
+}
+
+static int
+page_cache_valid(page_cache_entry_t *pce)
+{
+  return pce->pce_gen == atomic_get(&page_cache_gen) &&
+         (!pce->pce_epg || pce->pce_epg_gen == atomic_get(&page_cache_epg_gen)) &&
+         pce->pce_expire > mclk();
+}
+
+/*
+ * Send the body, the file offset is not shared between the connections
+ */
+int
+page_cache_sendfile(http_connection_t *hc, int fd, size_t size)
+{
+  off_t off = 0;
+  ssize_t r;
+  size_t chunk;
+
+  while (size > 0) {
+    chunk = MIN(size, 1024 * 1024);
+#if defined(PLATFORM_LINUX)
+    r = sendfile(hc->hc_fd, fd, &off, chunk);
+#elif defined(PLATFORM_FREEBSD)
+    off_t sbytes = 0;
+    r = sendfile(fd, hc->hc_fd, off, chunk, NULL, &sbytes, 0);
+    if (r == 0 || sbytes > 0)
+      r = sbytes;
+#elif defined(PLATFORM_DARWIN)
+    off_t len = chunk;
+    r = sendfile(fd, hc->hc_fd, off, &len, NULL, 0);
+    if (r == 0 || len > 0)
+      r = len;
+#else
+    uint8_t buf[65536];
+    r = pread(fd, buf, MIN(chunk, sizeof(buf)), off);
+    if (r > 0 && tvh_write(hc->hc_fd, buf, r))
+      r = -1;
+#endif
+    if (r < 0 && errno == EINTR)
+      continue;
+    if (r <= 0)
+      return -1;
+#if !defined(PLATFORM_LINUX)
+    off += r;
+#endif
+    size -= r;
+  }
+  return 0;
+}
+
+/*
+ *
+ */
+#if ENABLE_ZLIB
+/*
+ * Called with pce_gzlock held, so one entry is compressed only once
+ */
+static void
+page_cache_gzip(page_cache_entry_t *pce)
+{
+  uint8_t *data;
+  size_t size = 0;
+  int fd;
+
+  if (pce->pce_size <= 256)
+    return;
+  fd = page_cache_tmpfile();
+  if (fd < 0)
+    return;
+  data = mmap(NULL, pce->pce_size, PROT_READ, MAP_SHARED, pce->pce_fd, 0);
+  if (data == MAP_FAILED) {
+    close(fd);
+    return;
+  }
+  if (tvh_gzip_deflate_fd(fd, data, pce->pce_size, &size, 3) < 0 || size == 0) {
+    close(fd);
+    fd = -1;
+  }
+  munmap(data, pce->pce_size);
+
+  if (fd >= 0) {
+    pce->pce_gzfd = fd;
+    pce->pce_gzsize = size;
+  }
+}
+#endif
+
+static int
+page_cache_send(http_connection_t *hc, page_cache_entry_t *pce,
+                const char *content)
+{
+  http_arg_list_t args;
+  const char *match, *encoding = NULL;
+  int r = 0, fd = pce->pce_fd;
+  size_t size = pce->pce_size;
+
+  http_arg_init(&args);
+  http_arg_set(&args, "ETag", pce->pce_etag);
+
+  match = http_arg_get(&hc->hc_args, "If-None-Match");
+  if (match && (strstr(match, pce->pce_etag) || !strcmp(match, "*"))) {
+    pthread_mutex_lock(&hc->hc_fd_lock);
+    http_send_header(hc, HTTP_STATUS_NOT_MODIFIED, NULL, 0,
+                     NULL, NULL, 0, NULL, NULL, &args);
+    pthread_mutex_unlock(&hc->hc_fd_lock);
+    http_arg_flush(&args);
+    return 0;
+  }
+
+#if ENABLE_ZLIB
+  if (http_encoding_valid(hc, "gzip")) {
+    pthread_mutex_lock(&pce->pce_gzlock);
+    if (pce->pce_gzfd < 0)
+      page_cache_gzip(pce);
+    if (pce->pce_gzfd >= 0) {
+      fd = pce->pce_gzfd;
+      size = pce->pce_gzsize;
+      encoding = "gzip";
+    }
+    pthread_mutex_unlock(&pce->pce_gzlock);
+  }
+#endif
+
+  pthread_mutex_lock(&hc->hc_fd_lock);
+  http_send_header(hc, HTTP_STATUS_OK, content, size ?: INT64_MIN,
+                   encoding, NULL, 0, NULL, NULL, &args);
+  if (!hc->hc_no_output)
+    r = page_cache_sendfile(hc, fd, size);
+  pthread_mutex_unlock(&hc->hc_fd_lock);
+  http_arg_flush(&args);
+  return r;
+}
+
+/*
+ * Build the lookup key: URL, host path, request arguments and everything
+ * from the access entry which changes the output. The user identity is
+ * included when the output carries tickets.
+ */
+static char *
+page_cache_key(http_connection_t *hc, int tickets)
+{
+  access_t *a = hc->hc_access;
+  htsbuf_queue_t q;
+  http_arg_t *ra;
+  htsmsg_field_t *f;
+  char *hostpath, *key;
+  int i;
+
+  htsbuf_queue_init(&q, 0);
+  hostpath = http_get_hostpath(hc);
+  htsbuf_qprintf(&q, "%s\n%s\n", hc->hc_url, hostpath);
+  free(hostpath);
+  TAILQ_FOREACH(ra, &hc->hc_req_args, link) {
+    if (!strcmp(ra->key, "ticket") || !strcmp(ra->key, "auth"))
+      continue;
+    htsbuf_qprintf(&q, "%s=%s\n", ra->key, ra->val ?: "");
+  }
+  htsbuf_qprintf(&q, "%08x\n", a->aa_rights);
+  for (i = 0; i < a->aa_chrange_count; i++)
+    htsbuf_qprintf(&q, "%"PRIu64",", a->aa_chrange[i]);
+  if (a->aa_chtags)
+    HTSMSG_FOREACH(f, a->aa_chtags)
+      htsbuf_qprintf(&q, "%s,", htsmsg_field_get_str(f) ?: "");
+  if (tickets)
+    htsbuf_qprintf(&q, "\n%s\n%s", a->aa_username ?: "",
+                   a->aa_representative ?: "");
+  key = htsbuf_to_string(&q);
+  htsbuf_queue_flush(&q);
+  return key;
+}
+
+/*
+ * Serve the request from the cache, returns zero when served
+ */
+int
+page_cache_begin(http_connection_t *hc, page_cache_req_t *pcr,
+                 const char *content, int tickets, int epg)
+{
+  page_cache_entry_t *pce;
+
+  pcr->pcr_key = NULL;
+  pcr->pcr_gen = atomic_get(&page_cache_gen);
+  pcr->pcr_epg_gen = atomic_get(&page_cache_epg_gen);
+  pcr->pcr_epg = epg;
+  if (hc->hc_access == NULL)
+    return -1;
+  pcr->pcr_key = page_cache_key(hc, tickets);
+
+  pthread_mutex_lock(&page_cache_lock);
+  LIST_FOREACH(pce, &page_cache_entries, pce_link)
+    if (!strcmp(pce->pce_key, pcr->pcr_key))
+      break;
+  if (pce && !page_cache_valid(pce)) {
+    page_cache_unlink(pce);
+    pce = NULL;
+  }
+  if (pce) {
+    pce->pce_refcnt++;
+    pce->pce_used = mclk();
+  }
+  pthread_mutex_unlock(&page_cache_lock);
+
+  if (pce == NULL)
+    return -1;
+
+  page_cache_send(hc, pce, content);
+  tvhtrace("webui", "%s: cached reply for %s (%zu bytes)",
+           hc->hc_peer_ipstr, hc->hc_url, pce->pce_size);
+
+  pthread_mutex_lock(&page_cache_lock);
+  page_cache_unref(pce);
+  pthread_mutex_unlock(&page_cache_lock);
+
+  free(pcr->pcr_key);
+  pcr->pcr_key = NULL;
+  return 0;
+}
+
+/*
+ * Store the rendered reply (hc->hc_reply) and send it
+ */
+void
+page_cache_end(http_connection_t *hc, page_cache_req_t *pcr,
+               const char *content, int ttl)
+{
+  page_cache_entry_t *pce, *old, *lru;
+  htsbuf_data_t *hd;
+  uint32_t crc = 0;
+  int fd = -1;
+
+  if (pcr->pcr_key == NULL || (fd = page_cache_tmpfile()) < 0)
+    goto fallback;
+
+  TAILQ_FOREACH(hd, &hc->hc_reply.hq_q, hd_link) {
+    const uint8_t *data = hd->hd_data + hd->hd_data_off;
+    size_t len = hd->hd_data_len - hd->hd_data_off;
+    if (tvh_write(fd, data, len))
+      goto fallback;
+    crc = tvh_crc32(data, len, crc);
+  }
+
+  pce = calloc(1, sizeof(*pce));
+  pce->pce_key    = pcr->pcr_key;
+  pce->pce_refcnt = 2; /* list + this request */
+  pce->pce_linked = 1;
+  pce->pce_gen    = pcr->pcr_gen;
+  pce->pce_epg_gen = pcr->pcr_epg_gen;
+  pce->pce_epg    = pcr->pcr_epg;
+  pce->pce_expire = mclk() + sec2mono(ttl);
+  pce->pce_used   = mclk();
+  pce->pce_fd     = fd;
+  pce->pce_size   = hc->hc_reply.hq_size;
+  pce->pce_gzfd   = -1;
+  pthread_mutex_init(&pce->pce_gzlock, NULL);
+  snprintf(pce->pce_etag, sizeof(pce->pce_etag), "\"%08x-%zx\"",
+           crc, pce->pce_size);
+  pcr->pcr_key = NULL;
+
+  pthread_mutex_lock(&page_cache_lock);
+  lru = NULL;
+  LIST_FOREACH(old, &page_cache_entries, pce_link) {
+    if (!strcmp(old->pce_key, pce->pce_key))
+      break;
+    if (lru == NULL || old->pce_used < lru->pce_used)
+      lru = old;
+  }
+  if (old)
+    page_cache_unlink(old);
+  else if (page_cache_count >= PAGE_CACHE_MAX && lru)
+    page_cache_unlink(lru);
+  LIST_INSERT_HEAD(&page_cache_entries, pce, pce_link);
+  page_cache_count++;
+  pthread_mutex_unlock(&page_cache_lock);
+
+  htsbuf_queue_flush(&hc->hc_reply);
+  page_cache_send(hc, pce, content);
+
+  pthread_mutex_lock(&page_cache_lock);
+  page_cache_unref(pce);
+  pthread_mutex_unlock(&page_cache_lock);
+  return;
+
+fallback:
+  if (fd >= 0)
+    close(fd);
+  free(pcr->pcr_key);
+  pcr->pcr_key = NULL;
+  http_output_content(hc, content);
+}
+
+/*
+ * Drop the request without storing (error paths)
+ */
+void
+page_cache_abort(page_cache_req_t *pcr)
+{
+  free(pcr->pcr_key);
+  pcr->pcr_key = NULL;
+}
+
+/*
+ *
+ */
+void
+page_cache_notify(const char *class)
+{
+  if (!strcmp(class, "epg"))
+    atomic_add(&page_cache_epg_gen, 1);
+  else if (!strcmp(class, "channel") || !strcmp(class, "channeltag") ||
+           !strcmp(class, "config"))
+    atomic_add(&page_cache_gen, 1);
+}
+
+/*
+ *
+ */
+void
+page_cache_done(void)
+{
+  page_cache_entry_t *pce;
+
+  pthread_mutex_lock(&page_cache_lock);
+  while ((pce = LIST_FIRST(&page_cache_entries)) != NULL)
+    page_cache_unlink(pce);
+  pthread_mutex_unlock(&page_cache_lock);
+}
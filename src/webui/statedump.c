@@ -173,6 +173,9 @@ page_statedump(http_connection_t *hc, const char *remain, void *opaque)
 
   dumpchannels(hq);
 
+  outputtitle(hq, 0, "Lock profile (top 50 by wait time)");
+  tvh_lockprof_dump(hq, 50);
+
   http_output_content(hc, "text/plain; charset=UTF-8");
   return 0;
 }
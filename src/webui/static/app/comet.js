@@ -43,11 +43,11 @@ tvheadend.cometPoller = function() {
                 });
     });
 
-    function parse_comet_response(responsetxt) {
-        response = Ext.util.JSON.decode(responsetxt);
+    function parse_comet_messages(responsetxt) {
+        var response = Ext.util.JSON.decode(responsetxt);
         tvheadend.boxid = response.boxid;
-        for (x = 0; x < response.messages.length; x++) {
-            m = response.messages[x];
+        for (var x = 0; x < response.messages.length; x++) {
+            var m = response.messages[x];
             if (0) console.log(JSON.stringify(m), null, " ");
             try {
                 tvheadend.comet.fireEvent(m.notificationClass, m);
@@ -55,9 +55,49 @@ tvheadend.cometPoller = function() {
                 tvheadend.log(_('Comet failure') + ' [e=' + e.message + ']');
             }
         }
+    }
+
+    function parse_comet_response(responsetxt) {
+        parse_comet_messages(responsetxt);
         cometRequest.delay(100);
     }
-    ;
 
-    cometRequest.delay(100);
+    /*
+     * Push the notifications over the WebSocket, the long-polling
+     * is used when the connection cannot be established
+     */
+    function cometSocket() {
+        var loc = window.location;
+        var path = loc.pathname.substring(0, loc.pathname.lastIndexOf('/') + 1);
+        var url = (loc.protocol === 'https:' ? 'wss://' : 'ws://') +
+                  loc.host + path + 'comet/ws';
+        var opened = false;
+        var ws;
+
+        if (tvheadend.boxid)
+            url += '?boxid=' + encodeURIComponent(tvheadend.boxid);
+        try {
+            ws = new WebSocket(url);
+        } catch (e) {
+            cometRequest.delay(100);
+            return;
+        }
+        ws.onopen = function() {
+            opened = true;
+        };
+        ws.onmessage = function(ev) {
+            parse_comet_messages(ev.data);
+        };
+        ws.onclose = function() {
+            if (opened)
+                cometSocket.defer(1000);
+            else
+                cometRequest.delay(100);
+        };
+    }
+
+    if (window.WebSocket)
+        cometSocket.defer(100);
+    else
+        cometRequest.delay(100);
 };
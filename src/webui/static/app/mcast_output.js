@@ -0,0 +1,25 @@
+/*
+ * Multicast Output
+ */
+
+tvheadend.mcast_output = function(panel, index)
+{
+    var list = 'enabled,channel,profile,address,port,interface,ttl,' +
+               'rtp,pacing,sap,weight,comment';
+
+    tvheadend.idnode_grid(panel, {
+        url: 'api/mcast_output',
+        titleS: _('Multicast Output'),
+        titleP: _('Multicast Outputs'),
+        iconCls: 'stream',
+        tabIndex: index,
+        uilevel: 'expert',
+        edit: { params: { list: list } },
+        add: {
+            params: { list: list },
+            url: 'api/mcast_output',
+            create: {}
+        },
+        del: true
+    });
+};
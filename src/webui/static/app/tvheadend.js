@@ -723,6 +723,7 @@ function accessUpdate(o) {
             items: []
         });
         tvheadend.esfilter_tab(stream);
+        tvheadend.mcast_output(stream, 7);
 
         cp.add(stream);
 
@@ -944,10 +944,11 @@ static int
 page_http_playlist(http_connection_t *hc, const char *remain, void *opaque)
 {
   char *components[2], *cmd, *s;
-  int nc, r, pltype = PLAYLIST_M3U;
+  int nc, r, pltype = PLAYLIST_M3U, cached;
   channel_t *ch = NULL;
   dvr_entry_t *de = NULL;
   channel_tag_t *tag = NULL;
+  page_cache_req_t pcr;
 
   if (remain && !strcmp(remain, "e2")) {
     pltype = PLAYLIST_E2;
@@ -987,6 +988,13 @@ page_http_playlist(http_connection_t *hc, const char *remain, void *opaque)
   if(nc == 2)
     http_deescape(components[1]);
 
+  /* Recordings are not cached (file sizes) */
+  cached = strcmp(components[0], "dvrid") &&
+           strncmp(components[0], "recordings", 10);
+  if (cached && page_cache_begin(hc, &pcr, pltype == PLAYLIST_E2 ?
+                                 MIME_E2 : MIME_M3U, pltype == PLAYLIST_M3U, 0) == 0)
+    return 0;
+
   pthread_mutex_lock(&global_lock);
 
   if(nc == 2 && !strcmp(components[0], "channelid"))
@@ -1042,8 +1050,14 @@ page_http_playlist(http_connection_t *hc, const char *remain, void *opaque)
 
   pthread_mutex_unlock(&global_lock);
 
-  if (r == 0)
+  if (r == 0 && cached)
+    /* M3U carries tickets (five minutes lifetime), keep it for two minutes */
+    page_cache_end(hc, &pcr, pltype == PLAYLIST_E2 ? MIME_E2 : MIME_M3U,
+                   pltype == PLAYLIST_M3U ? 120 : 3600);
+  else if (r == 0)
     http_output_content(hc, pltype == PLAYLIST_E2 ? MIME_E2 : MIME_M3U);
+  else if (cached)
+    page_cache_abort(&pcr);
 
   return r;
 }
@@ -1881,11 +1895,14 @@ webui_init(int xspf)
   simpleui_start();
   extjs_start();
   comet_init();
+  hls_init();
   webui_api_init();
 }
 
 void
 webui_done(void)
 {
+  hls_done();
+  page_cache_done();
   comet_done();
 }
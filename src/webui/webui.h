@@ -43,6 +43,31 @@ void extjs_start_dvb(void);
 
 void webui_api_init ( void );
 
+/**
+ * Cache for the rendered exports (XMLTV, playlists)
+ */
+typedef struct page_cache_req {
+  char *pcr_key;
+  int   pcr_gen;
+  int   pcr_epg_gen;
+  int   pcr_epg;
+} page_cache_req_t;
+
+int page_cache_begin(http_connection_t *hc, page_cache_req_t *pcr,
+                     const char *content, int tickets, int epg);
+void page_cache_end(http_connection_t *hc, page_cache_req_t *pcr,
+                    const char *content, int ttl);
+void page_cache_abort(page_cache_req_t *pcr);
+void page_cache_notify(const char *class);
+void page_cache_done(void);
+int page_cache_sendfile(http_connection_t *hc, int fd, size_t size);
+
+/**
+ * Shared HLS live output
+ */
+void hls_init(void);
+void hls_done(void);
+
 
 /**
  *
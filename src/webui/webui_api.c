@@ -25,6 +25,16 @@
 #include "htsmsg.h"
 #include "htsmsg_json.h"
 
+static int
+webui_api_stream_write ( api_stream_t *as )
+{
+  http_connection_t *hc = as->as_opaque;
+
+  if (!hc->hc_stream)
+    http_stream_begin(hc, HTTP_STATUS_OK, "text/x-json; charset=UTF-8");
+  return http_stream_write(hc, &as->as_queue);
+}
+
 static int
 webui_api_handler
   ( http_connection_t *hc, const char *remain, void *opaque )
@@ -32,6 +42,7 @@ webui_api_handler
   int r;
   http_arg_t *ha;
   htsmsg_t *args, *resp = NULL;
+  api_stream_t as;
 
   /* Build arguments */
   args = htsmsg_create_map();
@@ -40,8 +51,21 @@ webui_api_handler
   }
       
   /* Call */
-  r = api_exec(hc->hc_access, remain, args, &resp);
+  memset(&as, 0, sizeof(as));
+  htsbuf_queue_init(&as.as_queue, 0);
+  as.as_opaque = hc;
+  as.as_write  = webui_api_stream_write;
+  r = api_exec_stream(hc->hc_access, remain, args, &resp, &as);
   htsmsg_destroy(args);
+
+  /* Streamed response */
+  if (as.as_started) {
+    htsbuf_queue_flush(&as.as_queue);
+    htsmsg_destroy(resp);
+    if (as.as_error || http_stream_end(hc))
+      return -1;
+    return 0;
+  }
   
   /* Convert error */
   if (r) {
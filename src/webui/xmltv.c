@@ -95,19 +95,19 @@ http_xmltv_programme_one(htsbuf_queue_t *hq, const char *hostpath,
   http_xmltv_time(stop, ebc->stop);
   htsbuf_qprintf(hq, "<programme start=\"%s\" stop=\"%s\" channel=\"%s\">\n",
                  start, stop, idnode_uuid_as_str(&ch->ch_id, ubuf));
-  RB_FOREACH(lse, e->title, link) {
+  LANG_STR_FOREACH(lse, e->title) {
     htsbuf_qprintf(hq, "  <title lang=\"%s\">", lse->lang);
     htsbuf_append_and_escape_xml(hq, lse->str);
     htsbuf_append_str(hq, "</title>\n");
   }
   if (e->subtitle)
-    RB_FOREACH(lse, e->subtitle, link) {
+    LANG_STR_FOREACH(lse, e->subtitle) {
       htsbuf_qprintf(hq, "  <sub-title lang=\"%s\">", lse->lang);
       htsbuf_append_and_escape_xml(hq, lse->str);
       htsbuf_append_str(hq, "</sub-title>\n");
     }
   if (ebc->description)
-    RB_FOREACH(lse, ebc->description, link) {
+    LANG_STR_FOREACH(lse, ebc->description) {
       htsbuf_qprintf(hq, "  <desc lang=\"%s\">", lse->lang);
       htsbuf_append_and_escape_xml(hq, lse->str);
       htsbuf_append_str(hq, "</desc>\n");
@@ -225,6 +225,7 @@ page_xmltv(http_connection_t *hc, const char *remain, void *opaque)
   int nc, r;
   channel_t *ch = NULL;
   channel_tag_t *tag = NULL;
+  page_cache_req_t pcr;
 
   if (!remain || *remain == '\0') {
     http_redirect(hc, "/xmltv/channels", &hc->hc_req_args, 0);
@@ -240,6 +241,9 @@ page_xmltv(http_connection_t *hc, const char *remain, void *opaque)
   if (nc == 2)
     http_deescape(components[1]);
 
+  if (page_cache_begin(hc, &pcr, "text/xml", 0, 1) == 0)
+    return 0;
+
   pthread_mutex_lock(&global_lock);
 
   if (nc == 2 && !strcmp(components[0], "channelid"))
@@ -272,7 +276,9 @@ page_xmltv(http_connection_t *hc, const char *remain, void *opaque)
   pthread_mutex_unlock(&global_lock);
 
   if (r == 0)
-    http_output_content(hc, "text/xml");
+    page_cache_end(hc, &pcr, "text/xml", 3600);
+  else
+    page_cache_abort(&pcr);
 
   return r;
 }
@@ -17,6 +17,7 @@
  */
 
 #include "tvheadend.h"
+#include "htsbuf.h"
 
 #define ZLIB_CONST 1
 #include <zlib.h>
@@ -176,3 +177,68 @@ int tvh_gzip_deflate_fd_header ( int fd, const uint8_t *data, size_t orig, int s
   data2[3] = (orig & 0xff);
   return tvh_write(fd, data2, 4);
 }
+
+/* **************************************************************************
+ * Streamed compression
+ * *************************************************************************/
+
+struct z_stream_s *tvh_gzip_deflate_stream_init ( int speed )
+{
+  z_stream *zstr = calloc(1, sizeof(*zstr));
+
+  if (zstr == NULL)
+    return NULL;
+  if (deflateInit2(zstr, speed, Z_DEFLATED, MAX_WBITS + 16 /* gzip */,
+                   MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+    free(zstr);
+    return NULL;
+  }
+  return zstr;
+}
+
+static int tvh_gzip_deflate_stream0
+  ( z_stream *zstr, const uint8_t *data, size_t size,
+    htsbuf_queue_t *out, int flush )
+{
+  uint8_t buf[16384];
+  int err;
+
+  zstr->avail_in = size;
+  zstr->next_in  = (z_const uint8_t *)data;
+  do {
+    zstr->avail_out = sizeof(buf);
+    zstr->next_out  = buf;
+    err = deflate(zstr, flush);
+    if (err != Z_OK && err != Z_STREAM_END && err != Z_BUF_ERROR)
+      return -1;
+    if (zstr->avail_out != sizeof(buf))
+      htsbuf_append(out, buf, sizeof(buf) - zstr->avail_out);
+  } while (zstr->avail_out == 0);
+  return 0;
+}
+
+/*
+ * Compress the whole input queue, the output is flushed (sync or finish),
+ * so the client can decode everything sent so far.
+ */
+int tvh_gzip_deflate_stream
+  ( struct z_stream_s *zstr, htsbuf_queue_t *in, htsbuf_queue_t *out, int finish )
+{
+  htsbuf_data_t *hd;
+
+  TAILQ_FOREACH(hd, &in->hq_q, hd_link)
+    if (tvh_gzip_deflate_stream0(zstr, hd->hd_data + hd->hd_data_off,
+                                 hd->hd_data_len - hd->hd_data_off,
+                                 out, Z_NO_FLUSH))
+      return -1;
+  return tvh_gzip_deflate_stream0(zstr, NULL, 0, out,
+                                  finish ? Z_FINISH : Z_SYNC_FLUSH);
+}
+
+void tvh_gzip_deflate_stream_end ( struct z_stream_s *zstr )
+{
+  if (zstr) {
+    deflateEnd(zstr);
+    free(zstr);
+  }
+}